@@ -0,0 +1,4156 @@
+#pragma once
+
+#include "BibleData/PerfectHashStringMap.h"
+
+/// Root words mapped by original word, which are used for more useful lookups of related verses for similar words.
+/// The data here has been hardcoded based on observation.
+///
+/// This is the source for the root word map in the library (see BibleWordIndex::RootWordsByOriginalWord),
+/// which is generated from these entries by BibleDataCodeFiles::GenerateRootWordMap().  The generator must be
+/// re-run after changing any entries.  Each original word must only have a single entry.
+///
+/// The original table had 4,674 entries for 4,140 distinct original words: 380 original words had more than one entry,
+/// for 534 redundant entries in total.  Only the first entry for each word was ever used, so only those were kept.
+const BIBLE_DATA::PerfectHashStringMap::Entry ROOT_WORD_ENTRIES[] =
+{
+    { "aaronites", "aaron" },
+    { "abased", "abase" },
+    { "abasing", "abase" },
+    { "abhorred", "abhor" },
+    { "abhorrest", "abhor" },
+    { "abhorreth", "abhor" },
+    { "abhorring", "abhor" },
+    { "abideth", "abide" },
+    { "abiding", "abide" },
+    { "abiezrites", "abiezrite" },
+    { "abodest", "abode" },
+    { "abolished", "abolish" },
+    { "abominable", "abominate" },
+    { "abominably", "abominate" },
+    { "abomination", "abominate" },
+    { "abominations", "abominate" },
+    { "abounded", "abound" },
+    { "aboundeth", "abound" },
+    { "abounding", "abound" },
+    { "absence", "absent" },
+    { "abstinence", "abstain" },
+    { "abundance", "abundant" },
+    { "abundantly", "abundant" },
+    { "abused", "abuse" },
+    { "abusers", "abuse" },
+    { "abusing", "abuse" },
+    { "acceptable", "accept" },
+    { "acceptably", "accept" },
+    { "acceptance", "accept" },
+    { "acceptation", "accept" },
+    { "accepted", "accept" },
+    { "acceptest", "accept" },
+    { "accepteth", "accept" },
+    { "accepting", "accept" },
+    { "accompanied", "accompany" },
+    { "accompanying", "accompany" },
+    { "accomplished", "accomplish" },
+    { "accomplishing", "accomplish" },
+    { "accomplishment", "accomplish" },
+    { "according", "accord" },
+    { "accordingly", "accord" },
+    { "accounted", "account" },
+    { "accounting", "account" },
+    { "accounts", "account" },
+    { "accusation", "accuse" },
+    { "accused", "accuse" },
+    { "accuser", "accuse" },
+    { "accusers", "accuse" },
+    { "accuseth", "accuse" },
+    { "accusing", "accuse" },
+    { "acknowledged", "acknowledge" },
+    { "acknowledgement", "acknowledge" },
+    { "acknowledgeth", "acknowledge" },
+    { "acknowledging", "acknowledge" },
+    { "acquaintance", "acquaint" },
+    { "acquainted", "acquaint" },
+    { "acquainting", "acquaint" },
+    { "acres", "acre" },
+    { "acts", "act" },
+    { "added", "add" },
+    { "addeth", "add" },
+    { "addition", "add" },
+    { "additions", "add" },
+    { "adders", "adder" },
+    { "adjured", "adjure" },
+    { "administered", "administer" },
+    { "administration", "administer" },
+    { "administrations", "administer" },
+    { "admiration", "admire" },
+    { "admired", "admire" },
+    { "admonished", "admonish" },
+    { "admonishing", "admonish" },
+    { "admonition", "admonish" },
+    { "adorned", "adorn" },
+    { "adorneth", "adorn" },
+    { "adorning", "adorn" },
+    { "adullamite", "adullam" },
+    { "adulterer", "adultery" },
+    { "adulterers", "adultery" },
+    { "adulteress", "adultery" },
+    { "adulteresses", "adultery" },
+    { "adulteries", "adultery" },
+    { "adulterous", "adultery" },
+    { "advantaged", "advantage" },
+    { "advantageth", "advantage" },
+    { "adventured", "adventure" },
+    { "adversaries", "adversary" },
+    { "adversities", "adversity" },
+    { "advise", "advice" },
+    { "advised", "advice" },
+    { "advisement", "advice" },
+    { "affected", "affect" },
+    { "affecteth", "affect" },
+    { "affectionately", "affection" },
+    { "affectioned", "affection" },
+    { "affections", "affection" },
+    { "affirmed", "affirm" },
+    { "afflicted", "afflict" },
+    { "afflictest", "afflict" },
+    { "affliction", "afflict" },
+    { "afflictions", "afflict" },
+    { "affrighted", "affright" },
+    { "afterwards", "afterward" },
+    { "agagite", "agag" },
+    { "agates", "agate" },
+    { "aged", "age" },
+    { "ages", "age" },
+    { "agreed", "agree" },
+    { "agreement", "agree" },
+    { "ahiramites", "ahiram" },
+    { "alexandrians", "alexandria" },
+    { "alienate", "alien" },
+    { "alienated", "alien" },
+    { "aliens", "alien" },
+    { "allowance", "allow" },
+    { "allowed", "allow" },
+    { "alloweth", "allow" },
+    { "almonds", "almond" },
+    { "altars", "altar" },
+    { "altered", "alter" },
+    { "altereth", "alter" },
+    { "amalekite", "amalek" },
+    { "amalekites", "amalek" },
+    { "amazed", "amaze" },
+    { "amazement", "amaze" },
+    { "ambassadors", "ambassador" },
+    { "ambushes", "ambush" },
+    { "ambushment", "ambush" },
+    { "ambushments", "ambush" },
+    { "amends", "amend" },
+    { "ammonite", "ammon" },
+    { "ammonites", "ammon" },
+    { "ammonitess", "ammon" },
+    { "amongst", "among" },
+    { "amorites", "amorite" },
+    { "amramites", "amram" },
+    { "anakims", "anak" },
+    { "anchors", "anchor" },
+    { "ancients", "ancient" },
+    { "angels", "angel" },
+    { "angered", "anger" },
+    { "angry", "anger" },
+    { "ankles", "ankle" },
+    { "anointed", "anoint" },
+    { "anointedst", "anoint" },
+    { "anointest", "anoint" },
+    { "anointing", "anoint" },
+    { "answerable", "answer" },
+    { "answered", "answer" },
+    { "answeredst", "answer" },
+    { "answerest", "answer" },
+    { "answereth", "answer" },
+    { "answering", "answer" },
+    { "answers", "answer" },
+    { "antichrists", "antichrist" },
+    { "ants", "ant" },
+    { "apostles", "apostle" },
+    { "apostleship", "apostle" },
+    { "apothecaries", "apothecary" },
+    { "apparelled", "apparel" },
+    { "appealed", "appeal" },
+    { "appearance", "appear" },
+    { "appearances", "appear" },
+    { "appeared", "appear" },
+    { "appeareth", "appear" },
+    { "appearing", "appear" },
+    { "appeased", "appease" },
+    { "appeaseth", "appease" },
+    { "appertained", "appertain" },
+    { "appertaineth", "appertain" },
+    { "apples", "apple" },
+    { "applied", "apply" },
+    { "appointed", "appoint" },
+    { "appointeth", "appoint" },
+    { "appointment", "appoint" },
+    { "apprehended", "apprehend" },
+    { "approached", "approach" },
+    { "approacheth", "approach" },
+    { "approaching", "approach" },
+    { "approved", "approve" },
+    { "approvest", "approve" },
+    { "approveth", "approve" },
+    { "approving", "approve" },
+    { "arabian", "arabia" },
+    { "arabians", "arabia" },
+    { "aramites", "aram" },
+    { "archers", "archer" },
+    { "arguing", "argue" },
+    { "arguments", "argue" },
+    { "ariseth", "arise" },
+    { "arising", "arise" },
+    { "aroerite", "aroer" },
+    { "arrayed", "array" },
+    { "arrows", "arrow" },
+    { "artificers", "artificer" },
+    { "arvadite", "arvad" },
+    { "ascended", "ascend" },
+    { "ascendeth", "ascend" },
+    { "ascending", "ascend" },
+    { "ascent", "ascend" },
+    { "ascribed", "ascribe" },
+    { "ashamed", "shame" },
+    { "ashbelites", "ashbel" },
+    { "ashdodites", "ashdodites" },
+    { "asherites", "asher" },
+    { "ashes", "ash" },
+    { "ashtarothite", "ashtaroth" },
+    { "ashurites", "ashur" },
+    { "asked", "ask" },
+    { "askest", "ask" },
+    { "asketh", "ask" },
+    { "asking", "ask" },
+    { "asleep", "sleep" },
+    { "asps", "asp" },
+    { "asrielites", "asriel" },
+    { "assaulted", "assault" },
+    { "assayed", "assay" },
+    { "assaying", "assay" },
+    { "assembled", "assemble" },
+    { "assemblies", "assemble" },
+    { "assembling", "assemble" },
+    { "assembly", "assemble" },
+    { "assented", "assent" },
+    { "asses", "ass" },
+    { "assurance", "assure" },
+    { "assured", "assure" },
+    { "assuredly", "assure" },
+    { "asswaged", "asswage" },
+    { "assyrian", "assyria" },
+    { "assyrians", "assyria" },
+    { "astonished", "astonish" },
+    { "astonishment", "astonish" },
+    { "astrologers", "astrologer" },
+    { "athenians", "athens" },
+    { "atonements", "atonement" },
+    { "attained", "attain" },
+    { "attendance", "attend" },
+    { "attended", "attend" },
+    { "attending", "attend" },
+    { "attentive", "attent" },
+    { "attentively", "attent" },
+    { "attired", "attire" },
+    { "authorities", "authority" },
+    { "avenged", "avenge" },
+    { "avenger", "avenge" },
+    { "avengeth", "avenge" },
+    { "avenging", "avenge" },
+    { "avoided", "avoid" },
+    { "avoiding", "avoid" },
+    { "awaked", "awake" },
+    { "awakest", "awake" },
+    { "awaketh", "awake" },
+    { "awaking", "awake" },
+    { "awoke", "awake" },
+    { "axes", "axe" },
+    { "babylonians", "babylon" },
+    { "babylonish", "babylon" },
+    { "backs", "back" },
+    { "backbiters", "backbite" },
+    { "backbiteth", "backbite" },
+    { "backbiting", "backbite" },
+    { "backbitings", "backbite" },
+    { "backslider", "backslide" },
+    { "backsliding", "backslide" },
+    { "backslidings", "backslide" },
+    { "badest", "bade" },
+    { "bags", "bag" },
+    { "baked", "bake" },
+    { "baker", "bake" },
+    { "bakers", "bake" },
+    { "baketh", "bake" },
+    { "balances", "balance" },
+    { "balancings", "balance" },
+    { "baldness", "bald" },
+    { "banded", "band" },
+    { "bands", "band" },
+    { "banished", "banish" },
+    { "banishment", "banish" },
+    { "banks", "bank" },
+    { "banners", "banner" },
+    { "banqueting", "banquet" },
+    { "banquetings", "banquet" },
+    { "baptism", "baptize" },
+    { "baptisms", "baptize" },
+    { "baptist", "baptize" },
+    { "baptized", "baptize" },
+    { "baptizest", "baptize" },
+    { "baptizeth", "baptize" },
+    { "baptizing", "baptize" },
+    { "barbarians", "barbarian" },
+    { "barbarous", "barbarian" },
+    { "barked", "bark" },
+    { "barns", "barn" },
+    { "barrels", "barrel" },
+    { "barrenness", "barren" },
+    { "bars", "bar" },
+    { "bases", "base" },
+    { "basest", "base" },
+    { "baskets", "basket" },
+    { "basons", "bason" },
+    { "bastards", "bastard" },
+    { "bats", "bat" },
+    { "bathe", "bath" },
+    { "bathed", "bath" },
+    { "baths", "bath" },
+    { "battered", "batter" },
+    { "battering", "batter" },
+    { "battles", "battle" },
+    { "battlements", "battlement" },
+    { "beams", "beam" },
+    { "beards", "beard" },
+    { "beasts", "beast" },
+    { "beaten", "beat" },
+    { "beatest", "beat" },
+    { "beateth", "beat" },
+    { "beating", "beat" },
+    { "beauties", "beauty" },
+    { "beautiful", "beauty" },
+    { "beautify", "beauty" },
+    { "becamest", "become" },
+    { "beckoned", "beckon" },
+    { "beckoning", "beckon" },
+    { "becometh", "become" },
+    { "beds", "bed" },
+    { "bees", "bee" },
+    { "befallen", "befall" },
+    { "befalleth", "befall" },
+    { "befell", "befall" },
+    { "beget", "begat" },
+    { "begettest", "begat" },
+    { "begetteth", "begat" },
+    { "beggar", "beg" },
+    { "beggarly", "beg" },
+    { "begged", "beg" },
+    { "begging", "beg" },
+    { "began", "begin" },
+    { "beginnest", "begin" },
+    { "beginning", "begin" },
+    { "beginnings", "begin" },
+    { "begotten", "begat" },
+    { "beguiled", "beguile" },
+    { "beguiling", "beguile" },
+    { "begun", "begin" },
+    { "behaved", "behave" },
+    { "behaveth", "behave" },
+    { "behaviour", "behave" },
+    { "beheld", "behold" },
+    { "beholdest", "behold" },
+    { "beholdeth", "behold" },
+    { "beholding", "behold" },
+    { "believe", "belief" },
+    { "believed", "belief" },
+    { "believers", "belief" },
+    { "believest", "belief" },
+    { "believeth", "belief" },
+    { "believing", "belief" },
+    { "bellows", "bellow" },
+    { "bells", "bell" },
+    { "bellies", "belly" },
+    { "belonged", "belong" },
+    { "belongest", "belong" },
+    { "belongeth", "belong" },
+    { "belonging", "belong" },
+    { "bemoaned", "bemoan" },
+    { "bemoaning", "bemoan" },
+    { "bendeth", "bend" },
+    { "bending", "bend" },
+    { "benefits", "benefit" },
+    { "benjamite", "benjamin" },
+    { "benjamites", "benjamin" },
+    { "bent", "bend" },
+    { "bereaved", "bereave" },
+    { "bereaveth", "bereave" },
+    { "beseeching", "beseech" },
+    { "besides", "beside" },
+    { "besieged", "besiege" },
+    { "bestowed", "bestow" },
+    { "betrayed", "betray" },
+    { "betrayers", "betray" },
+    { "betrayest", "betray" },
+    { "betrayeth", "betray" },
+    { "betrothed", "betroth" },
+    { "bettered", "better" },
+    { "bewailed", "bewail" },
+    { "bewaileth", "bewail" },
+    { "bewrayeth", "bewray" },
+    { "bidden", "bid" },
+    { "biddeth", "bid" },
+    { "bidding", "bid" },
+    { "bindeth", "bind" },
+    { "binding", "bind" },
+    { "birds", "bird" },
+    { "bishops", "bishop" },
+    { "biteth", "biteth" },
+    { "bitterly", "bitter" },
+    { "bitterness", "bitter" },
+    { "blacker", "black" },
+    { "blackish", "black" },
+    { "blackness", "black" },
+    { "blamed", "blame" },
+    { "blameless", "blame" },
+    { "blaspheme", "blasphemy" },
+    { "blasphemed", "blasphemy" },
+    { "blasphemer", "blasphemy" },
+    { "blasphemers", "blasphemy" },
+    { "blasphemest", "blasphemy" },
+    { "blasphemeth", "blasphemy" },
+    { "blasphemies", "blasphemy" },
+    { "blaspheming", "blasphemy" },
+    { "blasphemous", "blasphemy" },
+    { "blasphemously", "blasphemy" },
+    { "blasted", "blast" },
+    { "blasting", "blast" },
+    { "bleatings", "bleating" },
+    { "blemishes", "blemish" },
+    { "blessed", "bless" },
+    { "blessedness", "bless" },
+    { "blessest", "bless" },
+    { "blesseth", "bless" },
+    { "blessing", "bless" },
+    { "blessings", "bless" },
+    { "blinded", "blind" },
+    { "blindeth", "blind" },
+    { "blindfolded", "blind" },
+    { "blindness", "blind" },
+    { "bloodguiltiness", "blood" },
+    { "bloodthirsty", "blood" },
+    { "bloody", "blood" },
+    { "blossomed", "blossom" },
+    { "blossoms", "blossom" },
+    { "blotted", "blot" },
+    { "blotteth", "blot" },
+    { "blotting", "blot" },
+    { "bloweth", "blow" },
+    { "blowing", "blow" },
+    { "blown", "blow" },
+    { "blueness", "blue" },
+    { "boards", "board" },
+    { "boasted", "boast" },
+    { "boasters", "boast" },
+    { "boastest", "boast" },
+    { "boasteth", "boast" },
+    { "boasting", "boast" },
+    { "boastings", "boast" },
+    { "boats", "boat" },
+    { "bodies", "body" },
+    { "bodily", "body" },
+    { "boiled", "boil" },
+    { "boiling", "boil" },
+    { "boils", "boil" },
+    { "boldly", "bold" },
+    { "boldness", "bold" },
+    { "bolted", "bolt" },
+    { "bonds", "bond" },
+    { "bondmaids", "bondmaids" },
+    { "bondmen", "bondman" },
+    { "bondwomen", "bondwoman" },
+    { "bones", "bone" },
+    { "books", "book" },
+    { "booths", "booth" },
+    { "booties", "booty" },
+    { "borders", "border" },
+    { "borrowed", "borrow" },
+    { "borroweth", "borrow" },
+    { "bottles", "bottle" },
+    { "bottoms", "bottom" },
+    { "boughs", "bough" },
+    { "bounds", "bound" },
+    { "bountifully", "bountiful" },
+    { "bountifulness", "bountiful" },
+    { "bowls", "bowl" },
+    { "bows", "bow" },
+    { "boys", "boy" },
+    { "bracelets", "bracelet" },
+    { "brambles", "bramble" },
+    { "branches", "branch" },
+    { "brands", "brand" },
+    { "brawlers", "brawler" },
+    { "brayed", "bray" },
+    { "breaches", "breach" },
+    { "breaker", "break" },
+    { "breakest", "break" },
+    { "breaketh", "break" },
+    { "breaking", "break" },
+    { "breakings", "break" },
+    { "breasts", "breast" },
+    { "breastplates", "breastplate" },
+    { "breathe", "breath" },
+    { "breathed", "breath" },
+    { "breatheth", "breath" },
+    { "breathing", "breath" },
+    { "breeding", "breed" },
+    { "bribery", "bribe" },
+    { "brides", "bribe" },
+    { "bricks", "brick" },
+    { "bridles", "bridle" },
+    { "bridleth", "bridle" },
+    { "brigandines", "brigandine" },
+    { "brightness", "bright" },
+    { "bringers", "bring" },
+    { "bringest", "bring" },
+    { "bringeth", "bring" },
+    { "bringing", "bring" },
+    { "broader", "broad" },
+    { "brooks", "brook" },
+    { "broughtest", "brought" },
+    { "bruised", "bruise" },
+    { "bruises", "bruise" },
+    { "bruising", "bruise" },
+    { "brutish", "brute" },
+    { "buckets", "bucket" },
+    { "bucklers", "buckler" },
+    { "budded", "bud" },
+    { "buds", "bud" },
+    { "buffeted", "buffet" },
+    { "builded", "build" },
+    { "buildedst", "build" },
+    { "builder", "build" },
+    { "builders", "build" },
+    { "buildest", "build" },
+    { "buildeth", "build" },
+    { "building", "build" },
+    { "built", "build" },
+    { "bulls", "bull" },
+    { "bullocks", "bullock" },
+    { "bulrushes", "bulrush" },
+    { "bunches", "bunch" },
+    { "bundles", "bundle" },
+    { "burdened", "burden" },
+    { "burdens", "burden" },
+    { "burdensome", "burden" },
+    { "burned", "burn" },
+    { "burneth", "burn" },
+    { "burning", "burn" },
+    { "burnings", "burn" },
+    { "burnt", "burn" },
+    { "bursting", "burst" },
+    { "burying", "bury" },
+    { "bushes", "bush" },
+    { "busybodies", "busybody" },
+    { "butlers", "butler" },
+    { "buyer", "buy" },
+    { "buyest", "buy" },
+    { "buyeth", "buy" },
+    { "cakes", "cake" },
+    { "caldrons", "caldron" },
+    { "called", "call" },
+    { "calledst", "call" },
+    { "callest", "call" },
+    { "calleth", "call" },
+    { "calling", "call" },
+    { "calved", "calve" },
+    { "calves", "calve" },
+    { "calveth", "calve" },
+    { "camest", "came" },
+    { "camels", "camel" },
+    { "camped", "camp" },
+    { "camps", "camp" },
+    { "canaanite", "canaan" },
+    { "canaanites", "canaanite" },
+    { "canaanitess", "canaanites" },
+    { "candles", "candle" },
+    { "candlesticks", "candlestick" },
+    { "cankered", "canker" },
+    { "caphtorims", "caphtorim" },
+    { "capitals", "capital" },
+    { "captains", "captain" },
+    { "captivated", "captivate" },
+    { "captives", "captive" },
+    { "caravans", "caravan" },
+    { "carbuncles", "carbuncle" },
+    { "carcases", "carcas" },
+    { "carcass", "carcas" },
+    { "carcasses", "carcass" },
+    { "cared", "car" },
+    { "cares", "car" },
+    { "carest", "care" },
+    { "caring", "car" },
+    { "carmelite", "carmel" },
+    { "carousings", "carousing" },
+    { "carpenters", "carpenter" },
+    { "carriages", "carriage" },
+    { "carrying", "carry" },
+    { "carts", "cart" },
+    { "carvings", "carving" },
+    { "cases", "case" },
+    { "castest", "casts" },
+    { "casting", "cast" },
+    { "castles", "castle" },
+    { "casts", "cast" },
+    { "catches", "catch" },
+    { "caterpillers", "caterpiller" },
+    { "cauls", "caul" },
+    { "caused", "cause" },
+    { "causes", "cause" },
+    { "causest", "cause" },
+    { "causing", "cause" },
+    { "caves", "cave" },
+    { "ceased", "cease" },
+    { "ceases", "cease" },
+    { "ceasing", "cease" },
+    { "cedars", "cedar" },
+    { "ceilings", "ceiling" },
+    { "cellars", "cellar" },
+    { "cells", "cell" },
+    { "censers", "censer" },
+    { "centurions", "centurion" },
+    { "chains", "chain" },
+    { "chaldeans", "chaldean" },
+    { "chambering", "chamber" },
+    { "chamberlains", "chamberlain" },
+    { "chambers", "chamber" },
+    { "changed", "change" },
+    { "changes", "change" },
+    { "changest", "change" },
+    { "changing", "change" },
+    { "channels", "channel" },
+    { "chapiters", "chapiter" },
+    { "charged", "charge" },
+    { "chargers", "charger" },
+    { "charges", "charge" },
+    { "chargest", "charge" },
+    { "charging", "charge" },
+    { "chariots", "chariot" },
+    { "charmed", "charm" },
+    { "charmers", "charmer" },
+    { "charming", "charm" },
+    { "chased", "chase" },
+    { "chases", "chase" },
+    { "chasing", "chase" },
+    { "chastened", "chasten" },
+    { "chastenest", "chastens" },
+    { "chastening", "chasten" },
+    { "chastens", "chasten" },
+    { "chastised", "chastise" },
+    { "chattering", "chatter" },
+    { "checked", "check" },
+    { "cheeks", "cheek" },
+    { "cheered", "cheer" },
+    { "cheers", "cheer" },
+    { "cheeses", "cheese" },
+    { "cherished", "cherish" },
+    { "cherishes", "cherish" },
+    { "cherubims", "cherubim" },
+    { "cherubs", "cherub" },
+    { "chests", "chest" },
+    { "chewed", "chew" },
+    { "chews", "chew" },
+    { "chiding", "chide" },
+    { "chiefest", "chiefs" },
+    { "chiefing", "chief" },
+    { "chiefs", "chief" },
+    { "chieftains", "chieftain" },
+    { "chirped", "chirp" },
+    { "chiseled", "chisel" },
+    { "chiseling", "chisel" },
+    { "choicest", "choice" },
+    { "choked", "choke" },
+    { "chooses", "choose" },
+    { "choosest", "choose" },
+    { "choosing", "choose" },
+    { "christians", "christian" },
+    { "christs", "christ" },
+    { "churches", "church" },
+    { "chuzas", "chuza" },
+    { "circled", "circle" },
+    { "circuits", "circuit" },
+    { "circumcised", "circumcise" },
+    { "circumcising", "circumcise" },
+    { "cisterns", "cistern" },
+    { "citizens", "citizen" },
+    { "claimed", "claim" },
+    { "claps", "clap" },
+    { "clasps", "clasp" },
+    { "cleansed", "cleanse" },
+    { "cleanses", "cleanse" },
+    { "cleansing", "cleanse" },
+    { "cleared", "clear" },
+    { "clearing", "clear" },
+    { "clears", "clear" },
+    { "cleaved", "cleave" },
+    { "cleaves", "cleave" },
+    { "clefts", "cleft" },
+    { "clifts", "clift" },
+    { "climbed", "climb" },
+    { "climbs", "climb" },
+    { "clings", "cling" },
+    { "cloaks", "cloak" },
+    { "closed", "close" },
+    { "closes", "close" },
+    { "closest", "close" },
+    { "closets", "closet" },
+    { "clothed", "cloth" },
+    { "clothes", "cloth" },
+    { "clothest", "clothe" },
+    { "clothing", "cloth" },
+    { "cloths", "cloth" },
+    { "clouds", "cloud" },
+    { "clubs", "club" },
+    { "clusters", "cluster" },
+    { "coals", "coal" },
+    { "coasts", "coast" },
+    { "coated", "coat" },
+    { "coats", "coat" },
+    { "cockatrices", "cockatrice" },
+    { "collapsed", "collapse" },
+    { "collars", "collar" },
+    { "collected", "collect" },
+    { "collections", "collection" },
+    { "collectors", "collector" },
+    { "colored", "color" },
+    { "colors", "color" },
+    { "coloured", "colour" },
+    { "colours", "colour" },
+    { "colts", "colt" },
+    { "comes", "come" },
+    { "comest", "come" },
+    { "comforted", "comfort" },
+    { "comforters", "comforter" },
+    { "comforts", "comfort" },
+    { "coming", "come" },
+    { "comings", "coming" },
+    { "commanded", "command" },
+    { "commandest", "commands" },
+    { "commanding", "command" },
+    { "commandments", "commandment" },
+    { "commands", "command" },
+    { "commended", "commend" },
+    { "commending", "commend" },
+    { "commends", "commend" },
+    { "commissions", "commission" },
+    { "commits", "commit" },
+    { "commotions", "commotion" },
+    { "communed", "commune" },
+    { "communicated", "communicate" },
+    { "communications", "communication" },
+    { "communing", "commune" },
+    { "compacted", "compact" },
+    { "companions", "companion" },
+    { "compared", "compare" },
+    { "comparing", "compare" },
+    { "compassed", "compass" },
+    { "compasses", "compass" },
+    { "compassing", "compass" },
+    { "compassions", "compassion" },
+    { "compels", "compel" },
+    { "complained", "complain" },
+    { "complaining", "complain" },
+    { "complaints", "complaint" },
+    { "completed", "complete" },
+    { "compounded", "compound" },
+    { "compounds", "compound" },
+    { "comprehended", "comprehend" },
+    { "concealed", "conceal" },
+    { "conceals", "conceal" },
+    { "conceited", "conceit" },
+    { "conceits", "conceit" },
+    { "conceived", "conceive" },
+    { "conceiving", "conceive" },
+    { "concerned", "concern" },
+    { "concerning", "concern" },
+    { "concerns", "concern" },
+    { "concluded", "conclude" },
+    { "concluding", "conclude" },
+    { "concubines", "concubine" },
+    { "condemned", "condemn" },
+    { "condemnest", "condemns" },
+    { "condemning", "condemn" },
+    { "condemns", "condemn" },
+    { "conditions", "condition" },
+    { "conducted", "conduct" },
+    { "conducting", "conduct" },
+    { "confections", "confection" },
+    { "confessed", "confess" },
+    { "confesses", "confess" },
+    { "confessing", "confess" },
+    { "confidences", "confidence" },
+    { "confirmed", "confirm" },
+    { "confirming", "confirm" },
+    { "confirms", "confirm" },
+    { "confounded", "confound" },
+    { "confused", "confuse" },
+    { "confusing", "confuse" },
+    { "congregations", "congregation" },
+    { "conquering", "conquer" },
+    { "consciences", "conscience" },
+    { "consecrated", "consecrate" },
+    { "consecrations", "consecration" },
+    { "consented", "consent" },
+    { "consenting", "consent" },
+    { "considered", "consider" },
+    { "considerest", "considers" },
+    { "considering", "consider" },
+    { "considers", "consider" },
+    { "consolations", "consolation" },
+    { "consoled", "console" },
+    { "consoling", "console" },
+    { "conspired", "conspire" },
+    { "constrained", "constrain" },
+    { "constrains", "constrain" },
+    { "consulted", "consult" },
+    { "consumed", "consume" },
+    { "consumes", "consume" },
+    { "consuming", "consume" },
+    { "contained", "contain" },
+    { "containers", "container" },
+    { "containing", "contain" },
+    { "contains", "contain" },
+    { "contemned", "contemn" },
+    { "contended", "contend" },
+    { "contendest", "contends" },
+    { "contending", "contend" },
+    { "contends", "contend" },
+    { "contentions", "contention" },
+    { "continued", "continue" },
+    { "continues", "continue" },
+    { "continuing", "continue" },
+    { "contradicted", "contradict" },
+    { "contradicting", "contradict" },
+    { "controls", "control" },
+    { "converted", "convert" },
+    { "converting", "convert" },
+    { "converts", "convert" },
+    { "conveyed", "convey" },
+    { "convicted", "convict" },
+    { "convicts", "convict" },
+    { "convinced", "convince" },
+    { "convocations", "convocation" },
+    { "cooks", "cook" },
+    { "coping", "copy" },
+    { "cord", "cor" },
+    { "cords", "cord" },
+    { "corners", "corner" },
+    { "cornets", "cornet" },
+    { "corpses", "corpse" },
+    { "corrected", "correct" },
+    { "correcting", "correct" },
+    { "corrects", "correct" },
+    { "corrupted", "corrupt" },
+    { "corrupting", "corrupt" },
+    { "cors", "cor" },
+    { "costs", "cost" },
+    { "cotes", "cot" },
+    { "cots", "cot" },
+    { "cottages", "cottage" },
+    { "couched", "couch" },
+    { "couches", "couch" },
+    { "couching", "couch" },
+    { "couldest", "couldn" },
+    { "coulding", "could" },
+    { "coulters", "coulter" },
+    { "councils", "council" },
+    { "counseled", "counsel" },
+    { "counsellors", "counsellor" },
+    { "counselors", "counselor" },
+    { "counsels", "counsel" },
+    { "counted", "count" },
+    { "countenances", "countenance" },
+    { "counting", "count" },
+    { "counts", "count" },
+    { "coupled", "couple" },
+    { "coupling", "couple" },
+    { "couplings", "coupling" },
+    { "courses", "course" },
+    { "courts", "court" },
+    { "cousins", "cousin" },
+    { "covenanted", "covenant" },
+    { "covenants", "covenant" },
+    { "covered", "cover" },
+    { "coverest", "covers" },
+    { "covering", "cover" },
+    { "coverings", "covering" },
+    { "covers", "cover" },
+    { "coverts", "covert" },
+    { "coveted", "covet" },
+    { "coveting", "covet" },
+    { "covetings", "coveting" },
+    { "cows", "cow" },
+    { "craved", "crave" },
+    { "craving", "crave" },
+    { "cravings", "craving" },
+    { "created", "create" },
+    { "creates", "create" },
+    { "creatures", "creature" },
+    { "credited", "credit" },
+    { "creditors", "creditor" },
+    { "creeks", "creek" },
+    { "creeping", "creep" },
+    { "creeps", "creep" },
+    { "cretes", "crete" },
+    { "criest", "crib" },
+    { "crimes", "crime" },
+    { "criminals", "criminal" },
+    { "crippled", "cripple" },
+    { "crooked", "crook" },
+    { "crops", "crop" },
+    { "crossed", "cross" },
+    { "crossing", "cross" },
+    { "crouches", "crouch" },
+    { "crowd", "crow" },
+    { "crowed", "crow" },
+    { "crowned", "crown" },
+    { "crownest", "crowns" },
+    { "crowning", "crown" },
+    { "crowns", "crown" },
+    { "crows", "crow" },
+    { "crucifying", "crucify" },
+    { "crushed", "crush" },
+    { "crushes", "crush" },
+    { "crying", "cry" },
+    { "cubits", "cubit" },
+    { "cubs", "cub" },
+    { "cupbearers", "cupbearer" },
+    { "cups", "cup" },
+    { "cured", "cure" },
+    { "cures", "cure" },
+    { "cursed", "curse" },
+    { "curses", "curse" },
+    { "cursest", "curse" },
+    { "cursing", "curse" },
+    { "cursings", "cursing" },
+    { "curtains", "curtain" },
+    { "cushions", "cushion" },
+    { "cushite", "cush" },
+    { "cushites", "cushite" },
+    { "customs", "custom" },
+    { "cuts", "cut" },
+    { "cuttings", "cutting" },
+    { "cymbals", "cymbal" },
+    { "cyrenians", "cyrenian" },
+    { "damsels", "damsel" },
+    { "danced", "dance" },
+    { "dances", "dance" },
+    { "dancing", "dance" },
+    { "dared", "dare" },
+    { "dares", "dare" },
+    { "daring", "dara" },
+    { "darkened", "darken" },
+    { "darkens", "darken" },
+    { "darking", "dark" },
+    { "darting", "dart" },
+    { "darts", "dart" },
+    { "dashed", "dash" },
+    { "dashes", "dash" },
+    { "daubed", "daub" },
+    { "daubing", "daub" },
+    { "daughters", "daughter" },
+    { "dawning", "dawn" },
+    { "dawns", "dawn" },
+    { "days", "day" },
+    { "deacons", "deacon" },
+    { "dealers", "dealer" },
+    { "dealest", "deals" },
+    { "dealing", "deal" },
+    { "dealings", "dealing" },
+    { "deals", "deal" },
+    { "deaths", "death" },
+    { "debates", "debate" },
+    { "debtors", "debtor" },
+    { "debts", "debt" },
+    { "decayed", "decay" },
+    { "decaying", "decay" },
+    { "deceased", "decease" },
+    { "deceits", "deceit" },
+    { "deceived", "deceive" },
+    { "deceivers", "deceiver" },
+    { "deceives", "deceive" },
+    { "deceiving", "deceive" },
+    { "deceivings", "deceiving" },
+    { "decided", "decide" },
+    { "decked", "deck" },
+    { "deckest", "decks" },
+    { "decking", "deck" },
+    { "decks", "deck" },
+    { "declared", "declare" },
+    { "declares", "declare" },
+    { "declaring", "declare" },
+    { "declined", "decline" },
+    { "declines", "decline" },
+    { "decorated", "decorate" },
+    { "decreased", "decrease" },
+    { "decreed", "decree" },
+    { "decrees", "decree" },
+    { "dedicated", "dedicate" },
+    { "dedicating", "dedicate" },
+    { "deeds", "deed" },
+    { "deeps", "deep" },
+    { "defeated", "defeat" },
+    { "defenced", "defence" },
+    { "defended", "defend" },
+    { "defending", "defend" },
+    { "defenses", "defense" },
+    { "defiled", "defile" },
+    { "defiles", "defile" },
+    { "defrauded", "defraud" },
+    { "degrees", "degree" },
+    { "delayed", "delay" },
+    { "delaying", "delay" },
+    { "delays", "delay" },
+    { "delicates", "delicate" },
+    { "delighted", "delight" },
+    { "delightest", "delights" },
+    { "delighting", "delight" },
+    { "delights", "delight" },
+    { "deliverances", "deliverance" },
+    { "delivered", "deliver" },
+    { "deliverest", "delivers" },
+    { "delivering", "deliver" },
+    { "delivers", "deliver" },
+    { "deluding", "delude" },
+    { "delusions", "delusion" },
+    { "demanded", "demand" },
+    { "demands", "demand" },
+    { "demons", "demon" },
+    { "denounced", "denounce" },
+    { "denounces", "denounce" },
+    { "dens", "den" },
+    { "denying", "deny" },
+    { "departed", "depart" },
+    { "departing", "depart" },
+    { "departs", "depart" },
+    { "depended", "depend" },
+    { "deposited", "deposit" },
+    { "deprived", "deprive" },
+    { "depths", "depth" },
+    { "derided", "deride" },
+    { "descendants", "descendant" },
+    { "descended", "descend" },
+    { "descending", "descend" },
+    { "described", "describe" },
+    { "deserted", "desert" },
+    { "deserting", "desert" },
+    { "deserts", "desert" },
+    { "deserves", "deserve" },
+    { "deserving", "deserve" },
+    { "desired", "desire" },
+    { "desires", "desire" },
+    { "desirest", "desire" },
+    { "desiring", "desire" },
+    { "desolations", "desolation" },
+    { "despaired", "despair" },
+    { "despised", "despise" },
+    { "despises", "despise" },
+    { "despisest", "despise" },
+    { "despising", "despise" },
+    { "despoiled", "despoil" },
+    { "destroyed", "destroy" },
+    { "destroyers", "destroyer" },
+    { "destroyest", "destroys" },
+    { "destroying", "destroy" },
+    { "destroys", "destroy" },
+    { "destructions", "destruction" },
+    { "detained", "detain" },
+    { "detected", "detect" },
+    { "determined", "determine" },
+    { "detested", "detest" },
+    { "detests", "detest" },
+    { "devices", "device" },
+    { "devils", "devil" },
+    { "devised", "devise" },
+    { "devises", "devise" },
+    { "devising", "devise" },
+    { "devoted", "devote" },
+    { "devotions", "devotion" },
+    { "devoured", "devour" },
+    { "devourest", "devours" },
+    { "devouring", "devour" },
+    { "devours", "devour" },
+    { "did", "di" },
+    { "didrachmas", "didrachma" },
+    { "died", "di" },
+    { "dies", "di" },
+    { "diest", "did" },
+    { "differences", "difference" },
+    { "differing", "differ" },
+    { "differs", "differ" },
+    { "digs", "dig" },
+    { "diing", "di" },
+    { "diminished", "diminish" },
+    { "diminishing", "diminish" },
+    { "dined", "dine" },
+    { "dips", "dip" },
+    { "directed", "direct" },
+    { "directing", "direct" },
+    { "directions", "direction" },
+    { "directs", "direct" },
+    { "disallowed", "disallow" },
+    { "disappointed", "disappoint" },
+    { "discerned", "discern" },
+    { "discerning", "discern" },
+    { "discerns", "discern" },
+    { "discharged", "discharge" },
+    { "disciples", "disciple" },
+    { "disciplines", "discipline" },
+    { "disclosed", "disclose" },
+    { "discloses", "disclose" },
+    { "discouraged", "discourage" },
+    { "discovered", "discover" },
+    { "discovering", "discover" },
+    { "diseased", "disease" },
+    { "diseases", "disease" },
+    { "disfigured", "disfigure" },
+    { "disgraced", "disgrace" },
+    { "disguised", "disguise" },
+    { "disguises", "disguise" },
+    { "dishes", "dish" },
+    { "dishoning", "dishon" },
+    { "dishonored", "dishonor" },
+    { "dishonors", "dishonor" },
+    { "dishonouring", "dishonour" },
+    { "dismayed", "dismay" },
+    { "dismaying", "dismay" },
+    { "dismissed", "dismiss" },
+    { "disobeyed", "disobey" },
+    { "disobeys", "disobey" },
+    { "dispatched", "dispatch" },
+    { "dispersed", "disperse" },
+    { "dispersions", "dispersion" },
+    { "displayed", "display" },
+    { "displays", "display" },
+    { "displeased", "displease" },
+    { "dispossessed", "dispossess" },
+    { "dispossessing", "dispossess" },
+    { "disputations", "disputation" },
+    { "disputed", "dispute" },
+    { "disputes", "dispute" },
+    { "disputing", "dispute" },
+    { "disputings", "disputing" },
+    { "disquieted", "disquiet" },
+    { "dissolved", "dissolve" },
+    { "dissolvest", "dissolve" },
+    { "dissolving", "dissolve" },
+    { "distressed", "distress" },
+    { "distresses", "distress" },
+    { "distributed", "distribute" },
+    { "distributes", "distribute" },
+    { "distributing", "distribute" },
+    { "disturbances", "disturbance" },
+    { "disturbed", "disturb" },
+    { "ditches", "ditch" },
+    { "divided", "divide" },
+    { "divides", "divide" },
+    { "dividing", "divide" },
+    { "divinations", "divination" },
+    { "divined", "divine" },
+    { "diviners", "diviner" },
+    { "divines", "divine" },
+    { "divining", "divine" },
+    { "divisions", "division" },
+    { "divorced", "divorce" },
+    { "divorces", "divorce" },
+    { "doctors", "doctor" },
+    { "doctrines", "doctrine" },
+    { "doers", "doer" },
+    { "does", "do" },
+    { "doest", "doe" },
+    { "dogs", "dog" },
+    { "doing", "do" },
+    { "doings", "doing" },
+    { "dominions", "dominion" },
+    { "donkeys", "donkey" },
+    { "doomed", "doom" },
+    { "doorkeepers", "doorkeeper" },
+    { "doors", "door" },
+    { "doted", "dote" },
+    { "doting", "dote" },
+    { "doubled", "double" },
+    { "doubted", "doubt" },
+    { "doubting", "doubt" },
+    { "doubts", "doubt" },
+    { "doves", "dove" },
+    { "dragons", "dragon" },
+    { "drained", "drain" },
+    { "drawers", "drawer" },
+    { "drawing", "draw" },
+    { "draws", "draw" },
+    { "dreaded", "dread" },
+    { "dreamed", "dream" },
+    { "dreamers", "dreamer" },
+    { "dreaming", "dream" },
+    { "dreams", "dream" },
+    { "dressed", "dress" },
+    { "dressers", "dresser" },
+    { "dressing", "dress" },
+    { "drewing", "drew" },
+    { "drinkers", "drinker" },
+    { "drinking", "drink" },
+    { "drinks", "drink" },
+    { "drives", "drive" },
+    { "driving", "drive" },
+    { "droppings", "dropping" },
+    { "drops", "drop" },
+    { "droves", "drove" },
+    { "drowned", "drown" },
+    { "drunkards", "drunkard" },
+    { "dues", "due" },
+    { "dukes", "duke" },
+    { "dunghills", "dunghill" },
+    { "during", "dura" },
+    { "dwelled", "dwell" },
+    { "dwellest", "dwells" },
+    { "dwelling", "dwell" },
+    { "dwellingplaces", "dwellingplace" },
+    { "dwellings", "dwelling" },
+    { "dwells", "dwell" },
+    { "eagles", "eagle" },
+    { "eared", "ear" },
+    { "earing", "ear" },
+    { "earnest", "earns" },
+    { "earrings", "earring" },
+    { "ears", "ear" },
+    { "earthquakes", "earthquake" },
+    { "eased", "ease" },
+    { "eaters", "eater" },
+    { "eatest", "eats" },
+    { "eating", "eat" },
+    { "eats", "eat" },
+    { "edged", "edge" },
+    { "edges", "edge" },
+    { "edifying", "edify" },
+    { "edomite", "edom" },
+    { "edomites", "edomite" },
+    { "effected", "effect" },
+    { "eggs", "egg" },
+    { "egyptians", "egyptian" },
+    { "elders", "elder" },
+    { "elected", "elect" },
+    { "embalmed", "embalm" },
+    { "embraced", "embrace" },
+    { "embraces", "embrace" },
+    { "embracing", "embrace" },
+    { "embroidered", "embroider" },
+    { "emeralds", "emerald" },
+    { "emims", "emim" },
+    { "employed", "employ" },
+    { "emulations", "emulation" },
+    { "encamped", "encamp" },
+    { "encamping", "encamp" },
+    { "encamps", "encamp" },
+    { "enchanters", "enchanter" },
+    { "enchantments", "enchantment" },
+    { "enclosed", "enclose" },
+    { "encloses", "enclose" },
+    { "encompassed", "encompass" },
+    { "encompassing", "encompass" },
+    { "encountered", "encounter" },
+    { "encouraged", "encourage" },
+    { "encourages", "encourage" },
+    { "end", "en" },
+    { "endangered", "endanger" },
+    { "endeavoured", "endeavour" },
+    { "endeavouring", "endeavour" },
+    { "endeavours", "endeavour" },
+    { "ended", "end" },
+    { "ending", "end" },
+    { "endowed", "endow" },
+    { "ends", "end" },
+    { "endured", "endure" },
+    { "endures", "endure" },
+    { "enduring", "endure" },
+    { "engraved", "engrave" },
+    { "engraving", "engrave" },
+    { "engravings", "engraving" },
+    { "enjoined", "enjoin" },
+    { "enjoyed", "enjoy" },
+    { "enjoys", "enjoy" },
+    { "enlarged", "enlarge" },
+    { "enlarges", "enlarge" },
+    { "enlarging", "enlarge" },
+    { "enlightened", "enlighten" },
+    { "enlightening", "enlighten" },
+    { "enlightens", "enlighten" },
+    { "enquired", "enquire" },
+    { "enquirest", "enquire" },
+    { "enriched", "enrich" },
+    { "enriches", "enrich" },
+    { "enriching", "enrich" },
+    { "enrolled", "enroll" },
+    { "ensamples", "ensample" },
+    { "ensigns", "ensign" },
+    { "ensnared", "ensnare" },
+    { "entangled", "entangle" },
+    { "entangles", "entangle" },
+    { "entered", "enter" },
+    { "entering", "enter" },
+    { "enters", "enter" },
+    { "entertained", "entertain" },
+    { "enticed", "entice" },
+    { "entices", "entice" },
+    { "enticing", "entice" },
+    { "entrances", "entrance" },
+    { "entreated", "entreat" },
+    { "entreating", "entreat" },
+    { "entrusted", "entrust" },
+    { "envying", "envy" },
+    { "envyings", "envying" },
+    { "ephesians", "ephesian" },
+    { "ephraimite", "ephraim" },
+    { "ephraimites", "ephraimite" },
+    { "ephrathite", "ephrath" },
+    { "ephrathites", "ephrathite" },
+    { "epicureans", "epicurean" },
+    { "epileptics", "epileptic" },
+    { "epistles", "epistle" },
+    { "equals", "equal" },
+    { "erred", "err" },
+    { "errors", "error" },
+    { "errs", "err" },
+    { "escaped", "escape" },
+    { "escapes", "escape" },
+    { "escaping", "escape" },
+    { "eschewed", "eschew" },
+    { "established", "establish" },
+    { "establishes", "establish" },
+    { "establishing", "establish" },
+    { "estates", "estate" },
+    { "esteemed", "esteem" },
+    { "esteeming", "esteem" },
+    { "esteems", "esteem" },
+    { "estimations", "estimation" },
+    { "ethiopians", "ethiopian" },
+    { "eunuchs", "eunuch" },
+    { "euodias", "euodia" },
+    { "evangelists", "evangelist" },
+    { "evening", "even" },
+    { "evenings", "evening" },
+    { "evidences", "evidence" },
+    { "evildoers", "evildoer" },
+    { "evils", "evil" },
+    { "ewes", "ewe" },
+    { "exacted", "exact" },
+    { "exacting", "exact" },
+    { "exactions", "exaction" },
+    { "exacts", "exact" },
+    { "exalted", "exalt" },
+    { "exaltest", "exalts" },
+    { "exalting", "exalt" },
+    { "exalts", "exalt" },
+    { "examined", "examine" },
+    { "examines", "examine" },
+    { "examining", "examine" },
+    { "examples", "example" },
+    { "exceeded", "exceed" },
+    { "exceedest", "exceeds" },
+    { "exceeding", "exceed" },
+    { "exceeds", "exceed" },
+    { "excels", "excel" },
+    { "excepted", "except" },
+    { "exchanged", "exchange" },
+    { "exchanging", "exchange" },
+    { "excluded", "exclude" },
+    { "excused", "excuse" },
+    { "excuses", "excuse" },
+    { "excusing", "excuse" },
+    { "executed", "execute" },
+    { "executes", "execute" },
+    { "executest", "execute" },
+    { "executing", "execute" },
+    { "exempted", "exempt" },
+    { "exercised", "exercise" },
+    { "exercises", "exercise" },
+    { "exercising", "exercise" },
+    { "exhortations", "exhortation" },
+    { "exhorted", "exhort" },
+    { "exhorting", "exhort" },
+    { "exhorts", "exhort" },
+    { "exiles", "exile" },
+    { "existed", "exist" },
+    { "existing", "exist" },
+    { "exists", "exist" },
+    { "exits", "exit" },
+    { "expected", "expect" },
+    { "expecting", "expect" },
+    { "expenses", "expense" },
+    { "experienced", "experience" },
+    { "explained", "explain" },
+    { "explaining", "explain" },
+    { "explains", "explain" },
+    { "exploits", "exploit" },
+    { "expounded", "expound" },
+    { "expressed", "express" },
+    { "expressions", "expression" },
+    { "extended", "extend" },
+    { "extortioners", "extortioner" },
+    { "exulting", "exult" },
+    { "exults", "exult" },
+    { "eyed", "eye" },
+    { "eyes", "eye" },
+    { "ezrahite", "ezrah" },
+    { "faces", "face" },
+    { "fades", "fade" },
+    { "fading", "fade" },
+    { "failed", "fail" },
+    { "failing", "fail" },
+    { "fails", "fail" },
+    { "fainted", "faint" },
+    { "faintest", "faints" },
+    { "fainting", "faint" },
+    { "faints", "faint" },
+    { "fairest", "fairs" },
+    { "fairing", "fair" },
+    { "fairs", "fair" },
+    { "fallest", "falls" },
+    { "falling", "fall" },
+    { "falls", "fall" },
+    { "familiars", "familiar" },
+    { "famines", "famine" },
+    { "famished", "famish" },
+    { "fared", "far" },
+    { "farmers", "farmer" },
+    { "farming", "farm" },
+    { "farms", "farm" },
+    { "farthings", "farthing" },
+    { "fashioned", "fashion" },
+    { "fashioning", "fashion" },
+    { "fashions", "fashion" },
+    { "fasted", "fast" },
+    { "fastened", "fasten" },
+    { "fastening", "fasten" },
+    { "fastens", "fasten" },
+    { "fasting", "fast" },
+    { "fastings", "fasting" },
+    { "fathered", "father" },
+    { "fathers", "father" },
+    { "fathomed", "fathom" },
+    { "fathoms", "fathom" },
+    { "fatlings", "fatling" },
+    { "fats", "fat" },
+    { "faults", "fault" },
+    { "favored", "favor" },
+    { "favorite", "favor" },
+    { "favors", "favor" },
+    { "favoured", "favour" },
+    { "favouring", "favour" },
+    { "feared", "fear" },
+    { "fearest", "fears" },
+    { "fearing", "fear" },
+    { "fears", "fear" },
+    { "feasted", "feast" },
+    { "feasting", "feast" },
+    { "feasts", "feast" },
+    { "feedest", "feeds" },
+    { "feeding", "feed" },
+    { "feeds", "feed" },
+    { "feeling", "feel" },
+    { "feigned", "feign" },
+    { "feigning", "feign" },
+    { "felled", "fell" },
+    { "felling", "fell" },
+    { "fellowhelpers", "fellowhelper" },
+    { "fellowlabourers", "fellowlabourer" },
+    { "fellowprisoners", "fellowprisoner" },
+    { "fellows", "fellow" },
+    { "fellowservants", "fellowservant" },
+    { "fenced", "fence" },
+    { "fences", "fence" },
+    { "fetched", "fetch" },
+    { "fetches", "fetch" },
+    { "fewing", "few" },
+    { "fields", "field" },
+    { "fighting", "fight" },
+    { "fightings", "fighting" },
+    { "fights", "fight" },
+    { "figs", "fig" },
+    { "figured", "figure" },
+    { "figures", "figure" },
+    { "filled", "fill" },
+    { "fillest", "fills" },
+    { "filleted", "fillet" },
+    { "fillets", "fillet" },
+    { "filling", "fill" },
+    { "fills", "fill" },
+    { "findest", "finds" },
+    { "finding", "find" },
+    { "finds", "find" },
+    { "fined", "fine" },
+    { "finest", "find" },
+    { "fingers", "finger" },
+    { "fining", "find" },
+    { "finished", "finish" },
+    { "firebrands", "firebrand" },
+    { "fires", "fir" },
+    { "firs", "fir" },
+    { "firstfruits", "firstfruit" },
+    { "firstlings", "firstling" },
+    { "fishers", "fisher" },
+    { "fishes", "fish" },
+    { "fishhooks", "fishhook" },
+    { "fishing", "fish" },
+    { "fists", "fist" },
+    { "fixed", "fix" },
+    { "flagons", "flagon" },
+    { "flags", "flag" },
+    { "flames", "flame" },
+    { "flaming", "flame" },
+    { "flashed", "flash" },
+    { "flashes", "flash" },
+    { "flashing", "flash" },
+    { "flattered", "flatter" },
+    { "flattering", "flatter" },
+    { "flatters", "flatter" },
+    { "flayed", "flay" },
+    { "fleeing", "flee" },
+    { "flees", "flee" },
+    { "fleeting", "fleeth" },
+    { "fleshed", "flesh" },
+    { "fleshhooks", "fleshhook" },
+    { "flocks", "flock" },
+    { "floods", "flood" },
+    { "floors", "floor" },
+    { "flourished", "flourish" },
+    { "flourishes", "flourish" },
+    { "flourishing", "flourish" },
+    { "flowed", "flow" },
+    { "flowers", "flower" },
+    { "flowing", "flow" },
+    { "flows", "flow" },
+    { "flutes", "flute" },
+    { "fluttering", "flutters" },
+    { "flying", "fly" },
+    { "foals", "foal" },
+    { "foaming", "foam" },
+    { "foams", "foam" },
+    { "folded", "fold" },
+    { "folding", "fold" },
+    { "folds", "fold" },
+    { "folks", "folk" },
+    { "followed", "follow" },
+    { "following", "follow" },
+    { "follows", "follow" },
+    { "foods", "food" },
+    { "fools", "fool" },
+    { "footed", "foot" },
+    { "forbearing", "forbear" },
+    { "forbears", "forbear" },
+    { "forbids", "forbid" },
+    { "forced", "force" },
+    { "forces", "force" },
+    { "forcing", "force" },
+    { "ford", "for" },
+    { "fords", "ford" },
+    { "forefathers", "forefather" },
+    { "foregoing", "forego" },
+    { "foreheads", "forehead" },
+    { "foreigners", "foreigner" },
+    { "foreskins", "foreskin" },
+    { "forest", "ford" },
+    { "forests", "forest" },
+    { "forewarned", "forewarn" },
+    { "forfeited", "forfeit" },
+    { "forfeits", "forfeit" },
+    { "forgavest", "forgave" },
+    { "forgers", "forger" },
+    { "forgets", "forget" },
+    { "forgivenesses", "forgiveness" },
+    { "forgives", "forgive" },
+    { "forgiving", "forgive" },
+    { "foring", "for" },
+    { "forks", "fork" },
+    { "formed", "form" },
+    { "forms", "form" },
+    { "fornications", "fornication" },
+    { "fornicators", "fornicator" },
+    { "forsakes", "forsake" },
+    { "forsaking", "forsake" },
+    { "forsooking", "forsook" },
+    { "fortresses", "fortress" },
+    { "forts", "fort" },
+    { "fortunes", "fortune" },
+    { "fouled", "foul" },
+    { "foundations", "foundation" },
+    { "founded", "found" },
+    { "founding", "found" },
+    { "fountains", "fountain" },
+    { "fours", "four" },
+    { "fowlers", "fowler" },
+    { "fowls", "fowl" },
+    { "foxes", "fox" },
+    { "framed", "frame" },
+    { "freed", "free" },
+    { "frees", "free" },
+    { "friends", "friend" },
+    { "frightened", "frighten" },
+    { "fringes", "fringe" },
+    { "fruits", "fruit" },
+    { "frustrated", "frustrate" },
+    { "frustrates", "frustrate" },
+    { "fugitives", "fugitive" },
+    { "fulfilled", "fulfill" },
+    { "fulfilling", "fulfill" },
+    { "fulfills", "fulfill" },
+    { "fullers", "fuller" },
+    { "fullest", "fully" },
+    { "fulling", "full" },
+    { "furbished", "furbish" },
+    { "furnaces", "furnace" },
+    { "furnished", "furnish" },
+    { "furrows", "furrow" },
+    { "furthered", "further" },
+    { "gaddest", "gaddi" },
+    { "gadite", "gad" },
+    { "gadites", "gadite" },
+    { "gained", "gain" },
+    { "gaining", "gain" },
+    { "gains", "gain" },
+    { "gainsaying", "gainsay" },
+    { "galilaeans", "galilaean" },
+    { "galileans", "galilean" },
+    { "games", "game" },
+    { "gaped", "gap" },
+    { "gapes", "gap" },
+    { "gaps", "gap" },
+    { "gardens", "garden" },
+    { "garlands", "garland" },
+    { "garments", "garment" },
+    { "garnered", "garner" },
+    { "garners", "garner" },
+    { "garnished", "garnish" },
+    { "garrisons", "garrison" },
+    { "gasps", "gasp" },
+    { "gates", "gat" },
+    { "gathered", "gather" },
+    { "gatherers", "gatherer" },
+    { "gatherest", "gathers" },
+    { "gathering", "gather" },
+    { "gatherings", "gathering" },
+    { "gathers", "gather" },
+    { "gavest", "gave" },
+    { "gazelles", "gazelle" },
+    { "gazers", "gazer" },
+    { "gazes", "gaze" },
+    { "gazing", "gaza" },
+    { "gederite", "geder" },
+    { "gendered", "gender" },
+    { "generations", "generation" },
+    { "gentiles", "gentile" },
+    { "gershonite", "gershon" },
+    { "gershonites", "gershonite" },
+    { "gets", "get" },
+    { "giants", "giant" },
+    { "gibeathite", "gibeath" },
+    { "gibeonite", "gibeon" },
+    { "gibeonites", "gibeonite" },
+    { "gifts", "gift" },
+    { "gileadite", "gilead" },
+    { "gileadites", "gileadite" },
+    { "gins", "gin" },
+    { "girded", "gird" },
+    { "girding", "gird" },
+    { "girdles", "girdle" },
+    { "girds", "gird" },
+    { "girgashites", "girgashite" },
+    { "girls", "girl" },
+    { "gittites", "gittite" },
+    { "gives", "give" },
+    { "givest", "give" },
+    { "giving", "give" },
+    { "givings", "giving" },
+    { "glasses", "glass" },
+    { "gleaned", "glean" },
+    { "gleaning", "glean" },
+    { "gleanings", "gleaning" },
+    { "gleans", "glean" },
+    { "glittering", "glitter" },
+    { "gloating", "gloat" },
+    { "glorifying", "glorify" },
+    { "glorying", "glory" },
+    { "gluttons", "glutton" },
+    { "gnashed", "gnash" },
+    { "gnashes", "gnash" },
+    { "gnashing", "gnash" },
+    { "gnawed", "gnaw" },
+    { "goads", "goad" },
+    { "goats", "goat" },
+    { "god", "god" },
+    { "gods", "god" },
+    { "goes", "go" },
+    { "goest", "gob" },
+    { "going", "go" },
+    { "goings", "going" },
+    { "goldsmiths", "goldsmith" },
+    { "goods", "good" },
+    { "gored", "gore" },
+    { "gores", "gore" },
+    { "goring", "gore" },
+    { "gossips", "gossip" },
+    { "gourds", "gourd" },
+    { "governing", "govern" },
+    { "governments", "government" },
+    { "governors", "governor" },
+    { "graffed", "graff" },
+    { "grafted", "graft" },
+    { "grains", "grain" },
+    { "granted", "grant" },
+    { "granting", "grant" },
+    { "grapegatherers", "grapegatherer" },
+    { "grapes", "grape" },
+    { "grasses", "grass" },
+    { "grasshoppers", "grasshopper" },
+    { "grating", "grate" },
+    { "graved", "grave" },
+    { "graves", "grave" },
+    { "graving", "grave" },
+    { "gravings", "graving" },
+    { "grazes", "graze" },
+    { "greating", "great" },
+    { "grecians", "grecian" },
+    { "greeks", "greek" },
+    { "greeted", "greet" },
+    { "greeting", "greet" },
+    { "greetings", "greeting" },
+    { "greets", "greet" },
+    { "griefs", "grief" },
+    { "grieved", "grieve" },
+    { "grieves", "grieve" },
+    { "grieving", "grieve" },
+    { "grinding", "grind" },
+    { "grinds", "grind" },
+    { "groaned", "groan" },
+    { "groaning", "groan" },
+    { "groanings", "groaning" },
+    { "groans", "groan" },
+    { "gropes", "grope" },
+    { "grounded", "ground" },
+    { "groves", "grove" },
+    { "growing", "grow" },
+    { "growling", "growl" },
+    { "grows", "grow" },
+    { "grudging", "grudge" },
+    { "grumbled", "grumble" },
+    { "grumbling", "grumble" },
+    { "guarded", "guard" },
+    { "guarding", "guard" },
+    { "guards", "guard" },
+    { "guest", "gum" },
+    { "guests", "guest" },
+    { "guided", "guide" },
+    { "guides", "guide" },
+    { "guiding", "guide" },
+    { "gushed", "gush" },
+    { "gushes", "gush" },
+    { "gutters", "gutter" },
+    { "habergeons", "habergeon" },
+    { "habitations", "habitation" },
+    { "habits", "habit" },
+    { "had", "ha" },
+    { "hades", "had" },
+    { "hagrites", "hagrite" },
+    { "hairs", "hair" },
+    { "haling", "hale" },
+    { "hallowed", "hallow" },
+    { "halted", "halt" },
+    { "halting", "halt" },
+    { "hamathite", "hamath" },
+    { "hammered", "hammer" },
+    { "hammers", "hammer" },
+    { "handbreadths", "handbreadth" },
+    { "handed", "hand" },
+    { "handfuls", "handful" },
+    { "handiworks", "handiwork" },
+    { "handkerchiefs", "handkerchief" },
+    { "handled", "handle" },
+    { "handles", "handle" },
+    { "handling", "handle" },
+    { "handmaidens", "handmaiden" },
+    { "handmaids", "handmaid" },
+    { "hands", "hand" },
+    { "hanged", "hang" },
+    { "hanging", "hang" },
+    { "hangings", "hanging" },
+    { "hangs", "hang" },
+    { "happened", "happen" },
+    { "happening", "happen" },
+    { "happens", "happen" },
+    { "hard", "har" },
+    { "hardened", "harden" },
+    { "hardening", "harden" },
+    { "hardens", "harden" },
+    { "hardships", "hardship" },
+    { "harlots", "harlot" },
+    { "harmed", "harm" },
+    { "harnessed", "harness" },
+    { "harnesses", "harness" },
+    { "harodite", "harod" },
+    { "harped", "harp" },
+    { "harping", "harp" },
+    { "harps", "harp" },
+    { "harrows", "harrow" },
+    { "harts", "hart" },
+    { "harvests", "harvest" },
+    { "has", "ha" },
+    { "hasted", "hast" },
+    { "hastened", "hasten" },
+    { "hastening", "hasten" },
+    { "hasting", "hast" },
+    { "hated", "hate" },
+    { "hates", "hate" },
+    { "hatest", "hate" },
+    { "hating", "hate" },
+    { "haunts", "haunt" },
+    { "havens", "haven" },
+    { "having", "have" },
+    { "headbands", "headband" },
+    { "headdresses", "headdress" },
+    { "headed", "head" },
+    { "heads", "head" },
+    { "healed", "heal" },
+    { "healing", "heal" },
+    { "healings", "healing" },
+    { "heals", "heal" },
+    { "heaped", "heap" },
+    { "heaps", "heap" },
+    { "heard", "hear" },
+    { "hearding", "heard" },
+    { "hearers", "hearer" },
+    { "hearest", "heard" },
+    { "hearing", "hear" },
+    { "hearkened", "hearken" },
+    { "hearkening", "hearken" },
+    { "hears", "hear" },
+    { "hearted", "heart" },
+    { "hearts", "heart" },
+    { "heated", "heat" },
+    { "heaved", "heave" },
+    { "heavens", "heaven" },
+    { "hebrews", "hebrew" },
+    { "hedged", "hedge" },
+    { "hedges", "hedge" },
+    { "heed", "he" },
+    { "heeding", "heed" },
+    { "heeds", "heed" },
+    { "heels", "heel" },
+    { "heights", "height" },
+    { "heirs", "heir" },
+    { "helmets", "helmet" },
+    { "helped", "help" },
+    { "helpers", "helper" },
+    { "helping", "help" },
+    { "helps", "help" },
+    { "hems", "hem" },
+    { "herbs", "herb" },
+    { "herd", "her" },
+    { "herds", "herd" },
+    { "heres", "her" },
+    { "heritages", "heritage" },
+    { "hers", "her" },
+    { "hewed", "hew" },
+    { "hewers", "hewer" },
+    { "hews", "hew" },
+    { "hides", "hid" },
+    { "hidest", "hide" },
+    { "hiding", "hid" },
+    { "highing", "high" },
+    { "highways", "highway" },
+    { "hills", "hill" },
+    { "hind", "hin" },
+    { "hindered", "hinder" },
+    { "hinds", "hind" },
+    { "hired", "hire" },
+    { "hires", "hire" },
+    { "hirest", "hire" },
+    { "hiss", "his" },
+    { "hissing", "hiss" },
+    { "hittites", "hittite" },
+    { "hivites", "hivite" },
+    { "hod", "ho" },
+    { "hoed", "ho" },
+    { "holdest", "holds" },
+    { "holding", "hold" },
+    { "holds", "hold" },
+    { "holes", "hole" },
+    { "homers", "homer" },
+    { "homes", "home" },
+    { "honored", "honor" },
+    { "honors", "honor" },
+    { "honoured", "honour" },
+    { "honourest", "honours" },
+    { "honouring", "honour" },
+    { "honours", "honour" },
+    { "hoofs", "hoof" },
+    { "hooks", "hook" },
+    { "hoped", "hope" },
+    { "hopes", "hope" },
+    { "hoping", "hope" },
+    { "horite", "hor" },
+    { "horites", "horite" },
+    { "horned", "horn" },
+    { "hornets", "hornet" },
+    { "horns", "horn" },
+    { "horonite", "horon" },
+    { "horses", "horse" },
+    { "hosts", "host" },
+    { "houghed", "hough" },
+    { "hours", "hour" },
+    { "households", "household" },
+    { "houses", "house" },
+    { "housetops", "housetop" },
+    { "howled", "howl" },
+    { "howling", "howl" },
+    { "howlings", "howling" },
+    { "humbled", "humble" },
+    { "humbles", "humble" },
+    { "humbling", "humble" },
+    { "hundreds", "hundred" },
+    { "hungered", "hunger" },
+    { "hunted", "hunt" },
+    { "hunters", "hunter" },
+    { "huntest", "hunts" },
+    { "hunting", "hunt" },
+    { "hunts", "hunt" },
+    { "hurled", "hurl" },
+    { "hurling", "hurl" },
+    { "hurls", "hurl" },
+    { "hurting", "hurt" },
+    { "hurts", "hurt" },
+    { "husbands", "husband" },
+    { "husks", "husk" },
+    { "hymns", "hymn" },
+    { "hypocrites", "hypocrite" },
+    { "idolaters", "idolater" },
+    { "idols", "idol" },
+    { "ignored", "ignore" },
+    { "images", "image" },
+    { "imaginations", "imagination" },
+    { "imagined", "imagine" },
+    { "imparted", "impart" },
+    { "imposed", "impose" },
+    { "impoverished", "impoverish" },
+    { "imprisonments", "imprisonment" },
+    { "imputed", "impute" },
+    { "imputing", "impute" },
+    { "incensed", "incense" },
+    { "inclined", "incline" },
+    { "inclines", "incline" },
+    { "inclosed", "inclose" },
+    { "increased", "increase" },
+    { "increases", "increase" },
+    { "increasest", "increase" },
+    { "increasing", "increase" },
+    { "indeed", "indee" },
+    { "infants", "infant" },
+    { "inflaming", "inflame" },
+    { "informed", "inform" },
+    { "inhabitants", "inhabitant" },
+    { "inhabited", "inhabit" },
+    { "inhabitest", "inhabits" },
+    { "inhabiting", "inhabit" },
+    { "inhabits", "inhabit" },
+    { "inheritances", "inheritance" },
+    { "inherited", "inherit" },
+    { "inherits", "inherit" },
+    { "innocents", "innocent" },
+    { "inquired", "inquire" },
+    { "inquires", "inquire" },
+    { "inscribed", "inscribe" },
+    { "instructed", "instruct" },
+    { "instructing", "instruct" },
+    { "instructions", "instruction" },
+    { "instructors", "instructor" },
+    { "instructs", "instruct" },
+    { "instruments", "instrument" },
+    { "insulted", "insult" },
+    { "insulting", "insult" },
+    { "insults", "insult" },
+    { "insurrections", "insurrection" },
+    { "intended", "intend" },
+    { "intending", "intend" },
+    { "intents", "intent" },
+    { "intercessions", "intercession" },
+    { "interpretations", "interpretation" },
+    { "interpreted", "interpret" },
+    { "interpreting", "interpret" },
+    { "interprets", "interpret" },
+    { "intreated", "intreat" },
+    { "invaded", "invade" },
+    { "invented", "invent" },
+    { "invited", "invite" },
+    { "invites", "invite" },
+    { "inwards", "inward" },
+    { "irad", "ira" },
+    { "irons", "iron" },
+    { "is", "i" },
+    { "ishmaelite", "ishmael" },
+    { "ishmaelites", "ishmaelite" },
+    { "ishmeelites", "ishmeelite" },
+    { "islands", "island" },
+    { "isles", "isle" },
+    { "israelite", "israel" },
+    { "israelites", "israelite" },
+    { "issued", "issue" },
+    { "issues", "issue" },
+    { "italians", "italian" },
+    { "itching", "itch" },
+    { "ithrites", "ithrite" },
+    { "its", "it" },
+    { "jackals", "jackal" },
+    { "jairite", "jair" },
+    { "jared", "jar" },
+    { "jars", "jar" },
+    { "jaws", "jaw" },
+    { "jebusite", "jebus" },
+    { "jebusites", "jebusite" },
+    { "jehud", "jehu" },
+    { "jewels", "jewel" },
+    { "jews", "jew" },
+    { "jezreelite", "jezreel" },
+    { "joined", "join" },
+    { "joining", "join" },
+    { "joinings", "joining" },
+    { "joints", "joint" },
+    { "joking", "joke" },
+    { "jonas", "jona" },
+    { "joses", "jose" },
+    { "journeyed", "journey" },
+    { "journeying", "journey" },
+    { "journeyings", "journeying" },
+    { "journeys", "journey" },
+    { "joyed", "joy" },
+    { "joying", "joy" },
+    { "judas", "juda" },
+    { "judged", "judge" },
+    { "judges", "judge" },
+    { "judgest", "judge" },
+    { "judging", "judge" },
+    { "judgments", "judgment" },
+    { "junias", "junia" },
+    { "justifying", "justify" },
+    { "keepers", "keeper" },
+    { "keepest", "keeps" },
+    { "keeping", "keep" },
+    { "keeps", "keep" },
+    { "kenites", "kenite" },
+    { "kenizzites", "kenizzite" },
+    { "kernels", "kernel" },
+    { "keys", "key" },
+    { "kicked", "kick" },
+    { "kids", "kid" },
+    { "killed", "kill" },
+    { "killest", "kills" },
+    { "killing", "kill" },
+    { "kills", "kill" },
+    { "kind", "kin" },
+    { "kindled", "kindle" },
+    { "kindles", "kindle" },
+    { "kindreds", "kindred" },
+    { "kinds", "kind" },
+    { "kingdoms", "kingdom" },
+    { "kings", "king" },
+    { "kinsfolks", "kinsfolk" },
+    { "kissed", "kiss" },
+    { "kisses", "kiss" },
+    { "kites", "kite" },
+    { "kneaded", "knead" },
+    { "kneading", "knead" },
+    { "kneeled", "kneel" },
+    { "kneeling", "kneel" },
+    { "knees", "knee" },
+    { "knewing", "knew" },
+    { "knocked", "knock" },
+    { "knocking", "knock" },
+    { "knocks", "knock" },
+    { "knops", "knop" },
+    { "knowest", "known" },
+    { "knowing", "know" },
+    { "knows", "know" },
+    { "korahite", "korah" },
+    { "korahites", "korahite" },
+    { "labored", "labor" },
+    { "laborers", "laborer" },
+    { "laboring", "labor" },
+    { "labors", "labor" },
+    { "laboured", "labour" },
+    { "labourers", "labourer" },
+    { "labouring", "labour" },
+    { "labours", "labour" },
+    { "lacked", "lack" },
+    { "lackest", "lacks" },
+    { "lacking", "lack" },
+    { "lacks", "lack" },
+    { "laded", "lad" },
+    { "lading", "lad" },
+    { "lads", "lad" },
+    { "lambs", "lamb" },
+    { "lamed", "lame" },
+    { "lamentations", "lamentation" },
+    { "lamented", "lament" },
+    { "lamps", "lamp" },
+    { "lampstands", "lampstand" },
+    { "lances", "lance" },
+    { "landed", "land" },
+    { "landing", "land" },
+    { "landmarks", "landmark" },
+    { "lands", "land" },
+    { "languages", "language" },
+    { "languished", "languish" },
+    { "languishes", "languish" },
+    { "languishing", "languish" },
+    { "laps", "lap" },
+    { "lasted", "last" },
+    { "lasting", "last" },
+    { "laughed", "laugh" },
+    { "laughing", "laugh" },
+    { "laughs", "laugh" },
+    { "launched", "launch" },
+    { "lavers", "laver" },
+    { "laws", "law" },
+    { "lawyers", "lawyer" },
+    { "layest", "lays" },
+    { "laying", "lay" },
+    { "lays", "lay" },
+    { "leaders", "leader" },
+    { "leadest", "leads" },
+    { "leading", "lead" },
+    { "leads", "lead" },
+    { "leaned", "lean" },
+    { "leaning", "lean" },
+    { "leans", "lean" },
+    { "leaped", "leap" },
+    { "leaping", "leap" },
+    { "leaps", "leap" },
+    { "learned", "learn" },
+    { "learning", "learn" },
+    { "leased", "lease" },
+    { "leasing", "lease" },
+    { "leaved", "leave" },
+    { "leavened", "leaven" },
+    { "leavens", "leaven" },
+    { "leaves", "leave" },
+    { "leaving", "leave" },
+    { "led", "le" },
+    { "ledges", "ledge" },
+    { "lees", "le" },
+    { "lefting", "left" },
+    { "legions", "legion" },
+    { "legs", "leg" },
+    { "lehemite", "lehem" },
+    { "lends", "lend" },
+    { "lengthened", "lengthen" },
+    { "lengthening", "lengthen" },
+    { "leopards", "leopard" },
+    { "lepers", "leper" },
+    { "lest", "le" },
+    { "lets", "let" },
+    { "letters", "letter" },
+    { "leveled", "level" },
+    { "levels", "level" },
+    { "levites", "levite" },
+    { "liars", "liar" },
+    { "licked", "lick" },
+    { "licks", "lick" },
+    { "lied", "lie" },
+    { "lies", "lie" },
+    { "liest", "lid" },
+    { "lifted", "lift" },
+    { "liftest", "lifts" },
+    { "lifting", "lift" },
+    { "lifts", "lift" },
+    { "lighted", "light" },
+    { "lightened", "lighten" },
+    { "lightest", "lights" },
+    { "lighting", "light" },
+    { "lightnings", "lightning" },
+    { "lights", "light" },
+    { "liked", "like" },
+    { "likened", "liken" },
+    { "liking", "like" },
+    { "limbs", "limb" },
+    { "limited", "limit" },
+    { "limits", "limit" },
+    { "lines", "line" },
+    { "lingered", "linger" },
+    { "lintels", "lintel" },
+    { "lionesses", "lioness" },
+    { "lions", "lion" },
+    { "lips", "lip" },
+    { "liquors", "liquor" },
+    { "listened", "listen" },
+    { "listening", "listen" },
+    { "listens", "listen" },
+    { "lived", "live" },
+    { "lives", "live" },
+    { "livest", "live" },
+    { "living", "live" },
+    { "loaded", "load" },
+    { "loads", "load" },
+    { "loathed", "loathe" },
+    { "loathes", "loathe" },
+    { "loathing", "loathe" },
+    { "locked", "lock" },
+    { "locks", "lock" },
+    { "locusts", "locust" },
+    { "lod", "lo" },
+    { "lodged", "lodge" },
+    { "lodges", "lodge" },
+    { "lodgest", "lodge" },
+    { "lodging", "lodge" },
+    { "lodgings", "lodging" },
+    { "longed", "long" },
+    { "longing", "long" },
+    { "longs", "long" },
+    { "looked", "look" },
+    { "lookest", "looks" },
+    { "looking", "look" },
+    { "looks", "look" },
+    { "loosed", "loose" },
+    { "loosened", "loosen" },
+    { "loosens", "loosen" },
+    { "loosing", "loose" },
+    { "lording", "lord" },
+    { "lords", "lord" },
+    { "loses", "lose" },
+    { "lothed", "lothe" },
+    { "lothing", "lothe" },
+    { "lots", "lot" },
+    { "lotuses", "lotus" },
+    { "loved", "love" },
+    { "lovers", "lover" },
+    { "loves", "love" },
+    { "lovest", "love" },
+    { "loving", "love" },
+    { "lovingkindnesses", "lovingkindness" },
+    { "lowered", "lower" },
+    { "lowering", "lower" },
+    { "lowing", "low" },
+    { "lubims", "lubim" },
+    { "lurking", "lurk" },
+    { "lurks", "lurk" },
+    { "lusted", "lust" },
+    { "lusting", "lust" },
+    { "lusts", "lust" },
+    { "lying", "lye" },
+    { "maacathite", "maacath" },
+    { "maacathites", "maacathite" },
+    { "maachathites", "maachathite" },
+    { "madest", "made" },
+    { "mading", "mad" },
+    { "magicians", "magician" },
+    { "magistrates", "magistrate" },
+    { "maidens", "maiden" },
+    { "maids", "maid" },
+    { "maidservants", "maidservant" },
+    { "maimed", "maim" },
+    { "maintained", "maintain" },
+    { "maintainest", "maintains" },
+    { "maintaining", "maintain" },
+    { "maintains", "maintain" },
+    { "makers", "maker" },
+    { "makes", "make" },
+    { "makest", "make" },
+    { "making", "make" },
+    { "malefactors", "malefactor" },
+    { "males", "male" },
+    { "maligned", "malign" },
+    { "manifested", "manifest" },
+    { "manners", "manner" },
+    { "manservants", "manservant" },
+    { "manslayers", "manslayer" },
+    { "mantles", "mantle" },
+    { "marched", "march" },
+    { "marching", "march" },
+    { "marked", "mark" },
+    { "markest", "marks" },
+    { "marketplaces", "marketplace" },
+    { "markets", "market" },
+    { "marking", "mark" },
+    { "marks", "mark" },
+    { "marriages", "marriage" },
+    { "marrying", "marry" },
+    { "mars", "mar" },
+    { "marshes", "marsh" },
+    { "martyrs", "martyr" },
+    { "marveled", "marvel" },
+    { "marveling", "marvel" },
+    { "marvels", "marvel" },
+    { "masquerades", "masquerade" },
+    { "masquerading", "masquerade" },
+    { "masters", "master" },
+    { "masts", "mast" },
+    { "mats", "mat" },
+    { "matters", "matter" },
+    { "mattocks", "mattock" },
+    { "mauled", "maul" },
+    { "maying", "may" },
+    { "meadows", "meadow" },
+    { "meanest", "means" },
+    { "meaning", "mean" },
+    { "means", "mean" },
+    { "measured", "measure" },
+    { "measures", "measure" },
+    { "measuring", "measure" },
+    { "meats", "meat" },
+    { "meddled", "meddle" },
+    { "meddles", "meddle" },
+    { "meddling", "meddle" },
+    { "medes", "mede" },
+    { "medicines", "medicine" },
+    { "meditated", "meditate" },
+    { "meditates", "meditate" },
+    { "meetest", "meets" },
+    { "meeting", "meet" },
+    { "meets", "meet" },
+    { "mehunims", "mehunim" },
+    { "melted", "melt" },
+    { "melting", "melt" },
+    { "melts", "melt" },
+    { "members", "member" },
+    { "mend", "men" },
+    { "mending", "mend" },
+    { "mentioned", "mention" },
+    { "mentioning", "mention" },
+    { "merchants", "merchant" },
+    { "mered", "mere" },
+    { "meres", "mere" },
+    { "messengers", "messenger" },
+    { "messes", "mess" },
+    { "metals", "metal" },
+    { "meted", "met" },
+    { "midianite", "midian" },
+    { "midianites", "midianite" },
+    { "mightest", "mighty" },
+    { "mighting", "might" },
+    { "millions", "million" },
+    { "mills", "mill" },
+    { "millstones", "millstone" },
+    { "minas", "mina" },
+    { "minded", "mind" },
+    { "minding", "mind" },
+    { "minds", "mind" },
+    { "mingled", "mingle" },
+    { "minished", "minish" },
+    { "ministered", "minister" },
+    { "ministering", "minister" },
+    { "ministers", "minister" },
+    { "minstrels", "minstrel" },
+    { "miracles", "miracle" },
+    { "mirrors", "mirror" },
+    { "miscarrying", "miscarry" },
+    { "mischiefs", "mischief" },
+    { "missed", "miss" },
+    { "missing", "miss" },
+    { "mite", "m" },
+    { "mites", "mite" },
+    { "mixed", "mix" },
+    { "mixes", "mix" },
+    { "moabite", "moab" },
+    { "moabites", "moabite" },
+    { "moabitess", "moabites" },
+    { "moaning", "moan" },
+    { "mocked", "mock" },
+    { "mockers", "mocker" },
+    { "mockest", "mocks" },
+    { "mocking", "mock" },
+    { "mockings", "mocking" },
+    { "mocks", "mock" },
+    { "modest", "mode" },
+    { "moistened", "moisten" },
+    { "molding", "moldy" },
+    { "moles", "mole" },
+    { "monsters", "monster" },
+    { "months", "month" },
+    { "monuments", "monument" },
+    { "moons", "moon" },
+    { "morals", "moral" },
+    { "mornings", "morning" },
+    { "morsels", "morsel" },
+    { "mortals", "mortal" },
+    { "mortars", "mortar" },
+    { "mothers", "mother" },
+    { "mounds", "mound" },
+    { "mountains", "mountain" },
+    { "mounted", "mount" },
+    { "mounting", "mount" },
+    { "mounts", "mount" },
+    { "mourned", "mourn" },
+    { "mourners", "mourner" },
+    { "mourning", "mourn" },
+    { "mourns", "mourn" },
+    { "mouths", "mouth" },
+    { "moved", "move" },
+    { "moves", "move" },
+    { "moving", "move" },
+    { "mules", "mule" },
+    { "multiplying", "multiply" },
+    { "multitudes", "multitude" },
+    { "munitions", "munition" },
+    { "murdered", "murder" },
+    { "murderers", "murderer" },
+    { "murders", "murder" },
+    { "murmured", "murmur" },
+    { "murmuring", "murmur" },
+    { "murmurings", "murmuring" },
+    { "mused", "muse" },
+    { "musicians", "musician" },
+    { "musing", "muse" },
+    { "muttered", "mutter" },
+    { "mutters", "mutter" },
+    { "nailing", "nail" },
+    { "nails", "nail" },
+    { "named", "name" },
+    { "names", "name" },
+    { "narrowed", "narrow" },
+    { "nations", "nation" },
+    { "natives", "native" },
+    { "nazarenes", "nazarene" },
+    { "nazarites", "nazarite" },
+    { "nazirites", "nazirite" },
+    { "nearing", "near" },
+    { "necked", "neck" },
+    { "necks", "neck" },
+    { "needed", "need" },
+    { "needest", "needs" },
+    { "needing", "need" },
+    { "needs", "need" },
+    { "neglected", "neglect" },
+    { "neglecting", "neglect" },
+    { "neighbors", "neighbor" },
+    { "neighbours", "neighbour" },
+    { "neighed", "neigh" },
+    { "neighing", "neigh" },
+    { "neighings", "neighing" },
+    { "nephews", "nephew" },
+    { "nest", "nd" },
+    { "nests", "nest" },
+    { "nethinims", "nethinim" },
+    { "netophathites", "netophathite" },
+    { "nets", "net" },
+    { "networks", "network" },
+    { "news", "new" },
+    { "nights", "night" },
+    { "nobles", "noble" },
+    { "nod", "no" },
+    { "noised", "noise" },
+    { "noses", "nose" },
+    { "noted", "not" },
+    { "noticed", "notice" },
+    { "nourished", "nourish" },
+    { "nourishes", "nourish" },
+    { "nourishing", "nourish" },
+    { "numbered", "number" },
+    { "numberest", "numbers" },
+    { "numbering", "number" },
+    { "numbers", "number" },
+    { "nursed", "nurse" },
+    { "nursing", "nurse" },
+    { "nurtured", "nurture" },
+    { "nuts", "nut" },
+    { "oaks", "oak" },
+    { "oars", "oar" },
+    { "oaths", "oath" },
+    { "obeyed", "obey" },
+    { "obeying", "obey" },
+    { "obeys", "obey" },
+    { "objects", "object" },
+    { "oblations", "oblation" },
+    { "observed", "observe" },
+    { "observers", "observer" },
+    { "observes", "observe" },
+    { "observest", "observe" },
+    { "observing", "observe" },
+    { "obtained", "obtain" },
+    { "obtaining", "obtain" },
+    { "obtains", "obtain" },
+    { "occasioned", "occasion" },
+    { "occasions", "occasion" },
+    { "odds", "odd" },
+    { "odors", "odor" },
+    { "odours", "odour" },
+    { "offences", "offence" },
+    { "offended", "offend" },
+    { "offenders", "offender" },
+    { "offenses", "offense" },
+    { "offered", "offer" },
+    { "offering", "offer" },
+    { "offerings", "offering" },
+    { "offers", "offer" },
+    { "officers", "officer" },
+    { "offices", "office" },
+    { "officials", "official" },
+    { "oiled", "oil" },
+    { "oils", "oil" },
+    { "ointments", "ointment" },
+    { "olding", "old" },
+    { "olives", "olive" },
+    { "oliveyards", "oliveyard" },
+    { "omers", "omer" },
+    { "ones", "on" },
+    { "opened", "open" },
+    { "openest", "opens" },
+    { "opening", "open" },
+    { "openings", "opening" },
+    { "opens", "open" },
+    { "operations", "operation" },
+    { "opinions", "opinion" },
+    { "opposed", "oppose" },
+    { "opposes", "oppose" },
+    { "opposest", "oppose" },
+    { "oppressed", "oppress" },
+    { "oppresses", "oppress" },
+    { "oppressing", "oppress" },
+    { "oppressions", "oppression" },
+    { "oppressors", "oppressor" },
+    { "oracles", "oracle" },
+    { "orchards", "orchard" },
+    { "ordained", "ordain" },
+    { "ordered", "order" },
+    { "ordering", "order" },
+    { "orderings", "ordering" },
+    { "orders", "order" },
+    { "ordinances", "ordinance" },
+    { "organs", "organ" },
+    { "ornaments", "ornament" },
+    { "ostriches", "ostrich" },
+    { "others", "other" },
+    { "oughting", "ought" },
+    { "ours", "our" },
+    { "outcasts", "outcast" },
+    { "ovens", "oven" },
+    { "overcharged", "overcharge" },
+    { "overcomes", "overcome" },
+    { "overflowed", "overflow" },
+    { "overflowing", "overflow" },
+    { "overflows", "overflow" },
+    { "overlaying", "overlay" },
+    { "overlays", "overlay" },
+    { "overlooked", "overlook" },
+    { "overlooks", "overlook" },
+    { "overseers", "overseer" },
+    { "overshadowed", "overshadow" },
+    { "overshadowing", "overshadow" },
+    { "overspreading", "overspread" },
+    { "overtakes", "overtake" },
+    { "overthrowing", "overthrow" },
+    { "overthrows", "overthrow" },
+    { "overturned", "overturn" },
+    { "overturns", "overturn" },
+    { "overwhelmed", "overwhelm" },
+    { "overwhelming", "overwhelm" },
+    { "owed", "owe" },
+    { "owes", "owe" },
+    { "owest", "owe" },
+    { "owls", "owl" },
+    { "owners", "owner" },
+    { "owns", "own" },
+    { "paces", "pace" },
+    { "paid", "pai" },
+    { "pained", "pain" },
+    { "pains", "pain" },
+    { "painted", "paint" },
+    { "painting", "paint" },
+    { "pairs", "pair" },
+    { "palaces", "palace" },
+    { "palms", "palm" },
+    { "pans", "pan" },
+    { "panted", "pant" },
+    { "pants", "pant" },
+    { "parables", "parable" },
+    { "paralytics", "paralytic" },
+    { "pardoned", "pardon" },
+    { "pardons", "pardon" },
+    { "parlours", "parlour" },
+    { "partakers", "partaker" },
+    { "partakest", "partake" },
+    { "parted", "part" },
+    { "parting", "part" },
+    { "partners", "partner" },
+    { "parts", "part" },
+    { "passages", "passage" },
+    { "passed", "pass" },
+    { "passes", "pass" },
+    { "passing", "pass" },
+    { "passions", "passion" },
+    { "passovers", "passover" },
+    { "pastors", "pastor" },
+    { "pastures", "pasture" },
+    { "patched", "patch" },
+    { "paths", "path" },
+    { "patriarchs", "patriarch" },
+    { "patterns", "pattern" },
+    { "pavilions", "pavilion" },
+    { "paws", "paw" },
+    { "payed", "pay" },
+    { "paying", "pay" },
+    { "pays", "pay" },
+    { "pearls", "pearl" },
+    { "peeped", "peep" },
+    { "pens", "pen" },
+    { "peoples", "people" },
+    { "perceived", "perceive" },
+    { "perceives", "perceive" },
+    { "perceivest", "perceive" },
+    { "perceiving", "perceive" },
+    { "perfected", "perfect" },
+    { "perfecting", "perfect" },
+    { "performed", "perform" },
+    { "performing", "perform" },
+    { "performs", "perform" },
+    { "perfumed", "perfume" },
+    { "perfumers", "perfumer" },
+    { "perfumes", "perfume" },
+    { "perils", "peril" },
+    { "perished", "perish" },
+    { "perishes", "perish" },
+    { "perishing", "perish" },
+    { "perizzites", "perizzite" },
+    { "permits", "permit" },
+    { "persecuted", "persecute" },
+    { "persecutest", "persecute" },
+    { "persecuting", "persecute" },
+    { "persecutions", "persecution" },
+    { "persecutors", "persecutor" },
+    { "persians", "persian" },
+    { "persons", "person" },
+    { "persuaded", "persuade" },
+    { "persuades", "persuade" },
+    { "persuadest", "persuade" },
+    { "persuading", "persuade" },
+    { "pertained", "pertain" },
+    { "pertaining", "pertain" },
+    { "pertains", "pertain" },
+    { "perverted", "pervert" },
+    { "perverting", "pervert" },
+    { "perverts", "pervert" },
+    { "pestilences", "pestilence" },
+    { "petitioned", "petition" },
+    { "petitions", "petition" },
+    { "pharisees", "pharisee" },
+    { "philistines", "philistine" },
+    { "physicians", "physician" },
+    { "picked", "pick" },
+    { "pieces", "piece" },
+    { "pierced", "pierce" },
+    { "piercing", "pierce" },
+    { "piercings", "piercing" },
+    { "pigeons", "pigeon" },
+    { "pigs", "pig" },
+    { "piled", "pile" },
+    { "pillars", "pillar" },
+    { "pillows", "pillow" },
+    { "pilots", "pilot" },
+    { "pining", "pin" },
+    { "pinnacles", "pinnacle" },
+    { "pins", "pin" },
+    { "piped", "pipe" },
+    { "pipes", "pipe" },
+    { "pirathonite", "pirathon" },
+    { "pitched", "pitch" },
+    { "pitchers", "pitcher" },
+    { "pits", "pit" },
+    { "placed", "place" },
+    { "places", "place" },
+    { "plagued", "plague" },
+    { "plagues", "plague" },
+    { "plains", "plain" },
+    { "plaistered", "plaister" },
+    { "planes", "plan" },
+    { "plans", "plan" },
+    { "planted", "plant" },
+    { "planting", "plant" },
+    { "plantings", "planting" },
+    { "plants", "plant" },
+    { "plastered", "plaster" },
+    { "plates", "plat" },
+    { "plating", "plat" },
+    { "platters", "platter" },
+    { "played", "play" },
+    { "players", "player" },
+    { "playing", "play" },
+    { "plead", "plea" },
+    { "pleaded", "plead" },
+    { "pleads", "plead" },
+    { "pleas", "plea" },
+    { "pleased", "pleas" },
+    { "pleases", "pleas" },
+    { "pleasing", "pleas" },
+    { "pleasures", "pleasure" },
+    { "pledged", "pledge" },
+    { "pledges", "pledge" },
+    { "plots", "plot" },
+    { "plowed", "plow" },
+    { "plowing", "plow" },
+    { "plows", "plow" },
+    { "plowshares", "plowshare" },
+    { "plucked", "pluck" },
+    { "plucking", "pluck" },
+    { "plundered", "plunder" },
+    { "plundering", "plunder" },
+    { "pointed", "point" },
+    { "points", "point" },
+    { "poisons", "poison" },
+    { "poles", "pole" },
+    { "polled", "poll" },
+    { "polls", "poll" },
+    { "polluted", "pollute" },
+    { "pollutes", "pollute" },
+    { "polluting", "pollute" },
+    { "pollutions", "pollution" },
+    { "pomegranates", "pomegranate" },
+    { "pondered", "ponder" },
+    { "pondering", "ponder" },
+    { "pools", "pool" },
+    { "pooring", "poor" },
+    { "poplars", "poplar" },
+    { "porches", "porch" },
+    { "porters", "porter" },
+    { "portions", "portion" },
+    { "portrayed", "portray" },
+    { "possessed", "possess" },
+    { "possesses", "possess" },
+    { "possessing", "possess" },
+    { "possessions", "possession" },
+    { "possessors", "possessor" },
+    { "posted", "post" },
+    { "posts", "post" },
+    { "pots", "pot" },
+    { "potsherds", "potsherd" },
+    { "potters", "potter" },
+    { "pounded", "pound" },
+    { "pounds", "pound" },
+    { "poured", "pour" },
+    { "pouring", "pour" },
+    { "pours", "pour" },
+    { "pourtrayed", "pourtray" },
+    { "powders", "powder" },
+    { "powers", "power" },
+    { "practiced", "practice" },
+    { "practices", "practice" },
+    { "practised", "practise" },
+    { "praised", "praise" },
+    { "praises", "praise" },
+    { "praising", "praise" },
+    { "prancings", "prancing" },
+    { "pransings", "pransing" },
+    { "prayed", "pray" },
+    { "prayers", "prayer" },
+    { "prayest", "prays" },
+    { "praying", "pray" },
+    { "prays", "pray" },
+    { "preached", "preach" },
+    { "preaches", "preach" },
+    { "preaching", "preach" },
+    { "precepts", "precept" },
+    { "predestinated", "predestinate" },
+    { "preparations", "preparation" },
+    { "prepared", "prepare" },
+    { "prepares", "prepare" },
+    { "preparest", "prepare" },
+    { "preparing", "prepare" },
+    { "presented", "present" },
+    { "presenting", "present" },
+    { "presents", "present" },
+    { "preserved", "preserve" },
+    { "preserves", "preserve" },
+    { "preservest", "preserve" },
+    { "pressed", "press" },
+    { "presses", "press" },
+    { "pressing", "press" },
+    { "presumed", "presume" },
+    { "pretended", "pretend" },
+    { "pretending", "pretend" },
+    { "prevailed", "prevail" },
+    { "prevailest", "prevails" },
+    { "prevailing", "prevail" },
+    { "prevails", "prevail" },
+    { "prevented", "prevent" },
+    { "preventing", "prevent" },
+    { "priced", "price" },
+    { "prices", "price" },
+    { "pricking", "pricks" },
+    { "priests", "priest" },
+    { "princes", "prince" },
+    { "princess", "princes" },
+    { "princesses", "princess" },
+    { "printed", "print" },
+    { "prisoners", "prisoner" },
+    { "prisons", "prison" },
+    { "prized", "prize" },
+    { "proceeded", "proceed" },
+    { "proceeding", "proceed" },
+    { "proceeds", "proceed" },
+    { "proclaimed", "proclaim" },
+    { "proclaiming", "proclaim" },
+    { "proconsuls", "proconsul" },
+    { "procured", "procure" },
+    { "produced", "produce" },
+    { "produces", "produce" },
+    { "profaned", "profane" },
+    { "profanes", "profane" },
+    { "profaning", "profane" },
+    { "professed", "profess" },
+    { "professing", "profess" },
+    { "profited", "profit" },
+    { "profiting", "profit" },
+    { "profits", "profit" },
+    { "prolonged", "prolong" },
+    { "prolongs", "prolong" },
+    { "promised", "promise" },
+    { "promises", "promise" },
+    { "promising", "promise" },
+    { "promoted", "promote" },
+    { "promotes", "promote" },
+    { "pronounced", "pronounce" },
+    { "pronounces", "pronounce" },
+    { "pronouncing", "pronounce" },
+    { "proofs", "proof" },
+    { "prophesying", "prophesy" },
+    { "prophesyings", "prophesying" },
+    { "prophets", "prophet" },
+    { "proselytes", "proselyte" },
+    { "prospered", "prosper" },
+    { "prospers", "prosper" },
+    { "prostituted", "prostitute" },
+    { "prostitutes", "prostitute" },
+    { "protects", "protect" },
+    { "protested", "protest" },
+    { "protesting", "protest" },
+    { "proved", "prove" },
+    { "proverbs", "proverb" },
+    { "proves", "prove" },
+    { "provided", "provide" },
+    { "provides", "provide" },
+    { "providing", "provide" },
+    { "provinces", "province" },
+    { "proving", "prove" },
+    { "provisioned", "provision" },
+    { "provisions", "provision" },
+    { "provocations", "provocation" },
+    { "provoked", "provoke" },
+    { "provokes", "provoke" },
+    { "provoking", "provoke" },
+    { "pruned", "prune" },
+    { "prunes", "prune" },
+    { "pruning", "prune" },
+    { "psalms", "psalm" },
+    { "publicans", "publican" },
+    { "published", "publish" },
+    { "publishes", "publish" },
+    { "pulled", "pull" },
+    { "pulling", "pull" },
+    { "punished", "punish" },
+    { "punishing", "punish" },
+    { "punishments", "punishment" },
+    { "purchased", "purchase" },
+    { "purest", "pure" },
+    { "purged", "purge" },
+    { "purges", "purge" },
+    { "purging", "purge" },
+    { "purifications", "purification" },
+    { "purifying", "purify" },
+    { "puring", "pur" },
+    { "purposed", "purpose" },
+    { "purposes", "purpose" },
+    { "purposing", "purpose" },
+    { "purses", "purse" },
+    { "pursued", "pursue" },
+    { "pursuers", "pursuer" },
+    { "pursues", "pursue" },
+    { "pursuing", "pursue" },
+    { "pushed", "push" },
+    { "pushing", "push" },
+    { "puts", "put" },
+    { "quails", "quail" },
+    { "quaked", "quake" },
+    { "quakes", "quake" },
+    { "quaking", "quake" },
+    { "quarreled", "quarrel" },
+    { "quarreling", "quarrel" },
+    { "quarrels", "quarrel" },
+    { "quarters", "quarter" },
+    { "queens", "queen" },
+    { "quenched", "quench" },
+    { "questioned", "question" },
+    { "questioning", "question" },
+    { "questionings", "questioning" },
+    { "questions", "question" },
+    { "quickened", "quicken" },
+    { "quickening", "quicken" },
+    { "quieted", "quiet" },
+    { "quivered", "quiver" },
+    { "quivering", "quiver" },
+    { "raged", "rage" },
+    { "rages", "rage" },
+    { "raging", "rage" },
+    { "railed", "rail" },
+    { "railing", "rail" },
+    { "railings", "railing" },
+    { "rained", "rain" },
+    { "rains", "rain" },
+    { "raised", "raise" },
+    { "raises", "raise" },
+    { "raising", "raise" },
+    { "raisins", "raisin" },
+    { "ramathite", "ramath" },
+    { "ramparts", "rampart" },
+    { "rams", "ram" },
+    { "ranges", "rang" },
+    { "ranging", "rang" },
+    { "ranks", "rank" },
+    { "ransomed", "ransom" },
+    { "rated", "rate" },
+    { "ravaged", "ravage" },
+    { "ravages", "ravage" },
+    { "ravening", "raven" },
+    { "ravens", "raven" },
+    { "reached", "reach" },
+    { "reaches", "reach" },
+    { "reaching", "reach" },
+    { "readest", "reads" },
+    { "reading", "read" },
+    { "reads", "read" },
+    { "reaped", "reap" },
+    { "reapers", "reaper" },
+    { "reapest", "reaps" },
+    { "reaping", "reap" },
+    { "reaps", "reap" },
+    { "reared", "rear" },
+    { "reasoned", "reason" },
+    { "reasoning", "reason" },
+    { "reasons", "reason" },
+    { "rebels", "rebel" },
+    { "rebuked", "rebuke" },
+    { "rebukes", "rebuke" },
+    { "rebuking", "rebuke" },
+    { "received", "receive" },
+    { "receives", "receive" },
+    { "receiving", "receive" },
+    { "reckoned", "reckon" },
+    { "reckoning", "reckon" },
+    { "reclining", "recline" },
+    { "recognized", "recognize" },
+    { "recognizing", "recognize" },
+    { "recompences", "recompence" },
+    { "recompensed", "recompense" },
+    { "recompenses", "recompense" },
+    { "recompensest", "recompense" },
+    { "recompensing", "recompense" },
+    { "reconciled", "reconcile" },
+    { "reconciling", "reconcile" },
+    { "recorded", "record" },
+    { "records", "record" },
+    { "recounted", "recount" },
+    { "recovered", "recover" },
+    { "recovering", "recover" },
+    { "redeemed", "redeem" },
+    { "redeeming", "redeem" },
+    { "redeems", "redeem" },
+    { "reeds", "reed" },
+    { "reeling", "reel" },
+    { "refined", "refine" },
+    { "refining", "refine" },
+    { "reflects", "reflect" },
+    { "refrained", "refrain" },
+    { "refreshed", "refresh" },
+    { "refreshes", "refresh" },
+    { "refreshing", "refresh" },
+    { "refused", "refuse" },
+    { "refuses", "refuse" },
+    { "refuted", "refute" },
+    { "regarded", "regard" },
+    { "regardest", "regards" },
+    { "regarding", "regard" },
+    { "regards", "regard" },
+    { "regions", "region" },
+    { "rehearsed", "rehearse" },
+    { "reigned", "reign" },
+    { "reignest", "reigns" },
+    { "reigning", "reign" },
+    { "reigns", "reign" },
+    { "rejected", "reject" },
+    { "rejects", "reject" },
+    { "rejoiced", "rejoice" },
+    { "rejoices", "rejoice" },
+    { "rejoicest", "rejoice" },
+    { "rejoicing", "rejoice" },
+    { "relatives", "relative" },
+    { "released", "release" },
+    { "relents", "relent" },
+    { "relieved", "relieve" },
+    { "remained", "remain" },
+    { "remainest", "remains" },
+    { "remaining", "remain" },
+    { "remains", "remain" },
+    { "remembered", "remember" },
+    { "rememberest", "remembers" },
+    { "remembering", "remember" },
+    { "remembers", "remember" },
+    { "remembrances", "remembrance" },
+    { "reminded", "remind" },
+    { "reminding", "remind" },
+    { "removed", "remove" },
+    { "removes", "remove" },
+    { "removing", "remove" },
+    { "rendered", "render" },
+    { "renderest", "renders" },
+    { "rendering", "render" },
+    { "renders", "render" },
+    { "rending", "rend" },
+    { "renewed", "renew" },
+    { "renewing", "renew" },
+    { "renounced", "renounce" },
+    { "renounces", "renounce" },
+    { "renowned", "renown" },
+    { "rented", "rent" },
+    { "renting", "rent" },
+    { "repaired", "repair" },
+    { "repairers", "repairer" },
+    { "repairing", "repair" },
+    { "repayed", "repay" },
+    { "repays", "repay" },
+    { "repented", "repent" },
+    { "repentest", "repents" },
+    { "repenting", "repent" },
+    { "repentings", "repenting" },
+    { "repents", "repent" },
+    { "rephaims", "rephaim" },
+    { "replenished", "replenish" },
+    { "reported", "report" },
+    { "reporting", "report" },
+    { "reproached", "reproach" },
+    { "reproaches", "reproach" },
+    { "reproaching", "reproach" },
+    { "reprobates", "reprobate" },
+    { "reproofs", "reproof" },
+    { "reproved", "reprove" },
+    { "reproves", "reprove" },
+    { "requested", "request" },
+    { "requesting", "request" },
+    { "requests", "request" },
+    { "required", "require" },
+    { "requires", "require" },
+    { "requirest", "require" },
+    { "requiring", "require" },
+    { "requited", "requite" },
+    { "requiting", "requite" },
+    { "rescued", "rescue" },
+    { "rescues", "rescue" },
+    { "resembled", "resemble" },
+    { "reserved", "reserve" },
+    { "resisted", "resist" },
+    { "resists", "resist" },
+    { "resorted", "resort" },
+    { "respected", "respect" },
+    { "respects", "respect" },
+    { "responded", "respond" },
+    { "rested", "rest" },
+    { "restest", "rests" },
+    { "resting", "rest" },
+    { "restored", "restore" },
+    { "restores", "restore" },
+    { "restoring", "restore" },
+    { "restrained", "restrain" },
+    { "restrainest", "restrains" },
+    { "restraining", "restrain" },
+    { "restrains", "restrain" },
+    { "rests", "rest" },
+    { "results", "result" },
+    { "retained", "retain" },
+    { "retains", "retain" },
+    { "retired", "retire" },
+    { "returned", "return" },
+    { "returning", "return" },
+    { "returns", "return" },
+    { "reubenite", "reuben" },
+    { "reubenites", "reubenite" },
+    { "revealed", "reveal" },
+    { "reveals", "reveal" },
+    { "revelations", "revelation" },
+    { "reveling", "revel" },
+    { "revenged", "revenge" },
+    { "revengers", "revenger" },
+    { "revenges", "revenge" },
+    { "revenging", "revenge" },
+    { "revenues", "revenue" },
+    { "reverenced", "reverence" },
+    { "reviled", "revile" },
+    { "reviles", "revile" },
+    { "revilest", "revile" },
+    { "reviling", "revile" },
+    { "revilings", "reviling" },
+    { "revived", "revive" },
+    { "reviving", "revive" },
+    { "revolted", "revolt" },
+    { "revolting", "revolt" },
+    { "rewarded", "reward" },
+    { "rewards", "reward" },
+    { "ribs", "rib" },
+    { "riches", "rich" },
+    { "riching", "rich" },
+    { "riddles", "riddle" },
+    { "riders", "rider" },
+    { "rides", "rid" },
+    { "riding", "rid" },
+    { "righteousnesses", "righteousness" },
+    { "rights", "right" },
+    { "rims", "rim" },
+    { "rings", "ring" },
+    { "rioting", "riot" },
+    { "riots", "riot" },
+    { "ripening", "ripens" },
+    { "rises", "rise" },
+    { "risest", "rise" },
+    { "rising", "rise" },
+    { "rivers", "river" },
+    { "roaming", "roams" },
+    { "roared", "roar" },
+    { "roaring", "roar" },
+    { "roarings", "roaring" },
+    { "roars", "roar" },
+    { "roasted", "roast" },
+    { "roasts", "roast" },
+    { "robbers", "robber" },
+    { "robes", "rob" },
+    { "robs", "rob" },
+    { "rocks", "rock" },
+    { "rods", "rod" },
+    { "roebucks", "roebuck" },
+    { "roes", "roe" },
+    { "rolled", "roll" },
+    { "rolling", "roll" },
+    { "rolls", "roll" },
+    { "romans", "roman" },
+    { "roofs", "roof" },
+    { "rooms", "room" },
+    { "rooted", "root" },
+    { "roots", "root" },
+    { "ropes", "rope" },
+    { "rots", "rot" },
+    { "rounded", "round" },
+    { "roused", "rouse" },
+    { "routed", "rout" },
+    { "rowed", "row" },
+    { "rowing", "row" },
+    { "rows", "row" },
+    { "ruined", "ruin" },
+    { "ruins", "ruin" },
+    { "ruled", "rule" },
+    { "rulers", "ruler" },
+    { "rules", "rule" },
+    { "rulest", "rule" },
+    { "ruling", "rule" },
+    { "rumors", "rumor" },
+    { "rumours", "rumour" },
+    { "runs", "run" },
+    { "rushed", "rush" },
+    { "rushes", "rush" },
+    { "rushing", "rush" },
+    { "sabbaths", "sabbath" },
+    { "sackclothes", "sackcloth" },
+    { "sacks", "sack" },
+    { "sacrificed", "sacrifice" },
+    { "sacrifices", "sacrifice" },
+    { "sacrificing", "sacrifice" },
+    { "saddled", "saddle" },
+    { "sailed", "sail" },
+    { "sailing", "sail" },
+    { "sails", "sail" },
+    { "saints", "saint" },
+    { "sakes", "sake" },
+    { "salted", "salt" },
+    { "salutations", "salutation" },
+    { "saluted", "salute" },
+    { "salutes", "salute" },
+    { "samaritans", "samaritan" },
+    { "sandals", "sandal" },
+    { "sapphires", "sapphire" },
+    { "sashes", "sash" },
+    { "sated", "sat" },
+    { "satest", "sata" },
+    { "satiated", "satiate" },
+    { "sating", "sat" },
+    { "satisfying", "satisfy" },
+    { "satyrs", "satyr" },
+    { "saved", "save" },
+    { "saves", "save" },
+    { "savest", "save" },
+    { "saving", "save" },
+    { "saviors", "savior" },
+    { "saviours", "saviour" },
+    { "savourest", "savours" },
+    { "savouring", "savour" },
+    { "savours", "savour" },
+    { "sawed", "saw" },
+    { "sawest", "sawn" },
+    { "sawing", "saw" },
+    { "saws", "saw" },
+    { "sayest", "says" },
+    { "saying", "say" },
+    { "sayings", "saying" },
+    { "says", "say" },
+    { "scared", "scar" },
+    { "scaring", "scar" },
+    { "scattered", "scatter" },
+    { "scattering", "scatter" },
+    { "scatters", "scatter" },
+    { "scepters", "scepter" },
+    { "sceptres", "sceptre" },
+    { "schemes", "scheme" },
+    { "scoffed", "scoff" },
+    { "scoffers", "scoffer" },
+    { "scoffing", "scoff" },
+    { "scoffs", "scoff" },
+    { "scorched", "scorch" },
+    { "scorching", "scorch" },
+    { "scorned", "scorn" },
+    { "scorners", "scorner" },
+    { "scornest", "scorns" },
+    { "scorning", "scorn" },
+    { "scorns", "scorn" },
+    { "scorpions", "scorpion" },
+    { "scourged", "scourge" },
+    { "scourges", "scourge" },
+    { "scourging", "scourge" },
+    { "scourgings", "scourging" },
+    { "scraped", "scrape" },
+    { "screened", "screen" },
+    { "scribes", "scribe" },
+    { "scriptures", "scripture" },
+    { "sealed", "seal" },
+    { "sealest", "seals" },
+    { "sealing", "seal" },
+    { "seals", "seal" },
+    { "seams", "seam" },
+    { "searched", "search" },
+    { "searches", "search" },
+    { "searching", "search" },
+    { "searchings", "searching" },
+    { "seas", "sea" },
+    { "seasoned", "season" },
+    { "seasons", "season" },
+    { "seated", "seat" },
+    { "seats", "seat" },
+    { "secrets", "secret" },
+    { "secured", "secure" },
+    { "seditions", "sedition" },
+    { "seduced", "seduce" },
+    { "seduces", "seduce" },
+    { "seducing", "seduce" },
+    { "seed", "see" },
+    { "seeds", "seed" },
+    { "seeing", "see" },
+    { "seekest", "seeks" },
+    { "seeking", "seek" },
+    { "seeks", "seek" },
+    { "seemed", "seem" },
+    { "seems", "seem" },
+    { "seers", "seer" },
+    { "sees", "see" },
+    { "seest", "sea" },
+    { "seething", "seeth" },
+    { "seized", "seize" },
+    { "seizes", "seize" },
+    { "selfwilled", "selfwill" },
+    { "sellers", "seller" },
+    { "sellest", "sells" },
+    { "selling", "sell" },
+    { "sells", "sell" },
+    { "sendest", "sends" },
+    { "sending", "send" },
+    { "sends", "send" },
+    { "senses", "sense" },
+    { "sentenced", "sentence" },
+    { "sentences", "sentence" },
+    { "senting", "sent" },
+    { "separated", "separate" },
+    { "separates", "separate" },
+    { "separating", "separate" },
+    { "sepulchres", "sepulchre" },
+    { "seraphims", "seraphim" },
+    { "serpents", "serpent" },
+    { "servants", "servant" },
+    { "served", "serve" },
+    { "serves", "serve" },
+    { "servest", "serve" },
+    { "services", "service" },
+    { "serving", "serve" },
+    { "sets", "set" },
+    { "settings", "setting" },
+    { "settled", "settle" },
+    { "settles", "settle" },
+    { "settlest", "settle" },
+    { "sevens", "seven" },
+    { "severed", "sever" },
+    { "sewed", "sew" },
+    { "sewest", "sews" },
+    { "sewing", "sew" },
+    { "sews", "sew" },
+    { "shadowing", "shadow" },
+    { "shadows", "shadow" },
+    { "shafts", "shaft" },
+    { "shaked", "shake" },
+    { "shakes", "shake" },
+    { "shaking", "shake" },
+    { "shamed", "shame" },
+    { "shames", "shame" },
+    { "shapes", "shape" },
+    { "shared", "share" },
+    { "shares", "share" },
+    { "sharing", "share" },
+    { "sharonite", "sharon" },
+    { "sharpened", "sharpen" },
+    { "sharpens", "sharpen" },
+    { "shaved", "shave" },
+    { "shearers", "shearer" },
+    { "shearing", "shear" },
+    { "sheathed", "sheath" },
+    { "shed", "she" },
+    { "sheds", "shed" },
+    { "sheepcotes", "sheepcote" },
+    { "sheepfolds", "sheepfold" },
+    { "sheets", "sheet" },
+    { "shekels", "shekel" },
+    { "shelters", "shelter" },
+    { "shemed", "shem" },
+    { "shemite", "shem" },
+    { "shepherd", "shepher" },
+    { "shepherds", "shepherd" },
+    { "sherds", "sherd" },
+    { "shewed", "shew" },
+    { "shewing", "shew" },
+    { "shields", "shield" },
+    { "shilonites", "shilonite" },
+    { "shined", "shine" },
+    { "shines", "shine" },
+    { "shining", "shine" },
+    { "ships", "ship" },
+    { "shocks", "shock" },
+    { "shoes", "shoe" },
+    { "shooting", "shoot" },
+    { "shoots", "shoot" },
+    { "shores", "shore" },
+    { "shoulders", "shoulder" },
+    { "shouldest", "shouldn" },
+    { "shoulding", "should" },
+    { "shouted", "shout" },
+    { "shouting", "shout" },
+    { "shoutings", "shouting" },
+    { "shouts", "shout" },
+    { "shovels", "shovel" },
+    { "showed", "show" },
+    { "showers", "shower" },
+    { "showing", "show" },
+    { "shows", "show" },
+    { "shrines", "shrine" },
+    { "shrinks", "shrink" },
+    { "shuns", "shun" },
+    { "shuts", "shut" },
+    { "sicknesses", "sickness" },
+    { "sided", "side" },
+    { "sides", "side" },
+    { "sifted", "sift" },
+    { "sighed", "sigh" },
+    { "sighest", "sighs" },
+    { "sighing", "sigh" },
+    { "sighs", "sigh" },
+    { "sights", "sight" },
+    { "signals", "signal" },
+    { "signed", "sign" },
+    { "signets", "signet" },
+    { "signifying", "signify" },
+    { "signs", "sign" },
+    { "silenced", "silence" },
+    { "similitudes", "similitude" },
+    { "sinews", "sinew" },
+    { "sing", "s" },
+    { "singed", "sing" },
+    { "singers", "singer" },
+    { "singing", "sing" },
+    { "sings", "sing" },
+    { "sinite", "sin" },
+    { "sinks", "sink" },
+    { "sinners", "sinner" },
+    { "sins", "sin" },
+    { "sirs", "sir" },
+    { "sisters", "sister" },
+    { "sits", "sit" },
+    { "situated", "situate" },
+    { "skilled", "skill" },
+    { "skins", "skin" },
+    { "skirts", "skirt" },
+    { "slacked", "slack" },
+    { "slandered", "slander" },
+    { "slanderers", "slanderer" },
+    { "slanderest", "slanders" },
+    { "slandering", "slander" },
+    { "slanders", "slander" },
+    { "slaughtered", "slaughter" },
+    { "slaves", "slave" },
+    { "slaying", "slay" },
+    { "slays", "slay" },
+    { "sleepest", "sleeps" },
+    { "sleeping", "sleep" },
+    { "sleeps", "sleep" },
+    { "slewing", "slew" },
+    { "slinging", "sling" },
+    { "slings", "sling" },
+    { "slips", "slip" },
+    { "slopes", "slope" },
+    { "slumbered", "slumber" },
+    { "slumbering", "slumber" },
+    { "slumberings", "slumbering" },
+    { "smalling", "small" },
+    { "smelled", "smell" },
+    { "smelling", "smell" },
+    { "smells", "smell" },
+    { "smiled", "smile" },
+    { "smitest", "smite" },
+    { "smiths", "smith" },
+    { "smiting", "smite" },
+    { "smoked", "smoke" },
+    { "smoking", "smoke" },
+    { "smoothes", "smooth" },
+    { "smotest", "smote" },
+    { "snared", "snare" },
+    { "snares", "snare" },
+    { "snatched", "snatch" },
+    { "snatches", "snatch" },
+    { "snatching", "snatch" },
+    { "snorting", "snorts" },
+    { "snowed", "snow" },
+    { "snuffed", "snuff" },
+    { "snuffs", "snuff" },
+    { "sockets", "socket" },
+    { "sod", "so" },
+    { "sodomite", "sodom" },
+    { "sodomites", "sodomite" },
+    { "sojourned", "sojourn" },
+    { "sojourners", "sojourner" },
+    { "sojourning", "sojourn" },
+    { "sojourns", "sojourn" },
+    { "soldiers", "soldier" },
+    { "soles", "sole" },
+    { "sometimes", "sometime" },
+    { "songs", "song" },
+    { "sons", "son" },
+    { "soothsayers", "soothsayer" },
+    { "sorcerers", "sorcerer" },
+    { "sores", "sore" },
+    { "sorrowed", "sorrow" },
+    { "sorrowing", "sorrow" },
+    { "sorrows", "sorrow" },
+    { "sorts", "sort" },
+    { "souls", "soul" },
+    { "sounded", "sound" },
+    { "sounding", "sound" },
+    { "soundings", "sounding" },
+    { "sounds", "sound" },
+    { "sowed", "sow" },
+    { "sowest", "sown" },
+    { "sowing", "sow" },
+    { "sows", "sow" },
+    { "spakest", "spake" },
+    { "spared", "spare" },
+    { "spares", "spare" },
+    { "sparing", "spare" },
+    { "sparks", "spark" },
+    { "sparrows", "sparrow" },
+    { "speakest", "speaks" },
+    { "speaking", "speak" },
+    { "speakings", "speaking" },
+    { "speaks", "speak" },
+    { "spears", "spear" },
+    { "speeches", "speech" },
+    { "spendest", "spends" },
+    { "spending", "spend" },
+    { "spends", "spend" },
+    { "spewed", "spew" },
+    { "spewing", "spew" },
+    { "spiced", "spice" },
+    { "spices", "spice" },
+    { "spirits", "spirit" },
+    { "splits", "split" },
+    { "spoiled", "spoil" },
+    { "spoilers", "spoiler" },
+    { "spoilest", "spoils" },
+    { "spoiling", "spoil" },
+    { "spoils", "spoil" },
+    { "spokes", "spoke" },
+    { "spoons", "spoon" },
+    { "sporting", "sport" },
+    { "spots", "spot" },
+    { "spouses", "spouse" },
+    { "spreadest", "spreads" },
+    { "spreading", "spread" },
+    { "spreadings", "spreading" },
+    { "spreads", "spread" },
+    { "springing", "spring" },
+    { "springs", "spring" },
+    { "sprinkled", "sprinkle" },
+    { "sprinkles", "sprinkle" },
+    { "sprinkling", "sprinkle" },
+    { "sprouts", "sprout" },
+    { "spued", "spue" },
+    { "spying", "spy" },
+    { "squared", "square" },
+    { "squares", "square" },
+    { "stablished", "stablish" },
+    { "staffs", "staff" },
+    { "staggered", "stagger" },
+    { "staggering", "stagger" },
+    { "staggers", "stagger" },
+    { "stained", "stain" },
+    { "stalks", "stalk" },
+    { "stalled", "stall" },
+    { "stalls", "stall" },
+    { "stamped", "stamp" },
+    { "stamping", "stamp" },
+    { "standards", "standard" },
+    { "standest", "stands" },
+    { "standing", "stand" },
+    { "stands", "stand" },
+    { "stars", "star" },
+    { "starting", "start" },
+    { "statutes", "statute" },
+    { "stayed", "stay" },
+    { "staying", "stay" },
+    { "stays", "stay" },
+    { "steads", "stead" },
+    { "stealing", "steal" },
+    { "steals", "steal" },
+    { "steeds", "steed" },
+    { "steps", "step" },
+    { "stewards", "steward" },
+    { "sticks", "stick" },
+    { "stilled", "still" },
+    { "stillest", "stills" },
+    { "stilling", "still" },
+    { "stills", "still" },
+    { "stings", "sting" },
+    { "stinking", "stink" },
+    { "stirs", "stir" },
+    { "stocks", "stock" },
+    { "stoned", "stone" },
+    { "stones", "stone" },
+    { "stonest", "stone" },
+    { "stoning", "stone" },
+    { "stooding", "stood" },
+    { "stools", "stool" },
+    { "stooped", "stoop" },
+    { "stooping", "stoop" },
+    { "stoops", "stoop" },
+    { "stops", "stop" },
+    { "stored", "store" },
+    { "storehouses", "storehouse" },
+    { "stores", "store" },
+    { "strained", "strain" },
+    { "straitened", "straiten" },
+    { "straitest", "straits" },
+    { "straiting", "strait" },
+    { "straits", "strait" },
+    { "strakes", "strake" },
+    { "strangers", "stranger" },
+    { "strawed", "straw" },
+    { "streams", "stream" },
+    { "streets", "street" },
+    { "strengthened", "strengthen" },
+    { "strengthening", "strengthen" },
+    { "strengthens", "strengthen" },
+    { "stretched", "stretch" },
+    { "stretches", "stretch" },
+    { "stretching", "stretch" },
+    { "stricting", "strict" },
+    { "strifes", "strife" },
+    { "strikers", "striker" },
+    { "strikes", "strike" },
+    { "striking", "strike" },
+    { "stringed", "string" },
+    { "strings", "string" },
+    { "striped", "strip" },
+    { "stripes", "strip" },
+    { "strips", "strip" },
+    { "strived", "strive" },
+    { "strives", "strive" },
+    { "striving", "strive" },
+    { "strivings", "striving" },
+    { "strokes", "stroke" },
+    { "strongholds", "stronghold" },
+    { "stronging", "strong" },
+    { "struggled", "struggle" },
+    { "struggles", "struggle" },
+    { "studs", "stud" },
+    { "stumbled", "stumble" },
+    { "stumbles", "stumble" },
+    { "stumbling", "stumble" },
+    { "stumblingblocks", "stumblingblock" },
+    { "stumblings", "stumbling" },
+    { "subdued", "subdue" },
+    { "subdues", "subdue" },
+    { "subjected", "subject" },
+    { "subjecting", "subject" },
+    { "subscribed", "subscribe" },
+    { "subverted", "subvert" },
+    { "subverting", "subvert" },
+    { "subverts", "subvert" },
+    { "succeeded", "succeed" },
+    { "succeeding", "succeed" },
+    { "succoured", "succour" },
+    { "sucked", "suck" },
+    { "sucking", "suck" },
+    { "sucklings", "suckling" },
+    { "sues", "sue" },
+    { "suffered", "suffer" },
+    { "sufferest", "suffers" },
+    { "suffering", "suffer" },
+    { "sufferings", "suffering" },
+    { "suffers", "suffer" },
+    { "sufficed", "suffice" },
+    { "suits", "suit" },
+    { "sukkiims", "sukkiim" },
+    { "summoned", "summon" },
+    { "summons", "summon" },
+    { "sundered", "sunder" },
+    { "sunrising", "sunrise" },
+    { "supplanted", "supplant" },
+    { "supplications", "supplication" },
+    { "supported", "support" },
+    { "supports", "support" },
+    { "supposed", "suppose" },
+    { "supposing", "suppose" },
+    { "surnamed", "surname" },
+    { "surrounded", "surround" },
+    { "surrounding", "surround" },
+    { "surrounds", "surround" },
+    { "sustained", "sustain" },
+    { "sustains", "sustain" },
+    { "swallowed", "swallow" },
+    { "swallows", "swallow" },
+    { "swarest", "sware" },
+    { "swarmed", "swarm" },
+    { "swarming", "swarm" },
+    { "swarms", "swarm" },
+    { "sways", "sway" },
+    { "swearing", "swear" },
+    { "swears", "swear" },
+    { "sweeping", "sweep" },
+    { "sweeps", "sweep" },
+    { "swelled", "swell" },
+    { "swelling", "swell" },
+    { "swellings", "swelling" },
+    { "swells", "swell" },
+    { "swerved", "swerve" },
+    { "swims", "swim" },
+    { "swooned", "swoon" },
+    { "swords", "sword" },
+    { "sycamores", "sycamore" },
+    { "sycomores", "sycomore" },
+    { "symbols", "symbol" },
+    { "synagogues", "synagogue" },
+    { "syrians", "syrian" },
+    { "tabernacles", "tabernacle" },
+    { "tables", "table" },
+    { "tablets", "tablet" },
+    { "tabrets", "tabret" },
+    { "tackling", "tackle" },
+    { "tacklings", "tackling" },
+    { "tails", "tail" },
+    { "takes", "take" },
+    { "takest", "take" },
+    { "taking", "take" },
+    { "talents", "talent" },
+    { "tales", "tale" },
+    { "talked", "talk" },
+    { "talkest", "talks" },
+    { "talking", "talk" },
+    { "talks", "talk" },
+    { "tambourines", "tambourine" },
+    { "tamed", "tame" },
+    { "tares", "tar" },
+    { "targets", "target" },
+    { "tarrying", "tarry" },
+    { "taskmasters", "taskmaster" },
+    { "tasks", "task" },
+    { "tasted", "taste" },
+    { "tastes", "taste" },
+    { "taunting", "taunt" },
+    { "taunts", "taunt" },
+    { "taxed", "tax" },
+    { "taxes", "tax" },
+    { "taxing", "tax" },
+    { "teachers", "teacher" },
+    { "teaches", "teach" },
+    { "teaching", "teach" },
+    { "teachings", "teaching" },
+    { "tearing", "tear" },
+    { "tears", "tear" },
+    { "tekoites", "tekoite" },
+    { "tellest", "tells" },
+    { "telling", "tell" },
+    { "tells", "tell" },
+    { "temanite", "teman" },
+    { "temanites", "temanite" },
+    { "tempered", "temper" },
+    { "tempest", "tempt" },
+    { "temples", "temple" },
+    { "temptations", "temptation" },
+    { "tempted", "tempt" },
+    { "tempting", "tempt" },
+    { "tempts", "tempt" },
+    { "tend", "ten" },
+    { "tends", "tend" },
+    { "tens", "ten" },
+    { "tents", "tent" },
+    { "terebinths", "terebinth" },
+    { "terrors", "terror" },
+    { "test", "to" },
+    { "tested", "test" },
+    { "testifying", "testify" },
+    { "testing", "test" },
+    { "tests", "test" },
+    { "thanked", "thank" },
+    { "thanking", "thank" },
+    { "thanks", "thank" },
+    { "thanksgivings", "thanksgiving" },
+    { "thefts", "theft" },
+    { "theirs", "their" },
+    { "thickets", "thicket" },
+    { "thighs", "thigh" },
+    { "thing", "the" },
+    { "things", "thing" },
+    { "thinkest", "thinks" },
+    { "thinking", "think" },
+    { "thinks", "think" },
+    { "thirsted", "thirst" },
+    { "thirsts", "thirst" },
+    { "thistles", "thistle" },
+    { "thongs", "thong" },
+    { "thorns", "thorn" },
+    { "thoughtest", "thoughts" },
+    { "thoughting", "thought" },
+    { "thoughts", "thought" },
+    { "thousands", "thousand" },
+    { "threatened", "threaten" },
+    { "threatening", "threaten" },
+    { "threatenings", "threatening" },
+    { "threats", "threat" },
+    { "threshed", "thresh" },
+    { "threshes", "thresh" },
+    { "threshing", "thresh" },
+    { "threshingfloors", "threshingfloor" },
+    { "thresholds", "threshold" },
+    { "threwing", "threw" },
+    { "thriving", "thrive" },
+    { "thrones", "throne" },
+    { "thronged", "throng" },
+    { "thronging", "throng" },
+    { "throwing", "throw" },
+    { "throws", "throw" },
+    { "thrusts", "thrust" },
+    { "thumbs", "thumb" },
+    { "thundered", "thunder" },
+    { "thunders", "thunder" },
+    { "tied", "tie" },
+    { "tiles", "tile" },
+    { "tiling", "tile" },
+    { "tilled", "till" },
+    { "tillest", "tills" },
+    { "tilling", "till" },
+    { "tills", "till" },
+    { "timbrels", "timbrel" },
+    { "times", "time" },
+    { "ting", "t" },
+    { "tired", "tire" },
+    { "tires", "tire" },
+    { "tithes", "tithe" },
+    { "tithing", "tithe" },
+    { "titles", "title" },
+    { "toes", "to" },
+    { "toiled", "toil" },
+    { "toiling", "toil" },
+    { "tokens", "token" },
+    { "tolad", "tola" },
+    { "tombs", "tomb" },
+    { "tongued", "tongue" },
+    { "tongues", "tongue" },
+    { "tooking", "took" },
+    { "tops", "top" },
+    { "torches", "torch" },
+    { "tormented", "torment" },
+    { "tormentors", "tormentor" },
+    { "torments", "torment" },
+    { "tossed", "toss" },
+    { "touched", "touch" },
+    { "touches", "touch" },
+    { "touching", "touch" },
+    { "towards", "toward" },
+    { "towers", "tower" },
+    { "towns", "town" },
+    { "traded", "trade" },
+    { "trading", "trade" },
+    { "traditions", "tradition" },
+    { "trafficked", "traffick" },
+    { "traffickers", "trafficker" },
+    { "trained", "train" },
+    { "traitors", "traitor" },
+    { "trampled", "trample" },
+    { "transgressed", "transgress" },
+    { "transgresses", "transgress" },
+    { "transgressing", "transgress" },
+    { "transgressions", "transgression" },
+    { "transgressors", "transgressor" },
+    { "translated", "translate" },
+    { "traps", "trap" },
+    { "travailed", "travail" },
+    { "travailest", "travails" },
+    { "travailing", "travail" },
+    { "travails", "travail" },
+    { "traveled", "travel" },
+    { "travelers", "traveler" },
+    { "traveling", "travel" },
+    { "travellers", "traveller" },
+    { "travels", "travel" },
+    { "treaders", "treader" },
+    { "treading", "tread" },
+    { "treads", "tread" },
+    { "treasured", "treasure" },
+    { "treasurers", "treasurer" },
+    { "treasures", "treasure" },
+    { "treasurest", "treasure" },
+    { "treasuring", "treasure" },
+    { "treated", "treat" },
+    { "trees", "tree" },
+    { "trembled", "tremble" },
+    { "trembles", "tremble" },
+    { "trembling", "tremble" },
+    { "trenches", "trench" },
+    { "trespassed", "trespass" },
+    { "trespasses", "trespass" },
+    { "trespassing", "trespass" },
+    { "trials", "trial" },
+    { "tribes", "tribe" },
+    { "tribulations", "tribulation" },
+    { "triest", "trip" },
+    { "triumphed", "triumph" },
+    { "triumphing", "triumph" },
+    { "triumphs", "triumph" },
+    { "troops", "troop" },
+    { "troubled", "trouble" },
+    { "troubles", "trouble" },
+    { "troublest", "trouble" },
+    { "troubling", "trouble" },
+    { "troughs", "trough" },
+    { "trumpets", "trumpet" },
+    { "trusted", "trust" },
+    { "trustest", "trusts" },
+    { "trusting", "trust" },
+    { "trusts", "trust" },
+    { "trying", "try" },
+    { "tumults", "tumult" },
+    { "tuned", "tune" },
+    { "turbans", "turban" },
+    { "turned", "turn" },
+    { "turnest", "turns" },
+    { "turning", "turn" },
+    { "turns", "turn" },
+    { "turtledoves", "turtledove" },
+    { "turtles", "turtle" },
+    { "tutors", "tutor" },
+    { "twined", "twin" },
+    { "twins", "twin" },
+    { "twisted", "twist" },
+    { "unawares", "unaware" },
+    { "unbelievers", "unbeliever" },
+    { "uncleannesses", "uncleanness" },
+    { "uncovered", "uncover" },
+    { "uncovers", "uncover" },
+    { "understandest", "understands" },
+    { "understanding", "understand" },
+    { "understands", "understand" },
+    { "unicorns", "unicorn" },
+    { "united", "unit" },
+    { "unloaded", "unload" },
+    { "untied", "untie" },
+    { "upbraided", "upbraid" },
+    { "upholdest", "upholds" },
+    { "upholding", "uphold" },
+    { "upholds", "uphold" },
+    { "uprooted", "uproot" },
+    { "urged", "urge" },
+    { "urges", "urge" },
+    { "used", "us" },
+    { "uses", "us" },
+    { "usest", "use" },
+    { "using", "us" },
+    { "uttered", "utter" },
+    { "uttering", "utter" },
+    { "utters", "utter" },
+    { "vagabonds", "vagabond" },
+    { "vails", "vail" },
+    { "valianting", "valiant" },
+    { "valleys", "valley" },
+    { "valued", "value" },
+    { "valuest", "value" },
+    { "vanished", "vanish" },
+    { "vanishes", "vanish" },
+    { "vanishing", "vanish" },
+    { "vapors", "vapor" },
+    { "vapours", "vapour" },
+    { "vats", "vat" },
+    { "vaulted", "vault" },
+    { "veiled", "veil" },
+    { "veils", "veil" },
+    { "vents", "vent" },
+    { "ventures", "venture" },
+    { "vessels", "vessel" },
+    { "vestures", "vesture" },
+    { "vexations", "vexation" },
+    { "vexed", "vex" },
+    { "vials", "vial" },
+    { "victuals", "victual" },
+    { "viewed", "view" },
+    { "vilest", "vile" },
+    { "villages", "village" },
+    { "vindicated", "vindicate" },
+    { "vines", "vine" },
+    { "vineyards", "vineyard" },
+    { "violated", "violate" },
+    { "viols", "viol" },
+    { "vipers", "viper" },
+    { "virgins", "virgin" },
+    { "visions", "vision" },
+    { "visited", "visit" },
+    { "visitest", "visits" },
+    { "visiting", "visit" },
+    { "visits", "visit" },
+    { "voices", "voice" },
+    { "vomited", "vomit" },
+    { "vomits", "vomit" },
+    { "vowed", "vow" },
+    { "vowest", "vows" },
+    { "vowing", "vow" },
+    { "vows", "vow" },
+    { "vultures", "vulture" },
+    { "wafers", "wafer" },
+    { "wages", "wag" },
+    { "wagons", "wagon" },
+    { "wailed", "wail" },
+    { "wailing", "wail" },
+    { "wailings", "wailing" },
+    { "wails", "wail" },
+    { "waited", "wait" },
+    { "waiting", "wait" },
+    { "waits", "wait" },
+    { "waked", "wake" },
+    { "wakes", "wake" },
+    { "waking", "wake" },
+    { "walked", "walk" },
+    { "walkest", "walks" },
+    { "walking", "walk" },
+    { "walks", "walk" },
+    { "walled", "wall" },
+    { "wallowed", "wallow" },
+    { "wallowing", "wallow" },
+    { "walls", "wall" },
+    { "wandered", "wander" },
+    { "wanderers", "wanderer" },
+    { "wanderest", "wanders" },
+    { "wandering", "wander" },
+    { "wanderings", "wandering" },
+    { "wanders", "wander" },
+    { "wanted", "want" },
+    { "wanting", "want" },
+    { "wants", "want" },
+    { "ward", "war" },
+    { "wards", "ward" },
+    { "wares", "war" },
+    { "warmed", "warm" },
+    { "warming", "warm" },
+    { "warms", "warm" },
+    { "warned", "warn" },
+    { "warning", "warn" },
+    { "warns", "warn" },
+    { "warped", "warp" },
+    { "warriors", "warrior" },
+    { "wars", "war" },
+    { "washed", "wash" },
+    { "washing", "wash" },
+    { "washings", "washing" },
+    { "wasted", "wast" },
+    { "wastes", "wast" },
+    { "wasting", "wast" },
+    { "watched", "watch" },
+    { "watchers", "watcher" },
+    { "watches", "watch" },
+    { "watching", "watch" },
+    { "watchings", "watching" },
+    { "watercourses", "watercourse" },
+    { "watered", "water" },
+    { "waterest", "waters" },
+    { "watering", "water" },
+    { "waterpots", "waterpot" },
+    { "waters", "water" },
+    { "waved", "wave" },
+    { "waves", "wave" },
+    { "waxed", "wax" },
+    { "waxing", "wax" },
+    { "ways", "way" },
+    { "weakened", "weaken" },
+    { "weakens", "weaken" },
+    { "weaknesses", "weakness" },
+    { "weapons", "weapon" },
+    { "wearing", "wear" },
+    { "wears", "wear" },
+    { "weavest", "weave" },
+    { "weaving", "weave" },
+    { "webs", "web" },
+    { "weddings", "wedding" },
+    { "weeks", "week" },
+    { "weepest", "weeps" },
+    { "weeping", "weep" },
+    { "weeps", "weep" },
+    { "weighed", "weigh" },
+    { "weighing", "weigh" },
+    { "weighs", "weigh" },
+    { "weights", "weight" },
+    { "welcomed", "welcome" },
+    { "welcomes", "welcome" },
+    { "wells", "well" },
+    { "wenting", "went" },
+    { "west", "we" },
+    { "whales", "whale" },
+    { "wheels", "wheel" },
+    { "whelps", "whelp" },
+    { "whiles", "while" },
+    { "whips", "whip" },
+    { "whirlwinds", "whirlwind" },
+    { "whispered", "whisper" },
+    { "whisperers", "whisperer" },
+    { "whispering", "whisper" },
+    { "whisperings", "whispering" },
+    { "whited", "whit" },
+    { "whitened", "whiten" },
+    { "whitewashed", "whitewash" },
+    { "whoredoms", "whoredom" },
+    { "whoremongers", "whoremonger" },
+    { "whores", "whore" },
+    { "whoring", "whore" },
+    { "wicked", "wick" },
+    { "widows", "widow" },
+    { "wielding", "wield" },
+    { "wields", "wield" },
+    { "willed", "will" },
+    { "willing", "will" },
+    { "willows", "willow" },
+    { "wills", "will" },
+    { "wind", "win" },
+    { "winding", "wind" },
+    { "windows", "window" },
+    { "winds", "wind" },
+    { "winebibbers", "winebibber" },
+    { "winepresses", "winepress" },
+    { "wines", "win" },
+    { "wineskins", "wineskin" },
+    { "wing", "we" },
+    { "winged", "wing" },
+    { "wings", "wing" },
+    { "winked", "wink" },
+    { "winking", "wink" },
+    { "winks", "wink" },
+    { "winnowed", "winnow" },
+    { "winnowing", "winnow" },
+    { "winnows", "winnow" },
+    { "wins", "win" },
+    { "wintered", "winter" },
+    { "wiped", "wipe" },
+    { "wipes", "wipe" },
+    { "wiping", "wipe" },
+    { "wisest", "wise" },
+    { "wished", "wish" },
+    { "wishing", "wish" },
+    { "witchcrafts", "witchcraft" },
+    { "withdrawest", "withdrawn" },
+    { "withdrawing", "withdraw" },
+    { "withered", "wither" },
+    { "withers", "wither" },
+    { "withhelding", "withheld" },
+    { "withholds", "withhold" },
+    { "withs", "with" },
+    { "withstands", "withstand" },
+    { "witnessed", "witness" },
+    { "witnesses", "witness" },
+    { "witnessing", "witness" },
+    { "wits", "wit" },
+    { "wizards", "wizard" },
+    { "woes", "woe" },
+    { "wombs", "womb" },
+    { "wondered", "wonder" },
+    { "wondering", "wonder" },
+    { "wonders", "wonder" },
+    { "woods", "wood" },
+    { "words", "word" },
+    { "worked", "work" },
+    { "workers", "worker" },
+    { "working", "work" },
+    { "workings", "working" },
+    { "works", "work" },
+    { "worlds", "world" },
+    { "worms", "worm" },
+    { "worshiped", "worship" },
+    { "worshippers", "worshipper" },
+    { "worships", "worship" },
+    { "wouldest", "wouldn" },
+    { "woulding", "would" },
+    { "wounded", "wound" },
+    { "wounding", "wound" },
+    { "wounds", "wound" },
+    { "wraths", "wrath" },
+    { "wreathed", "wreath" },
+    { "wreaths", "wreath" },
+    { "wrestled", "wrestle" },
+    { "wrestling", "wrestle" },
+    { "wrestlings", "wrestling" },
+    { "wrests", "wrest" },
+    { "wringed", "wring" },
+    { "wringing", "wring" },
+    { "wrinkles", "wrinkle" },
+    { "writers", "writer" },
+    { "writes", "write" },
+    { "writest", "write" },
+    { "writing", "write" },
+    { "writings", "writing" },
+    { "wronged", "wrong" },
+    { "wrongs", "wrong" },
+    { "wroughting", "wrought" },
+    { "yearned", "yearn" },
+    { "yearning", "yearn" },
+    { "yearns", "yearn" },
+    { "years", "year" },
+    { "yelled", "yell" },
+    { "yes", "ye" },
+    { "yielded", "yield" },
+    { "yielding", "yield" },
+    { "yields", "yield" },
+    { "yoked", "yoke" },
+    { "yokes", "yoke" },
+    { "younging", "young" },
+    { "yours", "your" },
+    { "youths", "youth" },
+    { "zamzummims", "zamzummim" },
+    { "zebulunite", "zebulun" },
+    { "zebulunites", "zebulunite" },
+    { "zered", "zer" },
+    { "zuzims", "zuzim" },
+};
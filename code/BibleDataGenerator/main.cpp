@@ -2,11 +2,20 @@
 #include <filesystem>
 #include "BibleData/BibleDataCodeFiles.h"
 #include "Debugging/Timer.h"
+#include "RootWordEntries.h"
 
 int main()
 {
-    // GENERATE CODE FILES FOR KJV DATA.
+    // GENERATE CODE FILES FOR THE ROOT WORD MAP.
+    // This doesn't depend on any translation, so it's generated first.
     std::filesystem::path output_directory_path = "../../code/BibleLibrary/BibleData/";
+    bool root_word_map_generated = BIBLE_DATA::BibleDataCodeFiles::GenerateRootWordMap(ROOT_WORD_ENTRIES, output_directory_path);
+    if (!root_word_map_generated)
+    {
+        return EXIT_FAILURE;
+    }
+
+    // GENERATE CODE FILES FOR KJV DATA.
     {
         DEBUGGING::SystemClockTimer system_clock_timer("KJV System Clock Timer");
         DEBUGGING::HighResolutionTimer high_resolution_timer("KJV High-Resolution Timer");
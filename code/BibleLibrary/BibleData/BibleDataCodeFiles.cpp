@@ -1,8 +1,17 @@
 #include <algorithm>
+#include <cstdio>
+#include <optional>
 #include <fstream>
+#include <string_view>
+#include <vector>
 #include <pugixml/pugixml.hpp>
 #include "BibleData/BibleBook.h"
 #include "BibleData/BibleDataCodeFiles.h"
+#include "BibleData/BibleSuffixArray.h"
+#include "BibleData/BibleTranslation.h"
+#include "BibleData/BibleVerseIdWithCharacterRange.h"
+#include "BibleData/BibleWordIndex.h"
+#include "BibleData/PerfectHashStringMap.h"
 
 namespace BIBLE_DATA
 {
@@ -82,6 +91,9 @@ namespace BIBLE_DATA
             << "{\n";
 
         // PARSE VERSES FROM EACH BOOK IN THE INPUT FILE.
+        // The full text and verse ranges are also accumulated in memory so that a word index can be built from them.
+        std::string full_text;
+        std::vector<BibleVerseIdWithCharacterRange> verse_character_ranges;
         std::size_t current_verse_start_offset = 0;
         pugi::xml_node osis_text_xml_node = osis_xml_document.select_node("/osis/osisText").node();
         // An assumption is being made that all direct child divs are for books, which is consistent with all files thus far.
@@ -161,6 +173,21 @@ namespace BIBLE_DATA
                     // The character ranges within the text also need to be written out.
                     output_verse_ranges_cpp_file << "BIBLE_DATA::BibleVerseIdWithCharacterRange { BIBLE_DATA::BibleVerseId { static_cast<BIBLE_DATA::BibleBook::Id>(" << book_id << "), " << chapter_number << ", " << verse_number << " }, " << current_verse_start_offset << ", " << verse_end_offset << "}," << "\n";
 
+                    // TRACK THE VERSE FOR BUILDING THE WORD INDEX.
+                    full_text += verse_text;
+                    BibleVerseIdWithCharacterRange verse_id_with_character_range =
+                    {
+                        .Id = BibleVerseId
+                        {
+                            .Book = book_id,
+                            .ChapterNumber = chapter_number,
+                            .VerseNumber = verse_number,
+                        },
+                        .FirstCharacterOffsetIntoFullBibleText = current_verse_start_offset,
+                        .LastCharacterOffsetIntoFullBibleText = verse_end_offset,
+                    };
+                    verse_character_ranges.push_back(verse_id_with_character_range);
+
                     // The starting offset for each verse needs to be tracked.
                     current_verse_start_offset += verse_text_character_count;
                 }
@@ -170,5 +197,242 @@ namespace BIBLE_DATA
         // Double curly braces to end both the arrays and the namespaces.
         output_verse_text_cpp_file << "};\n}" << std::endl;
         output_verse_ranges_cpp_file << "};\n}" << std::endl;
+
+        // BUILD THE WORD INDEX FOR THE TRANSLATION.
+        // The same code used at runtime is used here to guarantee identical indexes.
+        // Token positions are included to support phrase searches.  Postings are left uncompressed so that
+        // the program can search them directly without decoding them at startup or during searches.
+        BibleTranslation bible_translation;
+        bible_translation.Text = full_text.c_str();
+        bible_translation.VerseCharacterRanges = verse_character_ranges;
+        BibleWordIndex word_index = BibleWordIndex::Build(&bible_translation, 1, true);
+
+        // WRITE OUT THE WORD INDEX HEADER FILE.
+        // Array sizes are included in the declarations so that users can wrap the arrays without separate size constants.
+        std::string word_index_code_file_base_name = "WordIndex_" + translation_name;
+        std::string word_index_header_filename = word_index_code_file_base_name + ".h";
+        std::filesystem::path word_index_header_filepath = std::filesystem::absolute(output_folder_path / word_index_header_filename);
+
+        std::string lexicon_characters_array_name = translation_name + "_WORD_INDEX_LEXICON_CHARACTERS";
+        std::string lexicon_word_offsets_array_name = translation_name + "_WORD_INDEX_LEXICON_WORD_OFFSETS";
+        std::string posting_verse_indices_array_name = translation_name + "_WORD_INDEX_POSTING_VERSE_INDICES";
+        std::string posting_offsets_array_name = translation_name + "_WORD_INDEX_POSTING_OFFSETS";
+        std::string posting_token_positions_array_name = translation_name + "_WORD_INDEX_POSTING_TOKEN_POSITIONS";
+        std::string verse_word_counts_array_name = translation_name + "_WORD_INDEX_VERSE_WORD_COUNTS";
+        std::string word_verse_counts_array_name = translation_name + "_WORD_INDEX_WORD_VERSE_COUNTS";
+        std::ofstream output_word_index_header_file(word_index_header_filepath);
+        output_word_index_header_file
+            << "#pragma once\n"
+            << "#include <cstdint>\n"
+            << "namespace BIBLE_DATA\n"
+            << "{\n"
+            << "extern const char " << lexicon_characters_array_name << "[" << word_index.LexiconCharacters.size() << "];\n"
+            << "extern const std::uint32_t " << lexicon_word_offsets_array_name << "[" << word_index.LexiconWordOffsets.size() << "];\n"
+            << "extern const std::uint16_t " << posting_verse_indices_array_name << "[" << word_index.PostingVerseIndices.size() << "];\n"
+            << "extern const std::uint32_t " << posting_offsets_array_name << "[" << word_index.PostingOffsets.size() << "];\n"
+            << "extern const std::uint16_t " << posting_token_positions_array_name << "[" << word_index.PostingTokenPositions.size() << "];\n"
+            << "extern const std::uint16_t " << verse_word_counts_array_name << "[" << word_index.VerseWordCounts.size() << "];\n"
+            << "extern const std::uint16_t " << word_verse_counts_array_name << "[" << word_index.WordVerseCounts.size() << "];\n"
+            << "}\n";
+
+        // WRITE OUT THE WORD INDEX CPP FILE.
+        std::string word_index_cpp_filename = word_index_code_file_base_name + ".cpp";
+        std::filesystem::path word_index_cpp_filepath = std::filesystem::absolute(output_folder_path / word_index_cpp_filename);
+        std::ofstream output_word_index_cpp_file(word_index_cpp_filepath);
+        output_word_index_cpp_file
+            << "#include \"BibleData/" << word_index_header_filename << "\"\n"
+            << "namespace BIBLE_DATA\n"
+            << "{\n";
+
+        // The lexicon only contains letters and digits, so characters don't need escaping.
+        // A new line is written after each word to make it easier to see when words start/end.
+        output_word_index_cpp_file << "const char " << lexicon_characters_array_name << "[] =\n{\n";
+        std::size_t word_count = word_index.WordCount();
+        for (std::size_t word_index_in_lexicon = 0; word_index_in_lexicon < word_count; ++word_index_in_lexicon)
+        {
+            std::string_view word = word_index.GetWord(word_index_in_lexicon);
+            for (const char character : word)
+            {
+                output_word_index_cpp_file << "'" << character << "',";
+            }
+            output_word_index_cpp_file << "\n";
+        }
+        output_word_index_cpp_file << "};\n";
+
+        output_word_index_cpp_file << "const std::uint32_t " << lexicon_word_offsets_array_name << "[] =\n{\n";
+        for (const std::uint32_t lexicon_word_offset : word_index.LexiconWordOffsets)
+        {
+            output_word_index_cpp_file << lexicon_word_offset << ",\n";
+        }
+        output_word_index_cpp_file << "};\n";
+
+        // Verse indices are written on a line per word to make it easier to see which verses go with which word.
+        output_word_index_cpp_file << "const std::uint16_t " << posting_verse_indices_array_name << "[] =\n{\n";
+        std::vector<BibleWordIndex::VerseIndex> no_decoded_verse_indices;
+        for (std::size_t word_index_in_lexicon = 0; word_index_in_lexicon < word_count; ++word_index_in_lexicon)
+        {
+            for (const BibleWordIndex::VerseIndex verse_index : word_index.GetVerseIndices(word_index_in_lexicon, no_decoded_verse_indices))
+            {
+                output_word_index_cpp_file << verse_index << ",";
+            }
+            output_word_index_cpp_file << "\n";
+        }
+        output_word_index_cpp_file << "};\n";
+
+        output_word_index_cpp_file << "const std::uint32_t " << posting_offsets_array_name << "[] =\n{\n";
+        for (const std::uint32_t posting_offset : word_index.PostingOffsets)
+        {
+            output_word_index_cpp_file << posting_offset << ",\n";
+        }
+        output_word_index_cpp_file << "};\n";
+
+        // Token positions are written on a line per word to line up with the verse indices above.
+        output_word_index_cpp_file << "const std::uint16_t " << posting_token_positions_array_name << "[] =\n{\n";
+        for (std::size_t word_index_in_lexicon = 0; word_index_in_lexicon < word_count; ++word_index_in_lexicon)
+        {
+            for (const BibleWordIndex::TokenPosition token_position : word_index.GetTokenPositions(word_index_in_lexicon))
+            {
+                output_word_index_cpp_file << token_position << ",";
+            }
+            output_word_index_cpp_file << "\n";
+        }
+        output_word_index_cpp_file << "};\n";
+
+        output_word_index_cpp_file << "const std::uint16_t " << verse_word_counts_array_name << "[] =\n{\n";
+        for (const std::uint16_t verse_word_count : word_index.VerseWordCounts)
+        {
+            output_word_index_cpp_file << verse_word_count << ",\n";
+        }
+        output_word_index_cpp_file << "};\n";
+
+        output_word_index_cpp_file << "const std::uint16_t " << word_verse_counts_array_name << "[] =\n{\n";
+        for (const std::uint16_t word_verse_count : word_index.WordVerseCounts)
+        {
+            output_word_index_cpp_file << word_verse_count << ",\n";
+        }
+        // Double curly braces to end both the array and the namespace.
+        output_word_index_cpp_file << "};\n}" << std::endl;
+
+        // BUILD THE SUFFIX ARRAY FOR THE TRANSLATION.
+        // Like the word index, the same code used at runtime is used here.
+        BibleSuffixArray suffix_array = BibleSuffixArray::Build(&bible_translation);
+
+        // WRITE OUT THE SUFFIX ARRAY HEADER FILE.
+        std::string suffix_array_code_file_base_name = "SuffixArray_" + translation_name;
+        std::string suffix_array_header_filename = suffix_array_code_file_base_name + ".h";
+        std::filesystem::path suffix_array_header_filepath = std::filesystem::absolute(output_folder_path / suffix_array_header_filename);
+
+        std::string suffix_offsets_array_name = translation_name + "_SUFFIX_ARRAY_SUFFIX_OFFSETS";
+        std::string longest_common_prefix_lengths_array_name = translation_name + "_SUFFIX_ARRAY_LONGEST_COMMON_PREFIX_LENGTHS";
+        std::ofstream output_suffix_array_header_file(suffix_array_header_filepath);
+        output_suffix_array_header_file
+            << "#pragma once\n"
+            << "#include <cstdint>\n"
+            << "namespace BIBLE_DATA\n"
+            << "{\n"
+            << "extern const std::uint32_t " << suffix_offsets_array_name << "[" << suffix_array.SuffixOffsets.size() << "];\n"
+            << "extern const std::uint32_t " << longest_common_prefix_lengths_array_name << "[" << suffix_array.LongestCommonPrefixLengths.size() << "];\n"
+            << "}\n";
+
+        // WRITE OUT THE SUFFIX ARRAY CPP FILE.
+        std::string suffix_array_cpp_filename = suffix_array_code_file_base_name + ".cpp";
+        std::filesystem::path suffix_array_cpp_filepath = std::filesystem::absolute(output_folder_path / suffix_array_cpp_filename);
+        std::ofstream output_suffix_array_cpp_file(suffix_array_cpp_filepath);
+        output_suffix_array_cpp_file
+            << "#include \"BibleData/" << suffix_array_header_filename << "\"\n"
+            << "namespace BIBLE_DATA\n"
+            << "{\n";
+
+        output_suffix_array_cpp_file << "const std::uint32_t " << suffix_offsets_array_name << "[] =\n{\n";
+        for (const std::uint32_t suffix_offset : suffix_array.SuffixOffsets)
+        {
+            output_suffix_array_cpp_file << suffix_offset << ",\n";
+        }
+        output_suffix_array_cpp_file << "};\n";
+
+        output_suffix_array_cpp_file << "const std::uint32_t " << longest_common_prefix_lengths_array_name << "[] =\n{\n";
+        for (const std::uint32_t longest_common_prefix_length : suffix_array.LongestCommonPrefixLengths)
+        {
+            output_suffix_array_cpp_file << longest_common_prefix_length << ",\n";
+        }
+        // Double curly braces to end both the array and the namespace.
+        output_suffix_array_cpp_file << "};\n}" << std::endl;
+    }
+
+    /// Generates code files for the root word map (see BibleWordIndex::RootWordsByOriginalWord).
+    /// Finding the perfect hash for the map takes too long to do at compile time, so it's done here,
+    /// and the code files contain the fully built map.
+    /// @param[in]  root_word_entries - The root words mapped by original word.  Original words must be distinct.
+    /// @param[in]  output_folder_path - The path for the output folder in which to write the generated code files.
+    /// @return True if the code files were generated; false if the map couldn't be built.
+    bool BibleDataCodeFiles::GenerateRootWordMap(
+        const std::span<const PerfectHashStringMap::Entry> root_word_entries,
+        const std::filesystem::path output_folder_path)
+    {
+        // BUILD THE MAP.
+        std::optional<PerfectHashStringMap::BuiltData> root_word_map = PerfectHashStringMap::Build(root_word_entries);
+        if (!root_word_map)
+        {
+            std::fprintf(stderr, "Failed to build root word map: root words must have distinct original words.\n");
+            return false;
+        }
+
+        // WRITE OUT THE HEADER FILE.
+        // Array sizes are included in the declarations so that the map can wrap the arrays without separate size constants.
+        std::string root_word_map_code_file_base_name = "RootWordMap";
+        std::string root_word_map_header_filename = root_word_map_code_file_base_name + ".h";
+        std::filesystem::path root_word_map_header_filepath = std::filesystem::absolute(output_folder_path / root_word_map_header_filename);
+
+        const std::string ENTRIES_ARRAY_NAME = "ROOT_WORD_MAP_ENTRIES";
+        const std::string SEEDS_BY_BUCKET_ARRAY_NAME = "ROOT_WORD_MAP_SEEDS_BY_BUCKET";
+        const std::string ENTRY_INDICES_BY_SLOT_ARRAY_NAME = "ROOT_WORD_MAP_ENTRY_INDICES_BY_SLOT";
+        std::ofstream output_root_word_map_header_file(root_word_map_header_filepath);
+        output_root_word_map_header_file
+            << "#pragma once\n"
+            << "#include <cstdint>\n"
+            << "#include \"BibleData/PerfectHashStringMap.h\"\n"
+            << "namespace BIBLE_DATA\n"
+            << "{\n"
+            << "extern const PerfectHashStringMap::Entry " << ENTRIES_ARRAY_NAME << "[" << root_word_map->Entries.size() << "];\n"
+            << "extern const std::uint32_t " << SEEDS_BY_BUCKET_ARRAY_NAME << "[" << root_word_map->SeedsByBucket.size() << "];\n"
+            << "extern const std::uint16_t " << ENTRY_INDICES_BY_SLOT_ARRAY_NAME << "[" << root_word_map->EntryIndicesBySlot.size() << "];\n"
+            << "}\n";
+
+        // WRITE OUT THE CPP FILE.
+        std::string root_word_map_cpp_filename = root_word_map_code_file_base_name + ".cpp";
+        std::filesystem::path root_word_map_cpp_filepath = std::filesystem::absolute(output_folder_path / root_word_map_cpp_filename);
+        std::ofstream output_root_word_map_cpp_file(root_word_map_cpp_filepath);
+        output_root_word_map_cpp_file
+            << "#include \"BibleData/" << root_word_map_header_filename << "\"\n"
+            << "namespace BIBLE_DATA\n"
+            << "{\n";
+
+        // Words only contain letters, so they don't need escaping.
+        // Lengths are written explicitly so that the entries are trivially constant-initialized.
+        output_root_word_map_cpp_file << "const PerfectHashStringMap::Entry " << ENTRIES_ARRAY_NAME << "[] =\n{\n";
+        for (const PerfectHashStringMap::Entry& entry : root_word_map->Entries)
+        {
+            output_root_word_map_cpp_file
+                << "{ std::string_view(\"" << entry.Key << "\", " << entry.Key.size() << "), "
+                << "std::string_view(\"" << entry.Value << "\", " << entry.Value.size() << ") },\n";
+        }
+        output_root_word_map_cpp_file << "};\n";
+
+        output_root_word_map_cpp_file << "const std::uint32_t " << SEEDS_BY_BUCKET_ARRAY_NAME << "[] =\n{\n";
+        for (const std::uint32_t seed : root_word_map->SeedsByBucket)
+        {
+            output_root_word_map_cpp_file << seed << ",\n";
+        }
+        output_root_word_map_cpp_file << "};\n";
+
+        output_root_word_map_cpp_file << "const std::uint16_t " << ENTRY_INDICES_BY_SLOT_ARRAY_NAME << "[] =\n{\n";
+        for (const std::uint16_t entry_index : root_word_map->EntryIndicesBySlot)
+        {
+            output_root_word_map_cpp_file << entry_index << ",\n";
+        }
+        // Double curly braces to end both the array and the namespace.
+        output_root_word_map_cpp_file << "};\n}" << std::endl;
+
+        return true;
     }
 }
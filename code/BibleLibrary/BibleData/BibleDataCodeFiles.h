@@ -1,7 +1,9 @@
 #pragma once
 
 #include <filesystem>
+#include <span>
 #include <string>
+#include "BibleData/PerfectHashStringMap.h"
 
 namespace BIBLE_DATA
 {
@@ -15,5 +17,8 @@ namespace BIBLE_DATA
             const std::string& translation_name,
             const std::filesystem::path input_osis_xml_filepath,
             const std::filesystem::path output_folder_path);
+        static bool GenerateRootWordMap(
+            const std::span<const PerfectHashStringMap::Entry> root_word_entries,
+            const std::filesystem::path output_folder_path);
     };
 }
@@ -0,0 +1,432 @@
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <string>
+#include "BibleData/BibleSuffixArray.h"
+#include "BibleData/BibleTranslation.h"
+
+namespace BIBLE_DATA
+{
+    /// Gets the lowercase form of a character for case-insensitive ordering of suffixes.
+    /// @param[in]  character - The character to lowercase.
+    /// @return The lowercase character as an unsigned value (so that non-ASCII characters sort after ASCII ones).
+    static unsigned char ToLowercase(const char character)
+    {
+        unsigned char lowercase_character = static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(character)));
+        return lowercase_character;
+    }
+
+    /// Builds a suffix array for a translation.
+    /// Suffixes are sorted in linear time using the SA-IS (induced sorting) algorithm,
+    /// and longest common prefixes are computed in linear time using Kasai's algorithm.
+    /// @param[in]  bible_translation - The translation for which to build the suffix array.
+    /// @return The suffix array for the translation.
+    BibleSuffixArray BibleSuffixArray::Build(const BibleTranslation* bible_translation)
+    {
+        // GET THE LOWERCASE CHARACTERS OF THE TEXT.
+        BibleSuffixArray suffix_array;
+        suffix_array.Bible = bible_translation;
+        std::size_t text_length = suffix_array.TextLength();
+        std::vector<std::int32_t> lowercase_characters(text_length);
+        for (std::size_t text_offset = 0; text_offset < text_length; ++text_offset)
+        {
+            lowercase_characters[text_offset] = ToLowercase(bible_translation->Text[text_offset]);
+        }
+
+        // SORT ALL SUFFIXES OF THE TEXT.
+        constexpr std::int32_t MAX_CHARACTER = 255;
+        std::vector<std::int32_t> sorted_suffix_offsets = SortSuffixes(lowercase_characters, MAX_CHARACTER);
+
+        auto built_data = std::make_shared<BuiltData>();
+        built_data->SuffixOffsets.assign(sorted_suffix_offsets.cbegin(), sorted_suffix_offsets.cend());
+
+        // COMPUTE THE LONGEST COMMON PREFIX OF EACH SUFFIX WITH THE PREVIOUS ONE.
+        // Suffixes are visited in text order since the common prefix for the suffix at offset N + 1
+        // is at most one shorter than for the suffix at offset N, so little text needs to be compared.
+        std::vector<std::uint32_t> sorted_indices_by_suffix_offset(text_length);
+        for (std::size_t sorted_index = 0; sorted_index < text_length; ++sorted_index)
+        {
+            sorted_indices_by_suffix_offset[sorted_suffix_offsets[sorted_index]] = static_cast<std::uint32_t>(sorted_index);
+        }
+        built_data->LongestCommonPrefixLengths.resize(text_length);
+        std::size_t common_prefix_length = 0;
+        for (std::size_t suffix_offset = 0; suffix_offset < text_length; ++suffix_offset)
+        {
+            // The first sorted suffix has no previous suffix.
+            std::size_t sorted_index = sorted_indices_by_suffix_offset[suffix_offset];
+            if (0 == sorted_index)
+            {
+                common_prefix_length = 0;
+                continue;
+            }
+
+            std::size_t previous_suffix_offset = built_data->SuffixOffsets[sorted_index - 1];
+            while ((suffix_offset + common_prefix_length < text_length) &&
+                (previous_suffix_offset + common_prefix_length < text_length) &&
+                (lowercase_characters[suffix_offset + common_prefix_length] == lowercase_characters[previous_suffix_offset + common_prefix_length]))
+            {
+                ++common_prefix_length;
+            }
+            built_data->LongestCommonPrefixLengths[sorted_index] = static_cast<std::uint32_t>(common_prefix_length);
+
+            if (common_prefix_length > 0)
+            {
+                --common_prefix_length;
+            }
+        }
+
+        // RETURN THE POPULATED SUFFIX ARRAY.
+        suffix_array.SuffixOffsets = built_data->SuffixOffsets;
+        suffix_array.LongestCommonPrefixLengths = built_data->LongestCommonPrefixLengths;
+        suffix_array.OwnedData = built_data;
+        return suffix_array;
+    }
+
+    /// Creates a suffix array that wraps already computed data without copying it.
+    /// This is primarily intended for data precomputed into generated code files (see BibleDataCodeFiles),
+    /// so that no work is needed at runtime to have a suffix array.
+    /// @param[in]  bible_translation - The translation the suffix array is for.
+    /// @param[in]  suffix_offsets - See SuffixOffsets.  Must remain valid for the lifetime of the suffix array.
+    /// @param[in]  longest_common_prefix_lengths - See LongestCommonPrefixLengths.  Must remain valid for the lifetime of the suffix array.
+    /// @return The suffix array wrapping the data.
+    BibleSuffixArray BibleSuffixArray::FromPrecomputedData(
+        const BibleTranslation* bible_translation,
+        const std::span<const std::uint32_t> suffix_offsets,
+        const std::span<const std::uint32_t> longest_common_prefix_lengths)
+    {
+        assert(suffix_offsets.size() == longest_common_prefix_lengths.size());
+
+        BibleSuffixArray suffix_array;
+        suffix_array.Bible = bible_translation;
+        suffix_array.SuffixOffsets = suffix_offsets;
+        suffix_array.LongestCommonPrefixLengths = longest_common_prefix_lengths;
+        return suffix_array;
+    }
+
+    /// Finds all occurrences of a substring (ignoring case) within verses.
+    /// The sorted suffixes are binary searched for the first one starting with the substring,
+    /// and the longest common prefix lengths then give all other matching suffixes without comparing text.
+    /// Occurrences spanning multiple verses are not included.
+    /// @param[in]  substring - The substring to find.
+    /// @return The verses containing the substring, in canonical verse order.
+    std::vector<BibleVersePhraseMatch> BibleSuffixArray::FindSubstring(const std::string_view substring) const
+    {
+        // CHECK IF THERE'S ANYTHING TO SEARCH FOR.
+        if (substring.empty())
+        {
+            return {};
+        }
+
+        // LOWERCASE THE SUBSTRING TO MATCH HOW SUFFIXES ARE SORTED.
+        std::string lowercase_substring(substring);
+        std::transform(
+            lowercase_substring.begin(),
+            lowercase_substring.end(),
+            lowercase_substring.begin(),
+            [](const char character) { return static_cast<char>(ToLowercase(character)); });
+
+        // FIND THE FIRST SUFFIX THAT STARTS WITH THE SUBSTRING.
+        auto first_matching_suffix_offset = std::partition_point(
+            SuffixOffsets.begin(),
+            SuffixOffsets.end(),
+            [&](const std::uint32_t suffix_offset) { return CompareSuffixToLowercaseSubstring(suffix_offset, lowercase_substring) < 0; });
+        bool substring_found = (
+            (SuffixOffsets.end() != first_matching_suffix_offset) &&
+            (0 == CompareSuffixToLowercaseSubstring(*first_matching_suffix_offset, lowercase_substring)));
+        if (!substring_found)
+        {
+            return {};
+        }
+
+        // FIND ALL OTHER SUFFIXES THAT START WITH THE SUBSTRING.
+        // Subsequent suffixes also start with the substring as long as they share at least that many characters with the previous suffix.
+        std::size_t first_matching_sorted_index = static_cast<std::size_t>(first_matching_suffix_offset - SuffixOffsets.begin());
+        std::size_t end_matching_sorted_index = first_matching_sorted_index + 1;
+        while ((end_matching_sorted_index < SuffixOffsets.size()) &&
+            (LongestCommonPrefixLengths[end_matching_sorted_index] >= lowercase_substring.size()))
+        {
+            ++end_matching_sorted_index;
+        }
+
+        // PUT THE OCCURRENCES IN TEXT ORDER.
+        std::vector<std::uint32_t> occurrence_text_offsets(
+            SuffixOffsets.begin() + first_matching_sorted_index,
+            SuffixOffsets.begin() + end_matching_sorted_index);
+        std::sort(occurrence_text_offsets.begin(), occurrence_text_offsets.end());
+
+        // GROUP THE OCCURRENCES BY VERSE.
+        std::vector<BibleVersePhraseMatch> matching_verses;
+        auto current_verse_character_range = Bible->VerseCharacterRanges.cbegin();
+        for (const std::uint32_t occurrence_text_offset : occurrence_text_offsets)
+        {
+            // FIND THE VERSE CONTAINING THE OCCURRENCE.
+            // Occurrences are in text order, so only verses after the previous occurrence's verse need to be searched.
+            current_verse_character_range = std::upper_bound(
+                current_verse_character_range,
+                Bible->VerseCharacterRanges.cend(),
+                occurrence_text_offset,
+                [](const std::size_t text_offset, const BibleVerseIdWithCharacterRange& verse_character_range)
+                {
+                    return text_offset < verse_character_range.FirstCharacterOffsetIntoFullBibleText;
+                });
+            --current_verse_character_range;
+
+            // SKIP THE OCCURRENCE IF IT CONTINUES INTO THE NEXT VERSE.
+            std::size_t occurrence_end_text_offset = occurrence_text_offset + lowercase_substring.size();
+            bool occurrence_within_verse = (occurrence_end_text_offset <= current_verse_character_range->LastCharacterOffsetIntoFullBibleText);
+            if (!occurrence_within_verse)
+            {
+                continue;
+            }
+
+            // ADD THE VERSE IF IT HASN'T BEEN ADDED YET.
+            std::size_t verse_index = static_cast<std::size_t>(current_verse_character_range - Bible->VerseCharacterRanges.cbegin());
+            BibleVerse verse = Bible->GetVerse(verse_index);
+            bool verse_already_added = !matching_verses.empty() && (matching_verses.back().Verse.Id == verse.Id);
+            if (!verse_already_added)
+            {
+                matching_verses.push_back(BibleVersePhraseMatch{ .Verse = verse });
+            }
+
+            // ADD THE OCCURRENCE TO THE VERSE.
+            std::size_t verse_start_text_offset = current_verse_character_range->FirstCharacterOffsetIntoFullBibleText;
+            matching_verses.back().MatchCharacterRanges.push_back(BibleVersePhraseMatch::CharacterRange
+            {
+                .FirstCharacterOffsetIntoVerseText = occurrence_text_offset - verse_start_text_offset,
+                .LastCharacterOffsetIntoVerseText = occurrence_end_text_offset - verse_start_text_offset,
+            });
+        }
+
+        return matching_verses;
+    }
+
+    /// Sorts all suffixes of a string using the SA-IS (suffix array by induced sorting) algorithm.
+    /// Suffixes are classified as S-type (smaller than the next suffix) or L-type (larger).
+    /// Sorting just the leftmost S-type (LMS) suffixes is enough to sort all others by "inducing"
+    /// their order in two linear scans.  The LMS suffixes themselves are sorted by recursively
+    /// sorting a reduced string at most half the length, so the total time is linear.
+    /// @param[in]  characters - The characters of the string, each in the range [0, max_character].
+    /// @param[in]  max_character - The maximum value of any character.
+    /// @return The starting offsets of all suffixes, in sorted order.
+    std::vector<std::int32_t> BibleSuffixArray::SortSuffixes(const std::span<const std::int32_t> characters, const std::int32_t max_character)
+    {
+        // SORT VERY SHORT STRINGS DIRECTLY.
+        // This handles the base cases of the recursion without any special cases below.
+        const std::int32_t character_count = static_cast<std::int32_t>(characters.size());
+        constexpr std::int32_t MAX_DIRECTLY_SORTED_CHARACTER_COUNT = 8;
+        if (character_count <= MAX_DIRECTLY_SORTED_CHARACTER_COUNT)
+        {
+            std::vector<std::int32_t> sorted_suffix_offsets(character_count);
+            for (std::int32_t suffix_offset = 0; suffix_offset < character_count; ++suffix_offset)
+            {
+                sorted_suffix_offsets[suffix_offset] = suffix_offset;
+            }
+            std::sort(
+                sorted_suffix_offsets.begin(),
+                sorted_suffix_offsets.end(),
+                [&](const std::int32_t left_suffix_offset, const std::int32_t right_suffix_offset)
+                {
+                    return std::lexicographical_compare(
+                        characters.begin() + left_suffix_offset,
+                        characters.end(),
+                        characters.begin() + right_suffix_offset,
+                        characters.end());
+                });
+            return sorted_suffix_offsets;
+        }
+
+        // CLASSIFY EACH SUFFIX AS S-TYPE OR L-TYPE.
+        // The last suffix is L-type since it's larger than the empty suffix after it.
+        std::vector<bool> suffix_is_s_type(character_count);
+        for (std::int32_t suffix_offset = character_count - 2; suffix_offset >= 0; --suffix_offset)
+        {
+            bool same_character_as_next_suffix = (characters[suffix_offset] == characters[suffix_offset + 1]);
+            suffix_is_s_type[suffix_offset] = same_character_as_next_suffix ?
+                suffix_is_s_type[suffix_offset + 1] :
+                (characters[suffix_offset] < characters[suffix_offset + 1]);
+        }
+
+        // DETERMINE WHERE THE BUCKETS FOR EACH CHARACTER START.
+        // Within a bucket for a character, L-type suffixes come before S-type suffixes.
+        std::vector<std::int32_t> l_type_bucket_starts(max_character + 2);
+        std::vector<std::int32_t> s_type_bucket_starts(max_character + 2);
+        for (std::int32_t suffix_offset = 0; suffix_offset < character_count; ++suffix_offset)
+        {
+            if (suffix_is_s_type[suffix_offset])
+            {
+                ++l_type_bucket_starts[characters[suffix_offset] + 1];
+            }
+            else
+            {
+                ++s_type_bucket_starts[characters[suffix_offset]];
+            }
+        }
+        for (std::int32_t character = 0; character <= max_character; ++character)
+        {
+            s_type_bucket_starts[character] += l_type_bucket_starts[character];
+            l_type_bucket_starts[character + 1] += s_type_bucket_starts[character];
+        }
+
+        // DEFINE HOW TO INDUCE THE ORDER OF ALL SUFFIXES FROM SORTED LMS SUFFIXES.
+        constexpr std::int32_t NO_SUFFIX = -1;
+        std::vector<std::int32_t> sorted_suffix_offsets(character_count);
+        std::vector<std::int32_t> next_bucket_positions(max_character + 2);
+        auto induce_sort = [&](const std::vector<std::int32_t>& lms_suffix_offsets)
+        {
+            // PLACE THE LMS SUFFIXES AT THE START OF THEIR S-TYPE BUCKETS.
+            std::fill(sorted_suffix_offsets.begin(), sorted_suffix_offsets.end(), NO_SUFFIX);
+            std::copy(s_type_bucket_starts.cbegin(), s_type_bucket_starts.cend(), next_bucket_positions.begin());
+            for (const std::int32_t lms_suffix_offset : lms_suffix_offsets)
+            {
+                sorted_suffix_offsets[next_bucket_positions[characters[lms_suffix_offset]]++] = lms_suffix_offset;
+            }
+
+            // INDUCE THE ORDER OF L-TYPE SUFFIXES FROM LEFT TO RIGHT.
+            // The last suffix is L-type and is the first suffix in its bucket since nothing follows it.
+            std::copy(l_type_bucket_starts.cbegin(), l_type_bucket_starts.cend(), next_bucket_positions.begin());
+            sorted_suffix_offsets[next_bucket_positions[characters[character_count - 1]]++] = character_count - 1;
+            for (std::int32_t sorted_index = 0; sorted_index < character_count; ++sorted_index)
+            {
+                std::int32_t suffix_offset = sorted_suffix_offsets[sorted_index];
+                bool previous_suffix_is_l_type = (suffix_offset >= 1) && !suffix_is_s_type[suffix_offset - 1];
+                if (previous_suffix_is_l_type)
+                {
+                    sorted_suffix_offsets[next_bucket_positions[characters[suffix_offset - 1]]++] = suffix_offset - 1;
+                }
+            }
+
+            // INDUCE THE ORDER OF S-TYPE SUFFIXES FROM RIGHT TO LEFT.
+            std::copy(l_type_bucket_starts.cbegin(), l_type_bucket_starts.cend(), next_bucket_positions.begin());
+            for (std::int32_t sorted_index = character_count - 1; sorted_index >= 0; --sorted_index)
+            {
+                std::int32_t suffix_offset = sorted_suffix_offsets[sorted_index];
+                bool previous_suffix_is_s_type = (suffix_offset >= 1) && suffix_is_s_type[suffix_offset - 1];
+                if (previous_suffix_is_s_type)
+                {
+                    sorted_suffix_offsets[--next_bucket_positions[characters[suffix_offset - 1] + 1]] = suffix_offset - 1;
+                }
+            }
+        };
+
+        // FIND ALL LMS SUFFIXES.
+        // These are S-type suffixes immediately after L-type suffixes.
+        std::vector<std::int32_t> lms_numbers_by_suffix_offset(character_count + 1, NO_SUFFIX);
+        std::vector<std::int32_t> lms_suffix_offsets;
+        for (std::int32_t suffix_offset = 1; suffix_offset < character_count; ++suffix_offset)
+        {
+            bool is_lms_suffix = !suffix_is_s_type[suffix_offset - 1] && suffix_is_s_type[suffix_offset];
+            if (is_lms_suffix)
+            {
+                lms_numbers_by_suffix_offset[suffix_offset] = static_cast<std::int32_t>(lms_suffix_offsets.size());
+                lms_suffix_offsets.push_back(suffix_offset);
+            }
+        }
+
+        // INDUCE AN ORDER THAT CORRECTLY SORTS LMS SUBSTRINGS (BUT NOT YET FULL LMS SUFFIXES).
+        induce_sort(lms_suffix_offsets);
+        if (lms_suffix_offsets.empty())
+        {
+            return sorted_suffix_offsets;
+        }
+
+        // NAME EACH LMS SUBSTRING BY ITS RANK AMONG DISTINCT LMS SUBSTRINGS.
+        // LMS substrings run from one LMS suffix to the next (or the end of the string).
+        const std::int32_t lms_suffix_count = static_cast<std::int32_t>(lms_suffix_offsets.size());
+        std::vector<std::int32_t> sorted_lms_suffix_offsets;
+        sorted_lms_suffix_offsets.reserve(lms_suffix_count);
+        for (const std::int32_t suffix_offset : sorted_suffix_offsets)
+        {
+            if (NO_SUFFIX != lms_numbers_by_suffix_offset[suffix_offset])
+            {
+                sorted_lms_suffix_offsets.push_back(suffix_offset);
+            }
+        }
+        std::vector<std::int32_t> reduced_characters(lms_suffix_count);
+        std::int32_t max_reduced_character = 0;
+        reduced_characters[lms_numbers_by_suffix_offset[sorted_lms_suffix_offsets[0]]] = 0;
+        for (std::int32_t sorted_lms_index = 1; sorted_lms_index < lms_suffix_count; ++sorted_lms_index)
+        {
+            // DETERMINE WHERE THE PREVIOUS AND CURRENT LMS SUBSTRINGS END.
+            std::int32_t previous_offset = sorted_lms_suffix_offsets[sorted_lms_index - 1];
+            std::int32_t current_offset = sorted_lms_suffix_offsets[sorted_lms_index];
+            std::int32_t previous_lms_number = lms_numbers_by_suffix_offset[previous_offset];
+            std::int32_t current_lms_number = lms_numbers_by_suffix_offset[current_offset];
+            std::int32_t previous_end_offset = (previous_lms_number + 1 < lms_suffix_count) ? lms_suffix_offsets[previous_lms_number + 1] : character_count;
+            std::int32_t current_end_offset = (current_lms_number + 1 < lms_suffix_count) ? lms_suffix_offsets[current_lms_number + 1] : character_count;
+
+            // CHECK IF THE LMS SUBSTRINGS ARE IDENTICAL.
+            // Substrings reaching the end of the string are never identical to others since the end is unique.
+            bool identical_lms_substrings = false;
+            if ((previous_end_offset - previous_offset) == (current_end_offset - current_offset))
+            {
+                while ((previous_offset < previous_end_offset) && (characters[previous_offset] == characters[current_offset]))
+                {
+                    ++previous_offset;
+                    ++current_offset;
+                }
+                identical_lms_substrings = (
+                    (previous_offset != character_count) &&
+                    (current_offset != character_count) &&
+                    (characters[previous_offset] == characters[current_offset]));
+            }
+
+            if (!identical_lms_substrings)
+            {
+                ++max_reduced_character;
+            }
+            reduced_characters[current_lms_number] = max_reduced_character;
+        }
+
+        // SORT THE LMS SUFFIXES BY RECURSIVELY SORTING THE REDUCED STRING.
+        std::vector<std::int32_t> sorted_reduced_suffix_offsets = SortSuffixes(reduced_characters, max_reduced_character);
+        for (std::int32_t sorted_lms_index = 0; sorted_lms_index < lms_suffix_count; ++sorted_lms_index)
+        {
+            sorted_lms_suffix_offsets[sorted_lms_index] = lms_suffix_offsets[sorted_reduced_suffix_offsets[sorted_lms_index]];
+        }
+
+        // INDUCE THE ORDER OF ALL SUFFIXES FROM THE CORRECTLY SORTED LMS SUFFIXES.
+        induce_sort(sorted_lms_suffix_offsets);
+        return sorted_suffix_offsets;
+    }
+
+    /// Compares the start of a suffix of the text (ignoring case) to a substring.
+    /// @param[in]  text_offset - The offset into the text of the suffix.
+    /// @param[in]  lowercase_substring - The already lowercased substring.
+    /// @return Negative if the suffix is less than the substring, 0 if the suffix starts with the substring,
+    ///     or positive if the suffix is greater than the substring.
+    int BibleSuffixArray::CompareSuffixToLowercaseSubstring(const std::size_t text_offset, const std::string_view lowercase_substring) const
+    {
+        std::size_t text_length = TextLength();
+        for (std::size_t substring_offset = 0; substring_offset < lowercase_substring.size(); ++substring_offset)
+        {
+            // A suffix that ends before the substring does is less than it.
+            std::size_t current_text_offset = text_offset + substring_offset;
+            if (current_text_offset >= text_length)
+            {
+                return -1;
+            }
+
+            unsigned char suffix_character = ToLowercase(Bible->Text[current_text_offset]);
+            unsigned char substring_character = static_cast<unsigned char>(lowercase_substring[substring_offset]);
+            if (suffix_character != substring_character)
+            {
+                return (suffix_character < substring_character) ? -1 : 1;
+            }
+        }
+
+        return 0;
+    }
+
+    /// Gets the length of the translation's text.
+    /// @return The number of characters in the text.
+    std::size_t BibleSuffixArray::TextLength() const
+    {
+        if (Bible->VerseCharacterRanges.empty())
+        {
+            return 0;
+        }
+
+        std::size_t text_length = Bible->VerseCharacterRanges.back().LastCharacterOffsetIntoFullBibleText;
+        return text_length;
+    }
+}
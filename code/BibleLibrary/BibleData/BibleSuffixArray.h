@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+#include "BibleData/BibleVersePhraseMatch.h"
+
+namespace BIBLE_DATA
+{
+    /// @todo   Get rid of forward declaration?
+    class BibleTranslation;
+
+    /// A suffix array over the full text of a Bible translation for finding arbitrary substrings,
+    /// including partial words and text spanning multiple words (such as "eth unto").
+    ///
+    /// The array holds the offset of every suffix of BibleTranslation::Text, sorted so that all suffixes
+    /// starting with any given substring are contiguous.  Suffixes are ordered ignoring case, so searches
+    /// are case-insensitive.  A parallel LCP (longest common prefix) array holds the length of the prefix
+    /// shared by each suffix and the one before it, which allows finding where a range of matches ends
+    /// without comparing text again.
+    ///
+    /// Like the word index, the array only views its data, so it can either wrap arrays precomputed
+    /// into generated code files or data built at runtime.
+    class BibleSuffixArray
+    {
+    public:
+        /// Storage for suffix array data built at runtime.
+        /// It is shared so that copies of a suffix array remain valid without copying the data.
+        struct BuiltData
+        {
+            /// See BibleSuffixArray::SuffixOffsets.
+            std::vector<std::uint32_t> SuffixOffsets = {};
+            /// See BibleSuffixArray::LongestCommonPrefixLengths.
+            std::vector<std::uint32_t> LongestCommonPrefixLengths = {};
+        };
+
+        static BibleSuffixArray Build(const BibleTranslation* bible_translation);
+        static BibleSuffixArray FromPrecomputedData(
+            const BibleTranslation* bible_translation,
+            const std::span<const std::uint32_t> suffix_offsets,
+            const std::span<const std::uint32_t> longest_common_prefix_lengths);
+
+        std::vector<BibleVersePhraseMatch> FindSubstring(const std::string_view substring) const;
+
+        /// The Bible translation this suffix array corresponds to.
+        const BibleTranslation* Bible = nullptr;
+        /// The data for the suffix array if built at runtime; null if the suffix array wraps precomputed data.
+        std::shared_ptr<const BuiltData> OwnedData = nullptr;
+        /// Offsets into BibleTranslation::Text for every suffix of the text, in case-insensitive sorted order.
+        std::span<const std::uint32_t> SuffixOffsets = {};
+        /// The length of the longest common prefix (ignoring case) between each suffix in SuffixOffsets
+        /// and the suffix before it.  The first length is always 0.
+        std::span<const std::uint32_t> LongestCommonPrefixLengths = {};
+
+    private:
+        static std::vector<std::int32_t> SortSuffixes(const std::span<const std::int32_t> characters, const std::int32_t max_character);
+        int CompareSuffixToLowercaseSubstring(const std::size_t text_offset, const std::string_view lowercase_substring) const;
+        std::size_t TextLength() const;
+    };
+}
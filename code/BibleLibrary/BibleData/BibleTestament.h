@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BibleData/BibleBook.h"
 #include "BibleData/BibleVerseId.h"
 
 namespace BIBLE_DATA
@@ -21,5 +22,27 @@ namespace BIBLE_DATA
 
         // METHODS.
         static BibleTestament::Id Get(const BibleVerseId& verse_id);
+
+        /// Gets the testament for all verses in a book.
+        /// This is constexpr so that it can be used to precompute lookup tables.
+        /// @param[in]  book - The book for which to get the testament.
+        /// @return The testament for the book.
+        static constexpr BibleTestament::Id GetForBook(const BibleBook::Id book)
+        {
+            bool is_old = ((BibleBook::GENESIS <= book) && (book <= BibleBook::MALACHI));
+            bool is_new = ((BibleBook::MATTHEW <= book) && (book <= BibleBook::REVELATION));
+            if (is_old)
+            {
+                return BibleTestament::OLD;
+            }
+            else if (is_new)
+            {
+                return BibleTestament::NEW;
+            }
+            else
+            {
+                return BibleTestament::INVALID;
+            }
+        }
     };
 }
@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <regex>
+#include <thread>
+#include <utility>
+#include "BibleData/BibleTranslation.h"
+
+namespace BIBLE_DATA
+{
+    /// Gets the verse at the specified index within the translation.
+    /// @param[in]  verse_index - The index of the verse within VerseCharacterRanges.
+    /// @return The verse at the specified index.
+    BibleVerse BibleTranslation::GetVerse(const std::size_t verse_index) const
+    {
+        // GET THE CHARACTER RANGE FOR THE VERSE.
+        const BibleVerseIdWithCharacterRange& verse_id_with_character_range = VerseCharacterRanges[verse_index];
+
+        // GET THE VERSE TEXT.
+        const char* first_character_in_verse = Text + verse_id_with_character_range.FirstCharacterOffsetIntoFullBibleText;
+        std::size_t verse_character_count = (
+            verse_id_with_character_range.LastCharacterOffsetIntoFullBibleText -
+            verse_id_with_character_range.FirstCharacterOffsetIntoFullBibleText);
+        std::string_view verse_text(first_character_in_verse, verse_character_count);
+
+        // RETURN THE FULL VERSE.
+        BibleVerse verse =
+        {
+            .Id = verse_id_with_character_range.Id,
+            .Text = verse_text
+        };
+        return verse;
+    }
+
+    /// Gets the indices of verses within a range.
+    /// Verse text is never accessed, and verses are found by binary searching their IDs.
+    /// @param[in]  verse_range - The range of verses.  Verses in the range don't need to exist in the translation.
+    /// @return The index within VerseCharacterRanges of the first verse in the range and the index just past the
+    ///     last verse in the range.  Both are equal if no verses in the translation are in the range.
+    std::pair<std::size_t, std::size_t> BibleTranslation::GetVerseIndexRange(const BibleVerseRange& verse_range) const
+    {
+        auto first_verse_in_range = std::partition_point(
+            VerseCharacterRanges.cbegin(),
+            VerseCharacterRanges.cend(),
+            [&verse_range](const BibleVerseIdWithCharacterRange& verse) { return verse.Id < verse_range.StartingVerse; });
+        auto verse_after_range = std::partition_point(
+            first_verse_in_range,
+            VerseCharacterRanges.cend(),
+            [&verse_range](const BibleVerseIdWithCharacterRange& verse) { return !(verse_range.EndingVerse < verse.Id); });
+
+        std::size_t first_verse_index = static_cast<std::size_t>(first_verse_in_range - VerseCharacterRanges.cbegin());
+        std::size_t end_verse_index = static_cast<std::size_t>(verse_after_range - VerseCharacterRanges.cbegin());
+        return { first_verse_index, end_verse_index };
+    }
+
+    /// Gets a view of the verses within a range.
+    /// Verses are contiguous, so the view takes constant memory regardless of the size of the range.
+    /// @param[in]  verse_range - The range of verses.  Verses in the range don't need to exist in the translation.
+    /// @return The verses in the range, in canonical order.
+    BibleVersesView BibleTranslation::GetVersesInRange(const BibleVerseRange& verse_range) const
+    {
+        auto [first_verse_index, end_verse_index] = GetVerseIndexRange(verse_range);
+        return BibleVersesView::FromContiguousVerses(this, first_verse_index, end_verse_index);
+    }
+
+    /// Visits each verse within a range one at a time, without storing any verses.
+    /// Only reads the translation, so it may be called from any thread.
+    /// @param[in]  verse_range - The range of verses.  Verses in the range don't need to exist in the translation.
+    /// @param[in]  visit_verse - The function to call for each verse in the range, in canonical order.
+    ///     Called on the calling thread.  Returning false stops visiting any more verses.
+    /// @return True if all verses in the range were visited; false if visiting was stopped early.
+    bool BibleTranslation::ForEachVerseInRange(const BibleVerseRange& verse_range, const BibleVerseVisitor& visit_verse) const
+    {
+        auto [first_verse_index, end_verse_index] = GetVerseIndexRange(verse_range);
+        for (std::size_t verse_index = first_verse_index; verse_index < end_verse_index; ++verse_index)
+        {
+            BibleVerse verse = GetVerse(verse_index);
+            bool continue_visiting = visit_verse(verse);
+            if (!continue_visiting)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Searches all verses for text matching a regular expression (in ECMAScript syntax).
+    /// The pattern is compiled once and then shared (read-only) by all threads.
+    /// Verses are split into contiguous chunks that threads take from a shared queue until none remain,
+    /// which keeps threads busy even if some chunks take longer to search than others.
+    /// Each verse is searched separately, so anchors and word boundaries apply to verses,
+    /// and matches never span multiple verses.
+    /// @param[in]  pattern - The regular expression to search for.
+    /// @param[in]  thread_count - The number of threads to use for searching.
+    /// @return The verses containing matches (with the ranges of characters for each non-empty match),
+    ///     in canonical verse order; null if the pattern is not a valid regular expression.
+    std::optional<std::vector<BibleVersePhraseMatch>> BibleTranslation::RegexSearch(
+        const std::string_view pattern,
+        const unsigned int thread_count) const
+    {
+        // COMPILE THE REGULAR EXPRESSION.
+        std::regex regular_expression;
+        try
+        {
+            regular_expression = std::regex(pattern.cbegin(), pattern.cend(), std::regex::ECMAScript | std::regex::optimize);
+        }
+        catch (const std::regex_error&)
+        {
+            return std::nullopt;
+        }
+
+        // DETERMINE HOW TO SPLIT UP THE VERSES FOR SEARCHING.
+        // More chunks than threads exist so that threads finishing early can take remaining chunks.
+        // Chunks are contiguous so that concatenating the chunks' matches in order keeps canonical verse order.
+        constexpr std::size_t CHUNKS_PER_THREAD = 8;
+        std::size_t verse_count = VerseCharacterRanges.size();
+        std::size_t worker_thread_count = std::clamp<std::size_t>(thread_count, 1, std::max<std::size_t>(verse_count, 1));
+        std::size_t chunk_count = std::clamp<std::size_t>(worker_thread_count * CHUNKS_PER_THREAD, 1, std::max<std::size_t>(verse_count, 1));
+
+        // DEFINE HOW TO SEARCH CHUNKS OF VERSES.
+        std::vector<std::vector<BibleVersePhraseMatch>> matching_verses_by_chunk(chunk_count);
+        std::atomic<std::size_t> next_chunk_index = 0;
+        auto search_chunks = [&]()
+        {
+            // SEARCH CHUNKS UNTIL NONE REMAIN.
+            for (std::size_t chunk_index = next_chunk_index++; chunk_index < chunk_count; chunk_index = next_chunk_index++)
+            {
+                std::size_t chunk_start_verse_index = (verse_count * chunk_index) / chunk_count;
+                std::size_t chunk_end_verse_index = (verse_count * (chunk_index + 1)) / chunk_count;
+                std::vector<BibleVersePhraseMatch>& chunk_matching_verses = matching_verses_by_chunk[chunk_index];
+                for (std::size_t verse_index = chunk_start_verse_index; verse_index < chunk_end_verse_index; ++verse_index)
+                {
+                    // FIND ALL MATCHES IN THE VERSE.
+                    BibleVerse verse = GetVerse(verse_index);
+                    BibleVersePhraseMatch matching_verse = { .Verse = verse };
+                    std::cregex_iterator end_of_matches;
+                    for (std::cregex_iterator match(verse.Text.data(), verse.Text.data() + verse.Text.size(), regular_expression); match != end_of_matches; ++match)
+                    {
+                        // Empty matches (such as for a pattern of only anchors) don't identify any text.
+                        std::size_t match_length = static_cast<std::size_t>(match->length());
+                        if (0 == match_length)
+                        {
+                            continue;
+                        }
+
+                        std::size_t match_offset = static_cast<std::size_t>(match->position());
+                        matching_verse.MatchCharacterRanges.push_back(BibleVersePhraseMatch::CharacterRange
+                        {
+                            .FirstCharacterOffsetIntoVerseText = match_offset,
+                            .LastCharacterOffsetIntoVerseText = match_offset + match_length,
+                        });
+                    }
+
+                    if (!matching_verse.MatchCharacterRanges.empty())
+                    {
+                        chunk_matching_verses.emplace_back(std::move(matching_verse));
+                    }
+                }
+            }
+        };
+
+        // SEARCH ALL CHUNKS.
+        // Work is only done on separate threads if multiple threads were requested.
+        bool single_threaded = (1 == worker_thread_count);
+        if (single_threaded)
+        {
+            search_chunks();
+        }
+        else
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(worker_thread_count);
+            for (std::size_t thread_index = 0; thread_index < worker_thread_count; ++thread_index)
+            {
+                threads.emplace_back(search_chunks);
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        // COMBINE THE MATCHES FROM ALL CHUNKS.
+        std::vector<BibleVersePhraseMatch> matching_verses;
+        for (std::vector<BibleVersePhraseMatch>& chunk_matching_verses : matching_verses_by_chunk)
+        {
+            std::move(chunk_matching_verses.begin(), chunk_matching_verses.end(), std::back_inserter(matching_verses));
+        }
+        return matching_verses;
+    }
+
+    /// Gets the memory used by the translation's text and indexes, broken down by component.
+    /// @return The memory used by the translation.
+    MemoryUsageReport BibleTranslation::MemoryUsage() const
+    {
+        MemoryUsageReport memory_usage;
+
+        // ADD THE TEXT.
+        // The text isn't stored with a length, but the last verse ends at the end of the text.
+        std::size_t text_size_in_bytes = 0;
+        if (!VerseCharacterRanges.empty())
+        {
+            text_size_in_bytes = VerseCharacterRanges.back().LastCharacterOffsetIntoFullBibleText;
+        }
+        memory_usage.Add("Text", text_size_in_bytes);
+
+        // ADD THE VERSE TABLE.
+        memory_usage.Add("Verse table", VerseCharacterRanges.capacity() * sizeof(BibleVerseIdWithCharacterRange));
+
+        // ADD THE INDEXES.
+        memory_usage.Add("Word index", WordIndex.MemoryUsage());
+        memory_usage.Add("Suffix array", SuffixArray.SuffixOffsets.size_bytes() + SuffixArray.LongestCommonPrefixLengths.size_bytes());
+        memory_usage.Add("Collocations", Collocations.SizeInBytes());
+
+        return memory_usage;
+    }
+}
@@ -1,9 +1,20 @@
 #pragma once
 
+#include <cstddef>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
+#include "BibleData/BibleVerse.h"
+#include "BibleData/BibleVersesView.h"
+#include "BibleData/BibleVersePhraseMatch.h"
+#include "BibleData/BibleSuffixArray.h"
 #include "BibleData/BibleVerseIdWithCharacterRange.h"
+#include "BibleData/BibleVerseRange.h"
+#include "BibleData/BibleWordCollocations.h"
 #include "BibleData/BibleWordIndex.h"
+#include "BibleData/MemoryUsageReport.h"
 
 namespace BIBLE_DATA
 {
@@ -17,6 +28,16 @@ namespace BIBLE_DATA
         /// The abbreviated name for the WEB (World English Bible) translation.
         inline static const std::string WEB_ABBREVIATED_NAME = "WEB";
 
+        // METHODS.
+        BibleVerse GetVerse(const std::size_t verse_index) const;
+        std::pair<std::size_t, std::size_t> GetVerseIndexRange(const BibleVerseRange& verse_range) const;
+        BibleVersesView GetVersesInRange(const BibleVerseRange& verse_range) const;
+        bool ForEachVerseInRange(const BibleVerseRange& verse_range, const BibleVerseVisitor& visit_verse) const;
+        std::optional<std::vector<BibleVersePhraseMatch>> RegexSearch(
+            const std::string_view pattern,
+            const unsigned int thread_count = 1) const;
+        MemoryUsageReport MemoryUsage() const;
+
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The raw, full text of the Bible translation (in order).
         const char* Text = nullptr;
@@ -24,5 +45,9 @@ namespace BIBLE_DATA
         std::vector<BibleVerseIdWithCharacterRange> VerseCharacterRanges = {};
         /// An index of words in the Bible translation.
         BibleWordIndex WordIndex = {};
+        /// A suffix array over the text of the Bible translation for finding arbitrary substrings.
+        BibleSuffixArray SuffixArray = {};
+        /// Collocations for finding words that frequently appear near other words.
+        BibleWordCollocations Collocations = {};
     };
 }
@@ -0,0 +1,104 @@
+#include <cstdio>
+#include <exception>
+#include "BibleData/BibleTranslationLoader.h"
+
+namespace BIBLE_DATA
+{
+    /// Waits for any translations still loading to finish so that no threads outlive the loader.
+    BibleTranslationLoader::~BibleTranslationLoader()
+    {
+        for (std::unique_ptr<TranslationLoad>& translation_load : TranslationLoads)
+        {
+            if (translation_load->Thread.joinable())
+            {
+                translation_load->Thread.join();
+            }
+        }
+    }
+
+    /// Starts loading a translation on a new background thread.
+    /// @param[in]  abbreviated_name - The abbreviated name of the translation.
+    /// @param[in]  load_function - The function to load the translation.  It's called on the background thread.
+    void BibleTranslationLoader::StartLoading(const std::string& abbreviated_name, LoadFunction load_function)
+    {
+        // TRACK THE TRANSLATION BEING LOADED.
+        // The translation is allocated before the thread starts so that its address never changes.
+        std::unique_ptr<TranslationLoad>& translation_load = TranslationLoads.emplace_back(std::make_unique<TranslationLoad>());
+        translation_load->AbbreviatedName = abbreviated_name;
+
+        // LOAD THE TRANSLATION ON A BACKGROUND THREAD.
+        TranslationLoad* const loading_translation = translation_load.get();
+        translation_load->Thread = std::thread([loading_translation, load_function = std::move(load_function)]()
+        {
+            // Errors are caught here since exceptions can't otherwise propagate out of the thread.
+            try
+            {
+                load_function(*loading_translation->Translation);
+                loading_translation->Status.store(LoadStatus::LOADED, std::memory_order_release);
+            }
+            catch (const std::exception& exception)
+            {
+                std::fprintf(stderr, "Failed to load %s translation: %s\n", loading_translation->AbbreviatedName.c_str(), exception.what());
+                loading_translation->Status.store(LoadStatus::FAILED, std::memory_order_release);
+            }
+            catch (...)
+            {
+                std::fprintf(stderr, "Failed to load %s translation: unknown error\n", loading_translation->AbbreviatedName.c_str());
+                loading_translation->Status.store(LoadStatus::FAILED, std::memory_order_release);
+            }
+        });
+    }
+
+    /// Adds any translations that have finished loading since the last call to a collection of Bibles.
+    /// Never blocks on translations still loading, so it can be called every frame.
+    /// @param[in,out]  bibles - The Bibles to add loaded translations to.
+    /// @return The abbreviated names of the newly added translations.
+    std::vector<std::string> BibleTranslationLoader::AddLoadedTranslations(Bibles& bibles)
+    {
+        std::vector<std::string> added_translation_names;
+        for (std::unique_ptr<TranslationLoad>& translation_load : TranslationLoads)
+        {
+            // SKIP OVER TRANSLATIONS ALREADY ADDED OR NOT SUCCESSFULLY LOADED.
+            if (translation_load->AddedToBibles)
+            {
+                continue;
+            }
+            LoadStatus load_status = translation_load->Status.load(std::memory_order_acquire);
+            if (LoadStatus::LOADED != load_status)
+            {
+                continue;
+            }
+
+            // ADD THE TRANSLATION.
+            // A copy is added since any indexes keep pointers to the loader's translation.
+            translation_load->Thread.join();
+            bibles.TranslationsByAbbreviatedName[translation_load->AbbreviatedName] = *translation_load->Translation;
+            translation_load->AddedToBibles = true;
+            added_translation_names.push_back(translation_load->AbbreviatedName);
+        }
+        return added_translation_names;
+    }
+
+    /// Gets the total number of translations that have started loading.
+    /// @return The number of translations.
+    std::size_t BibleTranslationLoader::TranslationCount() const
+    {
+        return TranslationLoads.size();
+    }
+
+    /// Gets the number of translations that have finished loading (successfully or not).
+    /// @return The number of finished translations.
+    std::size_t BibleTranslationLoader::FinishedTranslationCount() const
+    {
+        std::size_t finished_translation_count = 0;
+        for (const std::unique_ptr<TranslationLoad>& translation_load : TranslationLoads)
+        {
+            LoadStatus load_status = translation_load->Status.load(std::memory_order_acquire);
+            if (LoadStatus::LOADING != load_status)
+            {
+                ++finished_translation_count;
+            }
+        }
+        return finished_translation_count;
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BibleData/BibleTranslation.h"
+#include "BibleData/Bibles.h"
+
+namespace BIBLE_DATA
+{
+    /// Loads Bible translations (including building any indexes) on background threads
+    /// so that a program can continue running (such as displaying a GUI) while translations load.
+    ///
+    /// Each translation is loaded on its own thread into a translation owned by the loader.
+    /// Only the thread that started loading should add loaded translations to a collection of Bibles.
+    class BibleTranslationLoader
+    {
+    public:
+        /// A function that fully initializes a translation, including any indexes.
+        /// The translation is never moved, so indexes may keep pointers to it.
+        using LoadFunction = std::function<void(BibleTranslation& translation)>;
+
+        /// The status of loading a single translation.
+        enum class LoadStatus
+        {
+            /// The translation is still being loaded.
+            LOADING,
+            /// The translation was successfully loaded.
+            LOADED,
+            /// An error occurred loading the translation.
+            FAILED,
+        };
+
+        /// A single translation being loaded.
+        struct TranslationLoad
+        {
+            /// The abbreviated name of the translation.
+            std::string AbbreviatedName = "";
+            /// The translation being loaded.  It must not be accessed by other threads until loaded.
+            std::unique_ptr<BibleTranslation> Translation = std::make_unique<BibleTranslation>();
+            /// The status of loading the translation.
+            std::atomic<LoadStatus> Status = LoadStatus::LOADING;
+            /// True if the translation has been added to a collection of Bibles; false otherwise.
+            bool AddedToBibles = false;
+            /// The thread loading the translation.
+            std::thread Thread = {};
+        };
+
+        BibleTranslationLoader() = default;
+        BibleTranslationLoader(const BibleTranslationLoader&) = delete;
+        BibleTranslationLoader& operator=(const BibleTranslationLoader&) = delete;
+        ~BibleTranslationLoader();
+
+        void StartLoading(const std::string& abbreviated_name, LoadFunction load_function);
+        std::vector<std::string> AddLoadedTranslations(Bibles& bibles);
+        std::size_t TranslationCount() const;
+        std::size_t FinishedTranslationCount() const;
+
+        /// The translations being loaded, in the order that loading started.
+        std::vector<std::unique_ptr<TranslationLoad>> TranslationLoads = {};
+    };
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string_view>
 #include "BibleData/BibleVerseId.h"
 
@@ -14,4 +15,8 @@ namespace BIBLE_DATA
         /// The text of the verse.
         std::string_view Text = "";
     };
+
+    /// A function called for each verse when visiting verses one at a time, such as for streaming large numbers of verses.
+    /// Returns true to continue visiting verses or false to stop early.
+    using BibleVerseVisitor = std::function<bool(const BibleVerse& verse)>;
 }
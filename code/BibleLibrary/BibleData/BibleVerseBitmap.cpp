@@ -0,0 +1,189 @@
+#include <bit>
+#include <cassert>
+#include "BibleData/BibleTranslation.h"
+#include "BibleData/BibleVerseBitmap.h"
+
+namespace BIBLE_DATA
+{
+    /// Creates a bitmap without any verses.
+    /// @param[in]  bible_translation - The translation the bitmap is for.
+    /// @return A bitmap with room for every verse in the translation.
+    BibleVerseBitmap BibleVerseBitmap::Empty(const BibleTranslation* bible_translation)
+    {
+        BibleVerseBitmap bitmap;
+        bitmap.Bible = bible_translation;
+        std::size_t verse_count = bible_translation->VerseCharacterRanges.size();
+        std::size_t chunk_count = (verse_count + VERSES_PER_CHUNK - 1) / VERSES_PER_CHUNK;
+        bitmap.BitChunks.resize(chunk_count, 0);
+        return bitmap;
+    }
+
+    /// Creates a bitmap from verse indices.
+    /// @param[in]  bible_translation - The translation the bitmap is for.
+    /// @param[in]  verse_indices - The indices of verses to include.  Duplicates and any order are allowed.
+    /// @return A bitmap with the verses.
+    BibleVerseBitmap BibleVerseBitmap::FromVerseIndices(const BibleTranslation* bible_translation, const std::span<const BibleWordIndex::VerseIndex> verse_indices)
+    {
+        BibleVerseBitmap bitmap = Empty(bible_translation);
+        for (const BibleWordIndex::VerseIndex verse_index : verse_indices)
+        {
+            bitmap.Add(verse_index);
+        }
+        return bitmap;
+    }
+
+    /// Creates a bitmap from a verse set.
+    /// @param[in]  verse_set - The verse set to convert.
+    /// @return A bitmap with the same verses.
+    BibleVerseBitmap BibleVerseBitmap::FromVerseSet(const BibleVerseSet& verse_set)
+    {
+        return FromVerseIndices(verse_set.Bible, verse_set.VerseIndices);
+    }
+
+    /// Gets the number of verses in the bitmap.
+    /// @return The number of verses.
+    std::size_t BibleVerseBitmap::Count() const
+    {
+        std::size_t verse_count = 0;
+        for (const BitChunk bit_chunk : BitChunks)
+        {
+            verse_count += static_cast<std::size_t>(std::popcount(bit_chunk));
+        }
+        return verse_count;
+    }
+
+    /// Checks if the bitmap contains a verse.
+    /// @param[in]  verse_index - The index of the verse in BibleTranslation::VerseCharacterRanges.
+    /// @return True if the verse is in the bitmap; false otherwise.
+    bool BibleVerseBitmap::Contains(const std::size_t verse_index) const
+    {
+        BitChunk verse_bit = BitChunk(1) << (verse_index % VERSES_PER_CHUNK);
+        bool verse_included = (BitChunks[verse_index / VERSES_PER_CHUNK] & verse_bit) != 0;
+        return verse_included;
+    }
+
+    /// Adds a verse to the bitmap.
+    /// @param[in]  verse_index - The index of the verse in BibleTranslation::VerseCharacterRanges.
+    void BibleVerseBitmap::Add(const std::size_t verse_index)
+    {
+        BitChunk verse_bit = BitChunk(1) << (verse_index % VERSES_PER_CHUNK);
+        BitChunks[verse_index / VERSES_PER_CHUNK] |= verse_bit;
+    }
+
+    /// Removes a verse from the bitmap.
+    /// @param[in]  verse_index - The index of the verse in BibleTranslation::VerseCharacterRanges.
+    void BibleVerseBitmap::Remove(const std::size_t verse_index)
+    {
+        BitChunk verse_bit = BitChunk(1) << (verse_index % VERSES_PER_CHUNK);
+        BitChunks[verse_index / VERSES_PER_CHUNK] &= ~verse_bit;
+    }
+
+    /// Keeps only verses also in another bitmap (AND).
+    /// Chunks are combined in a simple loop that compilers vectorize.
+    /// @param[in]  other_bitmap - The other bitmap.  Must be for the same translation.
+    void BibleVerseBitmap::IntersectWith(const BibleVerseBitmap& other_bitmap)
+    {
+        assert(BitChunks.size() == other_bitmap.BitChunks.size());
+        for (std::size_t chunk_index = 0; chunk_index < BitChunks.size(); ++chunk_index)
+        {
+            BitChunks[chunk_index] &= other_bitmap.BitChunks[chunk_index];
+        }
+    }
+
+    /// Adds all verses in another bitmap (OR).
+    /// @param[in]  other_bitmap - The other bitmap.  Must be for the same translation.
+    void BibleVerseBitmap::UnionWith(const BibleVerseBitmap& other_bitmap)
+    {
+        assert(BitChunks.size() == other_bitmap.BitChunks.size());
+        for (std::size_t chunk_index = 0; chunk_index < BitChunks.size(); ++chunk_index)
+        {
+            BitChunks[chunk_index] |= other_bitmap.BitChunks[chunk_index];
+        }
+    }
+
+    /// Keeps only verses in exactly one of this bitmap or another bitmap (XOR).
+    /// @param[in]  other_bitmap - The other bitmap.  Must be for the same translation.
+    void BibleVerseBitmap::SymmetricDifferenceWith(const BibleVerseBitmap& other_bitmap)
+    {
+        assert(BitChunks.size() == other_bitmap.BitChunks.size());
+        for (std::size_t chunk_index = 0; chunk_index < BitChunks.size(); ++chunk_index)
+        {
+            BitChunks[chunk_index] ^= other_bitmap.BitChunks[chunk_index];
+        }
+    }
+
+    /// Removes all verses in another bitmap (AND NOT).
+    /// @param[in]  other_bitmap - The other bitmap.  Must be for the same translation.
+    void BibleVerseBitmap::Subtract(const BibleVerseBitmap& other_bitmap)
+    {
+        assert(BitChunks.size() == other_bitmap.BitChunks.size());
+        for (std::size_t chunk_index = 0; chunk_index < BitChunks.size(); ++chunk_index)
+        {
+            BitChunks[chunk_index] &= ~other_bitmap.BitChunks[chunk_index];
+        }
+    }
+
+    /// Converts the bitmap to the same verses in another translation, so that verses can be compared across translations.
+    /// Verses are matched by ID since translations may not have exactly the same verses.
+    /// @param[in]  other_bible_translation - The translation to convert to.
+    /// @return A bitmap for the other translation with all verses that exist in both translations.
+    BibleVerseBitmap BibleVerseBitmap::ForTranslation(const BibleTranslation* other_bible_translation) const
+    {
+        // MATCH VERSES IN BOTH TRANSLATIONS.
+        // Both translations have verses in canonical order, so matching verses can be found in a single pass.
+        BibleVerseBitmap other_bitmap = Empty(other_bible_translation);
+        const std::vector<BibleVerseIdWithCharacterRange>& verse_character_ranges = Bible->VerseCharacterRanges;
+        const std::vector<BibleVerseIdWithCharacterRange>& other_verse_character_ranges = other_bible_translation->VerseCharacterRanges;
+        std::size_t other_verse_index = 0;
+        for (std::size_t verse_index = 0; verse_index < verse_character_ranges.size(); ++verse_index)
+        {
+            // SKIP VERSES NOT IN THE BITMAP.
+            if (!Contains(verse_index))
+            {
+                continue;
+            }
+
+            // FIND THE SAME VERSE IN THE OTHER TRANSLATION.
+            const BibleVerseId& verse_id = verse_character_ranges[verse_index].Id;
+            while ((other_verse_index < other_verse_character_ranges.size()) && (other_verse_character_ranges[other_verse_index].Id < verse_id))
+            {
+                ++other_verse_index;
+            }
+
+            bool verse_in_other_translation = (other_verse_index < other_verse_character_ranges.size()) && (other_verse_character_ranges[other_verse_index].Id == verse_id);
+            if (verse_in_other_translation)
+            {
+                other_bitmap.Add(other_verse_index);
+            }
+        }
+        return other_bitmap;
+    }
+
+    /// Converts the bitmap to a verse set.
+    /// @return A verse set with the same verses.
+    BibleVerseSet BibleVerseBitmap::ToVerseSet() const
+    {
+        BibleVerseSet verse_set;
+        verse_set.Bible = Bible;
+        verse_set.VerseIndices.reserve(Count());
+        for (std::size_t chunk_index = 0; chunk_index < BitChunks.size(); ++chunk_index)
+        {
+            // Only set bits are visited by repeatedly clearing the lowest one.
+            for (BitChunk remaining_bits = BitChunks[chunk_index]; remaining_bits != 0; remaining_bits &= (remaining_bits - 1))
+            {
+                std::size_t verse_index = (chunk_index * VERSES_PER_CHUNK) + static_cast<std::size_t>(std::countr_zero(remaining_bits));
+                verse_set.VerseIndices.push_back(static_cast<BibleWordIndex::VerseIndex>(verse_index));
+            }
+        }
+        return verse_set;
+    }
+
+    /// Gets all verses in the bitmap.
+    /// @return All verses in the bitmap, in canonical verse order.
+    std::vector<BibleVerse> BibleVerseBitmap::GetVerses() const
+    {
+        BibleVerseSet verse_set = ToVerseSet();
+        std::vector<BibleVerse> verses = verse_set.GetVerses();
+        return verses;
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "BibleData/BibleVerse.h"
+#include "BibleData/BibleVerseSet.h"
+#include "BibleData/BibleWordIndex.h"
+
+namespace BIBLE_DATA
+{
+    /// @todo   Get rid of forward declaration?
+    class BibleTranslation;
+
+    /// A set of verses within a single Bible translation stored as a bitmap, with 1 bit per verse
+    /// in BibleTranslation::VerseCharacterRanges (about 4 KB for an entire translation).
+    ///
+    /// Set operations are done a 64-bit chunk at a time, so combining sets takes the same small amount
+    /// of time regardless of how many verses they contain.  This complements BibleVerseSet,
+    /// which stores sorted verse indices and is smaller for sets with few verses (much like
+    /// the array and bitmap containers in Roaring bitmaps), and sets can be converted between both forms.
+    class BibleVerseBitmap
+    {
+    public:
+        /// A chunk of bits for consecutive verses.  The lowest bit is for the earliest verse.
+        using BitChunk = std::uint64_t;
+        /// The number of verses in a single chunk.
+        static constexpr std::size_t VERSES_PER_CHUNK = 64;
+
+        static BibleVerseBitmap Empty(const BibleTranslation* bible_translation);
+        static BibleVerseBitmap FromVerseIndices(const BibleTranslation* bible_translation, const std::span<const BibleWordIndex::VerseIndex> verse_indices);
+        static BibleVerseBitmap FromVerseSet(const BibleVerseSet& verse_set);
+
+        std::size_t Count() const;
+        bool Contains(const std::size_t verse_index) const;
+        void Add(const std::size_t verse_index);
+        void Remove(const std::size_t verse_index);
+
+        void IntersectWith(const BibleVerseBitmap& other_bitmap);
+        void UnionWith(const BibleVerseBitmap& other_bitmap);
+        void SymmetricDifferenceWith(const BibleVerseBitmap& other_bitmap);
+        void Subtract(const BibleVerseBitmap& other_bitmap);
+
+        BibleVerseBitmap ForTranslation(const BibleTranslation* other_bible_translation) const;
+        BibleVerseSet ToVerseSet() const;
+        std::vector<BibleVerse> GetVerses() const;
+
+        /// The translation containing the verses.
+        const BibleTranslation* Bible = nullptr;
+        /// The bits for all verses in the translation.  Bits past the last verse are always 0.
+        std::vector<BitChunk> BitChunks = {};
+    };
+}
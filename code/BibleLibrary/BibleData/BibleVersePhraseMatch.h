@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "BibleData/BibleVerse.h"
+
+namespace BIBLE_DATA
+{
+    /// A verse containing a searched phrase, along with where the phrase occurs in the verse.
+    struct BibleVersePhraseMatch
+    {
+        /// The range of characters for a single occurrence of the phrase within a verse.
+        struct CharacterRange
+        {
+            /// The offset into the verse text of the first character of the phrase.
+            std::size_t FirstCharacterOffsetIntoVerseText = 0;
+            /// The offset into the verse text one past the last character of the phrase.
+            std::size_t LastCharacterOffsetIntoVerseText = 0;
+        };
+
+        /// The verse containing the phrase.
+        BibleVerse Verse = {};
+        /// The ranges of characters for each occurrence of the phrase in the verse (in order).
+        /// Punctuation or other non-word characters between words of the phrase are included.
+        std::vector<CharacterRange> MatchCharacterRanges = {};
+    };
+}
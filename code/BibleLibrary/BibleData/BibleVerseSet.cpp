@@ -0,0 +1,36 @@
+#include "BibleData/BibleTranslation.h"
+#include "BibleData/BibleVerseSet.h"
+
+namespace BIBLE_DATA
+{
+    /// Gets the number of verses in the set.
+    /// @return The number of verses.
+    std::size_t BibleVerseSet::Count() const
+    {
+        return VerseIndices.size();
+    }
+
+    /// Gets a single verse from the set.
+    /// @param[in]  index_in_set - The index of the verse within the set.  Must be less than Count().
+    /// @return The verse.
+    BibleVerse BibleVerseSet::GetVerse(const std::size_t index_in_set) const
+    {
+        BibleWordIndex::VerseIndex verse_index = VerseIndices[index_in_set];
+        BibleVerse verse = Bible->GetVerse(verse_index);
+        return verse;
+    }
+
+    /// Gets all verses in the set.
+    /// @return All verses in the set, in canonical verse order.
+    std::vector<BibleVerse> BibleVerseSet::GetVerses() const
+    {
+        std::vector<BibleVerse> verses;
+        verses.reserve(VerseIndices.size());
+        for (const BibleWordIndex::VerseIndex verse_index : VerseIndices)
+        {
+            BibleVerse verse = Bible->GetVerse(verse_index);
+            verses.emplace_back(verse);
+        }
+        return verses;
+    }
+}
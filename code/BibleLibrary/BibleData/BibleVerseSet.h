@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "BibleData/BibleVerse.h"
+#include "BibleData/BibleWordIndex.h"
+
+namespace BIBLE_DATA
+{
+    /// @todo   Get rid of forward declaration?
+    class BibleTranslation;
+
+    /// A set of verses within a single Bible translation.
+    /// Verses are only stored as indices, so verse text is not retrieved until actually needed.
+    class BibleVerseSet
+    {
+    public:
+        std::size_t Count() const;
+        BibleVerse GetVerse(const std::size_t index_in_set) const;
+        std::vector<BibleVerse> GetVerses() const;
+
+        /// The translation containing the verses.
+        const BibleTranslation* Bible = nullptr;
+        /// Indices of verses within BibleTranslation::VerseCharacterRanges, in increasing order without duplicates.
+        std::vector<BibleWordIndex::VerseIndex> VerseIndices = {};
+    };
+}
@@ -0,0 +1,145 @@
+#include <memory>
+#include <utility>
+#include "BibleData/BibleTranslation.h"
+#include "BibleData/BibleVersesView.h"
+
+namespace BIBLE_DATA
+{
+    /// Gets the current verse.
+    /// @return The current verse.
+    BibleVerse BibleVersesView::Iterator::operator*() const
+    {
+        if (CurrentVerseIndex)
+        {
+            return Translation->GetVerse(*CurrentVerseIndex);
+        }
+        else
+        {
+            return Translation->GetVerse(CurrentContiguousVerseIndex);
+        }
+    }
+
+    /// Moves to the next verse.
+    /// @return This iterator.
+    BibleVersesView::Iterator& BibleVersesView::Iterator::operator++()
+    {
+        if (CurrentVerseIndex)
+        {
+            ++CurrentVerseIndex;
+        }
+        else
+        {
+            ++CurrentContiguousVerseIndex;
+        }
+        return *this;
+    }
+
+    /// Moves to the next verse.
+    /// @return A copy of this iterator from before moving to the next verse.
+    BibleVersesView::Iterator BibleVersesView::Iterator::operator++(int)
+    {
+        Iterator previous_iterator = *this;
+        ++(*this);
+        return previous_iterator;
+    }
+
+    /// Creates a view that owns its verse indices.
+    /// @param[in]  bible_translation - The translation containing the verses.
+    /// @param[in]  verse_indices - The indices of the verses.  Moved into the view.
+    /// @return The view of the verses.
+    BibleVersesView BibleVersesView::FromOwnedVerseIndices(const BibleTranslation* bible_translation, std::vector<VerseIndex>&& verse_indices)
+    {
+        std::shared_ptr<const std::vector<VerseIndex>> owned_verse_indices = std::make_shared<const std::vector<VerseIndex>>(std::move(verse_indices));
+        BibleVersesView verses_view =
+        {
+            .Translation = bible_translation,
+            .OwnedVerseIndices = owned_verse_indices,
+            .VerseIndices = *owned_verse_indices,
+        };
+        return verses_view;
+    }
+
+    /// Creates a view of a contiguous range of verses, which doesn't store any verse indices.
+    /// @param[in]  bible_translation - The translation containing the verses.
+    /// @param[in]  first_verse_index - The index of the first verse.
+    /// @param[in]  end_verse_index - The index after the last verse.
+    /// @return The view of the verses.
+    BibleVersesView BibleVersesView::FromContiguousVerses(
+        const BibleTranslation* bible_translation,
+        const std::size_t first_verse_index,
+        const std::size_t end_verse_index)
+    {
+        BibleVersesView verses_view =
+        {
+            .Translation = bible_translation,
+            .IsContiguous = true,
+            .ContiguousFirstVerseIndex = first_verse_index,
+            .ContiguousEndVerseIndex = end_verse_index,
+        };
+        return verses_view;
+    }
+
+    /// Gets an iterator to the first verse.
+    /// @return An iterator to the first verse.
+    BibleVersesView::Iterator BibleVersesView::begin() const
+    {
+        if (IsContiguous)
+        {
+            return Iterator{ .Translation = Translation, .CurrentContiguousVerseIndex = ContiguousFirstVerseIndex };
+        }
+        else
+        {
+            return Iterator{ .Translation = Translation, .CurrentVerseIndex = VerseIndices.data() };
+        }
+    }
+
+    /// Gets an iterator past the last verse.
+    /// @return An iterator past the last verse.
+    BibleVersesView::Iterator BibleVersesView::end() const
+    {
+        if (IsContiguous)
+        {
+            return Iterator{ .Translation = Translation, .CurrentContiguousVerseIndex = ContiguousEndVerseIndex };
+        }
+        else
+        {
+            return Iterator{ .Translation = Translation, .CurrentVerseIndex = VerseIndices.data() + VerseIndices.size() };
+        }
+    }
+
+    /// Gets the number of verses in the view.
+    /// @return The number of verses.
+    std::size_t BibleVersesView::size() const
+    {
+        if (IsContiguous)
+        {
+            return ContiguousEndVerseIndex - ContiguousFirstVerseIndex;
+        }
+        else
+        {
+            return VerseIndices.size();
+        }
+    }
+
+    /// Determines if the view has no verses.
+    /// @return True if the view has no verses; false otherwise.
+    bool BibleVersesView::empty() const
+    {
+        return (0 == size());
+    }
+
+    /// Gets a verse in the view.
+    /// @param[in]  index - The index of the verse within the view.  Must be less than size().
+    /// @return The verse.
+    BibleVerse BibleVersesView::operator[](const std::size_t index) const
+    {
+        if (IsContiguous)
+        {
+            return Translation->GetVerse(ContiguousFirstVerseIndex + index);
+        }
+        else
+        {
+            return Translation->GetVerse(VerseIndices[index]);
+        }
+    }
+}
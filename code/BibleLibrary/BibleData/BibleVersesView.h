@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <vector>
+#include "BibleData/BibleVerse.h"
+
+namespace BIBLE_DATA
+{
+    /// @todo   Get rid of forward declaration?
+    class BibleTranslation;
+
+    /// A lightweight view of verses in a translation, identified by their indices in BibleTranslation::VerseCharacterRanges.
+    /// Verses are only produced as they're accessed, so views can be stored and passed around (such as for search results)
+    /// without copying any verses.  Copying a view is cheap since any owned indices are shared.
+    ///
+    /// Views of contiguous ranges of verses (such as a chapter) don't store any indices at all, so they
+    /// take constant memory regardless of the number of verses.
+    ///
+    /// Lowercase methods are used for consistency with standard containers, which allows use in range-based for loops.
+    class BibleVersesView
+    {
+    public:
+        /// An index of a verse within BibleTranslation::VerseCharacterRanges.
+        /// The ~31,000 verses in a Bible fit within 16 bits.
+        using VerseIndex = std::uint16_t;
+
+        /// Produces verses one at a time while iterating over a view.
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = BibleVerse;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = BibleVerse;
+
+            BibleVerse operator*() const;
+            Iterator& operator++();
+            Iterator operator++(int);
+            bool operator==(const Iterator& rhs) const = default;
+
+            /// The translation containing the verses.
+            const BibleTranslation* Translation = nullptr;
+            /// The index of the current verse; null if iterating over a contiguous range of verses.
+            const VerseIndex* CurrentVerseIndex = nullptr;
+            /// The index of the current verse if iterating over a contiguous range of verses.
+            std::size_t CurrentContiguousVerseIndex = 0;
+        };
+
+        static BibleVersesView FromOwnedVerseIndices(const BibleTranslation* bible_translation, std::vector<VerseIndex>&& verse_indices);
+        static BibleVersesView FromContiguousVerses(
+            const BibleTranslation* bible_translation,
+            const std::size_t first_verse_index,
+            const std::size_t end_verse_index);
+
+        Iterator begin() const;
+        Iterator end() const;
+        std::size_t size() const;
+        bool empty() const;
+        BibleVerse operator[](const std::size_t index) const;
+
+        /// The translation containing the verses.
+        const BibleTranslation* Translation = nullptr;
+        /// The storage for the verse indices if they don't view data owned elsewhere (such as a word index's postings);
+        /// null otherwise.  It only keeps the indices alive for the lifetime of the view.
+        std::shared_ptr<const std::vector<VerseIndex>> OwnedVerseIndices = nullptr;
+        /// The indices of the verses, in the order they should be produced.  Unused for contiguous verses.
+        std::span<const VerseIndex> VerseIndices = {};
+        /// True if the view is of the contiguous range of verses [ContiguousFirstVerseIndex, ContiguousEndVerseIndex)
+        /// rather than of VerseIndices; false otherwise.
+        bool IsContiguous = false;
+        /// The index of the first verse if the view is of contiguous verses.
+        std::size_t ContiguousFirstVerseIndex = 0;
+        /// The index after the last verse if the view is of contiguous verses.
+        std::size_t ContiguousEndVerseIndex = 0;
+    };
+}
@@ -0,0 +1,334 @@
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <thread>
+#include "BibleData/BibleTranslation.h"
+#include "BibleData/BibleWordCollocations.h"
+
+namespace BIBLE_DATA
+{
+    /// Creates collocations for a translation, building the forward index of distinct words in each verse
+    /// needed for finding collocates immediately.
+    /// @param[in]  bible_translation - The translation for which to find collocates.  Its word index must already exist.
+    /// @return Collocations for the translation.
+    BibleWordCollocations BibleWordCollocations::Build(const BibleTranslation* bible_translation)
+    {
+        BibleWordCollocations collocations = BuildOnFirstUse(bible_translation);
+        collocations.GetVerseWords();
+        return collocations;
+    }
+
+    /// Creates collocations for a translation without building the forward index needed for finding collocates
+    /// until it's first used, which avoids the cost of building it unless collocates are actually requested.
+    /// @param[in]  bible_translation - The translation for which to find collocates.
+    ///     Its word index must exist by the time collocates are first requested.
+    /// @return Collocations for the translation.
+    BibleWordCollocations BibleWordCollocations::BuildOnFirstUse(const BibleTranslation* bible_translation)
+    {
+        BibleWordCollocations collocations;
+        collocations.Bible = bible_translation;
+        collocations.LazyWords = std::make_shared<LazyVerseWords>();
+        return collocations;
+    }
+
+    /// Gets the forward index of distinct words in each verse, building it if this is its first use.
+    /// It's only built once for collocations and all of their copies, even if first used by multiple threads at once.
+    /// @return The forward index.
+    const BibleWordCollocations::VerseWords& BibleWordCollocations::GetVerseWords() const
+    {
+        assert(LazyWords);
+        std::call_once(LazyWords->BuildOnce, [this]()
+        {
+            LazyWords->Words = BuildVerseWords(Bible);
+            LazyWords->Built = true;
+        });
+        return LazyWords->Words;
+    }
+
+    /// Gets the memory used by the forward index.
+    /// The forward index isn't built just to report its memory.
+    /// @return The size in bytes of the forward index; 0 if it hasn't been built.
+    std::size_t BibleWordCollocations::SizeInBytes() const
+    {
+        bool verse_words_built = LazyWords && LazyWords->Built;
+        if (!verse_words_built)
+        {
+            return 0;
+        }
+
+        const VerseWords& verse_words = LazyWords->Words;
+        std::size_t size_in_bytes = sizeof(std::uint32_t) * (verse_words.VerseWordOffsets.capacity() + verse_words.VerseWordIndices.capacity());
+        return size_in_bytes;
+    }
+
+    /// Gets the words most strongly associated with a word.
+    /// Only words appearing together more often than expected by chance are included.
+    /// Collocations are never modified after creation, so this may be called concurrently from multiple threads.
+    /// @param[in]  word_index - The index of the word in the word index's lexicon.
+    /// @param[in]  verse_window_size - The number of verses before and after each verse with the word to also
+    ///     count words from.  0 only counts words in the same verse.  Windows may span chapters and books.
+    /// @param[in]  score_type - How to score how strongly words are associated.
+    /// @param[in]  max_collocate_count - The maximum number of collocates to get.
+    /// @return The most strongly associated words, from highest to lowest score.
+    std::vector<BibleWordCollocations::Collocate> BibleWordCollocations::GetCollocates(
+        const std::size_t word_index,
+        const std::size_t verse_window_size,
+        const ScoreType score_type,
+        const std::size_t max_collocate_count) const
+    {
+        CountingBuffers counting_buffers;
+        std::vector<Collocate> collocates = GetCollocates(word_index, verse_window_size, score_type, max_collocate_count, counting_buffers);
+        return collocates;
+    }
+
+    /// Gets the words most strongly associated with every word in the lexicon.
+    /// Words are spread across threads that each reuse their own counting buffers.
+    /// @param[in]  verse_window_size - See GetCollocates().
+    /// @param[in]  score_type - See GetCollocates().
+    /// @param[in]  max_collocate_count - The maximum number of collocates to get for each word.
+    /// @param[in]  thread_count - The number of threads to use (such as std::thread::hardware_concurrency()).
+    ///     Values less than 1 are treated as 1.
+    /// @return The collocates for each word, in the same order as the word index's lexicon.
+    std::vector<std::vector<BibleWordCollocations::Collocate>> BibleWordCollocations::GetCollocatesForAllWords(
+        const std::size_t verse_window_size,
+        const ScoreType score_type,
+        const std::size_t max_collocate_count,
+        const unsigned int thread_count) const
+    {
+        // DEFINE HOW TO GET COLLOCATES FOR WORDS.
+        // Words are taken one at a time since the time for each word varies greatly with how common it is.
+        std::size_t word_count = Bible->WordIndex.WordCount();
+        std::vector<std::vector<Collocate>> collocates_by_word_index(word_count);
+        std::atomic<std::size_t> next_word_index = 0;
+        auto get_collocates_for_words = [&]()
+        {
+            CountingBuffers counting_buffers;
+            for (std::size_t word_index = next_word_index++; word_index < word_count; word_index = next_word_index++)
+            {
+                collocates_by_word_index[word_index] = GetCollocates(word_index, verse_window_size, score_type, max_collocate_count, counting_buffers);
+            }
+        };
+
+        // GET COLLOCATES FOR ALL WORDS.
+        // Work is only done on separate threads if multiple threads were requested.
+        std::size_t worker_thread_count = std::clamp<std::size_t>(thread_count, 1, std::max<std::size_t>(word_count, 1));
+        bool single_threaded = (1 == worker_thread_count);
+        if (single_threaded)
+        {
+            get_collocates_for_words();
+        }
+        else
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(worker_thread_count);
+            for (std::size_t thread_index = 0; thread_index < worker_thread_count; ++thread_index)
+            {
+                threads.emplace_back(get_collocates_for_words);
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        return collocates_by_word_index;
+    }
+
+    /// Gets the words most strongly associated with a word using existing buffers.
+    /// @param[in]  word_index - See the public GetCollocates().
+    /// @param[in]  verse_window_size - See the public GetCollocates().
+    /// @param[in]  score_type - See the public GetCollocates().
+    /// @param[in]  max_collocate_count - See the public GetCollocates().
+    /// @param[in,out]  counting_buffers - Buffers to use for counting.  They're left ready for reuse.
+    /// @return See the public GetCollocates().
+    std::vector<BibleWordCollocations::Collocate> BibleWordCollocations::GetCollocates(
+        const std::size_t word_index,
+        const std::size_t verse_window_size,
+        const ScoreType score_type,
+        const std::size_t max_collocate_count,
+        CountingBuffers& counting_buffers) const
+    {
+        // PREPARE THE BUFFERS FOR COUNTING.
+        const VerseWords& verse_words = GetVerseWords();
+        const BibleWordIndex& bible_word_index = Bible->WordIndex;
+        std::size_t word_count = bible_word_index.WordCount();
+        counting_buffers.CooccurrenceCountsByWordIndex.resize(word_count, 0);
+
+        // COUNT WORDS IN ALL VERSES NEAR THE WORD.
+        // Windows around nearby occurrences of the word overlap, so each verse is tracked to only be counted once.
+        std::size_t verse_count = Bible->VerseCharacterRanges.size();
+        std::size_t next_uncounted_verse_index = 0;
+        std::size_t window_verse_count = 0;
+        for (BibleWordIndex::PostingCursor postings = bible_word_index.GetPostingCursor(word_index); !postings.AtEnd(); postings.MoveToNextPosting())
+        {
+            std::size_t verse_index_with_word = postings.CurrentVerseIndex();
+            std::size_t window_start_verse_index = std::max(next_uncounted_verse_index, verse_index_with_word - std::min<std::size_t>(verse_index_with_word, verse_window_size));
+            std::size_t window_end_verse_index = std::min(verse_count, verse_index_with_word + verse_window_size + 1);
+            for (std::size_t verse_index = window_start_verse_index; verse_index < window_end_verse_index; ++verse_index)
+            {
+                for (std::size_t verse_word_offset = verse_words.VerseWordOffsets[verse_index]; verse_word_offset < verse_words.VerseWordOffsets[verse_index + 1]; ++verse_word_offset)
+                {
+                    std::uint32_t verse_word_index = verse_words.VerseWordIndices[verse_word_offset];
+                    std::uint32_t& cooccurrence_count = counting_buffers.CooccurrenceCountsByWordIndex[verse_word_index];
+                    if (0 == cooccurrence_count)
+                    {
+                        counting_buffers.CountedWordIndices.push_back(verse_word_index);
+                    }
+                    ++cooccurrence_count;
+                }
+                ++window_verse_count;
+            }
+            next_uncounted_verse_index = std::max(next_uncounted_verse_index, window_end_verse_index);
+        }
+
+        // SCORE EACH WORD THAT APPEARED NEAR THE WORD.
+        // Pointwise mutual information greatly overrates words that happen to appear together only once or twice,
+        // so those words are skipped.
+        constexpr std::uint32_t MIN_COOCCURRENCE_COUNT_FOR_POINTWISE_MUTUAL_INFORMATION = 3;
+        std::uint32_t min_cooccurrence_count = (ScoreType::POINTWISE_MUTUAL_INFORMATION == score_type) ? MIN_COOCCURRENCE_COUNT_FOR_POINTWISE_MUTUAL_INFORMATION : 1;
+        std::vector<Collocate> collocates;
+        for (const std::uint32_t counted_word_index : counting_buffers.CountedWordIndices)
+        {
+            // RESET THE COUNT FOR THE NEXT WORD.
+            std::uint32_t cooccurrence_count = counting_buffers.CooccurrenceCountsByWordIndex[counted_word_index];
+            counting_buffers.CooccurrenceCountsByWordIndex[counted_word_index] = 0;
+
+            // SKIP WORDS THAT AREN'T ASSOCIATED WITH THE WORD.
+            // A word is always associated with itself, so it's skipped too.
+            bool same_word = (counted_word_index == word_index);
+            bool enough_cooccurrences = (cooccurrence_count >= min_cooccurrence_count);
+            if (same_word || !enough_cooccurrences)
+            {
+                continue;
+            }
+
+            // Words that appear together less often than expected are negatively associated.
+            double collocate_verse_count = static_cast<double>(bible_word_index.WordVerseCounts[counted_word_index]);
+            double expected_cooccurrence_count = (static_cast<double>(window_verse_count) * collocate_verse_count) / static_cast<double>(verse_count);
+            bool positively_associated = (cooccurrence_count > expected_cooccurrence_count);
+            if (!positively_associated)
+            {
+                continue;
+            }
+
+            double score = ComputeScore(
+                score_type,
+                static_cast<double>(cooccurrence_count),
+                static_cast<double>(window_verse_count),
+                collocate_verse_count,
+                static_cast<double>(verse_count));
+            collocates.push_back(Collocate
+            {
+                .WordIndex = counted_word_index,
+                .Word = bible_word_index.GetWord(counted_word_index),
+                .CooccurrenceCount = cooccurrence_count,
+                .Score = score,
+            });
+        }
+        counting_buffers.CountedWordIndices.clear();
+
+        // KEEP ONLY THE HIGHEST SCORING COLLOCATES.
+        auto ranks_higher = [](const Collocate& left, const Collocate& right)
+        {
+            if (left.Score != right.Score)
+            {
+                return left.Score > right.Score;
+            }
+            return left.WordIndex < right.WordIndex;
+        };
+        std::size_t kept_collocate_count = std::min(max_collocate_count, collocates.size());
+        std::partial_sort(collocates.begin(), collocates.begin() + kept_collocate_count, collocates.end(), ranks_higher);
+        collocates.resize(kept_collocate_count);
+        return collocates;
+    }
+
+    /// Computes the score for how strongly two words are associated.
+    /// @param[in]  score_type - How to score the association.
+    /// @param[in]  cooccurrence_count - The number of verses near the first word containing the second word.
+    /// @param[in]  window_verse_count - The number of verses near the first word.
+    /// @param[in]  collocate_verse_count - The number of verses containing the second word.
+    /// @param[in]  total_verse_count - The total number of verses.
+    /// @return The score for the association.
+    double BibleWordCollocations::ComputeScore(
+        const ScoreType score_type,
+        const double cooccurrence_count,
+        const double window_verse_count,
+        const double collocate_verse_count,
+        const double total_verse_count)
+    {
+        // COMPUTE POINTWISE MUTUAL INFORMATION IF APPLICABLE.
+        if (ScoreType::POINTWISE_MUTUAL_INFORMATION == score_type)
+        {
+            double pointwise_mutual_information = std::log2((cooccurrence_count * total_verse_count) / (window_verse_count * collocate_verse_count));
+            return pointwise_mutual_information;
+        }
+
+        // COMPUTE THE LOG-LIKELIHOOD RATIO.
+        // This compares how many verses are inside versus outside the window and with versus without the second word
+        // against what would be expected if the words were independent, using the entropy form of Dunning's G² statistic.
+        auto x_log_x = [](const double x)
+        {
+            return (x > 0.0) ? x * std::log(x) : 0.0;
+        };
+        double in_window_with_word_count = cooccurrence_count;
+        double in_window_without_word_count = window_verse_count - cooccurrence_count;
+        double outside_window_with_word_count = collocate_verse_count - cooccurrence_count;
+        double outside_window_without_word_count = total_verse_count - window_verse_count - outside_window_with_word_count;
+        double cell_entropy =
+            x_log_x(in_window_with_word_count) +
+            x_log_x(in_window_without_word_count) +
+            x_log_x(outside_window_with_word_count) +
+            x_log_x(outside_window_without_word_count);
+        double row_entropy = x_log_x(window_verse_count) + x_log_x(total_verse_count - window_verse_count);
+        double column_entropy = x_log_x(collocate_verse_count) + x_log_x(total_verse_count - collocate_verse_count);
+        double log_likelihood_ratio = 2.0 * (cell_entropy - row_entropy - column_entropy + x_log_x(total_verse_count));
+        return log_likelihood_ratio;
+    }
+
+    /// Builds the forward index of distinct words in each verse needed for finding collocates.
+    /// @param[in]  bible_translation - The translation for which to find collocates.  Its word index must already exist.
+    /// @return The forward index for the translation.
+    BibleWordCollocations::VerseWords BibleWordCollocations::BuildVerseWords(const BibleTranslation* bible_translation)
+    {
+        // COUNT THE DISTINCT WORDS IN EACH VERSE.
+        // Postings are in verse order, so repeated occurrences within a verse are skipped by moving to the next verse.
+        const BibleWordIndex& word_index = bible_translation->WordIndex;
+        std::size_t verse_count = bible_translation->VerseCharacterRanges.size();
+        std::size_t word_count = word_index.WordCount();
+        VerseWords verse_words;
+        verse_words.VerseWordOffsets.resize(verse_count + 1, 0);
+        for (std::size_t current_word_index = 0; current_word_index < word_count; ++current_word_index)
+        {
+            for (BibleWordIndex::PostingCursor postings = word_index.GetPostingCursor(current_word_index); !postings.AtEnd();)
+            {
+                BibleWordIndex::VerseIndex verse_index = postings.CurrentVerseIndex();
+                ++verse_words.VerseWordOffsets[verse_index + 1];
+                postings.SkipToVerse(static_cast<std::size_t>(verse_index) + 1);
+            }
+        }
+
+        // COMPUTE WHERE EACH VERSE'S WORDS START.
+        for (std::size_t verse_index = 0; verse_index < verse_count; ++verse_index)
+        {
+            verse_words.VerseWordOffsets[verse_index + 1] += verse_words.VerseWordOffsets[verse_index];
+        }
+
+        // FILL IN THE WORDS FOR EACH VERSE.
+        std::vector<std::uint32_t> next_word_offsets(verse_words.VerseWordOffsets.cbegin(), verse_words.VerseWordOffsets.cend() - 1);
+        verse_words.VerseWordIndices.resize(verse_words.VerseWordOffsets.back());
+        for (std::size_t current_word_index = 0; current_word_index < word_count; ++current_word_index)
+        {
+            for (BibleWordIndex::PostingCursor postings = word_index.GetPostingCursor(current_word_index); !postings.AtEnd();)
+            {
+                BibleWordIndex::VerseIndex verse_index = postings.CurrentVerseIndex();
+                std::uint32_t& next_word_offset = next_word_offsets[verse_index];
+                verse_words.VerseWordIndices[next_word_offset] = static_cast<std::uint32_t>(current_word_index);
+                ++next_word_offset;
+                postings.SkipToVerse(static_cast<std::size_t>(verse_index) + 1);
+            }
+        }
+
+        return verse_words;
+    }
+}
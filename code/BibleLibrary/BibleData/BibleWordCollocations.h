@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace BIBLE_DATA
+{
+    /// @todo   Get rid of forward declaration?
+    class BibleTranslation;
+
+    /// Finds collocates of words (other words that appear near a word more often than expected by chance),
+    /// such as "grace" appearing with "peace" and "mercy".
+    ///
+    /// Words are considered to appear together if they're in the same verse or, optionally, within a window
+    /// of a few verses from each other.  Counting only visits the verses near a word (found from the word's postings)
+    /// using a forward index of the distinct words in each verse, so even very common words are fast.
+    ///
+    /// The forward index can be built on first use (see BuildOnFirstUse()) so that programs only pay for it
+    /// if collocates are actually requested.  It's only built once, even if first used by multiple threads at once.
+    class BibleWordCollocations
+    {
+    public:
+        /// The different ways to score how strongly words are associated.
+        enum class ScoreType
+        {
+            /// Pointwise mutual information, which is how much more often (on a log2 scale) words appear together
+            /// than expected.  Favors rarer, more distinctive words.
+            POINTWISE_MUTUAL_INFORMATION,
+            /// Dunning's log-likelihood ratio, which is how unlikely it is for words to appear together as often
+            /// as they do by chance.  Favors words that are both strongly associated and frequent.
+            LOG_LIKELIHOOD_RATIO,
+        };
+
+        /// A word appearing near another word.
+        struct Collocate
+        {
+            /// The index of the word in the word index's lexicon.
+            std::size_t WordIndex = 0;
+            /// The word, as stored in the word index's lexicon.
+            std::string_view Word = "";
+            /// The number of verses near the other word that contain this word.
+            std::size_t CooccurrenceCount = 0;
+            /// The score for how strongly the words are associated.  Higher scores are more strongly associated.
+            double Score = 0.0;
+        };
+
+        /// A forward index of the distinct words in each verse.
+        struct VerseWords
+        {
+            /// The offset into VerseWordIndices of the first word for each verse, in the same order as
+            /// BibleTranslation::VerseCharacterRanges.  An extra offset at the end holds the total number of words.
+            std::vector<std::uint32_t> VerseWordOffsets = {};
+            /// The indices (in the word index's lexicon) of the distinct words in each verse.
+            std::vector<std::uint32_t> VerseWordIndices = {};
+        };
+
+        static BibleWordCollocations Build(const BibleTranslation* bible_translation);
+        static BibleWordCollocations BuildOnFirstUse(const BibleTranslation* bible_translation);
+
+        const VerseWords& GetVerseWords() const;
+        std::size_t SizeInBytes() const;
+
+        std::vector<Collocate> GetCollocates(
+            const std::size_t word_index,
+            const std::size_t verse_window_size,
+            const ScoreType score_type,
+            const std::size_t max_collocate_count) const;
+        std::vector<std::vector<Collocate>> GetCollocatesForAllWords(
+            const std::size_t verse_window_size,
+            const ScoreType score_type,
+            const std::size_t max_collocate_count,
+            const unsigned int thread_count) const;
+
+        /// The Bible translation this corresponds to.
+        const BibleTranslation* Bible = nullptr;
+
+    private:
+        /// A forward index that is only built on first use (see GetVerseWords()).
+        struct LazyVerseWords
+        {
+            /// Ensures the forward index is only built once, even if first used by multiple threads at once.
+            std::once_flag BuildOnce = {};
+            /// True once Words has been built.
+            std::atomic<bool> Built = false;
+            /// The forward index; empty until built.
+            VerseWords Words = {};
+        };
+
+        /// Buffers for counting co-occurrences, which can be reused across words to avoid allocations.
+        struct CountingBuffers
+        {
+            /// The number of verses near the current word containing each word in the lexicon.
+            std::vector<std::uint32_t> CooccurrenceCountsByWordIndex = {};
+            /// The indices of words with non-zero counts, so that only those need to be visited or reset.
+            std::vector<std::uint32_t> CountedWordIndices = {};
+        };
+
+        std::vector<Collocate> GetCollocates(
+            const std::size_t word_index,
+            const std::size_t verse_window_size,
+            const ScoreType score_type,
+            const std::size_t max_collocate_count,
+            CountingBuffers& counting_buffers) const;
+        static double ComputeScore(
+            const ScoreType score_type,
+            const double cooccurrence_count,
+            const double window_verse_count,
+            const double collocate_verse_count,
+            const double total_verse_count);
+        static VerseWords BuildVerseWords(const BibleTranslation* bible_translation);
+
+        /// The forward index, which is shared so that copies of collocations only build it once.
+        /// Null if not created for any translation.
+        std::shared_ptr<LazyVerseWords> LazyWords = nullptr;
+    };
+}
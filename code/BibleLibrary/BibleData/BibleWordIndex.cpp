@@ -1,4703 +1,347 @@
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
 #include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <ranges>
+#include <thread>
+#include <stmr/stmr.h>
 #include "BibleData/BibleAuthor.h"
 #include "BibleData/BibleBookGenre.h"
 #include "BibleData/BibleTestament.h"
 #include "BibleData/BibleTranslation.h"
+#include "BibleData/BibleVerseBitmap.h"
 #include "BibleData/BibleWordIndex.h"
+#include "BibleData/RootWordMap.h"
 
 namespace BIBLE_DATA
 {
-    std::unordered_map<std::string, std::string> BibleWordIndex::RootWordsByOriginalWord = 
+    constinit const PerfectHashStringMap BibleWordIndex::RootWordsByOriginalWord(
+        ROOT_WORD_MAP_ENTRIES,
+        ROOT_WORD_MAP_SEEDS_BY_BUCKET,
+        ROOT_WORD_MAP_ENTRY_INDICES_BY_SLOT);
+
+    constinit const std::array<BibleWordIndex::BookAttributes, BibleWordIndex::BOOK_TABLE_SIZE> BibleWordIndex::ATTRIBUTES_BY_BOOK = []()
+    {
+        std::array<BookAttributes, BOOK_TABLE_SIZE> attributes_by_book = {};
+        for (std::size_t book = 0; book < BOOK_TABLE_SIZE; ++book)
+        {
+            BibleBook::Id book_id = static_cast<BibleBook::Id>(book);
+            attributes_by_book[book] = BookAttributes
+            {
+                .Author = BibleAuthor::GetForBook(book_id),
+                .Genre = BibleBookGenre::GetForBook(book_id),
+                .Testament = BibleTestament::GetForBook(book_id),
+            };
+        }
+        return attributes_by_book;
+    }();
+
+    /// Splits text into words the same way as done for indexing, calling the provided function for each word.
+    /// Words are runs of letters and digits, with any other characters separating words.
+    /// @param[in]  text - The text to split into words.
+    /// @param[in]  include_unterminated_final_word - True if a final word not followed by any
+    ///     non-word character should be included.  Verses have always been indexed without such
+    ///     a word, so this should be false for verses to match the index.
+    /// @param[in]  process_word - The function to call for each word, in order, with the offset into
+    ///     the text of the word's first character and the word itself.
+    template <typename WordProcessor>
+    void BibleWordIndex::ForEachWord(
+        const std::string_view text,
+        const bool include_unterminated_final_word,
+        const WordProcessor& process_word)
     {
-        { "aaronites", "aaron" },
-        { "abased", "abase" },
-        { "abasing", "abase" },
-        { "abhorred", "abhor" },
-        { "abhorrest", "abhor" },
-        { "abhorreth", "abhor" },
-        { "abhorring", "abhor" },
-        { "abideth", "abide" },
-        { "abiding", "abide" },
-        { "abiezrites", "abiezrite" },
-        { "abodest", "abode" },
-        { "abolished", "abolish" },
-        { "abominable", "abominate" },
-        { "abominably", "abominate" },
-        { "abomination", "abominate" },
-        { "abominations", "abominate" },
-        { "abounded", "abound" },
-        { "aboundeth", "abound" },
-        { "abounding", "abound" },
-        { "absence", "absent" },
-        { "abstinence", "abstain" },
-        { "abundance", "abundant" },
-        { "abundantly", "abundant" },
-        { "abused", "abuse" },
-        { "abusers", "abuse" },
-        { "abusing", "abuse" },
-        { "acceptable", "accept" },
-        { "acceptably", "accept" },
-        { "acceptance", "accept" },
-        { "acceptation", "accept" },
-        { "accepted", "accept" },
-        { "acceptest", "accept" },
-        { "accepteth", "accept" },
-        { "accepting", "accept" },
-        { "accompanied", "accompany" },
-        { "accompanying", "accompany" },
-        { "accomplished", "accomplish" },
-        { "accomplishing", "accomplish" },
-        { "accomplishment", "accomplish" },
-        { "according", "accord" },
-        { "accordingly", "accord" },
-        { "accounted", "account" },
-        { "accounting", "account" },
-        { "accounts", "account" },
-        { "accusation", "accuse" },
-        { "accused", "accuse" },
-        { "accuser", "accuse" },
-        { "accusers", "accuse" },
-        { "accuseth", "accuse" },
-        { "accusing", "accuse" },
-        { "acknowledged", "acknowledge" },
-        { "acknowledgement", "acknowledge" },
-        { "acknowledgeth", "acknowledge" },
-        { "acknowledging", "acknowledge" },
-        { "acquaintance", "acquaint" },
-        { "acquainted", "acquaint" },
-        { "acquainting", "acquaint" },
-        { "acres", "acre" },
-        { "acts", "act" },
-        { "added", "add" },
-        { "addeth", "add" },
-        { "addition", "add" },
-        { "additions", "add" },
-        { "adders", "adder" },
-        { "adjured", "adjure" },
-        { "administered", "administer" },
-        { "administration", "administer" },
-        { "administrations", "administer" },
-        { "admiration", "admire" },
-        { "admired", "admire" },
-        { "admonished", "admonish" },
-        { "admonishing", "admonish" },
-        { "admonition", "admonish" },
-        { "adorned", "adorn" },
-        { "adorneth", "adorn" },
-        { "adorning", "adorn" },
-        { "adullamite", "adullam" },
-        { "adulterer", "adultery" },
-        { "adulterers", "adultery" },
-        { "adulteress", "adultery" },
-        { "adulteresses", "adultery" },
-        { "adulteries", "adultery" },
-        { "adulterous", "adultery" },
-        { "advantaged", "advantage" },
-        { "advantageth", "advantage" },
-        { "adventured", "adventure" },
-        { "adversaries", "adversary" },
-        { "adversities", "adversity" },
-        { "advise", "advice" },
-        { "advised", "advice" },
-        { "advisement", "advice" },
-        { "affected", "affect" },
-        { "affecteth", "affect" },
-        { "affectionately", "affection" },
-        { "affectioned", "affection" },
-        { "affections", "affection" },
-        { "affirmed", "affirm" },
-        { "afflicted", "afflict" },
-        { "afflictest", "afflict" },
-        { "affliction", "afflict" },
-        { "afflictions", "afflict" },
-        { "affrighted", "affright" },
-        { "afterwards", "afterward" },
-        { "agagite", "agag" },
-        { "agates", "agate" },
-        { "aged", "age" },
-        { "ages", "age" },
-        { "agreed", "agree" },
-        { "agreement", "agree" },
-        { "ahiramites", "ahiram" },
-        { "alexandrians", "alexandria" },
-        { "alienate", "alien" },
-        { "alienated", "alien" },
-        { "aliens", "alien" },
-        { "allowance", "allow" },
-        { "allowed", "allow" },
-        { "alloweth", "allow" },
-        { "almonds", "almond" },
-        { "altars", "altar" },
-        { "altered", "alter" },
-        { "altereth", "alter" },
-        { "amalekite", "amalek" },
-        { "amalekites", "amalek" },
-        { "amazed", "amaze" },
-        { "amazement", "amaze" },
-        { "ambassadors", "ambassador" },
-        { "ambushes", "ambush" },
-        { "ambushment", "ambush" },
-        { "ambushments", "ambush" },
-        { "amends", "amend" },
-        { "ammonite", "ammon" },
-        { "ammonites", "ammon" },
-        { "ammonitess", "ammon" },
-        { "amongst", "among" },
-        { "amorites", "amorite" },
-        { "amramites", "amram" },
-        { "anakims", "anak" },
-        { "anchors", "anchor" },
-        { "ancients", "ancient" },
-        { "angels", "angel" },
-        { "angered", "anger" },
-        { "angry", "anger" },
-        { "ankles", "ankle" },
-        { "anointed", "anoint" },
-        { "anointedst", "anoint" },
-        { "anointest", "anoint" },
-        { "anointing", "anoint" },
-        { "answerable", "answer" },
-        { "answered", "answer" },
-        { "answeredst", "answer" },
-        { "answerest", "answer" },
-        { "answereth", "answer" },
-        { "answering", "answer" },
-        { "answers", "answer" },
-        { "antichrists", "antichrist" },
-        { "ants", "ant" },
-        { "apostles", "apostle" },
-        { "apostleship", "apostle" },
-        { "apothecaries", "apothecary" },
-        { "apparelled", "apparel" },
-        { "appealed", "appeal" },
-        { "appearance", "appear" },
-        { "appearances", "appear" },
-        { "appeared", "appear" },
-        { "appeareth", "appear" },
-        { "appearing", "appear" },
-        { "appeased", "appease" },
-        { "appeaseth", "appease" },
-        { "appertained", "appertain" },
-        { "appertaineth", "appertain" },
-        { "apples", "apple" },
-        { "applied", "apply" },
-        { "appointed", "appoint" },
-        { "appointeth", "appoint" },
-        { "appointment", "appoint" },
-        { "apprehended", "apprehend" },
-        { "approached", "approach" },
-        { "approacheth", "approach" },
-        { "approaching", "approach" },
-        { "approved", "approve" },
-        { "approvest", "approve" },
-        { "approveth", "approve" },
-        { "approving", "approve" },
-        { "arabian", "arabia" },
-        { "arabians", "arabia" },
-        { "aramites", "aram" },
-        { "archers", "archer" },
-        { "arguing", "argue" },
-        { "arguments", "argue" },
-        { "ariseth", "arise" },
-        { "arising", "arise" },
-        { "aroerite", "aroer" },
-        { "arrayed", "array" },
-        { "arrows", "arrow" },
-        { "artificers", "artificer" },
-        { "arvadite", "arvad" },
-        { "ascended", "ascend" },
-        { "ascendeth", "ascend" },
-        { "ascending", "ascend" },
-        { "ascent", "ascend" },
-        { "ascribed", "ascribe" },
-        { "ashamed", "shame" },
-        { "ashbelites", "ashbel" },
-        { "ashdodites", "ashdodites" },
-        { "asherites", "asher" },
-        { "ashes", "ash" },
-        { "ashtarothite", "ashtaroth" },
-        { "ashurites", "ashur" },
-        { "asked", "ask" },
-        { "askest", "ask" },
-        { "asketh", "ask" },
-        { "asking", "ask" },
-        { "asleep", "sleep" },
-        { "asps", "asp" },
-        { "asrielites", "asriel" },
-        { "assaulted", "assault" },
-        { "assayed", "assay" },
-        { "assaying", "assay" },
-        { "assembled", "assemble" },
-        { "assemblies", "assemble" },
-        { "assembling", "assemble" },
-        { "assembly", "assemble" },
-        { "assented", "assent" },
-        { "asses", "ass" },
-        { "assurance", "assure" },
-        { "assured", "assure" },
-        { "assuredly", "assure" },
-        { "asswaged", "asswage" },
-        { "assyrian", "assyria" },
-        { "assyrians", "assyria" },
-        { "astonished", "astonish" },
-        { "astonishment", "astonish" },
-        { "astrologers", "astrologer" },
-        { "athenians", "athens" },
-        { "atonements", "atonement" },
-        { "attained", "attain" },
-        { "attendance", "attend" },
-        { "attended", "attend" },
-        { "attending", "attend" },
-        { "attentive", "attent" },
-        { "attentively", "attent" },
-        { "attired", "attire" },
-        { "authorities", "authority" },
-        { "avenged", "avenge" },
-        { "avenger", "avenge" },
-        { "avengeth", "avenge" },
-        { "avenging", "avenge" },
-        { "avoided", "avoid" },
-        { "avoiding", "avoid" },
-        { "awaked", "awake" },
-        { "awakest", "awake" },
-        { "awaketh", "awake" },
-        { "awaking", "awake" },
-        { "awoke", "awake" },
-        { "axes", "axe" },
-        { "babylonians", "babylon" },
-        { "babylonish", "babylon" },
-        { "backs", "back" },
-        { "backbiters", "backbite" },
-        { "backbiteth", "backbite" },
-        { "backbiting", "backbite" },
-        { "backbitings", "backbite" },
-        { "backslider", "backslide" },
-        { "backsliding", "backslide" },
-        { "backslidings", "backslide" },
-        { "badest", "bade" },
-        { "bags", "bag" },
-        { "baked", "bake" },
-        { "baker", "bake" },
-        { "bakers", "bake" },
-        { "baketh", "bake" },
-        { "balances", "balance" },
-        { "balancings", "balance" },
-        { "baldness", "bald" },
-        { "banded", "band" },
-        { "bands", "band" },
-        { "banished", "banish" },
-        { "banishment", "banish" },
-        { "banks", "bank" },
-        { "banners", "banner" },
-        { "banqueting", "banquet" },
-        { "banquetings", "banquet" },
-        { "baptism", "baptize" },
-        { "baptisms", "baptize" },
-        { "baptist", "baptize" },
-        { "baptized", "baptize" },
-        { "baptizest", "baptize" },
-        { "baptizeth", "baptize" },
-        { "baptizing", "baptize" },
-        { "barbarians", "barbarian" },
-        { "barbarous", "barbarian" },
-        { "barked", "bark" },
-        { "barns", "barn" },
-        { "barrels", "barrel" },
-        { "barrenness", "barren" },
-        { "bars", "bar" },
-        { "bases", "base" },
-        { "basest", "base" },
-        { "baskets", "basket" },
-        { "basons", "bason" },
-        { "bastards", "bastard" },
-        { "bats", "bat" },
-        { "bathe", "bath" },
-        { "bathed", "bath" },
-        { "baths", "bath" },
-        { "battered", "batter" },
-        { "battering", "batter" },
-        { "battles", "battle" },
-        { "battlements", "battlement" },
-        { "beams", "beam" },
-        { "beards", "beard" },
-        { "beasts", "beast" },
-        { "beaten", "beat" },
-        { "beatest", "beat" },
-        { "beateth", "beat" },
-        { "beating", "beat" },
-        { "beauties", "beauty" },
-        { "beautiful", "beauty" },
-        { "beautify", "beauty" },
-        { "becamest", "become" },
-        { "beckoned", "beckon" },
-        { "beckoning", "beckon" },
-        { "becometh", "become" },
-        { "beds", "bed" },
-        { "bees", "bee" },
-        { "befallen", "befall" },
-        { "befalleth", "befall" },
-        { "befell", "befall" },
-        { "beget", "begat" },
-        { "begettest", "begat" },
-        { "begetteth", "begat" },
-        { "beggar", "beg" },
-        { "beggarly", "beg" },
-        { "begged", "beg" },
-        { "begging", "beg" },
-        { "began", "begin" },
-        { "beginnest", "begin" },
-        { "beginning", "begin" },
-        { "beginnings", "begin" },
-        { "begotten", "begat" },
-        { "beguiled", "beguile" },
-        { "beguiling", "beguile" },
-        { "begun", "begin" },
-        { "behaved", "behave" },
-        { "behaveth", "behave" },
-        { "behaviour", "behave" },
-        { "beheld", "behold" },
-        { "beholdest", "behold" },
-        { "beholdeth", "behold" },
-        { "beholding", "behold" },
-        { "believe", "belief" },
-        { "believed", "belief" },
-        { "believers", "belief" },
-        { "believest", "belief" },
-        { "believeth", "belief" },
-        { "believing", "belief" },
-        { "bellows", "bellow" },
-        { "bells", "bell" },
-        { "bellies", "belly" },
-        { "belonged", "belong" },
-        { "belongest", "belong" },
-        { "belongeth", "belong" },
-        { "belonging", "belong" },
-        { "bemoaned", "bemoan" },
-        { "bemoaning", "bemoan" },
-        { "bendeth", "bend" },
-        { "bending", "bend" },
-        { "benefits", "benefit" },
-        { "benjamite", "benjamin" },
-        { "benjamites", "benjamin" },
-        { "bent", "bend" },
-        { "bereaved", "bereave" },
-        { "bereaveth", "bereave" },
-        { "beseeching", "beseech" },
-        { "besides", "beside" },
-        { "besieged", "besiege" },
-        { "bestowed", "bestow" },
-        { "betrayed", "betray" },
-        { "betrayers", "betray" },
-        { "betrayest", "betray" },
-        { "betrayeth", "betray" },
-        { "betrothed", "betroth" },
-        { "bettered", "better" },
-        { "bewailed", "bewail" },
-        { "bewaileth", "bewail" },
-        { "bewrayeth", "bewray" },
-        { "bidden", "bid" },
-        { "biddeth", "bid" },
-        { "bidding", "bid" },
-        { "bindeth", "bind" },
-        { "binding", "bind" },
-        { "birds", "bird" },
-        { "bishops", "bishop" },
-        { "biteth", "biteth" },
-        { "bitterly", "bitter" },
-        { "bitterness", "bitter" },
-        { "blacker", "black" },
-        { "blackish", "black" },
-        { "blackness", "black" },
-        { "blamed", "blame" },
-        { "blameless", "blame" },
-        { "blaspheme", "blasphemy" },
-        { "blasphemed", "blasphemy" },
-        { "blasphemer", "blasphemy" },
-        { "blasphemers", "blasphemy" },
-        { "blasphemest", "blasphemy" },
-        { "blasphemeth", "blasphemy" },
-        { "blasphemies", "blasphemy" },
-        { "blaspheming", "blasphemy" },
-        { "blasphemous", "blasphemy" },
-        { "blasphemously", "blasphemy" },
-        { "blasted", "blast" },
-        { "blasting", "blast" },
-        { "bleatings", "bleating" },
-        { "blemishes", "blemish" },
-        { "blessed", "bless" },
-        { "blessedness", "bless" },
-        { "blessest", "bless" },
-        { "blesseth", "bless" },
-        { "blessing", "bless" },
-        { "blessings", "bless" },
-        { "blinded", "blind" },
-        { "blindeth", "blind" },
-        { "blindfolded", "blind" },
-        { "blindness", "blind" },
-        { "bloodguiltiness", "blood" },
-        { "bloodthirsty", "blood" },
-        { "bloody", "blood" },
-        { "blossomed", "blossom" },
-        { "blossoms", "blossom" },
-        { "blotted", "blot" },
-        { "blotteth", "blot" },
-        { "blotting", "blot" },
-        { "bloweth", "blow" },
-        { "blowing", "blow" },
-        { "blown", "blow" },
-        { "blueness", "blue" },
-        { "boards", "board" },
-        { "boasted", "boast" },
-        { "boasters", "boast" },
-        { "boastest", "boast" },
-        { "boasteth", "boast" },
-        { "boasting", "boast" },
-        { "boastings", "boast" },
-        { "boats", "boat" },
-        { "bodies", "body" },
-        { "bodily", "body" },
-        { "boiled", "boil" },
-        { "boiling", "boil" },
-        { "boils", "boil" },
-        { "boldly", "bold" },
-        { "boldness", "bold" },
-        { "bolted", "bolt" },
-        { "bonds", "bond" },
-        { "bondmaids", "bondmaids" },
-        { "bondmen", "bondman" },
-        { "bondwomen", "bondwoman" },
-        { "bones", "bone" },
-        { "books", "book" },
-        { "booths", "booth" },
-        { "booties", "booty" },
-        { "borders", "border" },
-        { "borrowed", "borrow" },
-        { "borroweth", "borrow" },
-        { "bottles", "bottle" },
-        { "bottoms", "bottom" },
-        { "boughs", "bough" },
-        { "bounds", "bound" },
-        { "bountifully", "bountiful" },
-        { "bountifulness", "bountiful" },
-        { "bowls", "bowl" },
-        { "bows", "bow" },
-        { "boys", "boy" },
-        { "bracelets", "bracelet" },
-        { "brambles", "bramble" },
-        { "branches", "branch" },
-        { "brands", "brand" },
-        { "brawlers", "brawler" },
-        { "brayed", "bray" },
-        { "breaches", "breach" },
-        { "breaker", "break" },
-        { "breakest", "break" },
-        { "breaketh", "break" },
-        { "breaking", "break" },
-        { "breakings", "break" },
-        { "breasts", "breast" },
-        { "breastplates", "breastplate" },
-        { "breathe", "breath" },
-        { "breathed", "breath" },
-        { "breatheth", "breath" },
-        { "breathing", "breath" },
-        { "breeding", "breed" },
-        { "bribery", "bribe" },
-        { "brides", "bribe" },
-        { "bricks", "brick" },
-        { "bridles", "bridle" },
-        { "bridleth", "bridle" },
-        { "brigandines", "brigandine" },
-        { "brightness", "bright" },
-        { "bringers", "bring" },
-        { "bringest", "bring" },
-        { "bringeth", "bring" },
-        { "bringing", "bring" },
-        { "broader", "broad" },
-        { "brooks", "brook" },
-        { "broughtest", "brought" },
-        { "bruised", "bruise" },
-        { "bruises", "bruise" },
-        { "bruising", "bruise" },
-        { "brutish", "brute" },
-        { "buckets", "bucket" },
-        { "bucklers", "buckler" },
-        { "budded", "bud" },
-        { "buds", "bud" },
-        { "buffeted", "buffet" },
-        { "builded", "build" },
-        { "buildedst", "build" },
-        { "builder", "build" },
-        { "builders", "build" },
-        { "buildest", "build" },
-        { "buildeth", "build" },
-        { "building", "build" },
-        { "building", "build" },
-        { "built", "build" },
-        { "bulls", "bull" },
-        { "bullocks", "bullock" },
-        { "bulrushes", "bulrush" },
-        { "bunches", "bunch" },
-        { "bundles", "bundle" },
-        { "burdened", "burden" },
-        { "burdens", "burden" },
-        { "burdensome", "burden" },
-        { "burned", "burn" },
-        { "burneth", "burn" },
-        { "burning", "burn" },
-        { "burnings", "burn" },
-        { "burnt", "burn" },
-        { "bursting", "burst" },
-        { "burying", "bury" },
-        { "bushes", "bush" },
-        { "busybodies", "busybody" },
-        { "butlers", "butler" },
-        { "buyer", "buy" },
-        { "buyest", "buy" },
-        { "buyeth", "buy" },
-        { "cakes", "cake" },
-        { "caldrons", "caldron" },
-        { "called", "call" },
-        { "calledst", "call" },
-        { "callest", "call" },
-        { "calleth", "call" },
-        { "calling", "call" },
-        { "calved", "calve" },
-        { "calves", "calve" },
-        { "calveth", "calve" },
-        { "camest", "came" },
-        { "camels", "camel" },
-        { "camped", "camp" },
-        { "camps", "camp" },
-        { "canaanite", "canaan" },
-        { "canaanites", "canaanite" },
-        { "canaanitess", "canaanites" },
-        { "candles", "candle" },
-        { "candlesticks", "candlestick" },
-        { "cankered", "canker" },
-        { "caphtorims", "caphtorim" },
-        { "capitals", "capital" },
-        { "captains", "captain" },
-        { "captivated", "captivate" },
-        { "captives", "captive" },
-        { "caravans", "caravan" },
-        { "carbuncles", "carbuncle" },
-        { "carcases", "carcas" },
-        { "carcass", "carcas" },
-        { "carcasses", "carcass" },
-        { "cared", "car" },
-        { "cared", "care" },
-        { "cares", "car" },
-        { "cares", "care" },
-        { "carest", "care" },
-        { "carest", "cart" },
-        { "caring", "car" },
-        { "caring", "car" },
-        { "caring", "care" },
-        { "caring", "cart" },
-        { "carmelite", "carmel" },
-        { "carousings", "carousing" },
-        { "carpenters", "carpenter" },
-        { "carriages", "carriage" },
-        { "carrying", "carry" },
-        { "carts", "cart" },
-        { "carvings", "carving" },
-        { "cases", "case" },
-        { "castest", "casts" },
-        { "casting", "cast" },
-        { "casting", "cast" },
-        { "casting", "casts" },
-        { "castles", "castle" },
-        { "casts", "cast" },
-        { "catches", "catch" },
-        { "caterpillers", "caterpiller" },
-        { "cauls", "caul" },
-        { "caused", "cause" },
-        { "causes", "cause" },
-        { "causest", "cause" },
-        { "causing", "cause" },
-        { "caves", "cave" },
-        { "ceased", "cease" },
-        { "ceases", "cease" },
-        { "ceasing", "cease" },
-        { "cedars", "cedar" },
-        { "ceilings", "ceiling" },
-        { "cellars", "cellar" },
-        { "cells", "cell" },
-        { "censers", "censer" },
-        { "centurions", "centurion" },
-        { "chains", "chain" },
-        { "chaldeans", "chaldean" },
-        { "chambering", "chamber" },
-        { "chambering", "chambers" },
-        { "chamberlains", "chamberlain" },
-        { "chambers", "chamber" },
-        { "changed", "change" },
-        { "changes", "change" },
-        { "changest", "change" },
-        { "changing", "change" },
-        { "channels", "channel" },
-        { "chapiters", "chapiter" },
-        { "charged", "charge" },
-        { "chargers", "charger" },
-        { "charges", "charge" },
-        { "chargest", "charge" },
-        { "charging", "charge" },
-        { "chariots", "chariot" },
-        { "charmed", "charm" },
-        { "charmers", "charmer" },
-        { "charming", "charm" },
-        { "chased", "chase" },
-        { "chases", "chase" },
-        { "chasing", "chase" },
-        { "chastened", "chasten" },
-        { "chastenest", "chastens" },
-        { "chastening", "chasten" },
-        { "chastening", "chasten" },
-        { "chastening", "chastens" },
-        { "chastens", "chasten" },
-        { "chastised", "chastise" },
-        { "chattering", "chatter" },
-        { "checked", "check" },
-        { "cheeks", "cheek" },
-        { "cheered", "cheer" },
-        { "cheers", "cheer" },
-        { "cheeses", "cheese" },
-        { "cherished", "cherish" },
-        { "cherishes", "cherish" },
-        { "cherubims", "cherubim" },
-        { "cherubs", "cherub" },
-        { "chests", "chest" },
-        { "chewed", "chew" },
-        { "chews", "chew" },
-        { "chiding", "chide" },
-        { "chiefest", "chiefs" },
-        { "chiefing", "chief" },
-        { "chiefs", "chief" },
-        { "chieftains", "chieftain" },
-        { "chirped", "chirp" },
-        { "chiseled", "chisel" },
-        { "chiseling", "chisel" },
-        { "choicest", "choice" },
-        { "choked", "choke" },
-        { "chooses", "choose" },
-        { "choosest", "choose" },
-        { "choosing", "choose" },
-        { "christians", "christian" },
-        { "christs", "christ" },
-        { "churches", "church" },
-        { "chuzas", "chuza" },
-        { "circled", "circle" },
-        { "circuits", "circuit" },
-        { "circumcised", "circumcise" },
-        { "circumcising", "circumcise" },
-        { "cisterns", "cistern" },
-        { "citizens", "citizen" },
-        { "claimed", "claim" },
-        { "claps", "clap" },
-        { "clasps", "clasp" },
-        { "cleansed", "cleanse" },
-        { "cleanses", "cleanse" },
-        { "cleansing", "cleanse" },
-        { "cleared", "clear" },
-        { "clearing", "clear" },
-        { "clearing", "clears" },
-        { "clears", "clear" },
-        { "cleaved", "cleave" },
-        { "cleaves", "cleave" },
-        { "clefts", "cleft" },
-        { "clifts", "clift" },
-        { "climbed", "climb" },
-        { "climbs", "climb" },
-        { "clings", "cling" },
-        { "cloaks", "cloak" },
-        { "closed", "close" },
-        { "closes", "close" },
-        { "closest", "close" },
-        { "closets", "closet" },
-        { "clothed", "cloth" },
-        { "clothed", "clothe" },
-        { "clothes", "cloth" },
-        { "clothes", "clothe" },
-        { "clothest", "clothe" },
-        { "clothest", "cloths" },
-        { "clothing", "cloth" },
-        { "clothing", "cloth" },
-        { "clothing", "clothe" },
-        { "clothing", "cloths" },
-        { "cloths", "cloth" },
-        { "clouds", "cloud" },
-        { "clubs", "club" },
-        { "clusters", "cluster" },
-        { "coals", "coal" },
-        { "coasts", "coast" },
-        { "coated", "coat" },
-        { "coats", "coat" },
-        { "cockatrices", "cockatrice" },
-        { "collapsed", "collapse" },
-        { "collars", "collar" },
-        { "collected", "collect" },
-        { "collections", "collection" },
-        { "collectors", "collector" },
-        { "colored", "color" },
-        { "colors", "color" },
-        { "coloured", "colour" },
-        { "colours", "colour" },
-        { "colts", "colt" },
-        { "comes", "come" },
-        { "comest", "come" },
-        { "comforted", "comfort" },
-        { "comforters", "comforter" },
-        { "comforts", "comfort" },
-        { "coming", "come" },
-        { "comings", "coming" },
-        { "commanded", "command" },
-        { "commandest", "commands" },
-        { "commanding", "command" },
-        { "commanding", "command" },
-        { "commanding", "commands" },
-        { "commandments", "commandment" },
-        { "commands", "command" },
-        { "commended", "commend" },
-        { "commending", "commend" },
-        { "commending", "commends" },
-        { "commends", "commend" },
-        { "commissions", "commission" },
-        { "commits", "commit" },
-        { "commotions", "commotion" },
-        { "communed", "commune" },
-        { "communicated", "communicate" },
-        { "communications", "communication" },
-        { "communing", "commune" },
-        { "compacted", "compact" },
-        { "companions", "companion" },
-        { "compared", "compare" },
-        { "comparing", "compare" },
-        { "compassed", "compass" },
-        { "compasses", "compass" },
-        { "compassing", "compass" },
-        { "compassing", "compass" },
-        { "compassions", "compassion" },
-        { "compels", "compel" },
-        { "complained", "complain" },
-        { "complaining", "complain" },
-        { "complaining", "complaint" },
-        { "complaints", "complaint" },
-        { "completed", "complete" },
-        { "compounded", "compound" },
-        { "compounds", "compound" },
-        { "comprehended", "comprehend" },
-        { "concealed", "conceal" },
-        { "conceals", "conceal" },
-        { "conceited", "conceit" },
-        { "conceits", "conceit" },
-        { "conceived", "conceive" },
-        { "conceiving", "conceive" },
-        { "concerned", "concern" },
-        { "concerning", "concern" },
-        { "concerning", "concerns" },
-        { "concerns", "concern" },
-        { "concluded", "conclude" },
-        { "concluding", "conclude" },
-        { "concubines", "concubine" },
-        { "condemned", "condemn" },
-        { "condemnest", "condemns" },
-        { "condemning", "condemn" },
-        { "condemning", "condemn" },
-        { "condemning", "condemns" },
-        { "condemns", "condemn" },
-        { "conditions", "condition" },
-        { "conducted", "conduct" },
-        { "conducting", "conduct" },
-        { "confections", "confection" },
-        { "confessed", "confess" },
-        { "confesses", "confess" },
-        { "confessing", "confess" },
-        { "confidences", "confidence" },
-        { "confirmed", "confirm" },
-        { "confirming", "confirm" },
-        { "confirming", "confirms" },
-        { "confirms", "confirm" },
-        { "confounded", "confound" },
-        { "confused", "confuse" },
-        { "confusing", "confuse" },
-        { "congregations", "congregation" },
-        { "conquering", "conquer" },
-        { "consciences", "conscience" },
-        { "consecrated", "consecrate" },
-        { "consecrations", "consecration" },
-        { "consented", "consent" },
-        { "consenting", "consent" },
-        { "considered", "consider" },
-        { "considerest", "considers" },
-        { "considering", "consider" },
-        { "considering", "consider" },
-        { "considering", "considers" },
-        { "considers", "consider" },
-        { "consolations", "consolation" },
-        { "consoled", "console" },
-        { "consoling", "console" },
-        { "conspired", "conspire" },
-        { "constrained", "constrain" },
-        { "constrains", "constrain" },
-        { "consulted", "consult" },
-        { "consumed", "consume" },
-        { "consumes", "consume" },
-        { "consuming", "consume" },
-        { "contained", "contain" },
-        { "containers", "container" },
-        { "containing", "contain" },
-        { "containing", "contains" },
-        { "contains", "contain" },
-        { "contemned", "contemn" },
-        { "contended", "contend" },
-        { "contendest", "contends" },
-        { "contending", "contend" },
-        { "contending", "contend" },
-        { "contending", "contends" },
-        { "contends", "contend" },
-        { "contentions", "contention" },
-        { "continued", "continue" },
-        { "continues", "continue" },
-        { "continuing", "continue" },
-        { "contradicted", "contradict" },
-        { "contradicting", "contradict" },
-        { "controls", "control" },
-        { "converted", "convert" },
-        { "converting", "convert" },
-        { "converting", "converts" },
-        { "converts", "convert" },
-        { "conveyed", "convey" },
-        { "convicted", "convict" },
-        { "convicts", "convict" },
-        { "convinced", "convince" },
-        { "convocations", "convocation" },
-        { "cooks", "cook" },
-        { "coping", "copy" },
-        { "cord", "cor" },
-        { "cords", "cord" },
-        { "corners", "corner" },
-        { "cornets", "cornet" },
-        { "corpses", "corpse" },
-        { "corrected", "correct" },
-        { "correcting", "correct" },
-        { "correcting", "corrects" },
-        { "corrects", "correct" },
-        { "corrupted", "corrupt" },
-        { "corrupting", "corrupt" },
-        { "cors", "cor" },
-        { "costs", "cost" },
-        { "cotes", "cot" },
-        { "cots", "cot" },
-        { "cottages", "cottage" },
-        { "couched", "couch" },
-        { "couches", "couch" },
-        { "couching", "couch" },
-        { "couldest", "couldn" },
-        { "coulding", "could" },
-        { "coulters", "coulter" },
-        { "councils", "council" },
-        { "counseled", "counsel" },
-        { "counsellors", "counsellor" },
-        { "counselors", "counselor" },
-        { "counsels", "counsel" },
-        { "counted", "count" },
-        { "countenances", "countenance" },
-        { "counting", "count" },
-        { "counting", "counts" },
-        { "counts", "count" },
-        { "coupled", "couple" },
-        { "coupling", "couple" },
-        { "couplings", "coupling" },
-        { "courses", "course" },
-        { "courts", "court" },
-        { "cousins", "cousin" },
-        { "covenanted", "covenant" },
-        { "covenants", "covenant" },
-        { "covered", "cover" },
-        { "coverest", "covers" },
-        { "coverest", "covert" },
-        { "covering", "cover" },
-        { "covering", "cover" },
-        { "covering", "covers" },
-        { "covering", "covert" },
-        { "coverings", "covering" },
-        { "covers", "cover" },
-        { "coverts", "covert" },
-        { "coveted", "covet" },
-        { "coveting", "covet" },
-        { "covetings", "coveting" },
-        { "cows", "cow" },
-        { "craved", "crave" },
-        { "craving", "crave" },
-        { "cravings", "craving" },
-        { "created", "create" },
-        { "creates", "create" },
-        { "creatures", "creature" },
-        { "credited", "credit" },
-        { "creditors", "creditor" },
-        { "creeks", "creek" },
-        { "creeping", "creep" },
-        { "creeping", "creeps" },
-        { "creeps", "creep" },
-        { "cretes", "crete" },
-        { "criest", "crib" },
-        { "crimes", "crime" },
-        { "criminals", "criminal" },
-        { "crippled", "cripple" },
-        { "crooked", "crook" },
-        { "crops", "crop" },
-        { "crossed", "cross" },
-        { "crossing", "cross" },
-        { "crouches", "crouch" },
-        { "crowd", "crow" },
-        { "crowed", "crow" },
-        { "crowned", "crown" },
-        { "crownest", "crowns" },
-        { "crowning", "crown" },
-        { "crowning", "crown" },
-        { "crowning", "crowns" },
-        { "crowns", "crown" },
-        { "crows", "crow" },
-        { "crucifying", "crucify" },
-        { "crushed", "crush" },
-        { "crushes", "crush" },
-        { "crying", "cry" },
-        { "cubits", "cubit" },
-        { "cubs", "cub" },
-        { "cupbearers", "cupbearer" },
-        { "cups", "cup" },
-        { "cured", "cure" },
-        { "cures", "cure" },
-        { "cursed", "curse" },
-        { "curses", "curse" },
-        { "cursest", "curse" },
-        { "cursing", "curse" },
-        { "cursings", "cursing" },
-        { "curtains", "curtain" },
-        { "cushions", "cushion" },
-        { "cushite", "cush" },
-        { "cushites", "cushite" },
-        { "customs", "custom" },
-        { "cuts", "cut" },
-        { "cuttings", "cutting" },
-        { "cymbals", "cymbal" },
-        { "cyrenians", "cyrenian" },
-        { "damsels", "damsel" },
-        { "danced", "dance" },
-        { "dances", "dance" },
-        { "dancing", "dance" },
-        { "dared", "dare" },
-        { "dares", "dare" },
-        { "daring", "dara" },
-        { "daring", "dare" },
-        { "daring", "dark" },
-        { "daring", "dart" },
-        { "darkened", "darken" },
-        { "darkens", "darken" },
-        { "darking", "dark" },
-        { "darting", "dart" },
-        { "darting", "darts" },
-        { "darts", "dart" },
-        { "dashed", "dash" },
-        { "dashes", "dash" },
-        { "daubed", "daub" },
-        { "daubing", "daub" },
-        { "daughters", "daughter" },
-        { "dawning", "dawn" },
-        { "dawning", "dawns" },
-        { "dawns", "dawn" },
-        { "days", "day" },
-        { "deacons", "deacon" },
-        { "dealers", "dealer" },
-        { "dealest", "deals" },
-        { "dealest", "dealt" },
-        { "dealing", "deal" },
-        { "dealing", "deal" },
-        { "dealing", "deals" },
-        { "dealing", "dealt" },
-        { "dealings", "dealing" },
-        { "deals", "deal" },
-        { "deaths", "death" },
-        { "debates", "debate" },
-        { "debtors", "debtor" },
-        { "debts", "debt" },
-        { "decayed", "decay" },
-        { "decaying", "decay" },
-        { "deceased", "decease" },
-        { "deceits", "deceit" },
-        { "deceived", "deceive" },
-        { "deceivers", "deceiver" },
-        { "deceives", "deceive" },
-        { "deceiving", "deceive" },
-        { "deceivings", "deceiving" },
-        { "decided", "decide" },
-        { "decked", "deck" },
-        { "deckest", "decks" },
-        { "decking", "deck" },
-        { "decks", "deck" },
-        { "declared", "declare" },
-        { "declares", "declare" },
-        { "declaring", "declare" },
-        { "declined", "decline" },
-        { "declines", "decline" },
-        { "decorated", "decorate" },
-        { "decreased", "decrease" },
-        { "decreed", "decree" },
-        { "decrees", "decree" },
-        { "dedicated", "dedicate" },
-        { "dedicating", "dedicate" },
-        { "deeds", "deed" },
-        { "deeps", "deep" },
-        { "defeated", "defeat" },
-        { "defenced", "defence" },
-        { "defended", "defend" },
-        { "defending", "defend" },
-        { "defending", "defend" },
-        { "defenses", "defense" },
-        { "defiled", "defile" },
-        { "defiles", "defile" },
-        { "defrauded", "defraud" },
-        { "degrees", "degree" },
-        { "delayed", "delay" },
-        { "delaying", "delay" },
-        { "delaying", "delays" },
-        { "delays", "delay" },
-        { "delicates", "delicate" },
-        { "delighted", "delight" },
-        { "delightest", "delights" },
-        { "delighting", "delight" },
-        { "delights", "delight" },
-        { "deliverances", "deliverance" },
-        { "delivered", "deliver" },
-        { "deliverest", "delivers" },
-        { "deliverest", "delivery" },
-        { "delivering", "deliver" },
-        { "delivering", "deliver" },
-        { "delivering", "delivers" },
-        { "delivering", "delivery" },
-        { "delivers", "deliver" },
-        { "deluding", "delude" },
-        { "delusions", "delusion" },
-        { "demanded", "demand" },
-        { "demands", "demand" },
-        { "demons", "demon" },
-        { "denounced", "denounce" },
-        { "denounces", "denounce" },
-        { "dens", "den" },
-        { "denying", "deny" },
-        { "departed", "depart" },
-        { "departing", "depart" },
-        { "departing", "departs" },
-        { "departs", "depart" },
-        { "depended", "depend" },
-        { "deposited", "deposit" },
-        { "deprived", "deprive" },
-        { "depths", "depth" },
-        { "derided", "deride" },
-        { "descendants", "descendant" },
-        { "descended", "descend" },
-        { "descending", "descend" },
-        { "described", "describe" },
-        { "deserted", "desert" },
-        { "deserting", "desert" },
-        { "deserting", "deserts" },
-        { "deserts", "desert" },
-        { "deserves", "deserve" },
-        { "deserving", "deserve" },
-        { "desired", "desire" },
-        { "desires", "desire" },
-        { "desirest", "desire" },
-        { "desiring", "desire" },
-        { "desolations", "desolation" },
-        { "despaired", "despair" },
-        { "despised", "despise" },
-        { "despises", "despise" },
-        { "despisest", "despise" },
-        { "despising", "despise" },
-        { "despoiled", "despoil" },
-        { "destroyed", "destroy" },
-        { "destroyers", "destroyer" },
-        { "destroyest", "destroys" },
-        { "destroying", "destroy" },
-        { "destroying", "destroy" },
-        { "destroying", "destroys" },
-        { "destroys", "destroy" },
-        { "destructions", "destruction" },
-        { "detained", "detain" },
-        { "detected", "detect" },
-        { "determined", "determine" },
-        { "detested", "detest" },
-        { "detests", "detest" },
-        { "devices", "device" },
-        { "devils", "devil" },
-        { "devised", "devise" },
-        { "devises", "devise" },
-        { "devising", "devise" },
-        { "devoted", "devote" },
-        { "devotions", "devotion" },
-        { "devoured", "devour" },
-        { "devourest", "devours" },
-        { "devouring", "devour" },
-        { "devouring", "devour" },
-        { "devouring", "devours" },
-        { "devours", "devour" },
-        { "did", "di" },
-        { "didrachmas", "didrachma" },
-        { "died", "di" },
-        { "died", "die" },
-        { "dies", "di" },
-        { "dies", "die" },
-        { "diest", "did" },
-        { "diest", "die" },
-        { "diest", "dig" },
-        { "diest", "dim" },
-        { "diest", "dip" },
-        { "differences", "difference" },
-        { "differing", "differ" },
-        { "differing", "differs" },
-        { "differs", "differ" },
-        { "digs", "dig" },
-        { "diing", "di" },
-        { "diminished", "diminish" },
-        { "diminishing", "diminish" },
-        { "dined", "dine" },
-        { "dips", "dip" },
-        { "directed", "direct" },
-        { "directing", "direct" },
-        { "directing", "directs" },
-        { "directions", "direction" },
-        { "directs", "direct" },
-        { "disallowed", "disallow" },
-        { "disappointed", "disappoint" },
-        { "discerned", "discern" },
-        { "discerning", "discern" },
-        { "discerning", "discerns" },
-        { "discerns", "discern" },
-        { "discharged", "discharge" },
-        { "disciples", "disciple" },
-        { "disciplines", "discipline" },
-        { "disclosed", "disclose" },
-        { "discloses", "disclose" },
-        { "discouraged", "discourage" },
-        { "discovered", "discover" },
-        { "discovering", "discover" },
-        { "diseased", "disease" },
-        { "diseases", "disease" },
-        { "disfigured", "disfigure" },
-        { "disgraced", "disgrace" },
-        { "disguised", "disguise" },
-        { "disguises", "disguise" },
-        { "dishes", "dish" },
-        { "dishoning", "dishon" },
-        { "dishonored", "dishonor" },
-        { "dishonors", "dishonor" },
-        { "dishonouring", "dishonour" },
-        { "dismayed", "dismay" },
-        { "dismaying", "dismay" },
-        { "dismissed", "dismiss" },
-        { "disobeyed", "disobey" },
-        { "disobeys", "disobey" },
-        { "dispatched", "dispatch" },
-        { "dispersed", "disperse" },
-        { "dispersions", "dispersion" },
-        { "displayed", "display" },
-        { "displays", "display" },
-        { "displeased", "displease" },
-        { "dispossessed", "dispossess" },
-        { "dispossessing", "dispossess" },
-        { "disputations", "disputation" },
-        { "disputed", "dispute" },
-        { "disputes", "dispute" },
-        { "disputing", "dispute" },
-        { "disputings", "disputing" },
-        { "disquieted", "disquiet" },
-        { "dissolved", "dissolve" },
-        { "dissolvest", "dissolve" },
-        { "dissolving", "dissolve" },
-        { "distressed", "distress" },
-        { "distresses", "distress" },
-        { "distributed", "distribute" },
-        { "distributes", "distribute" },
-        { "distributing", "distribute" },
-        { "disturbances", "disturbance" },
-        { "disturbed", "disturb" },
-        { "ditches", "ditch" },
-        { "divided", "divide" },
-        { "divides", "divide" },
-        { "dividing", "divide" },
-        { "divinations", "divination" },
-        { "divined", "divine" },
-        { "diviners", "diviner" },
-        { "divines", "divine" },
-        { "divining", "divine" },
-        { "divisions", "division" },
-        { "divorced", "divorce" },
-        { "divorces", "divorce" },
-        { "doctors", "doctor" },
-        { "doctrines", "doctrine" },
-        { "doers", "doer" },
-        { "does", "do" },
-        { "does", "doe" },
-        { "doest", "doe" },
-        { "doest", "dog" },
-        { "doest", "don" },
-        { "doest", "dor" },
-        { "dogs", "dog" },
-        { "doing", "do" },
-        { "doing", "do" },
-        { "doing", "doe" },
-        { "doing", "dog" },
-        { "doing", "don" },
-        { "doing", "dor" },
-        { "doings", "doing" },
-        { "dominions", "dominion" },
-        { "donkeys", "donkey" },
-        { "doomed", "doom" },
-        { "doorkeepers", "doorkeeper" },
-        { "doors", "door" },
-        { "doted", "dote" },
-        { "doting", "dote" },
-        { "doting", "doth" },
-        { "doubled", "double" },
-        { "doubted", "doubt" },
-        { "doubting", "doubt" },
-        { "doubting", "doubts" },
-        { "doubts", "doubt" },
-        { "doves", "dove" },
-        { "dragons", "dragon" },
-        { "drained", "drain" },
-        { "drawers", "drawer" },
-        { "drawing", "draw" },
-        { "drawing", "drawn" },
-        { "drawing", "draws" },
-        { "draws", "draw" },
-        { "dreaded", "dread" },
-        { "dreamed", "dream" },
-        { "dreamers", "dreamer" },
-        { "dreaming", "dream" },
-        { "dreaming", "dreams" },
-        { "dreams", "dream" },
-        { "dressed", "dress" },
-        { "dressers", "dresser" },
-        { "dressing", "dress" },
-        { "drewing", "drew" },
-        { "drinkers", "drinker" },
-        { "drinking", "drink" },
-        { "drinking", "drinks" },
-        { "drinks", "drink" },
-        { "drives", "drive" },
-        { "driving", "drive" },
-        { "droppings", "dropping" },
-        { "drops", "drop" },
-        { "droves", "drove" },
-        { "drowned", "drown" },
-        { "drunkards", "drunkard" },
-        { "dues", "due" },
-        { "dukes", "duke" },
-        { "dunghills", "dunghill" },
-        { "during", "dura" },
-        { "dwelled", "dwell" },
-        { "dwellest", "dwells" },
-        { "dwelling", "dwell" },
-        { "dwelling", "dwell" },
-        { "dwelling", "dwells" },
-        { "dwellingplaces", "dwellingplace" },
-        { "dwellings", "dwelling" },
-        { "dwells", "dwell" },
-        { "eagles", "eagle" },
-        { "eared", "ear" },
-        { "earing", "ear" },
-        { "earing", "ears" },
-        { "earnest", "earns" },
-        { "earrings", "earring" },
-        { "ears", "ear" },
-        { "earthquakes", "earthquake" },
-        { "eased", "ease" },
-        { "eaters", "eater" },
-        { "eatest", "eats" },
-        { "eating", "eat" },
-        { "eating", "eat" },
-        { "eating", "eats" },
-        { "eats", "eat" },
-        { "edged", "edge" },
-        { "edges", "edge" },
-        { "edifying", "edify" },
-        { "edomite", "edom" },
-        { "edomites", "edomite" },
-        { "effected", "effect" },
-        { "eggs", "egg" },
-        { "egyptians", "egyptian" },
-        { "elders", "elder" },
-        { "elected", "elect" },
-        { "embalmed", "embalm" },
-        { "embraced", "embrace" },
-        { "embraces", "embrace" },
-        { "embracing", "embrace" },
-        { "embroidered", "embroider" },
-        { "emeralds", "emerald" },
-        { "emims", "emim" },
-        { "employed", "employ" },
-        { "emulations", "emulation" },
-        { "encamped", "encamp" },
-        { "encamping", "encamp" },
-        { "encamping", "encamps" },
-        { "encamps", "encamp" },
-        { "enchanters", "enchanter" },
-        { "enchantments", "enchantment" },
-        { "enclosed", "enclose" },
-        { "encloses", "enclose" },
-        { "encompassed", "encompass" },
-        { "encompassing", "encompass" },
-        { "encountered", "encounter" },
-        { "encouraged", "encourage" },
-        { "encourages", "encourage" },
-        { "end", "en" },
-        { "endangered", "endanger" },
-        { "endeavoured", "endeavour" },
-        { "endeavouring", "endeavour" },
-        { "endeavouring", "endeavours" },
-        { "endeavours", "endeavour" },
-        { "ended", "end" },
-        { "ending", "end" },
-        { "ending", "ends" },
-        { "endowed", "endow" },
-        { "ends", "end" },
-        { "endured", "endure" },
-        { "endures", "endure" },
-        { "enduring", "endure" },
-        { "engraved", "engrave" },
-        { "engraving", "engrave" },
-        { "engravings", "engraving" },
-        { "enjoined", "enjoin" },
-        { "enjoyed", "enjoy" },
-        { "enjoys", "enjoy" },
-        { "enlarged", "enlarge" },
-        { "enlarges", "enlarge" },
-        { "enlarging", "enlarge" },
-        { "enlightened", "enlighten" },
-        { "enlightening", "enlighten" },
-        { "enlightening", "enlightens" },
-        { "enlightens", "enlighten" },
-        { "enquired", "enquire" },
-        { "enquirest", "enquire" },
-        { "enquirest", "enquiry" },
-        { "enriched", "enrich" },
-        { "enriches", "enrich" },
-        { "enriching", "enrich" },
-        { "enrolled", "enroll" },
-        { "ensamples", "ensample" },
-        { "ensigns", "ensign" },
-        { "ensnared", "ensnare" },
-        { "entangled", "entangle" },
-        { "entangles", "entangle" },
-        { "entered", "enter" },
-        { "entering", "enter" },
-        { "entering", "enters" },
-        { "enters", "enter" },
-        { "entertained", "entertain" },
-        { "enticed", "entice" },
-        { "entices", "entice" },
-        { "enticing", "entice" },
-        { "entrances", "entrance" },
-        { "entreated", "entreat" },
-        { "entreating", "entreat" },
-        { "entreating", "entreaty" },
-        { "entrusted", "entrust" },
-        { "envying", "envy" },
-        { "envyings", "envying" },
-        { "ephesians", "ephesian" },
-        { "ephraimite", "ephraim" },
-        { "ephraimites", "ephraimite" },
-        { "ephrathite", "ephrath" },
-        { "ephrathites", "ephrathite" },
-        { "epicureans", "epicurean" },
-        { "epileptics", "epileptic" },
-        { "epistles", "epistle" },
-        { "equals", "equal" },
-        { "erred", "err" },
-        { "errors", "error" },
-        { "errs", "err" },
-        { "escaped", "escape" },
-        { "escapes", "escape" },
-        { "escaping", "escape" },
-        { "eschewed", "eschew" },
-        { "established", "establish" },
-        { "establishes", "establish" },
-        { "establishing", "establish" },
-        { "estates", "estate" },
-        { "esteemed", "esteem" },
-        { "esteeming", "esteem" },
-        { "esteeming", "esteems" },
-        { "esteems", "esteem" },
-        { "estimations", "estimation" },
-        { "ethiopians", "ethiopian" },
-        { "eunuchs", "eunuch" },
-        { "euodias", "euodia" },
-        { "evangelists", "evangelist" },
-        { "evening", "even" },
-        { "evening", "event" },
-        { "evenings", "evening" },
-        { "evidences", "evidence" },
-        { "evildoers", "evildoer" },
-        { "evils", "evil" },
-        { "ewes", "ewe" },
-        { "exacted", "exact" },
-        { "exacting", "exact" },
-        { "exacting", "exacts" },
-        { "exactions", "exaction" },
-        { "exacts", "exact" },
-        { "exalted", "exalt" },
-        { "exaltest", "exalts" },
-        { "exalting", "exalt" },
-        { "exalts", "exalt" },
-        { "examined", "examine" },
-        { "examines", "examine" },
-        { "examining", "examine" },
-        { "examples", "example" },
-        { "exceeded", "exceed" },
-        { "exceedest", "exceeds" },
-        { "exceeding", "exceed" },
-        { "exceeding", "exceed" },
-        { "exceeding", "exceeds" },
-        { "exceeds", "exceed" },
-        { "excels", "excel" },
-        { "excepted", "except" },
-        { "exchanged", "exchange" },
-        { "exchanging", "exchange" },
-        { "excluded", "exclude" },
-        { "excused", "excuse" },
-        { "excuses", "excuse" },
-        { "excusing", "excuse" },
-        { "executed", "execute" },
-        { "executes", "execute" },
-        { "executest", "execute" },
-        { "executing", "execute" },
-        { "exempted", "exempt" },
-        { "exercised", "exercise" },
-        { "exercises", "exercise" },
-        { "exercising", "exercise" },
-        { "exhortations", "exhortation" },
-        { "exhorted", "exhort" },
-        { "exhorting", "exhort" },
-        { "exhorting", "exhorts" },
-        { "exhorts", "exhort" },
-        { "exiles", "exile" },
-        { "existed", "exist" },
-        { "existing", "exist" },
-        { "existing", "exists" },
-        { "exists", "exist" },
-        { "exits", "exit" },
-        { "expected", "expect" },
-        { "expecting", "expect" },
-        { "expenses", "expense" },
-        { "experienced", "experience" },
-        { "explained", "explain" },
-        { "explaining", "explain" },
-        { "explaining", "explains" },
-        { "explains", "explain" },
-        { "exploits", "exploit" },
-        { "expounded", "expound" },
-        { "expressed", "express" },
-        { "expressions", "expression" },
-        { "extended", "extend" },
-        { "extortioners", "extortioner" },
-        { "exulting", "exult" },
-        { "exulting", "exults" },
-        { "exults", "exult" },
-        { "eyed", "eye" },
-        { "eyes", "eye" },
-        { "ezrahite", "ezrah" },
-        { "faces", "face" },
-        { "fades", "fade" },
-        { "fading", "fade" },
-        { "failed", "fail" },
-        { "failing", "fail" },
-        { "failing", "fails" },
-        { "fails", "fail" },
-        { "fainted", "faint" },
-        { "faintest", "faints" },
-        { "fainting", "faint" },
-        { "fainting", "faint" },
-        { "fainting", "faints" },
-        { "faints", "faint" },
-        { "fairest", "fairs" },
-        { "fairing", "fair" },
-        { "fairs", "fair" },
-        { "fallest", "falls" },
-        { "falling", "fall" },
-        { "falling", "fall" },
-        { "falling", "falls" },
-        { "falls", "fall" },
-        { "familiars", "familiar" },
-        { "famines", "famine" },
-        { "famished", "famish" },
-        { "fared", "far" },
-        { "fared", "fare" },
-        { "farmers", "farmer" },
-        { "farming", "farm" },
-        { "farming", "farms" },
-        { "farms", "farm" },
-        { "farthings", "farthing" },
-        { "fashioned", "fashion" },
-        { "fashioning", "fashion" },
-        { "fashioning", "fashions" },
-        { "fashions", "fashion" },
-        { "fasted", "fast" },
-        { "fastened", "fasten" },
-        { "fastening", "fasten" },
-        { "fastening", "fastens" },
-        { "fastens", "fasten" },
-        { "fasting", "fast" },
-        { "fasting", "fast" },
-        { "fastings", "fasting" },
-        { "fathered", "father" },
-        { "fathers", "father" },
-        { "fathomed", "fathom" },
-        { "fathoms", "fathom" },
-        { "fatlings", "fatling" },
-        { "fats", "fat" },
-        { "faults", "fault" },
-        { "favored", "favor" },
-        { "favorite", "favor" },
-        { "favors", "favor" },
-        { "favoured", "favour" },
-        { "favouring", "favour" },
-        { "feared", "fear" },
-        { "fearest", "fears" },
-        { "fearing", "fear" },
-        { "fearing", "fear" },
-        { "fearing", "fears" },
-        { "fears", "fear" },
-        { "feasted", "feast" },
-        { "feasting", "feast" },
-        { "feasting", "feasts" },
-        { "feasts", "feast" },
-        { "feedest", "feeds" },
-        { "feeding", "feed" },
-        { "feeding", "feed" },
-        { "feeding", "feeds" },
-        { "feeds", "feed" },
-        { "feeling", "feel" },
-        { "feigned", "feign" },
-        { "feigning", "feign" },
-        { "felled", "fell" },
-        { "felling", "fell" },
-        { "felling", "fell" },
-        { "fellowhelpers", "fellowhelper" },
-        { "fellowlabourers", "fellowlabourer" },
-        { "fellowprisoners", "fellowprisoner" },
-        { "fellows", "fellow" },
-        { "fellowservants", "fellowservant" },
-        { "fenced", "fence" },
-        { "fences", "fence" },
-        { "fetched", "fetch" },
-        { "fetches", "fetch" },
-        { "fewing", "few" },
-        { "fields", "field" },
-        { "fighting", "fight" },
-        { "fighting", "fights" },
-        { "fightings", "fighting" },
-        { "fights", "fight" },
-        { "figs", "fig" },
-        { "figured", "figure" },
-        { "figures", "figure" },
-        { "filled", "fill" },
-        { "fillest", "fills" },
-        { "filleted", "fillet" },
-        { "fillets", "fillet" },
-        { "filling", "fill" },
-        { "filling", "fill" },
-        { "filling", "fills" },
-        { "fills", "fill" },
-        { "findest", "finds" },
-        { "finding", "find" },
-        { "finding", "find" },
-        { "finding", "finds" },
-        { "finds", "find" },
-        { "fined", "fine" },
-        { "finest", "find" },
-        { "finest", "fine" },
-        { "finest", "fins" },
-        { "fingers", "finger" },
-        { "fining", "find" },
-        { "fining", "fine" },
-        { "fining", "fins" },
-        { "finished", "finish" },
-        { "firebrands", "firebrand" },
-        { "fires", "fir" },
-        { "fires", "fire" },
-        { "firs", "fir" },
-        { "firstfruits", "firstfruit" },
-        { "firstlings", "firstling" },
-        { "fishers", "fisher" },
-        { "fishes", "fish" },
-        { "fishhooks", "fishhook" },
-        { "fishing", "fish" },
-        { "fists", "fist" },
-        { "fixed", "fix" },
-        { "flagons", "flagon" },
-        { "flags", "flag" },
-        { "flames", "flame" },
-        { "flaming", "flame" },
-        { "flashed", "flash" },
-        { "flashes", "flash" },
-        { "flashing", "flash" },
-        { "flattered", "flatter" },
-        { "flattering", "flatter" },
-        { "flattering", "flatters" },
-        { "flattering", "flattery" },
-        { "flatters", "flatter" },
-        { "flayed", "flay" },
-        { "fleeing", "flee" },
-        { "fleeing", "flees" },
-        { "flees", "flee" },
-        { "fleeting", "fleeth" },
-        { "fleshed", "flesh" },
-        { "fleshhooks", "fleshhook" },
-        { "flocks", "flock" },
-        { "floods", "flood" },
-        { "floors", "floor" },
-        { "flourished", "flourish" },
-        { "flourishes", "flourish" },
-        { "flourishing", "flourish" },
-        { "flowed", "flow" },
-        { "flowers", "flower" },
-        { "flowing", "flow" },
-        { "flowing", "flows" },
-        { "flows", "flow" },
-        { "flutes", "flute" },
-        { "fluttering", "flutters" },
-        { "flying", "fly" },
-        { "foals", "foal" },
-        { "foaming", "foam" },
-        { "foaming", "foams" },
-        { "foams", "foam" },
-        { "folded", "fold" },
-        { "folding", "fold" },
-        { "folding", "folds" },
-        { "folds", "fold" },
-        { "folks", "folk" },
-        { "followed", "follow" },
-        { "following", "follow" },
-        { "following", "follows" },
-        { "follows", "follow" },
-        { "foods", "food" },
-        { "fools", "fool" },
-        { "footed", "foot" },
-        { "forbearing", "forbear" },
-        { "forbearing", "forbears" },
-        { "forbears", "forbear" },
-        { "forbids", "forbid" },
-        { "forced", "force" },
-        { "forces", "force" },
-        { "forcing", "force" },
-        { "ford", "for" },
-        { "fords", "ford" },
-        { "forefathers", "forefather" },
-        { "foregoing", "forego" },
-        { "foreheads", "forehead" },
-        { "foreigners", "foreigner" },
-        { "foreskins", "foreskin" },
-        { "forest", "ford" },
-        { "forest", "fork" },
-        { "forest", "form" },
-        { "forest", "fort" },
-        { "forests", "forest" },
-        { "forewarned", "forewarn" },
-        { "forfeited", "forfeit" },
-        { "forfeits", "forfeit" },
-        { "forgavest", "forgave" },
-        { "forgers", "forger" },
-        { "forgets", "forget" },
-        { "forgivenesses", "forgiveness" },
-        { "forgives", "forgive" },
-        { "forgiving", "forgive" },
-        { "foring", "for" },
-        { "forks", "fork" },
-        { "formed", "form" },
-        { "forms", "form" },
-        { "fornications", "fornication" },
-        { "fornicators", "fornicator" },
-        { "forsakes", "forsake" },
-        { "forsaking", "forsake" },
-        { "forsooking", "forsook" },
-        { "fortresses", "fortress" },
-        { "forts", "fort" },
-        { "fortunes", "fortune" },
-        { "fouled", "foul" },
-        { "foundations", "foundation" },
-        { "founded", "found" },
-        { "founding", "found" },
-        { "fountains", "fountain" },
-        { "fours", "four" },
-        { "fowlers", "fowler" },
-        { "fowls", "fowl" },
-        { "foxes", "fox" },
-        { "framed", "frame" },
-        { "freed", "free" },
-        { "frees", "free" },
-        { "friends", "friend" },
-        { "frightened", "frighten" },
-        { "fringes", "fringe" },
-        { "fruits", "fruit" },
-        { "frustrated", "frustrate" },
-        { "frustrates", "frustrate" },
-        { "fugitives", "fugitive" },
-        { "fulfilled", "fulfill" },
-        { "fulfilling", "fulfill" },
-        { "fulfilling", "fulfills" },
-        { "fulfills", "fulfill" },
-        { "fullers", "fuller" },
-        { "fullest", "fully" },
-        { "fulling", "full" },
-        { "furbished", "furbish" },
-        { "furnaces", "furnace" },
-        { "furnished", "furnish" },
-        { "furrows", "furrow" },
-        { "furthered", "further" },
-        { "gaddest", "gaddi" },
-        { "gadite", "gad" },
-        { "gadites", "gadite" },
-        { "gained", "gain" },
-        { "gaining", "gain" },
-        { "gaining", "gains" },
-        { "gains", "gain" },
-        { "gainsaying", "gainsay" },
-        { "galilaeans", "galilaean" },
-        { "galileans", "galilean" },
-        { "games", "game" },
-        { "gaped", "gap" },
-        { "gapes", "gap" },
-        { "gaps", "gap" },
-        { "gardens", "garden" },
-        { "garlands", "garland" },
-        { "garments", "garment" },
-        { "garnered", "garner" },
-        { "garners", "garner" },
-        { "garnished", "garnish" },
-        { "garrisons", "garrison" },
-        { "gasps", "gasp" },
-        { "gates", "gat" },
-        { "gates", "gate" },
-        { "gathered", "gather" },
-        { "gatherers", "gatherer" },
-        { "gatherest", "gathers" },
-        { "gathering", "gather" },
-        { "gathering", "gather" },
-        { "gathering", "gathers" },
-        { "gatherings", "gathering" },
-        { "gathers", "gather" },
-        { "gavest", "gave" },
-        { "gazelles", "gazelle" },
-        { "gazers", "gazer" },
-        { "gazes", "gaze" },
-        { "gazing", "gaza" },
-        { "gazing", "gaze" },
-        { "gederite", "geder" },
-        { "gendered", "gender" },
-        { "generations", "generation" },
-        { "gentiles", "gentile" },
-        { "gershonite", "gershon" },
-        { "gershonites", "gershonite" },
-        { "gets", "get" },
-        { "giants", "giant" },
-        { "gibeathite", "gibeath" },
-        { "gibeonite", "gibeon" },
-        { "gibeonites", "gibeonite" },
-        { "gifts", "gift" },
-        { "gileadite", "gilead" },
-        { "gileadites", "gileadite" },
-        { "gins", "gin" },
-        { "girded", "gird" },
-        { "girding", "gird" },
-        { "girding", "girds" },
-        { "girdles", "girdle" },
-        { "girds", "gird" },
-        { "girgashites", "girgashite" },
-        { "girls", "girl" },
-        { "gittites", "gittite" },
-        { "gives", "give" },
-        { "givest", "give" },
-        { "giving", "give" },
-        { "givings", "giving" },
-        { "glasses", "glass" },
-        { "gleaned", "glean" },
-        { "gleaning", "glean" },
-        { "gleaning", "gleans" },
-        { "gleanings", "gleaning" },
-        { "gleans", "glean" },
-        { "glittering", "glitter" },
-        { "gloating", "gloat" },
-        { "glorifying", "glorify" },
-        { "glorying", "glory" },
-        { "gluttons", "glutton" },
-        { "gnashed", "gnash" },
-        { "gnashes", "gnash" },
-        { "gnashing", "gnash" },
-        { "gnawed", "gnaw" },
-        { "goads", "goad" },
-        { "goats", "goat" },
-        { "god", "god" },
-        { "gods", "god" },
-        { "goes", "go" },
-        { "goest", "gob" },
-        { "goest", "god" },
-        { "goest", "gog" },
-        { "goest", "got" },
-        { "going", "go" },
-        { "going", "go" },
-        { "going", "gob" },
-        { "going", "god" },
-        { "going", "gog" },
-        { "going", "got" },
-        { "goings", "going" },
-        { "goldsmiths", "goldsmith" },
-        { "goods", "good" },
-        { "gored", "gore" },
-        { "gores", "gore" },
-        { "goring", "gore" },
-        { "gossips", "gossip" },
-        { "gourds", "gourd" },
-        { "governing", "govern" },
-        { "governments", "government" },
-        { "governors", "governor" },
-        { "graffed", "graff" },
-        { "grafted", "graft" },
-        { "grains", "grain" },
-        { "granted", "grant" },
-        { "granting", "grant" },
-        { "grapegatherers", "grapegatherer" },
-        { "grapes", "grape" },
-        { "grasses", "grass" },
-        { "grasshoppers", "grasshopper" },
-        { "grating", "grate" },
-        { "graved", "grave" },
-        { "graves", "grave" },
-        { "graving", "grave" },
-        { "gravings", "graving" },
-        { "grazes", "graze" },
-        { "greating", "great" },
-        { "grecians", "grecian" },
-        { "greeks", "greek" },
-        { "greeted", "greet" },
-        { "greeting", "greet" },
-        { "greeting", "greets" },
-        { "greetings", "greeting" },
-        { "greets", "greet" },
-        { "griefs", "grief" },
-        { "grieved", "grieve" },
-        { "grieves", "grieve" },
-        { "grieving", "grieve" },
-        { "grinding", "grind" },
-        { "grinding", "grinds" },
-        { "grinds", "grind" },
-        { "groaned", "groan" },
-        { "groaning", "groan" },
-        { "groaning", "groans" },
-        { "groanings", "groaning" },
-        { "groans", "groan" },
-        { "gropes", "grope" },
-        { "grounded", "ground" },
-        { "groves", "grove" },
-        { "growing", "grow" },
-        { "growing", "growl" },
-        { "growing", "grown" },
-        { "growing", "grows" },
-        { "growling", "growl" },
-        { "grows", "grow" },
-        { "grudging", "grudge" },
-        { "grumbled", "grumble" },
-        { "grumbling", "grumble" },
-        { "guarded", "guard" },
-        { "guarding", "guard" },
-        { "guarding", "guards" },
-        { "guards", "guard" },
-        { "guest", "gum" },
-        { "guest", "gur" },
-        { "guests", "guest" },
-        { "guided", "guide" },
-        { "guides", "guide" },
-        { "guiding", "guide" },
-        { "gushed", "gush" },
-        { "gushes", "gush" },
-        { "gutters", "gutter" },
-        { "habergeons", "habergeon" },
-        { "habitations", "habitation" },
-        { "habits", "habit" },
-        { "had", "ha" },
-        { "hades", "had" },
-        { "hagrites", "hagrite" },
-        { "hairs", "hair" },
-        { "haling", "hale" },
-        { "haling", "half" },
-        { "haling", "hali" },
-        { "haling", "hall" },
-        { "haling", "halt" },
-        { "hallowed", "hallow" },
-        { "halted", "halt" },
-        { "halting", "halt" },
-        { "hamathite", "hamath" },
-        { "hammered", "hammer" },
-        { "hammers", "hammer" },
-        { "handbreadths", "handbreadth" },
-        { "handed", "hand" },
-        { "handfuls", "handful" },
-        { "handiworks", "handiwork" },
-        { "handkerchiefs", "handkerchief" },
-        { "handled", "handle" },
-        { "handles", "handle" },
-        { "handling", "handle" },
-        { "handmaidens", "handmaiden" },
-        { "handmaids", "handmaid" },
-        { "hands", "hand" },
-        { "hanged", "hang" },
-        { "hanging", "hang" },
-        { "hanging", "hangs" },
-        { "hangings", "hanging" },
-        { "hangs", "hang" },
-        { "happened", "happen" },
-        { "happening", "happen" },
-        { "happening", "happens" },
-        { "happens", "happen" },
-        { "hard", "har" },
-        { "hardened", "harden" },
-        { "hardening", "harden" },
-        { "hardening", "hardens" },
-        { "hardens", "harden" },
-        { "hardships", "hardship" },
-        { "harlots", "harlot" },
-        { "harmed", "harm" },
-        { "harnessed", "harness" },
-        { "harnesses", "harness" },
-        { "harodite", "harod" },
-        { "harped", "harp" },
-        { "harping", "harp" },
-        { "harping", "harps" },
-        { "harps", "harp" },
-        { "harrows", "harrow" },
-        { "harts", "hart" },
-        { "harvests", "harvest" },
-        { "has", "ha" },
-        { "hasted", "hast" },
-        { "hasted", "haste" },
-        { "hastened", "hasten" },
-        { "hastening", "hasten" },
-        { "hasting", "hast" },
-        { "hasting", "haste" },
-        { "hasting", "hasty" },
-        { "hated", "hate" },
-        { "hates", "hate" },
-        { "hatest", "hate" },
-        { "hatest", "hath" },
-        { "hatest", "hats" },
-        { "hating", "hate" },
-        { "hating", "hath" },
-        { "hating", "hats" },
-        { "haunts", "haunt" },
-        { "havens", "haven" },
-        { "having", "have" },
-        { "headbands", "headband" },
-        { "headdresses", "headdress" },
-        { "headed", "head" },
-        { "heads", "head" },
-        { "healed", "heal" },
-        { "healing", "heal" },
-        { "healing", "heals" },
-        { "healings", "healing" },
-        { "heals", "heal" },
-        { "heaped", "heap" },
-        { "heaps", "heap" },
-        { "heard", "hear" },
-        { "hearding", "heard" },
-        { "hearers", "hearer" },
-        { "hearest", "heard" },
-        { "hearest", "hears" },
-        { "hearest", "heart" },
-        { "hearing", "hear" },
-        { "hearing", "hear" },
-        { "hearing", "heard" },
-        { "hearing", "hears" },
-        { "hearing", "heart" },
-        { "hearkened", "hearken" },
-        { "hearkening", "hearken" },
-        { "hears", "hear" },
-        { "hearted", "heart" },
-        { "hearts", "heart" },
-        { "heated", "heat" },
-        { "heaved", "heave" },
-        { "heavens", "heaven" },
-        { "hebrews", "hebrew" },
-        { "hedged", "hedge" },
-        { "hedges", "hedge" },
-        { "heed", "he" },
-        { "heeding", "heed" },
-        { "heeding", "heeds" },
-        { "heeds", "heed" },
-        { "heels", "heel" },
-        { "heights", "height" },
-        { "heirs", "heir" },
-        { "helmets", "helmet" },
-        { "helped", "help" },
-        { "helpers", "helper" },
-        { "helping", "help" },
-        { "helping", "helps" },
-        { "helps", "help" },
-        { "hems", "hem" },
-        { "herbs", "herb" },
-        { "herd", "her" },
-        { "herds", "herd" },
-        { "heres", "her" },
-        { "heres", "here" },
-        { "heritages", "heritage" },
-        { "hers", "her" },
-        { "hewed", "hew" },
-        { "hewers", "hewer" },
-        { "hews", "hew" },
-        { "hides", "hid" },
-        { "hides", "hide" },
-        { "hidest", "hide" },
-        { "hiding", "hid" },
-        { "hiding", "hid" },
-        { "hiding", "hide" },
-        { "highing", "high" },
-        { "highways", "highway" },
-        { "hills", "hill" },
-        { "hind", "hin" },
-        { "hindered", "hinder" },
-        { "hinds", "hind" },
-        { "hired", "hire" },
-        { "hires", "hire" },
-        { "hirest", "hire" },
-        { "hiss", "his" },
-        { "hissing", "hiss" },
-        { "hittites", "hittite" },
-        { "hivites", "hivite" },
-        { "hod", "ho" },
-        { "hoed", "ho" },
-        { "holdest", "holds" },
-        { "holding", "hold" },
-        { "holding", "hold" },
-        { "holding", "holds" },
-        { "holds", "hold" },
-        { "holes", "hole" },
-        { "homers", "homer" },
-        { "homes", "home" },
-        { "honored", "honor" },
-        { "honors", "honor" },
-        { "honoured", "honour" },
-        { "honourest", "honours" },
-        { "honouring", "honour" },
-        { "honours", "honour" },
-        { "hoofs", "hoof" },
-        { "hooks", "hook" },
-        { "hoped", "hope" },
-        { "hopes", "hope" },
-        { "hoping", "hope" },
-        { "horite", "hor" },
-        { "horites", "horite" },
-        { "horned", "horn" },
-        { "hornets", "hornet" },
-        { "horns", "horn" },
-        { "horonite", "horon" },
-        { "horses", "horse" },
-        { "hosts", "host" },
-        { "houghed", "hough" },
-        { "hours", "hour" },
-        { "households", "household" },
-        { "houses", "house" },
-        { "housetops", "housetop" },
-        { "howled", "howl" },
-        { "howling", "howl" },
-        { "howlings", "howling" },
-        { "humbled", "humble" },
-        { "humbles", "humble" },
-        { "humbling", "humble" },
-        { "humbling", "humbly" },
-        { "hundreds", "hundred" },
-        { "hungered", "hunger" },
-        { "hunted", "hunt" },
-        { "hunters", "hunter" },
-        { "huntest", "hunts" },
-        { "hunting", "hunt" },
-        { "hunting", "hunt" },
-        { "hunting", "hunts" },
-        { "hunts", "hunt" },
-        { "hurled", "hurl" },
-        { "hurling", "hurl" },
-        { "hurling", "hurls" },
-        { "hurls", "hurl" },
-        { "hurting", "hurt" },
-        { "hurting", "hurts" },
-        { "hurts", "hurt" },
-        { "husbands", "husband" },
-        { "husks", "husk" },
-        { "hymns", "hymn" },
-        { "hypocrites", "hypocrite" },
-        { "idolaters", "idolater" },
-        { "idols", "idol" },
-        { "ignored", "ignore" },
-        { "images", "image" },
-        { "imaginations", "imagination" },
-        { "imagined", "imagine" },
-        { "imparted", "impart" },
-        { "imposed", "impose" },
-        { "impoverished", "impoverish" },
-        { "imprisonments", "imprisonment" },
-        { "imputed", "impute" },
-        { "imputing", "impute" },
-        { "incensed", "incense" },
-        { "inclined", "incline" },
-        { "inclines", "incline" },
-        { "inclosed", "inclose" },
-        { "increased", "increase" },
-        { "increases", "increase" },
-        { "increasest", "increase" },
-        { "increasing", "increase" },
-        { "indeed", "indee" },
-        { "infants", "infant" },
-        { "inflaming", "inflame" },
-        { "informed", "inform" },
-        { "inhabitants", "inhabitant" },
-        { "inhabited", "inhabit" },
-        { "inhabitest", "inhabits" },
-        { "inhabiting", "inhabit" },
-        { "inhabiting", "inhabit" },
-        { "inhabiting", "inhabits" },
-        { "inhabits", "inhabit" },
-        { "inheritances", "inheritance" },
-        { "inherited", "inherit" },
-        { "inherits", "inherit" },
-        { "innocents", "innocent" },
-        { "inquired", "inquire" },
-        { "inquires", "inquire" },
-        { "inscribed", "inscribe" },
-        { "instructed", "instruct" },
-        { "instructing", "instruct" },
-        { "instructing", "instructs" },
-        { "instructions", "instruction" },
-        { "instructors", "instructor" },
-        { "instructs", "instruct" },
-        { "instruments", "instrument" },
-        { "insulted", "insult" },
-        { "insulting", "insult" },
-        { "insulting", "insults" },
-        { "insults", "insult" },
-        { "insurrections", "insurrection" },
-        { "intended", "intend" },
-        { "intending", "intend" },
-        { "intending", "intend" },
-        { "intents", "intent" },
-        { "intercessions", "intercession" },
-        { "interpretations", "interpretation" },
-        { "interpreted", "interpret" },
-        { "interpreting", "interpret" },
-        { "interpreting", "interprets" },
-        { "interprets", "interpret" },
-        { "intreated", "intreat" },
-        { "invaded", "invade" },
-        { "invented", "invent" },
-        { "invited", "invite" },
-        { "invites", "invite" },
-        { "inwards", "inward" },
-        { "irad", "ira" },
-        { "irons", "iron" },
-        { "is", "i" },
-        { "ishmaelite", "ishmael" },
-        { "ishmaelites", "ishmaelite" },
-        { "ishmeelites", "ishmeelite" },
-        { "islands", "island" },
-        { "isles", "isle" },
-        { "israelite", "israel" },
-        { "israelites", "israelite" },
-        { "issued", "issue" },
-        { "issues", "issue" },
-        { "italians", "italian" },
-        { "itching", "itch" },
-        { "ithrites", "ithrite" },
-        { "its", "it" },
-        { "jackals", "jackal" },
-        { "jairite", "jair" },
-        { "jared", "jar" },
-        { "jars", "jar" },
-        { "jaws", "jaw" },
-        { "jebusite", "jebus" },
-        { "jebusites", "jebusite" },
-        { "jehud", "jehu" },
-        { "jewels", "jewel" },
-        { "jews", "jew" },
-        { "jezreelite", "jezreel" },
-        { "joined", "join" },
-        { "joining", "join" },
-        { "joining", "joint" },
-        { "joinings", "joining" },
-        { "joints", "joint" },
-        { "joking", "joke" },
-        { "jonas", "jona" },
-        { "joses", "jose" },
-        { "journeyed", "journey" },
-        { "journeying", "journey" },
-        { "journeying", "journeys" },
-        { "journeyings", "journeying" },
-        { "journeys", "journey" },
-        { "joyed", "joy" },
-        { "joying", "joy" },
-        { "judas", "juda" },
-        { "judged", "judge" },
-        { "judges", "judge" },
-        { "judgest", "judge" },
-        { "judging", "judge" },
-        { "judgments", "judgment" },
-        { "junias", "junia" },
-        { "justifying", "justify" },
-        { "keepers", "keeper" },
-        { "keepest", "keeps" },
-        { "keeping", "keep" },
-        { "keeping", "keep" },
-        { "keeping", "keeps" },
-        { "keeps", "keep" },
-        { "kenites", "kenite" },
-        { "kenizzites", "kenizzite" },
-        { "kernels", "kernel" },
-        { "keys", "key" },
-        { "kicked", "kick" },
-        { "kids", "kid" },
-        { "killed", "kill" },
-        { "killest", "kills" },
-        { "killing", "kill" },
-        { "killing", "kill" },
-        { "killing", "kills" },
-        { "kills", "kill" },
-        { "kind", "kin" },
-        { "kindled", "kindle" },
-        { "kindles", "kindle" },
-        { "kindreds", "kindred" },
-        { "kinds", "kind" },
-        { "kingdoms", "kingdom" },
-        { "kings", "king" },
-        { "kinsfolks", "kinsfolk" },
-        { "kissed", "kiss" },
-        { "kisses", "kiss" },
-        { "kites", "kite" },
-        { "kneaded", "knead" },
-        { "kneading", "knead" },
-        { "kneeled", "kneel" },
-        { "kneeling", "kneel" },
-        { "knees", "knee" },
-        { "knewing", "knew" },
-        { "knocked", "knock" },
-        { "knocking", "knock" },
-        { "knocking", "knocks" },
-        { "knocks", "knock" },
-        { "knops", "knop" },
-        { "knowest", "known" },
-        { "knowest", "knows" },
-        { "knowing", "know" },
-        { "knowing", "know" },
-        { "knowing", "known" },
-        { "knowing", "knows" },
-        { "knows", "know" },
-        { "korahite", "korah" },
-        { "korahites", "korahite" },
-        { "labored", "labor" },
-        { "laborers", "laborer" },
-        { "laboring", "labor" },
-        { "laboring", "labors" },
-        { "labors", "labor" },
-        { "laboured", "labour" },
-        { "labourers", "labourer" },
-        { "labouring", "labour" },
-        { "labouring", "labours" },
-        { "labours", "labour" },
-        { "lacked", "lack" },
-        { "lackest", "lacks" },
-        { "lacking", "lack" },
-        { "lacking", "lack" },
-        { "lacking", "lacks" },
-        { "lacks", "lack" },
-        { "laded", "lad" },
-        { "laded", "lade" },
-        { "lading", "lad" },
-        { "lading", "lade" },
-        { "lading", "lads" },
-        { "lading", "lady" },
-        { "lads", "lad" },
-        { "lambs", "lamb" },
-        { "lamed", "lame" },
-        { "lamentations", "lamentation" },
-        { "lamented", "lament" },
-        { "lamps", "lamp" },
-        { "lampstands", "lampstand" },
-        { "lances", "lance" },
-        { "landed", "land" },
-        { "landing", "land" },
-        { "landing", "lands" },
-        { "landmarks", "landmark" },
-        { "lands", "land" },
-        { "languages", "language" },
-        { "languished", "languish" },
-        { "languishes", "languish" },
-        { "languishing", "languish" },
-        { "laps", "lap" },
-        { "lasted", "last" },
-        { "lasting", "last" },
-        { "laughed", "laugh" },
-        { "laughing", "laugh" },
-        { "laughing", "laughs" },
-        { "laughs", "laugh" },
-        { "launched", "launch" },
-        { "lavers", "laver" },
-        { "laws", "law" },
-        { "lawyers", "lawyer" },
-        { "layest", "lays" },
-        { "laying", "lay" },
-        { "laying", "lay" },
-        { "laying", "lays" },
-        { "lays", "lay" },
-        { "leaders", "leader" },
-        { "leadest", "leads" },
-        { "leading", "lead" },
-        { "leading", "lead" },
-        { "leading", "leads" },
-        { "leads", "lead" },
-        { "leaned", "lean" },
-        { "leaning", "lean" },
-        { "leaning", "leans" },
-        { "leans", "lean" },
-        { "leaped", "leap" },
-        { "leaping", "leap" },
-        { "leaping", "leaps" },
-        { "leaps", "leap" },
-        { "learned", "learn" },
-        { "learning", "learn" },
-        { "leased", "lease" },
-        { "leasing", "lease" },
-        { "leasing", "least" },
-        { "leaved", "leave" },
-        { "leavened", "leaven" },
-        { "leavens", "leaven" },
-        { "leaves", "leave" },
-        { "leaving", "leave" },
-        { "led", "le" },
-        { "ledges", "ledge" },
-        { "lees", "le" },
-        { "lees", "lee" },
-        { "lefting", "left" },
-        { "legions", "legion" },
-        { "legs", "leg" },
-        { "lehemite", "lehem" },
-        { "lends", "lend" },
-        { "lengthened", "lengthen" },
-        { "lengthening", "lengthen" },
-        { "leopards", "leopard" },
-        { "lepers", "leper" },
-        { "lest", "le" },
-        { "lest", "ll" },
-        { "lest", "lo" },
-        { "lets", "let" },
-        { "letters", "letter" },
-        { "leveled", "level" },
-        { "levels", "level" },
-        { "levites", "levite" },
-        { "liars", "liar" },
-        { "licked", "lick" },
-        { "licks", "lick" },
-        { "lied", "lie" },
-        { "lies", "lie" },
-        { "liest", "lid" },
-        { "liest", "lie" },
-        { "liest", "lip" },
-        { "liest", "lit" },
-        { "lifted", "lift" },
-        { "liftest", "lifts" },
-        { "lifting", "lift" },
-        { "lifting", "lift" },
-        { "lifting", "lifts" },
-        { "lifts", "lift" },
-        { "lighted", "light" },
-        { "lightened", "lighten" },
-        { "lightest", "lights" },
-        { "lighting", "light" },
-        { "lighting", "light" },
-        { "lighting", "lights" },
-        { "lightnings", "lightning" },
-        { "lights", "light" },
-        { "liked", "like" },
-        { "likened", "liken" },
-        { "liking", "like" },
-        { "limbs", "limb" },
-        { "limited", "limit" },
-        { "limits", "limit" },
-        { "lines", "line" },
-        { "lingered", "linger" },
-        { "lintels", "lintel" },
-        { "lionesses", "lioness" },
-        { "lions", "lion" },
-        { "lips", "lip" },
-        { "liquors", "liquor" },
-        { "listened", "listen" },
-        { "listening", "listen" },
-        { "listening", "listens" },
-        { "listens", "listen" },
-        { "lived", "live" },
-        { "lives", "live" },
-        { "livest", "live" },
-        { "living", "live" },
-        { "loaded", "load" },
-        { "loads", "load" },
-        { "loathed", "loathe" },
-        { "loathes", "loathe" },
-        { "loathing", "loathe" },
-        { "locked", "lock" },
-        { "locks", "lock" },
-        { "locusts", "locust" },
-        { "lod", "lo" },
-        { "lodged", "lodge" },
-        { "lodges", "lodge" },
-        { "lodgest", "lodge" },
-        { "lodging", "lodge" },
-        { "lodgings", "lodging" },
-        { "longed", "long" },
-        { "longing", "long" },
-        { "longing", "longs" },
-        { "longs", "long" },
-        { "looked", "look" },
-        { "lookest", "looks" },
-        { "looking", "look" },
-        { "looking", "look" },
-        { "looking", "looks" },
-        { "looks", "look" },
-        { "loosed", "loose" },
-        { "loosened", "loosen" },
-        { "loosens", "loosen" },
-        { "loosing", "loose" },
-        { "lording", "lord" },
-        { "lording", "lords" },
-        { "lords", "lord" },
-        { "loses", "lose" },
-        { "lothed", "lothe" },
-        { "lothing", "lothe" },
-        { "lots", "lot" },
-        { "lotuses", "lotus" },
-        { "loved", "love" },
-        { "lovers", "lover" },
-        { "loves", "love" },
-        { "lovest", "love" },
-        { "loving", "love" },
-        { "lovingkindnesses", "lovingkindness" },
-        { "lowered", "lower" },
-        { "lowering", "lower" },
-        { "lowing", "low" },
-        { "lowing", "low" },
-        { "lubims", "lubim" },
-        { "lurking", "lurk" },
-        { "lurking", "lurks" },
-        { "lurks", "lurk" },
-        { "lusted", "lust" },
-        { "lusting", "lust" },
-        { "lusting", "lusts" },
-        { "lusting", "lusty" },
-        { "lusts", "lust" },
-        { "lying", "lye" },
-        { "maacathite", "maacath" },
-        { "maacathites", "maacathite" },
-        { "maachathites", "maachathite" },
-        { "madest", "made" },
-        { "mading", "mad" },
-        { "magicians", "magician" },
-        { "magistrates", "magistrate" },
-        { "maidens", "maiden" },
-        { "maids", "maid" },
-        { "maidservants", "maidservant" },
-        { "maimed", "maim" },
-        { "maintained", "maintain" },
-        { "maintainest", "maintains" },
-        { "maintaining", "maintain" },
-        { "maintains", "maintain" },
-        { "makers", "maker" },
-        { "makes", "make" },
-        { "makest", "make" },
-        { "making", "make" },
-        { "malefactors", "malefactor" },
-        { "males", "male" },
-        { "maligned", "malign" },
-        { "manifested", "manifest" },
-        { "manners", "manner" },
-        { "manservants", "manservant" },
-        { "manslayers", "manslayer" },
-        { "mantles", "mantle" },
-        { "marched", "march" },
-        { "marching", "march" },
-        { "marked", "mark" },
-        { "markest", "marks" },
-        { "marketplaces", "marketplace" },
-        { "markets", "market" },
-        { "marking", "mark" },
-        { "marks", "mark" },
-        { "marriages", "marriage" },
-        { "marrying", "marry" },
-        { "mars", "mar" },
-        { "marshes", "marsh" },
-        { "martyrs", "martyr" },
-        { "marveled", "marvel" },
-        { "marveling", "marvel" },
-        { "marveling", "marvels" },
-        { "marvels", "marvel" },
-        { "masquerades", "masquerade" },
-        { "masquerading", "masquerade" },
-        { "masters", "master" },
-        { "masts", "mast" },
-        { "mats", "mat" },
-        { "matters", "matter" },
-        { "mattocks", "mattock" },
-        { "mauled", "maul" },
-        { "maying", "may" },
-        { "meadows", "meadow" },
-        { "meanest", "means" },
-        { "meanest", "meant" },
-        { "meaning", "mean" },
-        { "meaning", "mean" },
-        { "meaning", "means" },
-        { "meaning", "meant" },
-        { "means", "mean" },
-        { "measured", "measure" },
-        { "measures", "measure" },
-        { "measuring", "measure" },
-        { "meats", "meat" },
-        { "meddled", "meddle" },
-        { "meddles", "meddle" },
-        { "meddling", "meddle" },
-        { "medes", "mede" },
-        { "medicines", "medicine" },
-        { "meditated", "meditate" },
-        { "meditates", "meditate" },
-        { "meetest", "meets" },
-        { "meeting", "meet" },
-        { "meeting", "meet" },
-        { "meeting", "meets" },
-        { "meets", "meet" },
-        { "mehunims", "mehunim" },
-        { "melted", "melt" },
-        { "melting", "melt" },
-        { "melting", "melts" },
-        { "melts", "melt" },
-        { "members", "member" },
-        { "mend", "men" },
-        { "mending", "mend" },
-        { "mentioned", "mention" },
-        { "mentioning", "mention" },
-        { "merchants", "merchant" },
-        { "mered", "mere" },
-        { "meres", "mere" },
-        { "messengers", "messenger" },
-        { "messes", "mess" },
-        { "metals", "metal" },
-        { "meted", "met" },
-        { "meted", "mete" },
-        { "midianite", "midian" },
-        { "midianites", "midianite" },
-        { "mightest", "mighty" },
-        { "mighting", "might" },
-        { "millions", "million" },
-        { "mills", "mill" },
-        { "millstones", "millstone" },
-        { "minas", "mina" },
-        { "minded", "mind" },
-        { "minding", "mind" },
-        { "minding", "minds" },
-        { "minds", "mind" },
-        { "mingled", "mingle" },
-        { "minished", "minish" },
-        { "ministered", "minister" },
-        { "ministering", "minister" },
-        { "ministering", "ministers" },
-        { "ministers", "minister" },
-        { "minstrels", "minstrel" },
-        { "miracles", "miracle" },
-        { "mirrors", "mirror" },
-        { "miscarrying", "miscarry" },
-        { "mischiefs", "mischief" },
-        { "missed", "miss" },
-        { "missing", "miss" },
-        { "mite", "m" },
-        { "mites", "mite" },
-        { "mixed", "mix" },
-        { "mixes", "mix" },
-        { "moabite", "moab" },
-        { "moabites", "moabite" },
-        { "moabitess", "moabites" },
-        { "moaning", "moan" },
-        { "mocked", "mock" },
-        { "mockers", "mocker" },
-        { "mockest", "mocks" },
-        { "mocking", "mock" },
-        { "mocking", "mock" },
-        { "mocking", "mocks" },
-        { "mockings", "mocking" },
-        { "mocks", "mock" },
-        { "modest", "mode" },
-        { "moistened", "moisten" },
-        { "molding", "moldy" },
-        { "moles", "mole" },
-        { "monsters", "monster" },
-        { "months", "month" },
-        { "monuments", "monument" },
-        { "moons", "moon" },
-        { "morals", "moral" },
-        { "mornings", "morning" },
-        { "morsels", "morsel" },
-        { "mortals", "mortal" },
-        { "mortars", "mortar" },
-        { "mothers", "mother" },
-        { "mounds", "mound" },
-        { "mountains", "mountain" },
-        { "mounted", "mount" },
-        { "mounting", "mount" },
-        { "mounting", "mounts" },
-        { "mounts", "mount" },
-        { "mourned", "mourn" },
-        { "mourners", "mourner" },
-        { "mourning", "mourn" },
-        { "mourning", "mourns" },
-        { "mourns", "mourn" },
-        { "mouths", "mouth" },
-        { "moved", "move" },
-        { "moves", "move" },
-        { "moving", "move" },
-        { "mules", "mule" },
-        { "multiplying", "multiply" },
-        { "multitudes", "multitude" },
-        { "munitions", "munition" },
-        { "murdered", "murder" },
-        { "murderers", "murderer" },
-        { "murders", "murder" },
-        { "murmured", "murmur" },
-        { "murmuring", "murmur" },
-        { "murmurings", "murmuring" },
-        { "mused", "muse" },
-        { "musicians", "musician" },
-        { "musing", "muse" },
-        { "musing", "must" },
-        { "muttered", "mutter" },
-        { "mutters", "mutter" },
-        { "nailing", "nail" },
-        { "nailing", "nails" },
-        { "nails", "nail" },
-        { "named", "name" },
-        { "names", "name" },
-        { "narrowed", "narrow" },
-        { "nations", "nation" },
-        { "natives", "native" },
-        { "nazarenes", "nazarene" },
-        { "nazarites", "nazarite" },
-        { "nazirites", "nazirite" },
-        { "nearing", "near" },
-        { "necked", "neck" },
-        { "necks", "neck" },
-        { "needed", "need" },
-        { "needest", "needs" },
-        { "needest", "needy" },
-        { "needing", "need" },
-        { "needs", "need" },
-        { "neglected", "neglect" },
-        { "neglecting", "neglect" },
-        { "neighbors", "neighbor" },
-        { "neighbours", "neighbour" },
-        { "neighed", "neigh" },
-        { "neighing", "neigh" },
-        { "neighings", "neighing" },
-        { "nephews", "nephew" },
-        { "nest", "nd" },
-        { "nest", "no" },
-        { "nests", "nest" },
-        { "nethinims", "nethinim" },
-        { "netophathites", "netophathite" },
-        { "nets", "net" },
-        { "networks", "network" },
-        { "news", "new" },
-        { "nights", "night" },
-        { "nobles", "noble" },
-        { "nod", "no" },
-        { "noised", "noise" },
-        { "noses", "nose" },
-        { "noted", "not" },
-        { "noted", "note" },
-        { "noticed", "notice" },
-        { "nourished", "nourish" },
-        { "nourishes", "nourish" },
-        { "nourishing", "nourish" },
-        { "numbered", "number" },
-        { "numberest", "numbers" },
-        { "numbering", "number" },
-        { "numbering", "number" },
-        { "numbering", "numbers" },
-        { "numbers", "number" },
-        { "nursed", "nurse" },
-        { "nursing", "nurse" },
-        { "nurtured", "nurture" },
-        { "nuts", "nut" },
-        { "oaks", "oak" },
-        { "oars", "oar" },
-        { "oaths", "oath" },
-        { "obeyed", "obey" },
-        { "obeying", "obey" },
-        { "obeying", "obeys" },
-        { "obeys", "obey" },
-        { "objects", "object" },
-        { "oblations", "oblation" },
-        { "observed", "observe" },
-        { "observers", "observer" },
-        { "observes", "observe" },
-        { "observest", "observe" },
-        { "observing", "observe" },
-        { "obtained", "obtain" },
-        { "obtaining", "obtain" },
-        { "obtaining", "obtains" },
-        { "obtains", "obtain" },
-        { "occasioned", "occasion" },
-        { "occasions", "occasion" },
-        { "odds", "odd" },
-        { "odors", "odor" },
-        { "odours", "odour" },
-        { "offences", "offence" },
-        { "offended", "offend" },
-        { "offenders", "offender" },
-        { "offenses", "offense" },
-        { "offered", "offer" },
-        { "offering", "offer" },
-        { "offering", "offers" },
-        { "offerings", "offering" },
-        { "offers", "offer" },
-        { "officers", "officer" },
-        { "offices", "office" },
-        { "officials", "official" },
-        { "oiled", "oil" },
-        { "oils", "oil" },
-        { "ointments", "ointment" },
-        { "olding", "old" },
-        { "olives", "olive" },
-        { "oliveyards", "oliveyard" },
-        { "omers", "omer" },
-        { "ones", "on" },
-        { "ones", "one" },
-        { "opened", "open" },
-        { "openest", "opens" },
-        { "opening", "open" },
-        { "opening", "open" },
-        { "opening", "opens" },
-        { "openings", "opening" },
-        { "opens", "open" },
-        { "operations", "operation" },
-        { "opinions", "opinion" },
-        { "opposed", "oppose" },
-        { "opposes", "oppose" },
-        { "opposest", "oppose" },
-        { "oppressed", "oppress" },
-        { "oppresses", "oppress" },
-        { "oppressing", "oppress" },
-        { "oppressions", "oppression" },
-        { "oppressors", "oppressor" },
-        { "oracles", "oracle" },
-        { "orchards", "orchard" },
-        { "ordained", "ordain" },
-        { "ordered", "order" },
-        { "ordering", "order" },
-        { "ordering", "orders" },
-        { "orderings", "ordering" },
-        { "orders", "order" },
-        { "ordinances", "ordinance" },
-        { "organs", "organ" },
-        { "ornaments", "ornament" },
-        { "ostriches", "ostrich" },
-        { "others", "other" },
-        { "oughting", "ought" },
-        { "ours", "our" },
-        { "outcasts", "outcast" },
-        { "ovens", "oven" },
-        { "overcharged", "overcharge" },
-        { "overcomes", "overcome" },
-        { "overflowed", "overflow" },
-        { "overflowing", "overflow" },
-        { "overflowing", "overflown" },
-        { "overflowing", "overflows" },
-        { "overflows", "overflow" },
-        { "overlaying", "overlay" },
-        { "overlaying", "overlays" },
-        { "overlays", "overlay" },
-        { "overlooked", "overlook" },
-        { "overlooks", "overlook" },
-        { "overseers", "overseer" },
-        { "overshadowed", "overshadow" },
-        { "overshadowing", "overshadow" },
-        { "overspreading", "overspread" },
-        { "overtakes", "overtake" },
-        { "overthrowing", "overthrow" },
-        { "overthrowing", "overthrown" },
-        { "overthrowing", "overthrows" },
-        { "overthrows", "overthrow" },
-        { "overturned", "overturn" },
-        { "overturns", "overturn" },
-        { "overwhelmed", "overwhelm" },
-        { "overwhelming", "overwhelm" },
-        { "owed", "owe" },
-        { "owes", "owe" },
-        { "owest", "owe" },
-        { "owest", "owl" },
-        { "owest", "own" },
-        { "owls", "owl" },
-        { "owners", "owner" },
-        { "owns", "own" },
-        { "paces", "pace" },
-        { "paid", "pai" },
-        { "pained", "pain" },
-        { "pains", "pain" },
-        { "painted", "paint" },
-        { "painting", "paint" },
-        { "pairs", "pair" },
-        { "palaces", "palace" },
-        { "palms", "palm" },
-        { "pans", "pan" },
-        { "panted", "pant" },
-        { "pants", "pant" },
-        { "parables", "parable" },
-        { "paralytics", "paralytic" },
-        { "pardoned", "pardon" },
-        { "pardons", "pardon" },
-        { "parlours", "parlour" },
-        { "partakers", "partaker" },
-        { "partakest", "partake" },
-        { "parted", "part" },
-        { "parting", "part" },
-        { "parting", "parts" },
-        { "parting", "party" },
-        { "partners", "partner" },
-        { "parts", "part" },
-        { "passages", "passage" },
-        { "passed", "pass" },
-        { "passes", "pass" },
-        { "passing", "pass" },
-        { "passing", "pass" },
-        { "passions", "passion" },
-        { "passovers", "passover" },
-        { "pastors", "pastor" },
-        { "pastures", "pasture" },
-        { "patched", "patch" },
-        { "paths", "path" },
-        { "patriarchs", "patriarch" },
-        { "patterns", "pattern" },
-        { "pavilions", "pavilion" },
-        { "paws", "paw" },
-        { "payed", "pay" },
-        { "paying", "pay" },
-        { "paying", "pays" },
-        { "pays", "pay" },
-        { "pearls", "pearl" },
-        { "peeped", "peep" },
-        { "pens", "pen" },
-        { "peoples", "people" },
-        { "perceived", "perceive" },
-        { "perceives", "perceive" },
-        { "perceivest", "perceive" },
-        { "perceiving", "perceive" },
-        { "perfected", "perfect" },
-        { "perfecting", "perfect" },
-        { "performed", "perform" },
-        { "performing", "perform" },
-        { "performing", "performs" },
-        { "performs", "perform" },
-        { "perfumed", "perfume" },
-        { "perfumers", "perfumer" },
-        { "perfumes", "perfume" },
-        { "perils", "peril" },
-        { "perished", "perish" },
-        { "perishes", "perish" },
-        { "perishing", "perish" },
-        { "perizzites", "perizzite" },
-        { "permits", "permit" },
-        { "persecuted", "persecute" },
-        { "persecutest", "persecute" },
-        { "persecuting", "persecute" },
-        { "persecutions", "persecution" },
-        { "persecutors", "persecutor" },
-        { "persians", "persian" },
-        { "persons", "person" },
-        { "persuaded", "persuade" },
-        { "persuades", "persuade" },
-        { "persuadest", "persuade" },
-        { "persuading", "persuade" },
-        { "pertained", "pertain" },
-        { "pertaining", "pertain" },
-        { "pertaining", "pertains" },
-        { "pertains", "pertain" },
-        { "perverted", "pervert" },
-        { "perverting", "pervert" },
-        { "perverting", "perverts" },
-        { "perverts", "pervert" },
-        { "pestilences", "pestilence" },
-        { "petitioned", "petition" },
-        { "petitions", "petition" },
-        { "pharisees", "pharisee" },
-        { "philistines", "philistine" },
-        { "physicians", "physician" },
-        { "picked", "pick" },
-        { "pieces", "piece" },
-        { "pierced", "pierce" },
-        { "piercing", "pierce" },
-        { "piercings", "piercing" },
-        { "pigeons", "pigeon" },
-        { "pigs", "pig" },
-        { "piled", "pile" },
-        { "pillars", "pillar" },
-        { "pillows", "pillow" },
-        { "pilots", "pilot" },
-        { "pining", "pin" },
-        { "pining", "pine" },
-        { "pining", "pins" },
-        { "pinnacles", "pinnacle" },
-        { "pins", "pin" },
-        { "piped", "pipe" },
-        { "pipes", "pipe" },
-        { "pirathonite", "pirathon" },
-        { "pitched", "pitch" },
-        { "pitchers", "pitcher" },
-        { "pits", "pit" },
-        { "placed", "place" },
-        { "places", "place" },
-        { "plagued", "plague" },
-        { "plagues", "plague" },
-        { "plains", "plain" },
-        { "plaistered", "plaister" },
-        { "planes", "plan" },
-        { "planes", "plane" },
-        { "plans", "plan" },
-        { "planted", "plant" },
-        { "planting", "plant" },
-        { "planting", "plants" },
-        { "plantings", "planting" },
-        { "plants", "plant" },
-        { "plastered", "plaster" },
-        { "plates", "plat" },
-        { "plates", "plate" },
-        { "plating", "plat" },
-        { "plating", "plate" },
-        { "platters", "platter" },
-        { "played", "play" },
-        { "players", "player" },
-        { "playing", "play" },
-        { "plead", "plea" },
-        { "pleaded", "plead" },
-        { "pleads", "plead" },
-        { "pleas", "plea" },
-        { "pleased", "pleas" },
-        { "pleased", "please" },
-        { "pleases", "pleas" },
-        { "pleases", "please" },
-        { "pleasing", "pleas" },
-        { "pleasing", "please" },
-        { "pleasures", "pleasure" },
-        { "pledged", "pledge" },
-        { "pledges", "pledge" },
-        { "plots", "plot" },
-        { "plowed", "plow" },
-        { "plowing", "plow" },
-        { "plowing", "plows" },
-        { "plows", "plow" },
-        { "plowshares", "plowshare" },
-        { "plucked", "pluck" },
-        { "plucking", "pluck" },
-        { "plucking", "pluckt" },
-        { "plundered", "plunder" },
-        { "plundering", "plunder" },
-        { "pointed", "point" },
-        { "points", "point" },
-        { "poisons", "poison" },
-        { "poles", "pole" },
-        { "polled", "poll" },
-        { "polls", "poll" },
-        { "polluted", "pollute" },
-        { "pollutes", "pollute" },
-        { "polluting", "pollute" },
-        { "pollutions", "pollution" },
-        { "pomegranates", "pomegranate" },
-        { "pondered", "ponder" },
-        { "pondering", "ponder" },
-        { "pools", "pool" },
-        { "pooring", "poor" },
-        { "poplars", "poplar" },
-        { "porches", "porch" },
-        { "porters", "porter" },
-        { "portions", "portion" },
-        { "portrayed", "portray" },
-        { "possessed", "possess" },
-        { "possesses", "possess" },
-        { "possessing", "possess" },
-        { "possessing", "possess" },
-        { "possessions", "possession" },
-        { "possessors", "possessor" },
-        { "posted", "post" },
-        { "posts", "post" },
-        { "pots", "pot" },
-        { "potsherds", "potsherd" },
-        { "potters", "potter" },
-        { "pounded", "pound" },
-        { "pounds", "pound" },
-        { "poured", "pour" },
-        { "pouring", "pour" },
-        { "pouring", "pours" },
-        { "pours", "pour" },
-        { "pourtrayed", "pourtray" },
-        { "powders", "powder" },
-        { "powers", "power" },
-        { "practiced", "practice" },
-        { "practices", "practice" },
-        { "practised", "practise" },
-        { "praised", "praise" },
-        { "praises", "praise" },
-        { "praising", "praise" },
-        { "prancings", "prancing" },
-        { "pransings", "pransing" },
-        { "prayed", "pray" },
-        { "prayers", "prayer" },
-        { "prayest", "prays" },
-        { "praying", "pray" },
-        { "praying", "pray" },
-        { "praying", "prays" },
-        { "prays", "pray" },
-        { "preached", "preach" },
-        { "preaches", "preach" },
-        { "preaching", "preach" },
-        { "preaching", "preach" },
-        { "precepts", "precept" },
-        { "predestinated", "predestinate" },
-        { "preparations", "preparation" },
-        { "prepared", "prepare" },
-        { "prepares", "prepare" },
-        { "preparest", "prepare" },
-        { "preparing", "prepare" },
-        { "presented", "present" },
-        { "presenting", "present" },
-        { "presenting", "presents" },
-        { "presents", "present" },
-        { "preserved", "preserve" },
-        { "preserves", "preserve" },
-        { "preservest", "preserve" },
-        { "pressed", "press" },
-        { "presses", "press" },
-        { "pressing", "press" },
-        { "presumed", "presume" },
-        { "pretended", "pretend" },
-        { "pretending", "pretend" },
-        { "prevailed", "prevail" },
-        { "prevailest", "prevails" },
-        { "prevailing", "prevail" },
-        { "prevails", "prevail" },
-        { "prevented", "prevent" },
-        { "preventing", "prevent" },
-        { "priced", "price" },
-        { "prices", "price" },
-        { "pricking", "pricks" },
-        { "priests", "priest" },
-        { "princes", "prince" },
-        { "princess", "princes" },
-        { "princesses", "princess" },
-        { "printed", "print" },
-        { "prisoners", "prisoner" },
-        { "prisons", "prison" },
-        { "prized", "prize" },
-        { "proceeded", "proceed" },
-        { "proceeding", "proceed" },
-        { "proceeding", "proceeds" },
-        { "proceeds", "proceed" },
-        { "proclaimed", "proclaim" },
-        { "proclaiming", "proclaim" },
-        { "proconsuls", "proconsul" },
-        { "procured", "procure" },
-        { "produced", "produce" },
-        { "produces", "produce" },
-        { "profaned", "profane" },
-        { "profanes", "profane" },
-        { "profaning", "profane" },
-        { "professed", "profess" },
-        { "professing", "profess" },
-        { "profited", "profit" },
-        { "profiting", "profit" },
-        { "profiting", "profits" },
-        { "profits", "profit" },
-        { "prolonged", "prolong" },
-        { "prolongs", "prolong" },
-        { "promised", "promise" },
-        { "promises", "promise" },
-        { "promising", "promise" },
-        { "promoted", "promote" },
-        { "promotes", "promote" },
-        { "pronounced", "pronounce" },
-        { "pronounces", "pronounce" },
-        { "pronouncing", "pronounce" },
-        { "proofs", "proof" },
-        { "prophesying", "prophesy" },
-        { "prophesyings", "prophesying" },
-        { "prophets", "prophet" },
-        { "proselytes", "proselyte" },
-        { "prospered", "prosper" },
-        { "prospers", "prosper" },
-        { "prostituted", "prostitute" },
-        { "prostitutes", "prostitute" },
-        { "protects", "protect" },
-        { "protested", "protest" },
-        { "protesting", "protest" },
-        { "proved", "prove" },
-        { "proverbs", "proverb" },
-        { "proves", "prove" },
-        { "provided", "provide" },
-        { "provides", "provide" },
-        { "providing", "provide" },
-        { "provinces", "province" },
-        { "proving", "prove" },
-        { "provisioned", "provision" },
-        { "provisions", "provision" },
-        { "provocations", "provocation" },
-        { "provoked", "provoke" },
-        { "provokes", "provoke" },
-        { "provoking", "provoke" },
-        { "pruned", "prune" },
-        { "prunes", "prune" },
-        { "pruning", "prune" },
-        { "psalms", "psalm" },
-        { "publicans", "publican" },
-        { "published", "publish" },
-        { "publishes", "publish" },
-        { "pulled", "pull" },
-        { "pulling", "pull" },
-        { "punished", "punish" },
-        { "punishing", "punish" },
-        { "punishments", "punishment" },
-        { "purchased", "purchase" },
-        { "purest", "pure" },
-        { "purged", "purge" },
-        { "purges", "purge" },
-        { "purging", "purge" },
-        { "purifications", "purification" },
-        { "purifying", "purify" },
-        { "puring", "pur" },
-        { "purposed", "purpose" },
-        { "purposes", "purpose" },
-        { "purposing", "purpose" },
-        { "purses", "purse" },
-        { "pursued", "pursue" },
-        { "pursuers", "pursuer" },
-        { "pursues", "pursue" },
-        { "pursuing", "pursue" },
-        { "pushed", "push" },
-        { "pushing", "push" },
-        { "puts", "put" },
-        { "quails", "quail" },
-        { "quaked", "quake" },
-        { "quakes", "quake" },
-        { "quaking", "quake" },
-        { "quarreled", "quarrel" },
-        { "quarreling", "quarrel" },
-        { "quarreling", "quarrels" },
-        { "quarrels", "quarrel" },
-        { "quarters", "quarter" },
-        { "queens", "queen" },
-        { "quenched", "quench" },
-        { "questioned", "question" },
-        { "questioning", "question" },
-        { "questioning", "questions" },
-        { "questionings", "questioning" },
-        { "questions", "question" },
-        { "quickened", "quicken" },
-        { "quickening", "quicken" },
-        { "quieted", "quiet" },
-        { "quivered", "quiver" },
-        { "quivering", "quiver" },
-        { "raged", "rage" },
-        { "rages", "rage" },
-        { "raging", "rage" },
-        { "raging", "rags" },
-        { "railed", "rail" },
-        { "railing", "rail" },
-        { "railings", "railing" },
-        { "rained", "rain" },
-        { "rains", "rain" },
-        { "raised", "raise" },
-        { "raises", "raise" },
-        { "raising", "raise" },
-        { "raisins", "raisin" },
-        { "ramathite", "ramath" },
-        { "ramparts", "rampart" },
-        { "rams", "ram" },
-        { "ranges", "rang" },
-        { "ranges", "range" },
-        { "ranging", "rang" },
-        { "ranging", "range" },
-        { "ranks", "rank" },
-        { "ransomed", "ransom" },
-        { "rated", "rate" },
-        { "ravaged", "ravage" },
-        { "ravages", "ravage" },
-        { "ravening", "raven" },
-        { "ravening", "ravens" },
-        { "ravens", "raven" },
-        { "reached", "reach" },
-        { "reaches", "reach" },
-        { "reaching", "reach" },
-        { "readest", "reads" },
-        { "readest", "ready" },
-        { "reading", "read" },
-        { "reading", "read" },
-        { "reading", "reads" },
-        { "reading", "ready" },
-        { "reads", "read" },
-        { "reaped", "reap" },
-        { "reapers", "reaper" },
-        { "reapest", "reaps" },
-        { "reaping", "reap" },
-        { "reaping", "reap" },
-        { "reaping", "reaps" },
-        { "reaps", "reap" },
-        { "reared", "rear" },
-        { "reasoned", "reason" },
-        { "reasoning", "reason" },
-        { "reasoning", "reasons" },
-        { "reasons", "reason" },
-        { "rebels", "rebel" },
-        { "rebuked", "rebuke" },
-        { "rebukes", "rebuke" },
-        { "rebuking", "rebuke" },
-        { "received", "receive" },
-        { "receives", "receive" },
-        { "receiving", "receive" },
-        { "reckoned", "reckon" },
-        { "reckoning", "reckon" },
-        { "reclining", "recline" },
-        { "recognized", "recognize" },
-        { "recognizing", "recognize" },
-        { "recompences", "recompence" },
-        { "recompensed", "recompense" },
-        { "recompenses", "recompense" },
-        { "recompensest", "recompense" },
-        { "recompensing", "recompense" },
-        { "reconciled", "reconcile" },
-        { "reconciling", "reconcile" },
-        { "recorded", "record" },
-        { "records", "record" },
-        { "recounted", "recount" },
-        { "recovered", "recover" },
-        { "recovering", "recover" },
-        { "redeemed", "redeem" },
-        { "redeeming", "redeem" },
-        { "redeeming", "redeems" },
-        { "redeems", "redeem" },
-        { "reeds", "reed" },
-        { "reeling", "reel" },
-        { "refined", "refine" },
-        { "refining", "refine" },
-        { "reflects", "reflect" },
-        { "refrained", "refrain" },
-        { "refreshed", "refresh" },
-        { "refreshes", "refresh" },
-        { "refreshing", "refresh" },
-        { "refused", "refuse" },
-        { "refuses", "refuse" },
-        { "refuted", "refute" },
-        { "regarded", "regard" },
-        { "regardest", "regards" },
-        { "regarding", "regard" },
-        { "regarding", "regard" },
-        { "regarding", "regards" },
-        { "regards", "regard" },
-        { "regions", "region" },
-        { "rehearsed", "rehearse" },
-        { "reigned", "reign" },
-        { "reignest", "reigns" },
-        { "reigning", "reign" },
-        { "reigning", "reign" },
-        { "reigning", "reigns" },
-        { "reigns", "reign" },
-        { "rejected", "reject" },
-        { "rejects", "reject" },
-        { "rejoiced", "rejoice" },
-        { "rejoices", "rejoice" },
-        { "rejoicest", "rejoice" },
-        { "rejoicing", "rejoice" },
-        { "relatives", "relative" },
-        { "released", "release" },
-        { "relents", "relent" },
-        { "relieved", "relieve" },
-        { "remained", "remain" },
-        { "remainest", "remains" },
-        { "remaining", "remain" },
-        { "remaining", "remain" },
-        { "remaining", "remains" },
-        { "remains", "remain" },
-        { "remembered", "remember" },
-        { "rememberest", "remembers" },
-        { "remembering", "remember" },
-        { "remembering", "remember" },
-        { "remembering", "remembers" },
-        { "remembers", "remember" },
-        { "remembrances", "remembrance" },
-        { "reminded", "remind" },
-        { "reminding", "remind" },
-        { "removed", "remove" },
-        { "removes", "remove" },
-        { "removing", "remove" },
-        { "rendered", "render" },
-        { "renderest", "renders" },
-        { "rendering", "render" },
-        { "rendering", "render" },
-        { "rendering", "renders" },
-        { "renders", "render" },
-        { "rending", "rend" },
-        { "renewed", "renew" },
-        { "renewing", "renew" },
-        { "renewing", "renew" },
-        { "renounced", "renounce" },
-        { "renounces", "renounce" },
-        { "renowned", "renown" },
-        { "rented", "rent" },
-        { "renting", "rent" },
-        { "repaired", "repair" },
-        { "repairers", "repairer" },
-        { "repairing", "repair" },
-        { "repayed", "repay" },
-        { "repays", "repay" },
-        { "repented", "repent" },
-        { "repentest", "repents" },
-        { "repenting", "repent" },
-        { "repenting", "repent" },
-        { "repenting", "repents" },
-        { "repentings", "repenting" },
-        { "repents", "repent" },
-        { "rephaims", "rephaim" },
-        { "replenished", "replenish" },
-        { "reported", "report" },
-        { "reporting", "report" },
-        { "reproached", "reproach" },
-        { "reproaches", "reproach" },
-        { "reproaching", "reproach" },
-        { "reprobates", "reprobate" },
-        { "reproofs", "reproof" },
-        { "reproved", "reprove" },
-        { "reproves", "reprove" },
-        { "requested", "request" },
-        { "requesting", "request" },
-        { "requesting", "requests" },
-        { "requests", "request" },
-        { "required", "require" },
-        { "requires", "require" },
-        { "requirest", "require" },
-        { "requiring", "require" },
-        { "requited", "requite" },
-        { "requiting", "requite" },
-        { "rescued", "rescue" },
-        { "rescues", "rescue" },
-        { "resembled", "resemble" },
-        { "reserved", "reserve" },
-        { "resisted", "resist" },
-        { "resists", "resist" },
-        { "resorted", "resort" },
-        { "respected", "respect" },
-        { "respects", "respect" },
-        { "responded", "respond" },
-        { "rested", "rest" },
-        { "restest", "rests" },
-        { "resting", "rest" },
-        { "resting", "rest" },
-        { "resting", "rests" },
-        { "restored", "restore" },
-        { "restores", "restore" },
-        { "restoring", "restore" },
-        { "restrained", "restrain" },
-        { "restrainest", "restrains" },
-        { "restrainest", "restraint" },
-        { "restraining", "restrain" },
-        { "restraining", "restrain" },
-        { "restraining", "restrains" },
-        { "restraining", "restraint" },
-        { "restrains", "restrain" },
-        { "rests", "rest" },
-        { "results", "result" },
-        { "retained", "retain" },
-        { "retains", "retain" },
-        { "retired", "retire" },
-        { "returned", "return" },
-        { "returning", "return" },
-        { "returning", "returns" },
-        { "returns", "return" },
-        { "reubenite", "reuben" },
-        { "reubenites", "reubenite" },
-        { "revealed", "reveal" },
-        { "reveals", "reveal" },
-        { "revelations", "revelation" },
-        { "reveling", "revel" },
-        { "revenged", "revenge" },
-        { "revengers", "revenger" },
-        { "revenges", "revenge" },
-        { "revenging", "revenge" },
-        { "revenues", "revenue" },
-        { "reverenced", "reverence" },
-        { "reviled", "revile" },
-        { "reviles", "revile" },
-        { "revilest", "revile" },
-        { "reviling", "revile" },
-        { "revilings", "reviling" },
-        { "revived", "revive" },
-        { "reviving", "revive" },
-        { "revolted", "revolt" },
-        { "revolting", "revolt" },
-        { "rewarded", "reward" },
-        { "rewards", "reward" },
-        { "ribs", "rib" },
-        { "riches", "rich" },
-        { "riching", "rich" },
-        { "riddles", "riddle" },
-        { "riders", "rider" },
-        { "rides", "rid" },
-        { "rides", "ride" },
-        { "riding", "rid" },
-        { "riding", "ride" },
-        { "righteousnesses", "righteousness" },
-        { "rights", "right" },
-        { "rims", "rim" },
-        { "rings", "ring" },
-        { "rioting", "riot" },
-        { "rioting", "riots" },
-        { "riots", "riot" },
-        { "ripening", "ripens" },
-        { "rises", "rise" },
-        { "risest", "rise" },
-        { "rising", "rise" },
-        { "rivers", "river" },
-        { "roaming", "roams" },
-        { "roared", "roar" },
-        { "roaring", "roar" },
-        { "roaring", "roars" },
-        { "roarings", "roaring" },
-        { "roars", "roar" },
-        { "roasted", "roast" },
-        { "roasts", "roast" },
-        { "robbers", "robber" },
-        { "robes", "rob" },
-        { "robes", "robe" },
-        { "robs", "rob" },
-        { "rocks", "rock" },
-        { "rods", "rod" },
-        { "roebucks", "roebuck" },
-        { "roes", "roe" },
-        { "rolled", "roll" },
-        { "rolling", "roll" },
-        { "rolling", "rolls" },
-        { "rolls", "roll" },
-        { "romans", "roman" },
-        { "roofs", "roof" },
-        { "rooms", "room" },
-        { "rooted", "root" },
-        { "roots", "root" },
-        { "ropes", "rope" },
-        { "rots", "rot" },
-        { "rounded", "round" },
-        { "roused", "rouse" },
-        { "routed", "rout" },
-        { "rowed", "row" },
-        { "rowing", "row" },
-        { "rowing", "rows" },
-        { "rows", "row" },
-        { "ruined", "ruin" },
-        { "ruins", "ruin" },
-        { "ruled", "rule" },
-        { "rulers", "ruler" },
-        { "rules", "rule" },
-        { "rulest", "rule" },
-        { "ruling", "rule" },
-        { "rumors", "rumor" },
-        { "rumours", "rumour" },
-        { "runs", "run" },
-        { "rushed", "rush" },
-        { "rushes", "rush" },
-        { "rushing", "rush" },
-        { "sabbaths", "sabbath" },
-        { "sackclothes", "sackcloth" },
-        { "sacks", "sack" },
-        { "sacrificed", "sacrifice" },
-        { "sacrifices", "sacrifice" },
-        { "sacrificing", "sacrifice" },
-        { "saddled", "saddle" },
-        { "sailed", "sail" },
-        { "sailing", "sail" },
-        { "sailing", "sails" },
-        { "sails", "sail" },
-        { "saints", "saint" },
-        { "sakes", "sake" },
-        { "salted", "salt" },
-        { "salutations", "salutation" },
-        { "saluted", "salute" },
-        { "salutes", "salute" },
-        { "samaritans", "samaritan" },
-        { "sandals", "sandal" },
-        { "sapphires", "sapphire" },
-        { "sashes", "sash" },
-        { "sated", "sat" },
-        { "satest", "sata" },
-        { "satiated", "satiate" },
-        { "sating", "sat" },
-        { "satisfying", "satisfy" },
-        { "satyrs", "satyr" },
-        { "saved", "save" },
-        { "saves", "save" },
-        { "savest", "save" },
-        { "saving", "save" },
-        { "saviors", "savior" },
-        { "saviours", "saviour" },
-        { "savourest", "savours" },
-        { "savourest", "savoury" },
-        { "savouring", "savour" },
-        { "savours", "savour" },
-        { "sawed", "saw" },
-        { "sawest", "sawn" },
-        { "sawest", "saws" },
-        { "sawing", "saw" },
-        { "saws", "saw" },
-        { "sayest", "says" },
-        { "saying", "say" },
-        { "saying", "say" },
-        { "saying", "says" },
-        { "sayings", "saying" },
-        { "says", "say" },
-        { "scared", "scar" },
-        { "scaring", "scar" },
-        { "scattered", "scatter" },
-        { "scattering", "scatter" },
-        { "scattering", "scatters" },
-        { "scatters", "scatter" },
-        { "scepters", "scepter" },
-        { "sceptres", "sceptre" },
-        { "schemes", "scheme" },
-        { "scoffed", "scoff" },
-        { "scoffers", "scoffer" },
-        { "scoffing", "scoff" },
-        { "scoffing", "scoffs" },
-        { "scoffs", "scoff" },
-        { "scorched", "scorch" },
-        { "scorching", "scorch" },
-        { "scorned", "scorn" },
-        { "scorners", "scorner" },
-        { "scornest", "scorns" },
-        { "scorning", "scorn" },
-        { "scorning", "scorn" },
-        { "scorning", "scorns" },
-        { "scorns", "scorn" },
-        { "scorpions", "scorpion" },
-        { "scourged", "scourge" },
-        { "scourges", "scourge" },
-        { "scourging", "scourge" },
-        { "scourgings", "scourging" },
-        { "scraped", "scrape" },
-        { "screened", "screen" },
-        { "scribes", "scribe" },
-        { "scriptures", "scripture" },
-        { "sealed", "seal" },
-        { "sealest", "seals" },
-        { "sealing", "seal" },
-        { "sealing", "seal" },
-        { "sealing", "seals" },
-        { "seals", "seal" },
-        { "seams", "seam" },
-        { "searched", "search" },
-        { "searches", "search" },
-        { "searching", "search" },
-        { "searching", "search" },
-        { "searchings", "searching" },
-        { "seas", "sea" },
-        { "seasoned", "season" },
-        { "seasons", "season" },
-        { "seated", "seat" },
-        { "seats", "seat" },
-        { "secrets", "secret" },
-        { "secured", "secure" },
-        { "seditions", "sedition" },
-        { "seduced", "seduce" },
-        { "seduces", "seduce" },
-        { "seducing", "seduce" },
-        { "seed", "see" },
-        { "seeds", "seed" },
-        { "seeing", "see" },
-        { "seeing", "seed" },
-        { "seeing", "seek" },
-        { "seeing", "seem" },
-        { "seeing", "seen" },
-        { "seeing", "seer" },
-        { "seeing", "sees" },
-        { "seekest", "seeks" },
-        { "seeking", "seek" },
-        { "seeking", "seek" },
-        { "seeking", "seeks" },
-        { "seeks", "seek" },
-        { "seemed", "seem" },
-        { "seems", "seem" },
-        { "seers", "seer" },
-        { "sees", "see" },
-        { "seest", "sea" },
-        { "seest", "see" },
-        { "seest", "sem" },
-        { "seest", "set" },
-        { "seest", "sew" },
-        { "seest", "sex" },
-        { "seething", "seeth" },
-        { "seething", "seethe" },
-        { "seized", "seize" },
-        { "seizes", "seize" },
-        { "selfwilled", "selfwill" },
-        { "sellers", "seller" },
-        { "sellest", "sells" },
-        { "selling", "sell" },
-        { "selling", "sell" },
-        { "selling", "sells" },
-        { "sells", "sell" },
-        { "sendest", "sends" },
-        { "sending", "send" },
-        { "sending", "send" },
-        { "sending", "sends" },
-        { "sends", "send" },
-        { "senses", "sense" },
-        { "sentenced", "sentence" },
-        { "sentences", "sentence" },
-        { "senting", "sent" },
-        { "separated", "separate" },
-        { "separates", "separate" },
-        { "separating", "separate" },
-        { "sepulchres", "sepulchre" },
-        { "seraphims", "seraphim" },
-        { "serpents", "serpent" },
-        { "servants", "servant" },
-        { "served", "serve" },
-        { "serves", "serve" },
-        { "servest", "serve" },
-        { "services", "service" },
-        { "serving", "serve" },
-        { "sets", "set" },
-        { "settings", "setting" },
-        { "settled", "settle" },
-        { "settles", "settle" },
-        { "settlest", "settle" },
-        { "sevens", "seven" },
-        { "severed", "sever" },
-        { "severed", "severe" },
-        { "sewed", "sew" },
-        { "sewest", "sews" },
-        { "sewing", "sew" },
-        { "sews", "sew" },
-        { "shadowing", "shadow" },
-        { "shadowing", "shadows" },
-        { "shadows", "shadow" },
-        { "shafts", "shaft" },
-        { "shaked", "shake" },
-        { "shakes", "shake" },
-        { "shaking", "shake" },
-        { "shamed", "shame" },
-        { "shames", "shame" },
-        { "shapes", "shape" },
-        { "shared", "share" },
-        { "shares", "share" },
-        { "sharing", "share" },
-        { "sharing", "sharp" },
-        { "sharonite", "sharon" },
-        { "sharpened", "sharpen" },
-        { "sharpens", "sharpen" },
-        { "shaved", "shave" },
-        { "shearers", "shearer" },
-        { "shearing", "shear" },
-        { "sheathed", "sheath" },
-        { "shed", "she" },
-        { "sheds", "shed" },
-        { "sheepcotes", "sheepcote" },
-        { "sheepfolds", "sheepfold" },
-        { "sheets", "sheet" },
-        { "shekels", "shekel" },
-        { "shelters", "shelter" },
-        { "shemed", "shem" },
-        { "shemite", "shem" },
-        { "shepherd", "shepher" },
-        { "shepherds", "shepherd" },
-        { "sherds", "sherd" },
-        { "shewed", "shew" },
-        { "shewing", "shew" },
-        { "shewing", "shew" },
-        { "shields", "shield" },
-        { "shilonites", "shilonite" },
-        { "shined", "shine" },
-        { "shined", "shine" },
-        { "shines", "shine" },
-        { "shines", "shine" },
-        { "shining", "shine" },
-        { "shining", "shine" },
-        { "ships", "ship" },
-        { "shocks", "shock" },
-        { "shoes", "shoe" },
-        { "shooting", "shoot" },
-        { "shooting", "shoots" },
-        { "shoots", "shoot" },
-        { "shores", "shore" },
-        { "shoulders", "shoulder" },
-        { "shouldest", "shouldn" },
-        { "shoulding", "should" },
-        { "shouted", "shout" },
-        { "shouting", "shout" },
-        { "shouting", "shouts" },
-        { "shoutings", "shouting" },
-        { "shouts", "shout" },
-        { "shovels", "shovel" },
-        { "showed", "show" },
-        { "showers", "shower" },
-        { "showing", "show" },
-        { "showing", "shown" },
-        { "showing", "shows" },
-        { "shows", "show" },
-        { "shrines", "shrine" },
-        { "shrinks", "shrink" },
-        { "shuns", "shun" },
-        { "shuts", "shut" },
-        { "sicknesses", "sickness" },
-        { "sided", "side" },
-        { "sides", "side" },
-        { "sifted", "sift" },
-        { "sighed", "sigh" },
-        { "sighest", "sighs" },
-        { "sighest", "sight" },
-        { "sighing", "sigh" },
-        { "sighing", "sigh" },
-        { "sighing", "sighs" },
-        { "sighing", "sight" },
-        { "sighs", "sigh" },
-        { "sights", "sight" },
-        { "signals", "signal" },
-        { "signed", "sign" },
-        { "signets", "signet" },
-        { "signifying", "signify" },
-        { "signs", "sign" },
-        { "silenced", "silence" },
-        { "similitudes", "similitude" },
-        { "sinews", "sinew" },
-        { "sing", "s" },
-        { "sing", "so" },
-        { "singed", "sing" },
-        { "singers", "singer" },
-        { "singing", "sing" },
-        { "singing", "sings" },
-        { "sings", "sing" },
-        { "sinite", "sin" },
-        { "sinks", "sink" },
-        { "sinners", "sinner" },
-        { "sins", "sin" },
-        { "sirs", "sir" },
-        { "sisters", "sister" },
-        { "sits", "sit" },
-        { "situated", "situate" },
-        { "skilled", "skill" },
-        { "skins", "skin" },
-        { "skirts", "skirt" },
-        { "slacked", "slack" },
-        { "slandered", "slander" },
-        { "slanderers", "slanderer" },
-        { "slanderest", "slanders" },
-        { "slandering", "slander" },
-        { "slanders", "slander" },
-        { "slaughtered", "slaughter" },
-        { "slaves", "slave" },
-        { "slaying", "slay" },
-        { "slaying", "slays" },
-        { "slays", "slay" },
-        { "sleepest", "sleeps" },
-        { "sleeping", "sleep" },
-        { "sleeping", "sleep" },
-        { "sleeping", "sleeps" },
-        { "sleeps", "sleep" },
-        { "slewing", "slew" },
-        { "slinging", "sling" },
-        { "slinging", "slings" },
-        { "slings", "sling" },
-        { "slips", "slip" },
-        { "slopes", "slope" },
-        { "slumbered", "slumber" },
-        { "slumbering", "slumber" },
-        { "slumberings", "slumbering" },
-        { "smalling", "small" },
-        { "smelled", "smell" },
-        { "smelling", "smell" },
-        { "smelling", "smells" },
-        { "smells", "smell" },
-        { "smiled", "smile" },
-        { "smitest", "smite" },
-        { "smitest", "smith" },
-        { "smiths", "smith" },
-        { "smiting", "smite" },
-        { "smiting", "smith" },
-        { "smoked", "smoke" },
-        { "smoking", "smoke" },
-        { "smoothes", "smooth" },
-        { "smotest", "smote" },
-        { "snared", "snare" },
-        { "snares", "snare" },
-        { "snatched", "snatch" },
-        { "snatches", "snatch" },
-        { "snatching", "snatch" },
-        { "snorting", "snorts" },
-        { "snowed", "snow" },
-        { "snuffed", "snuff" },
-        { "snuffs", "snuff" },
-        { "sockets", "socket" },
-        { "sod", "so" },
-        { "sodomite", "sodom" },
-        { "sodomites", "sodomite" },
-        { "sojourned", "sojourn" },
-        { "sojourners", "sojourner" },
-        { "sojourning", "sojourn" },
-        { "sojourning", "sojourns" },
-        { "sojourns", "sojourn" },
-        { "soldiers", "soldier" },
-        { "soles", "sole" },
-        { "sometimes", "sometime" },
-        { "songs", "song" },
-        { "sons", "son" },
-        { "soothsayers", "soothsayer" },
-        { "sorcerers", "sorcerer" },
-        { "sores", "sore" },
-        { "sorrowed", "sorrow" },
-        { "sorrowing", "sorrow" },
-        { "sorrowing", "sorrows" },
-        { "sorrows", "sorrow" },
-        { "sorts", "sort" },
-        { "souls", "soul" },
-        { "sounded", "sound" },
-        { "sounding", "sound" },
-        { "sounding", "sounds" },
-        { "soundings", "sounding" },
-        { "sounds", "sound" },
-        { "sowed", "sow" },
-        { "sowest", "sown" },
-        { "sowest", "sows" },
-        { "sowing", "sow" },
-        { "sowing", "sow" },
-        { "sowing", "sown" },
-        { "sowing", "sows" },
-        { "sows", "sow" },
-        { "spakest", "spake" },
-        { "spared", "spare" },
-        { "spares", "spare" },
-        { "sparing", "spare" },
-        { "sparing", "spark" },
-        { "sparks", "spark" },
-        { "sparrows", "sparrow" },
-        { "speakest", "speaks" },
-        { "speaking", "speak" },
-        { "speaking", "speak" },
-        { "speaking", "speaks" },
-        { "speakings", "speaking" },
-        { "speaks", "speak" },
-        { "spears", "spear" },
-        { "speeches", "speech" },
-        { "spendest", "spends" },
-        { "spending", "spend" },
-        { "spends", "spend" },
-        { "spewed", "spew" },
-        { "spewing", "spew" },
-        { "spiced", "spice" },
-        { "spices", "spice" },
-        { "spirits", "spirit" },
-        { "splits", "split" },
-        { "spoiled", "spoil" },
-        { "spoilers", "spoiler" },
-        { "spoilest", "spoils" },
-        { "spoiling", "spoil" },
-        { "spoiling", "spoil" },
-        { "spoiling", "spoils" },
-        { "spoils", "spoil" },
-        { "spokes", "spoke" },
-        { "spoons", "spoon" },
-        { "sporting", "sport" },
-        { "spots", "spot" },
-        { "spouses", "spouse" },
-        { "spreadest", "spreads" },
-        { "spreading", "spread" },
-        { "spreading", "spread" },
-        { "spreading", "spreads" },
-        { "spreadings", "spreading" },
-        { "spreads", "spread" },
-        { "springing", "spring" },
-        { "springing", "springs" },
-        { "springs", "spring" },
-        { "sprinkled", "sprinkle" },
-        { "sprinkles", "sprinkle" },
-        { "sprinkling", "sprinkle" },
-        { "sprouts", "sprout" },
-        { "spued", "spue" },
-        { "spying", "spy" },
-        { "squared", "square" },
-        { "squares", "square" },
-        { "stablished", "stablish" },
-        { "staffs", "staff" },
-        { "staggered", "stagger" },
-        { "staggering", "stagger" },
-        { "staggering", "staggers" },
-        { "staggers", "stagger" },
-        { "stained", "stain" },
-        { "stalks", "stalk" },
-        { "stalled", "stall" },
-        { "stalls", "stall" },
-        { "stamped", "stamp" },
-        { "stamping", "stamp" },
-        { "standards", "standard" },
-        { "standest", "stands" },
-        { "standing", "stand" },
-        { "standing", "stand" },
-        { "standing", "stands" },
-        { "stands", "stand" },
-        { "stars", "star" },
-        { "starting", "start" },
-        { "statutes", "statute" },
-        { "stayed", "stay" },
-        { "staying", "stay" },
-        { "staying", "stays" },
-        { "stays", "stay" },
-        { "steads", "stead" },
-        { "stealing", "steal" },
-        { "stealing", "steals" },
-        { "steals", "steal" },
-        { "steeds", "steed" },
-        { "steps", "step" },
-        { "stewards", "steward" },
-        { "sticks", "stick" },
-        { "stilled", "still" },
-        { "stillest", "stills" },
-        { "stilling", "still" },
-        { "stills", "still" },
-        { "stings", "sting" },
-        { "stinking", "stink" },
-        { "stirs", "stir" },
-        { "stocks", "stock" },
-        { "stoned", "stone" },
-        { "stones", "stone" },
-        { "stonest", "stone" },
-        { "stonest", "stony" },
-        { "stoning", "stone" },
-        { "stoning", "stony" },
-        { "stooding", "stood" },
-        { "stools", "stool" },
-        { "stooped", "stoop" },
-        { "stooping", "stoop" },
-        { "stooping", "stoops" },
-        { "stoops", "stoop" },
-        { "stops", "stop" },
-        { "stored", "store" },
-        { "storehouses", "storehouse" },
-        { "stores", "store" },
-        { "strained", "strain" },
-        { "straitened", "straiten" },
-        { "straitest", "straits" },
-        { "straiting", "strait" },
-        { "straits", "strait" },
-        { "strakes", "strake" },
-        { "strangers", "stranger" },
-        { "strawed", "straw" },
-        { "streams", "stream" },
-        { "streets", "street" },
-        { "strengthened", "strengthen" },
-        { "strengthening", "strengthen" },
-        { "strengthening", "strengthens" },
-        { "strengthens", "strengthen" },
-        { "stretched", "stretch" },
-        { "stretches", "stretch" },
-        { "stretching", "stretch" },
-        { "stretching", "stretch" },
-        { "stricting", "strict" },
-        { "strifes", "strife" },
-        { "strikers", "striker" },
-        { "strikes", "strike" },
-        { "striking", "strike" },
-        { "stringed", "string" },
-        { "strings", "string" },
-        { "striped", "strip" },
-        { "striped", "stripe" },
-        { "stripes", "strip" },
-        { "stripes", "stripe" },
-        { "strips", "strip" },
-        { "strived", "strive" },
-        { "strives", "strive" },
-        { "striving", "strive" },
-        { "strivings", "striving" },
-        { "strokes", "stroke" },
-        { "strongholds", "stronghold" },
-        { "stronging", "strong" },
-        { "struggled", "struggle" },
-        { "struggles", "struggle" },
-        { "studs", "stud" },
-        { "stumbled", "stumble" },
-        { "stumbles", "stumble" },
-        { "stumbling", "stumble" },
-        { "stumblingblocks", "stumblingblock" },
-        { "stumblings", "stumbling" },
-        { "subdued", "subdue" },
-        { "subdues", "subdue" },
-        { "subjected", "subject" },
-        { "subjecting", "subject" },
-        { "subscribed", "subscribe" },
-        { "subverted", "subvert" },
-        { "subverting", "subvert" },
-        { "subverting", "subverts" },
-        { "subverts", "subvert" },
-        { "succeeded", "succeed" },
-        { "succeeding", "succeed" },
-        { "succoured", "succour" },
-        { "sucked", "suck" },
-        { "sucking", "suck" },
-        { "sucklings", "suckling" },
-        { "sues", "sue" },
-        { "suffered", "suffer" },
-        { "sufferest", "suffers" },
-        { "suffering", "suffer" },
-        { "suffering", "suffer" },
-        { "suffering", "suffers" },
-        { "sufferings", "suffering" },
-        { "suffers", "suffer" },
-        { "sufficed", "suffice" },
-        { "suits", "suit" },
-        { "sukkiims", "sukkiim" },
-        { "summoned", "summon" },
-        { "summons", "summon" },
-        { "sundered", "sunder" },
-        { "sunrising", "sunrise" },
-        { "supplanted", "supplant" },
-        { "supplications", "supplication" },
-        { "supported", "support" },
-        { "supports", "support" },
-        { "supposed", "suppose" },
-        { "supposing", "suppose" },
-        { "surnamed", "surname" },
-        { "surrounded", "surround" },
-        { "surrounding", "surround" },
-        { "surrounding", "surrounds" },
-        { "surrounds", "surround" },
-        { "sustained", "sustain" },
-        { "sustains", "sustain" },
-        { "swallowed", "swallow" },
-        { "swallows", "swallow" },
-        { "swarest", "sware" },
-        { "swarest", "swarm" },
-        { "swarmed", "swarm" },
-        { "swarming", "swarm" },
-        { "swarming", "swarms" },
-        { "swarms", "swarm" },
-        { "sways", "sway" },
-        { "swearing", "swear" },
-        { "swearing", "swears" },
-        { "swears", "swear" },
-        { "sweeping", "sweep" },
-        { "sweeping", "sweeps" },
-        { "sweeps", "sweep" },
-        { "swelled", "swell" },
-        { "swelling", "swell" },
-        { "swelling", "swells" },
-        { "swellings", "swelling" },
-        { "swells", "swell" },
-        { "swerved", "swerve" },
-        { "swims", "swim" },
-        { "swooned", "swoon" },
-        { "swords", "sword" },
-        { "sycamores", "sycamore" },
-        { "sycomores", "sycomore" },
-        { "symbols", "symbol" },
-        { "synagogues", "synagogue" },
-        { "syrians", "syrian" },
-        { "tabernacles", "tabernacle" },
-        { "tables", "table" },
-        { "tablets", "tablet" },
-        { "tabrets", "tabret" },
-        { "tackling", "tackle" },
-        { "tacklings", "tackling" },
-        { "tails", "tail" },
-        { "takes", "take" },
-        { "takest", "take" },
-        { "taking", "take" },
-        { "talents", "talent" },
-        { "tales", "tale" },
-        { "talked", "talk" },
-        { "talkest", "talks" },
-        { "talking", "talk" },
-        { "talking", "talk" },
-        { "talking", "talks" },
-        { "talks", "talk" },
-        { "tambourines", "tambourine" },
-        { "tamed", "tame" },
-        { "tares", "tar" },
-        { "tares", "tare" },
-        { "targets", "target" },
-        { "tarrying", "tarry" },
-        { "taskmasters", "taskmaster" },
-        { "tasks", "task" },
-        { "tasted", "taste" },
-        { "tastes", "taste" },
-        { "taunting", "taunt" },
-        { "taunting", "taunts" },
-        { "taunts", "taunt" },
-        { "taxed", "tax" },
-        { "taxes", "tax" },
-        { "taxing", "tax" },
-        { "teachers", "teacher" },
-        { "teaches", "teach" },
-        { "teaching", "teach" },
-        { "teaching", "teach" },
-        { "teachings", "teaching" },
-        { "tearing", "tear" },
-        { "tearing", "tears" },
-        { "tears", "tear" },
-        { "tekoites", "tekoite" },
-        { "tellest", "tells" },
-        { "telling", "tell" },
-        { "telling", "tell" },
-        { "telling", "tells" },
-        { "tells", "tell" },
-        { "temanite", "teman" },
-        { "temanites", "temanite" },
-        { "tempered", "temper" },
-        { "tempest", "tempt" },
-        { "temples", "temple" },
-        { "temptations", "temptation" },
-        { "tempted", "tempt" },
-        { "tempting", "tempt" },
-        { "tempting", "tempts" },
-        { "tempts", "tempt" },
-        { "tend", "ten" },
-        { "tends", "tend" },
-        { "tens", "ten" },
-        { "tents", "tent" },
-        { "terebinths", "terebinth" },
-        { "terrors", "terror" },
-        { "test", "to" },
-        { "tested", "test" },
-        { "testifying", "testify" },
-        { "testing", "test" },
-        { "testing", "tests" },
-        { "tests", "test" },
-        { "thanked", "thank" },
-        { "thanking", "thank" },
-        { "thanking", "thanks" },
-        { "thanks", "thank" },
-        { "thanksgivings", "thanksgiving" },
-        { "thefts", "theft" },
-        { "theirs", "their" },
-        { "thickets", "thicket" },
-        { "thighs", "thigh" },
-        { "thing", "the" },
-        { "thing", "thy" },
-        { "things", "thing" },
-        { "thinkest", "thinks" },
-        { "thinking", "think" },
-        { "thinking", "think" },
-        { "thinking", "thinks" },
-        { "thinks", "think" },
-        { "thirsted", "thirst" },
-        { "thirsts", "thirst" },
-        { "thistles", "thistle" },
-        { "thongs", "thong" },
-        { "thorns", "thorn" },
-        { "thoughtest", "thoughts" },
-        { "thoughting", "thought" },
-        { "thoughts", "thought" },
-        { "thousands", "thousand" },
-        { "threatened", "threaten" },
-        { "threatening", "threaten" },
-        { "threatenings", "threatening" },
-        { "threats", "threat" },
-        { "threshed", "thresh" },
-        { "threshes", "thresh" },
-        { "threshing", "thresh" },
-        { "threshingfloors", "threshingfloor" },
-        { "thresholds", "threshold" },
-        { "threwing", "threw" },
-        { "thriving", "thrive" },
-        { "thrones", "throne" },
-        { "thronged", "throng" },
-        { "thronging", "throng" },
-        { "throwing", "throw" },
-        { "throwing", "thrown" },
-        { "throwing", "throws" },
-        { "throws", "throw" },
-        { "thrusts", "thrust" },
-        { "thumbs", "thumb" },
-        { "thundered", "thunder" },
-        { "thunders", "thunder" },
-        { "tied", "tie" },
-        { "tiles", "tile" },
-        { "tiling", "tile" },
-        { "tiling", "till" },
-        { "tilled", "till" },
-        { "tillest", "tills" },
-        { "tilling", "till" },
-        { "tills", "till" },
-        { "timbrels", "timbrel" },
-        { "times", "time" },
-        { "ting", "t" },
-        { "tired", "tire" },
-        { "tires", "tire" },
-        { "tithes", "tithe" },
-        { "tithing", "tithe" },
-        { "titles", "title" },
-        { "toes", "to" },
-        { "toes", "toe" },
-        { "toiled", "toil" },
-        { "toiling", "toil" },
-        { "tokens", "token" },
-        { "tolad", "tola" },
-        { "tombs", "tomb" },
-        { "tongued", "tongue" },
-        { "tongues", "tongue" },
-        { "tooking", "took" },
-        { "tops", "top" },
-        { "torches", "torch" },
-        { "tormented", "torment" },
-        { "tormentors", "tormentor" },
-        { "torments", "torment" },
-        { "tossed", "toss" },
-        { "touched", "touch" },
-        { "touches", "touch" },
-        { "touching", "touch" },
-        { "towards", "toward" },
-        { "towers", "tower" },
-        { "towns", "town" },
-        { "traded", "trade" },
-        { "trading", "trade" },
-        { "traditions", "tradition" },
-        { "trafficked", "traffick" },
-        { "traffickers", "trafficker" },
-        { "trained", "train" },
-        { "traitors", "traitor" },
-        { "trampled", "trample" },
-        { "transgressed", "transgress" },
-        { "transgresses", "transgress" },
-        { "transgressing", "transgress" },
-        { "transgressing", "transgress" },
-        { "transgressions", "transgression" },
-        { "transgressors", "transgressor" },
-        { "translated", "translate" },
-        { "traps", "trap" },
-        { "travailed", "travail" },
-        { "travailest", "travails" },
-        { "travailing", "travail" },
-        { "travailing", "travail" },
-        { "travailing", "travails" },
-        { "travails", "travail" },
-        { "traveled", "travel" },
-        { "travelers", "traveler" },
-        { "traveling", "travel" },
-        { "traveling", "travels" },
-        { "travellers", "traveller" },
-        { "travels", "travel" },
-        { "treaders", "treader" },
-        { "treading", "tread" },
-        { "treading", "treads" },
-        { "treads", "tread" },
-        { "treasured", "treasure" },
-        { "treasurers", "treasurer" },
-        { "treasures", "treasure" },
-        { "treasurest", "treasure" },
-        { "treasurest", "treasury" },
-        { "treasuring", "treasure" },
-        { "treasuring", "treasury" },
-        { "treated", "treat" },
-        { "trees", "tree" },
-        { "trembled", "tremble" },
-        { "trembles", "tremble" },
-        { "trembling", "tremble" },
-        { "trenches", "trench" },
-        { "trespassed", "trespass" },
-        { "trespasses", "trespass" },
-        { "trespassing", "trespass" },
-        { "trials", "trial" },
-        { "tribes", "tribe" },
-        { "tribulations", "tribulation" },
-        { "triest", "trip" },
-        { "triumphed", "triumph" },
-        { "triumphing", "triumph" },
-        { "triumphing", "triumphs" },
-        { "triumphs", "triumph" },
-        { "troops", "troop" },
-        { "troubled", "trouble" },
-        { "troubles", "trouble" },
-        { "troublest", "trouble" },
-        { "troubling", "trouble" },
-        { "troughs", "trough" },
-        { "trumpets", "trumpet" },
-        { "trusted", "trust" },
-        { "trustest", "trusts" },
-        { "trustest", "trusty" },
-        { "trusting", "trust" },
-        { "trusting", "trust" },
-        { "trusting", "trusts" },
-        { "trusting", "trusty" },
-        { "trusts", "trust" },
-        { "trying", "try" },
-        { "tumults", "tumult" },
-        { "tuned", "tune" },
-        { "turbans", "turban" },
-        { "turned", "turn" },
-        { "turnest", "turns" },
-        { "turning", "turn" },
-        { "turning", "turn" },
-        { "turning", "turns" },
-        { "turns", "turn" },
-        { "turtledoves", "turtledove" },
-        { "turtles", "turtle" },
-        { "tutors", "tutor" },
-        { "twined", "twin" },
-        { "twins", "twin" },
-        { "twisted", "twist" },
-        { "unawares", "unaware" },
-        { "unbelievers", "unbeliever" },
-        { "uncleannesses", "uncleanness" },
-        { "uncovered", "uncover" },
-        { "uncovers", "uncover" },
-        { "understandest", "understands" },
-        { "understanding", "understand" },
-        { "understanding", "understand" },
-        { "understanding", "understands" },
-        { "understands", "understand" },
-        { "unicorns", "unicorn" },
-        { "united", "unit" },
-        { "united", "unite" },
-        { "unloaded", "unload" },
-        { "untied", "untie" },
-        { "upbraided", "upbraid" },
-        { "upholdest", "upholds" },
-        { "upholding", "uphold" },
-        { "upholding", "uphold" },
-        { "upholding", "upholds" },
-        { "upholds", "uphold" },
-        { "uprooted", "uproot" },
-        { "urged", "urge" },
-        { "urges", "urge" },
-        { "used", "us" },
-        { "used", "use" },
-        { "uses", "us" },
-        { "uses", "use" },
-        { "usest", "use" },
-        { "using", "us" },
-        { "using", "us" },
-        { "using", "use" },
-        { "uttered", "utter" },
-        { "uttering", "utter" },
-        { "uttering", "utters" },
-        { "utters", "utter" },
-        { "vagabonds", "vagabond" },
-        { "vails", "vail" },
-        { "valianting", "valiant" },
-        { "valleys", "valley" },
-        { "valued", "value" },
-        { "valuest", "value" },
-        { "vanished", "vanish" },
-        { "vanishes", "vanish" },
-        { "vanishing", "vanish" },
-        { "vapors", "vapor" },
-        { "vapours", "vapour" },
-        { "vats", "vat" },
-        { "vaulted", "vault" },
-        { "veiled", "veil" },
-        { "veils", "veil" },
-        { "vents", "vent" },
-        { "ventures", "venture" },
-        { "vessels", "vessel" },
-        { "vestures", "vesture" },
-        { "vexations", "vexation" },
-        { "vexed", "vex" },
-        { "vials", "vial" },
-        { "victuals", "victual" },
-        { "viewed", "view" },
-        { "vilest", "vile" },
-        { "villages", "village" },
-        { "vindicated", "vindicate" },
-        { "vines", "vine" },
-        { "vineyards", "vineyard" },
-        { "violated", "violate" },
-        { "viols", "viol" },
-        { "vipers", "viper" },
-        { "virgins", "virgin" },
-        { "visions", "vision" },
-        { "visited", "visit" },
-        { "visitest", "visits" },
-        { "visiting", "visit" },
-        { "visiting", "visit" },
-        { "visiting", "visits" },
-        { "visits", "visit" },
-        { "voices", "voice" },
-        { "vomited", "vomit" },
-        { "vomits", "vomit" },
-        { "vowed", "vow" },
-        { "vowest", "vows" },
-        { "vowing", "vow" },
-        { "vows", "vow" },
-        { "vultures", "vulture" },
-        { "wafers", "wafer" },
-        { "wages", "wag" },
-        { "wages", "wage" },
-        { "wagons", "wagon" },
-        { "wailed", "wail" },
-        { "wailing", "wail" },
-        { "wailing", "wails" },
-        { "wailings", "wailing" },
-        { "wails", "wail" },
-        { "waited", "wait" },
-        { "waiting", "wait" },
-        { "waiting", "waits" },
-        { "waits", "wait" },
-        { "waked", "wake" },
-        { "wakes", "wake" },
-        { "waking", "wake" },
-        { "walked", "walk" },
-        { "walkest", "walks" },
-        { "walking", "walk" },
-        { "walking", "walk" },
-        { "walking", "walks" },
-        { "walks", "walk" },
-        { "walled", "wall" },
-        { "wallowed", "wallow" },
-        { "wallowing", "wallow" },
-        { "walls", "wall" },
-        { "wandered", "wander" },
-        { "wanderers", "wanderer" },
-        { "wanderest", "wanders" },
-        { "wandering", "wander" },
-        { "wandering", "wander" },
-        { "wandering", "wanders" },
-        { "wanderings", "wandering" },
-        { "wanders", "wander" },
-        { "wanted", "want" },
-        { "wanting", "want" },
-        { "wanting", "wants" },
-        { "wants", "want" },
-        { "ward", "war" },
-        { "wards", "ward" },
-        { "wares", "war" },
-        { "wares", "ware" },
-        { "warmed", "warm" },
-        { "warming", "warm" },
-        { "warming", "warms" },
-        { "warms", "warm" },
-        { "warned", "warn" },
-        { "warning", "warn" },
-        { "warning", "warns" },
-        { "warns", "warn" },
-        { "warped", "warp" },
-        { "warriors", "warrior" },
-        { "wars", "war" },
-        { "washed", "wash" },
-        { "washing", "wash" },
-        { "washing", "wash" },
-        { "washings", "washing" },
-        { "wasted", "wast" },
-        { "wasted", "waste" },
-        { "wastes", "wast" },
-        { "wastes", "waste" },
-        { "wasting", "wast" },
-        { "wasting", "waste" },
-        { "watched", "watch" },
-        { "watchers", "watcher" },
-        { "watches", "watch" },
-        { "watching", "watch" },
-        { "watchings", "watching" },
-        { "watercourses", "watercourse" },
-        { "watered", "water" },
-        { "waterest", "waters" },
-        { "watering", "water" },
-        { "watering", "water" },
-        { "watering", "waters" },
-        { "waterpots", "waterpot" },
-        { "waters", "water" },
-        { "waved", "wave" },
-        { "waves", "wave" },
-        { "waxed", "wax" },
-        { "waxing", "wax" },
-        { "ways", "way" },
-        { "weakened", "weaken" },
-        { "weakens", "weaken" },
-        { "weaknesses", "weakness" },
-        { "weapons", "weapon" },
-        { "wearing", "wear" },
-        { "wearing", "wears" },
-        { "wearing", "weary" },
-        { "wears", "wear" },
-        { "weavest", "weave" },
-        { "weaving", "weave" },
-        { "webs", "web" },
-        { "weddings", "wedding" },
-        { "weeks", "week" },
-        { "weepest", "weeps" },
-        { "weeping", "weep" },
-        { "weeping", "weep" },
-        { "weeping", "weeps" },
-        { "weeps", "weep" },
-        { "weighed", "weigh" },
-        { "weighing", "weigh" },
-        { "weighing", "weighs" },
-        { "weighing", "weight" },
-        { "weighs", "weigh" },
-        { "weights", "weight" },
-        { "welcomed", "welcome" },
-        { "welcomes", "welcome" },
-        { "wells", "well" },
-        { "wenting", "went" },
-        { "west", "we" },
-        { "whales", "whale" },
-        { "wheels", "wheel" },
-        { "whelps", "whelp" },
-        { "whiles", "while" },
-        { "whips", "whip" },
-        { "whirlwinds", "whirlwind" },
-        { "whispered", "whisper" },
-        { "whisperers", "whisperer" },
-        { "whispering", "whisper" },
-        { "whisperings", "whispering" },
-        { "whited", "whit" },
-        { "whited", "white" },
-        { "whitened", "whiten" },
-        { "whitewashed", "whitewash" },
-        { "whoredoms", "whoredom" },
-        { "whoremongers", "whoremonger" },
-        { "whores", "whore" },
-        { "whoring", "whore" },
-        { "wicked", "wick" },
-        { "widows", "widow" },
-        { "wielding", "wield" },
-        { "wielding", "wields" },
-        { "wields", "wield" },
-        { "willed", "will" },
-        { "willing", "will" },
-        { "willing", "wills" },
-        { "willows", "willow" },
-        { "wills", "will" },
-        { "wind", "win" },
-        { "winding", "wind" },
-        { "winding", "winds" },
-        { "winding", "windy" },
-        { "windows", "window" },
-        { "winds", "wind" },
-        { "winebibbers", "winebibber" },
-        { "winepresses", "winepress" },
-        { "wines", "win" },
-        { "wines", "wine" },
-        { "wineskins", "wineskin" },
-        { "wing", "we" },
-        { "winged", "wing" },
-        { "wings", "wing" },
-        { "winked", "wink" },
-        { "winking", "wink" },
-        { "winking", "winks" },
-        { "winks", "wink" },
-        { "winnowed", "winnow" },
-        { "winnowing", "winnow" },
-        { "winnowing", "winnows" },
-        { "winnows", "winnow" },
-        { "wins", "win" },
-        { "wintered", "winter" },
-        { "wiped", "wipe" },
-        { "wipes", "wipe" },
-        { "wiping", "wipe" },
-        { "wisest", "wise" },
-        { "wisest", "wish" },
-        { "wisest", "wist" },
-        { "wished", "wish" },
-        { "wishing", "wish" },
-        { "witchcrafts", "witchcraft" },
-        { "withdrawest", "withdrawn" },
-        { "withdrawing", "withdraw" },
-        { "withered", "wither" },
-        { "withers", "wither" },
-        { "withhelding", "withheld" },
-        { "withholds", "withhold" },
-        { "withs", "with" },
-        { "withstands", "withstand" },
-        { "witnessed", "witness" },
-        { "witnesses", "witness" },
-        { "witnessing", "witness" },
-        { "wits", "wit" },
-        { "wizards", "wizard" },
-        { "woes", "woe" },
-        { "wombs", "womb" },
-        { "wondered", "wonder" },
-        { "wondering", "wonder" },
-        { "wondering", "wonders" },
-        { "wonders", "wonder" },
-        { "woods", "wood" },
-        { "words", "word" },
-        { "worked", "work" },
-        { "workers", "worker" },
-        { "working", "work" },
-        { "working", "works" },
-        { "workings", "working" },
-        { "works", "work" },
-        { "worlds", "world" },
-        { "worms", "worm" },
-        { "worshiped", "worship" },
-        { "worshippers", "worshipper" },
-        { "worships", "worship" },
-        { "wouldest", "wouldn" },
-        { "woulding", "would" },
-        { "wounded", "wound" },
-        { "wounding", "wound" },
-        { "wounding", "wounds" },
-        { "wounds", "wound" },
-        { "wraths", "wrath" },
-        { "wreathed", "wreath" },
-        { "wreaths", "wreath" },
-        { "wrestled", "wrestle" },
-        { "wrestling", "wrestle" },
-        { "wrestlings", "wrestling" },
-        { "wrests", "wrest" },
-        { "wringed", "wring" },
-        { "wringing", "wring" },
-        { "wrinkles", "wrinkle" },
-        { "writers", "writer" },
-        { "writes", "write" },
-        { "writest", "write" },
-        { "writing", "write" },
-        { "writings", "writing" },
-        { "wronged", "wrong" },
-        { "wrongs", "wrong" },
-        { "wroughting", "wrought" },
-        { "yearned", "yearn" },
-        { "yearning", "yearn" },
-        { "yearning", "yearns" },
-        { "yearns", "yearn" },
-        { "years", "year" },
-        { "yelled", "yell" },
-        { "yes", "ye" },
-        { "yielded", "yield" },
-        { "yielding", "yield" },
-        { "yielding", "yields" },
-        { "yields", "yield" },
-        { "yoked", "yoke" },
-        { "yokes", "yoke" },
-        { "younging", "young" },
-        { "yours", "your" },
-        { "youths", "youth" },
-        { "zamzummims", "zamzummim" },
-        { "zebulunite", "zebulun" },
-        { "zebulunites", "zebulunite" },
-        { "zered", "zer" },
-        { "zuzims", "zuzim" },
-    };
+        std::size_t current_word_start_character_index = 0;
+        std::size_t text_character_count = text.length();
+        for (std::size_t character_index = 0; character_index < text_character_count; ++character_index)
+        {
+            char current_character = text[character_index];
+
+            // CHECK IF THE CURRENT CHARACTER IS PART OF A WORD.
+            /// @todo   Handle contractions or other more complex scenarios!
+            bool is_part_of_word = std::isalnum(static_cast<unsigned char>(current_character));
+            if (!is_part_of_word)
+            {
+                // PROCESS THE WORD AS LONG AS IT EXISTS.
+                std::size_t current_word_character_count = (character_index - current_word_start_character_index);
+                bool word_exists = (current_word_character_count > 0);
+                if (word_exists)
+                {
+                    std::string_view current_word = text.substr(current_word_start_character_index, current_word_character_count);
+                    process_word(current_word_start_character_index, current_word);
+                }
+
+                // START MOVING TO THE NEXT WORD.
+                current_word_start_character_index = character_index + 1;
+            }
+        }
+
+        // PROCESS ANY FINAL WORD IF APPLICABLE.
+        bool unterminated_final_word_exists = (current_word_start_character_index < text_character_count);
+        if (include_unterminated_final_word && unterminated_final_word_exists)
+        {
+            std::string_view final_word = text.substr(current_word_start_character_index);
+            process_word(current_word_start_character_index, final_word);
+        }
+    }
 
     /// Builds a word index for the given Bible translation.
     /// @param[in]  bible_translation - The translation to index.
+    /// @param[in]  thread_count - The number of threads to use for building the index.
+    ///     Verses are split into contiguous chunks with balanced verse counts, each chunk is indexed
+    ///     on a separate thread, and the partial indices are then merged.  The resulting index is
+    ///     identical regardless of the number of threads.
+    /// @param[in]  include_token_positions - True to also store the position of each word occurrence
+    ///     within its verse, which speeds up phrase searches at the cost of extra memory.
+    /// @param[in]  compress_postings - True to store postings compressed (see CompressedPostings),
+    ///     which uses less memory at the cost of decoding postings during searches.
     /// @return The word index for the corresponding Bible translation.
-    BibleWordIndex BibleWordIndex::Build(const BibleTranslation* bible_translation)
+    BibleWordIndex BibleWordIndex::Build(
+        const BibleTranslation* bible_translation,
+        const unsigned int thread_count,
+        const bool include_token_positions,
+        const bool compress_postings)
     {
-        BibleWordIndex word_index;
-        word_index.Bible = bible_translation;
+        // MAKE SURE ALL VERSES CAN BE REFERENCED BY A VERSE INDEX.
+        std::size_t verse_count = bible_translation->VerseCharacterRanges.size();
+        assert(verse_count <= (static_cast<std::size_t>(std::numeric_limits<VerseIndex>::max()) + 1));
+
+        // DETERMINE HOW TO SPLIT UP THE VERSES FOR INDEXING.
+        // Chunks are contiguous so that concatenating the chunks' postings in order keeps canonical verse order.
+        std::size_t chunk_count = std::clamp<std::size_t>(thread_count, 1, std::max<std::size_t>(verse_count, 1));
+        std::vector<std::size_t> chunk_start_verse_indices;
+        for (std::size_t chunk_index = 0; chunk_index <= chunk_count; ++chunk_index)
+        {
+            std::size_t chunk_start_verse_index = (verse_count * chunk_index) / chunk_count;
+            chunk_start_verse_indices.push_back(chunk_start_verse_index);
+        }
+
+        // Work for each chunk is done on a separate thread if multiple chunks exist.
+        auto for_each_chunk = [chunk_count](const auto& process_chunk)
+        {
+            bool single_threaded = (1 == chunk_count);
+            if (single_threaded)
+            {
+                process_chunk(0);
+                return;
+            }
+
+            std::vector<std::thread> threads;
+            threads.reserve(chunk_count);
+            for (std::size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index)
+            {
+                threads.emplace_back(process_chunk, chunk_index);
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        };
+
+        // INDEX EACH CHUNK OF VERSES.
+        std::vector<PartialIndex> partial_indices(chunk_count);
+        for_each_chunk([&](const std::size_t chunk_index)
+        {
+            IndexVerses(
+                bible_translation,
+                chunk_start_verse_indices[chunk_index],
+                chunk_start_verse_indices[chunk_index + 1],
+                partial_indices[chunk_index]);
+        });
+
+        // DETERMINE ALL UNIQUE WORDS IN SORTED ORDER.
+        std::vector<std::string_view> words;
+        for (const PartialIndex& partial_index : partial_indices)
+        {
+            for (const auto& [word, word_id] : partial_index.WordIdsByWord)
+            {
+                words.push_back(word);
+            }
+        }
+        std::sort(words.begin(), words.end());
+        words.erase(std::unique(words.begin(), words.end()), words.end());
+        std::size_t word_count = words.size();
+
+        // MAP EACH CHUNK'S WORD IDS TO INDICES IN THE FULL LIST OF WORDS.
+        std::vector<std::vector<std::uint32_t>> word_indices_by_chunk_word_id(chunk_count);
+        for_each_chunk([&](const std::size_t chunk_index)
+        {
+            const PartialIndex& partial_index = partial_indices[chunk_index];
+            std::vector<std::uint32_t>& word_indices_by_word_id = word_indices_by_chunk_word_id[chunk_index];
+            word_indices_by_word_id.resize(partial_index.WordIdsByWord.size());
+
+            for (const auto& [word, word_id] : partial_index.WordIdsByWord)
+            {
+                auto word_in_full_list = std::lower_bound(words.cbegin(), words.cend(), word);
+                std::uint32_t word_index = static_cast<std::uint32_t>(word_in_full_list - words.cbegin());
+                word_indices_by_word_id[word_id] = word_index;
+            }
+        });
+
+        // COUNT THE POSTINGS FOR EACH WORD IN EACH CHUNK.
+        // The counts are stored by word and then by chunk so they can be converted in-place
+        // into offsets for where each chunk's postings for a word go in the final postings.
+        std::vector<std::uint32_t> posting_offsets_by_word_and_chunk(word_count * chunk_count, 0);
+        auto get_word_and_chunk_index = [chunk_count](const std::size_t word_index, const std::size_t chunk_index)
+        {
+            return word_index * chunk_count + chunk_index;
+        };
+        for_each_chunk([&](const std::size_t chunk_index)
+        {
+            // Each chunk only touches its own counts, so no synchronization is needed.
+            const std::vector<std::uint32_t>& word_indices_by_word_id = word_indices_by_chunk_word_id[chunk_index];
+            for (const WordOccurrence& word_occurrence : partial_indices[chunk_index].WordOccurrences)
+            {
+                std::uint32_t word_index = word_indices_by_word_id[word_occurrence.WordId];
+                std::size_t word_and_chunk_index = get_word_and_chunk_index(word_index, chunk_index);
+                ++posting_offsets_by_word_and_chunk[word_and_chunk_index];
+            }
+        });
+
+        // FORM THE LEXICON AND POSTING OFFSETS.
+        std::size_t total_word_character_count = 0;
+        for (const std::string_view word : words)
+        {
+            total_word_character_count += word.length();
+        }
+        std::shared_ptr<BuiltData> built_data = std::make_shared<BuiltData>();
+        built_data->LexiconCharacters.reserve(total_word_character_count);
+        built_data->LexiconWordOffsets.reserve(word_count + 1);
+        built_data->PostingOffsets.reserve(word_count + 1);
+        std::uint32_t current_posting_offset = 0;
+        for (std::size_t word_index = 0; word_index < word_count; ++word_index)
+        {
+            built_data->LexiconWordOffsets.push_back(static_cast<std::uint32_t>(built_data->LexiconCharacters.size()));
+            built_data->LexiconCharacters += words[word_index];
+
+            built_data->PostingOffsets.push_back(current_posting_offset);
+            for (std::size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index)
+            {
+                std::size_t word_and_chunk_index = get_word_and_chunk_index(word_index, chunk_index);
+                std::uint32_t chunk_posting_count = posting_offsets_by_word_and_chunk[word_and_chunk_index];
+                posting_offsets_by_word_and_chunk[word_and_chunk_index] = current_posting_offset;
+                current_posting_offset += chunk_posting_count;
+            }
+        }
+        // The final offsets mark the ends of the last word and its postings.
+        built_data->LexiconWordOffsets.push_back(static_cast<std::uint32_t>(built_data->LexiconCharacters.size()));
+        built_data->PostingOffsets.push_back(current_posting_offset);
+
+        // COPY THE POSTINGS FROM EACH CHUNK INTO PLACE.
+        // Occurrences within a chunk are in verse order, so appending each one at the next
+        // offset for its word and chunk keeps the postings in canonical verse order.
+        built_data->PostingVerseIndices.resize(current_posting_offset);
+        if (include_token_positions)
+        {
+            built_data->PostingTokenPositions.resize(current_posting_offset);
+        }
+        for_each_chunk([&](const std::size_t chunk_index)
+        {
+            const std::vector<std::uint32_t>& word_indices_by_word_id = word_indices_by_chunk_word_id[chunk_index];
+            for (const WordOccurrence& word_occurrence : partial_indices[chunk_index].WordOccurrences)
+            {
+                std::uint32_t word_index = word_indices_by_word_id[word_occurrence.WordId];
+                std::size_t word_and_chunk_index = get_word_and_chunk_index(word_index, chunk_index);
+                std::uint32_t& posting_offset = posting_offsets_by_word_and_chunk[word_and_chunk_index];
+                built_data->PostingVerseIndices[posting_offset] = word_occurrence.ContainingVerseIndex;
+                if (include_token_positions)
+                {
+                    built_data->PostingTokenPositions[posting_offset] = word_occurrence.PositionInVerse;
+                }
+                ++posting_offset;
+            }
+        });
+
+        // COUNT THE WORDS IN EACH VERSE AND THE VERSES CONTAINING EACH WORD FOR RANKING VERSES BY RELEVANCE.
+        built_data->VerseWordCounts.resize(verse_count);
+        for (const VerseIndex verse_index : built_data->PostingVerseIndices)
+        {
+            ++built_data->VerseWordCounts[verse_index];
+        }
+        built_data->WordVerseCounts.resize(word_count);
+        for (std::size_t word_index = 0; word_index < word_count; ++word_index)
+        {
+            // Postings are in verse order, so each distinct verse starts where the verse index changes.
+            std::uint32_t first_posting_offset = built_data->PostingOffsets[word_index];
+            std::uint32_t end_posting_offset = built_data->PostingOffsets[word_index + 1];
+            for (std::uint32_t posting_offset = first_posting_offset; posting_offset < end_posting_offset; ++posting_offset)
+            {
+                bool new_verse = (posting_offset == first_posting_offset) ||
+                    (built_data->PostingVerseIndices[posting_offset] != built_data->PostingVerseIndices[posting_offset - 1]);
+                if (new_verse)
+                {
+                    ++built_data->WordVerseCounts[word_index];
+                }
+            }
+        }
+
+        // COMPRESS THE POSTINGS IF REQUESTED.
+        // The uncompressed postings are only needed for building, so their memory is freed.
+        if (compress_postings)
+        {
+            built_data->CompressedPostings = CompressedPostingLists::Compress(built_data->PostingVerseIndices, built_data->PostingOffsets);
+            std::vector<VerseIndex>().swap(built_data->PostingVerseIndices);
+        }
 
-        // INDEX EACH VERSE IN THE BIBLE TRANSLATION.
-        for (const BibleVerseIdWithCharacterRange& verse_id_with_character_range : bible_translation->VerseCharacterRanges)
+        // RETURN THE POPULATED WORD INDEX.
+        CompressedPostingLists compressed_postings =
+        {
+            .WordFirstBlockIndices = built_data->CompressedPostings.WordFirstBlockIndices,
+            .Blocks = built_data->CompressedPostings.Blocks,
+            .EncodedBytes = built_data->CompressedPostings.EncodedBytes,
+        };
+        BibleWordIndex word_index = FromPrecomputedData(
+            bible_translation,
+            built_data->LexiconCharacters,
+            built_data->LexiconWordOffsets,
+            built_data->PostingVerseIndices,
+            built_data->PostingOffsets,
+            built_data->VerseWordCounts,
+            built_data->WordVerseCounts,
+            built_data->PostingTokenPositions,
+            compressed_postings);
+        word_index.OwnedData = built_data;
+        return word_index;
+    }
+
+    /// Indexes a range of verses into a partial index.
+    /// This is designed to avoid heap allocations except when encountering a new word
+    /// (or when the list of occurrences needs to grow beyond its initial estimate).
+    /// @param[in]  bible_translation - The translation containing the verses to index.
+    /// @param[in]  first_verse_index - The index of the first verse to index.
+    /// @param[in]  end_verse_index - The index one past the last verse to index.
+    /// @param[in,out]  partial_index - The partial index to add the verses' words to.
+    void BibleWordIndex::IndexVerses(
+        const BibleTranslation* bible_translation,
+        const std::size_t first_verse_index,
+        const std::size_t end_verse_index,
+        PartialIndex& partial_index)
+    {
+        // ESTIMATE THE NUMBER OF WORD OCCURRENCES.
+        // Words in Bibles average a bit over 4 characters, so assuming every 4 characters
+        // (including spaces and punctuation) is a word should avoid most regrowth.
+        bool verses_exist = (first_verse_index < end_verse_index);
+        if (verses_exist)
+        {
+            std::size_t first_character_offset = bible_translation->VerseCharacterRanges[first_verse_index].FirstCharacterOffsetIntoFullBibleText;
+            std::size_t last_character_offset = bible_translation->VerseCharacterRanges[end_verse_index - 1].LastCharacterOffsetIntoFullBibleText;
+            constexpr std::size_t ESTIMATED_CHARACTERS_PER_WORD = 4;
+            std::size_t estimated_word_occurrence_count = (last_character_offset - first_character_offset) / ESTIMATED_CHARACTERS_PER_WORD;
+            partial_index.WordOccurrences.reserve(partial_index.WordOccurrences.size() + estimated_word_occurrence_count);
+        }
+
+        // INDEX EACH VERSE IN THE RANGE.
+        WordNormalizationBuffer word_normalization_buffer;
+        for (std::size_t verse_index = first_verse_index; verse_index < end_verse_index; ++verse_index)
         {
             // GET THE CURRENT VERSE TEXT.
+            const BibleVerseIdWithCharacterRange& verse_id_with_character_range = bible_translation->VerseCharacterRanges[verse_index];
             const char* first_character_in_verse = bible_translation->Text + verse_id_with_character_range.FirstCharacterOffsetIntoFullBibleText;
             std::size_t verse_character_count = (
                 verse_id_with_character_range.LastCharacterOffsetIntoFullBibleText - 
@@ -4705,259 +349,2086 @@ namespace BIBLE_DATA
             std::string_view current_verse_text(first_character_in_verse, verse_character_count);
 
             // INDEX EACH WORD IN THE VERSE.
-            std::size_t current_word_start_character_index = 0;
-            std::size_t current_verse_character_count = current_verse_text.length();
-            for (std::size_t character_index = 0; character_index < current_verse_character_count; ++character_index)
-            {
-                char current_character = current_verse_text[character_index];
-
-                // CHECK IF THE CURRENT CHARACTER IS PART OF A WORD.
-                /// @todo   Handle contractions or other more complex scenarios!
-                bool is_part_of_word = std::isalnum(current_character);
-                if (!is_part_of_word)
+            TokenPosition current_position_in_verse = 0;
+            ForEachWord(
+                current_verse_text,
+                false,
+                [&](const std::size_t, const std::string_view current_word)
                 {
-                    // GET THE LOWERCASE VERSION OF THE CURRENT WORD FOR INDEXING.
-                    const char* first_character_in_word = first_character_in_verse + current_word_start_character_index;
-                    std::size_t current_word_character_count = (character_index - current_word_start_character_index);
-                    std::string current_word(first_character_in_word, current_word_character_count);
-                    std::transform(
-                        current_word.begin(), 
-                        current_word.end(), 
-                        current_word.begin(), 
-                        [](const char character)
-                        { 
-                            return static_cast<char>(std::tolower(static_cast<int>(character)));
-                        });
-
-                    // INDEX THE VERSES FOR THE WORD AS LONG AS THE WORD EXISTS.
-                    if (!current_word.empty())
+                    // GET THE NORMALIZED (LOWERCASE AND ROOT) VERSION OF THE CURRENT WORD FOR INDEXING.
+                    std::string_view normalized_word = NormalizeWord(current_word, word_normalization_buffer);
+
+                    // GET THE ID OF THE WORD.
+                    // The word only needs to be copied if it hasn't been encountered before.
+                    auto normalized_word_and_id = partial_index.WordIdsByWord.find(normalized_word);
+                    bool new_word = (partial_index.WordIdsByWord.end() == normalized_word_and_id);
+                    if (new_word)
                     {
-                        // INDEX THE WORD BY ITS ROOT WORD IF APPLICABLE.
-                        auto current_word_and_root_word = RootWordsByOriginalWord.find(current_word);
-                        bool different_root_word_found = (RootWordsByOriginalWord.cend() != current_word_and_root_word);
-                        if (different_root_word_found)
-                        {
-                            word_index.BibleVersesByWord[current_word_and_root_word->second].emplace_back(verse_id_with_character_range);
-                        }
-                        else
-                        {
-                            word_index.BibleVersesByWord[current_word].emplace_back(verse_id_with_character_range);
-                        }
+                        std::uint32_t new_word_id = static_cast<std::uint32_t>(partial_index.WordIdsByWord.size());
+                        normalized_word_and_id = partial_index.WordIdsByWord.emplace(std::string(normalized_word), new_word_id).first;
                     }
 
-                    // START MOVING TO THE NEXT WORD.
-                    current_word_start_character_index = character_index + 1;
-                }
-            }
+                    // TRACK THE OCCURRENCE OF THE WORD.
+                    WordOccurrence word_occurrence =
+                    {
+                        .WordId = normalized_word_and_id->second,
+                        .ContainingVerseIndex = static_cast<VerseIndex>(verse_index),
+                        .PositionInVerse = current_position_in_verse,
+                    };
+                    partial_index.WordOccurrences.push_back(word_occurrence);
+                    ++current_position_in_verse;
+                });
         }
-
-        // RETURN THE POPULATED WORD INDEX.
-        return word_index;
     }
 
-    /// Gets matching verses for the corresponding word.
-    /// @param[in]  word - The word for which to get matching verses.
-    /// @return The verses matching the word.
-    std::vector<BibleVerse> BibleWordIndex::GetMatchingVerses(const std::string_view word) const
+    /// Normalizes a word to the form used for keys in the index.
+    /// This means lowercasing the word and then mapping it to any root word.
+    /// @param[in]  word - The word to normalize.
+    /// @param[in,out]  word_normalization_buffer - The buffer to use for holding the lowercase version of the word.
+    /// @return The normalized word.  This references either the buffer or static root word data,
+    ///     so it is only valid as long as the buffer is not reused.
+    std::string_view BibleWordIndex::NormalizeWord(const std::string_view word, WordNormalizationBuffer& word_normalization_buffer)
     {
-        std::printf("Verse index word count: %zu\n", BibleVersesByWord.size());
+        // GET THE STORAGE FOR THE LOWERCASE WORD.
+        // Only unusually long words need to use heap-allocated storage.
+        std::size_t word_character_count = word.length();
+        char* lowercase_word_characters = word_normalization_buffer.Characters;
+        bool word_fits_in_fixed_buffer = (word_character_count <= WordNormalizationBuffer::MAX_FIXED_WORD_LENGTH_IN_CHARACTERS);
+        if (!word_fits_in_fixed_buffer)
+        {
+            word_normalization_buffer.LongWordCharacters.resize(word_character_count);
+            lowercase_word_characters = word_normalization_buffer.LongWordCharacters.data();
+        }
 
         // MAKE SURE THE WORD IS LOWERCASE.
-        std::string lowercase_word(word);
         std::transform(
-            lowercase_word.begin(), 
-            lowercase_word.end(), 
-            lowercase_word.begin(), 
+            word.cbegin(),
+            word.cend(),
+            lowercase_word_characters,
             [](const char character)
-            { 
+            {
                 return static_cast<char>(std::tolower(static_cast<int>(character)));
             });
+        std::string_view lowercase_word(lowercase_word_characters, word_character_count);
 
         // GET ANY ROOT WORD IF APPLICABLE.
-        auto current_word_and_root_word = RootWordsByOriginalWord.find(lowercase_word);
-        bool different_root_word_found = (RootWordsByOriginalWord.cend() != current_word_and_root_word);
-        if (different_root_word_found)
+        std::optional<std::string_view> root_word = RootWordsByOriginalWord.Find(lowercase_word);
+        if (root_word)
         {
-            lowercase_word = current_word_and_root_word->second;
+            return *root_word;
         }
 
-        // SEARCH FOR ANY MATCHING VERSES.
-        auto word_with_verse_ids_with_character_ranges = BibleVersesByWord.find(lowercase_word);
-        bool word_found = (BibleVersesByWord.cend() != word_with_verse_ids_with_character_ranges);
-        if (!word_found)
+        return lowercase_word;
+    }
+
+    /// Gets the Porter stem of a word (such as "believ" for "believe", "believed", and "believing").
+    /// This may be called concurrently from multiple threads.
+    /// @param[in]  word - The word to stem.
+    /// @return The lowercase stem of the word.
+    std::string BibleWordIndex::StemWord(const std::string_view word)
+    {
+        // LOWERCASE THE WORD SINCE THE STEMMER ONLY HANDLES LOWERCASE LETTERS.
+        std::string stemmed_word(word);
+        std::transform(
+            stemmed_word.cbegin(),
+            stemmed_word.cend(),
+            stemmed_word.begin(),
+            [](const char character)
+            {
+                return static_cast<char>(std::tolower(static_cast<int>(character)));
+            });
+        if (stemmed_word.empty())
         {
-            // INDICATE THAT NO MATCHING VERSES COULD BE FOUND.
-            return {};
+            return stemmed_word;
         }
 
-        // GET THE FULL VERSES FOR THE MATCHING VERSES IDENTIFIED ABOVE.
-        const std::vector<BibleVerseIdWithCharacterRange>& verse_ids_with_character_ranges = word_with_verse_ids_with_character_ranges->second;
+        // STEM THE WORD.
+        // The stemmer keeps its state in global variables, so only a single word can be stemmed at a time.
+        static std::mutex stemmer_mutex;
+        std::lock_guard<std::mutex> stemmer_lock(stemmer_mutex);
+        constexpr int WORD_START_INDEX = 0;
+        int last_character_index = static_cast<int>(stemmed_word.length()) - 1;
+        int stem_last_character_index = stem(stemmed_word.data(), WORD_START_INDEX, last_character_index);
+        stemmed_word.resize(static_cast<std::size_t>(stem_last_character_index) + 1);
+        return stemmed_word;
+    }
 
-        std::printf("Matching verse count: %zu\n", verse_ids_with_character_ranges.size());
+    /// Creates a word index that wraps already computed index data without copying it.
+    /// This is primarily intended for data precomputed into generated code files (see BibleDataCodeFiles),
+    /// so that no work is needed at runtime to have an index.
+    /// @param[in]  bible_translation - The translation the index data is for.
+    /// @param[in]  lexicon_characters - See LexiconCharacters.  Must remain valid for the lifetime of the index.
+    /// @param[in]  lexicon_word_offsets - See LexiconWordOffsets.  Must remain valid for the lifetime of the index.
+    /// @param[in]  posting_verse_indices - See PostingVerseIndices.  Must remain valid for the lifetime of the index.
+    ///     Must be empty if compressed postings are provided.
+    /// @param[in]  posting_offsets - See PostingOffsets.  Must remain valid for the lifetime of the index.
+    /// @param[in]  verse_word_counts - See VerseWordCounts.  Must remain valid for the lifetime of the index.
+    /// @param[in]  word_verse_counts - See WordVerseCounts.  Must remain valid for the lifetime of the index.
+    /// @param[in]  posting_token_positions - See PostingTokenPositions.  Must remain valid for the lifetime of the index.
+    ///     May be empty if token positions are not available.
+    /// @param[in]  compressed_postings - See CompressedPostings.  Its arrays must remain valid for the lifetime of the index.
+    ///     May be empty if postings aren't compressed.
+    /// @return The word index wrapping the data.
+    BibleWordIndex BibleWordIndex::FromPrecomputedData(
+        const BibleTranslation* bible_translation,
+        const std::string_view lexicon_characters,
+        const std::span<const std::uint32_t> lexicon_word_offsets,
+        const std::span<const VerseIndex> posting_verse_indices,
+        const std::span<const std::uint32_t> posting_offsets,
+        const std::span<const std::uint16_t> verse_word_counts,
+        const std::span<const std::uint16_t> word_verse_counts,
+        const std::span<const TokenPosition> posting_token_positions,
+        const CompressedPostingLists& compressed_postings)
+    {
+        assert(lexicon_word_offsets.size() == posting_offsets.size());
+        assert(word_verse_counts.size() + 1 == posting_offsets.size());
+        assert(verse_word_counts.size() == bible_translation->VerseCharacterRanges.size());
+        assert(compressed_postings.Empty() ? (posting_verse_indices.size() == posting_offsets.back()) : posting_verse_indices.empty());
+        assert(compressed_postings.Empty() || (compressed_postings.WordFirstBlockIndices.size() == posting_offsets.size()));
+        assert(posting_token_positions.empty() || (posting_token_positions.size() == posting_offsets.back()));
 
-        std::vector<BibleVerse> matching_verses;
-        for (const BibleVerseIdWithCharacterRange& verse_id_with_character_range : verse_ids_with_character_ranges)
+        BibleWordIndex word_index;
+        word_index.Bible = bible_translation;
+        word_index.LexiconCharacters = lexicon_characters;
+        word_index.LexiconWordOffsets = lexicon_word_offsets;
+        word_index.PostingVerseIndices = posting_verse_indices;
+        word_index.PostingOffsets = posting_offsets;
+        word_index.PostingTokenPositions = posting_token_positions;
+        word_index.CompressedPostings = compressed_postings;
+        word_index.VerseWordCounts = verse_word_counts;
+        word_index.WordVerseCounts = word_verse_counts;
+        word_index.LazyStems = std::make_shared<LazyStemIndex>();
+        return word_index;
+    }
+
+    /// Creates a copy of the index with any compressed postings decoded, for indexes whose postings are compressed
+    /// for storage (such as in generated code files or index files) but that should be searched uncompressed.
+    /// Uncompressed postings can be viewed directly by searches (see GetMatchingVersesView()), whereas compressed postings
+    /// must be decoded into newly allocated memory for every search that needs the postings as a whole.
+    /// @return A copy of the index with uncompressed postings.  The copy shares all other data with this index,
+    ///     so it keeps this index's data alive.  Returned as-is if postings aren't compressed.
+    BibleWordIndex BibleWordIndex::WithUncompressedPostings() const
+    {
+        // RETURN THE INDEX AS-IS IF ITS POSTINGS AREN'T COMPRESSED.
+        BibleWordIndex word_index = *this;
+        if (!HasCompressedPostings())
         {
-            // GET THE CURRENT VERSE TEXT.
-            const char* first_character_in_verse = Bible->Text + verse_id_with_character_range.FirstCharacterOffsetIntoFullBibleText;
-            std::size_t verse_character_count = (
-                verse_id_with_character_range.LastCharacterOffsetIntoFullBibleText - 
-                verse_id_with_character_range.FirstCharacterOffsetIntoFullBibleText);
-            std::string_view current_verse_text(first_character_in_verse, verse_character_count);
+            return word_index;
+        }
 
-            // TRACK THE CURRENT MATCHING VERSE.
-            BibleVerse current_verse = 
-            {
-                .Id = BibleVerseId
-                {
-                    .Book = verse_id_with_character_range.Id.Book,
-                    .ChapterNumber = verse_id_with_character_range.Id.ChapterNumber,
-                    .VerseNumber = verse_id_with_character_range.Id.VerseNumber,
-                },
-                .Text = current_verse_text
-            };
+        /// Storage for decoded postings that also keeps the original index data alive.
+        struct UncompressedData
+        {
+            /// The original index's data (see OwnedData).
+            std::shared_ptr<const void> CompressedData = nullptr;
+            /// The decoded verse indices for all postings (see PostingVerseIndices).
+            std::vector<VerseIndex> PostingVerseIndices = {};
+        };
 
-            matching_verses.emplace_back(current_verse);
+        // DECODE EACH BLOCK DIRECTLY INTO PLACE.
+        // Extra room is needed since the last group of each word is decoded as a whole even if it's partial,
+        // but any garbage decoded past a word's postings is overwritten by the next word's postings.
+        std::shared_ptr<UncompressedData> uncompressed_data = std::make_shared<UncompressedData>();
+        uncompressed_data->CompressedData = OwnedData;
+        uncompressed_data->PostingVerseIndices.resize(PostingOffsets.back() + CompressedPostingLists::POSTINGS_PER_GROUP);
+        std::size_t word_count = WordCount();
+        for (std::size_t word_index_in_lexicon = 0; word_index_in_lexicon < word_count; ++word_index_in_lexicon)
+        {
+            std::size_t first_block_index = CompressedPostings.WordFirstBlockIndices[word_index_in_lexicon];
+            std::size_t end_block_index = CompressedPostings.WordFirstBlockIndices[word_index_in_lexicon + 1];
+            for (std::size_t block_index = first_block_index; block_index < end_block_index; ++block_index)
+            {
+                std::size_t block_start_posting_index = PostingOffsets[word_index_in_lexicon] + (block_index - first_block_index) * CompressedPostingLists::POSTINGS_PER_BLOCK;
+                CompressedPostings.DecodeBlock(block_index, uncompressed_data->PostingVerseIndices.data() + block_start_posting_index);
+            }
         }
+        uncompressed_data->PostingVerseIndices.resize(PostingOffsets.back());
+        uncompressed_data->PostingVerseIndices.shrink_to_fit();
 
-        return matching_verses;
+        // SWITCH THE COPY TO THE UNCOMPRESSED POSTINGS.
+        word_index.PostingVerseIndices = uncompressed_data->PostingVerseIndices;
+        word_index.CompressedPostings = {};
+        word_index.OwnedData = uncompressed_data;
+        return word_index;
     }
 
-    /// Gets matching verses for the corresponding word in a categorized form.
-    /// @param[in]  verse_id - The ID of the verse to use for categorization purposes.
-    /// @param[in]  word - The word for which to get matching verses.
-    /// @return The matching verses in categorized form.
-    CategorizedBibleVerseSearchResults BibleWordIndex::GetMatchingVerses(
-        const BibleVerseId& verse_id,
-        const std::string_view word) const
+    /// Builds a stem index for the lexicon, which allows matching words by stem.
+    /// Each distinct word is only stemmed once, so the cost depends on the size of the lexicon
+    /// rather than the number of word occurrences.
+    /// Searches use a stem index that is built on first use (see GetStemIndex()), so this only needs to be
+    /// called directly to get a separate stem index.
+    /// @return The stem index for the lexicon.
+    BibleWordIndex::StemIndex BibleWordIndex::BuildStemIndex() const
     {
-        // INITIALIZE THE SEARCH RESULTS.
-        CategorizedBibleVerseSearchResults search_results =
+        // STEM EACH WORD IN THE LEXICON.
+        std::size_t word_count = WordCount();
+        std::vector<std::string> stems_by_word_index;
+        stems_by_word_index.reserve(word_count);
+        for (std::size_t word_index = 0; word_index < word_count; ++word_index)
         {
-            .SearchedWord = std::string(word),
-            .OriginalVerseId = verse_id,
-        };
+            std::string word_stem = StemWord(GetWord(word_index));
+            stems_by_word_index.emplace_back(std::move(word_stem));
+        }
 
-        // MAKE SURE THE WORD IS LOWERCASE.
-        std::string lowercase_word(word);
-        std::transform(
-            lowercase_word.begin(),
-            lowercase_word.end(),
-            lowercase_word.begin(),
-            [](const char character)
+        // SORT THE WORDS BY STEM.
+        // Sorting is stable so that words with the same stem remain in lexicon order.
+        std::vector<std::uint32_t> word_indices_sorted_by_stem(word_count);
+        std::iota(word_indices_sorted_by_stem.begin(), word_indices_sorted_by_stem.end(), 0);
+        std::stable_sort(
+            word_indices_sorted_by_stem.begin(),
+            word_indices_sorted_by_stem.end(),
+            [&stems_by_word_index](const std::uint32_t left_word_index, const std::uint32_t right_word_index)
             {
-                return static_cast<char>(std::tolower(static_cast<int>(character)));
+                return stems_by_word_index[left_word_index] < stems_by_word_index[right_word_index];
             });
 
-        // GET ANY ROOT WORD IF APPLICABLE.
-        auto current_word_and_root_word = RootWordsByOriginalWord.find(lowercase_word);
-        bool different_root_word_found = (RootWordsByOriginalWord.cend() != current_word_and_root_word);
-        if (different_root_word_found)
+        // GROUP THE WORDS BY STEM.
+        StemIndex stem_index;
+        stem_index.LexiconStemIndices.resize(word_count);
+        stem_index.StemWordIndices.reserve(word_count);
+        for (const std::uint32_t word_index : word_indices_sorted_by_stem)
         {
-            lowercase_word = current_word_and_root_word->second;
+            // ADD THE WORD'S STEM IF IT'S NEW.
+            const std::string& word_stem = stems_by_word_index[word_index];
+            bool new_stem = stem_index.StemWordIndices.empty() || (word_stem != stems_by_word_index[stem_index.StemWordIndices.back()]);
+            if (new_stem)
+            {
+                stem_index.StemOffsets.push_back(static_cast<std::uint32_t>(stem_index.StemCharacters.size()));
+                stem_index.StemCharacters += word_stem;
+                stem_index.StemWordOffsets.push_back(static_cast<std::uint32_t>(stem_index.StemWordIndices.size()));
+            }
+
+            // ADD THE WORD TO ITS STEM.
+            stem_index.LexiconStemIndices[word_index] = static_cast<std::uint32_t>(stem_index.StemWordOffsets.size() - 1);
+            stem_index.StemWordIndices.push_back(word_index);
         }
+        stem_index.StemOffsets.push_back(static_cast<std::uint32_t>(stem_index.StemCharacters.size()));
+        stem_index.StemWordOffsets.push_back(static_cast<std::uint32_t>(stem_index.StemWordIndices.size()));
 
-        // SEARCH FOR ANY MATCHING VERSES.
-        auto word_with_verse_ids_with_character_ranges = BibleVersesByWord.find(lowercase_word);
-        bool word_found = (BibleVersesByWord.cend() != word_with_verse_ids_with_character_ranges);
-        if (!word_found)
+        return stem_index;
+    }
+
+    /// Gets the number of unique words in the index.
+    /// @return The number of words in the lexicon.
+    std::size_t BibleWordIndex::WordCount() const
+    {
+        // An index that hasn't been built has no offsets at all.
+        if (LexiconWordOffsets.empty())
         {
-            // INDICATE THAT NO MATCHING VERSES COULD BE FOUND.
-            return {};
+            return 0;
         }
 
-        // GET THE FULL VERSES FOR THE MATCHING VERSES IDENTIFIED ABOVE.
-        const std::vector<BibleVerseIdWithCharacterRange>& verse_ids_with_character_ranges = word_with_verse_ids_with_character_ranges->second;
+        // The extra final offset doesn't correspond to a word.
+        std::size_t word_count = LexiconWordOffsets.size() - 1;
+        return word_count;
+    }
 
-        std::printf("Matching verse count: %zu\n", verse_ids_with_character_ranges.size());
+    /// Gets the memory used by the index's data, broken down by component.
+    /// Arrays are counted for the data the index views, regardless of whether it was built,
+    /// precomputed into code, or memory-mapped from a file.
+    /// @return The memory used by the index.
+    MemoryUsageReport BibleWordIndex::MemoryUsage() const
+    {
+        // ADD THE COMPONENTS OF THE MAIN INDEX.
+        MemoryUsageReport memory_usage;
+        memory_usage.Add("Lexicon strings", LexiconCharacters.size() + LexiconWordOffsets.size_bytes());
+        memory_usage.Add("Postings", PostingVerseIndices.size_bytes() + PostingOffsets.size_bytes() + CompressedPostings.SizeInBytes());
+        memory_usage.Add("Token positions", PostingTokenPositions.size_bytes());
+        memory_usage.Add("Ranking statistics", VerseWordCounts.size_bytes() + WordVerseCounts.size_bytes());
 
-        for (const BibleVerseIdWithCharacterRange& verse_id_with_character_range : verse_ids_with_character_ranges)
+        // ADD THE STEM INDEX IF IT HAS BEEN BUILT.
+        // It isn't built just to report its memory, since that would use memory that may never otherwise be used.
+        bool stem_index_built = LazyStems && LazyStems->Built;
+        if (stem_index_built)
         {
-            // GET THE CURRENT VERSE TEXT.
-            const char* first_character_in_verse = Bible->Text + verse_id_with_character_range.FirstCharacterOffsetIntoFullBibleText;
-            std::size_t verse_character_count = (
-                verse_id_with_character_range.LastCharacterOffsetIntoFullBibleText -
-                verse_id_with_character_range.FirstCharacterOffsetIntoFullBibleText);
-            std::string_view current_verse_text(first_character_in_verse, verse_character_count);
+            const StemIndex& stem_index = LazyStems->Stems;
+            std::size_t stem_index_size_in_bytes = (
+                stem_index.StemCharacters.capacity() +
+                sizeof(std::uint32_t) * (
+                    stem_index.StemOffsets.capacity() +
+                    stem_index.LexiconStemIndices.capacity() +
+                    stem_index.StemWordOffsets.capacity() +
+                    stem_index.StemWordIndices.capacity()));
+            memory_usage.Add("Stem index", stem_index_size_in_bytes);
+        }
 
-            // GET THE FULL FORM OF THE CURRENT MATCHING VERSE.
-            BibleVerse current_verse =
-            {
-                .Id = BibleVerseId
-                {
-                    .Book = verse_id_with_character_range.Id.Book,
-                    .ChapterNumber = verse_id_with_character_range.Id.ChapterNumber,
-                    .VerseNumber = verse_id_with_character_range.Id.VerseNumber,
-                },
-                .Text = current_verse_text
-            };
+        return memory_usage;
+    }
+
+    /// Gets a word from the lexicon.
+    /// @param[in]  word_index - The index of the word in the lexicon.  Must be less than WordCount().
+    /// @return The lowercase word.
+    std::string_view BibleWordIndex::GetWord(const std::size_t word_index) const
+    {
+        std::uint32_t word_start_offset = LexiconWordOffsets[word_index];
+        std::uint32_t word_end_offset = LexiconWordOffsets[word_index + 1];
+        std::string_view word(LexiconCharacters.data() + word_start_offset, word_end_offset - word_start_offset);
+        return word;
+    }
+
+    /// Determines if postings are stored compressed (see CompressedPostings).
+    /// @return True if postings are compressed; false otherwise.
+    bool BibleWordIndex::HasCompressedPostings() const
+    {
+        bool has_compressed_postings = !CompressedPostings.Empty();
+        return has_compressed_postings;
+    }
 
-            // PLACE THE VERSE IN THE APPROPRIATE CATEGORY OF SEARCH RESULTS.
-            bool in_same_book = (verse_id.Book == current_verse.Id.Book);
-            if (in_same_book)
+    /// Gets the stem index for the lexicon, building it if this is its first use.
+    /// It's only built once for an index and all of its copies, even if first used by multiple threads at once.
+    /// @return The stem index; null if the index wasn't created from any data.
+    const BibleWordIndex::StemIndex* BibleWordIndex::GetStemIndex() const
+    {
+        if (!LazyStems)
+        {
+            return nullptr;
+        }
+
+        std::call_once(LazyStems->BuildOnce, [this]()
+        {
+            LazyStems->Stems = BuildStemIndex();
+            LazyStems->Built = true;
+        });
+        return &LazyStems->Stems;
+    }
+
+    /// Gets the number of postings (occurrences) for a word in the lexicon without accessing the postings themselves.
+    /// @param[in]  word_index - The index of the word in the lexicon.  Must be less than WordCount().
+    /// @return The number of occurrences of the word.
+    std::size_t BibleWordIndex::GetPostingCount(const std::size_t word_index) const
+    {
+        std::size_t posting_count = PostingOffsets[word_index + 1] - PostingOffsets[word_index];
+        return posting_count;
+    }
+
+    /// Gets the posting list of verse indices for a word in the lexicon.
+    /// @param[in]  word_index - The index of the word in the lexicon.  Must be less than WordCount().
+    /// @param[in,out]  decoded_verse_indices - Storage for the verse indices if postings are compressed.
+    ///     Any previous contents are replaced, but the existing capacity is reused.  Unused if postings aren't compressed.
+    /// @return The verse indices for every occurrence of the word, in canonical verse order.
+    ///     Uncompressed postings are viewed directly; otherwise, this views the decoded verse indices.
+    std::span<const BibleWordIndex::VerseIndex> BibleWordIndex::GetVerseIndices(
+        const std::size_t word_index,
+        std::vector<VerseIndex>& decoded_verse_indices) const
+    {
+        // DECODE ANY COMPRESSED POSTINGS.
+        if (HasCompressedPostings())
+        {
+            CompressedPostings.DecodeVerseIndices(word_index, decoded_verse_indices);
+            return decoded_verse_indices;
+        }
+
+        // VIEW THE UNCOMPRESSED POSTINGS DIRECTLY.
+        std::uint32_t first_posting_offset = PostingOffsets[word_index];
+        std::uint32_t end_posting_offset = PostingOffsets[word_index + 1];
+        std::span<const VerseIndex> verse_indices(PostingVerseIndices.data() + first_posting_offset, end_posting_offset - first_posting_offset);
+        return verse_indices;
+    }
+
+    /// Gets a cursor at the start of the postings for a word in the lexicon.
+    /// @param[in]  word_index - The index of the word in the lexicon.  Must be less than WordCount().
+    /// @return A cursor at the word's first posting (or at the end if the word has no postings).
+    ///     It must not outlive the index's data.
+    BibleWordIndex::PostingCursor BibleWordIndex::GetPostingCursor(const std::size_t word_index) const
+    {
+        // WALK THROUGH UNCOMPRESSED POSTINGS DIRECTLY.
+        if (!HasCompressedPostings())
+        {
+            std::uint32_t first_posting_offset = PostingOffsets[word_index];
+            std::uint32_t end_posting_offset = PostingOffsets[word_index + 1];
+            std::span<const VerseIndex> verse_indices(PostingVerseIndices.data() + first_posting_offset, end_posting_offset - first_posting_offset);
+            return PostingCursor::FromVerseIndices(verse_indices);
+        }
+
+        // DECODE THE FIRST BLOCK OF COMPRESSED POSTINGS.
+        PostingCursor cursor;
+        cursor.CompressedPostings = CompressedPostings;
+        cursor.TotalPostingCount = GetPostingCount(word_index);
+        cursor.BlockIndex = CompressedPostings.WordFirstBlockIndices[word_index];
+        cursor.EndBlockIndex = CompressedPostings.WordFirstBlockIndices[word_index + 1];
+        cursor.DecodeCurrentBlock();
+        return cursor;
+    }
+
+    /// Gets the verses matching a single word in the batch.
+    /// @param[in]  word_index - The index of the word in the batch.  Must be less than the number of words in the batch.
+    /// @return The verses matching the word.
+    std::span<const BibleVerse> BibleWordIndex::MatchingVersesBatch::GetVerses(const std::size_t word_index) const
+    {
+        std::size_t first_verse_offset = VerseOffsets[word_index];
+        std::size_t end_verse_offset = VerseOffsets[word_index + 1];
+        std::span<const BibleVerse> verses(Verses.data() + first_verse_offset, end_verse_offset - first_verse_offset);
+        return verses;
+    }
+
+    /// Determines if the index has token positions, which allow faster phrase searches.
+    /// @return True if the index has token positions; false otherwise.
+    bool BibleWordIndex::HasTokenPositions() const
+    {
+        // Token positions exist for either all postings or none.
+        bool has_token_positions = !PostingTokenPositions.empty();
+        return has_token_positions;
+    }
+
+    /// Gets the positions within verses for a word in the lexicon.
+    /// @param[in]  word_index - The index of the word in the lexicon.  Must be less than WordCount().
+    /// @return The positions within verses for every occurrence of the word, in parallel with GetVerseIndices().
+    ///     Within a single verse, positions are in increasing order.  Empty if the index lacks token positions.
+    std::span<const BibleWordIndex::TokenPosition> BibleWordIndex::GetTokenPositions(const std::size_t word_index) const
+    {
+        if (!HasTokenPositions())
+        {
+            return {};
+        }
+
+        std::uint32_t first_posting_offset = PostingOffsets[word_index];
+        std::uint32_t end_posting_offset = PostingOffsets[word_index + 1];
+        std::span<const TokenPosition> token_positions(PostingTokenPositions.data() + first_posting_offset, end_posting_offset - first_posting_offset);
+        return token_positions;
+    }
+
+    /// Finds a word in the lexicon.
+    /// @param[in]  lowercase_word - The already lowercased (and root-word normalized, if desired) word to find.
+    /// @return The index of the word in the lexicon, if found; null otherwise.
+    std::optional<std::size_t> BibleWordIndex::FindWord(const std::string_view lowercase_word) const
+    {
+        // BINARY SEARCH THE SORTED LEXICON FOR THE WORD.
+        std::size_t low_word_index = 0;
+        std::size_t high_word_index = WordCount();
+        while (low_word_index < high_word_index)
+        {
+            std::size_t middle_word_index = low_word_index + (high_word_index - low_word_index) / 2;
+            std::string_view middle_word = GetWord(middle_word_index);
+            if (middle_word < lowercase_word)
             {
-                // CHECK IF THE VERSE IS IN THE SAME CHAPTER.
-                bool in_same_chapter = (verse_id.ChapterNumber == current_verse.Id.ChapterNumber);
-                if (in_same_chapter)
-                {
-                    // CHECK IF THE SAME IS THE SEARCHED FOR VERSE.
-                    // The same verse as that searched for does not need to be repeated.
-                    bool is_same_verse = (verse_id.VerseNumber == current_verse.Id.VerseNumber);
-                    if (!is_same_verse)
-                    {
-                        search_results.VersesInSameChapter.push_back(current_verse);
-                    }
-                }
-                else
-                {
-                    // STORE THE VERSE AS BEING IN THE SAME BOOK.
-                    search_results.VersesInSameBook.push_back(current_verse);
-                }
+                low_word_index = middle_word_index + 1;
             }
             else
             {
-                // CHECK IF THE VERSE IS IN ANOTHER BOOK BY THE SAME AUTHOR.
-                BibleAuthor::Id searched_verse_author = BibleAuthor::Get(verse_id);
-                BibleAuthor::Id current_verse_author = BibleAuthor::Get(current_verse.Id);
-                bool verse_in_other_book_by_same_author = (searched_verse_author == current_verse_author);
-                if (verse_in_other_book_by_same_author)
-                {
-                    // STORE THE VERSE AS BEING IN ANOTHER BOOK BY THE SAME AUTHOR.
-                    search_results.VersesInOtherBooksByAuthor.push_back(current_verse);
-                }
-                else
-                {
-                    // CHECK IF THE VERSE IS IN THE SAME TESTAMENT.
-                    BibleTestament::Id searched_verse_testament = BibleTestament::Get(verse_id);
-                    BibleTestament::Id current_verse_testament = BibleTestament::Get(current_verse.Id);
-                    bool verse_in_same_testament = (searched_verse_testament == current_verse_testament);
-                    if (verse_in_same_testament)
-                    {
-                        // CHECK IF THE VERSE IS IN ANOTHER BOOK OF THE SAME GENRE.
-                        BibleBookGenre::Id searched_verse_book_genre = BibleBookGenre::Get(verse_id);
-                        BibleBookGenre::Id current_verse_book_genre = BibleBookGenre::Get(current_verse.Id);
-                        bool verse_in_other_book_of_same_genre = (searched_verse_book_genre == current_verse_book_genre);
-                        if (verse_in_other_book_of_same_genre)
-                        {
-                            // STORE THE VERSE AS BEING IN ANOTHER BOOK OF THE SAME GENRE IN THE TESTAMENT.
-                            search_results.VersesInBooksOfSameGenreByOtherAuthorsInSameTestament.push_back(current_verse);
-                        }
-                        else
-                        {
-                            // STORE THE VERSE AS BEING ELSEWHERE IN THE SAME TESTAMENT.
-                            search_results.VersesElsewhereInSameTestament.push_back(current_verse);
-                        }
-                    }
-                    else
-                    {
-                        // STORE THE VERSE AS BEING IN THE OTHER TESTAMENT.
-                        search_results.VersesFromOtherTestament.push_back(current_verse);
-                    }
-                }
+                high_word_index = middle_word_index;
             }
         }
 
-        // RETURN THE SEARCH RESULTS.
-        return search_results;
+        // CHECK IF THE WORD WAS FOUND.
+        bool word_found = (low_word_index < WordCount()) && (GetWord(low_word_index) == lowercase_word);
+        if (!word_found)
+        {
+            return std::nullopt;
+        }
+
+        return low_word_index;
+    }
+
+    /// Finds a stem in the stem index.
+    /// @param[in]  stem - The stem to find (see StemWord()).
+    /// @return The index of the stem in the stem index (see GetStemIndex()), if found; null otherwise.
+    std::optional<std::size_t> BibleWordIndex::FindStem(const std::string_view stem) const
+    {
+        const StemIndex* stems = GetStemIndex();
+        if (!stems)
+        {
+            return std::nullopt;
+        }
+
+        // BINARY SEARCH THE SORTED STEMS.
+        std::size_t stem_count = stems->StemOffsets.size() - 1;
+        auto get_stem = [stems](const std::size_t stem_index)
+        {
+            std::uint32_t stem_start_offset = stems->StemOffsets[stem_index];
+            std::uint32_t stem_end_offset = stems->StemOffsets[stem_index + 1];
+            std::string_view indexed_stem(stems->StemCharacters.data() + stem_start_offset, stem_end_offset - stem_start_offset);
+            return indexed_stem;
+        };
+        std::size_t low_stem_index = 0;
+        std::size_t high_stem_index = stem_count;
+        while (low_stem_index < high_stem_index)
+        {
+            std::size_t middle_stem_index = low_stem_index + (high_stem_index - low_stem_index) / 2;
+            if (get_stem(middle_stem_index) < stem)
+            {
+                low_stem_index = middle_stem_index + 1;
+            }
+            else
+            {
+                high_stem_index = middle_stem_index;
+            }
+        }
+
+        // CHECK IF THE STEM WAS FOUND.
+        bool stem_found = (low_stem_index < stem_count) && (get_stem(low_stem_index) == stem);
+        if (!stem_found)
+        {
+            return std::nullopt;
+        }
+
+        return low_stem_index;
+    }
+
+    /// Gets the most frequent words in the lexicon that start with a prefix, such as for autocompleting words as they're typed.
+    /// The index is never modified after creation, so this may be called concurrently from multiple threads.
+    /// @param[in]  lowercase_prefix - The already lowercased prefix of words to get.  An empty prefix matches all words.
+    /// @param[in]  max_word_count - The maximum number of words to get.
+    /// @return Up to the maximum number of words starting with the prefix, in order of decreasing occurrence count.
+    ///     Words with the same occurrence count are in alphabetical order.
+    std::vector<BibleWordIndex::WordCompletion> BibleWordIndex::GetWordsWithPrefix(
+        const std::string_view lowercase_prefix,
+        const std::size_t max_word_count) const
+    {
+        // CHECK IF ANY WORDS WERE REQUESTED.
+        if (max_word_count == 0)
+        {
+            return {};
+        }
+
+        // FIND THE RANGE OF WORDS STARTING WITH THE PREFIX.
+        // Since the lexicon is sorted, all words with the prefix are contiguous,
+        // starting with the first word that isn't less than the prefix.
+        auto word_indices = std::views::iota(std::size_t{ 0 }, WordCount());
+        auto first_word_with_prefix = std::ranges::partition_point(
+            word_indices,
+            [&](const std::size_t word_index) { return GetWord(word_index) < lowercase_prefix; });
+        auto end_word_with_prefix = std::ranges::partition_point(
+            first_word_with_prefix,
+            word_indices.end(),
+            [&](const std::size_t word_index) { return GetWord(word_index).starts_with(lowercase_prefix); });
+
+        // KEEP THE MOST FREQUENT WORDS IN A BOUNDED HEAP.
+        // Short prefixes can match thousands of words, so only keeping the top words avoids sorting all of them.
+        // The heap is ordered so that its front is the lowest ranked word kept so far.
+        auto ranks_higher = [](const WordCompletion& left, const WordCompletion& right)
+        {
+            if (left.OccurrenceCount != right.OccurrenceCount)
+            {
+                return left.OccurrenceCount > right.OccurrenceCount;
+            }
+            return left.Word < right.Word;
+        };
+        std::vector<WordCompletion> word_completions;
+        word_completions.reserve(max_word_count);
+        for (auto current_word_with_prefix = first_word_with_prefix; current_word_with_prefix != end_word_with_prefix; ++current_word_with_prefix)
+        {
+            std::size_t word_index = *current_word_with_prefix;
+            WordCompletion word_completion =
+            {
+                .Word = GetWord(word_index),
+                .OccurrenceCount = PostingOffsets[word_index + 1] - PostingOffsets[word_index],
+            };
+
+            // ADD THE WORD IF THERE'S STILL ROOM.
+            if (word_completions.size() < max_word_count)
+            {
+                word_completions.push_back(word_completion);
+                std::push_heap(word_completions.begin(), word_completions.end(), ranks_higher);
+                continue;
+            }
+
+            // REPLACE THE LOWEST RANKED WORD IF THE CURRENT WORD IS MORE FREQUENT.
+            // Words are visited in alphabetical order, so a word with an equal count never ranks higher.
+            bool more_frequent_than_lowest_ranked_word = (word_completion.OccurrenceCount > word_completions.front().OccurrenceCount);
+            if (more_frequent_than_lowest_ranked_word)
+            {
+                std::pop_heap(word_completions.begin(), word_completions.end(), ranks_higher);
+                word_completions.back() = word_completion;
+                std::push_heap(word_completions.begin(), word_completions.end(), ranks_higher);
+            }
+        }
+
+        // ORDER THE WORDS FROM HIGHEST TO LOWEST RANKED.
+        std::sort_heap(word_completions.begin(), word_completions.end(), ranks_higher);
+        return word_completions;
+    }
+
+    /// Finds words in the lexicon within an edit distance of a word, such as for handling misspelled words.
+    /// The sorted lexicon is walked as if it were a trie, intersecting it with a Levenshtein automaton for the word:
+    /// edit distances for prefixes shared by consecutive words are only computed once, and all words
+    /// with a prefix are skipped as soon as the prefix is too distant, so most of the lexicon is never examined.
+    /// The index is never modified after creation, so this may be called concurrently from multiple threads.
+    /// @param[in]  word - The word to find similar words for.  It is normalized the same way as for indexing.
+    /// @param[in]  max_edit_distance - The maximum edit distance of similar words.
+    /// @return The similar words (including the word itself if in the lexicon), ordered by increasing edit distance.
+    ///     Words with the same edit distance are ordered by decreasing occurrence count and then alphabetically.
+    std::vector<BibleWordIndex::SimilarWord> BibleWordIndex::FindSimilarWords(
+        const std::string_view word,
+        const std::size_t max_edit_distance) const
+    {
+        // NORMALIZE THE WORD TO MATCH HOW IT'S INDEXED.
+        WordNormalizationBuffer word_normalization_buffer;
+        std::string_view normalized_word = NormalizeWord(word, word_normalization_buffer);
+
+        // INITIALIZE THE EDIT DISTANCES FOR AN EMPTY PREFIX.
+        // Each row holds the edit distances between a prefix of the current lexicon word (row N for N characters)
+        // and every prefix of the searched word, which is a single row of the standard Levenshtein table.
+        // Rows for all prefixes of the current lexicon word are kept so that they can be reused for the next word.
+        const std::size_t edit_distance_row_length = normalized_word.size() + 1;
+        std::vector<std::size_t> edit_distance_rows(edit_distance_row_length);
+        std::iota(edit_distance_rows.begin(), edit_distance_rows.end(), std::size_t{ 0 });
+        std::size_t computed_prefix_length = 0;
+        std::string_view computed_lexicon_word = "";
+
+        // FIND ALL SIMILAR WORDS IN THE LEXICON.
+        std::vector<SimilarWord> similar_words;
+        const std::size_t word_count = WordCount();
+        std::size_t word_index = 0;
+        while (word_index < word_count)
+        {
+            // REUSE EDIT DISTANCES FOR THE PREFIX SHARED WITH THE PREVIOUSLY EXAMINED WORD.
+            std::string_view lexicon_word = GetWord(word_index);
+            std::size_t max_shared_prefix_length = std::min(computed_prefix_length, lexicon_word.size());
+            std::size_t shared_prefix_length = 0;
+            while (shared_prefix_length < max_shared_prefix_length && computed_lexicon_word[shared_prefix_length] == lexicon_word[shared_prefix_length])
+            {
+                ++shared_prefix_length;
+            }
+            computed_prefix_length = shared_prefix_length;
+            computed_lexicon_word = lexicon_word;
+
+            // COMPUTE EDIT DISTANCES FOR THE REMAINING CHARACTERS OF THE WORD.
+            bool prefix_too_distant = false;
+            while (computed_prefix_length < lexicon_word.size())
+            {
+                // MAKE SURE SPACE EXISTS FOR THE NEXT ROW.
+                std::size_t prefix_length = computed_prefix_length + 1;
+                std::size_t required_edit_distance_count = (prefix_length + 1) * edit_distance_row_length;
+                if (edit_distance_rows.size() < required_edit_distance_count)
+                {
+                    edit_distance_rows.resize(required_edit_distance_count);
+                }
+
+                // COMPUTE THE ROW FROM THE PREVIOUS ROW.
+                const std::size_t* previous_row = &edit_distance_rows[computed_prefix_length * edit_distance_row_length];
+                std::size_t* current_row = &edit_distance_rows[prefix_length * edit_distance_row_length];
+                current_row[0] = prefix_length;
+                std::size_t min_edit_distance_in_row = current_row[0];
+                char lexicon_word_character = lexicon_word[computed_prefix_length];
+                for (std::size_t searched_prefix_length = 1; searched_prefix_length < edit_distance_row_length; ++searched_prefix_length)
+                {
+                    std::size_t substitution_cost = (normalized_word[searched_prefix_length - 1] == lexicon_word_character) ? 0 : 1;
+                    current_row[searched_prefix_length] = std::min({
+                        previous_row[searched_prefix_length] + 1,
+                        current_row[searched_prefix_length - 1] + 1,
+                        previous_row[searched_prefix_length - 1] + substitution_cost });
+                    min_edit_distance_in_row = std::min(min_edit_distance_in_row, current_row[searched_prefix_length]);
+                }
+                computed_prefix_length = prefix_length;
+
+                // SKIP ALL WORDS WITH THE PREFIX IF IT'S TOO DISTANT.
+                // Edit distances in later rows are never smaller than the smallest in this row,
+                // so no word starting with this prefix can be similar enough.
+                prefix_too_distant = (min_edit_distance_in_row > max_edit_distance);
+                if (prefix_too_distant)
+                {
+                    std::string_view too_distant_prefix = lexicon_word.substr(0, prefix_length);
+                    auto remaining_word_indices = std::views::iota(word_index, word_count);
+                    auto end_word_with_prefix = std::ranges::partition_point(
+                        remaining_word_indices,
+                        [&](const std::size_t remaining_word_index) { return GetWord(remaining_word_index).starts_with(too_distant_prefix); });
+                    word_index += static_cast<std::size_t>(end_word_with_prefix - remaining_word_indices.begin());
+                    break;
+                }
+            }
+            if (prefix_too_distant)
+            {
+                continue;
+            }
+
+            // ADD THE WORD IF IT'S SIMILAR ENOUGH.
+            std::size_t edit_distance = edit_distance_rows[lexicon_word.size() * edit_distance_row_length + normalized_word.size()];
+            if (edit_distance <= max_edit_distance)
+            {
+                similar_words.push_back(SimilarWord
+                {
+                    .WordIndex = word_index,
+                    .Word = lexicon_word,
+                    .EditDistance = edit_distance,
+                });
+            }
+            ++word_index;
+        }
+
+        // ORDER THE SIMILAR WORDS FROM MOST TO LEAST LIKELY TO BE INTENDED.
+        std::sort(
+            similar_words.begin(),
+            similar_words.end(),
+            [&](const SimilarWord& left, const SimilarWord& right)
+            {
+                if (left.EditDistance != right.EditDistance)
+                {
+                    return left.EditDistance < right.EditDistance;
+                }
+
+                std::size_t left_occurrence_count = GetPostingCount(left.WordIndex);
+                std::size_t right_occurrence_count = GetPostingCount(right.WordIndex);
+                if (left_occurrence_count != right_occurrence_count)
+                {
+                    return left_occurrence_count > right_occurrence_count;
+                }
+
+                return left.WordIndex < right.WordIndex;
+            });
+        return similar_words;
+    }
+
+    /// Gets matching verses for the corresponding word.
+    /// @param[in]  word - The word for which to get matching verses.
+    /// @param[in]  match_type - How to match the word against words in the index.
+    /// @return The verses matching the word, with one verse per occurrence of a matching word.
+    std::vector<BibleVerse> BibleWordIndex::GetMatchingVerses(const std::string_view word, const WordMatchType match_type) const
+    {
+        // SEARCH FOR ANY MATCHING VERSES.
+        std::vector<VerseIndex> verse_indices = GetMatchingVerseIndices(word, match_type);
+
+        // GET THE FULL VERSES FOR THE MATCHING VERSES IDENTIFIED ABOVE.
+        std::vector<BibleVerse> matching_verses;
+        matching_verses.reserve(verse_indices.size());
+        for (const VerseIndex verse_index : verse_indices)
+        {
+            BibleVerse current_verse = Bible->GetVerse(verse_index);
+            matching_verses.emplace_back(current_verse);
+        }
+
+        return matching_verses;
+    }
+
+    /// Gets matching verses for each word in a batch, which is faster than getting them separately for many words.
+    /// Each word is only normalized once, and verses are written directly into the caller's storage
+    /// rather than into separately allocated results for each word.
+    /// @param[in]  words - The words for which to get matching verses.
+    /// @param[in,out]  matching_verses_batch - The storage for the matching verses.  Any previous contents are replaced,
+    ///     but previously allocated memory is reused.
+    /// @param[in]  match_type - How to match the words against words in the index.
+    /// @param[in]  thread_count - The number of threads to use for getting verses.
+    void BibleWordIndex::GetMatchingVersesBatch(
+        const std::span<const std::string_view> words,
+        MatchingVersesBatch& matching_verses_batch,
+        const WordMatchType match_type,
+        const unsigned int thread_count) const
+    {
+        // DETERMINE HOW TO SPLIT UP THE WORDS.
+        // More chunks than threads exist so that threads finishing early (such as from only having rare words)
+        // can take remaining chunks.
+        constexpr std::size_t CHUNKS_PER_THREAD = 8;
+        std::size_t word_count = words.size();
+        std::size_t worker_thread_count = std::clamp<std::size_t>(thread_count, 1, std::max<std::size_t>(word_count, 1));
+        std::size_t chunk_count = std::clamp<std::size_t>(worker_thread_count * CHUNKS_PER_THREAD, 1, std::max<std::size_t>(word_count, 1));
+
+        // DEFINE HOW TO PROCESS ALL CHUNKS OF WORDS.
+        // Work is only done on separate threads if multiple threads were requested.
+        auto process_all_chunks = [&](const auto& process_words)
+        {
+            std::atomic<std::size_t> next_chunk_index = 0;
+            auto process_chunks = [&]()
+            {
+                for (std::size_t chunk_index = next_chunk_index++; chunk_index < chunk_count; chunk_index = next_chunk_index++)
+                {
+                    std::size_t chunk_start_word_index = (word_count * chunk_index) / chunk_count;
+                    std::size_t chunk_end_word_index = (word_count * (chunk_index + 1)) / chunk_count;
+                    process_words(chunk_start_word_index, chunk_end_word_index);
+                }
+            };
+
+            bool single_threaded = (1 == worker_thread_count);
+            if (single_threaded)
+            {
+                process_chunks();
+            }
+            else
+            {
+                std::vector<std::thread> threads;
+                threads.reserve(worker_thread_count);
+                for (std::size_t thread_index = 0; thread_index < worker_thread_count; ++thread_index)
+                {
+                    threads.emplace_back(process_chunks);
+                }
+                for (std::thread& thread : threads)
+                {
+                    thread.join();
+                }
+            }
+        };
+
+        // FIND THE MATCHING VERSE INDICES FOR ALL WORDS.
+        // Root word matches are the postings themselves, so only other types of matching
+        // (or decoding compressed postings) need separate storage.
+        std::vector<std::span<const VerseIndex>> verse_indices_by_word(word_count);
+        bool matching_root_words = (WordMatchType::ROOT_WORD == match_type);
+        bool separate_storage_needed = !matching_root_words || HasCompressedPostings();
+        std::vector<std::vector<VerseIndex>> matched_verse_indices_by_word(separate_storage_needed ? word_count : 0);
+        process_all_chunks([&](const std::size_t start_word_index, const std::size_t end_word_index)
+        {
+            WordNormalizationBuffer word_normalization_buffer;
+            for (std::size_t word_index = start_word_index; word_index < end_word_index; ++word_index)
+            {
+                std::string_view normalized_word = NormalizeWord(words[word_index], word_normalization_buffer);
+                std::optional<std::size_t> lexicon_word_index = FindWord(normalized_word);
+                if (matching_root_words)
+                {
+                    if (lexicon_word_index)
+                    {
+                        // Storage only exists if postings need to be decoded.
+                        std::vector<VerseIndex> no_decoded_verse_indices;
+                        std::vector<VerseIndex>& decoded_verse_indices = separate_storage_needed ? matched_verse_indices_by_word[word_index] : no_decoded_verse_indices;
+                        verse_indices_by_word[word_index] = GetVerseIndices(*lexicon_word_index, decoded_verse_indices);
+                    }
+                }
+                else
+                {
+                    std::vector<VerseIndex>& matched_verse_indices = matched_verse_indices_by_word[word_index];
+                    AppendMatchingVerseIndices(words[word_index], normalized_word, lexicon_word_index, match_type, matched_verse_indices);
+                    verse_indices_by_word[word_index] = matched_verse_indices;
+                }
+            }
+        });
+
+        // ALLOCATE SPACE FOR ALL MATCHING VERSES.
+        matching_verses_batch.VerseOffsets.resize(word_count + 1);
+        std::size_t total_verse_count = 0;
+        for (std::size_t word_index = 0; word_index < word_count; ++word_index)
+        {
+            matching_verses_batch.VerseOffsets[word_index] = total_verse_count;
+            total_verse_count += verse_indices_by_word[word_index].size();
+        }
+        matching_verses_batch.VerseOffsets[word_count] = total_verse_count;
+        matching_verses_batch.Verses.resize(total_verse_count);
+
+        // GET THE FULL VERSES FOR ALL WORDS.
+        // Each word's verses are written to their own part of the storage, so no synchronization is needed.
+        process_all_chunks([&](const std::size_t start_word_index, const std::size_t end_word_index)
+        {
+            for (std::size_t word_index = start_word_index; word_index < end_word_index; ++word_index)
+            {
+                BibleVerse* word_verses = matching_verses_batch.Verses.data() + matching_verses_batch.VerseOffsets[word_index];
+                for (const VerseIndex verse_index : verse_indices_by_word[word_index])
+                {
+                    *word_verses = Bible->GetVerse(verse_index);
+                    ++word_verses;
+                }
+            }
+        });
+    }
+
+    /// Gets all verses containing a word as a bitmap, for quickly combining with other sets of verses.
+    /// @param[in]  word - The word to search for.  It's normalized the same way as for indexing.
+    /// @return A bitmap of verses containing the word (empty if the word isn't in the index).
+    BibleVerseBitmap BibleWordIndex::GetMatchingVerseBitmap(const std::string_view word) const
+    {
+        // FIND THE WORD.
+        WordNormalizationBuffer word_normalization_buffer;
+        std::string_view normalized_word = NormalizeWord(word, word_normalization_buffer);
+        std::optional<std::size_t> word_index = FindWord(normalized_word);
+        if (!word_index)
+        {
+            return BibleVerseBitmap::Empty(Bible);
+        }
+
+        // SET THE BIT FOR EACH VERSE CONTAINING THE WORD.
+        std::vector<VerseIndex> decoded_verse_indices;
+        BibleVerseBitmap verse_bitmap = BibleVerseBitmap::FromVerseIndices(Bible, GetVerseIndices(*word_index, decoded_verse_indices));
+        return verse_bitmap;
+    }
+
+    /// Counts occurrences of a word within a range of verses without accessing any verse text.
+    /// Postings hold one entry per occurrence in verse order, so the position of the first posting at or after
+    /// a verse is the cumulative number of occurrences before that verse.  Counting is therefore just
+    /// a subtraction of two such positions, each found by skipping through the postings (logarithmic in the word's occurrences,
+    /// with at most two blocks decoded for compressed postings).
+    /// @param[in]  word_index - The index of the word in the lexicon.
+    /// @param[in]  first_verse_index - The index of the first verse in the range.
+    /// @param[in]  end_verse_index - The index just past the last verse in the range.
+    /// @return The number of occurrences of the word in the range.
+    std::size_t BibleWordIndex::CountOccurrences(const std::size_t word_index, const std::size_t first_verse_index, const std::size_t end_verse_index) const
+    {
+        PostingCursor postings = GetPostingCursor(word_index);
+        postings.SkipToVerse(first_verse_index);
+        std::size_t first_posting_index_in_range = postings.CurrentPostingIndex();
+        postings.SkipToVerse(end_verse_index);
+        std::size_t occurrence_count = postings.CurrentPostingIndex() - first_posting_index_in_range;
+        return occurrence_count;
+    }
+
+    /// Counts occurrences of a word within a range of verses without accessing any verse text.
+    /// @param[in]  word - The word to count.  It's normalized the same way as for indexing.
+    /// @param[in]  verse_range - The range of verses to count in.
+    /// @return The number of occurrences of the word in the range.
+    std::size_t BibleWordIndex::CountOccurrences(const std::string_view word, const BibleVerseRange& verse_range) const
+    {
+        // FIND THE WORD.
+        WordNormalizationBuffer word_normalization_buffer;
+        std::string_view normalized_word = NormalizeWord(word, word_normalization_buffer);
+        std::optional<std::size_t> word_index = FindWord(normalized_word);
+        if (!word_index)
+        {
+            return 0;
+        }
+
+        // COUNT OCCURRENCES IN THE VERSES FOR THE RANGE.
+        auto [first_verse_index, end_verse_index] = Bible->GetVerseIndexRange(verse_range);
+        std::size_t occurrence_count = CountOccurrences(*word_index, first_verse_index, end_verse_index);
+        return occurrence_count;
+    }
+
+    /// Counts occurrences of a word in each book without accessing any verse text.
+    /// Only books containing the word are visited, skipping to the end of each book's postings.
+    /// @param[in]  word - The word to count.  It's normalized the same way as for indexing.
+    /// @return The number of occurrences of the word in each book containing the word.
+    std::map<BibleBook::Id, std::size_t> BibleWordIndex::CountOccurrencesByBook(const std::string_view word) const
+    {
+        // FIND THE WORD.
+        WordNormalizationBuffer word_normalization_buffer;
+        std::string_view normalized_word = NormalizeWord(word, word_normalization_buffer);
+        std::optional<std::size_t> word_index = FindWord(normalized_word);
+        if (!word_index)
+        {
+            return {};
+        }
+
+        // COUNT OCCURRENCES IN EACH BOOK CONTAINING THE WORD.
+        std::map<BibleBook::Id, std::size_t> occurrence_counts_by_book;
+        PostingCursor postings = GetPostingCursor(*word_index);
+        while (!postings.AtEnd())
+        {
+            // FIND THE RANGE OF VERSES IN THE CURRENT BOOK.
+            BibleBook::Id book = Bible->VerseCharacterRanges[postings.CurrentVerseIndex()].Id.Book;
+            BibleVerseRange entire_book =
+            {
+                .StartingVerse = BibleVerseId { .Book = book, .ChapterNumber = 0, .VerseNumber = 0 },
+                .EndingVerse = BibleVerseId { .Book = book, .ChapterNumber = std::numeric_limits<unsigned int>::max(), .VerseNumber = std::numeric_limits<unsigned int>::max() },
+            };
+            std::size_t book_end_verse_index = Bible->GetVerseIndexRange(entire_book).second;
+
+            // SKIP TO THE FIRST POSTING AFTER THE BOOK.
+            std::size_t book_first_posting_index = postings.CurrentPostingIndex();
+            postings.SkipToVerse(book_end_verse_index);
+            occurrence_counts_by_book[book] = postings.CurrentPostingIndex() - book_first_posting_index;
+        }
+        return occurrence_counts_by_book;
+    }
+
+    /// Gets matching verses for the corresponding word in a categorized form.
+    /// @param[in]  verse_id - The ID of the verse to use for categorization purposes.
+    /// @param[in]  word - The word for which to get matching verses.
+    /// @param[in]  max_edit_distance - The maximum edit distance of other words whose verses should also be included
+    ///     (see FindSimilarWords()).  If 0, only verses with the word itself are included.
+    /// @param[in]  match_type - How to match the word against words in the index.
+    ///     Only used if no similar words are included.
+    /// @return The matching verses in categorized form.
+    CategorizedBibleVerseSearchResults BibleWordIndex::GetMatchingVerses(
+        const BibleVerseId& verse_id,
+        const std::string_view word,
+        const std::size_t max_edit_distance,
+        const WordMatchType match_type) const
+    {
+        // GET THE CATEGORIZED VERSES.
+        CategorizedBibleVersesView search_results_view = GetMatchingVersesView(verse_id, word, max_edit_distance, match_type);
+
+        // COPY THE VERSES FOR EACH CATEGORY.
+        auto get_verses = [](const BibleVersesView& verses_view)
+        {
+            std::vector<BibleVerse> verses;
+            verses.reserve(verses_view.size());
+            verses.assign(verses_view.begin(), verses_view.end());
+            return verses;
+        };
+        CategorizedBibleVerseSearchResults search_results =
+        {
+            .SearchedWord = search_results_view.SearchedWord,
+            .OriginalVerseId = search_results_view.OriginalVerseId,
+            .VersesInSameChapter = get_verses(search_results_view.VersesInSameChapter),
+            .VersesInSameBook = get_verses(search_results_view.VersesInSameBook),
+            .VersesInOtherBooksByAuthor = get_verses(search_results_view.VersesInOtherBooksByAuthor),
+            .VersesInBooksOfSameGenreByOtherAuthorsInSameTestament = get_verses(search_results_view.VersesInBooksOfSameGenreByOtherAuthorsInSameTestament),
+            .VersesElsewhereInSameTestament = get_verses(search_results_view.VersesElsewhereInSameTestament),
+            .VersesFromOtherTestament = get_verses(search_results_view.VersesFromOtherTestament),
+        };
+        return search_results;
+    }
+
+    /// Gets a view of matching verses for the corresponding word, without copying any verses.
+    /// @param[in]  word - The word for which to get matching verses.
+    /// @param[in]  match_type - How to match the word against words in the index.
+    /// @return The verses matching the word, with one verse per occurrence of a matching word.
+    ///     For root word matching of uncompressed postings, the view directly views the word's postings
+    ///     without allocating any memory.  Otherwise, the view owns newly allocated verse indices
+    ///     (including decoded postings if postings are compressed; see WithUncompressedPostings()).
+    BibleVersesView BibleWordIndex::GetMatchingVersesView(const std::string_view word, const WordMatchType match_type) const
+    {
+        // VIEW THE POSTINGS DIRECTLY FOR ROOT WORD MATCHING.
+        // Words are indexed by root word, so the postings are exactly the matching verses.
+        // Compressed postings must be decoded, so the view owns them like for other types of matching.
+        bool postings_viewable = (WordMatchType::ROOT_WORD == match_type) && !HasCompressedPostings();
+        if (postings_viewable)
+        {
+            BibleVersesView matching_verses = { .Translation = Bible };
+            WordNormalizationBuffer word_normalization_buffer;
+            std::string_view normalized_word = NormalizeWord(word, word_normalization_buffer);
+            std::optional<std::size_t> word_index = FindWord(normalized_word);
+            if (word_index)
+            {
+                std::vector<VerseIndex> no_decoded_verse_indices;
+                matching_verses.VerseIndices = GetVerseIndices(*word_index, no_decoded_verse_indices);
+            }
+            return matching_verses;
+        }
+
+        // VIEW THE VERSE INDICES FOR OTHER TYPES OF MATCHING.
+        std::vector<VerseIndex> verse_indices = GetMatchingVerseIndices(word, match_type);
+        return BibleVersesView::FromOwnedVerseIndices(Bible, std::move(verse_indices));
+    }
+
+    /// Gets a view of matching verses for the corresponding word in a categorized form.
+    /// Verses are only categorized by their IDs and then partitioned into a single buffer of verse indices,
+    /// so no verses are copied.
+    /// @param[in]  verse_id - The ID of the verse to use for categorization purposes.
+    /// @param[in]  word - The word for which to get matching verses.
+    /// @param[in]  max_edit_distance - The maximum edit distance of other words whose verses should also be included
+    ///     (see FindSimilarWords()).  If 0, only verses with the word itself are included.
+    /// @param[in]  match_type - How to match the word against words in the index.
+    ///     Only used if no similar words are included.
+    /// @return The matching verses in categorized form.
+    CategorizedBibleVersesView BibleWordIndex::GetMatchingVersesView(
+        const BibleVerseId& verse_id,
+        const std::string_view word,
+        const std::size_t max_edit_distance,
+        const WordMatchType match_type) const
+    {
+        // GET THE VERSE INDICES FOR THE WORD.
+        BibleVersesView matching_verses;
+        bool word_only = (0 == max_edit_distance);
+        if (word_only)
+        {
+            // SEARCH FOR ANY MATCHING VERSES.
+            matching_verses = GetMatchingVersesView(word, match_type);
+            if (matching_verses.empty())
+            {
+                // INDICATE THAT NO MATCHING VERSES COULD BE FOUND.
+                return {};
+            }
+        }
+        else
+        {
+            // COMBINE THE VERSE INDICES FOR ALL SIMILAR WORDS.
+            // They're sorted to keep verses in canonical order like for a single word.
+            std::vector<VerseIndex> similar_word_verse_indices;
+            std::vector<VerseIndex> decoded_verse_indices;
+            std::vector<SimilarWord> similar_words = FindSimilarWords(word, max_edit_distance);
+            for (const SimilarWord& similar_word : similar_words)
+            {
+                std::span<const VerseIndex> current_word_verse_indices = GetVerseIndices(similar_word.WordIndex, decoded_verse_indices);
+                similar_word_verse_indices.insert(similar_word_verse_indices.end(), current_word_verse_indices.begin(), current_word_verse_indices.end());
+            }
+            std::sort(similar_word_verse_indices.begin(), similar_word_verse_indices.end());
+            matching_verses = BibleVersesView::FromOwnedVerseIndices(Bible, std::move(similar_word_verse_indices));
+        }
+        std::span<const VerseIndex> verse_indices = matching_verses.VerseIndices;
+
+        // DETERMINE THE CATEGORY OF VERSES IN EACH BOOK.
+        // Verses outside the searched verse's book are categorized only based on their book,
+        // so categories are determined once per book rather than for every matching verse.
+        const BookAttributes& searched_book_attributes = ATTRIBUTES_BY_BOOK[verse_id.Book];
+        std::array<VerseCategory, BOOK_TABLE_SIZE> categories_by_book = {};
+        for (std::size_t book = 0; book < BOOK_TABLE_SIZE; ++book)
+        {
+            const BookAttributes& book_attributes = ATTRIBUTES_BY_BOOK[book];
+            bool is_searched_book = (static_cast<std::size_t>(verse_id.Book) == book);
+            if (is_searched_book)
+            {
+                // Verses in the same chapter are distinguished for each verse below.
+                categories_by_book[book] = VerseCategory::SAME_BOOK;
+            }
+            else if (searched_book_attributes.Author == book_attributes.Author)
+            {
+                categories_by_book[book] = VerseCategory::OTHER_BOOK_BY_AUTHOR;
+            }
+            else if (searched_book_attributes.Testament == book_attributes.Testament)
+            {
+                bool same_genre = (searched_book_attributes.Genre == book_attributes.Genre);
+                categories_by_book[book] = same_genre ? VerseCategory::SAME_GENRE_IN_TESTAMENT : VerseCategory::ELSEWHERE_IN_TESTAMENT;
+            }
+            else
+            {
+                categories_by_book[book] = VerseCategory::OTHER_TESTAMENT;
+            }
+        }
+
+        // CATEGORIZE EACH MATCHING VERSE.
+        // Only verse IDs are needed, so the full verses aren't retrieved yet.
+        std::vector<VerseCategory> verse_categories(verse_indices.size());
+        std::array<std::size_t, VERSE_CATEGORY_COUNT> verse_counts_by_category = {};
+        for (std::size_t posting_index = 0; posting_index < verse_indices.size(); ++posting_index)
+        {
+            const BibleVerseId& current_verse_id = Bible->VerseCharacterRanges[verse_indices[posting_index]].Id;
+            VerseCategory category = categories_by_book[current_verse_id.Book];
+
+            // CHECK IF THE VERSE IS IN THE SAME CHAPTER.
+            bool in_same_chapter = (VerseCategory::SAME_BOOK == category) && (verse_id.ChapterNumber == current_verse_id.ChapterNumber);
+            if (in_same_chapter)
+            {
+                // The same verse as that searched for does not need to be repeated.
+                bool is_same_verse = (verse_id.VerseNumber == current_verse_id.VerseNumber);
+                category = is_same_verse ? VerseCategory::SEARCHED_VERSE : VerseCategory::SAME_CHAPTER;
+            }
+
+            verse_categories[posting_index] = category;
+            ++verse_counts_by_category[static_cast<std::size_t>(category)];
+        }
+
+        // PARTITION THE VERSES INTO THEIR CATEGORIES.
+        // Each category is a contiguous subrange of a single buffer, in the same order as the categories,
+        // and verses within each category remain in their original order.
+        std::array<std::size_t, VERSE_CATEGORY_COUNT + 1> category_offsets = {};
+        for (std::size_t category = 0; category < VERSE_CATEGORY_COUNT; ++category)
+        {
+            category_offsets[category + 1] = category_offsets[category] + verse_counts_by_category[category];
+        }
+        std::vector<VerseIndex> categorized_verse_indices(verse_indices.size());
+        std::array<std::size_t, VERSE_CATEGORY_COUNT> next_offsets_by_category = {};
+        std::copy_n(category_offsets.cbegin(), VERSE_CATEGORY_COUNT, next_offsets_by_category.begin());
+        for (std::size_t posting_index = 0; posting_index < verse_indices.size(); ++posting_index)
+        {
+            std::size_t& next_offset = next_offsets_by_category[static_cast<std::size_t>(verse_categories[posting_index])];
+            categorized_verse_indices[next_offset] = verse_indices[posting_index];
+            ++next_offset;
+        }
+
+        // VIEW EACH CATEGORY OF VERSES.
+        // The searched verse is in the final category, which isn't viewed.
+        BibleVersesView all_categorized_verses = BibleVersesView::FromOwnedVerseIndices(Bible, std::move(categorized_verse_indices));
+        auto view_category = [&](const VerseCategory category)
+        {
+            std::size_t category_index = static_cast<std::size_t>(category);
+            BibleVersesView category_verses = all_categorized_verses;
+            category_verses.VerseIndices = all_categorized_verses.VerseIndices.subspan(
+                category_offsets[category_index],
+                category_offsets[category_index + 1] - category_offsets[category_index]);
+            return category_verses;
+        };
+        CategorizedBibleVersesView search_results =
+        {
+            .SearchedWord = std::string(word),
+            .OriginalVerseId = verse_id,
+            .VersesInSameChapter = view_category(VerseCategory::SAME_CHAPTER),
+            .VersesInSameBook = view_category(VerseCategory::SAME_BOOK),
+            .VersesInOtherBooksByAuthor = view_category(VerseCategory::OTHER_BOOK_BY_AUTHOR),
+            .VersesInBooksOfSameGenreByOtherAuthorsInSameTestament = view_category(VerseCategory::SAME_GENRE_IN_TESTAMENT),
+            .VersesElsewhereInSameTestament = view_category(VerseCategory::ELSEWHERE_IN_TESTAMENT),
+            .VersesFromOtherTestament = view_category(VerseCategory::OTHER_TESTAMENT),
+        };
+        return search_results;
+    }
+
+    /// Gets the verses most relevant to a query of one or more words, ranked using BM25 (https://en.wikipedia.org/wiki/Okapi_BM25).
+    /// The posting lists for all query words are walked in verse order at the same time, scoring each verse as it's reached,
+    /// so searching takes time proportional to the lengths of those posting lists rather than the number of verses.
+    /// Only the most relevant verses are kept (in a bounded heap) while scoring.
+    /// @param[in]  query_text - The words to search for.  Words are normalized the same way as for indexing.
+    /// @param[in]  max_verse_count - The maximum number of verses to get.
+    /// @return Up to the maximum number of verses containing any of the query words, in order of decreasing relevance.
+    ///     Verses with the same relevance are in canonical verse order.
+    std::vector<BibleWordIndex::ScoredVerse> BibleWordIndex::GetMostRelevantVerses(
+        const std::string_view query_text,
+        const std::size_t max_verse_count) const
+    {
+        // FIND THE QUERY WORDS IN THE LEXICON.
+        std::vector<std::size_t> query_word_indices = FindQueryWords(query_text);
+        bool any_verses_requested = (max_verse_count > 0);
+        if (query_word_indices.empty() || !any_verses_requested)
+        {
+            return {};
+        }
+
+        // SCORE EACH VERSE CONTAINING ANY QUERY WORD.
+        // The heap is ordered so that its front is the lowest ranked verse kept so far.
+        using VerseIndexWithScore = std::pair<VerseIndex, double>;
+        auto ranks_higher = [](const VerseIndexWithScore& left, const VerseIndexWithScore& right)
+        {
+            if (left.second != right.second)
+            {
+                return left.second > right.second;
+            }
+            return left.first < right.first;
+        };
+        std::vector<VerseIndexWithScore> most_relevant_verses;
+        most_relevant_verses.reserve(max_verse_count);
+        std::vector<PostingCursor> query_word_postings;
+        query_word_postings.reserve(query_word_indices.size());
+        for (const std::size_t query_word_index : query_word_indices)
+        {
+            query_word_postings.push_back(GetPostingCursor(query_word_index));
+        }
+        while (true)
+        {
+            // FIND THE NEXT VERSE CONTAINING ANY QUERY WORD.
+            std::optional<VerseIndex> next_verse_index;
+            for (const PostingCursor& postings : query_word_postings)
+            {
+                if (!postings.AtEnd())
+                {
+                    next_verse_index = next_verse_index ? std::min(*next_verse_index, postings.CurrentVerseIndex()) : postings.CurrentVerseIndex();
+                }
+            }
+            if (!next_verse_index)
+            {
+                break;
+            }
+
+            // SCORE THE VERSE BASED ON ALL QUERY WORD OCCURRENCES IN IT.
+            double relevance_score = 0.0;
+            for (std::size_t query_word_number = 0; query_word_number < query_word_indices.size(); ++query_word_number)
+            {
+                PostingCursor& postings = query_word_postings[query_word_number];
+                std::size_t occurrence_count_in_verse = 0;
+                while (!postings.AtEnd() && (postings.CurrentVerseIndex() == *next_verse_index))
+                {
+                    ++occurrence_count_in_verse;
+                    postings.MoveToNextPosting();
+                }
+
+                if (occurrence_count_in_verse > 0)
+                {
+                    relevance_score += ComputeRelevanceScore(query_word_indices[query_word_number], occurrence_count_in_verse, *next_verse_index);
+                }
+            }
+
+            // KEEP THE VERSE IF IT'S AMONG THE MOST RELEVANT SO FAR.
+            // Verses are visited in canonical order, so a verse with an equal score never ranks higher.
+            VerseIndexWithScore verse_index_with_score(*next_verse_index, relevance_score);
+            if (most_relevant_verses.size() < max_verse_count)
+            {
+                most_relevant_verses.push_back(verse_index_with_score);
+                std::push_heap(most_relevant_verses.begin(), most_relevant_verses.end(), ranks_higher);
+            }
+            else if (relevance_score > most_relevant_verses.front().second)
+            {
+                std::pop_heap(most_relevant_verses.begin(), most_relevant_verses.end(), ranks_higher);
+                most_relevant_verses.back() = verse_index_with_score;
+                std::push_heap(most_relevant_verses.begin(), most_relevant_verses.end(), ranks_higher);
+            }
+        }
+
+        // GET THE FULL VERSES FROM MOST TO LEAST RELEVANT.
+        std::sort_heap(most_relevant_verses.begin(), most_relevant_verses.end(), ranks_higher);
+        std::vector<ScoredVerse> scored_verses;
+        scored_verses.reserve(most_relevant_verses.size());
+        for (const auto& [verse_index, relevance_score] : most_relevant_verses)
+        {
+            scored_verses.push_back(ScoredVerse
+            {
+                .Verse = Bible->GetVerse(verse_index),
+                .RelevanceScore = relevance_score,
+            });
+        }
+        return scored_verses;
+    }
+
+    /// Sorts each category of a view of search results by relevance (as for GetMostRelevantVerses()) to a query.
+    /// Each verse is scored by searching the query words' posting lists for its index, so sorting takes time
+    /// proportional to the number of results rather than the number of verses, and no verse text is accessed.
+    /// Full verses can be produced from the sorted views afterwards as needed.
+    /// Sorted verse indices are stored in a new buffer so that any other copies of the view are unaffected.
+    /// @param[in]  query_text - The words to score verses for.  Words are normalized the same way as for indexing.
+    /// @param[in,out]  search_results - The search results (for verses in this index's translation) to sort.
+    ///     Verses with the same relevance remain in their original order.
+    void BibleWordIndex::SortByRelevance(const std::string_view query_text, CategorizedBibleVersesView& search_results) const
+    {
+        // FIND THE QUERY WORDS IN THE LEXICON.
+        std::vector<std::size_t> query_word_indices = FindQueryWords(query_text);
+
+        // SORT EACH CATEGORY OF VERSES.
+        BibleVersesView* verse_categories[] =
+        {
+            &search_results.VersesInSameChapter,
+            &search_results.VersesInSameBook,
+            &search_results.VersesInOtherBooksByAuthor,
+            &search_results.VersesInBooksOfSameGenreByOtherAuthorsInSameTestament,
+            &search_results.VersesElsewhereInSameTestament,
+            &search_results.VersesFromOtherTestament,
+        };
+        for (BibleVersesView* verses : verse_categories)
+        {
+            // SCORE EACH VERSE ONCE.
+            std::vector<std::pair<VerseIndex, double>> scored_verse_indices;
+            scored_verse_indices.reserve(verses->size());
+            for (const VerseIndex verse_index : verses->VerseIndices)
+            {
+                scored_verse_indices.emplace_back(verse_index, ScoreVerse(query_word_indices, verse_index));
+            }
+
+            // PUT THE MOST RELEVANT VERSES FIRST.
+            std::stable_sort(
+                scored_verse_indices.begin(),
+                scored_verse_indices.end(),
+                [](const std::pair<VerseIndex, double>& left, const std::pair<VerseIndex, double>& right) { return left.second > right.second; });
+            std::vector<VerseIndex> sorted_verse_indices;
+            sorted_verse_indices.reserve(scored_verse_indices.size());
+            for (const auto& [verse_index, relevance_score] : scored_verse_indices)
+            {
+                sorted_verse_indices.push_back(verse_index);
+            }
+            *verses = BibleVersesView::FromOwnedVerseIndices(Bible, std::move(sorted_verse_indices));
+        }
+    }
+
+    /// Scores a verse based on all occurrences of query words in it.
+    /// Each query word's posting list is searched for the verse, so verses can be scored without accessing their text.
+    /// @param[in]  query_word_indices - The indices in the lexicon of the query words.
+    /// @param[in]  verse_index - The index of the verse to score.
+    /// @return The relevance score for the verse.  Higher scores are more relevant.
+    double BibleWordIndex::ScoreVerse(const std::span<const std::size_t> query_word_indices, const std::size_t verse_index) const
+    {
+        double relevance_score = 0.0;
+        for (const std::size_t query_word_index : query_word_indices)
+        {
+            PostingCursor postings = GetPostingCursor(query_word_index);
+            postings.SkipToVerse(verse_index);
+            std::size_t occurrence_count_in_verse = 0;
+            while (!postings.AtEnd() && (postings.CurrentVerseIndex() == verse_index))
+            {
+                ++occurrence_count_in_verse;
+                postings.MoveToNextPosting();
+            }
+
+            if (occurrence_count_in_verse > 0)
+            {
+                relevance_score += ComputeRelevanceScore(query_word_index, occurrence_count_in_verse, verse_index);
+            }
+        }
+        return relevance_score;
+    }
+
+    /// Gets verses containing an exact phrase (a sequence of consecutive words).
+    /// Words are normalized the same way as for indexing, so variations of words with the same root
+    /// also match, and any punctuation between words is ignored.
+    /// Only verses containing the rarest word in the phrase are examined, so searching takes time
+    /// proportional to that word's postings rather than the size of the entire translation.
+    /// Token positions are used to check word order if available; otherwise, candidate verses are re-split into words.
+    /// @param[in]  phrase - The phrase to search for.
+    /// @return The verses matching the phrase, in canonical verse order.
+    std::vector<BibleVersePhraseMatch> BibleWordIndex::GetVersesMatchingPhrase(const std::string_view phrase) const
+    {
+        // FIND THE WORDS OF THE PHRASE IN THE LEXICON.
+        std::vector<std::size_t> phrase_word_indices;
+        bool all_phrase_words_found = true;
+        WordNormalizationBuffer word_normalization_buffer;
+        ForEachWord(
+            phrase,
+            true,
+            [&](const std::size_t, const std::string_view phrase_word)
+            {
+                std::string_view normalized_word = NormalizeWord(phrase_word, word_normalization_buffer);
+                std::optional<std::size_t> word_index = FindWord(normalized_word);
+                if (word_index)
+                {
+                    phrase_word_indices.push_back(*word_index);
+                }
+                else
+                {
+                    all_phrase_words_found = false;
+                }
+            });
+        bool phrase_words_exist = !phrase_word_indices.empty();
+        if (!all_phrase_words_found || !phrase_words_exist)
+        {
+            // INDICATE THAT NO MATCHING VERSES COULD BE FOUND.
+            return {};
+        }
+
+        // FIND THE RAREST WORD IN THE PHRASE.
+        std::size_t phrase_word_count = phrase_word_indices.size();
+        std::size_t rarest_word_position_in_phrase = 0;
+        for (std::size_t word_position_in_phrase = 1; word_position_in_phrase < phrase_word_count; ++word_position_in_phrase)
+        {
+            std::size_t current_word_posting_count = GetPostingCount(phrase_word_indices[word_position_in_phrase]);
+            std::size_t rarest_word_posting_count = GetPostingCount(phrase_word_indices[rarest_word_position_in_phrase]);
+            bool current_word_rarer = (current_word_posting_count < rarest_word_posting_count);
+            if (current_word_rarer)
+            {
+                rarest_word_position_in_phrase = word_position_in_phrase;
+            }
+        }
+        std::span<const TokenPosition> rarest_word_token_positions = GetTokenPositions(phrase_word_indices[rarest_word_position_in_phrase]);
+
+        // EXAMINE EACH VERSE CONTAINING THE RAREST WORD.
+        // Verses are visited in order, so cursors for each word's postings only ever need to move forward.
+        std::vector<PostingCursor> postings_by_word_position;
+        postings_by_word_position.reserve(phrase_word_count);
+        for (const std::size_t word_index : phrase_word_indices)
+        {
+            postings_by_word_position.push_back(GetPostingCursor(word_index));
+        }
+        PostingCursor& rarest_word_postings = postings_by_word_position[rarest_word_position_in_phrase];
+        std::vector<std::size_t> verse_first_posting_indices_by_word_position(phrase_word_count, 0);
+        std::vector<std::size_t> verse_end_posting_indices_by_word_position(phrase_word_count, 0);
+        std::vector<std::size_t> match_start_positions;
+        std::vector<std::size_t> verse_word_indices;
+        std::vector<BibleVersePhraseMatch::CharacterRange> verse_word_character_ranges;
+        std::vector<BibleVersePhraseMatch> phrase_matches;
+        while (!rarest_word_postings.AtEnd())
+        {
+            // CHECK IF ALL WORDS IN THE PHRASE ARE IN THE CURRENT VERSE.
+            // The postings of each word within the verse are found by moving past them,
+            // which also moves the rarest word's postings to the next verse.
+            VerseIndex current_verse_index = rarest_word_postings.CurrentVerseIndex();
+            bool all_phrase_words_in_verse = true;
+            for (std::size_t word_position_in_phrase = 0; word_position_in_phrase < phrase_word_count; ++word_position_in_phrase)
+            {
+                PostingCursor& postings = postings_by_word_position[word_position_in_phrase];
+                postings.SkipToVerse(current_verse_index);
+                std::size_t verse_first_posting_index = postings.CurrentPostingIndex();
+                while (!postings.AtEnd() && (postings.CurrentVerseIndex() == current_verse_index))
+                {
+                    postings.MoveToNextPosting();
+                }
+                std::size_t verse_end_posting_index = postings.CurrentPostingIndex();
+                verse_first_posting_indices_by_word_position[word_position_in_phrase] = verse_first_posting_index;
+                verse_end_posting_indices_by_word_position[word_position_in_phrase] = verse_end_posting_index;
+
+                bool word_in_verse = (verse_first_posting_index < verse_end_posting_index);
+                if (!word_in_verse)
+                {
+                    all_phrase_words_in_verse = false;
+                    break;
+                }
+            }
+            if (!all_phrase_words_in_verse)
+            {
+                rarest_word_postings.SkipToVerse(current_verse_index + 1);
+                continue;
+            }
+
+            // FIND WHERE THE PHRASE STARTS IN THE VERSE.
+            BibleVerse current_verse = Bible->GetVerse(current_verse_index);
+            match_start_positions.clear();
+            if (HasTokenPositions())
+            {
+                // CHECK IF THE OTHER WORDS ARE AT THE RIGHT POSITIONS AROUND EACH OCCURRENCE OF THE RAREST WORD.
+                std::size_t rarest_word_verse_first_posting_index = verse_first_posting_indices_by_word_position[rarest_word_position_in_phrase];
+                std::size_t rarest_word_verse_end_posting_index = verse_end_posting_indices_by_word_position[rarest_word_position_in_phrase];
+                for (std::size_t posting_index = rarest_word_verse_first_posting_index; posting_index < rarest_word_verse_end_posting_index; ++posting_index)
+                {
+                    // MAKE SURE THE PHRASE COULD START BEFORE THE RAREST WORD.
+                    std::size_t rarest_word_position_in_verse = rarest_word_token_positions[posting_index];
+                    bool phrase_fits_before_rarest_word = (rarest_word_position_in_verse >= rarest_word_position_in_phrase);
+                    if (!phrase_fits_before_rarest_word)
+                    {
+                        continue;
+                    }
+                    std::size_t phrase_start_position_in_verse = rarest_word_position_in_verse - rarest_word_position_in_phrase;
+
+                    // CHECK IF EACH WORD IS AT ITS EXPECTED POSITION.
+                    bool word_sequence_matches = true;
+                    for (std::size_t word_position_in_phrase = 0; word_position_in_phrase < phrase_word_count; ++word_position_in_phrase)
+                    {
+                        std::span<const TokenPosition> token_positions = GetTokenPositions(phrase_word_indices[word_position_in_phrase]);
+                        std::size_t verse_first_posting_index = verse_first_posting_indices_by_word_position[word_position_in_phrase];
+                        std::size_t verse_end_posting_index = verse_end_posting_indices_by_word_position[word_position_in_phrase];
+                        std::size_t expected_position_in_verse = phrase_start_position_in_verse + word_position_in_phrase;
+                        bool word_at_expected_position = std::binary_search(
+                            token_positions.begin() + verse_first_posting_index,
+                            token_positions.begin() + verse_end_posting_index,
+                            expected_position_in_verse);
+                        if (!word_at_expected_position)
+                        {
+                            word_sequence_matches = false;
+                            break;
+                        }
+                    }
+
+                    if (word_sequence_matches)
+                    {
+                        match_start_positions.push_back(phrase_start_position_in_verse);
+                    }
+                }
+            }
+            else
+            {
+                // GET THE LEXICON INDICES FOR ALL WORDS IN THE VERSE.
+                // Every word indexed for a verse is in the lexicon.
+                verse_word_indices.clear();
+                ForEachWord(
+                    current_verse.Text,
+                    false,
+                    [&](const std::size_t, const std::string_view verse_word)
+                    {
+                        std::string_view normalized_word = NormalizeWord(verse_word, word_normalization_buffer);
+                        std::optional<std::size_t> word_index = FindWord(normalized_word);
+                        verse_word_indices.push_back(word_index.value_or(WordCount()));
+                    });
+
+                // CHECK FOR THE PHRASE STARTING AT EACH WORD.
+                for (std::size_t phrase_start_position_in_verse = 0; phrase_start_position_in_verse + phrase_word_count <= verse_word_indices.size(); ++phrase_start_position_in_verse)
+                {
+                    bool phrase_starts_here = std::equal(
+                        phrase_word_indices.cbegin(),
+                        phrase_word_indices.cend(),
+                        verse_word_indices.cbegin() + phrase_start_position_in_verse);
+                    if (phrase_starts_here)
+                    {
+                        match_start_positions.push_back(phrase_start_position_in_verse);
+                    }
+                }
+            }
+
+            // RECORD WHERE THE PHRASE OCCURS IN THE VERSE.
+            bool phrase_in_verse = !match_start_positions.empty();
+            if (phrase_in_verse)
+            {
+                // DETERMINE WHERE EACH WORD IN THE VERSE IS.
+                verse_word_character_ranges.clear();
+                ForEachWord(
+                    current_verse.Text,
+                    false,
+                    [&](const std::size_t word_start_character_index, const std::string_view verse_word)
+                    {
+                        BibleVersePhraseMatch::CharacterRange word_character_range =
+                        {
+                            .FirstCharacterOffsetIntoVerseText = word_start_character_index,
+                            .LastCharacterOffsetIntoVerseText = word_start_character_index + verse_word.length(),
+                        };
+                        verse_word_character_ranges.push_back(word_character_range);
+                    });
+
+                // SPAN FROM THE FIRST TO THE LAST WORD OF EACH OCCURRENCE OF THE PHRASE.
+                BibleVersePhraseMatch phrase_match = { .Verse = current_verse };
+                for (const std::size_t phrase_start_position_in_verse : match_start_positions)
+                {
+                    std::size_t phrase_end_position_in_verse = phrase_start_position_in_verse + phrase_word_count - 1;
+                    BibleVersePhraseMatch::CharacterRange phrase_character_range =
+                    {
+                        .FirstCharacterOffsetIntoVerseText = verse_word_character_ranges[phrase_start_position_in_verse].FirstCharacterOffsetIntoVerseText,
+                        .LastCharacterOffsetIntoVerseText = verse_word_character_ranges[phrase_end_position_in_verse].LastCharacterOffsetIntoVerseText,
+                    };
+                    phrase_match.MatchCharacterRanges.push_back(phrase_character_range);
+                }
+                phrase_matches.push_back(std::move(phrase_match));
+            }
+        }
+
+        return phrase_matches;
+    }
+
+    /// Gets the verse indices for all occurrences of words matching a word.
+    /// @param[in]  word - The word for which to get matching verses.
+    /// @param[in]  match_type - How to match the word against words in the index.
+    /// @return The verse indices for every occurrence of a matching word, in canonical verse order.
+    std::vector<BibleWordIndex::VerseIndex> BibleWordIndex::GetMatchingVerseIndices(const std::string_view word, const WordMatchType match_type) const
+    {
+        // FIND THE WORD AS IT'S INDEXED.
+        WordNormalizationBuffer word_normalization_buffer;
+        std::string_view normalized_word = NormalizeWord(word, word_normalization_buffer);
+        std::optional<std::size_t> word_index = FindWord(normalized_word);
+
+        // GET THE VERSE INDICES.
+        std::vector<VerseIndex> verse_indices;
+        AppendMatchingVerseIndices(word, normalized_word, word_index, match_type, verse_indices);
+        return verse_indices;
+    }
+
+    /// Appends the verse indices for all occurrences of words matching a word that has already been looked up.
+    /// @param[in]  word - The original word for which to get matching verses.
+    /// @param[in]  normalized_word - The word as normalized for the index (see NormalizeWord()).
+    /// @param[in]  word_index - The index of the normalized word in the lexicon, if it exists.
+    /// @param[in]  match_type - How to match the word against words in the index.
+    /// @param[in,out]  verse_indices - The verse indices to append to.  Appended indices are in canonical verse order.
+    void BibleWordIndex::AppendMatchingVerseIndices(
+        const std::string_view word,
+        const std::string_view normalized_word,
+        const std::optional<std::size_t> word_index,
+        const WordMatchType match_type,
+        std::vector<VerseIndex>& verse_indices) const
+    {
+        // GET THE VERSE INDICES BASED ON THE TYPE OF MATCHING.
+        switch (match_type)
+        {
+            case WordMatchType::EXACT:
+            {
+                // MAKE SURE THE WORD EXISTS.
+                if (!word_index)
+                {
+                    break;
+                }
+
+                // KEEP ONLY OCCURRENCES OF THE EXACT WORD.
+                // Exact words are indexed under their root words, so each verse with the root word
+                // is checked for occurrences of the exact word.
+                PostingCursor root_word_postings = GetPostingCursor(*word_index);
+                while (!root_word_postings.AtEnd())
+                {
+                    // Verses with multiple occurrences of the root word only need to be checked once.
+                    VerseIndex verse_index = root_word_postings.CurrentVerseIndex();
+                    root_word_postings.SkipToVerse(verse_index + 1);
+
+                    BibleVerse verse = Bible->GetVerse(verse_index);
+                    std::size_t exact_word_occurrence_count = CountExactWordOccurrences(verse.Text, word);
+                    verse_indices.insert(verse_indices.end(), exact_word_occurrence_count, verse_index);
+                }
+                break;
+            }
+            case WordMatchType::STEM:
+            {
+                // USE ROOT WORD MATCHING IF NO STEM INDEX EXISTS.
+                // This only happens for an index without any data.
+                const StemIndex* stems = GetStemIndex();
+                if (!stems)
+                {
+                    AppendMatchingVerseIndices(word, normalized_word, word_index, WordMatchType::ROOT_WORD, verse_indices);
+                    break;
+                }
+
+                // FIND THE STEM.
+                // Lexicon words are root words, so the root word is stemmed the same way.
+                std::string word_stem = StemWord(normalized_word);
+                std::optional<std::size_t> stem_index = FindStem(word_stem);
+                if (!stem_index)
+                {
+                    break;
+                }
+
+                // COMBINE THE VERSE INDICES FOR ALL WORDS WITH THE STEM.
+                // They're sorted to keep verses in canonical order like for a single word.
+                std::size_t first_stem_verse_index_offset = verse_indices.size();
+                std::uint32_t first_stem_word_offset = stems->StemWordOffsets[*stem_index];
+                std::uint32_t end_stem_word_offset = stems->StemWordOffsets[*stem_index + 1];
+                std::vector<VerseIndex> decoded_verse_indices;
+                for (std::uint32_t stem_word_offset = first_stem_word_offset; stem_word_offset < end_stem_word_offset; ++stem_word_offset)
+                {
+                    std::span<const VerseIndex> stem_word_verse_indices = GetVerseIndices(stems->StemWordIndices[stem_word_offset], decoded_verse_indices);
+                    verse_indices.insert(verse_indices.end(), stem_word_verse_indices.begin(), stem_word_verse_indices.end());
+                }
+                std::sort(verse_indices.begin() + first_stem_verse_index_offset, verse_indices.end());
+                break;
+            }
+            case WordMatchType::ROOT_WORD:
+            default:
+            {
+                if (word_index)
+                {
+                    std::vector<VerseIndex> decoded_verse_indices;
+                    std::span<const VerseIndex> root_word_verse_indices = GetVerseIndices(*word_index, decoded_verse_indices);
+                    verse_indices.insert(verse_indices.end(), root_word_verse_indices.begin(), root_word_verse_indices.end());
+                }
+                break;
+            }
+        }
+    }
+
+    /// Counts the occurrences of an exact word (ignoring case) in a verse.
+    /// @param[in]  verse_text - The text of the verse.
+    /// @param[in]  word - The word to count.
+    /// @return The number of occurrences of the word in the verse.
+    std::size_t BibleWordIndex::CountExactWordOccurrences(const std::string_view verse_text, const std::string_view word)
+    {
+        std::size_t occurrence_count = 0;
+        ForEachWord(
+            verse_text,
+            false,
+            [&](const std::size_t, const std::string_view current_word)
+            {
+                bool is_same_word = std::ranges::equal(word, current_word, [](const char left_character, const char right_character)
+                {
+                    return std::tolower(static_cast<int>(left_character)) == std::tolower(static_cast<int>(right_character));
+                });
+                if (is_same_word)
+                {
+                    ++occurrence_count;
+                }
+            });
+        return occurrence_count;
+    }
+
+    /// Gets a cursor for producing verses matching a word one at a time.
+    /// Unlike getting all matching verses at once, no storage for the matching verses is needed,
+    /// so this is suited to walking through huge numbers of matches (such as for very common words).
+    /// @param[in]  word - The word for which to get matching verses.
+    /// @param[in]  match_type - How to match the word against words in the index.
+    /// @return The cursor, which produces the same verses in the same order as GetMatchingVerses().
+    ///     It must not outlive this index.
+    BibleWordIndex::MatchingVerseCursor BibleWordIndex::GetMatchingVerseCursor(const std::string_view word, const WordMatchType match_type) const
+    {
+        // FIND THE WORD AS IT'S INDEXED.
+        WordNormalizationBuffer word_normalization_buffer;
+        std::string_view normalized_word = NormalizeWord(word, word_normalization_buffer);
+        std::optional<std::size_t> word_index = FindWord(normalized_word);
+
+        // USE ROOT WORD MATCHING IF NO STEM INDEX EXISTS.
+        // This is consistent with getting all matching verses at once.
+        MatchingVerseCursor cursor = { .WordIndex = this, .MatchType = match_type };
+        const StemIndex* stems = (WordMatchType::STEM == match_type) ? GetStemIndex() : nullptr;
+        if (WordMatchType::STEM == match_type && !stems)
+        {
+            cursor.MatchType = WordMatchType::ROOT_WORD;
+        }
+
+        // PREPARE THE POSTINGS TO WALK THROUGH BASED ON THE TYPE OF MATCHING.
+        switch (cursor.MatchType)
+        {
+            case WordMatchType::EXACT:
+            {
+                // The exact word is only needed for matching exact words.
+                cursor.ExactWord = std::string(word);
+                if (word_index)
+                {
+                    cursor.RemainingPostings = GetPostingCursor(*word_index);
+                }
+                break;
+            }
+            case WordMatchType::STEM:
+            {
+                // Postings for all words with the stem are merged as the cursor advances.
+                std::string word_stem = StemWord(normalized_word);
+                std::optional<std::size_t> stem_index = FindStem(word_stem);
+                if (!stem_index)
+                {
+                    break;
+                }
+
+                std::uint32_t first_stem_word_offset = stems->StemWordOffsets[*stem_index];
+                std::uint32_t end_stem_word_offset = stems->StemWordOffsets[*stem_index + 1];
+                cursor.RemainingStemWordPostings.reserve(end_stem_word_offset - first_stem_word_offset);
+                for (std::uint32_t stem_word_offset = first_stem_word_offset; stem_word_offset < end_stem_word_offset; ++stem_word_offset)
+                {
+                    PostingCursor stem_word_postings = GetPostingCursor(stems->StemWordIndices[stem_word_offset]);
+                    cursor.RemainingStemWordPostings.push_back(stem_word_postings);
+                }
+                break;
+            }
+            case WordMatchType::ROOT_WORD:
+            default:
+            {
+                if (word_index)
+                {
+                    cursor.RemainingPostings = GetPostingCursor(*word_index);
+                }
+                break;
+            }
+        }
+
+        return cursor;
+    }
+
+    /// Visits verses matching a word one at a time, without storing any of the matching verses.
+    /// Like other const methods, this may be called from any number of threads at once.
+    /// @param[in]  word - The word for which to visit matching verses.
+    /// @param[in]  visit_verse - The function to call for each matching verse, with one call per occurrence of a matching word
+    ///     in the same order as GetMatchingVerses().  Called on the calling thread.  Returning false stops visiting any more verses.
+    /// @param[in]  match_type - How to match the word against words in the index.
+    /// @return True if all matching verses were visited; false if visiting was stopped early.
+    bool BibleWordIndex::ForEachMatchingVerse(
+        const std::string_view word,
+        const BibleVerseVisitor& visit_verse,
+        const WordMatchType match_type) const
+    {
+        MatchingVerseCursor cursor = GetMatchingVerseCursor(word, match_type);
+        for (std::optional<BibleVerse> verse = cursor.Next(); verse; verse = cursor.Next())
+        {
+            bool continue_visiting = visit_verse(*verse);
+            if (!continue_visiting)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Gets the next matching verse, advancing the cursor.
+    /// @return The next matching verse; null if no matching verses remain.
+    std::optional<BibleVerse> BibleWordIndex::MatchingVerseCursor::Next()
+    {
+        // PRODUCE ANY REMAINING OCCURRENCES OF AN EXACT WORD IN THE CURRENT VERSE.
+        if (RemainingExactWordOccurrenceCount > 0)
+        {
+            --RemainingExactWordOccurrenceCount;
+            return WordIndex->Bible->GetVerse(ExactWordVerseIndex);
+        }
+
+        // ADVANCE TO THE NEXT MATCHING VERSE BASED ON THE TYPE OF MATCHING.
+        switch (MatchType)
+        {
+            case WordMatchType::EXACT:
+            {
+                // FIND THE NEXT VERSE WITH THE EXACT WORD.
+                // Exact words are indexed under their root words, so verses with the root word are checked
+                // until one has the exact word.
+                while (!RemainingPostings.AtEnd())
+                {
+                    // Verses with multiple occurrences of the root word only need to be checked once.
+                    VerseIndex verse_index = RemainingPostings.CurrentVerseIndex();
+                    RemainingPostings.SkipToVerse(verse_index + 1);
+
+                    BibleVerse verse = WordIndex->Bible->GetVerse(verse_index);
+                    std::size_t exact_word_occurrence_count = CountExactWordOccurrences(verse.Text, ExactWord);
+                    if (exact_word_occurrence_count > 0)
+                    {
+                        // The verse is produced once per occurrence, like for other types of matching.
+                        ExactWordVerseIndex = verse_index;
+                        RemainingExactWordOccurrenceCount = exact_word_occurrence_count - 1;
+                        return verse;
+                    }
+                }
+                return std::nullopt;
+            }
+            case WordMatchType::STEM:
+            {
+                // FIND THE WORD WHOSE NEXT POSTING IS EARLIEST.
+                // Stems have few words, so a linear scan is fast and keeps verses in canonical order without sorting.
+                PostingCursor* earliest_postings = nullptr;
+                for (PostingCursor& stem_word_postings : RemainingStemWordPostings)
+                {
+                    if (stem_word_postings.AtEnd())
+                    {
+                        continue;
+                    }
+
+                    bool is_earliest = (!earliest_postings || stem_word_postings.CurrentVerseIndex() < earliest_postings->CurrentVerseIndex());
+                    if (is_earliest)
+                    {
+                        earliest_postings = &stem_word_postings;
+                    }
+                }
+                if (!earliest_postings)
+                {
+                    return std::nullopt;
+                }
+
+                // PRODUCE THE VERSE FOR THE POSTING.
+                VerseIndex verse_index = earliest_postings->CurrentVerseIndex();
+                earliest_postings->MoveToNextPosting();
+                return WordIndex->Bible->GetVerse(verse_index);
+            }
+            case WordMatchType::ROOT_WORD:
+            default:
+            {
+                // PRODUCE THE VERSE FOR THE NEXT POSTING.
+                if (RemainingPostings.AtEnd())
+                {
+                    return std::nullopt;
+                }
+                VerseIndex verse_index = RemainingPostings.CurrentVerseIndex();
+                RemainingPostings.MoveToNextPosting();
+                return WordIndex->Bible->GetVerse(verse_index);
+            }
+        }
+    }
+
+    /// Finds the distinct words of a query in the lexicon.
+    /// @param[in]  query_text - The query text.  Words are normalized the same way as for indexing.
+    /// @return The indices in the lexicon of query words that exist in the lexicon, in increasing order.
+    std::vector<std::size_t> BibleWordIndex::FindQueryWords(const std::string_view query_text) const
+    {
+        std::vector<std::size_t> query_word_indices;
+        WordNormalizationBuffer word_normalization_buffer;
+        ForEachWord(
+            query_text,
+            true,
+            [&](const std::size_t, const std::string_view query_word)
+            {
+                std::string_view normalized_word = NormalizeWord(query_word, word_normalization_buffer);
+                std::optional<std::size_t> word_index = FindWord(normalized_word);
+                if (word_index)
+                {
+                    query_word_indices.push_back(*word_index);
+                }
+            });
+
+        // Repeated query words only count once.
+        std::sort(query_word_indices.begin(), query_word_indices.end());
+        query_word_indices.erase(std::unique(query_word_indices.begin(), query_word_indices.end()), query_word_indices.end());
+        return query_word_indices;
+    }
+
+    /// Computes how much a single word contributes to a verse's BM25 relevance score.
+    /// @param[in]  word_index - The index of the word in the lexicon.
+    /// @param[in]  occurrence_count_in_verse - The number of occurrences of the word in the verse.
+    /// @param[in]  verse_index - The index of the verse.
+    /// @return The word's contribution to the verse's relevance score.
+    double BibleWordIndex::ComputeRelevanceScore(
+        const std::size_t word_index,
+        const std::size_t occurrence_count_in_verse,
+        const std::size_t verse_index) const
+    {
+        // These are the most commonly used values for BM25's k1 and b parameters.
+        constexpr double OCCURRENCE_COUNT_SATURATION = 1.2;
+        constexpr double VERSE_LENGTH_NORMALIZATION = 0.75;
+
+        // COMPUTE HOW RARE THE WORD IS.
+        // Rarer words say more about whether a verse is relevant.
+        double verse_count = static_cast<double>(VerseWordCounts.size());
+        double word_verse_count = static_cast<double>(WordVerseCounts[word_index]);
+        double inverse_document_frequency = std::log(1.0 + (verse_count - word_verse_count + 0.5) / (word_verse_count + 0.5));
+
+        // COMPUTE HOW SIGNIFICANT THE WORD'S OCCURRENCES ARE WITHIN THE VERSE.
+        // Additional occurrences have diminishing returns, and occurrences in shorter verses are more significant.
+        // Every word occurrence has one posting, so the total number of postings is the total number of words.
+        double average_verse_word_count = static_cast<double>(PostingOffsets.back()) / verse_count;
+        double relative_verse_length = static_cast<double>(VerseWordCounts[verse_index]) / average_verse_word_count;
+        double occurrence_count = static_cast<double>(occurrence_count_in_verse);
+        double occurrence_score = (occurrence_count * (OCCURRENCE_COUNT_SATURATION + 1.0)) / (
+            occurrence_count + OCCURRENCE_COUNT_SATURATION * (1.0 - VERSE_LENGTH_NORMALIZATION + VERSE_LENGTH_NORMALIZATION * relative_verse_length));
+
+        double relevance_score = inverse_document_frequency * occurrence_score;
+        return relevance_score;
+    }
+
+    /// Finds the first posting (at or after a starting posting) for a verse at or after the specified verse.
+    /// This "gallops" by checking postings at exponentially increasing distances before binary searching,
+    /// so skipping a few postings is cheap while skipping many postings remains logarithmic.
+    /// @param[in]  verse_indices - The verse indices of a posting list (in increasing order).
+    /// @param[in]  start_posting_index - The index of the posting to start searching from.
+    /// @param[in]  verse_index - The verse index to search for.  May be past the last valid verse index.
+    /// @return The index of the first posting at or after the start whose verse index is at least the specified verse index;
+    ///     the size of the posting list if no such posting exists.
+    std::size_t BibleWordIndex::GallopToVerse(
+        const std::span<const VerseIndex> verse_indices,
+        const std::size_t start_posting_index,
+        const std::size_t verse_index)
+    {
+        // GALLOP AHEAD UNTIL REACHING A POSTING AT OR PAST THE VERSE.
+        std::size_t posting_count = verse_indices.size();
+        std::size_t search_start_posting_index = start_posting_index;
+        std::size_t search_end_posting_index = start_posting_index;
+        std::size_t step_size = 1;
+        while ((search_end_posting_index < posting_count) && (verse_indices[search_end_posting_index] < verse_index))
+        {
+            search_start_posting_index = search_end_posting_index + 1;
+            search_end_posting_index += step_size;
+            step_size *= 2;
+        }
+        search_end_posting_index = std::min(search_end_posting_index, posting_count);
+
+        // BINARY SEARCH WITHIN THE LAST STEP.
+        auto first_posting_at_or_after_verse = std::lower_bound(
+            verse_indices.begin() + search_start_posting_index,
+            verse_indices.begin() + search_end_posting_index,
+            verse_index);
+        std::size_t posting_index = static_cast<std::size_t>(first_posting_at_or_after_verse - verse_indices.begin());
+        return posting_index;
+    }
+
+    /// Creates a cursor for walking through uncompressed verse indices, such as already evaluated search results.
+    /// @param[in]  verse_indices - The verse indices to walk through, in increasing order.  Must outlive the cursor.
+    /// @return A cursor at the first verse index (or at the end if there are none).
+    BibleWordIndex::PostingCursor BibleWordIndex::PostingCursor::FromVerseIndices(const std::span<const VerseIndex> verse_indices)
+    {
+        // All verse indices are treated as a single block.
+        PostingCursor cursor;
+        cursor.VerseIndices = verse_indices;
+        cursor.TotalPostingCount = verse_indices.size();
+        cursor.BlockPostingCount = verse_indices.size();
+        return cursor;
+    }
+
+    /// Checks if the cursor has moved past all postings.
+    /// @return True if no postings remain; false otherwise.
+    bool BibleWordIndex::PostingCursor::AtEnd() const
+    {
+        // Cursors are only left at the end of a block once no blocks remain.
+        bool at_end = (PostingIndexInBlock >= BlockPostingCount);
+        return at_end;
+    }
+
+    /// Gets the total number of postings being walked through, including any already passed.
+    /// @return The total number of postings.
+    std::size_t BibleWordIndex::PostingCursor::PostingCount() const
+    {
+        return TotalPostingCount;
+    }
+
+    /// Gets the index of the current posting among all postings being walked through,
+    /// such as for finding the corresponding token position (see GetTokenPositions()).
+    /// @return The index of the current posting; PostingCount() if at the end.
+    std::size_t BibleWordIndex::PostingCursor::CurrentPostingIndex() const
+    {
+        std::size_t posting_index = BlockFirstPostingIndex + PostingIndexInBlock;
+        return posting_index;
+    }
+
+    /// Gets the verse index of the current posting.
+    /// @return The current verse index.  Must not be called if AtEnd().
+    BibleWordIndex::VerseIndex BibleWordIndex::PostingCursor::CurrentVerseIndex() const
+    {
+        if (CompressedPostings.Empty())
+        {
+            return VerseIndices[PostingIndexInBlock];
+        }
+
+        return DecodedVerseIndices[PostingIndexInBlock];
+    }
+
+    /// Moves to the next posting, decoding the next block if needed.
+    /// Must not be called if AtEnd().
+    void BibleWordIndex::PostingCursor::MoveToNextPosting()
+    {
+        // MOVE WITHIN THE CURRENT BLOCK.
+        ++PostingIndexInBlock;
+
+        // MOVE TO ANY NEXT BLOCK.
+        bool block_finished = (PostingIndexInBlock >= BlockPostingCount);
+        bool next_block_exists = (BlockIndex + 1 < EndBlockIndex);
+        if (block_finished && next_block_exists)
+        {
+            ++BlockIndex;
+            BlockFirstPostingIndex += BlockPostingCount;
+            DecodeCurrentBlock();
+        }
+    }
+
+    /// Skips to the first remaining posting at or after a verse.
+    /// Compressed blocks that end before the verse are skipped without being decoded.
+    /// @param[in]  verse_index - The verse to skip to.  May be past the last valid verse index.
+    void BibleWordIndex::PostingCursor::SkipToVerse(const std::size_t verse_index)
+    {
+        // CHECK IF ANY POSTINGS REMAIN.
+        if (AtEnd())
+        {
+            return;
+        }
+
+        // SKIP TO THE BLOCK CONTAINING THE VERSE IF IT'S IN A LATER BLOCK.
+        bool compressed = !CompressedPostings.Empty();
+        bool verse_in_later_block = compressed && (CompressedPostings.Blocks[BlockIndex].LastVerseIndex < verse_index);
+        if (verse_in_later_block)
+        {
+            // FIND THE FIRST BLOCK ENDING AT OR AFTER THE VERSE.
+            std::span<const CompressedPostingLists::Block> blocks = CompressedPostings.Blocks;
+            auto block = std::partition_point(
+                blocks.begin() + BlockIndex + 1,
+                blocks.begin() + EndBlockIndex,
+                [verse_index](const CompressedPostingLists::Block& current_block) { return current_block.LastVerseIndex < verse_index; });
+            std::size_t next_block_index = static_cast<std::size_t>(block - blocks.begin());
+
+            // MOVE TO THE END IF NO BLOCK CONTAINS THE VERSE.
+            bool verse_after_all_blocks = (next_block_index >= EndBlockIndex);
+            if (verse_after_all_blocks)
+            {
+                BlockIndex = EndBlockIndex;
+                BlockFirstPostingIndex = TotalPostingCount;
+                BlockPostingCount = 0;
+                PostingIndexInBlock = 0;
+                return;
+            }
+
+            // DECODE THE BLOCK.
+            // All skipped blocks are full since only a word's last block can be partial.
+            BlockFirstPostingIndex += BlockPostingCount + ((next_block_index - BlockIndex - 1) * CompressedPostingLists::POSTINGS_PER_BLOCK);
+            BlockIndex = next_block_index;
+            DecodeCurrentBlock();
+        }
+
+        // FIND THE POSTING WITHIN THE BLOCK.
+        const VerseIndex* block_verse_indices = compressed ? DecodedVerseIndices.data() : VerseIndices.data();
+        PostingIndexInBlock = GallopToVerse(std::span<const VerseIndex>(block_verse_indices, BlockPostingCount), PostingIndexInBlock, verse_index);
+    }
+
+    /// Decodes the compressed block at the current block index and moves to its first posting.
+    void BibleWordIndex::PostingCursor::DecodeCurrentBlock()
+    {
+        PostingIndexInBlock = 0;
+        bool block_exists = (BlockIndex < EndBlockIndex);
+        if (!block_exists)
+        {
+            BlockPostingCount = 0;
+            return;
+        }
+
+        BlockPostingCount = CompressedPostings.Blocks[BlockIndex].PostingCount;
+        CompressedPostings.DecodeBlock(BlockIndex, DecodedVerseIndices.data());
     }
 }
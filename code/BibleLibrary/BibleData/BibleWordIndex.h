@@ -1,39 +1,466 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
+#include "BibleData/BibleAuthor.h"
+#include "BibleData/BibleBook.h"
+#include "BibleData/BibleBookGenre.h"
 #include "BibleData/BibleVerse.h"
-#include "BibleData/BibleVerseIdWithCharacterRange.h"
+#include "BibleData/BibleVersePhraseMatch.h"
+#include "BibleData/BibleVerseRange.h"
+#include "BibleData/BibleVersesView.h"
+#include "BibleData/BibleTestament.h"
 #include "BibleData/CategorizedBibleVerseSearchResults.h"
+#include "BibleData/CategorizedBibleVersesView.h"
+#include "BibleData/CompressedPostingLists.h"
+#include "BibleData/MemoryUsageReport.h"
+#include "BibleData/PerfectHashStringMap.h"
 
 namespace BIBLE_DATA
 {
     /// @todo   Get rid of forward declaration?
     class BibleTranslation;
+    class BibleVerseBitmap;
+
+    /// A hash for strings that supports heterogeneous lookup (with std::string_view keys)
+    /// in std::string-keyed unordered containers, which avoids allocating temporary strings.
+    struct TransparentStringHash
+    {
+        /// Allows heterogeneous lookup.
+        using is_transparent = void;
+
+        /// Hashes the string.
+        /// @param[in]  string - The string to hash.
+        /// @return The hash of the string.
+        std::size_t operator()(const std::string_view string) const
+        {
+            return std::hash<std::string_view>{}(string);
+        }
+    };
 
     /// An index of words in a Bible translation for easier looking up of verses by word.
     /// Indexing is done based on lowercasing each word.
+    ///
+    /// The index is stored in a compact, flat form rather than as a map of strings to verses:
+    /// - A lexicon of all unique words in sorted order, with all word characters stored in a single pool.
+    /// - Posting lists for each word, which are indices of verses in BibleTranslation::VerseCharacterRanges.
+    ///     One index exists per occurrence of the word, in the order the occurrences appear in the translation.
+    ///
+    /// Optionally, token positions (which word within a verse each occurrence is) may be stored
+    /// in parallel with the posting lists to allow quickly searching for exact phrases.
+    ///
+    /// Posting lists may also be stored compressed (see CompressedPostings) to use less memory.
+    /// Searches walk through postings with cursors (see PostingCursor) that work the same for either form,
+    /// so compressed postings are only decoded as needed, and intersections skip blocks without decoding them.
+    /// However, results that view postings directly (such as GetMatchingVersesView()) are only possible
+    /// for uncompressed postings, so compressed storage can be decoded once when searching interactively
+    /// (see WithUncompressedPostings()).
+    ///
+    /// Statistics for ranking verses by relevance (the number of words in each verse and the number
+    /// of verses containing each word) are also stored so that they don't need to be computed for each search.
+    ///
+    /// The index only views this data, so it can either wrap arrays precomputed into generated code files
+    /// (with no runtime construction) or data built at runtime for translations without generated files.
+    ///
+    /// Once an index is created, all const methods may be called concurrently from any number of threads
+    /// since they only read the index data (the stem index, which is built on first use, is built only once
+    /// even if first used by multiple threads at once).  Creating or modifying an index (such as via assignment)
+    /// must not overlap with any other use of it.
     class BibleWordIndex
     {
     public:
+        /// An index of a verse within BibleTranslation::VerseCharacterRanges.
+        /// The same type is used for views of verses so that postings can be viewed directly.
+        using VerseIndex = BibleVersesView::VerseIndex;
+        /// The position of a word within a verse (0 for the first word, 1 for the second, etc.).
+        /// Verses have far fewer than 65,536 words.
+        using TokenPosition = std::uint16_t;
+
         /// Root words mapped by original word.
         /// Used for more useful lookups of related verses for similar words.
-        /// The data here has been hardcoded based on observation.
-        static std::unordered_map<std::string, std::string> RootWordsByOriginalWord;
+        /// The data here has been hardcoded based on observation (see BibleDataGenerator/RootWordEntries.h).
+        /// The map's perfect hash is generated offline into code files (see BibleDataCodeFiles::GenerateRootWordMap()),
+        /// so it requires no initialization or allocations at runtime.
+        static const PerfectHashStringMap RootWordsByOriginalWord;
+
+        /// Storage for index data built at runtime.
+        /// It is shared so that copies of an index remain valid without copying the data.
+        struct BuiltData
+        {
+            /// See BibleWordIndex::LexiconCharacters.
+            std::string LexiconCharacters = "";
+            /// See BibleWordIndex::LexiconWordOffsets.
+            std::vector<std::uint32_t> LexiconWordOffsets = {};
+            /// See BibleWordIndex::PostingVerseIndices.
+            std::vector<VerseIndex> PostingVerseIndices = {};
+            /// See BibleWordIndex::PostingOffsets.
+            std::vector<std::uint32_t> PostingOffsets = {};
+            /// See BibleWordIndex::PostingTokenPositions.
+            std::vector<TokenPosition> PostingTokenPositions = {};
+            /// See BibleWordIndex::VerseWordCounts.
+            std::vector<std::uint16_t> VerseWordCounts = {};
+            /// See BibleWordIndex::WordVerseCounts.
+            std::vector<std::uint16_t> WordVerseCounts = {};
+            /// See BibleWordIndex::CompressedPostings.
+            CompressedPostingLists::BuiltData CompressedPostings = {};
+        };
+
+        /// A position within a single word's postings, for walking or skipping through them in verse order.
+        /// Compressed postings are decoded a block at a time, and skipping passes over entire blocks without decoding them.
+        /// A cursor must only be used by one thread at a time and must not outlive the postings it walks through.
+        class PostingCursor
+        {
+        public:
+            static PostingCursor FromVerseIndices(const std::span<const VerseIndex> verse_indices);
+
+            bool AtEnd() const;
+            std::size_t PostingCount() const;
+            std::size_t CurrentPostingIndex() const;
+            VerseIndex CurrentVerseIndex() const;
+            void MoveToNextPosting();
+            void SkipToVerse(const std::size_t verse_index);
+
+            /// The compressed postings being walked through; empty if walking through uncompressed VerseIndices.
+            CompressedPostingLists CompressedPostings = {};
+            /// The uncompressed verse indices being walked through, which are treated as a single block.
+            std::span<const VerseIndex> VerseIndices = {};
+            /// The total number of postings being walked through.
+            std::size_t TotalPostingCount = 0;
+            /// The index in CompressedPostingLists::Blocks of the current block, if compressed.
+            std::size_t BlockIndex = 0;
+            /// The index in CompressedPostingLists::Blocks just past the last block, if compressed.
+            std::size_t EndBlockIndex = 0;
+            /// The index (among all postings being walked through) of the first posting in the current block.
+            std::size_t BlockFirstPostingIndex = 0;
+            /// The number of postings in the current block.
+            std::size_t BlockPostingCount = 0;
+            /// The index of the current posting within the current block.
+            std::size_t PostingIndexInBlock = 0;
+            /// The verse indices of the current block, if compressed.
+            std::array<VerseIndex, CompressedPostingLists::DECODED_BLOCK_CAPACITY> DecodedVerseIndices = {};
+
+        private:
+            friend class BibleWordIndex;
+
+            void DecodeCurrentBlock();
+        };
+
+        /// How a searched word is matched against words in the index.
+        enum class WordMatchType
+        {
+            /// Only occurrences of the same word (ignoring case) match.
+            EXACT,
+            /// Occurrences of any word with the same root word (see RootWordsByOriginalWord) match.
+            /// This is how words are indexed, so it's the fastest.
+            ROOT_WORD,
+            /// Occurrences of any word with the same Porter stem (such as "believ" for "believe" and "believing") match.
+            /// The stem index is built on first use (see GetStemIndex()).
+            STEM,
+        };
+
+        /// A secondary index of lexicon words grouped by their Porter stems.
+        /// Stems map to lexicon words rather than having separate postings, which keeps the index small,
+        /// and verses for a stem are found by merging the postings of its words.
+        struct StemIndex
+        {
+            /// The characters for all distinct stems, concatenated in sorted order.
+            std::string StemCharacters = "";
+            /// Offsets into StemCharacters for the first character of each stem.
+            /// An extra final offset marks the end of the last stem, so stem N spans [N, N + 1).
+            std::vector<std::uint32_t> StemOffsets = {};
+            /// The index of the stem of each word, in the same order as the lexicon.
+            std::vector<std::uint32_t> LexiconStemIndices = {};
+            /// Offsets into StemWordIndices for the first word of each stem.
+            /// An extra final offset marks the end of the last stem's words, so stem N spans [N, N + 1).
+            std::vector<std::uint32_t> StemWordOffsets = {};
+            /// The lexicon indices of all words with each stem, concatenated in the same order as the stems.
+            std::vector<std::uint32_t> StemWordIndices = {};
+        };
+
+        /// Storage for the verses matching a batch of words (see GetMatchingVersesBatch()).
+        /// Verses for all words are stored in a single array, and storage can be reused across batches
+        /// so that memory only needs to be allocated when a batch is larger than previous batches.
+        struct MatchingVersesBatch
+        {
+            std::span<const BibleVerse> GetVerses(const std::size_t word_index) const;
+
+            /// The verses matching all words, concatenated in the same order as the words.
+            std::vector<BibleVerse> Verses = {};
+            /// Offsets into Verses for the first verse of each word.
+            /// An extra final offset marks the end of the last word's verses, so word N spans [N, N + 1).
+            std::vector<std::size_t> VerseOffsets = {};
+        };
+
+        /// Produces the verses matching a word one at a time (see GetMatchingVerseCursor()).
+        /// Matching verses are found from the index's postings as the cursor advances, so the memory used
+        /// doesn't depend on the number of matching verses (only stem matching keeps a position for each word with the stem).
+        /// A cursor must only be used by one thread at a time, but any number of cursors may be used concurrently.
+        class MatchingVerseCursor
+        {
+        public:
+            std::optional<BibleVerse> Next();
+
+            /// The index containing the verses.
+            const BibleWordIndex* WordIndex = nullptr;
+            /// How the word is matched against words in the index.
+            WordMatchType MatchType = WordMatchType::ROOT_WORD;
+            /// The searched word if matching exact words; empty otherwise.
+            std::string ExactWord = "";
+            /// The remaining postings of the word for root word or exact matching.
+            PostingCursor RemainingPostings = {};
+            /// The remaining postings of each word with the stem for stem matching.
+            std::vector<PostingCursor> RemainingStemWordPostings = {};
+            /// The index of the most recent verse containing the exact word, for exact matching.
+            VerseIndex ExactWordVerseIndex = 0;
+            /// The number of times the most recent verse still needs to be produced for additional occurrences of the exact word.
+            std::size_t RemainingExactWordOccurrenceCount = 0;
+        };
 
-        static BibleWordIndex Build(const BibleTranslation* bible_translation);
-        std::vector<BibleVerse> GetMatchingVerses(const std::string_view word) const;
+        /// A buffer for holding a word while normalizing it without heap allocations.
+        struct WordNormalizationBuffer
+        {
+            /// The maximum length of a word that can be normalized without a heap allocation.
+            /// The longest words in Bibles are a bit under 20 characters.
+            static constexpr std::size_t MAX_FIXED_WORD_LENGTH_IN_CHARACTERS = 64;
+
+            /// Storage for words up to the maximum fixed length.
+            char Characters[MAX_FIXED_WORD_LENGTH_IN_CHARACTERS] = {};
+            /// Storage for any words longer than the maximum fixed length.
+            std::string LongWordCharacters = "";
+        };
+
+        /// A word from the lexicon completing a prefix, such as for autocompleting typed words.
+        struct WordCompletion
+        {
+            /// The lowercase word.
+            std::string_view Word = "";
+            /// The number of occurrences of the word in the translation.
+            std::size_t OccurrenceCount = 0;
+        };
+
+        /// A word from the lexicon similar to a searched word, such as for handling misspelled words.
+        struct SimilarWord
+        {
+            /// The index of the word in the lexicon.
+            std::size_t WordIndex = 0;
+            /// The lowercase word.
+            std::string_view Word = "";
+            /// The edit distance (number of inserted, deleted, or substituted characters) from the searched word.
+            std::size_t EditDistance = 0;
+        };
+
+        /// A verse along with a score for how relevant it is to a search.
+        struct ScoredVerse
+        {
+            /// The verse.
+            BibleVerse Verse = {};
+            /// The relevance score for the verse.  Higher scores are more relevant.
+            double RelevanceScore = 0.0;
+        };
+
+        static std::string_view NormalizeWord(const std::string_view word, WordNormalizationBuffer& word_normalization_buffer);
+        static std::string StemWord(const std::string_view word);
+        static std::size_t GallopToVerse(
+            const std::span<const VerseIndex> verse_indices,
+            const std::size_t start_posting_index,
+            const std::size_t verse_index);
+
+        static BibleWordIndex Build(
+            const BibleTranslation* bible_translation,
+            const unsigned int thread_count = 1,
+            const bool include_token_positions = false,
+            const bool compress_postings = false);
+        static BibleWordIndex FromPrecomputedData(
+            const BibleTranslation* bible_translation,
+            const std::string_view lexicon_characters,
+            const std::span<const std::uint32_t> lexicon_word_offsets,
+            const std::span<const VerseIndex> posting_verse_indices,
+            const std::span<const std::uint32_t> posting_offsets,
+            const std::span<const std::uint16_t> verse_word_counts,
+            const std::span<const std::uint16_t> word_verse_counts,
+            const std::span<const TokenPosition> posting_token_positions = {},
+            const CompressedPostingLists& compressed_postings = {});
+        BibleWordIndex WithUncompressedPostings() const;
+        StemIndex BuildStemIndex() const;
+
+        std::size_t WordCount() const;
+        MemoryUsageReport MemoryUsage() const;
+        std::string_view GetWord(const std::size_t word_index) const;
+        bool HasCompressedPostings() const;
+        const StemIndex* GetStemIndex() const;
+        std::size_t GetPostingCount(const std::size_t word_index) const;
+        std::span<const VerseIndex> GetVerseIndices(const std::size_t word_index, std::vector<VerseIndex>& decoded_verse_indices) const;
+        PostingCursor GetPostingCursor(const std::size_t word_index) const;
+        bool HasTokenPositions() const;
+        std::span<const TokenPosition> GetTokenPositions(const std::size_t word_index) const;
+        std::optional<std::size_t> FindWord(const std::string_view lowercase_word) const;
+        std::optional<std::size_t> FindStem(const std::string_view stem) const;
+        std::vector<WordCompletion> GetWordsWithPrefix(const std::string_view lowercase_prefix, const std::size_t max_word_count) const;
+        std::vector<SimilarWord> FindSimilarWords(const std::string_view word, const std::size_t max_edit_distance) const;
+
+        std::vector<BibleVerse> GetMatchingVerses(const std::string_view word, const WordMatchType match_type = WordMatchType::ROOT_WORD) const;
+        void GetMatchingVersesBatch(
+            const std::span<const std::string_view> words,
+            MatchingVersesBatch& matching_verses_batch,
+            const WordMatchType match_type = WordMatchType::ROOT_WORD,
+            const unsigned int thread_count = 1) const;
+        BibleVerseBitmap GetMatchingVerseBitmap(const std::string_view word) const;
+        std::size_t CountOccurrences(const std::size_t word_index, const std::size_t first_verse_index, const std::size_t end_verse_index) const;
+        std::size_t CountOccurrences(const std::string_view word, const BibleVerseRange& verse_range) const;
+        std::map<BibleBook::Id, std::size_t> CountOccurrencesByBook(const std::string_view word) const;
         CategorizedBibleVerseSearchResults GetMatchingVerses(
             const BibleVerseId& verse_id,
-            const std::string_view word) const;
+            const std::string_view word,
+            const std::size_t max_edit_distance = 0,
+            const WordMatchType match_type = WordMatchType::ROOT_WORD) const;
+        BibleVersesView GetMatchingVersesView(const std::string_view word, const WordMatchType match_type = WordMatchType::ROOT_WORD) const;
+        CategorizedBibleVersesView GetMatchingVersesView(
+            const BibleVerseId& verse_id,
+            const std::string_view word,
+            const std::size_t max_edit_distance = 0,
+            const WordMatchType match_type = WordMatchType::ROOT_WORD) const;
+        MatchingVerseCursor GetMatchingVerseCursor(const std::string_view word, const WordMatchType match_type = WordMatchType::ROOT_WORD) const;
+        bool ForEachMatchingVerse(
+            const std::string_view word,
+            const BibleVerseVisitor& visit_verse,
+            const WordMatchType match_type = WordMatchType::ROOT_WORD) const;
+        std::vector<BibleVersePhraseMatch> GetVersesMatchingPhrase(const std::string_view phrase) const;
+        std::vector<ScoredVerse> GetMostRelevantVerses(const std::string_view query_text, const std::size_t max_verse_count) const;
+        void SortByRelevance(const std::string_view query_text, CategorizedBibleVersesView& search_results) const;
 
         /// The Bible translation this index corresponds to.
         const BibleTranslation* Bible = nullptr;
-        /// A mapping of Bible verses by lowercase word.
-        /// @todo std::unordered_map<std::string, std::vector<BibleVerseIdWithCharacterRange>> BibleVersesByWord = {};
-        std::map<std::string, std::vector<BibleVerseIdWithCharacterRange>> BibleVersesByWord = {};
+        /// The storage for the index data if built at runtime (BuiltData) or loaded from a file (see BibleWordIndexFile);
+        /// null if the index wraps precomputed data.  It only keeps the data alive for the lifetime of the index.
+        std::shared_ptr<const void> OwnedData = nullptr;
+        /// The characters for all lowercase words in the lexicon, concatenated in sorted word order.
+        std::string_view LexiconCharacters = "";
+        /// Offsets into LexiconCharacters for the first character of each word.
+        /// An extra final offset marks the end of the last word, so word N spans [N, N + 1).
+        std::span<const std::uint32_t> LexiconWordOffsets = {};
+        /// Verse indices for all occurrences of all words, concatenated in the same order as the lexicon.
+        /// Empty if postings are compressed (see CompressedPostings).
+        std::span<const VerseIndex> PostingVerseIndices = {};
+        /// Offsets of the first posting of each word among all postings (such as into PostingVerseIndices).
+        /// An extra final offset marks the end of the last word's postings, so word N spans [N, N + 1).
+        /// These exist whether or not postings are compressed.
+        std::span<const std::uint32_t> PostingOffsets = {};
+        /// The position within its verse of every word occurrence, in the same order as the postings.
+        /// Empty if the index was created without token positions.
+        std::span<const TokenPosition> PostingTokenPositions = {};
+        /// The verse indices for all occurrences of all words in compressed form, instead of PostingVerseIndices.
+        /// Empty if postings aren't compressed.
+        CompressedPostingLists CompressedPostings = {};
+        /// The number of indexed words (including repeated words) in each verse, in the same order as BibleTranslation::VerseCharacterRanges.
+        std::span<const std::uint16_t> VerseWordCounts = {};
+        /// The number of distinct verses containing each word, in the same order as the lexicon.
+        std::span<const std::uint16_t> WordVerseCounts = {};
+
+    private:
+        /// A stem index for the lexicon that is only built on first use (see GetStemIndex()),
+        /// since most searches never match by stem.
+        struct LazyStemIndex
+        {
+            /// Ensures the stem index is only built once, even if first used by multiple threads at once.
+            std::once_flag BuildOnce = {};
+            /// True once Stems has been built.
+            std::atomic<bool> Built = false;
+            /// The stem index; empty until built.
+            StemIndex Stems = {};
+        };
+
+        /// The categories of verses relative to a searched verse (see CategorizedBibleVerseSearchResults).
+        /// Values are in the same order as the categories in search results.
+        enum class VerseCategory : std::uint8_t
+        {
+            SAME_CHAPTER,
+            SAME_BOOK,
+            OTHER_BOOK_BY_AUTHOR,
+            SAME_GENRE_IN_TESTAMENT,
+            ELSEWHERE_IN_TESTAMENT,
+            OTHER_TESTAMENT,
+            /// The searched verse itself, which isn't included in any category.
+            SEARCHED_VERSE,
+        };
+        /// The number of different verse categories.
+        static constexpr std::size_t VERSE_CATEGORY_COUNT = static_cast<std::size_t>(VerseCategory::SEARCHED_VERSE) + 1;
+
+        /// Attributes of a book used for categorizing verses.
+        struct BookAttributes
+        {
+            /// The author of the book.
+            BibleAuthor::Id Author = BibleAuthor::INVALID;
+            /// The genre of the book.
+            BibleBookGenre::Id Genre = BibleBookGenre::INVALID;
+            /// The testament containing the book.
+            BibleTestament::Id Testament = BibleTestament::INVALID;
+        };
+        /// The number of entries in tables indexed by book ID.
+        static constexpr std::size_t BOOK_TABLE_SIZE = static_cast<std::size_t>(BibleBook::REVELATION) + 1;
+        /// Attributes of each book, indexed by book ID.
+        /// They're computed at compile time so that categorizing verses only requires looking up a table.
+        static const std::array<BookAttributes, BOOK_TABLE_SIZE> ATTRIBUTES_BY_BOOK;
+
+        /// A single occurrence of a word in a verse.
+        struct WordOccurrence
+        {
+            /// The ID of the word within the partial index containing the occurrence.
+            std::uint32_t WordId = 0;
+            /// The index of the verse containing the word.
+            VerseIndex ContainingVerseIndex = 0;
+            /// The position of the word within the verse.
+            TokenPosition PositionInVerse = 0;
+        };
+
+        /// A partial index built for a subset of verses.
+        struct PartialIndex
+        {
+            /// IDs (in order of first occurrence) of normalized words.
+            /// Heterogeneous lookup is allowed to avoid allocating strings for existing words.
+            std::unordered_map<std::string, std::uint32_t, TransparentStringHash, std::equal_to<>> WordIdsByWord = {};
+            /// All word occurrences in verse order.
+            std::vector<WordOccurrence> WordOccurrences = {};
+        };
+
+        static void IndexVerses(
+            const BibleTranslation* bible_translation,
+            const std::size_t first_verse_index,
+            const std::size_t end_verse_index,
+            PartialIndex& partial_index);
+        std::vector<VerseIndex> GetMatchingVerseIndices(const std::string_view word, const WordMatchType match_type) const;
+        void AppendMatchingVerseIndices(
+            const std::string_view word,
+            const std::string_view normalized_word,
+            const std::optional<std::size_t> word_index,
+            const WordMatchType match_type,
+            std::vector<VerseIndex>& verse_indices) const;
+        static std::size_t CountExactWordOccurrences(const std::string_view verse_text, const std::string_view word);
+        std::vector<std::size_t> FindQueryWords(const std::string_view query_text) const;
+        double ScoreVerse(const std::span<const std::size_t> query_word_indices, const std::size_t verse_index) const;
+        double ComputeRelevanceScore(
+            const std::size_t word_index,
+            const std::size_t occurrence_count_in_verse,
+            const std::size_t verse_index) const;
+        template <typename WordProcessor>
+        static void ForEachWord(
+            const std::string_view text,
+            const bool include_unterminated_final_word,
+            const WordProcessor& process_word);
+
+        /// The stem index for the lexicon, which is shared so that copies of an index only build it once.
+        /// Null for an index that wasn't created from any data (see FromPrecomputedData()).
+        std::shared_ptr<LazyStemIndex> LazyStems = nullptr;
     };
 }
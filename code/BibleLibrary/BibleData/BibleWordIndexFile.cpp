@@ -0,0 +1,447 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+#include <vector>
+#if _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "BibleData/BibleTranslation.h"
+#include "BibleData/BibleWordIndexFile.h"
+
+namespace BIBLE_DATA
+{
+    // The header is directly followed by aligned arrays, so it must keep them aligned.
+    static_assert(0 == (sizeof(BibleWordIndexFile::Header) % BibleWordIndexFile::ARRAY_ALIGNMENT_IN_BYTES));
+    // Compressed posting blocks are stored as-is, so they must not have any padding bytes that would vary between saves.
+    static_assert(8 == sizeof(CompressedPostingLists::Block));
+
+    /// Computes a hash of a translation's verse text for checking if a word index file was built from the same text.
+    /// The character ranges of verses are included since the index depends on how text is split into verses.
+    /// @param[in]  bible_translation - The translation to hash.
+    /// @return The hash of the translation's verse text.
+    std::uint64_t BibleWordIndexFile::HashTranslationText(const BibleTranslation& bible_translation)
+    {
+        // A translation without verses has no text.
+        if (bible_translation.VerseCharacterRanges.empty())
+        {
+            return FNV_OFFSET_BASIS;
+        }
+
+        // HASH THE FULL TEXT OF ALL VERSES.
+        std::size_t text_character_count = bible_translation.VerseCharacterRanges.back().LastCharacterOffsetIntoFullBibleText;
+        std::span<const char> text(bible_translation.Text, text_character_count);
+        std::uint64_t hash = HashBytes(std::as_bytes(text), FNV_OFFSET_BASIS);
+
+        // HASH THE CHARACTER RANGES OF ALL VERSES.
+        // Only the offsets are hashed to avoid including any padding bytes.
+        for (const BibleVerseIdWithCharacterRange& verse : bible_translation.VerseCharacterRanges)
+        {
+            const std::uint64_t verse_character_offsets[] =
+            {
+                verse.FirstCharacterOffsetIntoFullBibleText,
+                verse.LastCharacterOffsetIntoFullBibleText,
+            };
+            hash = HashBytes(std::as_bytes(std::span(verse_character_offsets)), hash);
+        }
+        return hash;
+    }
+
+    /// Saves a word index to a file.
+    /// The file is written to a temporary location first and then renamed, so other processes never see a partial file.
+    /// @param[in]  word_index - The word index to save.
+    /// @param[in]  filepath - The path of the file to save to.  Any existing file is replaced.
+    /// @return True if the file was saved; false otherwise (including for an index that wasn't created from any data).
+    bool BibleWordIndexFile::Save(const BibleWordIndex& word_index, const std::filesystem::path& filepath)
+    {
+        // MAKE SURE THE INDEX HAS DATA TO SAVE.
+        // An index that wasn't created has no translation to identify and no final posting offset for the posting count.
+        bool index_created = (word_index.Bible && !word_index.PostingOffsets.empty());
+        if (!index_created)
+        {
+            return false;
+        }
+
+        // DESCRIBE THE INDEX.
+        Header header =
+        {
+            .TranslationTextHash = HashTranslationText(*word_index.Bible),
+            .LexiconCharacterCount = word_index.LexiconCharacters.size(),
+            .WordCount = word_index.WordCount(),
+            .PostingCount = word_index.PostingOffsets.back(),
+            .PostingVerseIndexCount = word_index.PostingVerseIndices.size(),
+            .VerseCount = word_index.VerseWordCounts.size(),
+            .TokenPositionCount = word_index.PostingTokenPositions.size(),
+            .CompressedPostingBlockCount = word_index.CompressedPostings.Blocks.size(),
+            .CompressedPostingByteCount = word_index.CompressedPostings.EncodedBytes.size(),
+        };
+
+        // ARRANGE THE INDEX'S ARRAYS AS THEY'LL BE STORED IN THE FILE.
+        // This must be in the same order as the counts in the header.
+        const std::span<const std::byte> ARRAYS[] =
+        {
+            std::as_bytes(std::span(word_index.LexiconCharacters.data(), word_index.LexiconCharacters.size())),
+            std::as_bytes(word_index.LexiconWordOffsets),
+            std::as_bytes(word_index.PostingVerseIndices),
+            std::as_bytes(word_index.PostingOffsets),
+            std::as_bytes(word_index.VerseWordCounts),
+            std::as_bytes(word_index.WordVerseCounts),
+            std::as_bytes(word_index.PostingTokenPositions),
+            std::as_bytes(word_index.CompressedPostings.WordFirstBlockIndices),
+            std::as_bytes(word_index.CompressedPostings.Blocks),
+            std::as_bytes(word_index.CompressedPostings.EncodedBytes),
+        };
+        std::vector<std::byte> array_bytes;
+        for (const std::span<const std::byte>& array : ARRAYS)
+        {
+            array_bytes.insert(array_bytes.end(), array.begin(), array.end());
+
+            // Padding is added so that the next array is aligned.
+            std::size_t padding_byte_count = (ARRAY_ALIGNMENT_IN_BYTES - (array_bytes.size() % ARRAY_ALIGNMENT_IN_BYTES)) % ARRAY_ALIGNMENT_IN_BYTES;
+            array_bytes.resize(array_bytes.size() + padding_byte_count);
+        }
+        header.ArraysChecksum = HashBytes(array_bytes, FNV_OFFSET_BASIS);
+
+        // WRITE THE FILE.
+        std::filesystem::path temporary_filepath = filepath;
+        temporary_filepath += ".tmp";
+        {
+            std::ofstream file(temporary_filepath, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(array_bytes.data()), static_cast<std::streamsize>(array_bytes.size()));
+            if (!file)
+            {
+                return false;
+            }
+        }
+
+        // REPLACE ANY EXISTING FILE.
+        // Errors are reported via the error code rather than exceptions since a failure to save isn't critical.
+        std::error_code rename_error;
+        std::filesystem::rename(temporary_filepath, filepath, rename_error);
+        if (rename_error)
+        {
+            std::error_code remove_error;
+            std::filesystem::remove(temporary_filepath, remove_error);
+            return false;
+        }
+
+        return true;
+    }
+
+    /// Loads a word index from a file by memory-mapping it.
+    /// Index data isn't copied, so only the checks of the file's contents need to read through it.
+    /// @param[in]  bible_translation - The translation the index should be for.
+    /// @param[in]  filepath - The path of the file to load.
+    /// @return The word index viewing the mapped file, if the file is valid for the translation; null otherwise.
+    std::optional<BibleWordIndex> BibleWordIndexFile::Load(const BibleTranslation* bible_translation, const std::filesystem::path& filepath)
+    {
+        // MAP THE FILE INTO MEMORY.
+        std::shared_ptr<const MemoryMappedFile> mapped_file = MemoryMappedFile::Open(filepath);
+        if (!mapped_file)
+        {
+            return std::nullopt;
+        }
+
+        // CHECK THAT THE FILE HAS THE CURRENT FORMAT.
+        std::span<const std::byte> file_bytes = mapped_file->Bytes;
+        if (file_bytes.size() < sizeof(Header))
+        {
+            return std::nullopt;
+        }
+        Header header;
+        std::memcpy(&header, file_bytes.data(), sizeof(header));
+        bool current_format = (
+            (MAGIC_BYTES == header.MagicBytes) &&
+            (FORMAT_VERSION == header.FormatVersion) &&
+            (sizeof(Header) == header.HeaderSizeInBytes));
+        if (!current_format)
+        {
+            return std::nullopt;
+        }
+
+        // CHECK THAT THE INDEX WAS BUILT FROM THE SAME TRANSLATION.
+        bool same_translation = (
+            (bible_translation->VerseCharacterRanges.size() == header.VerseCount) &&
+            (HashTranslationText(*bible_translation) == header.TranslationTextHash));
+        if (!same_translation)
+        {
+            return std::nullopt;
+        }
+
+        // CHECK THAT THE FILE HAS THE EXPECTED SIZE.
+        // Counts are first limited to the file size so that computing array sizes can't overflow.
+        const std::uint64_t COUNTS[] =
+        {
+            header.LexiconCharacterCount,
+            header.WordCount,
+            header.PostingCount,
+            header.PostingVerseIndexCount,
+            header.VerseCount,
+            header.TokenPositionCount,
+            header.CompressedPostingBlockCount,
+            header.CompressedPostingByteCount,
+        };
+        for (const std::uint64_t count : COUNTS)
+        {
+            if (count > file_bytes.size())
+            {
+                return std::nullopt;
+            }
+        }
+        // This must be in the same order as the arrays are stored.
+        bool postings_compressed = (header.CompressedPostingByteCount > 0);
+        std::size_t word_first_block_index_count = postings_compressed ? (header.WordCount + 1) : 0;
+        const std::size_t ARRAY_SIZES_IN_BYTES[] =
+        {
+            header.LexiconCharacterCount * sizeof(char),
+            (header.WordCount + 1) * sizeof(std::uint32_t),
+            header.PostingVerseIndexCount * sizeof(BibleWordIndex::VerseIndex),
+            (header.WordCount + 1) * sizeof(std::uint32_t),
+            header.VerseCount * sizeof(std::uint16_t),
+            header.WordCount * sizeof(std::uint16_t),
+            header.TokenPositionCount * sizeof(BibleWordIndex::TokenPosition),
+            word_first_block_index_count * sizeof(std::uint32_t),
+            header.CompressedPostingBlockCount * sizeof(CompressedPostingLists::Block),
+            header.CompressedPostingByteCount * sizeof(std::uint8_t),
+        };
+        std::vector<std::size_t> array_offsets;
+        std::size_t array_offset = sizeof(Header);
+        for (const std::size_t array_size_in_bytes : ARRAY_SIZES_IN_BYTES)
+        {
+            array_offsets.push_back(array_offset);
+            std::size_t padded_array_size_in_bytes = ((array_size_in_bytes + ARRAY_ALIGNMENT_IN_BYTES - 1) / ARRAY_ALIGNMENT_IN_BYTES) * ARRAY_ALIGNMENT_IN_BYTES;
+            array_offset += padded_array_size_in_bytes;
+        }
+        if (file_bytes.size() != array_offset)
+        {
+            return std::nullopt;
+        }
+
+        // CHECK THAT THE ARRAYS AREN'T CORRUPTED.
+        std::uint64_t arrays_checksum = HashBytes(file_bytes.subspan(sizeof(Header)), FNV_OFFSET_BASIS);
+        if (arrays_checksum != header.ArraysChecksum)
+        {
+            return std::nullopt;
+        }
+
+        // VIEW THE ARRAYS DIRECTLY IN THE MAPPED FILE.
+        // The mapping starts on a page boundary, and every array is aligned within the file.
+        auto get_array_bytes = [&](const std::size_t array_index)
+        {
+            return file_bytes.data() + array_offsets[array_index];
+        };
+        std::string_view lexicon_characters(reinterpret_cast<const char*>(get_array_bytes(0)), header.LexiconCharacterCount);
+        std::span<const std::uint32_t> lexicon_word_offsets(reinterpret_cast<const std::uint32_t*>(get_array_bytes(1)), header.WordCount + 1);
+        std::span<const BibleWordIndex::VerseIndex> posting_verse_indices(reinterpret_cast<const BibleWordIndex::VerseIndex*>(get_array_bytes(2)), header.PostingVerseIndexCount);
+        std::span<const std::uint32_t> posting_offsets(reinterpret_cast<const std::uint32_t*>(get_array_bytes(3)), header.WordCount + 1);
+        std::span<const std::uint16_t> verse_word_counts(reinterpret_cast<const std::uint16_t*>(get_array_bytes(4)), header.VerseCount);
+        std::span<const std::uint16_t> word_verse_counts(reinterpret_cast<const std::uint16_t*>(get_array_bytes(5)), header.WordCount);
+        std::span<const BibleWordIndex::TokenPosition> posting_token_positions(reinterpret_cast<const BibleWordIndex::TokenPosition*>(get_array_bytes(6)), header.TokenPositionCount);
+        CompressedPostingLists compressed_postings =
+        {
+            .WordFirstBlockIndices = std::span<const std::uint32_t>(reinterpret_cast<const std::uint32_t*>(get_array_bytes(7)), word_first_block_index_count),
+            .Blocks = std::span<const CompressedPostingLists::Block>(reinterpret_cast<const CompressedPostingLists::Block*>(get_array_bytes(8)), header.CompressedPostingBlockCount),
+            .EncodedBytes = std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(get_array_bytes(9)), header.CompressedPostingByteCount),
+        };
+
+        // CHECK THAT THE OFFSETS STAY WITHIN THE ARRAYS.
+        // Offsets are only checked at their ends since the checksum guards against corruption.
+        // Postings must be stored in exactly one of the uncompressed or compressed forms.
+        bool postings_valid = postings_compressed ?
+            ((0 == header.PostingVerseIndexCount) && (compressed_postings.WordFirstBlockIndices.back() == header.CompressedPostingBlockCount)) :
+            ((header.PostingCount == header.PostingVerseIndexCount) && (0 == header.CompressedPostingBlockCount));
+        bool offsets_valid = (
+            (lexicon_word_offsets.back() == header.LexiconCharacterCount) &&
+            (posting_offsets.back() == header.PostingCount) &&
+            postings_valid &&
+            ((0 == header.TokenPositionCount) || (header.PostingCount == header.TokenPositionCount)));
+        if (!offsets_valid)
+        {
+            return std::nullopt;
+        }
+
+        // CREATE THE INDEX.
+        // The mapped file is kept alive by the index (and any copies of it).
+        BibleWordIndex word_index = BibleWordIndex::FromPrecomputedData(
+            bible_translation,
+            lexicon_characters,
+            lexicon_word_offsets,
+            posting_verse_indices,
+            posting_offsets,
+            verse_word_counts,
+            word_verse_counts,
+            posting_token_positions,
+            compressed_postings);
+        word_index.OwnedData = mapped_file;
+        return word_index;
+    }
+
+    /// Loads a word index from a file if it's valid for the translation; otherwise, builds the index
+    /// and saves it to the file so that later loads are faster.
+    /// @param[in]  bible_translation - The translation the index is for.
+    /// @param[in]  filepath - The path of the file to load from or save to.
+    /// @param[in]  thread_count - The number of threads to use if building the index (see BibleWordIndex::Build()).
+    /// @param[in]  include_token_positions - True if the index should have token positions (see BibleWordIndex::Build()).
+    ///     Files without token positions are rebuilt if this is true.
+    /// @param[in]  compress_postings - True if the index should have compressed postings (see BibleWordIndex::Build()).
+    ///     Files with postings in the other form are rebuilt.
+    /// @return The loaded or built word index.
+    BibleWordIndex BibleWordIndexFile::LoadOrBuild(
+        const BibleTranslation* bible_translation,
+        const std::filesystem::path& filepath,
+        const unsigned int thread_count,
+        const bool include_token_positions,
+        const bool compress_postings)
+    {
+        // TRY LOADING THE INDEX FROM THE FILE.
+        std::optional<BibleWordIndex> loaded_word_index = Load(bible_translation, filepath);
+        bool loaded_index_usable = (
+            loaded_word_index &&
+            (!include_token_positions || loaded_word_index->HasTokenPositions()) &&
+            (compress_postings == loaded_word_index->HasCompressedPostings()));
+        if (loaded_index_usable)
+        {
+            return *loaded_word_index;
+        }
+
+        // RELEASE ANY UNUSABLE LOADED INDEX.
+        // It keeps the file mapped, which prevents replacing the file on Windows.
+        loaded_word_index.reset();
+
+        // BUILD THE INDEX.
+        BibleWordIndex built_word_index = BibleWordIndex::Build(bible_translation, thread_count, include_token_positions, compress_postings);
+
+        // SAVE THE INDEX FOR NEXT TIME.
+        // Failing to save only means that the index will need to be built again next time.
+        bool saved = Save(built_word_index, filepath);
+        if (!saved)
+        {
+            std::fprintf(stderr, "Failed to save word index to %s\n", filepath.string().c_str());
+        }
+
+        return built_word_index;
+    }
+
+    /// Hashes bytes using FNV-1a (https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function),
+    /// combining 8 bytes at a time rather than 1 for speed since this is used for entire files.
+    /// @param[in]  bytes - The bytes to hash.
+    /// @param[in]  initial_hash - The hash to start from, for continuing a previous hash.
+    /// @return The hash of the bytes.
+    std::uint64_t BibleWordIndexFile::HashBytes(const std::span<const std::byte> bytes, const std::uint64_t initial_hash)
+    {
+        constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+        std::uint64_t hash = initial_hash;
+
+        // HASH 8 BYTES AT A TIME.
+        constexpr std::size_t BYTES_PER_WORD = sizeof(std::uint64_t);
+        std::size_t full_word_byte_count = bytes.size() - (bytes.size() % BYTES_PER_WORD);
+        for (std::size_t byte_index = 0; byte_index < full_word_byte_count; byte_index += BYTES_PER_WORD)
+        {
+            std::uint64_t word = 0;
+            std::memcpy(&word, bytes.data() + byte_index, BYTES_PER_WORD);
+            hash ^= word;
+            hash *= FNV_PRIME;
+        }
+
+        // HASH ANY REMAINING BYTES.
+        for (std::size_t byte_index = full_word_byte_count; byte_index < bytes.size(); ++byte_index)
+        {
+            hash ^= static_cast<std::uint64_t>(bytes[byte_index]);
+            hash *= FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    /// Maps an entire file into memory as read-only.
+    /// The mapping is shared, so multiple processes mapping the same file share the same physical memory.
+    /// @param[in]  filepath - The path of the file to map.
+    /// @return The mapped file, if successfully mapped; null otherwise (including for empty files, which can't be mapped).
+    std::shared_ptr<const BibleWordIndexFile::MemoryMappedFile> BibleWordIndexFile::MemoryMappedFile::Open(const std::filesystem::path& filepath)
+    {
+#if _WIN32
+        // OPEN THE FILE.
+        HANDLE file_handle = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (INVALID_HANDLE_VALUE == file_handle)
+        {
+            return nullptr;
+        }
+        LARGE_INTEGER file_size = {};
+        bool file_size_retrieved = (0 != GetFileSizeEx(file_handle, &file_size));
+        if (!file_size_retrieved || (0 == file_size.QuadPart))
+        {
+            CloseHandle(file_handle);
+            return nullptr;
+        }
+
+        // MAP THE FILE.
+        // Handles can be closed immediately since a mapped view keeps the underlying file mapped.
+        HANDLE mapping_handle = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file_handle);
+        if (!mapping_handle)
+        {
+            return nullptr;
+        }
+        void* mapped_bytes = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping_handle);
+        if (!mapped_bytes)
+        {
+            return nullptr;
+        }
+        std::size_t file_size_in_bytes = static_cast<std::size_t>(file_size.QuadPart);
+#else
+        // OPEN THE FILE.
+        int file_descriptor = open(filepath.c_str(), O_RDONLY);
+        if (file_descriptor < 0)
+        {
+            return nullptr;
+        }
+        struct stat file_status = {};
+        bool file_status_retrieved = (0 == fstat(file_descriptor, &file_status));
+        if (!file_status_retrieved || (0 == file_status.st_size))
+        {
+            close(file_descriptor);
+            return nullptr;
+        }
+
+        // MAP THE FILE.
+        // The file can be closed immediately since the mapping keeps the underlying file mapped.
+        std::size_t file_size_in_bytes = static_cast<std::size_t>(file_status.st_size);
+        void* mapped_bytes = mmap(nullptr, file_size_in_bytes, PROT_READ, MAP_SHARED, file_descriptor, 0);
+        close(file_descriptor);
+        if (MAP_FAILED == mapped_bytes)
+        {
+            return nullptr;
+        }
+#endif
+
+        std::shared_ptr<MemoryMappedFile> mapped_file = std::make_shared<MemoryMappedFile>();
+        mapped_file->Bytes = std::span<const std::byte>(static_cast<const std::byte*>(mapped_bytes), file_size_in_bytes);
+        return mapped_file;
+    }
+
+    /// Unmaps the file.
+    BibleWordIndexFile::MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (Bytes.empty())
+        {
+            return;
+        }
+
+#if _WIN32
+        UnmapViewOfFile(Bytes.data());
+#else
+        munmap(const_cast<std::byte*>(Bytes.data()), Bytes.size());
+#endif
+    }
+}
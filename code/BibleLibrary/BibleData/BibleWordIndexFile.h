@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include "BibleData/BibleWordIndex.h"
+
+namespace BIBLE_DATA
+{
+    /// @todo   Get rid of forward declaration?
+    class BibleTranslation;
+
+    /// A binary file holding a built word index, for translations whose indexes aren't precomputed into code files.
+    ///
+    /// Files are loaded by memory-mapping them read-only, and the index's arrays view the mapped pages directly,
+    /// so loading doesn't copy or convert any index data, and multiple processes loading the same file
+    /// share the same physical memory.  To allow this, arrays are stored in their in-memory form
+    /// (little-endian on x64) at offsets aligned for their element types.
+    ///
+    /// The file format is:
+    /// - A Header.
+    /// - The index's arrays, in the order of the Header's counts, each padded to a multiple of ARRAY_ALIGNMENT_IN_BYTES.
+    ///
+    /// Files are only used if they have the current format version, were built from the same translation text,
+    /// and match their checksum.  Otherwise, they must be rebuilt (see LoadOrBuild()).
+    class BibleWordIndexFile
+    {
+    public:
+        /// The bytes identifying a word index file.
+        static constexpr std::array<char, 8> MAGIC_BYTES = { 'B', 'I', 'B', 'L', 'W', 'I', 'D', 'X' };
+        /// The current version of the file format.  Must be incremented whenever the format changes.
+        static constexpr std::uint32_t FORMAT_VERSION = 2;
+        /// The alignment of each array in the file, which is enough for any array's element type.
+        static constexpr std::size_t ARRAY_ALIGNMENT_IN_BYTES = 8;
+
+        /// The header at the start of a word index file.
+        struct Header
+        {
+            /// Should be MAGIC_BYTES.
+            std::array<char, 8> MagicBytes = MAGIC_BYTES;
+            /// The version of the file format.
+            std::uint32_t FormatVersion = FORMAT_VERSION;
+            /// The size of this header, for additional checking of the format.
+            std::uint32_t HeaderSizeInBytes = sizeof(Header);
+            /// The hash of the translation's verse text (see HashTranslationText()) the index was built from.
+            std::uint64_t TranslationTextHash = 0;
+            /// The hash of all bytes after the header.
+            std::uint64_t ArraysChecksum = 0;
+            /// The number of characters in BibleWordIndex::LexiconCharacters.
+            std::uint64_t LexiconCharacterCount = 0;
+            /// The number of words in the lexicon.  BibleWordIndex::LexiconWordOffsets, BibleWordIndex::PostingOffsets,
+            /// and BibleWordIndex::WordVerseCounts are sized based on this.
+            std::uint64_t WordCount = 0;
+            /// The total number of postings for all words (the last entry in BibleWordIndex::PostingOffsets).
+            std::uint64_t PostingCount = 0;
+            /// The number of entries in BibleWordIndex::PostingVerseIndices.
+            /// Either PostingCount for uncompressed postings or 0 for compressed postings.
+            std::uint64_t PostingVerseIndexCount = 0;
+            /// The number of entries in BibleWordIndex::VerseWordCounts.
+            std::uint64_t VerseCount = 0;
+            /// The number of entries in BibleWordIndex::PostingTokenPositions.
+            std::uint64_t TokenPositionCount = 0;
+            /// The number of entries in CompressedPostingLists::Blocks.
+            std::uint64_t CompressedPostingBlockCount = 0;
+            /// The number of entries in CompressedPostingLists::EncodedBytes.  Only 0 for uncompressed postings,
+            /// in which case CompressedPostingLists::WordFirstBlockIndices is empty rather than sized based on WordCount.
+            std::uint64_t CompressedPostingByteCount = 0;
+        };
+
+        static std::uint64_t HashTranslationText(const BibleTranslation& bible_translation);
+        static bool Save(const BibleWordIndex& word_index, const std::filesystem::path& filepath);
+        static std::optional<BibleWordIndex> Load(const BibleTranslation* bible_translation, const std::filesystem::path& filepath);
+        static BibleWordIndex LoadOrBuild(
+            const BibleTranslation* bible_translation,
+            const std::filesystem::path& filepath,
+            const unsigned int thread_count = 1,
+            const bool include_token_positions = false,
+            const bool compress_postings = false);
+
+    private:
+        /// The initial value for FNV-1a hashes.
+        static constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+
+        /// A read-only memory mapping of an entire file, which is unmapped when destroyed.
+        class MemoryMappedFile
+        {
+        public:
+            static std::shared_ptr<const MemoryMappedFile> Open(const std::filesystem::path& filepath);
+
+            MemoryMappedFile() = default;
+            MemoryMappedFile(const MemoryMappedFile&) = delete;
+            MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+            ~MemoryMappedFile();
+
+            /// The bytes of the file.
+            std::span<const std::byte> Bytes = {};
+        };
+
+        static std::uint64_t HashBytes(const std::span<const std::byte> bytes, const std::uint64_t initial_hash);
+    };
+}
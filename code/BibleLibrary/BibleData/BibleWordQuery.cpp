@@ -0,0 +1,593 @@
+#include <algorithm>
+#include <cctype>
+#include "BibleData/BibleTranslation.h"
+#include "BibleData/BibleWordQuery.h"
+
+namespace BIBLE_DATA
+{
+    /// Parses a query from text.
+    /// @param[in]  query_text - The text of the query (see the class documentation for syntax).
+    /// @return The query, if successfully parsed; null otherwise (such as for empty queries,
+    ///     unbalanced parentheses, or operators missing operands).
+    std::optional<BibleWordQuery> BibleWordQuery::Parse(const std::string_view query_text)
+    {
+        // SPLIT THE QUERY INTO TOKENS.
+        std::vector<QueryToken> tokens = Tokenize(query_text);
+        bool tokens_exist = !tokens.empty();
+        if (!tokens_exist)
+        {
+            return std::nullopt;
+        }
+
+        // PARSE THE TOKENS INTO NODES.
+        BibleWordQuery query;
+        std::size_t token_index = 0;
+        std::optional<std::size_t> root_node_index = query.ParseOrExpression(tokens, token_index);
+        if (!root_node_index)
+        {
+            return std::nullopt;
+        }
+
+        // MAKE SURE ALL TOKENS WERE PARSED.
+        // Leftover tokens would indicate something like an unmatched closing parenthesis.
+        bool all_tokens_parsed = (tokens.size() == token_index);
+        if (!all_tokens_parsed)
+        {
+            return std::nullopt;
+        }
+
+        query.RootNodeIndex = *root_node_index;
+        return query;
+    }
+
+    /// Finds verses matching the query.
+    /// @param[in]  word_index - The word index for the translation to search.
+    /// @return The verses matching the query.  Verse text is not retrieved until requested from the set.
+    BibleVerseSet BibleWordQuery::Evaluate(const BibleWordIndex& word_index) const
+    {
+        // INITIALIZE THE RESULTS.
+        BibleVerseSet matching_verses =
+        {
+            .Bible = word_index.Bible,
+        };
+
+        // MAKE SURE THE QUERY HAS SOMETHING TO EVALUATE.
+        bool nodes_exist = !Nodes.empty();
+        if (!nodes_exist)
+        {
+            return matching_verses;
+        }
+
+        // EVALUATE THE QUERY.
+        // The total number of verses is needed to support NOT.
+        std::size_t verse_count = word_index.Bible ? word_index.Bible->VerseCharacterRanges.size() : 0;
+        matching_verses.VerseIndices = EvaluateNode(word_index, RootNodeIndex, verse_count);
+        return matching_verses;
+    }
+
+    /// Splits query text into tokens.
+    /// Words are runs of letters and digits (like for the word index), and all other characters
+    /// besides parentheses just separate tokens.
+    /// @param[in]  query_text - The query text to tokenize.
+    /// @return The tokens in the query text.
+    std::vector<BibleWordQuery::QueryToken> BibleWordQuery::Tokenize(const std::string_view query_text)
+    {
+        std::vector<QueryToken> tokens;
+        std::size_t query_character_count = query_text.length();
+        std::size_t character_index = 0;
+        while (character_index < query_character_count)
+        {
+            // HANDLE PARENTHESES.
+            char current_character = query_text[character_index];
+            if ('(' == current_character)
+            {
+                tokens.push_back({ .Type = QueryTokenType::OPEN_PARENTHESIS, .Text = query_text.substr(character_index, 1) });
+                ++character_index;
+                continue;
+            }
+            else if (')' == current_character)
+            {
+                tokens.push_back({ .Type = QueryTokenType::CLOSE_PARENTHESIS, .Text = query_text.substr(character_index, 1) });
+                ++character_index;
+                continue;
+            }
+
+            // SKIP OVER ANY OTHER CHARACTERS NOT PART OF WORDS.
+            bool is_part_of_word = std::isalnum(static_cast<unsigned char>(current_character));
+            if (!is_part_of_word)
+            {
+                ++character_index;
+                continue;
+            }
+
+            // READ THE ENTIRE WORD.
+            std::size_t word_start_character_index = character_index;
+            while ((character_index < query_character_count) && std::isalnum(static_cast<unsigned char>(query_text[character_index])))
+            {
+                ++character_index;
+            }
+            std::string_view word = query_text.substr(word_start_character_index, character_index - word_start_character_index);
+
+            // DETERMINE IF THE WORD IS AN OPERATOR.
+            QueryToken token = { .Type = QueryTokenType::WORD, .Text = word };
+            if ("AND" == word)
+            {
+                token.Type = QueryTokenType::AND;
+            }
+            else if ("OR" == word)
+            {
+                token.Type = QueryTokenType::OR;
+            }
+            else if ("NOT" == word)
+            {
+                token.Type = QueryTokenType::NOT;
+            }
+            tokens.push_back(token);
+        }
+
+        return tokens;
+    }
+
+    /// Parses an expression of one or more subexpressions separated by OR.
+    /// @param[in]  tokens - The tokens being parsed.
+    /// @param[in,out]  token_index - The index of the next token to parse.  Updated to be past the expression.
+    /// @return The index of the node for the expression, if successfully parsed; null otherwise.
+    std::optional<std::size_t> BibleWordQuery::ParseOrExpression(const std::vector<QueryToken>& tokens, std::size_t& token_index)
+    {
+        // PARSE THE FIRST SUBEXPRESSION.
+        std::optional<std::size_t> first_node_index = ParseAndExpression(tokens, token_index);
+        if (!first_node_index)
+        {
+            return std::nullopt;
+        }
+
+        // PARSE ANY ADDITIONAL SUBEXPRESSIONS.
+        Node or_node = { .Type = NodeType::OR, .ChildNodeIndices = { *first_node_index } };
+        while ((token_index < tokens.size()) && (QueryTokenType::OR == tokens[token_index].Type))
+        {
+            ++token_index;
+            std::optional<std::size_t> next_node_index = ParseAndExpression(tokens, token_index);
+            if (!next_node_index)
+            {
+                return std::nullopt;
+            }
+            or_node.ChildNodeIndices.push_back(*next_node_index);
+        }
+
+        // AVOID AN EXTRA NODE IF NO OR WAS PRESENT.
+        bool single_subexpression = (1 == or_node.ChildNodeIndices.size());
+        if (single_subexpression)
+        {
+            return first_node_index;
+        }
+
+        return AddNode(std::move(or_node));
+    }
+
+    /// Parses an expression of one or more subexpressions that must all match.
+    /// Subexpressions may be separated by AND or just placed next to each other.
+    /// @param[in]  tokens - The tokens being parsed.
+    /// @param[in,out]  token_index - The index of the next token to parse.  Updated to be past the expression.
+    /// @return The index of the node for the expression, if successfully parsed; null otherwise.
+    std::optional<std::size_t> BibleWordQuery::ParseAndExpression(const std::vector<QueryToken>& tokens, std::size_t& token_index)
+    {
+        // PARSE THE FIRST SUBEXPRESSION.
+        std::optional<std::size_t> first_node_index = ParseUnaryExpression(tokens, token_index);
+        if (!first_node_index)
+        {
+            return std::nullopt;
+        }
+
+        // PARSE ANY ADDITIONAL SUBEXPRESSIONS.
+        Node and_node = { .Type = NodeType::AND, .ChildNodeIndices = { *first_node_index } };
+        while (token_index < tokens.size())
+        {
+            // CHECK IF ANOTHER SUBEXPRESSION IS PART OF THIS EXPRESSION.
+            // OR and closing parentheses end this expression, but anything else continues it.
+            QueryTokenType token_type = tokens[token_index].Type;
+            bool expression_ended = (QueryTokenType::OR == token_type) || (QueryTokenType::CLOSE_PARENTHESIS == token_type);
+            if (expression_ended)
+            {
+                break;
+            }
+
+            // SKIP ANY EXPLICIT AND.
+            if (QueryTokenType::AND == token_type)
+            {
+                ++token_index;
+            }
+
+            // PARSE THE NEXT SUBEXPRESSION.
+            std::optional<std::size_t> next_node_index = ParseUnaryExpression(tokens, token_index);
+            if (!next_node_index)
+            {
+                return std::nullopt;
+            }
+            and_node.ChildNodeIndices.push_back(*next_node_index);
+        }
+
+        // AVOID AN EXTRA NODE IF ONLY A SINGLE SUBEXPRESSION WAS PRESENT.
+        bool single_subexpression = (1 == and_node.ChildNodeIndices.size());
+        if (single_subexpression)
+        {
+            return first_node_index;
+        }
+
+        return AddNode(std::move(and_node));
+    }
+
+    /// Parses a single word, a parenthesized expression, or NOT applied to one of these.
+    /// @param[in]  tokens - The tokens being parsed.
+    /// @param[in,out]  token_index - The index of the next token to parse.  Updated to be past the expression.
+    /// @return The index of the node for the expression, if successfully parsed; null otherwise.
+    std::optional<std::size_t> BibleWordQuery::ParseUnaryExpression(const std::vector<QueryToken>& tokens, std::size_t& token_index)
+    {
+        // MAKE SURE A TOKEN EXISTS.
+        bool token_exists = (token_index < tokens.size());
+        if (!token_exists)
+        {
+            return std::nullopt;
+        }
+
+        const QueryToken& token = tokens[token_index];
+        switch (token.Type)
+        {
+            case QueryTokenType::WORD:
+            {
+                // NORMALIZE THE WORD TO MATCH HOW IT'S INDEXED.
+                ++token_index;
+                BibleWordIndex::WordNormalizationBuffer word_normalization_buffer;
+                std::string_view normalized_word = BibleWordIndex::NormalizeWord(token.Text, word_normalization_buffer);
+                return AddNode({ .Type = NodeType::WORD, .NormalizedWord = std::string(normalized_word) });
+            }
+            case QueryTokenType::NOT:
+            {
+                // PARSE THE EXPRESSION BEING NEGATED.
+                ++token_index;
+                std::optional<std::size_t> negated_node_index = ParseUnaryExpression(tokens, token_index);
+                if (!negated_node_index)
+                {
+                    return std::nullopt;
+                }
+                return AddNode({ .Type = NodeType::NOT, .ChildNodeIndices = { *negated_node_index } });
+            }
+            case QueryTokenType::OPEN_PARENTHESIS:
+            {
+                // PARSE THE EXPRESSION WITHIN THE PARENTHESES.
+                ++token_index;
+                std::optional<std::size_t> inner_node_index = ParseOrExpression(tokens, token_index);
+                if (!inner_node_index)
+                {
+                    return std::nullopt;
+                }
+
+                // MAKE SURE THE PARENTHESES ARE CLOSED.
+                bool parentheses_closed = (token_index < tokens.size()) && (QueryTokenType::CLOSE_PARENTHESIS == tokens[token_index].Type);
+                if (!parentheses_closed)
+                {
+                    return std::nullopt;
+                }
+                ++token_index;
+                return inner_node_index;
+            }
+            default:
+                // Operators without a left operand or unexpected closing parentheses are invalid here.
+                return std::nullopt;
+        }
+    }
+
+    /// Adds a node to the query.
+    /// @param[in]  node - The node to add.
+    /// @return The index of the added node.
+    std::size_t BibleWordQuery::AddNode(Node&& node)
+    {
+        std::size_t node_index = Nodes.size();
+        Nodes.emplace_back(std::move(node));
+        return node_index;
+    }
+
+    /// Evaluates a node in the query.
+    /// @param[in]  word_index - The word index for the translation to search.
+    /// @param[in]  node_index - The index of the node to evaluate.
+    /// @param[in]  verse_count - The total number of verses in the translation.
+    /// @return Indices of verses matching the node, in increasing order without duplicates.
+    std::vector<BibleWordIndex::VerseIndex> BibleWordQuery::EvaluateNode(
+        const BibleWordIndex& word_index,
+        const std::size_t node_index,
+        const std::size_t verse_count) const
+    {
+        // Results for non-word child nodes are stored here to allow operating on them the same as posting lists.
+        std::vector<std::vector<BibleWordIndex::VerseIndex>> evaluated_verse_indices;
+        const Node& node = Nodes[node_index];
+        evaluated_verse_indices.reserve(node.ChildNodeIndices.size());
+
+        switch (node.Type)
+        {
+            case NodeType::WORD:
+            {
+                // Posting lists have an entry per occurrence, so verses may be duplicated.
+                BibleWordIndex::PostingCursor postings = GetNodePostings(word_index, node_index, verse_count, evaluated_verse_indices);
+                return RemoveDuplicates(postings);
+            }
+            case NodeType::NOT:
+            {
+                BibleWordIndex::PostingCursor negated_postings = GetNodePostings(
+                    word_index,
+                    node.ChildNodeIndices.front(),
+                    verse_count,
+                    evaluated_verse_indices);
+                return Complement(negated_postings, verse_count);
+            }
+            case NodeType::OR:
+            {
+                // COMBINE VERSES FROM ALL CHILD NODES.
+                std::vector<BibleWordIndex::VerseIndex> matching_verse_indices;
+                for (const std::size_t child_node_index : node.ChildNodeIndices)
+                {
+                    BibleWordIndex::PostingCursor child_postings = GetNodePostings(
+                        word_index,
+                        child_node_index,
+                        verse_count,
+                        evaluated_verse_indices);
+                    matching_verse_indices = Union(matching_verse_indices, child_postings);
+                }
+                return matching_verse_indices;
+            }
+            case NodeType::AND:
+            {
+                // GET THE VERSES FOR EACH CHILD NODE.
+                // Negated child nodes are kept separate so that their verses can be subtracted
+                // rather than computing the (usually huge) complement of their verses.
+                std::vector<BibleWordIndex::PostingCursor> required_postings;
+                std::vector<BibleWordIndex::PostingCursor> excluded_postings;
+                for (const std::size_t child_node_index : node.ChildNodeIndices)
+                {
+                    const Node& child_node = Nodes[child_node_index];
+                    bool child_negated = (NodeType::NOT == child_node.Type);
+                    if (child_negated)
+                    {
+                        BibleWordIndex::PostingCursor child_postings = GetNodePostings(
+                            word_index,
+                            child_node.ChildNodeIndices.front(),
+                            verse_count,
+                            evaluated_verse_indices);
+                        excluded_postings.push_back(child_postings);
+                    }
+                    else
+                    {
+                        BibleWordIndex::PostingCursor child_postings = GetNodePostings(
+                            word_index,
+                            child_node_index,
+                            verse_count,
+                            evaluated_verse_indices);
+                        required_postings.push_back(child_postings);
+                    }
+                }
+
+                // INTERSECT THE REQUIRED VERSES.
+                // Starting with the smallest lists keeps intermediate results (and searches through larger lists) small.
+                std::vector<BibleWordIndex::VerseIndex> matching_verse_indices;
+                bool required_verses_exist = !required_postings.empty();
+                if (required_verses_exist)
+                {
+                    std::sort(
+                        required_postings.begin(),
+                        required_postings.end(),
+                        [](const BibleWordIndex::PostingCursor& left, const BibleWordIndex::PostingCursor& right)
+                        {
+                            return left.PostingCount() < right.PostingCount();
+                        });
+                    matching_verse_indices = RemoveDuplicates(required_postings.front());
+                    for (std::size_t required_index = 1; required_index < required_postings.size(); ++required_index)
+                    {
+                        bool matching_verses_remain = !matching_verse_indices.empty();
+                        if (!matching_verses_remain)
+                        {
+                            break;
+                        }
+
+                        matching_verse_indices = Intersect(matching_verse_indices, required_postings[required_index]);
+                    }
+                }
+                else
+                {
+                    // Only excluded verses were specified, so all other verses match.
+                    BibleWordIndex::PostingCursor no_postings;
+                    matching_verse_indices = Complement(no_postings, verse_count);
+                }
+
+                // REMOVE ANY EXCLUDED VERSES.
+                for (const BibleWordIndex::PostingCursor& postings_to_remove : excluded_postings)
+                {
+                    matching_verse_indices = Subtract(matching_verse_indices, postings_to_remove);
+                }
+
+                return matching_verse_indices;
+            }
+        }
+
+        return {};
+    }
+
+    /// Gets the verses for a node for use as an operand in a parent node.
+    /// @param[in]  word_index - The word index for the translation to search.
+    /// @param[in]  node_index - The index of the node to get verses for.
+    /// @param[in]  verse_count - The total number of verses in the translation.
+    /// @param[in,out]  evaluated_verse_indices - Storage for verses of non-word nodes.  Must have space
+    ///     reserved for all nodes to be added so that previously returned verses are not moved.
+    /// @return A cursor at the start of the verses for the node, in increasing order.  For word nodes, this walks
+    ///     through the word's posting list (without copying or fully decoding it), which may contain duplicate verses.
+    BibleWordIndex::PostingCursor BibleWordQuery::GetNodePostings(
+        const BibleWordIndex& word_index,
+        const std::size_t node_index,
+        const std::size_t verse_count,
+        std::vector<std::vector<BibleWordIndex::VerseIndex>>& evaluated_verse_indices) const
+    {
+        // EVALUATE NON-WORD NODES.
+        const Node& node = Nodes[node_index];
+        bool is_word = (NodeType::WORD == node.Type);
+        if (!is_word)
+        {
+            evaluated_verse_indices.emplace_back(EvaluateNode(word_index, node_index, verse_count));
+            return BibleWordIndex::PostingCursor::FromVerseIndices(evaluated_verse_indices.back());
+        }
+
+        // USE THE POSTING LIST FOR ANY WORD IN THE INDEX.
+        std::optional<std::size_t> word_index_in_lexicon = word_index.FindWord(node.NormalizedWord);
+        if (!word_index_in_lexicon)
+        {
+            return {};
+        }
+        return word_index.GetPostingCursor(*word_index_in_lexicon);
+    }
+
+    /// Removes duplicate verses.
+    /// @param[in]  postings - A cursor at the start of the postings to remove duplicates from.
+    /// @return The verse indices without duplicates, in increasing order.
+    std::vector<BibleWordIndex::VerseIndex> BibleWordQuery::RemoveDuplicates(BibleWordIndex::PostingCursor postings)
+    {
+        std::vector<BibleWordIndex::VerseIndex> unique_verse_indices;
+        unique_verse_indices.reserve(postings.PostingCount());
+        while (!postings.AtEnd())
+        {
+            BibleWordIndex::VerseIndex verse_index = postings.CurrentVerseIndex();
+            unique_verse_indices.push_back(verse_index);
+            postings.SkipToVerse(static_cast<std::size_t>(verse_index) + 1);
+        }
+        return unique_verse_indices;
+    }
+
+    /// Finds verses in both sets of verses.
+    /// The larger set is skipped ahead to each verse in the smaller set (galloping within blocks and
+    /// passing over entire compressed blocks), so this takes time proportional to the smaller set
+    /// (times a logarithmic factor).
+    /// @param[in]  smaller_verse_indices - The (ideally) smaller set of verse indices, in increasing order.
+    /// @param[in]  larger_postings - A cursor at the start of the (ideally) larger set of verses.
+    /// @return The verse indices in both sets, in increasing order without duplicates.
+    std::vector<BibleWordIndex::VerseIndex> BibleWordQuery::Intersect(
+        const std::span<const BibleWordIndex::VerseIndex> smaller_verse_indices,
+        BibleWordIndex::PostingCursor larger_postings)
+    {
+        std::vector<BibleWordIndex::VerseIndex> intersected_verse_indices;
+        for (std::size_t smaller_posting_index = 0; smaller_posting_index < smaller_verse_indices.size(); ++smaller_posting_index)
+        {
+            // SKIP DUPLICATE VERSES.
+            BibleWordIndex::VerseIndex verse_index = smaller_verse_indices[smaller_posting_index];
+            bool duplicate_verse = (smaller_posting_index > 0) && (smaller_verse_indices[smaller_posting_index - 1] == verse_index);
+            if (duplicate_verse)
+            {
+                continue;
+            }
+
+            // SEARCH FOR THE VERSE IN THE LARGER SET.
+            larger_postings.SkipToVerse(verse_index);
+            if (larger_postings.AtEnd())
+            {
+                break;
+            }
+
+            bool verse_in_both_sets = (larger_postings.CurrentVerseIndex() == verse_index);
+            if (verse_in_both_sets)
+            {
+                intersected_verse_indices.push_back(verse_index);
+            }
+        }
+
+        return intersected_verse_indices;
+    }
+
+    /// Finds verses in either set of verses.
+    /// @param[in]  first_verse_indices - The first set of verse indices, in increasing order.
+    /// @param[in]  second_postings - A cursor at the start of the second set of verses.
+    /// @return The verse indices in either set, in increasing order without duplicates.
+    std::vector<BibleWordIndex::VerseIndex> BibleWordQuery::Union(
+        const std::span<const BibleWordIndex::VerseIndex> first_verse_indices,
+        BibleWordIndex::PostingCursor second_postings)
+    {
+        std::vector<BibleWordIndex::VerseIndex> combined_verse_indices;
+        combined_verse_indices.reserve(first_verse_indices.size() + second_postings.PostingCount());
+        std::size_t first_posting_index = 0;
+        while ((first_posting_index < first_verse_indices.size()) || !second_postings.AtEnd())
+        {
+            // TAKE THE EARLIEST VERSE FROM EITHER SET.
+            BibleWordIndex::VerseIndex verse_index = 0;
+            bool first_verses_remain = (first_posting_index < first_verse_indices.size());
+            bool second_verses_remain = !second_postings.AtEnd();
+            bool take_from_first = first_verses_remain && (!second_verses_remain || first_verse_indices[first_posting_index] <= second_postings.CurrentVerseIndex());
+            if (take_from_first)
+            {
+                verse_index = first_verse_indices[first_posting_index];
+                ++first_posting_index;
+            }
+            else
+            {
+                verse_index = second_postings.CurrentVerseIndex();
+                second_postings.MoveToNextPosting();
+            }
+
+            // ONLY ADD THE VERSE IF NOT ALREADY ADDED.
+            bool duplicate_verse = !combined_verse_indices.empty() && (combined_verse_indices.back() == verse_index);
+            if (!duplicate_verse)
+            {
+                combined_verse_indices.push_back(verse_index);
+            }
+        }
+
+        return combined_verse_indices;
+    }
+
+    /// Finds verses in one set of verses but not another.
+    /// @param[in]  verse_indices - The set of verse indices to remove verses from, in increasing order.
+    /// @param[in]  postings_to_remove - A cursor at the start of the set of verses to remove.
+    /// @return The remaining verse indices, in increasing order without duplicates.
+    std::vector<BibleWordIndex::VerseIndex> BibleWordQuery::Subtract(
+        const std::span<const BibleWordIndex::VerseIndex> verse_indices,
+        BibleWordIndex::PostingCursor postings_to_remove)
+    {
+        std::vector<BibleWordIndex::VerseIndex> remaining_verse_indices;
+        for (std::size_t posting_index = 0; posting_index < verse_indices.size(); ++posting_index)
+        {
+            // SKIP DUPLICATE VERSES.
+            BibleWordIndex::VerseIndex verse_index = verse_indices[posting_index];
+            bool duplicate_verse = (posting_index > 0) && (verse_indices[posting_index - 1] == verse_index);
+            if (duplicate_verse)
+            {
+                continue;
+            }
+
+            // ONLY KEEP THE VERSE IF IT'S NOT BEING REMOVED.
+            postings_to_remove.SkipToVerse(verse_index);
+            bool verse_removed = !postings_to_remove.AtEnd() && (postings_to_remove.CurrentVerseIndex() == verse_index);
+            if (!verse_removed)
+            {
+                remaining_verse_indices.push_back(verse_index);
+            }
+        }
+
+        return remaining_verse_indices;
+    }
+
+    /// Finds all verses not in a set of verses.
+    /// @param[in]  postings - A cursor at the start of the set of verses to exclude.
+    /// @param[in]  verse_count - The total number of verses in the translation.
+    /// @return The indices of all other verses, in increasing order.
+    std::vector<BibleWordIndex::VerseIndex> BibleWordQuery::Complement(
+        BibleWordIndex::PostingCursor postings,
+        const std::size_t verse_count)
+    {
+        std::vector<BibleWordIndex::VerseIndex> other_verse_indices;
+        for (std::size_t verse_index = 0; verse_index < verse_count; ++verse_index)
+        {
+            // SKIP PAST ANY EARLIER OR DUPLICATE VERSES IN THE SET.
+            postings.SkipToVerse(verse_index);
+
+            bool verse_in_set = !postings.AtEnd() && (postings.CurrentVerseIndex() == verse_index);
+            if (!verse_in_set)
+            {
+                other_verse_indices.push_back(static_cast<BibleWordIndex::VerseIndex>(verse_index));
+            }
+        }
+
+        return other_verse_indices;
+    }
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "BibleData/BibleVerseSet.h"
+#include "BibleData/BibleWordIndex.h"
+
+namespace BIBLE_DATA
+{
+    /// A boolean query for verses containing combinations of words, such as "faith AND works NOT law".
+    ///
+    /// The following syntax is supported, from highest to lowest precedence:
+    /// - Words, which are normalized the same way as for the word index (lowercase and root words).
+    /// - Parentheses for grouping.
+    /// - NOT for excluding verses (both "NOT law" and "works NOT law" are allowed).
+    /// - AND for requiring multiple words.  Words next to each other without an operator are also treated as AND.
+    /// - OR for allowing any of multiple words.
+    /// Operators must be uppercase so that lowercase "and", "or", and "not" can still be searched for as words.
+    ///
+    /// Queries are evaluated directly on sorted posting lists in the word index (through posting cursors,
+    /// so compressed postings are only decoded as needed), intersecting by skipping ahead through
+    /// larger lists so that a rare word combined with common words stays fast.
+    class BibleWordQuery
+    {
+    public:
+        static std::optional<BibleWordQuery> Parse(const std::string_view query_text);
+
+        BibleVerseSet Evaluate(const BibleWordIndex& word_index) const;
+
+    private:
+        /// The different kinds of tokens in query text.
+        enum class QueryTokenType
+        {
+            /// A word to search for.
+            WORD,
+            /// The AND operator.
+            AND,
+            /// The OR operator.
+            OR,
+            /// The NOT operator.
+            NOT,
+            /// An opening parenthesis.
+            OPEN_PARENTHESIS,
+            /// A closing parenthesis.
+            CLOSE_PARENTHESIS,
+        };
+
+        /// A single token in query text.
+        struct QueryToken
+        {
+            /// The type of token.
+            QueryTokenType Type = QueryTokenType::WORD;
+            /// The text of the token.
+            std::string_view Text = "";
+        };
+
+        /// The different kinds of nodes in a parsed query.
+        enum class NodeType
+        {
+            /// Verses containing a word.
+            WORD,
+            /// Verses matching all child nodes.
+            AND,
+            /// Verses matching any child node.
+            OR,
+            /// Verses not matching the single child node.
+            NOT,
+        };
+
+        /// A single node in a parsed query.
+        struct Node
+        {
+            /// The type of node.
+            NodeType Type = NodeType::WORD;
+            /// The normalized word for word nodes.
+            std::string NormalizedWord = "";
+            /// Indices of child nodes in BibleWordQuery::Nodes for operator nodes.
+            std::vector<std::size_t> ChildNodeIndices = {};
+        };
+
+        static std::vector<QueryToken> Tokenize(const std::string_view query_text);
+        std::optional<std::size_t> ParseOrExpression(const std::vector<QueryToken>& tokens, std::size_t& token_index);
+        std::optional<std::size_t> ParseAndExpression(const std::vector<QueryToken>& tokens, std::size_t& token_index);
+        std::optional<std::size_t> ParseUnaryExpression(const std::vector<QueryToken>& tokens, std::size_t& token_index);
+        std::size_t AddNode(Node&& node);
+
+        std::vector<BibleWordIndex::VerseIndex> EvaluateNode(
+            const BibleWordIndex& word_index,
+            const std::size_t node_index,
+            const std::size_t verse_count) const;
+        BibleWordIndex::PostingCursor GetNodePostings(
+            const BibleWordIndex& word_index,
+            const std::size_t node_index,
+            const std::size_t verse_count,
+            std::vector<std::vector<BibleWordIndex::VerseIndex>>& evaluated_verse_indices) const;
+
+        static std::vector<BibleWordIndex::VerseIndex> RemoveDuplicates(BibleWordIndex::PostingCursor postings);
+        static std::vector<BibleWordIndex::VerseIndex> Intersect(
+            const std::span<const BibleWordIndex::VerseIndex> smaller_verse_indices,
+            BibleWordIndex::PostingCursor larger_postings);
+        static std::vector<BibleWordIndex::VerseIndex> Union(
+            const std::span<const BibleWordIndex::VerseIndex> first_verse_indices,
+            BibleWordIndex::PostingCursor second_postings);
+        static std::vector<BibleWordIndex::VerseIndex> Subtract(
+            const std::span<const BibleWordIndex::VerseIndex> verse_indices,
+            BibleWordIndex::PostingCursor postings_to_remove);
+        static std::vector<BibleWordIndex::VerseIndex> Complement(
+            BibleWordIndex::PostingCursor postings,
+            const std::size_t verse_count);
+
+        /// All nodes in the parsed query.
+        std::vector<Node> Nodes = {};
+        /// The index of the root node in Nodes.
+        std::size_t RootNodeIndex = 0;
+    };
+}
@@ -0,0 +1,38 @@
+#include "BibleData/Bibles.h"
+
+namespace BIBLE_DATA
+{
+    /// Gets the memory used by all translations, broken down by translation and component.
+    /// @return The memory used by the Bibles.
+    MemoryUsageReport Bibles::MemoryUsage() const
+    {
+        // ESTIMATE THE OVERHEAD OF THE MAP'S NODES.
+        // The exact layout is implementation-specific, but nodes typically hold the key-value pair
+        // along with a next pointer and a cached hash, and each bucket holds a pointer.
+        using TranslationMap = std::unordered_map<std::string, BibleTranslation>;
+        constexpr std::size_t NODE_SIZE_IN_BYTES = sizeof(TranslationMap::value_type) + 2 * sizeof(void*);
+        std::size_t node_overhead_in_bytes = TranslationsByAbbreviatedName.bucket_count() * sizeof(void*);
+        for (const auto& [abbreviated_name, translation] : TranslationsByAbbreviatedName)
+        {
+            node_overhead_in_bytes += NODE_SIZE_IN_BYTES;
+
+            // Names short enough for the small string optimization don't allocate.
+            bool name_allocated = (abbreviated_name.capacity() > std::string().capacity());
+            if (name_allocated)
+            {
+                node_overhead_in_bytes += abbreviated_name.capacity() + 1;
+            }
+        }
+
+        MemoryUsageReport memory_usage;
+        memory_usage.Add("Node overhead", node_overhead_in_bytes);
+
+        // ADD EACH TRANSLATION.
+        for (const auto& [abbreviated_name, translation] : TranslationsByAbbreviatedName)
+        {
+            memory_usage.Add(abbreviated_name, translation.MemoryUsage());
+        }
+
+        return memory_usage;
+    }
+}
@@ -3,6 +3,7 @@
 #include <string>
 #include <unordered_map>
 #include "BibleData/BibleTranslation.h"
+#include "BibleData/MemoryUsageReport.h"
 
 namespace BIBLE_DATA
 {
@@ -11,6 +12,8 @@ namespace BIBLE_DATA
     class Bibles
     {
     public:
+        MemoryUsageReport MemoryUsage() const;
+
         /// Bible translations mapped by abbreviated name.
         std::unordered_map<std::string, BibleTranslation> TranslationsByAbbreviatedName = {};
     };
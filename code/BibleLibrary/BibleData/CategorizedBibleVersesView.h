@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include "BibleData/BibleVerseId.h"
+#include "BibleData/BibleVersesView.h"
+
+namespace BIBLE_DATA
+{
+    /// A view of Bible verse search results categorized based on proximity to some original verse
+    /// (see CategorizedBibleVerseSearchResults for details on the categories).
+    /// The verses in all categories view separate subranges of a single buffer of verse indices,
+    /// so getting results requires no allocations per verse, and copying results is cheap.
+    struct CategorizedBibleVersesView
+    {
+        /// The word searched for to produce the results.
+        std::string SearchedWord = "";
+        /// The ID of the original Bible verse from which results were searched for.
+        BibleVerseId OriginalVerseId = {};
+        /// Verses in the same chapter as the original verse.
+        BibleVersesView VersesInSameChapter = {};
+        /// Verses in the same book (but not same chapter) as the original verse.
+        BibleVersesView VersesInSameBook = {};
+        /// Verses in the other books by the same author as the original verse.
+        BibleVersesView VersesInOtherBooksByAuthor = {};
+        /// Verses in other books by other authors of the same genre in the same testament.
+        BibleVersesView VersesInBooksOfSameGenreByOtherAuthorsInSameTestament = {};
+        /// Verses from the same testament that do not fit into one of the more specific categories above.
+        BibleVersesView VersesElsewhereInSameTestament = {};
+        /// Verses from the other testament.
+        BibleVersesView VersesFromOtherTestament = {};
+    };
+}
@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "BibleData/CategorizedSearchResultCache.h"
+
+namespace BIBLE_DATA
+{
+    /// Creates a key for search results.
+    /// @param[in]  translation_name - The abbreviated name of the translation searched.
+    /// @param[in]  verse_id - The ID of the original verse from which results were searched for.
+    /// @param[in]  word - The word searched for.  It's normalized the same way as for searching.
+    /// @param[in]  match_type - How the word was matched against words in the translation.
+    /// @param[in]  sorted_by_relevance - True if the results were sorted by relevance; false if in canonical order.
+    /// @return The key for the search results.
+    CategorizedSearchResultCache::Key CategorizedSearchResultCache::Key::Create(
+        const std::string_view translation_name,
+        const BibleVerseId& verse_id,
+        const std::string_view word,
+        const BibleWordIndex::WordMatchType match_type,
+        const bool sorted_by_relevance)
+    {
+        // NORMALIZE THE WORD BASED ON HOW IT'S MATCHED.
+        // Exact matching distinguishes between words with the same root word, so only case is ignored.
+        std::string normalized_word;
+        if (BibleWordIndex::WordMatchType::EXACT == match_type)
+        {
+            normalized_word.resize(word.size());
+            std::transform(
+                word.cbegin(),
+                word.cend(),
+                normalized_word.begin(),
+                [](const char character)
+                {
+                    return static_cast<char>(std::tolower(static_cast<int>(character)));
+                });
+        }
+        else
+        {
+            BibleWordIndex::WordNormalizationBuffer word_normalization_buffer;
+            normalized_word = BibleWordIndex::NormalizeWord(word, word_normalization_buffer);
+        }
+
+        Key key =
+        {
+            .TranslationName = std::string(translation_name),
+            .VerseId = verse_id,
+            .NormalizedWord = normalized_word,
+            .MatchType = match_type,
+            .SortedByRelevance = sorted_by_relevance,
+        };
+        return key;
+    }
+
+    /// Hashes a cache key.
+    /// @param[in]  key - The key to hash.
+    /// @return The hash of the key.
+    std::size_t CategorizedSearchResultCache::KeyHash::operator()(const Key& key) const
+    {
+        // COMBINE THE HASHES OF ALL PARTS OF THE KEY.
+        // The verse ID and other small values are packed together since they easily fit in a single value.
+        std::size_t translation_name_hash = std::hash<std::string>{}(key.TranslationName);
+        std::size_t normalized_word_hash = std::hash<std::string>{}(key.NormalizedWord);
+        std::size_t packed_values = (
+            (static_cast<std::size_t>(key.VerseId.Book) << 32) |
+            (static_cast<std::size_t>(key.VerseId.ChapterNumber) << 16) |
+            (static_cast<std::size_t>(key.VerseId.VerseNumber) << 4) |
+            (static_cast<std::size_t>(key.MatchType) << 1) |
+            static_cast<std::size_t>(key.SortedByRelevance));
+        std::size_t packed_values_hash = std::hash<std::size_t>{}(packed_values);
+
+        constexpr std::size_t HASH_COMBINING_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+        std::size_t hash = translation_name_hash;
+        hash = (hash * HASH_COMBINING_MULTIPLIER) ^ normalized_word_hash;
+        hash = (hash * HASH_COMBINING_MULTIPLIER) ^ packed_values_hash;
+        return hash;
+    }
+
+    /// Creates an empty cache.
+    /// @param[in]  memory_budget_in_bytes - The maximum number of bytes to use for cached results.
+    CategorizedSearchResultCache::CategorizedSearchResultCache(const std::size_t memory_budget_in_bytes) :
+        MemoryBudgetInBytes(memory_budget_in_bytes)
+    {}
+
+    /// Copies a cache.  Keys must be mapped to the copied entries since iterators only refer to entries in the original cache.
+    /// @param[in]  other - The cache to copy.
+    CategorizedSearchResultCache::CategorizedSearchResultCache(const CategorizedSearchResultCache& other) :
+        MemoryBudgetInBytes(other.MemoryBudgetInBytes),
+        UsedMemoryInBytes(other.UsedMemoryInBytes),
+        HitCount(other.HitCount),
+        MissCount(other.MissCount),
+        EvictionCount(other.EvictionCount),
+        EntriesByRecentUse(other.EntriesByRecentUse)
+    {
+        for (auto entry = EntriesByRecentUse.begin(); EntriesByRecentUse.end() != entry; ++entry)
+        {
+            EntriesByKey[entry->CacheKey] = entry;
+        }
+    }
+
+    /// Copies a cache.
+    /// @param[in]  other - The cache to copy.
+    /// @return This cache.
+    CategorizedSearchResultCache& CategorizedSearchResultCache::operator=(const CategorizedSearchResultCache& other)
+    {
+        if (this != &other)
+        {
+            CategorizedSearchResultCache copied_cache(other);
+            *this = std::move(copied_cache);
+        }
+        return *this;
+    }
+
+    /// Finds cached results, marking them as the most recently used if found.
+    /// @param[in]  key - The key of the results to find.
+    /// @return The cached results, if found; null otherwise.  Only valid until the cache is next modified.
+    const CategorizedBibleVersesView* CategorizedSearchResultCache::Find(const Key& key)
+    {
+        // CHECK IF THE RESULTS ARE CACHED.
+        auto key_with_entry = EntriesByKey.find(key);
+        if (EntriesByKey.end() == key_with_entry)
+        {
+            ++MissCount;
+            return nullptr;
+        }
+
+        // MARK THE RESULTS AS THE MOST RECENTLY USED.
+        // Splicing just relinks the list node, so the entry's iterator remains valid.
+        ++HitCount;
+        std::list<Entry>::iterator entry = key_with_entry->second;
+        EntriesByRecentUse.splice(EntriesByRecentUse.begin(), EntriesByRecentUse, entry);
+        return &entry->SearchResults;
+    }
+
+    /// Adds results to the cache as the most recently used, evicting the least recently used results
+    /// if needed to stay within the memory budget.  Results too large for the memory budget aren't cached.
+    /// @param[in]  key - The key of the results.  Any existing results for the key are replaced.
+    /// @param[in]  search_results - The results to cache.
+    void CategorizedSearchResultCache::Insert(const Key& key, const CategorizedBibleVersesView& search_results)
+    {
+        // REMOVE ANY EXISTING RESULTS FOR THE KEY.
+        auto key_with_existing_entry = EntriesByKey.find(key);
+        if (EntriesByKey.end() != key_with_existing_entry)
+        {
+            UsedMemoryInBytes -= key_with_existing_entry->second->SizeInBytes;
+            EntriesByRecentUse.erase(key_with_existing_entry->second);
+            EntriesByKey.erase(key_with_existing_entry);
+        }
+
+        // MAKE SURE THE RESULTS FIT WITHIN THE CACHE.
+        Entry new_entry =
+        {
+            .CacheKey = key,
+            .SearchResults = search_results,
+        };
+        new_entry.SizeInBytes = EstimateSizeInBytes(new_entry);
+        if (new_entry.SizeInBytes > MemoryBudgetInBytes)
+        {
+            return;
+        }
+
+        // EVICT THE LEAST RECENTLY USED RESULTS UNTIL THE NEW RESULTS FIT.
+        while (UsedMemoryInBytes + new_entry.SizeInBytes > MemoryBudgetInBytes)
+        {
+            const Entry& least_recently_used_entry = EntriesByRecentUse.back();
+            UsedMemoryInBytes -= least_recently_used_entry.SizeInBytes;
+            EntriesByKey.erase(least_recently_used_entry.CacheKey);
+            EntriesByRecentUse.pop_back();
+            ++EvictionCount;
+        }
+
+        // ADD THE NEW RESULTS AS THE MOST RECENTLY USED.
+        UsedMemoryInBytes += new_entry.SizeInBytes;
+        EntriesByRecentUse.push_front(std::move(new_entry));
+        EntriesByKey[key] = EntriesByRecentUse.begin();
+    }
+
+    /// Removes all cached results.  Hit and miss counts are preserved.
+    void CategorizedSearchResultCache::Clear()
+    {
+        EntriesByRecentUse.clear();
+        EntriesByKey.clear();
+        UsedMemoryInBytes = 0;
+    }
+
+    /// Gets the fraction of lookups that found cached results.
+    /// @return The hit rate from 0 to 1 (0 if nothing has been looked up yet).
+    double CategorizedSearchResultCache::HitRate() const
+    {
+        std::size_t lookup_count = HitCount + MissCount;
+        if (0 == lookup_count)
+        {
+            return 0.0;
+        }
+
+        double hit_rate = static_cast<double>(HitCount) / static_cast<double>(lookup_count);
+        return hit_rate;
+    }
+
+    /// Gets the memory used by the cache, broken down by component.
+    /// @return The memory used by the cache.
+    MemoryUsageReport CategorizedSearchResultCache::MemoryUsage() const
+    {
+        MemoryUsageReport memory_usage;
+        memory_usage.Add("Cached results", UsedMemoryInBytes);
+        memory_usage.Add("Key map buckets", EntriesByKey.bucket_count() * sizeof(void*));
+        return memory_usage;
+    }
+
+    /// Estimates the number of bytes used by a cache entry, including its nodes in the cache's containers.
+    /// @param[in]  entry - The entry to estimate the size of.
+    /// @return The estimated size of the entry.
+    std::size_t CategorizedSearchResultCache::EstimateSizeInBytes(const Entry& entry)
+    {
+        // ESTIMATE THE SIZE OF THE NODES HOLDING THE ENTRY.
+        // List nodes have previous and next pointers, and map nodes have a next pointer and a cached hash.
+        constexpr std::size_t LIST_NODE_SIZE_IN_BYTES = sizeof(Entry) + 2 * sizeof(void*);
+        constexpr std::size_t MAP_NODE_SIZE_IN_BYTES = sizeof(std::pair<const Key, std::list<Entry>::iterator>) + 2 * sizeof(void*);
+        std::size_t size_in_bytes = LIST_NODE_SIZE_IN_BYTES + MAP_NODE_SIZE_IN_BYTES;
+
+        // ADD THE STRINGS.
+        // The key is stored in both the list and map nodes.
+        size_in_bytes += 2 * (entry.CacheKey.TranslationName.capacity() + entry.CacheKey.NormalizedWord.capacity());
+        size_in_bytes += entry.SearchResults.SearchedWord.capacity();
+
+        // ADD THE VERSE INDICES.
+        // Categories typically view the same buffer (unless sorted separately), so each buffer is only counted once.
+        // Verses only view translation text, so the text itself isn't included.
+        const CategorizedBibleVersesView& search_results = entry.SearchResults;
+        const BibleVersesView* verse_categories[] =
+        {
+            &search_results.VersesInSameChapter,
+            &search_results.VersesInSameBook,
+            &search_results.VersesInOtherBooksByAuthor,
+            &search_results.VersesInBooksOfSameGenreByOtherAuthorsInSameTestament,
+            &search_results.VersesElsewhereInSameTestament,
+            &search_results.VersesFromOtherTestament,
+        };
+        std::vector<const std::vector<BibleVersesView::VerseIndex>*> counted_verse_index_buffers;
+        for (const BibleVersesView* verses : verse_categories)
+        {
+            const std::vector<BibleVersesView::VerseIndex>* verse_indices = verses->OwnedVerseIndices.get();
+            bool verse_indices_counted = (std::find(counted_verse_index_buffers.cbegin(), counted_verse_index_buffers.cend(), verse_indices) != counted_verse_index_buffers.cend());
+            if (verse_indices && !verse_indices_counted)
+            {
+                size_in_bytes += verse_indices->capacity() * sizeof(BibleVersesView::VerseIndex);
+                counted_verse_index_buffers.push_back(verse_indices);
+            }
+        }
+
+        return size_in_bytes;
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "BibleData/BibleVerseId.h"
+#include "BibleData/BibleWordIndex.h"
+#include "BibleData/CategorizedBibleVersesView.h"
+#include "BibleData/MemoryUsageReport.h"
+
+namespace BIBLE_DATA
+{
+    /// A cache of the most recently used categorized search results, so that returning to a word and verse
+    /// searched for recently (such as when switching between words or toggling translations) doesn't require searching again.
+    ///
+    /// The cache is bounded by a memory budget rather than a number of results since results for common words
+    /// are far larger than for rare words.  When the budget is exceeded, the least recently used results are evicted.
+    ///
+    /// The cache isn't thread-safe since even finding results updates which results were most recently used.
+    class CategorizedSearchResultCache
+    {
+    public:
+        /// The default memory budget, which holds thousands of results for typical words.
+        static constexpr std::size_t DEFAULT_MEMORY_BUDGET_IN_BYTES = 16 * 1024 * 1024;
+
+        /// Identifies a single set of search results.
+        struct Key
+        {
+            static Key Create(
+                const std::string_view translation_name,
+                const BibleVerseId& verse_id,
+                const std::string_view word,
+                const BibleWordIndex::WordMatchType match_type,
+                const bool sorted_by_relevance);
+
+            bool operator==(const Key& rhs) const = default;
+
+            /// The abbreviated name of the translation searched.
+            std::string TranslationName = "";
+            /// The ID of the original verse from which results were searched for.
+            BibleVerseId VerseId = {};
+            /// The word searched for, normalized so that different forms of a word with the same results share results.
+            std::string NormalizedWord = "";
+            /// How the word was matched against words in the translation.
+            BibleWordIndex::WordMatchType MatchType = BibleWordIndex::WordMatchType::ROOT_WORD;
+            /// True if the results were sorted by relevance; false if in canonical order.
+            bool SortedByRelevance = false;
+        };
+
+        CategorizedSearchResultCache() = default;
+        explicit CategorizedSearchResultCache(const std::size_t memory_budget_in_bytes);
+        CategorizedSearchResultCache(const CategorizedSearchResultCache& other);
+        CategorizedSearchResultCache(CategorizedSearchResultCache&& other) = default;
+        CategorizedSearchResultCache& operator=(const CategorizedSearchResultCache& other);
+        CategorizedSearchResultCache& operator=(CategorizedSearchResultCache&& other) = default;
+
+        const CategorizedBibleVersesView* Find(const Key& key);
+        void Insert(const Key& key, const CategorizedBibleVersesView& search_results);
+        void Clear();
+        double HitRate() const;
+        MemoryUsageReport MemoryUsage() const;
+
+        /// The maximum number of bytes to use for cached results.
+        std::size_t MemoryBudgetInBytes = DEFAULT_MEMORY_BUDGET_IN_BYTES;
+        /// The number of results currently using memory in the cache.
+        std::size_t UsedMemoryInBytes = 0;
+        /// The number of times results were found in the cache.
+        std::size_t HitCount = 0;
+        /// The number of times results weren't found in the cache.
+        std::size_t MissCount = 0;
+        /// The number of results evicted to stay within the memory budget.
+        std::size_t EvictionCount = 0;
+
+    private:
+        /// A hash for cache keys.
+        struct KeyHash
+        {
+            std::size_t operator()(const Key& key) const;
+        };
+
+        /// A single set of cached results.
+        struct Entry
+        {
+            /// The key identifying the results.
+            Key CacheKey = {};
+            /// The cached results.
+            CategorizedBibleVersesView SearchResults = {};
+            /// The estimated number of bytes used by the entry.
+            std::size_t SizeInBytes = 0;
+        };
+
+        static std::size_t EstimateSizeInBytes(const Entry& entry);
+
+        /// Cached results ordered from most recently used (front) to least recently used (back).
+        std::list<Entry> EntriesByRecentUse = {};
+        /// Iterators to cached results in EntriesByRecentUse, for finding results by key.
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> EntriesByKey = {};
+    };
+}
@@ -0,0 +1,291 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include "BibleData/CompressedPostingLists.h"
+
+// SSSE3 is needed for the byte shuffle used to decode a group at once.  x64 only guarantees SSE2,
+// so the SSSE3 decoder is compiled for all x64 builds but only used if the processor supports SSSE3
+// (see ProcessorSupportsSsse3()), with a scalar decoder used otherwise.
+#if defined(_M_X64) || defined(__x86_64__)
+#define COMPRESSED_POSTING_LISTS_SSSE3_AVAILABLE 1
+#include <tmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define COMPRESSED_POSTING_LISTS_SSSE3_AVAILABLE 0
+#endif
+
+// MSVC allows SSSE3 intrinsics in any function, but GCC and Clang only allow them in functions targeting SSSE3
+// (unless the entire build targets SSSE3).
+#if defined(__GNUC__)
+#define COMPRESSED_POSTING_LISTS_SSSE3_FUNCTION __attribute__((target("ssse3")))
+#else
+#define COMPRESSED_POSTING_LISTS_SSSE3_FUNCTION
+#endif
+
+namespace BIBLE_DATA
+{
+    /// Shuffle masks for decoding a group of differences with a single byte shuffle, by control byte.
+    /// Each pair of bytes in a mask selects the low and high bytes of a difference (0x80 for a high byte of 0).
+    static constexpr auto GROUP_SHUFFLE_MASKS_BY_CONTROL_BYTE = []()
+    {
+        std::array<std::array<std::uint8_t, CompressedPostingLists::GROUP_READ_SIZE_IN_BYTES>, 256> shuffle_masks = {};
+        for (std::size_t control_byte = 0; control_byte < shuffle_masks.size(); ++control_byte)
+        {
+            std::uint8_t encoded_byte_index = 0;
+            for (std::size_t posting_index_in_group = 0; posting_index_in_group < CompressedPostingLists::POSTINGS_PER_GROUP; ++posting_index_in_group)
+            {
+                constexpr std::uint8_t ZERO_BYTE = 0x80;
+                bool two_byte_difference = (control_byte >> posting_index_in_group) & 1;
+                shuffle_masks[control_byte][2 * posting_index_in_group] = encoded_byte_index++;
+                shuffle_masks[control_byte][2 * posting_index_in_group + 1] = two_byte_difference ? encoded_byte_index++ : ZERO_BYTE;
+            }
+        }
+        return shuffle_masks;
+    }();
+
+    /// Decodes a single group of verse index differences without any SIMD instructions.
+    /// @param[in]  control_byte - The control byte for the group.
+    /// @param[in]  encoded_differences - The encoded differences following the control byte.
+    /// @param[in]  previous_verse_index - The verse index before the group.
+    /// @param[out] verse_indices - The location to write all 8 decoded verse indices to.
+    ///     Verse indices past the end of a partial group are garbage.
+    static void DecodeGroupWithoutSimd(
+        const std::uint8_t control_byte,
+        const std::uint8_t* const encoded_differences,
+        const CompressedPostingLists::VerseIndex previous_verse_index,
+        CompressedPostingLists::VerseIndex* const verse_indices)
+    {
+        // SUM EACH DIFFERENCE WITH THE PREVIOUS VERSE INDEX.
+        CompressedPostingLists::VerseIndex verse_index = previous_verse_index;
+        const std::uint8_t* current_encoded_difference = encoded_differences;
+        for (std::size_t posting_index_in_group = 0; posting_index_in_group < CompressedPostingLists::POSTINGS_PER_GROUP; ++posting_index_in_group)
+        {
+            std::uint16_t difference = *current_encoded_difference++;
+            bool two_byte_difference = (control_byte >> posting_index_in_group) & 1;
+            if (two_byte_difference)
+            {
+                difference |= static_cast<std::uint16_t>(*current_encoded_difference++ << 8);
+            }
+
+            verse_index = static_cast<CompressedPostingLists::VerseIndex>(verse_index + difference);
+            verse_indices[posting_index_in_group] = verse_index;
+        }
+    }
+
+#if COMPRESSED_POSTING_LISTS_SSSE3_AVAILABLE
+    /// Checks if the processor supports SSSE3 instructions.
+    /// The processor is only queried once since support can't change while running.  This is checked on first use
+    /// rather than during static initialization so that it's valid even when decoding during other static initialization.
+    /// @return True if SSSE3 is supported; false otherwise.
+    static bool ProcessorSupportsSsse3()
+    {
+        static const bool ssse3_supported = []()
+        {
+#if defined(_MSC_VER)
+            // SSSE3 support is indicated by bit 9 of ECX for CPUID function 1.
+            constexpr int PROCESSOR_FEATURES_CPUID_FUNCTION = 1;
+            constexpr int ECX_REGISTER_INDEX = 2;
+            constexpr int SSSE3_BIT = 1 << 9;
+            int cpu_info[4] = {};
+            __cpuid(cpu_info, PROCESSOR_FEATURES_CPUID_FUNCTION);
+            return (0 != (cpu_info[ECX_REGISTER_INDEX] & SSSE3_BIT));
+#else
+            __builtin_cpu_init();
+            return (0 != __builtin_cpu_supports("ssse3"));
+#endif
+        }();
+        return ssse3_supported;
+    }
+
+    /// Decodes a single group of verse index differences with SSSE3 instructions.
+    /// Must only be called if ProcessorSupportsSsse3().
+    /// @param[in]  control_byte - The control byte for the group.
+    /// @param[in]  encoded_differences - The encoded differences following the control byte.
+    ///     At least GROUP_READ_SIZE_IN_BYTES must be readable.
+    /// @param[in]  previous_verse_index - The verse index before the group.
+    /// @param[out] verse_indices - The location to write all 8 decoded verse indices to.
+    ///     Verse indices past the end of a partial group are garbage.
+    COMPRESSED_POSTING_LISTS_SSSE3_FUNCTION static void DecodeGroupWithSsse3(
+        const std::uint8_t control_byte,
+        const std::uint8_t* const encoded_differences,
+        const CompressedPostingLists::VerseIndex previous_verse_index,
+        CompressedPostingLists::VerseIndex* const verse_indices)
+    {
+        // SPREAD THE DIFFERENCES INTO 16-BIT LANES.
+        __m128i encoded_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(encoded_differences));
+        __m128i shuffle_mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(GROUP_SHUFFLE_MASKS_BY_CONTROL_BYTE[control_byte].data()));
+        __m128i differences = _mm_shuffle_epi8(encoded_bytes, shuffle_mask);
+
+        // SUM THE DIFFERENCES TO GET VERSE INDICES.
+        // Each lane gets the sum of all lanes before it in 3 shifted additions.
+        differences = _mm_add_epi16(differences, _mm_slli_si128(differences, 2));
+        differences = _mm_add_epi16(differences, _mm_slli_si128(differences, 4));
+        differences = _mm_add_epi16(differences, _mm_slli_si128(differences, 8));
+        __m128i decoded_verse_indices = _mm_add_epi16(differences, _mm_set1_epi16(static_cast<short>(previous_verse_index)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(verse_indices), decoded_verse_indices);
+    }
+#endif
+
+    /// Compresses posting lists.
+    /// @param[in]  posting_verse_indices - The verse indices for all postings (see BibleWordIndex::PostingVerseIndices).
+    /// @param[in]  posting_offsets - The offsets of each word's postings (see BibleWordIndex::PostingOffsets).
+    /// @return The compressed posting lists.
+    CompressedPostingLists::BuiltData CompressedPostingLists::Compress(
+        const std::span<const VerseIndex> posting_verse_indices,
+        const std::span<const std::uint32_t> posting_offsets)
+    {
+        BuiltData built_data;
+        std::size_t word_count = posting_offsets.empty() ? 0 : posting_offsets.size() - 1;
+        built_data.WordFirstBlockIndices.reserve(word_count + 1);
+        built_data.EncodedBytes.reserve(posting_verse_indices.size() + GROUP_READ_SIZE_IN_BYTES);
+        for (std::size_t word_index = 0; word_index < word_count; ++word_index)
+        {
+            // ENCODE EACH BLOCK OF THE WORD'S POSTINGS.
+            built_data.WordFirstBlockIndices.push_back(static_cast<std::uint32_t>(built_data.Blocks.size()));
+            std::span<const VerseIndex> verse_indices = posting_verse_indices.subspan(
+                posting_offsets[word_index],
+                posting_offsets[word_index + 1] - posting_offsets[word_index]);
+            for (std::size_t block_start_posting_index = 0; block_start_posting_index < verse_indices.size(); block_start_posting_index += POSTINGS_PER_BLOCK)
+            {
+                std::size_t block_posting_count = std::min(POSTINGS_PER_BLOCK, verse_indices.size() - block_start_posting_index);
+                std::span<const VerseIndex> block_verse_indices = verse_indices.subspan(block_start_posting_index, block_posting_count);
+                built_data.Blocks.push_back(Block
+                {
+                    .ByteOffset = static_cast<std::uint32_t>(built_data.EncodedBytes.size()),
+                    .LastVerseIndex = block_verse_indices.back(),
+                    .PostingCount = static_cast<std::uint16_t>(block_posting_count),
+                });
+                EncodeBlock(block_verse_indices, built_data.EncodedBytes);
+            }
+        }
+        built_data.WordFirstBlockIndices.push_back(static_cast<std::uint32_t>(built_data.Blocks.size()));
+
+        // PAD THE ENCODED BYTES FOR DECODING.
+        built_data.EncodedBytes.resize(built_data.EncodedBytes.size() + GROUP_READ_SIZE_IN_BYTES, 0);
+        built_data.EncodedBytes.shrink_to_fit();
+        built_data.Blocks.shrink_to_fit();
+        return built_data;
+    }
+
+    /// Determines if no posting lists are stored, meaning postings aren't compressed.
+    /// @return True if no posting lists are stored; false otherwise.
+    bool CompressedPostingLists::Empty() const
+    {
+        return WordFirstBlockIndices.empty();
+    }
+
+    /// Gets the total size of the compressed posting lists.
+    /// @return The size in bytes of all stored data.
+    std::size_t CompressedPostingLists::SizeInBytes() const
+    {
+        std::size_t size_in_bytes = WordFirstBlockIndices.size_bytes() + Blocks.size_bytes() + EncodedBytes.size_bytes();
+        return size_in_bytes;
+    }
+
+    /// Decodes all verse indices for a word.
+    /// @param[in]  word_index - The index of the word in the lexicon.
+    /// @param[out] verse_indices - The word's verse indices, one per occurrence in canonical order.
+    ///     Any previous contents are replaced, but the existing capacity is reused.
+    void CompressedPostingLists::DecodeVerseIndices(const std::size_t word_index, std::vector<VerseIndex>& verse_indices) const
+    {
+        // COUNT THE WORD'S POSTINGS.
+        // All blocks except the last one are full.
+        std::size_t first_block_index = WordFirstBlockIndices[word_index];
+        std::size_t end_block_index = WordFirstBlockIndices[word_index + 1];
+        if (first_block_index == end_block_index)
+        {
+            verse_indices.clear();
+            return;
+        }
+        std::size_t full_block_count = end_block_index - first_block_index - 1;
+        std::size_t posting_count = (full_block_count * POSTINGS_PER_BLOCK) + Blocks[end_block_index - 1].PostingCount;
+
+        // DECODE EACH BLOCK DIRECTLY INTO PLACE.
+        // Extra room is needed since the last group is decoded as a whole even if it's partial,
+        // and only the last block can be partial, so any garbage decoded past it is removed afterward.
+        verse_indices.resize(posting_count + POSTINGS_PER_GROUP);
+        for (std::size_t block_index = first_block_index; block_index < end_block_index; ++block_index)
+        {
+            std::size_t block_start_posting_index = (block_index - first_block_index) * POSTINGS_PER_BLOCK;
+            DecodeBlock(block_index, verse_indices.data() + block_start_posting_index);
+        }
+        verse_indices.resize(posting_count);
+    }
+
+    /// Decodes a single block of verse indices.
+    /// @param[in]  block_index - The index of the block in Blocks.
+    /// @param[out] verse_indices - The location to write the decoded verse indices to.
+    ///     Room must exist for the block's postings rounded up to a full group (see DECODED_BLOCK_CAPACITY).
+    void CompressedPostingLists::DecodeBlock(const std::size_t block_index, VerseIndex* const verse_indices) const
+    {
+        const Block& block = Blocks[block_index];
+        const std::uint8_t* current_encoded_byte = EncodedBytes.data() + block.ByteOffset;
+        VerseIndex previous_verse_index = 0;
+#if COMPRESSED_POSTING_LISTS_SSSE3_AVAILABLE
+        bool ssse3_supported = ProcessorSupportsSsse3();
+#endif
+        for (std::size_t group_start_index = 0; group_start_index < block.PostingCount; group_start_index += POSTINGS_PER_GROUP)
+        {
+            // DECODE THE GROUP.
+            std::uint8_t control_byte = *current_encoded_byte++;
+#if COMPRESSED_POSTING_LISTS_SSSE3_AVAILABLE
+            if (ssse3_supported)
+            {
+                DecodeGroupWithSsse3(control_byte, current_encoded_byte, previous_verse_index, verse_indices + group_start_index);
+            }
+            else
+#endif
+            {
+                DecodeGroupWithoutSimd(control_byte, current_encoded_byte, previous_verse_index, verse_indices + group_start_index);
+            }
+
+            // MOVE TO THE NEXT GROUP.
+            // Each difference takes 1 byte plus another for each bit set in the control byte.
+            // Only the last group may be partial, so its garbage verse indices are never used as a base.
+            std::size_t two_byte_difference_count = static_cast<std::size_t>(std::popcount(control_byte));
+            current_encoded_byte += POSTINGS_PER_GROUP + two_byte_difference_count;
+            previous_verse_index = verse_indices[group_start_index + POSTINGS_PER_GROUP - 1];
+        }
+    }
+
+    /// Encodes a single block of verse indices.
+    /// @param[in]  verse_indices - The sorted verse indices to encode.  At most POSTINGS_PER_BLOCK may be provided.
+    /// @param[in,out]  encoded_bytes - The bytes to append the encoded block to.
+    void CompressedPostingLists::EncodeBlock(const std::span<const VerseIndex> verse_indices, std::vector<std::uint8_t>& encoded_bytes)
+    {
+        assert(verse_indices.size() <= POSTINGS_PER_BLOCK);
+
+        // The first difference is from 0 so that the block can be decoded independently.
+        VerseIndex previous_verse_index = 0;
+        for (std::size_t group_start_index = 0; group_start_index < verse_indices.size(); group_start_index += POSTINGS_PER_GROUP)
+        {
+            // RESERVE SPACE FOR THE CONTROL BYTE.
+            std::size_t control_byte_offset = encoded_bytes.size();
+            encoded_bytes.push_back(0);
+
+            // ENCODE EACH DIFFERENCE IN THE GROUP.
+            // A partial group at the end of a block only has bytes for its actual differences.
+            std::uint8_t control_byte = 0;
+            std::size_t group_end_index = std::min(group_start_index + POSTINGS_PER_GROUP, verse_indices.size());
+            for (std::size_t posting_index = group_start_index; posting_index < group_end_index; ++posting_index)
+            {
+                std::uint16_t difference = static_cast<std::uint16_t>(verse_indices[posting_index] - previous_verse_index);
+                encoded_bytes.push_back(static_cast<std::uint8_t>(difference & 0xFF));
+
+                constexpr std::uint16_t MAX_ONE_BYTE_DIFFERENCE = 0xFF;
+                bool two_byte_difference = (difference > MAX_ONE_BYTE_DIFFERENCE);
+                if (two_byte_difference)
+                {
+                    encoded_bytes.push_back(static_cast<std::uint8_t>(difference >> 8));
+                    control_byte |= static_cast<std::uint8_t>(1 << (posting_index - group_start_index));
+                }
+
+                previous_verse_index = verse_indices[posting_index];
+            }
+            encoded_bytes[control_byte_offset] = control_byte;
+        }
+    }
+}
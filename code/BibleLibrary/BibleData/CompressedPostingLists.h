@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "BibleData/BibleVersesView.h"
+
+namespace BIBLE_DATA
+{
+    /// Posting lists (verse indices for each word) stored in a compressed form, for word indexes
+    /// where memory matters more than the small cost of decoding (see BibleWordIndex::CompressedPostings).
+    ///
+    /// Posting lists are sorted, so each verse index is stored as the difference from the previous one,
+    /// which usually fits in a single byte instead of two.  Differences are encoded in groups of 8
+    /// (similar to the StreamVByte format):  a control byte holds 1 bit per difference indicating
+    /// whether it takes 1 or 2 bytes, followed by the bytes for all 8 differences.  This allows
+    /// decoding an entire group at once with a single byte shuffle on processors supporting SSSE3.
+    ///
+    /// Groups are further divided into fixed-size blocks.  The first difference in each block is from 0,
+    /// so every block can be decoded independently, and the last verse index of each block is stored
+    /// so that intersections can skip to a verse without decoding the blocks before it.
+    ///
+    /// Like the rest of a word index, this only views its arrays so that they can be built at runtime,
+    /// precomputed into generated code files, or memory-mapped from a file.
+    class CompressedPostingLists
+    {
+    public:
+        /// An index of a verse within BibleTranslation::VerseCharacterRanges.
+        using VerseIndex = BibleVersesView::VerseIndex;
+
+        /// The number of postings whose verse index differences share a single control byte.
+        static constexpr std::size_t POSTINGS_PER_GROUP = 8;
+        /// The maximum number of postings in a single block.
+        static constexpr std::size_t POSTINGS_PER_BLOCK = 16 * POSTINGS_PER_GROUP;
+        /// The number of verse indices needed to decode a block, which includes room for an extra group
+        /// since groups are always decoded as a whole.
+        static constexpr std::size_t DECODED_BLOCK_CAPACITY = POSTINGS_PER_BLOCK + POSTINGS_PER_GROUP;
+        /// The number of bytes read at once when decoding a group.
+        /// The largest possible group (8 differences of 2 bytes each) fits within this.
+        static constexpr std::size_t GROUP_READ_SIZE_IN_BYTES = 16;
+
+        /// A block of consecutive postings for a single word.
+        struct Block
+        {
+            /// The offset of the block's first control byte in EncodedBytes.
+            std::uint32_t ByteOffset = 0;
+            /// The verse index of the last posting in the block.
+            VerseIndex LastVerseIndex = 0;
+            /// The number of postings in the block.
+            std::uint16_t PostingCount = 0;
+        };
+
+        /// Storage for compressed posting lists built at runtime (see Compress()).
+        struct BuiltData
+        {
+            /// See CompressedPostingLists::WordFirstBlockIndices.
+            std::vector<std::uint32_t> WordFirstBlockIndices = {};
+            /// See CompressedPostingLists::Blocks.
+            std::vector<Block> Blocks = {};
+            /// See CompressedPostingLists::EncodedBytes.
+            std::vector<std::uint8_t> EncodedBytes = {};
+        };
+
+        static BuiltData Compress(const std::span<const VerseIndex> posting_verse_indices, const std::span<const std::uint32_t> posting_offsets);
+
+        bool Empty() const;
+        std::size_t SizeInBytes() const;
+        void DecodeVerseIndices(const std::size_t word_index, std::vector<VerseIndex>& verse_indices) const;
+        void DecodeBlock(const std::size_t block_index, VerseIndex* const verse_indices) const;
+
+        /// The index in Blocks of the first block for each word, in the same order as the word index's lexicon.
+        /// An extra entry at the end holds the total number of blocks, so word N's blocks span [N, N + 1).
+        std::span<const std::uint32_t> WordFirstBlockIndices = {};
+        /// The blocks for all words.  Every block except the last one for a word is full.
+        std::span<const Block> Blocks = {};
+        /// The control bytes and verse index differences for all blocks.
+        /// Padding is included at the end so that groups can always be read GROUP_READ_SIZE_IN_BYTES at a time.
+        std::span<const std::uint8_t> EncodedBytes = {};
+
+    private:
+        static void EncodeBlock(const std::span<const VerseIndex> verse_indices, std::vector<std::uint8_t>& encoded_bytes);
+    };
+}
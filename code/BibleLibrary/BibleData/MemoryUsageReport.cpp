@@ -0,0 +1,35 @@
+#include "BibleData/MemoryUsageReport.h"
+
+namespace BIBLE_DATA
+{
+    /// Adds a component to the report.
+    /// @param[in]  component_name - The name of the component.
+    /// @param[in]  size_in_bytes - The number of bytes used by the component.
+    void MemoryUsageReport::Add(const std::string& component_name, const std::size_t size_in_bytes)
+    {
+        Components.push_back(Component{ .Name = component_name, .SizeInBytes = size_in_bytes });
+    }
+
+    /// Adds all components from another report as sub-components of a parent component.
+    /// @param[in]  parent_name - The name of the parent component to prefix the child components with.
+    /// @param[in]  child_report - The report with the components to add.
+    void MemoryUsageReport::Add(const std::string& parent_name, const MemoryUsageReport& child_report)
+    {
+        for (const Component& child_component : child_report.Components)
+        {
+            Add(parent_name + "/" + child_component.Name, child_component.SizeInBytes);
+        }
+    }
+
+    /// Gets the total number of bytes used by all components.
+    /// @return The total size of all components.
+    std::size_t MemoryUsageReport::TotalSizeInBytes() const
+    {
+        std::size_t total_size_in_bytes = 0;
+        for (const Component& component : Components)
+        {
+            total_size_in_bytes += component.SizeInBytes;
+        }
+        return total_size_in_bytes;
+    }
+}
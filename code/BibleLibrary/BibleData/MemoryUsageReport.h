@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace BIBLE_DATA
+{
+    /// A breakdown of the memory used by some data into its separate components, for seeing where memory goes.
+    /// Sizes cover memory in any storage the data views (heap allocations, data compiled into the program,
+    /// or memory-mapped files), and containers are counted by capacity since that's what's actually allocated.
+    class MemoryUsageReport
+    {
+    public:
+        /// The memory used by a single component.
+        struct Component
+        {
+            /// The name of the component.  Components from nested reports are prefixed with
+            /// the names of their parents (such as "KJV/Word index/Postings").
+            std::string Name = "";
+            /// The number of bytes used by the component.
+            std::size_t SizeInBytes = 0;
+        };
+
+        void Add(const std::string& component_name, const std::size_t size_in_bytes);
+        void Add(const std::string& parent_name, const MemoryUsageReport& child_report);
+        std::size_t TotalSizeInBytes() const;
+
+        /// The components, in the order they were added.
+        std::vector<Component> Components = {};
+    };
+}
@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <unordered_set>
+#include "BibleData/PerfectHashStringMap.h"
+
+namespace BIBLE_DATA
+{
+    /// Builds a map from the provided entries by finding seeds that place all keys into distinct slots.
+    /// This is intended for generating code files rather than for use at runtime.
+    /// @param[in]  entries - The entries for the map.  Keys must be distinct.
+    /// @return The built map data; null if any keys are duplicated or there are too many entries.
+    std::optional<PerfectHashStringMap::BuiltData> PerfectHashStringMap::Build(const std::span<const Entry> entries)
+    {
+        // MAKE SURE THE ENTRIES CAN BE STORED.
+        bool too_many_entries = (entries.size() >= MAX_ENTRY_COUNT);
+        if (too_many_entries)
+        {
+            return std::nullopt;
+        }
+
+        // MAKE SURE ALL KEYS ARE DISTINCT.
+        // Any duplicate key would have an entry that could never be found.
+        std::unordered_set<std::string_view> keys;
+        for (const Entry& entry : entries)
+        {
+            bool key_already_exists = !keys.insert(entry.Key).second;
+            if (key_already_exists)
+            {
+                return std::nullopt;
+            }
+        }
+
+        // HASH EACH KEY AND GROUP THE KEYS INTO BUCKETS.
+        BuiltData built_data =
+        {
+            .Entries = std::vector<Entry>(entries.begin(), entries.end()),
+            .SeedsByBucket = std::vector<std::uint32_t>((entries.size() / 4) + 1, 0),
+            .EntryIndicesBySlot = std::vector<std::uint16_t>((2 * entries.size()) + 1, EMPTY_SLOT),
+        };
+        std::size_t bucket_count = built_data.SeedsByBucket.size();
+        std::size_t slot_count = built_data.EntryIndicesBySlot.size();
+        std::vector<std::uint64_t> hashes_by_entry_index(entries.size());
+        std::vector<std::vector<std::uint16_t>> entry_indices_by_bucket(bucket_count);
+        for (std::size_t entry_index = 0; entry_index < entries.size(); ++entry_index)
+        {
+            hashes_by_entry_index[entry_index] = Hash(entries[entry_index].Key);
+            std::size_t bucket_index = hashes_by_entry_index[entry_index] % bucket_count;
+            entry_indices_by_bucket[bucket_index].push_back(static_cast<std::uint16_t>(entry_index));
+        }
+
+        // FIND A SEED FOR EACH BUCKET THAT PLACES ALL OF ITS KEYS INTO FREE SLOTS.
+        // Placing the largest buckets first, while most slots are free, makes finding seeds much easier.
+        // Ties are broken by bucket index so that the built data is always the same.
+        std::vector<std::size_t> bucket_indices_by_placement_order(bucket_count);
+        for (std::size_t bucket_index = 0; bucket_index < bucket_count; ++bucket_index)
+        {
+            bucket_indices_by_placement_order[bucket_index] = bucket_index;
+        }
+        std::stable_sort(
+            bucket_indices_by_placement_order.begin(),
+            bucket_indices_by_placement_order.end(),
+            [&entry_indices_by_bucket](const std::size_t left_bucket_index, const std::size_t right_bucket_index)
+            {
+                return entry_indices_by_bucket[left_bucket_index].size() > entry_indices_by_bucket[right_bucket_index].size();
+            });
+        for (const std::size_t bucket_index : bucket_indices_by_placement_order)
+        {
+            const std::vector<std::uint16_t>& bucket_entry_indices = entry_indices_by_bucket[bucket_index];
+            for (std::uint32_t seed = 0; ; ++seed)
+            {
+                // TRY PLACING ALL KEYS IN THE BUCKET WITH THE CURRENT SEED.
+                std::size_t placed_key_count = 0;
+                for (; placed_key_count < bucket_entry_indices.size(); ++placed_key_count)
+                {
+                    std::uint16_t entry_index = bucket_entry_indices[placed_key_count];
+                    std::size_t slot_index = GetSlotIndex(hashes_by_entry_index[entry_index], seed, slot_count);
+                    bool slot_free = (EMPTY_SLOT == built_data.EntryIndicesBySlot[slot_index]);
+                    if (!slot_free)
+                    {
+                        break;
+                    }
+                    built_data.EntryIndicesBySlot[slot_index] = entry_index;
+                }
+
+                // KEEP THE SEED IF ALL KEYS WERE PLACED.
+                bool all_keys_placed = (bucket_entry_indices.size() == placed_key_count);
+                if (all_keys_placed)
+                {
+                    built_data.SeedsByBucket[bucket_index] = seed;
+                    break;
+                }
+
+                // UNDO ANY PARTIAL PLACEMENT BEFORE TRYING THE NEXT SEED.
+                for (std::size_t placed_key_index = 0; placed_key_index < placed_key_count; ++placed_key_index)
+                {
+                    std::uint16_t entry_index = bucket_entry_indices[placed_key_index];
+                    std::size_t slot_index = GetSlotIndex(hashes_by_entry_index[entry_index], seed, slot_count);
+                    built_data.EntryIndicesBySlot[slot_index] = EMPTY_SLOT;
+                }
+            }
+        }
+
+        return built_data;
+    }
+
+    /// Finds the value for a key.
+    /// @param[in]  key - The key to find.
+    /// @return The value for the key, if found; null otherwise.
+    std::optional<std::string_view> PerfectHashStringMap::Find(const std::string_view key) const
+    {
+        // MAKE SURE THE MAP HAS ENTRIES.
+        if (SeedsByBucket.empty())
+        {
+            return std::nullopt;
+        }
+
+        // FIND THE ONLY SLOT THE KEY COULD BE IN.
+        std::uint64_t hash = Hash(key);
+        std::size_t bucket_index = hash % SeedsByBucket.size();
+        std::size_t slot_index = GetSlotIndex(hash, SeedsByBucket[bucket_index], EntryIndicesBySlot.size());
+
+        // CHECK IF THE KEY IS ACTUALLY IN THE SLOT.
+        // Keys not in the map still hash to some slot, so the key must be compared.
+        std::uint16_t entry_index = EntryIndicesBySlot[slot_index];
+        bool slot_empty = (EMPTY_SLOT == entry_index);
+        if (slot_empty)
+        {
+            return std::nullopt;
+        }
+        const Entry& entry = Entries[entry_index];
+        bool key_matches = (entry.Key == key);
+        if (!key_matches)
+        {
+            return std::nullopt;
+        }
+
+        return entry.Value;
+    }
+
+    /// Gets all entries in the map.
+    /// @return All entries in the map, in their originally provided order.
+    std::span<const PerfectHashStringMap::Entry> PerfectHashStringMap::GetEntries() const
+    {
+        return Entries;
+    }
+
+    /// Computes the hash for a string using FNV-1a (https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function).
+    /// @param[in]  string - The string to hash.
+    /// @return The hash of the string.
+    std::uint64_t PerfectHashStringMap::Hash(const std::string_view string)
+    {
+        constexpr std::uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ull;
+        constexpr std::uint64_t FNV_PRIME = 0x100000001B3ull;
+        std::uint64_t hash = FNV_OFFSET_BASIS;
+        for (const char character : string)
+        {
+            hash ^= static_cast<unsigned char>(character);
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    /// Gets the slot for a key's hash given a bucket's seed.
+    /// The hash is remixed with the seed (using SplitMix64's finalizer) rather than rehashing
+    /// the key's characters to keep trying different seeds cheap.
+    /// @param[in]  hash - The hash of the key.
+    /// @param[in]  seed - The seed for the key's bucket.
+    /// @param[in]  slot_count - The number of slots in the map.
+    /// @return The index of the slot.
+    std::size_t PerfectHashStringMap::GetSlotIndex(const std::uint64_t hash, const std::uint32_t seed, const std::size_t slot_count)
+    {
+        std::uint64_t mixed_hash = hash + (seed + 1) * 0x9E3779B97F4A7C15ull;
+        mixed_hash = (mixed_hash ^ (mixed_hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+        mixed_hash = (mixed_hash ^ (mixed_hash >> 27)) * 0x94D049BB133111EBull;
+        mixed_hash ^= (mixed_hash >> 31);
+        std::size_t slot_index = static_cast<std::size_t>(mixed_hash % slot_count);
+        return slot_index;
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace BIBLE_DATA
+{
+    /// A read-only map of strings to strings with lookups based on a perfect hash
+    /// (https://en.wikipedia.org/wiki/Perfect_hash_function).
+    /// Keys are placed following the "hash, displace, and compress" approach: keys are first grouped into buckets,
+    /// and each bucket gets a seed such that all of its keys hash to distinct, unused slots.
+    /// Lookups therefore hash the key once and compare against at most a single entry.
+    ///
+    /// Finding seeds is too much work to do at compile time for large maps, so maps are built offline (see Build())
+    /// and written out to code files (see BibleDataCodeFiles).  A map only views those arrays, so it can be
+    /// constant-initialized with no static initialization or heap allocation needed.
+    class PerfectHashStringMap
+    {
+    public:
+        /// A single key/value entry in the map.
+        struct Entry
+        {
+            /// The key for the entry.
+            std::string_view Key = "";
+            /// The value for the entry.
+            std::string_view Value = "";
+        };
+
+        /// Storage for a map built at runtime (see Build()).
+        struct BuiltData
+        {
+            /// See PerfectHashStringMap::Entries.
+            std::vector<Entry> Entries = {};
+            /// See PerfectHashStringMap::SeedsByBucket.
+            std::vector<std::uint32_t> SeedsByBucket = {};
+            /// See PerfectHashStringMap::EntryIndicesBySlot.
+            std::vector<std::uint16_t> EntryIndicesBySlot = {};
+        };
+
+        /// The value indicating a slot without an entry.
+        static constexpr std::uint16_t EMPTY_SLOT = 0xFFFF;
+        /// The maximum number of entries in a map, since indices of entries are stored in 16 bits to keep slots compact.
+        static constexpr std::size_t MAX_ENTRY_COUNT = EMPTY_SLOT;
+
+        static std::optional<BuiltData> Build(const std::span<const Entry> entries);
+
+        /// Creates an empty map.
+        constexpr PerfectHashStringMap() = default;
+
+        /// Creates a map viewing already built data (see Build()), such as from generated code files.
+        /// @param[in]  entries - The entries in the map.
+        /// @param[in]  seeds_by_bucket - The seed for each bucket.
+        /// @param[in]  entry_indices_by_slot - The index of the entry in each slot.
+        constexpr PerfectHashStringMap(
+            const std::span<const Entry> entries,
+            const std::span<const std::uint32_t> seeds_by_bucket,
+            const std::span<const std::uint16_t> entry_indices_by_slot) :
+            Entries(entries),
+            SeedsByBucket(seeds_by_bucket),
+            EntryIndicesBySlot(entry_indices_by_slot)
+        {}
+
+        std::optional<std::string_view> Find(const std::string_view key) const;
+        std::span<const Entry> GetEntries() const;
+
+    private:
+        static std::uint64_t Hash(const std::string_view string);
+        static std::size_t GetSlotIndex(const std::uint64_t hash, const std::uint32_t seed, const std::size_t slot_count);
+
+        /// The entries in the map, which all have distinct keys.
+        std::span<const Entry> Entries = {};
+        /// The seed for each bucket that places all of its keys into unique slots.
+        /// There are a quarter as many buckets as entries (plus one), which averages a few keys per bucket.
+        std::span<const std::uint32_t> SeedsByBucket = {};
+        /// Indices into Entries for each slot; EMPTY_SLOT if no entry is in the slot.
+        /// There are twice as many slots as entries (plus one), which keeps seed searches short.
+        std::span<const std::uint16_t> EntryIndicesBySlot = {};
+    };
+}
@@ -0,0 +1,13470 @@
+#include "BibleData/RootWordMap.h"
+namespace BIBLE_DATA
+{
+const PerfectHashStringMap::Entry ROOT_WORD_MAP_ENTRIES[] =
+{
+{ std::string_view("aaronites", 9), std::string_view("aaron", 5) },
+{ std::string_view("abased", 6), std::string_view("abase", 5) },
+{ std::string_view("abasing", 7), std::string_view("abase", 5) },
+{ std::string_view("abhorred", 8), std::string_view("abhor", 5) },
+{ std::string_view("abhorrest", 9), std::string_view("abhor", 5) },
+{ std::string_view("abhorreth", 9), std::string_view("abhor", 5) },
+{ std::string_view("abhorring", 9), std::string_view("abhor", 5) },
+{ std::string_view("abideth", 7), std::string_view("abide", 5) },
+{ std::string_view("abiding", 7), std::string_view("abide", 5) },
+{ std::string_view("abiezrites", 10), std::string_view("abiezrite", 9) },
+{ std::string_view("abodest", 7), std::string_view("abode", 5) },
+{ std::string_view("abolished", 9), std::string_view("abolish", 7) },
+{ std::string_view("abominable", 10), std::string_view("abominate", 9) },
+{ std::string_view("abominably", 10), std::string_view("abominate", 9) },
+{ std::string_view("abomination", 11), std::string_view("abominate", 9) },
+{ std::string_view("abominations", 12), std::string_view("abominate", 9) },
+{ std::string_view("abounded", 8), std::string_view("abound", 6) },
+{ std::string_view("aboundeth", 9), std::string_view("abound", 6) },
+{ std::string_view("abounding", 9), std::string_view("abound", 6) },
+{ std::string_view("absence", 7), std::string_view("absent", 6) },
+{ std::string_view("abstinence", 10), std::string_view("abstain", 7) },
+{ std::string_view("abundance", 9), std::string_view("abundant", 8) },
+{ std::string_view("abundantly", 10), std::string_view("abundant", 8) },
+{ std::string_view("abused", 6), std::string_view("abuse", 5) },
+{ std::string_view("abusers", 7), std::string_view("abuse", 5) },
+{ std::string_view("abusing", 7), std::string_view("abuse", 5) },
+{ std::string_view("acceptable", 10), std::string_view("accept", 6) },
+{ std::string_view("acceptably", 10), std::string_view("accept", 6) },
+{ std::string_view("acceptance", 10), std::string_view("accept", 6) },
+{ std::string_view("acceptation", 11), std::string_view("accept", 6) },
+{ std::string_view("accepted", 8), std::string_view("accept", 6) },
+{ std::string_view("acceptest", 9), std::string_view("accept", 6) },
+{ std::string_view("accepteth", 9), std::string_view("accept", 6) },
+{ std::string_view("accepting", 9), std::string_view("accept", 6) },
+{ std::string_view("accompanied", 11), std::string_view("accompany", 9) },
+{ std::string_view("accompanying", 12), std::string_view("accompany", 9) },
+{ std::string_view("accomplished", 12), std::string_view("accomplish", 10) },
+{ std::string_view("accomplishing", 13), std::string_view("accomplish", 10) },
+{ std::string_view("accomplishment", 14), std::string_view("accomplish", 10) },
+{ std::string_view("according", 9), std::string_view("accord", 6) },
+{ std::string_view("accordingly", 11), std::string_view("accord", 6) },
+{ std::string_view("accounted", 9), std::string_view("account", 7) },
+{ std::string_view("accounting", 10), std::string_view("account", 7) },
+{ std::string_view("accounts", 8), std::string_view("account", 7) },
+{ std::string_view("accusation", 10), std::string_view("accuse", 6) },
+{ std::string_view("accused", 7), std::string_view("accuse", 6) },
+{ std::string_view("accuser", 7), std::string_view("accuse", 6) },
+{ std::string_view("accusers", 8), std::string_view("accuse", 6) },
+{ std::string_view("accuseth", 8), std::string_view("accuse", 6) },
+{ std::string_view("accusing", 8), std::string_view("accuse", 6) },
+{ std::string_view("acknowledged", 12), std::string_view("acknowledge", 11) },
+{ std::string_view("acknowledgement", 15), std::string_view("acknowledge", 11) },
+{ std::string_view("acknowledgeth", 13), std::string_view("acknowledge", 11) },
+{ std::string_view("acknowledging", 13), std::string_view("acknowledge", 11) },
+{ std::string_view("acquaintance", 12), std::string_view("acquaint", 8) },
+{ std::string_view("acquainted", 10), std::string_view("acquaint", 8) },
+{ std::string_view("acquainting", 11), std::string_view("acquaint", 8) },
+{ std::string_view("acres", 5), std::string_view("acre", 4) },
+{ std::string_view("acts", 4), std::string_view("act", 3) },
+{ std::string_view("added", 5), std::string_view("add", 3) },
+{ std::string_view("addeth", 6), std::string_view("add", 3) },
+{ std::string_view("addition", 8), std::string_view("add", 3) },
+{ std::string_view("additions", 9), std::string_view("add", 3) },
+{ std::string_view("adders", 6), std::string_view("adder", 5) },
+{ std::string_view("adjured", 7), std::string_view("adjure", 6) },
+{ std::string_view("administered", 12), std::string_view("administer", 10) },
+{ std::string_view("administration", 14), std::string_view("administer", 10) },
+{ std::string_view("administrations", 15), std::string_view("administer", 10) },
+{ std::string_view("admiration", 10), std::string_view("admire", 6) },
+{ std::string_view("admired", 7), std::string_view("admire", 6) },
+{ std::string_view("admonished", 10), std::string_view("admonish", 8) },
+{ std::string_view("admonishing", 11), std::string_view("admonish", 8) },
+{ std::string_view("admonition", 10), std::string_view("admonish", 8) },
+{ std::string_view("adorned", 7), std::string_view("adorn", 5) },
+{ std::string_view("adorneth", 8), std::string_view("adorn", 5) },
+{ std::string_view("adorning", 8), std::string_view("adorn", 5) },
+{ std::string_view("adullamite", 10), std::string_view("adullam", 7) },
+{ std::string_view("adulterer", 9), std::string_view("adultery", 8) },
+{ std::string_view("adulterers", 10), std::string_view("adultery", 8) },
+{ std::string_view("adulteress", 10), std::string_view("adultery", 8) },
+{ std::string_view("adulteresses", 12), std::string_view("adultery", 8) },
+{ std::string_view("adulteries", 10), std::string_view("adultery", 8) },
+{ std::string_view("adulterous", 10), std::string_view("adultery", 8) },
+{ std::string_view("advantaged", 10), std::string_view("advantage", 9) },
+{ std::string_view("advantageth", 11), std::string_view("advantage", 9) },
+{ std::string_view("adventured", 10), std::string_view("adventure", 9) },
+{ std::string_view("adversaries", 11), std::string_view("adversary", 9) },
+{ std::string_view("adversities", 11), std::string_view("adversity", 9) },
+{ std::string_view("advise", 6), std::string_view("advice", 6) },
+{ std::string_view("advised", 7), std::string_view("advice", 6) },
+{ std::string_view("advisement", 10), std::string_view("advice", 6) },
+{ std::string_view("affected", 8), std::string_view("affect", 6) },
+{ std::string_view("affecteth", 9), std::string_view("affect", 6) },
+{ std::string_view("affectionately", 14), std::string_view("affection", 9) },
+{ std::string_view("affectioned", 11), std::string_view("affection", 9) },
+{ std::string_view("affections", 10), std::string_view("affection", 9) },
+{ std::string_view("affirmed", 8), std::string_view("affirm", 6) },
+{ std::string_view("afflicted", 9), std::string_view("afflict", 7) },
+{ std::string_view("afflictest", 10), std::string_view("afflict", 7) },
+{ std::string_view("affliction", 10), std::string_view("afflict", 7) },
+{ std::string_view("afflictions", 11), std::string_view("afflict", 7) },
+{ std::string_view("affrighted", 10), std::string_view("affright", 8) },
+{ std::string_view("afterwards", 10), std::string_view("afterward", 9) },
+{ std::string_view("agagite", 7), std::string_view("agag", 4) },
+{ std::string_view("agates", 6), std::string_view("agate", 5) },
+{ std::string_view("aged", 4), std::string_view("age", 3) },
+{ std::string_view("ages", 4), std::string_view("age", 3) },
+{ std::string_view("agreed", 6), std::string_view("agree", 5) },
+{ std::string_view("agreement", 9), std::string_view("agree", 5) },
+{ std::string_view("ahiramites", 10), std::string_view("ahiram", 6) },
+{ std::string_view("alexandrians", 12), std::string_view("alexandria", 10) },
+{ std::string_view("alienate", 8), std::string_view("alien", 5) },
+{ std::string_view("alienated", 9), std::string_view("alien", 5) },
+{ std::string_view("aliens", 6), std::string_view("alien", 5) },
+{ std::string_view("allowance", 9), std::string_view("allow", 5) },
+{ std::string_view("allowed", 7), std::string_view("allow", 5) },
+{ std::string_view("alloweth", 8), std::string_view("allow", 5) },
+{ std::string_view("almonds", 7), std::string_view("almond", 6) },
+{ std::string_view("altars", 6), std::string_view("altar", 5) },
+{ std::string_view("altered", 7), std::string_view("alter", 5) },
+{ std::string_view("altereth", 8), std::string_view("alter", 5) },
+{ std::string_view("amalekite", 9), std::string_view("amalek", 6) },
+{ std::string_view("amalekites", 10), std::string_view("amalek", 6) },
+{ std::string_view("amazed", 6), std::string_view("amaze", 5) },
+{ std::string_view("amazement", 9), std::string_view("amaze", 5) },
+{ std::string_view("ambassadors", 11), std::string_view("ambassador", 10) },
+{ std::string_view("ambushes", 8), std::string_view("ambush", 6) },
+{ std::string_view("ambushment", 10), std::string_view("ambush", 6) },
+{ std::string_view("ambushments", 11), std::string_view("ambush", 6) },
+{ std::string_view("amends", 6), std::string_view("amend", 5) },
+{ std::string_view("ammonite", 8), std::string_view("ammon", 5) },
+{ std::string_view("ammonites", 9), std::string_view("ammon", 5) },
+{ std::string_view("ammonitess", 10), std::string_view("ammon", 5) },
+{ std::string_view("amongst", 7), std::string_view("among", 5) },
+{ std::string_view("amorites", 8), std::string_view("amorite", 7) },
+{ std::string_view("amramites", 9), std::string_view("amram", 5) },
+{ std::string_view("anakims", 7), std::string_view("anak", 4) },
+{ std::string_view("anchors", 7), std::string_view("anchor", 6) },
+{ std::string_view("ancients", 8), std::string_view("ancient", 7) },
+{ std::string_view("angels", 6), std::string_view("angel", 5) },
+{ std::string_view("angered", 7), std::string_view("anger", 5) },
+{ std::string_view("angry", 5), std::string_view("anger", 5) },
+{ std::string_view("ankles", 6), std::string_view("ankle", 5) },
+{ std::string_view("anointed", 8), std::string_view("anoint", 6) },
+{ std::string_view("anointedst", 10), std::string_view("anoint", 6) },
+{ std::string_view("anointest", 9), std::string_view("anoint", 6) },
+{ std::string_view("anointing", 9), std::string_view("anoint", 6) },
+{ std::string_view("answerable", 10), std::string_view("answer", 6) },
+{ std::string_view("answered", 8), std::string_view("answer", 6) },
+{ std::string_view("answeredst", 10), std::string_view("answer", 6) },
+{ std::string_view("answerest", 9), std::string_view("answer", 6) },
+{ std::string_view("answereth", 9), std::string_view("answer", 6) },
+{ std::string_view("answering", 9), std::string_view("answer", 6) },
+{ std::string_view("answers", 7), std::string_view("answer", 6) },
+{ std::string_view("antichrists", 11), std::string_view("antichrist", 10) },
+{ std::string_view("ants", 4), std::string_view("ant", 3) },
+{ std::string_view("apostles", 8), std::string_view("apostle", 7) },
+{ std::string_view("apostleship", 11), std::string_view("apostle", 7) },
+{ std::string_view("apothecaries", 12), std::string_view("apothecary", 10) },
+{ std::string_view("apparelled", 10), std::string_view("apparel", 7) },
+{ std::string_view("appealed", 8), std::string_view("appeal", 6) },
+{ std::string_view("appearance", 10), std::string_view("appear", 6) },
+{ std::string_view("appearances", 11), std::string_view("appear", 6) },
+{ std::string_view("appeared", 8), std::string_view("appear", 6) },
+{ std::string_view("appeareth", 9), std::string_view("appear", 6) },
+{ std::string_view("appearing", 9), std::string_view("appear", 6) },
+{ std::string_view("appeased", 8), std::string_view("appease", 7) },
+{ std::string_view("appeaseth", 9), std::string_view("appease", 7) },
+{ std::string_view("appertained", 11), std::string_view("appertain", 9) },
+{ std::string_view("appertaineth", 12), std::string_view("appertain", 9) },
+{ std::string_view("apples", 6), std::string_view("apple", 5) },
+{ std::string_view("applied", 7), std::string_view("apply", 5) },
+{ std::string_view("appointed", 9), std::string_view("appoint", 7) },
+{ std::string_view("appointeth", 10), std::string_view("appoint", 7) },
+{ std::string_view("appointment", 11), std::string_view("appoint", 7) },
+{ std::string_view("apprehended", 11), std::string_view("apprehend", 9) },
+{ std::string_view("approached", 10), std::string_view("approach", 8) },
+{ std::string_view("approacheth", 11), std::string_view("approach", 8) },
+{ std::string_view("approaching", 11), std::string_view("approach", 8) },
+{ std::string_view("approved", 8), std::string_view("approve", 7) },
+{ std::string_view("approvest", 9), std::string_view("approve", 7) },
+{ std::string_view("approveth", 9), std::string_view("approve", 7) },
+{ std::string_view("approving", 9), std::string_view("approve", 7) },
+{ std::string_view("arabian", 7), std::string_view("arabia", 6) },
+{ std::string_view("arabians", 8), std::string_view("arabia", 6) },
+{ std::string_view("aramites", 8), std::string_view("aram", 4) },
+{ std::string_view("archers", 7), std::string_view("archer", 6) },
+{ std::string_view("arguing", 7), std::string_view("argue", 5) },
+{ std::string_view("arguments", 9), std::string_view("argue", 5) },
+{ std::string_view("ariseth", 7), std::string_view("arise", 5) },
+{ std::string_view("arising", 7), std::string_view("arise", 5) },
+{ std::string_view("aroerite", 8), std::string_view("aroer", 5) },
+{ std::string_view("arrayed", 7), std::string_view("array", 5) },
+{ std::string_view("arrows", 6), std::string_view("arrow", 5) },
+{ std::string_view("artificers", 10), std::string_view("artificer", 9) },
+{ std::string_view("arvadite", 8), std::string_view("arvad", 5) },
+{ std::string_view("ascended", 8), std::string_view("ascend", 6) },
+{ std::string_view("ascendeth", 9), std::string_view("ascend", 6) },
+{ std::string_view("ascending", 9), std::string_view("ascend", 6) },
+{ std::string_view("ascent", 6), std::string_view("ascend", 6) },
+{ std::string_view("ascribed", 8), std::string_view("ascribe", 7) },
+{ std::string_view("ashamed", 7), std::string_view("shame", 5) },
+{ std::string_view("ashbelites", 10), std::string_view("ashbel", 6) },
+{ std::string_view("ashdodites", 10), std::string_view("ashdodites", 10) },
+{ std::string_view("asherites", 9), std::string_view("asher", 5) },
+{ std::string_view("ashes", 5), std::string_view("ash", 3) },
+{ std::string_view("ashtarothite", 12), std::string_view("ashtaroth", 9) },
+{ std::string_view("ashurites", 9), std::string_view("ashur", 5) },
+{ std::string_view("asked", 5), std::string_view("ask", 3) },
+{ std::string_view("askest", 6), std::string_view("ask", 3) },
+{ std::string_view("asketh", 6), std::string_view("ask", 3) },
+{ std::string_view("asking", 6), std::string_view("ask", 3) },
+{ std::string_view("asleep", 6), std::string_view("sleep", 5) },
+{ std::string_view("asps", 4), std::string_view("asp", 3) },
+{ std::string_view("asrielites", 10), std::string_view("asriel", 6) },
+{ std::string_view("assaulted", 9), std::string_view("assault", 7) },
+{ std::string_view("assayed", 7), std::string_view("assay", 5) },
+{ std::string_view("assaying", 8), std::string_view("assay", 5) },
+{ std::string_view("assembled", 9), std::string_view("assemble", 8) },
+{ std::string_view("assemblies", 10), std::string_view("assemble", 8) },
+{ std::string_view("assembling", 10), std::string_view("assemble", 8) },
+{ std::string_view("assembly", 8), std::string_view("assemble", 8) },
+{ std::string_view("assented", 8), std::string_view("assent", 6) },
+{ std::string_view("asses", 5), std::string_view("ass", 3) },
+{ std::string_view("assurance", 9), std::string_view("assure", 6) },
+{ std::string_view("assured", 7), std::string_view("assure", 6) },
+{ std::string_view("assuredly", 9), std::string_view("assure", 6) },
+{ std::string_view("asswaged", 8), std::string_view("asswage", 7) },
+{ std::string_view("assyrian", 8), std::string_view("assyria", 7) },
+{ std::string_view("assyrians", 9), std::string_view("assyria", 7) },
+{ std::string_view("astonished", 10), std::string_view("astonish", 8) },
+{ std::string_view("astonishment", 12), std::string_view("astonish", 8) },
+{ std::string_view("astrologers", 11), std::string_view("astrologer", 10) },
+{ std::string_view("athenians", 9), std::string_view("athens", 6) },
+{ std::string_view("atonements", 10), std::string_view("atonement", 9) },
+{ std::string_view("attained", 8), std::string_view("attain", 6) },
+{ std::string_view("attendance", 10), std::string_view("attend", 6) },
+{ std::string_view("attended", 8), std::string_view("attend", 6) },
+{ std::string_view("attending", 9), std::string_view("attend", 6) },
+{ std::string_view("attentive", 9), std::string_view("attent", 6) },
+{ std::string_view("attentively", 11), std::string_view("attent", 6) },
+{ std::string_view("attired", 7), std::string_view("attire", 6) },
+{ std::string_view("authorities", 11), std::string_view("authority", 9) },
+{ std::string_view("avenged", 7), std::string_view("avenge", 6) },
+{ std::string_view("avenger", 7), std::string_view("avenge", 6) },
+{ std::string_view("avengeth", 8), std::string_view("avenge", 6) },
+{ std::string_view("avenging", 8), std::string_view("avenge", 6) },
+{ std::string_view("avoided", 7), std::string_view("avoid", 5) },
+{ std::string_view("avoiding", 8), std::string_view("avoid", 5) },
+{ std::string_view("awaked", 6), std::string_view("awake", 5) },
+{ std::string_view("awakest", 7), std::string_view("awake", 5) },
+{ std::string_view("awaketh", 7), std::string_view("awake", 5) },
+{ std::string_view("awaking", 7), std::string_view("awake", 5) },
+{ std::string_view("awoke", 5), std::string_view("awake", 5) },
+{ std::string_view("axes", 4), std::string_view("axe", 3) },
+{ std::string_view("babylonians", 11), std::string_view("babylon", 7) },
+{ std::string_view("babylonish", 10), std::string_view("babylon", 7) },
+{ std::string_view("backs", 5), std::string_view("back", 4) },
+{ std::string_view("backbiters", 10), std::string_view("backbite", 8) },
+{ std::string_view("backbiteth", 10), std::string_view("backbite", 8) },
+{ std::string_view("backbiting", 10), std::string_view("backbite", 8) },
+{ std::string_view("backbitings", 11), std::string_view("backbite", 8) },
+{ std::string_view("backslider", 10), std::string_view("backslide", 9) },
+{ std::string_view("backsliding", 11), std::string_view("backslide", 9) },
+{ std::string_view("backslidings", 12), std::string_view("backslide", 9) },
+{ std::string_view("badest", 6), std::string_view("bade", 4) },
+{ std::string_view("bags", 4), std::string_view("bag", 3) },
+{ std::string_view("baked", 5), std::string_view("bake", 4) },
+{ std::string_view("baker", 5), std::string_view("bake", 4) },
+{ std::string_view("bakers", 6), std::string_view("bake", 4) },
+{ std::string_view("baketh", 6), std::string_view("bake", 4) },
+{ std::string_view("balances", 8), std::string_view("balance", 7) },
+{ std::string_view("balancings", 10), std::string_view("balance", 7) },
+{ std::string_view("baldness", 8), std::string_view("bald", 4) },
+{ std::string_view("banded", 6), std::string_view("band", 4) },
+{ std::string_view("bands", 5), std::string_view("band", 4) },
+{ std::string_view("banished", 8), std::string_view("banish", 6) },
+{ std::string_view("banishment", 10), std::string_view("banish", 6) },
+{ std::string_view("banks", 5), std::string_view("bank", 4) },
+{ std::string_view("banners", 7), std::string_view("banner", 6) },
+{ std::string_view("banqueting", 10), std::string_view("banquet", 7) },
+{ std::string_view("banquetings", 11), std::string_view("banquet", 7) },
+{ std::string_view("baptism", 7), std::string_view("baptize", 7) },
+{ std::string_view("baptisms", 8), std::string_view("baptize", 7) },
+{ std::string_view("baptist", 7), std::string_view("baptize", 7) },
+{ std::string_view("baptized", 8), std::string_view("baptize", 7) },
+{ std::string_view("baptizest", 9), std::string_view("baptize", 7) },
+{ std::string_view("baptizeth", 9), std::string_view("baptize", 7) },
+{ std::string_view("baptizing", 9), std::string_view("baptize", 7) },
+{ std::string_view("barbarians", 10), std::string_view("barbarian", 9) },
+{ std::string_view("barbarous", 9), std::string_view("barbarian", 9) },
+{ std::string_view("barked", 6), std::string_view("bark", 4) },
+{ std::string_view("barns", 5), std::string_view("barn", 4) },
+{ std::string_view("barrels", 7), std::string_view("barrel", 6) },
+{ std::string_view("barrenness", 10), std::string_view("barren", 6) },
+{ std::string_view("bars", 4), std::string_view("bar", 3) },
+{ std::string_view("bases", 5), std::string_view("base", 4) },
+{ std::string_view("basest", 6), std::string_view("base", 4) },
+{ std::string_view("baskets", 7), std::string_view("basket", 6) },
+{ std::string_view("basons", 6), std::string_view("bason", 5) },
+{ std::string_view("bastards", 8), std::string_view("bastard", 7) },
+{ std::string_view("bats", 4), std::string_view("bat", 3) },
+{ std::string_view("bathe", 5), std::string_view("bath", 4) },
+{ std::string_view("bathed", 6), std::string_view("bath", 4) },
+{ std::string_view("baths", 5), std::string_view("bath", 4) },
+{ std::string_view("battered", 8), std::string_view("batter", 6) },
+{ std::string_view("battering", 9), std::string_view("batter", 6) },
+{ std::string_view("battles", 7), std::string_view("battle", 6) },
+{ std::string_view("battlements", 11), std::string_view("battlement", 10) },
+{ std::string_view("beams", 5), std::string_view("beam", 4) },
+{ std::string_view("beards", 6), std::string_view("beard", 5) },
+{ std::string_view("beasts", 6), std::string_view("beast", 5) },
+{ std::string_view("beaten", 6), std::string_view("beat", 4) },
+{ std::string_view("beatest", 7), std::string_view("beat", 4) },
+{ std::string_view("beateth", 7), std::string_view("beat", 4) },
+{ std::string_view("beating", 7), std::string_view("beat", 4) },
+{ std::string_view("beauties", 8), std::string_view("beauty", 6) },
+{ std::string_view("beautiful", 9), std::string_view("beauty", 6) },
+{ std::string_view("beautify", 8), std::string_view("beauty", 6) },
+{ std::string_view("becamest", 8), std::string_view("become", 6) },
+{ std::string_view("beckoned", 8), std::string_view("beckon", 6) },
+{ std::string_view("beckoning", 9), std::string_view("beckon", 6) },
+{ std::string_view("becometh", 8), std::string_view("become", 6) },
+{ std::string_view("beds", 4), std::string_view("bed", 3) },
+{ std::string_view("bees", 4), std::string_view("bee", 3) },
+{ std::string_view("befallen", 8), std::string_view("befall", 6) },
+{ std::string_view("befalleth", 9), std::string_view("befall", 6) },
+{ std::string_view("befell", 6), std::string_view("befall", 6) },
+{ std::string_view("beget", 5), std::string_view("begat", 5) },
+{ std::string_view("begettest", 9), std::string_view("begat", 5) },
+{ std::string_view("begetteth", 9), std::string_view("begat", 5) },
+{ std::string_view("beggar", 6), std::string_view("beg", 3) },
+{ std::string_view("beggarly", 8), std::string_view("beg", 3) },
+{ std::string_view("begged", 6), std::string_view("beg", 3) },
+{ std::string_view("begging", 7), std::string_view("beg", 3) },
+{ std::string_view("began", 5), std::string_view("begin", 5) },
+{ std::string_view("beginnest", 9), std::string_view("begin", 5) },
+{ std::string_view("beginning", 9), std::string_view("begin", 5) },
+{ std::string_view("beginnings", 10), std::string_view("begin", 5) },
+{ std::string_view("begotten", 8), std::string_view("begat", 5) },
+{ std::string_view("beguiled", 8), std::string_view("beguile", 7) },
+{ std::string_view("beguiling", 9), std::string_view("beguile", 7) },
+{ std::string_view("begun", 5), std::string_view("begin", 5) },
+{ std::string_view("behaved", 7), std::string_view("behave", 6) },
+{ std::string_view("behaveth", 8), std::string_view("behave", 6) },
+{ std::string_view("behaviour", 9), std::string_view("behave", 6) },
+{ std::string_view("beheld", 6), std::string_view("behold", 6) },
+{ std::string_view("beholdest", 9), std::string_view("behold", 6) },
+{ std::string_view("beholdeth", 9), std::string_view("behold", 6) },
+{ std::string_view("beholding", 9), std::string_view("behold", 6) },
+{ std::string_view("believe", 7), std::string_view("belief", 6) },
+{ std::string_view("believed", 8), std::string_view("belief", 6) },
+{ std::string_view("believers", 9), std::string_view("belief", 6) },
+{ std::string_view("believest", 9), std::string_view("belief", 6) },
+{ std::string_view("believeth", 9), std::string_view("belief", 6) },
+{ std::string_view("believing", 9), std::string_view("belief", 6) },
+{ std::string_view("bellows", 7), std::string_view("bellow", 6) },
+{ std::string_view("bells", 5), std::string_view("bell", 4) },
+{ std::string_view("bellies", 7), std::string_view("belly", 5) },
+{ std::string_view("belonged", 8), std::string_view("belong", 6) },
+{ std::string_view("belongest", 9), std::string_view("belong", 6) },
+{ std::string_view("belongeth", 9), std::string_view("belong", 6) },
+{ std::string_view("belonging", 9), std::string_view("belong", 6) },
+{ std::string_view("bemoaned", 8), std::string_view("bemoan", 6) },
+{ std::string_view("bemoaning", 9), std::string_view("bemoan", 6) },
+{ std::string_view("bendeth", 7), std::string_view("bend", 4) },
+{ std::string_view("bending", 7), std::string_view("bend", 4) },
+{ std::string_view("benefits", 8), std::string_view("benefit", 7) },
+{ std::string_view("benjamite", 9), std::string_view("benjamin", 8) },
+{ std::string_view("benjamites", 10), std::string_view("benjamin", 8) },
+{ std::string_view("bent", 4), std::string_view("bend", 4) },
+{ std::string_view("bereaved", 8), std::string_view("bereave", 7) },
+{ std::string_view("bereaveth", 9), std::string_view("bereave", 7) },
+{ std::string_view("beseeching", 10), std::string_view("beseech", 7) },
+{ std::string_view("besides", 7), std::string_view("beside", 6) },
+{ std::string_view("besieged", 8), std::string_view("besiege", 7) },
+{ std::string_view("bestowed", 8), std::string_view("bestow", 6) },
+{ std::string_view("betrayed", 8), std::string_view("betray", 6) },
+{ std::string_view("betrayers", 9), std::string_view("betray", 6) },
+{ std::string_view("betrayest", 9), std::string_view("betray", 6) },
+{ std::string_view("betrayeth", 9), std::string_view("betray", 6) },
+{ std::string_view("betrothed", 9), std::string_view("betroth", 7) },
+{ std::string_view("bettered", 8), std::string_view("better", 6) },
+{ std::string_view("bewailed", 8), std::string_view("bewail", 6) },
+{ std::string_view("bewaileth", 9), std::string_view("bewail", 6) },
+{ std::string_view("bewrayeth", 9), std::string_view("bewray", 6) },
+{ std::string_view("bidden", 6), std::string_view("bid", 3) },
+{ std::string_view("biddeth", 7), std::string_view("bid", 3) },
+{ std::string_view("bidding", 7), std::string_view("bid", 3) },
+{ std::string_view("bindeth", 7), std::string_view("bind", 4) },
+{ std::string_view("binding", 7), std::string_view("bind", 4) },
+{ std::string_view("birds", 5), std::string_view("bird", 4) },
+{ std::string_view("bishops", 7), std::string_view("bishop", 6) },
+{ std::string_view("biteth", 6), std::string_view("biteth", 6) },
+{ std::string_view("bitterly", 8), std::string_view("bitter", 6) },
+{ std::string_view("bitterness", 10), std::string_view("bitter", 6) },
+{ std::string_view("blacker", 7), std::string_view("black", 5) },
+{ std::string_view("blackish", 8), std::string_view("black", 5) },
+{ std::string_view("blackness", 9), std::string_view("black", 5) },
+{ std::string_view("blamed", 6), std::string_view("blame", 5) },
+{ std::string_view("blameless", 9), std::string_view("blame", 5) },
+{ std::string_view("blaspheme", 9), std::string_view("blasphemy", 9) },
+{ std::string_view("blasphemed", 10), std::string_view("blasphemy", 9) },
+{ std::string_view("blasphemer", 10), std::string_view("blasphemy", 9) },
+{ std::string_view("blasphemers", 11), std::string_view("blasphemy", 9) },
+{ std::string_view("blasphemest", 11), std::string_view("blasphemy", 9) },
+{ std::string_view("blasphemeth", 11), std::string_view("blasphemy", 9) },
+{ std::string_view("blasphemies", 11), std::string_view("blasphemy", 9) },
+{ std::string_view("blaspheming", 11), std::string_view("blasphemy", 9) },
+{ std::string_view("blasphemous", 11), std::string_view("blasphemy", 9) },
+{ std::string_view("blasphemously", 13), std::string_view("blasphemy", 9) },
+{ std::string_view("blasted", 7), std::string_view("blast", 5) },
+{ std::string_view("blasting", 8), std::string_view("blast", 5) },
+{ std::string_view("bleatings", 9), std::string_view("bleating", 8) },
+{ std::string_view("blemishes", 9), std::string_view("blemish", 7) },
+{ std::string_view("blessed", 7), std::string_view("bless", 5) },
+{ std::string_view("blessedness", 11), std::string_view("bless", 5) },
+{ std::string_view("blessest", 8), std::string_view("bless", 5) },
+{ std::string_view("blesseth", 8), std::string_view("bless", 5) },
+{ std::string_view("blessing", 8), std::string_view("bless", 5) },
+{ std::string_view("blessings", 9), std::string_view("bless", 5) },
+{ std::string_view("blinded", 7), std::string_view("blind", 5) },
+{ std::string_view("blindeth", 8), std::string_view("blind", 5) },
+{ std::string_view("blindfolded", 11), std::string_view("blind", 5) },
+{ std::string_view("blindness", 9), std::string_view("blind", 5) },
+{ std::string_view("bloodguiltiness", 15), std::string_view("blood", 5) },
+{ std::string_view("bloodthirsty", 12), std::string_view("blood", 5) },
+{ std::string_view("bloody", 6), std::string_view("blood", 5) },
+{ std::string_view("blossomed", 9), std::string_view("blossom", 7) },
+{ std::string_view("blossoms", 8), std::string_view("blossom", 7) },
+{ std::string_view("blotted", 7), std::string_view("blot", 4) },
+{ std::string_view("blotteth", 8), std::string_view("blot", 4) },
+{ std::string_view("blotting", 8), std::string_view("blot", 4) },
+{ std::string_view("bloweth", 7), std::string_view("blow", 4) },
+{ std::string_view("blowing", 7), std::string_view("blow", 4) },
+{ std::string_view("blown", 5), std::string_view("blow", 4) },
+{ std::string_view("blueness", 8), std::string_view("blue", 4) },
+{ std::string_view("boards", 6), std::string_view("board", 5) },
+{ std::string_view("boasted", 7), std::string_view("boast", 5) },
+{ std::string_view("boasters", 8), std::string_view("boast", 5) },
+{ std::string_view("boastest", 8), std::string_view("boast", 5) },
+{ std::string_view("boasteth", 8), std::string_view("boast", 5) },
+{ std::string_view("boasting", 8), std::string_view("boast", 5) },
+{ std::string_view("boastings", 9), std::string_view("boast", 5) },
+{ std::string_view("boats", 5), std::string_view("boat", 4) },
+{ std::string_view("bodies", 6), std::string_view("body", 4) },
+{ std::string_view("bodily", 6), std::string_view("body", 4) },
+{ std::string_view("boiled", 6), std::string_view("boil", 4) },
+{ std::string_view("boiling", 7), std::string_view("boil", 4) },
+{ std::string_view("boils", 5), std::string_view("boil", 4) },
+{ std::string_view("boldly", 6), std::string_view("bold", 4) },
+{ std::string_view("boldness", 8), std::string_view("bold", 4) },
+{ std::string_view("bolted", 6), std::string_view("bolt", 4) },
+{ std::string_view("bonds", 5), std::string_view("bond", 4) },
+{ std::string_view("bondmaids", 9), std::string_view("bondmaids", 9) },
+{ std::string_view("bondmen", 7), std::string_view("bondman", 7) },
+{ std::string_view("bondwomen", 9), std::string_view("bondwoman", 9) },
+{ std::string_view("bones", 5), std::string_view("bone", 4) },
+{ std::string_view("books", 5), std::string_view("book", 4) },
+{ std::string_view("booths", 6), std::string_view("booth", 5) },
+{ std::string_view("booties", 7), std::string_view("booty", 5) },
+{ std::string_view("borders", 7), std::string_view("border", 6) },
+{ std::string_view("borrowed", 8), std::string_view("borrow", 6) },
+{ std::string_view("borroweth", 9), std::string_view("borrow", 6) },
+{ std::string_view("bottles", 7), std::string_view("bottle", 6) },
+{ std::string_view("bottoms", 7), std::string_view("bottom", 6) },
+{ std::string_view("boughs", 6), std::string_view("bough", 5) },
+{ std::string_view("bounds", 6), std::string_view("bound", 5) },
+{ std::string_view("bountifully", 11), std::string_view("bountiful", 9) },
+{ std::string_view("bountifulness", 13), std::string_view("bountiful", 9) },
+{ std::string_view("bowls", 5), std::string_view("bowl", 4) },
+{ std::string_view("bows", 4), std::string_view("bow", 3) },
+{ std::string_view("boys", 4), std::string_view("boy", 3) },
+{ std::string_view("bracelets", 9), std::string_view("bracelet", 8) },
+{ std::string_view("brambles", 8), std::string_view("bramble", 7) },
+{ std::string_view("branches", 8), std::string_view("branch", 6) },
+{ std::string_view("brands", 6), std::string_view("brand", 5) },
+{ std::string_view("brawlers", 8), std::string_view("brawler", 7) },
+{ std::string_view("brayed", 6), std::string_view("bray", 4) },
+{ std::string_view("breaches", 8), std::string_view("breach", 6) },
+{ std::string_view("breaker", 7), std::string_view("break", 5) },
+{ std::string_view("breakest", 8), std::string_view("break", 5) },
+{ std::string_view("breaketh", 8), std::string_view("break", 5) },
+{ std::string_view("breaking", 8), std::string_view("break", 5) },
+{ std::string_view("breakings", 9), std::string_view("break", 5) },
+{ std::string_view("breasts", 7), std::string_view("breast", 6) },
+{ std::string_view("breastplates", 12), std::string_view("breastplate", 11) },
+{ std::string_view("breathe", 7), std::string_view("breath", 6) },
+{ std::string_view("breathed", 8), std::string_view("breath", 6) },
+{ std::string_view("breatheth", 9), std::string_view("breath", 6) },
+{ std::string_view("breathing", 9), std::string_view("breath", 6) },
+{ std::string_view("breeding", 8), std::string_view("breed", 5) },
+{ std::string_view("bribery", 7), std::string_view("bribe", 5) },
+{ std::string_view("brides", 6), std::string_view("bribe", 5) },
+{ std::string_view("bricks", 6), std::string_view("brick", 5) },
+{ std::string_view("bridles", 7), std::string_view("bridle", 6) },
+{ std::string_view("bridleth", 8), std::string_view("bridle", 6) },
+{ std::string_view("brigandines", 11), std::string_view("brigandine", 10) },
+{ std::string_view("brightness", 10), std::string_view("bright", 6) },
+{ std::string_view("bringers", 8), std::string_view("bring", 5) },
+{ std::string_view("bringest", 8), std::string_view("bring", 5) },
+{ std::string_view("bringeth", 8), std::string_view("bring", 5) },
+{ std::string_view("bringing", 8), std::string_view("bring", 5) },
+{ std::string_view("broader", 7), std::string_view("broad", 5) },
+{ std::string_view("brooks", 6), std::string_view("brook", 5) },
+{ std::string_view("broughtest", 10), std::string_view("brought", 7) },
+{ std::string_view("bruised", 7), std::string_view("bruise", 6) },
+{ std::string_view("bruises", 7), std::string_view("bruise", 6) },
+{ std::string_view("bruising", 8), std::string_view("bruise", 6) },
+{ std::string_view("brutish", 7), std::string_view("brute", 5) },
+{ std::string_view("buckets", 7), std::string_view("bucket", 6) },
+{ std::string_view("bucklers", 8), std::string_view("buckler", 7) },
+{ std::string_view("budded", 6), std::string_view("bud", 3) },
+{ std::string_view("buds", 4), std::string_view("bud", 3) },
+{ std::string_view("buffeted", 8), std::string_view("buffet", 6) },
+{ std::string_view("builded", 7), std::string_view("build", 5) },
+{ std::string_view("buildedst", 9), std::string_view("build", 5) },
+{ std::string_view("builder", 7), std::string_view("build", 5) },
+{ std::string_view("builders", 8), std::string_view("build", 5) },
+{ std::string_view("buildest", 8), std::string_view("build", 5) },
+{ std::string_view("buildeth", 8), std::string_view("build", 5) },
+{ std::string_view("building", 8), std::string_view("build", 5) },
+{ std::string_view("built", 5), std::string_view("build", 5) },
+{ std::string_view("bulls", 5), std::string_view("bull", 4) },
+{ std::string_view("bullocks", 8), std::string_view("bullock", 7) },
+{ std::string_view("bulrushes", 9), std::string_view("bulrush", 7) },
+{ std::string_view("bunches", 7), std::string_view("bunch", 5) },
+{ std::string_view("bundles", 7), std::string_view("bundle", 6) },
+{ std::string_view("burdened", 8), std::string_view("burden", 6) },
+{ std::string_view("burdens", 7), std::string_view("burden", 6) },
+{ std::string_view("burdensome", 10), std::string_view("burden", 6) },
+{ std::string_view("burned", 6), std::string_view("burn", 4) },
+{ std::string_view("burneth", 7), std::string_view("burn", 4) },
+{ std::string_view("burning", 7), std::string_view("burn", 4) },
+{ std::string_view("burnings", 8), std::string_view("burn", 4) },
+{ std::string_view("burnt", 5), std::string_view("burn", 4) },
+{ std::string_view("bursting", 8), std::string_view("burst", 5) },
+{ std::string_view("burying", 7), std::string_view("bury", 4) },
+{ std::string_view("bushes", 6), std::string_view("bush", 4) },
+{ std::string_view("busybodies", 10), std::string_view("busybody", 8) },
+{ std::string_view("butlers", 7), std::string_view("butler", 6) },
+{ std::string_view("buyer", 5), std::string_view("buy", 3) },
+{ std::string_view("buyest", 6), std::string_view("buy", 3) },
+{ std::string_view("buyeth", 6), std::string_view("buy", 3) },
+{ std::string_view("cakes", 5), std::string_view("cake", 4) },
+{ std::string_view("caldrons", 8), std::string_view("caldron", 7) },
+{ std::string_view("called", 6), std::string_view("call", 4) },
+{ std::string_view("calledst", 8), std::string_view("call", 4) },
+{ std::string_view("callest", 7), std::string_view("call", 4) },
+{ std::string_view("calleth", 7), std::string_view("call", 4) },
+{ std::string_view("calling", 7), std::string_view("call", 4) },
+{ std::string_view("calved", 6), std::string_view("calve", 5) },
+{ std::string_view("calves", 6), std::string_view("calve", 5) },
+{ std::string_view("calveth", 7), std::string_view("calve", 5) },
+{ std::string_view("camest", 6), std::string_view("came", 4) },
+{ std::string_view("camels", 6), std::string_view("camel", 5) },
+{ std::string_view("camped", 6), std::string_view("camp", 4) },
+{ std::string_view("camps", 5), std::string_view("camp", 4) },
+{ std::string_view("canaanite", 9), std::string_view("canaan", 6) },
+{ std::string_view("canaanites", 10), std::string_view("canaanite", 9) },
+{ std::string_view("canaanitess", 11), std::string_view("canaanites", 10) },
+{ std::string_view("candles", 7), std::string_view("candle", 6) },
+{ std::string_view("candlesticks", 12), std::string_view("candlestick", 11) },
+{ std::string_view("cankered", 8), std::string_view("canker", 6) },
+{ std::string_view("caphtorims", 10), std::string_view("caphtorim", 9) },
+{ std::string_view("capitals", 8), std::string_view("capital", 7) },
+{ std::string_view("captains", 8), std::string_view("captain", 7) },
+{ std::string_view("captivated", 10), std::string_view("captivate", 9) },
+{ std::string_view("captives", 8), std::string_view("captive", 7) },
+{ std::string_view("caravans", 8), std::string_view("caravan", 7) },
+{ std::string_view("carbuncles", 10), std::string_view("carbuncle", 9) },
+{ std::string_view("carcases", 8), std::string_view("carcas", 6) },
+{ std::string_view("carcass", 7), std::string_view("carcas", 6) },
+{ std::string_view("carcasses", 9), std::string_view("carcass", 7) },
+{ std::string_view("cared", 5), std::string_view("car", 3) },
+{ std::string_view("cares", 5), std::string_view("car", 3) },
+{ std::string_view("carest", 6), std::string_view("care", 4) },
+{ std::string_view("caring", 6), std::string_view("car", 3) },
+{ std::string_view("carmelite", 9), std::string_view("carmel", 6) },
+{ std::string_view("carousings", 10), std::string_view("carousing", 9) },
+{ std::string_view("carpenters", 10), std::string_view("carpenter", 9) },
+{ std::string_view("carriages", 9), std::string_view("carriage", 8) },
+{ std::string_view("carrying", 8), std::string_view("carry", 5) },
+{ std::string_view("carts", 5), std::string_view("cart", 4) },
+{ std::string_view("carvings", 8), std::string_view("carving", 7) },
+{ std::string_view("cases", 5), std::string_view("case", 4) },
+{ std::string_view("castest", 7), std::string_view("casts", 5) },
+{ std::string_view("casting", 7), std::string_view("cast", 4) },
+{ std::string_view("castles", 7), std::string_view("castle", 6) },
+{ std::string_view("casts", 5), std::string_view("cast", 4) },
+{ std::string_view("catches", 7), std::string_view("catch", 5) },
+{ std::string_view("caterpillers", 12), std::string_view("caterpiller", 11) },
+{ std::string_view("cauls", 5), std::string_view("caul", 4) },
+{ std::string_view("caused", 6), std::string_view("cause", 5) },
+{ std::string_view("causes", 6), std::string_view("cause", 5) },
+{ std::string_view("causest", 7), std::string_view("cause", 5) },
+{ std::string_view("causing", 7), std::string_view("cause", 5) },
+{ std::string_view("caves", 5), std::string_view("cave", 4) },
+{ std::string_view("ceased", 6), std::string_view("cease", 5) },
+{ std::string_view("ceases", 6), std::string_view("cease", 5) },
+{ std::string_view("ceasing", 7), std::string_view("cease", 5) },
+{ std::string_view("cedars", 6), std::string_view("cedar", 5) },
+{ std::string_view("ceilings", 8), std::string_view("ceiling", 7) },
+{ std::string_view("cellars", 7), std::string_view("cellar", 6) },
+{ std::string_view("cells", 5), std::string_view("cell", 4) },
+{ std::string_view("censers", 7), std::string_view("censer", 6) },
+{ std::string_view("centurions", 10), std::string_view("centurion", 9) },
+{ std::string_view("chains", 6), std::string_view("chain", 5) },
+{ std::string_view("chaldeans", 9), std::string_view("chaldean", 8) },
+{ std::string_view("chambering", 10), std::string_view("chamber", 7) },
+{ std::string_view("chamberlains", 12), std::string_view("chamberlain", 11) },
+{ std::string_view("chambers", 8), std::string_view("chamber", 7) },
+{ std::string_view("changed", 7), std::string_view("change", 6) },
+{ std::string_view("changes", 7), std::string_view("change", 6) },
+{ std::string_view("changest", 8), std::string_view("change", 6) },
+{ std::string_view("changing", 8), std::string_view("change", 6) },
+{ std::string_view("channels", 8), std::string_view("channel", 7) },
+{ std::string_view("chapiters", 9), std::string_view("chapiter", 8) },
+{ std::string_view("charged", 7), std::string_view("charge", 6) },
+{ std::string_view("chargers", 8), std::string_view("charger", 7) },
+{ std::string_view("charges", 7), std::string_view("charge", 6) },
+{ std::string_view("chargest", 8), std::string_view("charge", 6) },
+{ std::string_view("charging", 8), std::string_view("charge", 6) },
+{ std::string_view("chariots", 8), std::string_view("chariot", 7) },
+{ std::string_view("charmed", 7), std::string_view("charm", 5) },
+{ std::string_view("charmers", 8), std::string_view("charmer", 7) },
+{ std::string_view("charming", 8), std::string_view("charm", 5) },
+{ std::string_view("chased", 6), std::string_view("chase", 5) },
+{ std::string_view("chases", 6), std::string_view("chase", 5) },
+{ std::string_view("chasing", 7), std::string_view("chase", 5) },
+{ std::string_view("chastened", 9), std::string_view("chasten", 7) },
+{ std::string_view("chastenest", 10), std::string_view("chastens", 8) },
+{ std::string_view("chastening", 10), std::string_view("chasten", 7) },
+{ std::string_view("chastens", 8), std::string_view("chasten", 7) },
+{ std::string_view("chastised", 9), std::string_view("chastise", 8) },
+{ std::string_view("chattering", 10), std::string_view("chatter", 7) },
+{ std::string_view("checked", 7), std::string_view("check", 5) },
+{ std::string_view("cheeks", 6), std::string_view("cheek", 5) },
+{ std::string_view("cheered", 7), std::string_view("cheer", 5) },
+{ std::string_view("cheers", 6), std::string_view("cheer", 5) },
+{ std::string_view("cheeses", 7), std::string_view("cheese", 6) },
+{ std::string_view("cherished", 9), std::string_view("cherish", 7) },
+{ std::string_view("cherishes", 9), std::string_view("cherish", 7) },
+{ std::string_view("cherubims", 9), std::string_view("cherubim", 8) },
+{ std::string_view("cherubs", 7), std::string_view("cherub", 6) },
+{ std::string_view("chests", 6), std::string_view("chest", 5) },
+{ std::string_view("chewed", 6), std::string_view("chew", 4) },
+{ std::string_view("chews", 5), std::string_view("chew", 4) },
+{ std::string_view("chiding", 7), std::string_view("chide", 5) },
+{ std::string_view("chiefest", 8), std::string_view("chiefs", 6) },
+{ std::string_view("chiefing", 8), std::string_view("chief", 5) },
+{ std::string_view("chiefs", 6), std::string_view("chief", 5) },
+{ std::string_view("chieftains", 10), std::string_view("chieftain", 9) },
+{ std::string_view("chirped", 7), std::string_view("chirp", 5) },
+{ std::string_view("chiseled", 8), std::string_view("chisel", 6) },
+{ std::string_view("chiseling", 9), std::string_view("chisel", 6) },
+{ std::string_view("choicest", 8), std::string_view("choice", 6) },
+{ std::string_view("choked", 6), std::string_view("choke", 5) },
+{ std::string_view("chooses", 7), std::string_view("choose", 6) },
+{ std::string_view("choosest", 8), std::string_view("choose", 6) },
+{ std::string_view("choosing", 8), std::string_view("choose", 6) },
+{ std::string_view("christians", 10), std::string_view("christian", 9) },
+{ std::string_view("christs", 7), std::string_view("christ", 6) },
+{ std::string_view("churches", 8), std::string_view("church", 6) },
+{ std::string_view("chuzas", 6), std::string_view("chuza", 5) },
+{ std::string_view("circled", 7), std::string_view("circle", 6) },
+{ std::string_view("circuits", 8), std::string_view("circuit", 7) },
+{ std::string_view("circumcised", 11), std::string_view("circumcise", 10) },
+{ std::string_view("circumcising", 12), std::string_view("circumcise", 10) },
+{ std::string_view("cisterns", 8), std::string_view("cistern", 7) },
+{ std::string_view("citizens", 8), std::string_view("citizen", 7) },
+{ std::string_view("claimed", 7), std::string_view("claim", 5) },
+{ std::string_view("claps", 5), std::string_view("clap", 4) },
+{ std::string_view("clasps", 6), std::string_view("clasp", 5) },
+{ std::string_view("cleansed", 8), std::string_view("cleanse", 7) },
+{ std::string_view("cleanses", 8), std::string_view("cleanse", 7) },
+{ std::string_view("cleansing", 9), std::string_view("cleanse", 7) },
+{ std::string_view("cleared", 7), std::string_view("clear", 5) },
+{ std::string_view("clearing", 8), std::string_view("clear", 5) },
+{ std::string_view("clears", 6), std::string_view("clear", 5) },
+{ std::string_view("cleaved", 7), std::string_view("cleave", 6) },
+{ std::string_view("cleaves", 7), std::string_view("cleave", 6) },
+{ std::string_view("clefts", 6), std::string_view("cleft", 5) },
+{ std::string_view("clifts", 6), std::string_view("clift", 5) },
+{ std::string_view("climbed", 7), std::string_view("climb", 5) },
+{ std::string_view("climbs", 6), std::string_view("climb", 5) },
+{ std::string_view("clings", 6), std::string_view("cling", 5) },
+{ std::string_view("cloaks", 6), std::string_view("cloak", 5) },
+{ std::string_view("closed", 6), std::string_view("close", 5) },
+{ std::string_view("closes", 6), std::string_view("close", 5) },
+{ std::string_view("closest", 7), std::string_view("close", 5) },
+{ std::string_view("closets", 7), std::string_view("closet", 6) },
+{ std::string_view("clothed", 7), std::string_view("cloth", 5) },
+{ std::string_view("clothes", 7), std::string_view("cloth", 5) },
+{ std::string_view("clothest", 8), std::string_view("clothe", 6) },
+{ std::string_view("clothing", 8), std::string_view("cloth", 5) },
+{ std::string_view("cloths", 6), std::string_view("cloth", 5) },
+{ std::string_view("clouds", 6), std::string_view("cloud", 5) },
+{ std::string_view("clubs", 5), std::string_view("club", 4) },
+{ std::string_view("clusters", 8), std::string_view("cluster", 7) },
+{ std::string_view("coals", 5), std::string_view("coal", 4) },
+{ std::string_view("coasts", 6), std::string_view("coast", 5) },
+{ std::string_view("coated", 6), std::string_view("coat", 4) },
+{ std::string_view("coats", 5), std::string_view("coat", 4) },
+{ std::string_view("cockatrices", 11), std::string_view("cockatrice", 10) },
+{ std::string_view("collapsed", 9), std::string_view("collapse", 8) },
+{ std::string_view("collars", 7), std::string_view("collar", 6) },
+{ std::string_view("collected", 9), std::string_view("collect", 7) },
+{ std::string_view("collections", 11), std::string_view("collection", 10) },
+{ std::string_view("collectors", 10), std::string_view("collector", 9) },
+{ std::string_view("colored", 7), std::string_view("color", 5) },
+{ std::string_view("colors", 6), std::string_view("color", 5) },
+{ std::string_view("coloured", 8), std::string_view("colour", 6) },
+{ std::string_view("colours", 7), std::string_view("colour", 6) },
+{ std::string_view("colts", 5), std::string_view("colt", 4) },
+{ std::string_view("comes", 5), std::string_view("come", 4) },
+{ std::string_view("comest", 6), std::string_view("come", 4) },
+{ std::string_view("comforted", 9), std::string_view("comfort", 7) },
+{ std::string_view("comforters", 10), std::string_view("comforter", 9) },
+{ std::string_view("comforts", 8), std::string_view("comfort", 7) },
+{ std::string_view("coming", 6), std::string_view("come", 4) },
+{ std::string_view("comings", 7), std::string_view("coming", 6) },
+{ std::string_view("commanded", 9), std::string_view("command", 7) },
+{ std::string_view("commandest", 10), std::string_view("commands", 8) },
+{ std::string_view("commanding", 10), std::string_view("command", 7) },
+{ std::string_view("commandments", 12), std::string_view("commandment", 11) },
+{ std::string_view("commands", 8), std::string_view("command", 7) },
+{ std::string_view("commended", 9), std::string_view("commend", 7) },
+{ std::string_view("commending", 10), std::string_view("commend", 7) },
+{ std::string_view("commends", 8), std::string_view("commend", 7) },
+{ std::string_view("commissions", 11), std::string_view("commission", 10) },
+{ std::string_view("commits", 7), std::string_view("commit", 6) },
+{ std::string_view("commotions", 10), std::string_view("commotion", 9) },
+{ std::string_view("communed", 8), std::string_view("commune", 7) },
+{ std::string_view("communicated", 12), std::string_view("communicate", 11) },
+{ std::string_view("communications", 14), std::string_view("communication", 13) },
+{ std::string_view("communing", 9), std::string_view("commune", 7) },
+{ std::string_view("compacted", 9), std::string_view("compact", 7) },
+{ std::string_view("companions", 10), std::string_view("companion", 9) },
+{ std::string_view("compared", 8), std::string_view("compare", 7) },
+{ std::string_view("comparing", 9), std::string_view("compare", 7) },
+{ std::string_view("compassed", 9), std::string_view("compass", 7) },
+{ std::string_view("compasses", 9), std::string_view("compass", 7) },
+{ std::string_view("compassing", 10), std::string_view("compass", 7) },
+{ std::string_view("compassions", 11), std::string_view("compassion", 10) },
+{ std::string_view("compels", 7), std::string_view("compel", 6) },
+{ std::string_view("complained", 10), std::string_view("complain", 8) },
+{ std::string_view("complaining", 11), std::string_view("complain", 8) },
+{ std::string_view("complaints", 10), std::string_view("complaint", 9) },
+{ std::string_view("completed", 9), std::string_view("complete", 8) },
+{ std::string_view("compounded", 10), std::string_view("compound", 8) },
+{ std::string_view("compounds", 9), std::string_view("compound", 8) },
+{ std::string_view("comprehended", 12), std::string_view("comprehend", 10) },
+{ std::string_view("concealed", 9), std::string_view("conceal", 7) },
+{ std::string_view("conceals", 8), std::string_view("conceal", 7) },
+{ std::string_view("conceited", 9), std::string_view("conceit", 7) },
+{ std::string_view("conceits", 8), std::string_view("conceit", 7) },
+{ std::string_view("conceived", 9), std::string_view("conceive", 8) },
+{ std::string_view("conceiving", 10), std::string_view("conceive", 8) },
+{ std::string_view("concerned", 9), std::string_view("concern", 7) },
+{ std::string_view("concerning", 10), std::string_view("concern", 7) },
+{ std::string_view("concerns", 8), std::string_view("concern", 7) },
+{ std::string_view("concluded", 9), std::string_view("conclude", 8) },
+{ std::string_view("concluding", 10), std::string_view("conclude", 8) },
+{ std::string_view("concubines", 10), std::string_view("concubine", 9) },
+{ std::string_view("condemned", 9), std::string_view("condemn", 7) },
+{ std::string_view("condemnest", 10), std::string_view("condemns", 8) },
+{ std::string_view("condemning", 10), std::string_view("condemn", 7) },
+{ std::string_view("condemns", 8), std::string_view("condemn", 7) },
+{ std::string_view("conditions", 10), std::string_view("condition", 9) },
+{ std::string_view("conducted", 9), std::string_view("conduct", 7) },
+{ std::string_view("conducting", 10), std::string_view("conduct", 7) },
+{ std::string_view("confections", 11), std::string_view("confection", 10) },
+{ std::string_view("confessed", 9), std::string_view("confess", 7) },
+{ std::string_view("confesses", 9), std::string_view("confess", 7) },
+{ std::string_view("confessing", 10), std::string_view("confess", 7) },
+{ std::string_view("confidences", 11), std::string_view("confidence", 10) },
+{ std::string_view("confirmed", 9), std::string_view("confirm", 7) },
+{ std::string_view("confirming", 10), std::string_view("confirm", 7) },
+{ std::string_view("confirms", 8), std::string_view("confirm", 7) },
+{ std::string_view("confounded", 10), std::string_view("confound", 8) },
+{ std::string_view("confused", 8), std::string_view("confuse", 7) },
+{ std::string_view("confusing", 9), std::string_view("confuse", 7) },
+{ std::string_view("congregations", 13), std::string_view("congregation", 12) },
+{ std::string_view("conquering", 10), std::string_view("conquer", 7) },
+{ std::string_view("consciences", 11), std::string_view("conscience", 10) },
+{ std::string_view("consecrated", 11), std::string_view("consecrate", 10) },
+{ std::string_view("consecrations", 13), std::string_view("consecration", 12) },
+{ std::string_view("consented", 9), std::string_view("consent", 7) },
+{ std::string_view("consenting", 10), std::string_view("consent", 7) },
+{ std::string_view("considered", 10), std::string_view("consider", 8) },
+{ std::string_view("considerest", 11), std::string_view("considers", 9) },
+{ std::string_view("considering", 11), std::string_view("consider", 8) },
+{ std::string_view("considers", 9), std::string_view("consider", 8) },
+{ std::string_view("consolations", 12), std::string_view("consolation", 11) },
+{ std::string_view("consoled", 8), std::string_view("console", 7) },
+{ std::string_view("consoling", 9), std::string_view("console", 7) },
+{ std::string_view("conspired", 9), std::string_view("conspire", 8) },
+{ std::string_view("constrained", 11), std::string_view("constrain", 9) },
+{ std::string_view("constrains", 10), std::string_view("constrain", 9) },
+{ std::string_view("consulted", 9), std::string_view("consult", 7) },
+{ std::string_view("consumed", 8), std::string_view("consume", 7) },
+{ std::string_view("consumes", 8), std::string_view("consume", 7) },
+{ std::string_view("consuming", 9), std::string_view("consume", 7) },
+{ std::string_view("contained", 9), std::string_view("contain", 7) },
+{ std::string_view("containers", 10), std::string_view("container", 9) },
+{ std::string_view("containing", 10), std::string_view("contain", 7) },
+{ std::string_view("contains", 8), std::string_view("contain", 7) },
+{ std::string_view("contemned", 9), std::string_view("contemn", 7) },
+{ std::string_view("contended", 9), std::string_view("contend", 7) },
+{ std::string_view("contendest", 10), std::string_view("contends", 8) },
+{ std::string_view("contending", 10), std::string_view("contend", 7) },
+{ std::string_view("contends", 8), std::string_view("contend", 7) },
+{ std::string_view("contentions", 11), std::string_view("contention", 10) },
+{ std::string_view("continued", 9), std::string_view("continue", 8) },
+{ std::string_view("continues", 9), std::string_view("continue", 8) },
+{ std::string_view("continuing", 10), std::string_view("continue", 8) },
+{ std::string_view("contradicted", 12), std::string_view("contradict", 10) },
+{ std::string_view("contradicting", 13), std::string_view("contradict", 10) },
+{ std::string_view("controls", 8), std::string_view("control", 7) },
+{ std::string_view("converted", 9), std::string_view("convert", 7) },
+{ std::string_view("converting", 10), std::string_view("convert", 7) },
+{ std::string_view("converts", 8), std::string_view("convert", 7) },
+{ std::string_view("conveyed", 8), std::string_view("convey", 6) },
+{ std::string_view("convicted", 9), std::string_view("convict", 7) },
+{ std::string_view("convicts", 8), std::string_view("convict", 7) },
+{ std::string_view("convinced", 9), std::string_view("convince", 8) },
+{ std::string_view("convocations", 12), std::string_view("convocation", 11) },
+{ std::string_view("cooks", 5), std::string_view("cook", 4) },
+{ std::string_view("coping", 6), std::string_view("copy", 4) },
+{ std::string_view("cord", 4), std::string_view("cor", 3) },
+{ std::string_view("cords", 5), std::string_view("cord", 4) },
+{ std::string_view("corners", 7), std::string_view("corner", 6) },
+{ std::string_view("cornets", 7), std::string_view("cornet", 6) },
+{ std::string_view("corpses", 7), std::string_view("corpse", 6) },
+{ std::string_view("corrected", 9), std::string_view("correct", 7) },
+{ std::string_view("correcting", 10), std::string_view("correct", 7) },
+{ std::string_view("corrects", 8), std::string_view("correct", 7) },
+{ std::string_view("corrupted", 9), std::string_view("corrupt", 7) },
+{ std::string_view("corrupting", 10), std::string_view("corrupt", 7) },
+{ std::string_view("cors", 4), std::string_view("cor", 3) },
+{ std::string_view("costs", 5), std::string_view("cost", 4) },
+{ std::string_view("cotes", 5), std::string_view("cot", 3) },
+{ std::string_view("cots", 4), std::string_view("cot", 3) },
+{ std::string_view("cottages", 8), std::string_view("cottage", 7) },
+{ std::string_view("couched", 7), std::string_view("couch", 5) },
+{ std::string_view("couches", 7), std::string_view("couch", 5) },
+{ std::string_view("couching", 8), std::string_view("couch", 5) },
+{ std::string_view("couldest", 8), std::string_view("couldn", 6) },
+{ std::string_view("coulding", 8), std::string_view("could", 5) },
+{ std::string_view("coulters", 8), std::string_view("coulter", 7) },
+{ std::string_view("councils", 8), std::string_view("council", 7) },
+{ std::string_view("counseled", 9), std::string_view("counsel", 7) },
+{ std::string_view("counsellors", 11), std::string_view("counsellor", 10) },
+{ std::string_view("counselors", 10), std::string_view("counselor", 9) },
+{ std::string_view("counsels", 8), std::string_view("counsel", 7) },
+{ std::string_view("counted", 7), std::string_view("count", 5) },
+{ std::string_view("countenances", 12), std::string_view("countenance", 11) },
+{ std::string_view("counting", 8), std::string_view("count", 5) },
+{ std::string_view("counts", 6), std::string_view("count", 5) },
+{ std::string_view("coupled", 7), std::string_view("couple", 6) },
+{ std::string_view("coupling", 8), std::string_view("couple", 6) },
+{ std::string_view("couplings", 9), std::string_view("coupling", 8) },
+{ std::string_view("courses", 7), std::string_view("course", 6) },
+{ std::string_view("courts", 6), std::string_view("court", 5) },
+{ std::string_view("cousins", 7), std::string_view("cousin", 6) },
+{ std::string_view("covenanted", 10), std::string_view("covenant", 8) },
+{ std::string_view("covenants", 9), std::string_view("covenant", 8) },
+{ std::string_view("covered", 7), std::string_view("cover", 5) },
+{ std::string_view("coverest", 8), std::string_view("covers", 6) },
+{ std::string_view("covering", 8), std::string_view("cover", 5) },
+{ std::string_view("coverings", 9), std::string_view("covering", 8) },
+{ std::string_view("covers", 6), std::string_view("cover", 5) },
+{ std::string_view("coverts", 7), std::string_view("covert", 6) },
+{ std::string_view("coveted", 7), std::string_view("covet", 5) },
+{ std::string_view("coveting", 8), std::string_view("covet", 5) },
+{ std::string_view("covetings", 9), std::string_view("coveting", 8) },
+{ std::string_view("cows", 4), std::string_view("cow", 3) },
+{ std::string_view("craved", 6), std::string_view("crave", 5) },
+{ std::string_view("craving", 7), std::string_view("crave", 5) },
+{ std::string_view("cravings", 8), std::string_view("craving", 7) },
+{ std::string_view("created", 7), std::string_view("create", 6) },
+{ std::string_view("creates", 7), std::string_view("create", 6) },
+{ std::string_view("creatures", 9), std::string_view("creature", 8) },
+{ std::string_view("credited", 8), std::string_view("credit", 6) },
+{ std::string_view("creditors", 9), std::string_view("creditor", 8) },
+{ std::string_view("creeks", 6), std::string_view("creek", 5) },
+{ std::string_view("creeping", 8), std::string_view("creep", 5) },
+{ std::string_view("creeps", 6), std::string_view("creep", 5) },
+{ std::string_view("cretes", 6), std::string_view("crete", 5) },
+{ std::string_view("criest", 6), std::string_view("crib", 4) },
+{ std::string_view("crimes", 6), std::string_view("crime", 5) },
+{ std::string_view("criminals", 9), std::string_view("criminal", 8) },
+{ std::string_view("crippled", 8), std::string_view("cripple", 7) },
+{ std::string_view("crooked", 7), std::string_view("crook", 5) },
+{ std::string_view("crops", 5), std::string_view("crop", 4) },
+{ std::string_view("crossed", 7), std::string_view("cross", 5) },
+{ std::string_view("crossing", 8), std::string_view("cross", 5) },
+{ std::string_view("crouches", 8), std::string_view("crouch", 6) },
+{ std::string_view("crowd", 5), std::string_view("crow", 4) },
+{ std::string_view("crowed", 6), std::string_view("crow", 4) },
+{ std::string_view("crowned", 7), std::string_view("crown", 5) },
+{ std::string_view("crownest", 8), std::string_view("crowns", 6) },
+{ std::string_view("crowning", 8), std::string_view("crown", 5) },
+{ std::string_view("crowns", 6), std::string_view("crown", 5) },
+{ std::string_view("crows", 5), std::string_view("crow", 4) },
+{ std::string_view("crucifying", 10), std::string_view("crucify", 7) },
+{ std::string_view("crushed", 7), std::string_view("crush", 5) },
+{ std::string_view("crushes", 7), std::string_view("crush", 5) },
+{ std::string_view("crying", 6), std::string_view("cry", 3) },
+{ std::string_view("cubits", 6), std::string_view("cubit", 5) },
+{ std::string_view("cubs", 4), std::string_view("cub", 3) },
+{ std::string_view("cupbearers", 10), std::string_view("cupbearer", 9) },
+{ std::string_view("cups", 4), std::string_view("cup", 3) },
+{ std::string_view("cured", 5), std::string_view("cure", 4) },
+{ std::string_view("cures", 5), std::string_view("cure", 4) },
+{ std::string_view("cursed", 6), std::string_view("curse", 5) },
+{ std::string_view("curses", 6), std::string_view("curse", 5) },
+{ std::string_view("cursest", 7), std::string_view("curse", 5) },
+{ std::string_view("cursing", 7), std::string_view("curse", 5) },
+{ std::string_view("cursings", 8), std::string_view("cursing", 7) },
+{ std::string_view("curtains", 8), std::string_view("curtain", 7) },
+{ std::string_view("cushions", 8), std::string_view("cushion", 7) },
+{ std::string_view("cushite", 7), std::string_view("cush", 4) },
+{ std::string_view("cushites", 8), std::string_view("cushite", 7) },
+{ std::string_view("customs", 7), std::string_view("custom", 6) },
+{ std::string_view("cuts", 4), std::string_view("cut", 3) },
+{ std::string_view("cuttings", 8), std::string_view("cutting", 7) },
+{ std::string_view("cymbals", 7), std::string_view("cymbal", 6) },
+{ std::string_view("cyrenians", 9), std::string_view("cyrenian", 8) },
+{ std::string_view("damsels", 7), std::string_view("damsel", 6) },
+{ std::string_view("danced", 6), std::string_view("dance", 5) },
+{ std::string_view("dances", 6), std::string_view("dance", 5) },
+{ std::string_view("dancing", 7), std::string_view("dance", 5) },
+{ std::string_view("dared", 5), std::string_view("dare", 4) },
+{ std::string_view("dares", 5), std::string_view("dare", 4) },
+{ std::string_view("daring", 6), std::string_view("dara", 4) },
+{ std::string_view("darkened", 8), std::string_view("darken", 6) },
+{ std::string_view("darkens", 7), std::string_view("darken", 6) },
+{ std::string_view("darking", 7), std::string_view("dark", 4) },
+{ std::string_view("darting", 7), std::string_view("dart", 4) },
+{ std::string_view("darts", 5), std::string_view("dart", 4) },
+{ std::string_view("dashed", 6), std::string_view("dash", 4) },
+{ std::string_view("dashes", 6), std::string_view("dash", 4) },
+{ std::string_view("daubed", 6), std::string_view("daub", 4) },
+{ std::string_view("daubing", 7), std::string_view("daub", 4) },
+{ std::string_view("daughters", 9), std::string_view("daughter", 8) },
+{ std::string_view("dawning", 7), std::string_view("dawn", 4) },
+{ std::string_view("dawns", 5), std::string_view("dawn", 4) },
+{ std::string_view("days", 4), std::string_view("day", 3) },
+{ std::string_view("deacons", 7), std::string_view("deacon", 6) },
+{ std::string_view("dealers", 7), std::string_view("dealer", 6) },
+{ std::string_view("dealest", 7), std::string_view("deals", 5) },
+{ std::string_view("dealing", 7), std::string_view("deal", 4) },
+{ std::string_view("dealings", 8), std::string_view("dealing", 7) },
+{ std::string_view("deals", 5), std::string_view("deal", 4) },
+{ std::string_view("deaths", 6), std::string_view("death", 5) },
+{ std::string_view("debates", 7), std::string_view("debate", 6) },
+{ std::string_view("debtors", 7), std::string_view("debtor", 6) },
+{ std::string_view("debts", 5), std::string_view("debt", 4) },
+{ std::string_view("decayed", 7), std::string_view("decay", 5) },
+{ std::string_view("decaying", 8), std::string_view("decay", 5) },
+{ std::string_view("deceased", 8), std::string_view("decease", 7) },
+{ std::string_view("deceits", 7), std::string_view("deceit", 6) },
+{ std::string_view("deceived", 8), std::string_view("deceive", 7) },
+{ std::string_view("deceivers", 9), std::string_view("deceiver", 8) },
+{ std::string_view("deceives", 8), std::string_view("deceive", 7) },
+{ std::string_view("deceiving", 9), std::string_view("deceive", 7) },
+{ std::string_view("deceivings", 10), std::string_view("deceiving", 9) },
+{ std::string_view("decided", 7), std::string_view("decide", 6) },
+{ std::string_view("decked", 6), std::string_view("deck", 4) },
+{ std::string_view("deckest", 7), std::string_view("decks", 5) },
+{ std::string_view("decking", 7), std::string_view("deck", 4) },
+{ std::string_view("decks", 5), std::string_view("deck", 4) },
+{ std::string_view("declared", 8), std::string_view("declare", 7) },
+{ std::string_view("declares", 8), std::string_view("declare", 7) },
+{ std::string_view("declaring", 9), std::string_view("declare", 7) },
+{ std::string_view("declined", 8), std::string_view("decline", 7) },
+{ std::string_view("declines", 8), std::string_view("decline", 7) },
+{ std::string_view("decorated", 9), std::string_view("decorate", 8) },
+{ std::string_view("decreased", 9), std::string_view("decrease", 8) },
+{ std::string_view("decreed", 7), std::string_view("decree", 6) },
+{ std::string_view("decrees", 7), std::string_view("decree", 6) },
+{ std::string_view("dedicated", 9), std::string_view("dedicate", 8) },
+{ std::string_view("dedicating", 10), std::string_view("dedicate", 8) },
+{ std::string_view("deeds", 5), std::string_view("deed", 4) },
+{ std::string_view("deeps", 5), std::string_view("deep", 4) },
+{ std::string_view("defeated", 8), std::string_view("defeat", 6) },
+{ std::string_view("defenced", 8), std::string_view("defence", 7) },
+{ std::string_view("defended", 8), std::string_view("defend", 6) },
+{ std::string_view("defending", 9), std::string_view("defend", 6) },
+{ std::string_view("defenses", 8), std::string_view("defense", 7) },
+{ std::string_view("defiled", 7), std::string_view("defile", 6) },
+{ std::string_view("defiles", 7), std::string_view("defile", 6) },
+{ std::string_view("defrauded", 9), std::string_view("defraud", 7) },
+{ std::string_view("degrees", 7), std::string_view("degree", 6) },
+{ std::string_view("delayed", 7), std::string_view("delay", 5) },
+{ std::string_view("delaying", 8), std::string_view("delay", 5) },
+{ std::string_view("delays", 6), std::string_view("delay", 5) },
+{ std::string_view("delicates", 9), std::string_view("delicate", 8) },
+{ std::string_view("delighted", 9), std::string_view("delight", 7) },
+{ std::string_view("delightest", 10), std::string_view("delights", 8) },
+{ std::string_view("delighting", 10), std::string_view("delight", 7) },
+{ std::string_view("delights", 8), std::string_view("delight", 7) },
+{ std::string_view("deliverances", 12), std::string_view("deliverance", 11) },
+{ std::string_view("delivered", 9), std::string_view("deliver", 7) },
+{ std::string_view("deliverest", 10), std::string_view("delivers", 8) },
+{ std::string_view("delivering", 10), std::string_view("deliver", 7) },
+{ std::string_view("delivers", 8), std::string_view("deliver", 7) },
+{ std::string_view("deluding", 8), std::string_view("delude", 6) },
+{ std::string_view("delusions", 9), std::string_view("delusion", 8) },
+{ std::string_view("demanded", 8), std::string_view("demand", 6) },
+{ std::string_view("demands", 7), std::string_view("demand", 6) },
+{ std::string_view("demons", 6), std::string_view("demon", 5) },
+{ std::string_view("denounced", 9), std::string_view("denounce", 8) },
+{ std::string_view("denounces", 9), std::string_view("denounce", 8) },
+{ std::string_view("dens", 4), std::string_view("den", 3) },
+{ std::string_view("denying", 7), std::string_view("deny", 4) },
+{ std::string_view("departed", 8), std::string_view("depart", 6) },
+{ std::string_view("departing", 9), std::string_view("depart", 6) },
+{ std::string_view("departs", 7), std::string_view("depart", 6) },
+{ std::string_view("depended", 8), std::string_view("depend", 6) },
+{ std::string_view("deposited", 9), std::string_view("deposit", 7) },
+{ std::string_view("deprived", 8), std::string_view("deprive", 7) },
+{ std::string_view("depths", 6), std::string_view("depth", 5) },
+{ std::string_view("derided", 7), std::string_view("deride", 6) },
+{ std::string_view("descendants", 11), std::string_view("descendant", 10) },
+{ std::string_view("descended", 9), std::string_view("descend", 7) },
+{ std::string_view("descending", 10), std::string_view("descend", 7) },
+{ std::string_view("described", 9), std::string_view("describe", 8) },
+{ std::string_view("deserted", 8), std::string_view("desert", 6) },
+{ std::string_view("deserting", 9), std::string_view("desert", 6) },
+{ std::string_view("deserts", 7), std::string_view("desert", 6) },
+{ std::string_view("deserves", 8), std::string_view("deserve", 7) },
+{ std::string_view("deserving", 9), std::string_view("deserve", 7) },
+{ std::string_view("desired", 7), std::string_view("desire", 6) },
+{ std::string_view("desires", 7), std::string_view("desire", 6) },
+{ std::string_view("desirest", 8), std::string_view("desire", 6) },
+{ std::string_view("desiring", 8), std::string_view("desire", 6) },
+{ std::string_view("desolations", 11), std::string_view("desolation", 10) },
+{ std::string_view("despaired", 9), std::string_view("despair", 7) },
+{ std::string_view("despised", 8), std::string_view("despise", 7) },
+{ std::string_view("despises", 8), std::string_view("despise", 7) },
+{ std::string_view("despisest", 9), std::string_view("despise", 7) },
+{ std::string_view("despising", 9), std::string_view("despise", 7) },
+{ std::string_view("despoiled", 9), std::string_view("despoil", 7) },
+{ std::string_view("destroyed", 9), std::string_view("destroy", 7) },
+{ std::string_view("destroyers", 10), std::string_view("destroyer", 9) },
+{ std::string_view("destroyest", 10), std::string_view("destroys", 8) },
+{ std::string_view("destroying", 10), std::string_view("destroy", 7) },
+{ std::string_view("destroys", 8), std::string_view("destroy", 7) },
+{ std::string_view("destructions", 12), std::string_view("destruction", 11) },
+{ std::string_view("detained", 8), std::string_view("detain", 6) },
+{ std::string_view("detected", 8), std::string_view("detect", 6) },
+{ std::string_view("determined", 10), std::string_view("determine", 9) },
+{ std::string_view("detested", 8), std::string_view("detest", 6) },
+{ std::string_view("detests", 7), std::string_view("detest", 6) },
+{ std::string_view("devices", 7), std::string_view("device", 6) },
+{ std::string_view("devils", 6), std::string_view("devil", 5) },
+{ std::string_view("devised", 7), std::string_view("devise", 6) },
+{ std::string_view("devises", 7), std::string_view("devise", 6) },
+{ std::string_view("devising", 8), std::string_view("devise", 6) },
+{ std::string_view("devoted", 7), std::string_view("devote", 6) },
+{ std::string_view("devotions", 9), std::string_view("devotion", 8) },
+{ std::string_view("devoured", 8), std::string_view("devour", 6) },
+{ std::string_view("devourest", 9), std::string_view("devours", 7) },
+{ std::string_view("devouring", 9), std::string_view("devour", 6) },
+{ std::string_view("devours", 7), std::string_view("devour", 6) },
+{ std::string_view("did", 3), std::string_view("di", 2) },
+{ std::string_view("didrachmas", 10), std::string_view("didrachma", 9) },
+{ std::string_view("died", 4), std::string_view("di", 2) },
+{ std::string_view("dies", 4), std::string_view("di", 2) },
+{ std::string_view("diest", 5), std::string_view("did", 3) },
+{ std::string_view("differences", 11), std::string_view("difference", 10) },
+{ std::string_view("differing", 9), std::string_view("differ", 6) },
+{ std::string_view("differs", 7), std::string_view("differ", 6) },
+{ std::string_view("digs", 4), std::string_view("dig", 3) },
+{ std::string_view("diing", 5), std::string_view("di", 2) },
+{ std::string_view("diminished", 10), std::string_view("diminish", 8) },
+{ std::string_view("diminishing", 11), std::string_view("diminish", 8) },
+{ std::string_view("dined", 5), std::string_view("dine", 4) },
+{ std::string_view("dips", 4), std::string_view("dip", 3) },
+{ std::string_view("directed", 8), std::string_view("direct", 6) },
+{ std::string_view("directing", 9), std::string_view("direct", 6) },
+{ std::string_view("directions", 10), std::string_view("direction", 9) },
+{ std::string_view("directs", 7), std::string_view("direct", 6) },
+{ std::string_view("disallowed", 10), std::string_view("disallow", 8) },
+{ std::string_view("disappointed", 12), std::string_view("disappoint", 10) },
+{ std::string_view("discerned", 9), std::string_view("discern", 7) },
+{ std::string_view("discerning", 10), std::string_view("discern", 7) },
+{ std::string_view("discerns", 8), std::string_view("discern", 7) },
+{ std::string_view("discharged", 10), std::string_view("discharge", 9) },
+{ std::string_view("disciples", 9), std::string_view("disciple", 8) },
+{ std::string_view("disciplines", 11), std::string_view("discipline", 10) },
+{ std::string_view("disclosed", 9), std::string_view("disclose", 8) },
+{ std::string_view("discloses", 9), std::string_view("disclose", 8) },
+{ std::string_view("discouraged", 11), std::string_view("discourage", 10) },
+{ std::string_view("discovered", 10), std::string_view("discover", 8) },
+{ std::string_view("discovering", 11), std::string_view("discover", 8) },
+{ std::string_view("diseased", 8), std::string_view("disease", 7) },
+{ std::string_view("diseases", 8), std::string_view("disease", 7) },
+{ std::string_view("disfigured", 10), std::string_view("disfigure", 9) },
+{ std::string_view("disgraced", 9), std::string_view("disgrace", 8) },
+{ std::string_view("disguised", 9), std::string_view("disguise", 8) },
+{ std::string_view("disguises", 9), std::string_view("disguise", 8) },
+{ std::string_view("dishes", 6), std::string_view("dish", 4) },
+{ std::string_view("dishoning", 9), std::string_view("dishon", 6) },
+{ std::string_view("dishonored", 10), std::string_view("dishonor", 8) },
+{ std::string_view("dishonors", 9), std::string_view("dishonor", 8) },
+{ std::string_view("dishonouring", 12), std::string_view("dishonour", 9) },
+{ std::string_view("dismayed", 8), std::string_view("dismay", 6) },
+{ std::string_view("dismaying", 9), std::string_view("dismay", 6) },
+{ std::string_view("dismissed", 9), std::string_view("dismiss", 7) },
+{ std::string_view("disobeyed", 9), std::string_view("disobey", 7) },
+{ std::string_view("disobeys", 8), std::string_view("disobey", 7) },
+{ std::string_view("dispatched", 10), std::string_view("dispatch", 8) },
+{ std::string_view("dispersed", 9), std::string_view("disperse", 8) },
+{ std::string_view("dispersions", 11), std::string_view("dispersion", 10) },
+{ std::string_view("displayed", 9), std::string_view("display", 7) },
+{ std::string_view("displays", 8), std::string_view("display", 7) },
+{ std::string_view("displeased", 10), std::string_view("displease", 9) },
+{ std::string_view("dispossessed", 12), std::string_view("dispossess", 10) },
+{ std::string_view("dispossessing", 13), std::string_view("dispossess", 10) },
+{ std::string_view("disputations", 12), std::string_view("disputation", 11) },
+{ std::string_view("disputed", 8), std::string_view("dispute", 7) },
+{ std::string_view("disputes", 8), std::string_view("dispute", 7) },
+{ std::string_view("disputing", 9), std::string_view("dispute", 7) },
+{ std::string_view("disputings", 10), std::string_view("disputing", 9) },
+{ std::string_view("disquieted", 10), std::string_view("disquiet", 8) },
+{ std::string_view("dissolved", 9), std::string_view("dissolve", 8) },
+{ std::string_view("dissolvest", 10), std::string_view("dissolve", 8) },
+{ std::string_view("dissolving", 10), std::string_view("dissolve", 8) },
+{ std::string_view("distressed", 10), std::string_view("distress", 8) },
+{ std::string_view("distresses", 10), std::string_view("distress", 8) },
+{ std::string_view("distributed", 11), std::string_view("distribute", 10) },
+{ std::string_view("distributes", 11), std::string_view("distribute", 10) },
+{ std::string_view("distributing", 12), std::string_view("distribute", 10) },
+{ std::string_view("disturbances", 12), std::string_view("disturbance", 11) },
+{ std::string_view("disturbed", 9), std::string_view("disturb", 7) },
+{ std::string_view("ditches", 7), std::string_view("ditch", 5) },
+{ std::string_view("divided", 7), std::string_view("divide", 6) },
+{ std::string_view("divides", 7), std::string_view("divide", 6) },
+{ std::string_view("dividing", 8), std::string_view("divide", 6) },
+{ std::string_view("divinations", 11), std::string_view("divination", 10) },
+{ std::string_view("divined", 7), std::string_view("divine", 6) },
+{ std::string_view("diviners", 8), std::string_view("diviner", 7) },
+{ std::string_view("divines", 7), std::string_view("divine", 6) },
+{ std::string_view("divining", 8), std::string_view("divine", 6) },
+{ std::string_view("divisions", 9), std::string_view("division", 8) },
+{ std::string_view("divorced", 8), std::string_view("divorce", 7) },
+{ std::string_view("divorces", 8), std::string_view("divorce", 7) },
+{ std::string_view("doctors", 7), std::string_view("doctor", 6) },
+{ std::string_view("doctrines", 9), std::string_view("doctrine", 8) },
+{ std::string_view("doers", 5), std::string_view("doer", 4) },
+{ std::string_view("does", 4), std::string_view("do", 2) },
+{ std::string_view("doest", 5), std::string_view("doe", 3) },
+{ std::string_view("dogs", 4), std::string_view("dog", 3) },
+{ std::string_view("doing", 5), std::string_view("do", 2) },
+{ std::string_view("doings", 6), std::string_view("doing", 5) },
+{ std::string_view("dominions", 9), std::string_view("dominion", 8) },
+{ std::string_view("donkeys", 7), std::string_view("donkey", 6) },
+{ std::string_view("doomed", 6), std::string_view("doom", 4) },
+{ std::string_view("doorkeepers", 11), std::string_view("doorkeeper", 10) },
+{ std::string_view("doors", 5), std::string_view("door", 4) },
+{ std::string_view("doted", 5), std::string_view("dote", 4) },
+{ std::string_view("doting", 6), std::string_view("dote", 4) },
+{ std::string_view("doubled", 7), std::string_view("double", 6) },
+{ std::string_view("doubted", 7), std::string_view("doubt", 5) },
+{ std::string_view("doubting", 8), std::string_view("doubt", 5) },
+{ std::string_view("doubts", 6), std::string_view("doubt", 5) },
+{ std::string_view("doves", 5), std::string_view("dove", 4) },
+{ std::string_view("dragons", 7), std::string_view("dragon", 6) },
+{ std::string_view("drained", 7), std::string_view("drain", 5) },
+{ std::string_view("drawers", 7), std::string_view("drawer", 6) },
+{ std::string_view("drawing", 7), std::string_view("draw", 4) },
+{ std::string_view("draws", 5), std::string_view("draw", 4) },
+{ std::string_view("dreaded", 7), std::string_view("dread", 5) },
+{ std::string_view("dreamed", 7), std::string_view("dream", 5) },
+{ std::string_view("dreamers", 8), std::string_view("dreamer", 7) },
+{ std::string_view("dreaming", 8), std::string_view("dream", 5) },
+{ std::string_view("dreams", 6), std::string_view("dream", 5) },
+{ std::string_view("dressed", 7), std::string_view("dress", 5) },
+{ std::string_view("dressers", 8), std::string_view("dresser", 7) },
+{ std::string_view("dressing", 8), std::string_view("dress", 5) },
+{ std::string_view("drewing", 7), std::string_view("drew", 4) },
+{ std::string_view("drinkers", 8), std::string_view("drinker", 7) },
+{ std::string_view("drinking", 8), std::string_view("drink", 5) },
+{ std::string_view("drinks", 6), std::string_view("drink", 5) },
+{ std::string_view("drives", 6), std::string_view("drive", 5) },
+{ std::string_view("driving", 7), std::string_view("drive", 5) },
+{ std::string_view("droppings", 9), std::string_view("dropping", 8) },
+{ std::string_view("drops", 5), std::string_view("drop", 4) },
+{ std::string_view("droves", 6), std::string_view("drove", 5) },
+{ std::string_view("drowned", 7), std::string_view("drown", 5) },
+{ std::string_view("drunkards", 9), std::string_view("drunkard", 8) },
+{ std::string_view("dues", 4), std::string_view("due", 3) },
+{ std::string_view("dukes", 5), std::string_view("duke", 4) },
+{ std::string_view("dunghills", 9), std::string_view("dunghill", 8) },
+{ std::string_view("during", 6), std::string_view("dura", 4) },
+{ std::string_view("dwelled", 7), std::string_view("dwell", 5) },
+{ std::string_view("dwellest", 8), std::string_view("dwells", 6) },
+{ std::string_view("dwelling", 8), std::string_view("dwell", 5) },
+{ std::string_view("dwellingplaces", 14), std::string_view("dwellingplace", 13) },
+{ std::string_view("dwellings", 9), std::string_view("dwelling", 8) },
+{ std::string_view("dwells", 6), std::string_view("dwell", 5) },
+{ std::string_view("eagles", 6), std::string_view("eagle", 5) },
+{ std::string_view("eared", 5), std::string_view("ear", 3) },
+{ std::string_view("earing", 6), std::string_view("ear", 3) },
+{ std::string_view("earnest", 7), std::string_view("earns", 5) },
+{ std::string_view("earrings", 8), std::string_view("earring", 7) },
+{ std::string_view("ears", 4), std::string_view("ear", 3) },
+{ std::string_view("earthquakes", 11), std::string_view("earthquake", 10) },
+{ std::string_view("eased", 5), std::string_view("ease", 4) },
+{ std::string_view("eaters", 6), std::string_view("eater", 5) },
+{ std::string_view("eatest", 6), std::string_view("eats", 4) },
+{ std::string_view("eating", 6), std::string_view("eat", 3) },
+{ std::string_view("eats", 4), std::string_view("eat", 3) },
+{ std::string_view("edged", 5), std::string_view("edge", 4) },
+{ std::string_view("edges", 5), std::string_view("edge", 4) },
+{ std::string_view("edifying", 8), std::string_view("edify", 5) },
+{ std::string_view("edomite", 7), std::string_view("edom", 4) },
+{ std::string_view("edomites", 8), std::string_view("edomite", 7) },
+{ std::string_view("effected", 8), std::string_view("effect", 6) },
+{ std::string_view("eggs", 4), std::string_view("egg", 3) },
+{ std::string_view("egyptians", 9), std::string_view("egyptian", 8) },
+{ std::string_view("elders", 6), std::string_view("elder", 5) },
+{ std::string_view("elected", 7), std::string_view("elect", 5) },
+{ std::string_view("embalmed", 8), std::string_view("embalm", 6) },
+{ std::string_view("embraced", 8), std::string_view("embrace", 7) },
+{ std::string_view("embraces", 8), std::string_view("embrace", 7) },
+{ std::string_view("embracing", 9), std::string_view("embrace", 7) },
+{ std::string_view("embroidered", 11), std::string_view("embroider", 9) },
+{ std::string_view("emeralds", 8), std::string_view("emerald", 7) },
+{ std::string_view("emims", 5), std::string_view("emim", 4) },
+{ std::string_view("employed", 8), std::string_view("employ", 6) },
+{ std::string_view("emulations", 10), std::string_view("emulation", 9) },
+{ std::string_view("encamped", 8), std::string_view("encamp", 6) },
+{ std::string_view("encamping", 9), std::string_view("encamp", 6) },
+{ std::string_view("encamps", 7), std::string_view("encamp", 6) },
+{ std::string_view("enchanters", 10), std::string_view("enchanter", 9) },
+{ std::string_view("enchantments", 12), std::string_view("enchantment", 11) },
+{ std::string_view("enclosed", 8), std::string_view("enclose", 7) },
+{ std::string_view("encloses", 8), std::string_view("enclose", 7) },
+{ std::string_view("encompassed", 11), std::string_view("encompass", 9) },
+{ std::string_view("encompassing", 12), std::string_view("encompass", 9) },
+{ std::string_view("encountered", 11), std::string_view("encounter", 9) },
+{ std::string_view("encouraged", 10), std::string_view("encourage", 9) },
+{ std::string_view("encourages", 10), std::string_view("encourage", 9) },
+{ std::string_view("end", 3), std::string_view("en", 2) },
+{ std::string_view("endangered", 10), std::string_view("endanger", 8) },
+{ std::string_view("endeavoured", 11), std::string_view("endeavour", 9) },
+{ std::string_view("endeavouring", 12), std::string_view("endeavour", 9) },
+{ std::string_view("endeavours", 10), std::string_view("endeavour", 9) },
+{ std::string_view("ended", 5), std::string_view("end", 3) },
+{ std::string_view("ending", 6), std::string_view("end", 3) },
+{ std::string_view("endowed", 7), std::string_view("endow", 5) },
+{ std::string_view("ends", 4), std::string_view("end", 3) },
+{ std::string_view("endured", 7), std::string_view("endure", 6) },
+{ std::string_view("endures", 7), std::string_view("endure", 6) },
+{ std::string_view("enduring", 8), std::string_view("endure", 6) },
+{ std::string_view("engraved", 8), std::string_view("engrave", 7) },
+{ std::string_view("engraving", 9), std::string_view("engrave", 7) },
+{ std::string_view("engravings", 10), std::string_view("engraving", 9) },
+{ std::string_view("enjoined", 8), std::string_view("enjoin", 6) },
+{ std::string_view("enjoyed", 7), std::string_view("enjoy", 5) },
+{ std::string_view("enjoys", 6), std::string_view("enjoy", 5) },
+{ std::string_view("enlarged", 8), std::string_view("enlarge", 7) },
+{ std::string_view("enlarges", 8), std::string_view("enlarge", 7) },
+{ std::string_view("enlarging", 9), std::string_view("enlarge", 7) },
+{ std::string_view("enlightened", 11), std::string_view("enlighten", 9) },
+{ std::string_view("enlightening", 12), std::string_view("enlighten", 9) },
+{ std::string_view("enlightens", 10), std::string_view("enlighten", 9) },
+{ std::string_view("enquired", 8), std::string_view("enquire", 7) },
+{ std::string_view("enquirest", 9), std::string_view("enquire", 7) },
+{ std::string_view("enriched", 8), std::string_view("enrich", 6) },
+{ std::string_view("enriches", 8), std::string_view("enrich", 6) },
+{ std::string_view("enriching", 9), std::string_view("enrich", 6) },
+{ std::string_view("enrolled", 8), std::string_view("enroll", 6) },
+{ std::string_view("ensamples", 9), std::string_view("ensample", 8) },
+{ std::string_view("ensigns", 7), std::string_view("ensign", 6) },
+{ std::string_view("ensnared", 8), std::string_view("ensnare", 7) },
+{ std::string_view("entangled", 9), std::string_view("entangle", 8) },
+{ std::string_view("entangles", 9), std::string_view("entangle", 8) },
+{ std::string_view("entered", 7), std::string_view("enter", 5) },
+{ std::string_view("entering", 8), std::string_view("enter", 5) },
+{ std::string_view("enters", 6), std::string_view("enter", 5) },
+{ std::string_view("entertained", 11), std::string_view("entertain", 9) },
+{ std::string_view("enticed", 7), std::string_view("entice", 6) },
+{ std::string_view("entices", 7), std::string_view("entice", 6) },
+{ std::string_view("enticing", 8), std::string_view("entice", 6) },
+{ std::string_view("entrances", 9), std::string_view("entrance", 8) },
+{ std::string_view("entreated", 9), std::string_view("entreat", 7) },
+{ std::string_view("entreating", 10), std::string_view("entreat", 7) },
+{ std::string_view("entrusted", 9), std::string_view("entrust", 7) },
+{ std::string_view("envying", 7), std::string_view("envy", 4) },
+{ std::string_view("envyings", 8), std::string_view("envying", 7) },
+{ std::string_view("ephesians", 9), std::string_view("ephesian", 8) },
+{ std::string_view("ephraimite", 10), std::string_view("ephraim", 7) },
+{ std::string_view("ephraimites", 11), std::string_view("ephraimite", 10) },
+{ std::string_view("ephrathite", 10), std::string_view("ephrath", 7) },
+{ std::string_view("ephrathites", 11), std::string_view("ephrathite", 10) },
+{ std::string_view("epicureans", 10), std::string_view("epicurean", 9) },
+{ std::string_view("epileptics", 10), std::string_view("epileptic", 9) },
+{ std::string_view("epistles", 8), std::string_view("epistle", 7) },
+{ std::string_view("equals", 6), std::string_view("equal", 5) },
+{ std::string_view("erred", 5), std::string_view("err", 3) },
+{ std::string_view("errors", 6), std::string_view("error", 5) },
+{ std::string_view("errs", 4), std::string_view("err", 3) },
+{ std::string_view("escaped", 7), std::string_view("escape", 6) },
+{ std::string_view("escapes", 7), std::string_view("escape", 6) },
+{ std::string_view("escaping", 8), std::string_view("escape", 6) },
+{ std::string_view("eschewed", 8), std::string_view("eschew", 6) },
+{ std::string_view("established", 11), std::string_view("establish", 9) },
+{ std::string_view("establishes", 11), std::string_view("establish", 9) },
+{ std::string_view("establishing", 12), std::string_view("establish", 9) },
+{ std::string_view("estates", 7), std::string_view("estate", 6) },
+{ std::string_view("esteemed", 8), std::string_view("esteem", 6) },
+{ std::string_view("esteeming", 9), std::string_view("esteem", 6) },
+{ std::string_view("esteems", 7), std::string_view("esteem", 6) },
+{ std::string_view("estimations", 11), std::string_view("estimation", 10) },
+{ std::string_view("ethiopians", 10), std::string_view("ethiopian", 9) },
+{ std::string_view("eunuchs", 7), std::string_view("eunuch", 6) },
+{ std::string_view("euodias", 7), std::string_view("euodia", 6) },
+{ std::string_view("evangelists", 11), std::string_view("evangelist", 10) },
+{ std::string_view("evening", 7), std::string_view("even", 4) },
+{ std::string_view("evenings", 8), std::string_view("evening", 7) },
+{ std::string_view("evidences", 9), std::string_view("evidence", 8) },
+{ std::string_view("evildoers", 9), std::string_view("evildoer", 8) },
+{ std::string_view("evils", 5), std::string_view("evil", 4) },
+{ std::string_view("ewes", 4), std::string_view("ewe", 3) },
+{ std::string_view("exacted", 7), std::string_view("exact", 5) },
+{ std::string_view("exacting", 8), std::string_view("exact", 5) },
+{ std::string_view("exactions", 9), std::string_view("exaction", 8) },
+{ std::string_view("exacts", 6), std::string_view("exact", 5) },
+{ std::string_view("exalted", 7), std::string_view("exalt", 5) },
+{ std::string_view("exaltest", 8), std::string_view("exalts", 6) },
+{ std::string_view("exalting", 8), std::string_view("exalt", 5) },
+{ std::string_view("exalts", 6), std::string_view("exalt", 5) },
+{ std::string_view("examined", 8), std::string_view("examine", 7) },
+{ std::string_view("examines", 8), std::string_view("examine", 7) },
+{ std::string_view("examining", 9), std::string_view("examine", 7) },
+{ std::string_view("examples", 8), std::string_view("example", 7) },
+{ std::string_view("exceeded", 8), std::string_view("exceed", 6) },
+{ std::string_view("exceedest", 9), std::string_view("exceeds", 7) },
+{ std::string_view("exceeding", 9), std::string_view("exceed", 6) },
+{ std::string_view("exceeds", 7), std::string_view("exceed", 6) },
+{ std::string_view("excels", 6), std::string_view("excel", 5) },
+{ std::string_view("excepted", 8), std::string_view("except", 6) },
+{ std::string_view("exchanged", 9), std::string_view("exchange", 8) },
+{ std::string_view("exchanging", 10), std::string_view("exchange", 8) },
+{ std::string_view("excluded", 8), std::string_view("exclude", 7) },
+{ std::string_view("excused", 7), std::string_view("excuse", 6) },
+{ std::string_view("excuses", 7), std::string_view("excuse", 6) },
+{ std::string_view("excusing", 8), std::string_view("excuse", 6) },
+{ std::string_view("executed", 8), std::string_view("execute", 7) },
+{ std::string_view("executes", 8), std::string_view("execute", 7) },
+{ std::string_view("executest", 9), std::string_view("execute", 7) },
+{ std::string_view("executing", 9), std::string_view("execute", 7) },
+{ std::string_view("exempted", 8), std::string_view("exempt", 6) },
+{ std::string_view("exercised", 9), std::string_view("exercise", 8) },
+{ std::string_view("exercises", 9), std::string_view("exercise", 8) },
+{ std::string_view("exercising", 10), std::string_view("exercise", 8) },
+{ std::string_view("exhortations", 12), std::string_view("exhortation", 11) },
+{ std::string_view("exhorted", 8), std::string_view("exhort", 6) },
+{ std::string_view("exhorting", 9), std::string_view("exhort", 6) },
+{ std::string_view("exhorts", 7), std::string_view("exhort", 6) },
+{ std::string_view("exiles", 6), std::string_view("exile", 5) },
+{ std::string_view("existed", 7), std::string_view("exist", 5) },
+{ std::string_view("existing", 8), std::string_view("exist", 5) },
+{ std::string_view("exists", 6), std::string_view("exist", 5) },
+{ std::string_view("exits", 5), std::string_view("exit", 4) },
+{ std::string_view("expected", 8), std::string_view("expect", 6) },
+{ std::string_view("expecting", 9), std::string_view("expect", 6) },
+{ std::string_view("expenses", 8), std::string_view("expense", 7) },
+{ std::string_view("experienced", 11), std::string_view("experience", 10) },
+{ std::string_view("explained", 9), std::string_view("explain", 7) },
+{ std::string_view("explaining", 10), std::string_view("explain", 7) },
+{ std::string_view("explains", 8), std::string_view("explain", 7) },
+{ std::string_view("exploits", 8), std::string_view("exploit", 7) },
+{ std::string_view("expounded", 9), std::string_view("expound", 7) },
+{ std::string_view("expressed", 9), std::string_view("express", 7) },
+{ std::string_view("expressions", 11), std::string_view("expression", 10) },
+{ std::string_view("extended", 8), std::string_view("extend", 6) },
+{ std::string_view("extortioners", 12), std::string_view("extortioner", 11) },
+{ std::string_view("exulting", 8), std::string_view("exult", 5) },
+{ std::string_view("exults", 6), std::string_view("exult", 5) },
+{ std::string_view("eyed", 4), std::string_view("eye", 3) },
+{ std::string_view("eyes", 4), std::string_view("eye", 3) },
+{ std::string_view("ezrahite", 8), std::string_view("ezrah", 5) },
+{ std::string_view("faces", 5), std::string_view("face", 4) },
+{ std::string_view("fades", 5), std::string_view("fade", 4) },
+{ std::string_view("fading", 6), std::string_view("fade", 4) },
+{ std::string_view("failed", 6), std::string_view("fail", 4) },
+{ std::string_view("failing", 7), std::string_view("fail", 4) },
+{ std::string_view("fails", 5), std::string_view("fail", 4) },
+{ std::string_view("fainted", 7), std::string_view("faint", 5) },
+{ std::string_view("faintest", 8), std::string_view("faints", 6) },
+{ std::string_view("fainting", 8), std::string_view("faint", 5) },
+{ std::string_view("faints", 6), std::string_view("faint", 5) },
+{ std::string_view("fairest", 7), std::string_view("fairs", 5) },
+{ std::string_view("fairing", 7), std::string_view("fair", 4) },
+{ std::string_view("fairs", 5), std::string_view("fair", 4) },
+{ std::string_view("fallest", 7), std::string_view("falls", 5) },
+{ std::string_view("falling", 7), std::string_view("fall", 4) },
+{ std::string_view("falls", 5), std::string_view("fall", 4) },
+{ std::string_view("familiars", 9), std::string_view("familiar", 8) },
+{ std::string_view("famines", 7), std::string_view("famine", 6) },
+{ std::string_view("famished", 8), std::string_view("famish", 6) },
+{ std::string_view("fared", 5), std::string_view("far", 3) },
+{ std::string_view("farmers", 7), std::string_view("farmer", 6) },
+{ std::string_view("farming", 7), std::string_view("farm", 4) },
+{ std::string_view("farms", 5), std::string_view("farm", 4) },
+{ std::string_view("farthings", 9), std::string_view("farthing", 8) },
+{ std::string_view("fashioned", 9), std::string_view("fashion", 7) },
+{ std::string_view("fashioning", 10), std::string_view("fashion", 7) },
+{ std::string_view("fashions", 8), std::string_view("fashion", 7) },
+{ std::string_view("fasted", 6), std::string_view("fast", 4) },
+{ std::string_view("fastened", 8), std::string_view("fasten", 6) },
+{ std::string_view("fastening", 9), std::string_view("fasten", 6) },
+{ std::string_view("fastens", 7), std::string_view("fasten", 6) },
+{ std::string_view("fasting", 7), std::string_view("fast", 4) },
+{ std::string_view("fastings", 8), std::string_view("fasting", 7) },
+{ std::string_view("fathered", 8), std::string_view("father", 6) },
+{ std::string_view("fathers", 7), std::string_view("father", 6) },
+{ std::string_view("fathomed", 8), std::string_view("fathom", 6) },
+{ std::string_view("fathoms", 7), std::string_view("fathom", 6) },
+{ std::string_view("fatlings", 8), std::string_view("fatling", 7) },
+{ std::string_view("fats", 4), std::string_view("fat", 3) },
+{ std::string_view("faults", 6), std::string_view("fault", 5) },
+{ std::string_view("favored", 7), std::string_view("favor", 5) },
+{ std::string_view("favorite", 8), std::string_view("favor", 5) },
+{ std::string_view("favors", 6), std::string_view("favor", 5) },
+{ std::string_view("favoured", 8), std::string_view("favour", 6) },
+{ std::string_view("favouring", 9), std::string_view("favour", 6) },
+{ std::string_view("feared", 6), std::string_view("fear", 4) },
+{ std::string_view("fearest", 7), std::string_view("fears", 5) },
+{ std::string_view("fearing", 7), std::string_view("fear", 4) },
+{ std::string_view("fears", 5), std::string_view("fear", 4) },
+{ std::string_view("feasted", 7), std::string_view("feast", 5) },
+{ std::string_view("feasting", 8), std::string_view("feast", 5) },
+{ std::string_view("feasts", 6), std::string_view("feast", 5) },
+{ std::string_view("feedest", 7), std::string_view("feeds", 5) },
+{ std::string_view("feeding", 7), std::string_view("feed", 4) },
+{ std::string_view("feeds", 5), std::string_view("feed", 4) },
+{ std::string_view("feeling", 7), std::string_view("feel", 4) },
+{ std::string_view("feigned", 7), std::string_view("feign", 5) },
+{ std::string_view("feigning", 8), std::string_view("feign", 5) },
+{ std::string_view("felled", 6), std::string_view("fell", 4) },
+{ std::string_view("felling", 7), std::string_view("fell", 4) },
+{ std::string_view("fellowhelpers", 13), std::string_view("fellowhelper", 12) },
+{ std::string_view("fellowlabourers", 15), std::string_view("fellowlabourer", 14) },
+{ std::string_view("fellowprisoners", 15), std::string_view("fellowprisoner", 14) },
+{ std::string_view("fellows", 7), std::string_view("fellow", 6) },
+{ std::string_view("fellowservants", 14), std::string_view("fellowservant", 13) },
+{ std::string_view("fenced", 6), std::string_view("fence", 5) },
+{ std::string_view("fences", 6), std::string_view("fence", 5) },
+{ std::string_view("fetched", 7), std::string_view("fetch", 5) },
+{ std::string_view("fetches", 7), std::string_view("fetch", 5) },
+{ std::string_view("fewing", 6), std::string_view("few", 3) },
+{ std::string_view("fields", 6), std::string_view("field", 5) },
+{ std::string_view("fighting", 8), std::string_view("fight", 5) },
+{ std::string_view("fightings", 9), std::string_view("fighting", 8) },
+{ std::string_view("fights", 6), std::string_view("fight", 5) },
+{ std::string_view("figs", 4), std::string_view("fig", 3) },
+{ std::string_view("figured", 7), std::string_view("figure", 6) },
+{ std::string_view("figures", 7), std::string_view("figure", 6) },
+{ std::string_view("filled", 6), std::string_view("fill", 4) },
+{ std::string_view("fillest", 7), std::string_view("fills", 5) },
+{ std::string_view("filleted", 8), std::string_view("fillet", 6) },
+{ std::string_view("fillets", 7), std::string_view("fillet", 6) },
+{ std::string_view("filling", 7), std::string_view("fill", 4) },
+{ std::string_view("fills", 5), std::string_view("fill", 4) },
+{ std::string_view("findest", 7), std::string_view("finds", 5) },
+{ std::string_view("finding", 7), std::string_view("find", 4) },
+{ std::string_view("finds", 5), std::string_view("find", 4) },
+{ std::string_view("fined", 5), std::string_view("fine", 4) },
+{ std::string_view("finest", 6), std::string_view("find", 4) },
+{ std::string_view("fingers", 7), std::string_view("finger", 6) },
+{ std::string_view("fining", 6), std::string_view("find", 4) },
+{ std::string_view("finished", 8), std::string_view("finish", 6) },
+{ std::string_view("firebrands", 10), std::string_view("firebrand", 9) },
+{ std::string_view("fires", 5), std::string_view("fir", 3) },
+{ std::string_view("firs", 4), std::string_view("fir", 3) },
+{ std::string_view("firstfruits", 11), std::string_view("firstfruit", 10) },
+{ std::string_view("firstlings", 10), std::string_view("firstling", 9) },
+{ std::string_view("fishers", 7), std::string_view("fisher", 6) },
+{ std::string_view("fishes", 6), std::string_view("fish", 4) },
+{ std::string_view("fishhooks", 9), std::string_view("fishhook", 8) },
+{ std::string_view("fishing", 7), std::string_view("fish", 4) },
+{ std::string_view("fists", 5), std::string_view("fist", 4) },
+{ std::string_view("fixed", 5), std::string_view("fix", 3) },
+{ std::string_view("flagons", 7), std::string_view("flagon", 6) },
+{ std::string_view("flags", 5), std::string_view("flag", 4) },
+{ std::string_view("flames", 6), std::string_view("flame", 5) },
+{ std::string_view("flaming", 7), std::string_view("flame", 5) },
+{ std::string_view("flashed", 7), std::string_view("flash", 5) },
+{ std::string_view("flashes", 7), std::string_view("flash", 5) },
+{ std::string_view("flashing", 8), std::string_view("flash", 5) },
+{ std::string_view("flattered", 9), std::string_view("flatter", 7) },
+{ std::string_view("flattering", 10), std::string_view("flatter", 7) },
+{ std::string_view("flatters", 8), std::string_view("flatter", 7) },
+{ std::string_view("flayed", 6), std::string_view("flay", 4) },
+{ std::string_view("fleeing", 7), std::string_view("flee", 4) },
+{ std::string_view("flees", 5), std::string_view("flee", 4) },
+{ std::string_view("fleeting", 8), std::string_view("fleeth", 6) },
+{ std::string_view("fleshed", 7), std::string_view("flesh", 5) },
+{ std::string_view("fleshhooks", 10), std::string_view("fleshhook", 9) },
+{ std::string_view("flocks", 6), std::string_view("flock", 5) },
+{ std::string_view("floods", 6), std::string_view("flood", 5) },
+{ std::string_view("floors", 6), std::string_view("floor", 5) },
+{ std::string_view("flourished", 10), std::string_view("flourish", 8) },
+{ std::string_view("flourishes", 10), std::string_view("flourish", 8) },
+{ std::string_view("flourishing", 11), std::string_view("flourish", 8) },
+{ std::string_view("flowed", 6), std::string_view("flow", 4) },
+{ std::string_view("flowers", 7), std::string_view("flower", 6) },
+{ std::string_view("flowing", 7), std::string_view("flow", 4) },
+{ std::string_view("flows", 5), std::string_view("flow", 4) },
+{ std::string_view("flutes", 6), std::string_view("flute", 5) },
+{ std::string_view("fluttering", 10), std::string_view("flutters", 8) },
+{ std::string_view("flying", 6), std::string_view("fly", 3) },
+{ std::string_view("foals", 5), std::string_view("foal", 4) },
+{ std::string_view("foaming", 7), std::string_view("foam", 4) },
+{ std::string_view("foams", 5), std::string_view("foam", 4) },
+{ std::string_view("folded", 6), std::string_view("fold", 4) },
+{ std::string_view("folding", 7), std::string_view("fold", 4) },
+{ std::string_view("folds", 5), std::string_view("fold", 4) },
+{ std::string_view("folks", 5), std::string_view("folk", 4) },
+{ std::string_view("followed", 8), std::string_view("follow", 6) },
+{ std::string_view("following", 9), std::string_view("follow", 6) },
+{ std::string_view("follows", 7), std::string_view("follow", 6) },
+{ std::string_view("foods", 5), std::string_view("food", 4) },
+{ std::string_view("fools", 5), std::string_view("fool", 4) },
+{ std::string_view("footed", 6), std::string_view("foot", 4) },
+{ std::string_view("forbearing", 10), std::string_view("forbear", 7) },
+{ std::string_view("forbears", 8), std::string_view("forbear", 7) },
+{ std::string_view("forbids", 7), std::string_view("forbid", 6) },
+{ std::string_view("forced", 6), std::string_view("force", 5) },
+{ std::string_view("forces", 6), std::string_view("force", 5) },
+{ std::string_view("forcing", 7), std::string_view("force", 5) },
+{ std::string_view("ford", 4), std::string_view("for", 3) },
+{ std::string_view("fords", 5), std::string_view("ford", 4) },
+{ std::string_view("forefathers", 11), std::string_view("forefather", 10) },
+{ std::string_view("foregoing", 9), std::string_view("forego", 6) },
+{ std::string_view("foreheads", 9), std::string_view("forehead", 8) },
+{ std::string_view("foreigners", 10), std::string_view("foreigner", 9) },
+{ std::string_view("foreskins", 9), std::string_view("foreskin", 8) },
+{ std::string_view("forest", 6), std::string_view("ford", 4) },
+{ std::string_view("forests", 7), std::string_view("forest", 6) },
+{ std::string_view("forewarned", 10), std::string_view("forewarn", 8) },
+{ std::string_view("forfeited", 9), std::string_view("forfeit", 7) },
+{ std::string_view("forfeits", 8), std::string_view("forfeit", 7) },
+{ std::string_view("forgavest", 9), std::string_view("forgave", 7) },
+{ std::string_view("forgers", 7), std::string_view("forger", 6) },
+{ std::string_view("forgets", 7), std::string_view("forget", 6) },
+{ std::string_view("forgivenesses", 13), std::string_view("forgiveness", 11) },
+{ std::string_view("forgives", 8), std::string_view("forgive", 7) },
+{ std::string_view("forgiving", 9), std::string_view("forgive", 7) },
+{ std::string_view("foring", 6), std::string_view("for", 3) },
+{ std::string_view("forks", 5), std::string_view("fork", 4) },
+{ std::string_view("formed", 6), std::string_view("form", 4) },
+{ std::string_view("forms", 5), std::string_view("form", 4) },
+{ std::string_view("fornications", 12), std::string_view("fornication", 11) },
+{ std::string_view("fornicators", 11), std::string_view("fornicator", 10) },
+{ std::string_view("forsakes", 8), std::string_view("forsake", 7) },
+{ std::string_view("forsaking", 9), std::string_view("forsake", 7) },
+{ std::string_view("forsooking", 10), std::string_view("forsook", 7) },
+{ std::string_view("fortresses", 10), std::string_view("fortress", 8) },
+{ std::string_view("forts", 5), std::string_view("fort", 4) },
+{ std::string_view("fortunes", 8), std::string_view("fortune", 7) },
+{ std::string_view("fouled", 6), std::string_view("foul", 4) },
+{ std::string_view("foundations", 11), std::string_view("foundation", 10) },
+{ std::string_view("founded", 7), std::string_view("found", 5) },
+{ std::string_view("founding", 8), std::string_view("found", 5) },
+{ std::string_view("fountains", 9), std::string_view("fountain", 8) },
+{ std::string_view("fours", 5), std::string_view("four", 4) },
+{ std::string_view("fowlers", 7), std::string_view("fowler", 6) },
+{ std::string_view("fowls", 5), std::string_view("fowl", 4) },
+{ std::string_view("foxes", 5), std::string_view("fox", 3) },
+{ std::string_view("framed", 6), std::string_view("frame", 5) },
+{ std::string_view("freed", 5), std::string_view("free", 4) },
+{ std::string_view("frees", 5), std::string_view("free", 4) },
+{ std::string_view("friends", 7), std::string_view("friend", 6) },
+{ std::string_view("frightened", 10), std::string_view("frighten", 8) },
+{ std::string_view("fringes", 7), std::string_view("fringe", 6) },
+{ std::string_view("fruits", 6), std::string_view("fruit", 5) },
+{ std::string_view("frustrated", 10), std::string_view("frustrate", 9) },
+{ std::string_view("frustrates", 10), std::string_view("frustrate", 9) },
+{ std::string_view("fugitives", 9), std::string_view("fugitive", 8) },
+{ std::string_view("fulfilled", 9), std::string_view("fulfill", 7) },
+{ std::string_view("fulfilling", 10), std::string_view("fulfill", 7) },
+{ std::string_view("fulfills", 8), std::string_view("fulfill", 7) },
+{ std::string_view("fullers", 7), std::string_view("fuller", 6) },
+{ std::string_view("fullest", 7), std::string_view("fully", 5) },
+{ std::string_view("fulling", 7), std::string_view("full", 4) },
+{ std::string_view("furbished", 9), std::string_view("furbish", 7) },
+{ std::string_view("furnaces", 8), std::string_view("furnace", 7) },
+{ std::string_view("furnished", 9), std::string_view("furnish", 7) },
+{ std::string_view("furrows", 7), std::string_view("furrow", 6) },
+{ std::string_view("furthered", 9), std::string_view("further", 7) },
+{ std::string_view("gaddest", 7), std::string_view("gaddi", 5) },
+{ std::string_view("gadite", 6), std::string_view("gad", 3) },
+{ std::string_view("gadites", 7), std::string_view("gadite", 6) },
+{ std::string_view("gained", 6), std::string_view("gain", 4) },
+{ std::string_view("gaining", 7), std::string_view("gain", 4) },
+{ std::string_view("gains", 5), std::string_view("gain", 4) },
+{ std::string_view("gainsaying", 10), std::string_view("gainsay", 7) },
+{ std::string_view("galilaeans", 10), std::string_view("galilaean", 9) },
+{ std::string_view("galileans", 9), std::string_view("galilean", 8) },
+{ std::string_view("games", 5), std::string_view("game", 4) },
+{ std::string_view("gaped", 5), std::string_view("gap", 3) },
+{ std::string_view("gapes", 5), std::string_view("gap", 3) },
+{ std::string_view("gaps", 4), std::string_view("gap", 3) },
+{ std::string_view("gardens", 7), std::string_view("garden", 6) },
+{ std::string_view("garlands", 8), std::string_view("garland", 7) },
+{ std::string_view("garments", 8), std::string_view("garment", 7) },
+{ std::string_view("garnered", 8), std::string_view("garner", 6) },
+{ std::string_view("garners", 7), std::string_view("garner", 6) },
+{ std::string_view("garnished", 9), std::string_view("garnish", 7) },
+{ std::string_view("garrisons", 9), std::string_view("garrison", 8) },
+{ std::string_view("gasps", 5), std::string_view("gasp", 4) },
+{ std::string_view("gates", 5), std::string_view("gat", 3) },
+{ std::string_view("gathered", 8), std::string_view("gather", 6) },
+{ std::string_view("gatherers", 9), std::string_view("gatherer", 8) },
+{ std::string_view("gatherest", 9), std::string_view("gathers", 7) },
+{ std::string_view("gathering", 9), std::string_view("gather", 6) },
+{ std::string_view("gatherings", 10), std::string_view("gathering", 9) },
+{ std::string_view("gathers", 7), std::string_view("gather", 6) },
+{ std::string_view("gavest", 6), std::string_view("gave", 4) },
+{ std::string_view("gazelles", 8), std::string_view("gazelle", 7) },
+{ std::string_view("gazers", 6), std::string_view("gazer", 5) },
+{ std::string_view("gazes", 5), std::string_view("gaze", 4) },
+{ std::string_view("gazing", 6), std::string_view("gaza", 4) },
+{ std::string_view("gederite", 8), std::string_view("geder", 5) },
+{ std::string_view("gendered", 8), std::string_view("gender", 6) },
+{ std::string_view("generations", 11), std::string_view("generation", 10) },
+{ std::string_view("gentiles", 8), std::string_view("gentile", 7) },
+{ std::string_view("gershonite", 10), std::string_view("gershon", 7) },
+{ std::string_view("gershonites", 11), std::string_view("gershonite", 10) },
+{ std::string_view("gets", 4), std::string_view("get", 3) },
+{ std::string_view("giants", 6), std::string_view("giant", 5) },
+{ std::string_view("gibeathite", 10), std::string_view("gibeath", 7) },
+{ std::string_view("gibeonite", 9), std::string_view("gibeon", 6) },
+{ std::string_view("gibeonites", 10), std::string_view("gibeonite", 9) },
+{ std::string_view("gifts", 5), std::string_view("gift", 4) },
+{ std::string_view("gileadite", 9), std::string_view("gilead", 6) },
+{ std::string_view("gileadites", 10), std::string_view("gileadite", 9) },
+{ std::string_view("gins", 4), std::string_view("gin", 3) },
+{ std::string_view("girded", 6), std::string_view("gird", 4) },
+{ std::string_view("girding", 7), std::string_view("gird", 4) },
+{ std::string_view("girdles", 7), std::string_view("girdle", 6) },
+{ std::string_view("girds", 5), std::string_view("gird", 4) },
+{ std::string_view("girgashites", 11), std::string_view("girgashite", 10) },
+{ std::string_view("girls", 5), std::string_view("girl", 4) },
+{ std::string_view("gittites", 8), std::string_view("gittite", 7) },
+{ std::string_view("gives", 5), std::string_view("give", 4) },
+{ std::string_view("givest", 6), std::string_view("give", 4) },
+{ std::string_view("giving", 6), std::string_view("give", 4) },
+{ std::string_view("givings", 7), std::string_view("giving", 6) },
+{ std::string_view("glasses", 7), std::string_view("glass", 5) },
+{ std::string_view("gleaned", 7), std::string_view("glean", 5) },
+{ std::string_view("gleaning", 8), std::string_view("glean", 5) },
+{ std::string_view("gleanings", 9), std::string_view("gleaning", 8) },
+{ std::string_view("gleans", 6), std::string_view("glean", 5) },
+{ std::string_view("glittering", 10), std::string_view("glitter", 7) },
+{ std::string_view("gloating", 8), std::string_view("gloat", 5) },
+{ std::string_view("glorifying", 10), std::string_view("glorify", 7) },
+{ std::string_view("glorying", 8), std::string_view("glory", 5) },
+{ std::string_view("gluttons", 8), std::string_view("glutton", 7) },
+{ std::string_view("gnashed", 7), std::string_view("gnash", 5) },
+{ std::string_view("gnashes", 7), std::string_view("gnash", 5) },
+{ std::string_view("gnashing", 8), std::string_view("gnash", 5) },
+{ std::string_view("gnawed", 6), std::string_view("gnaw", 4) },
+{ std::string_view("goads", 5), std::string_view("goad", 4) },
+{ std::string_view("goats", 5), std::string_view("goat", 4) },
+{ std::string_view("god", 3), std::string_view("god", 3) },
+{ std::string_view("gods", 4), std::string_view("god", 3) },
+{ std::string_view("goes", 4), std::string_view("go", 2) },
+{ std::string_view("goest", 5), std::string_view("gob", 3) },
+{ std::string_view("going", 5), std::string_view("go", 2) },
+{ std::string_view("goings", 6), std::string_view("going", 5) },
+{ std::string_view("goldsmiths", 10), std::string_view("goldsmith", 9) },
+{ std::string_view("goods", 5), std::string_view("good", 4) },
+{ std::string_view("gored", 5), std::string_view("gore", 4) },
+{ std::string_view("gores", 5), std::string_view("gore", 4) },
+{ std::string_view("goring", 6), std::string_view("gore", 4) },
+{ std::string_view("gossips", 7), std::string_view("gossip", 6) },
+{ std::string_view("gourds", 6), std::string_view("gourd", 5) },
+{ std::string_view("governing", 9), std::string_view("govern", 6) },
+{ std::string_view("governments", 11), std::string_view("government", 10) },
+{ std::string_view("governors", 9), std::string_view("governor", 8) },
+{ std::string_view("graffed", 7), std::string_view("graff", 5) },
+{ std::string_view("grafted", 7), std::string_view("graft", 5) },
+{ std::string_view("grains", 6), std::string_view("grain", 5) },
+{ std::string_view("granted", 7), std::string_view("grant", 5) },
+{ std::string_view("granting", 8), std::string_view("grant", 5) },
+{ std::string_view("grapegatherers", 14), std::string_view("grapegatherer", 13) },
+{ std::string_view("grapes", 6), std::string_view("grape", 5) },
+{ std::string_view("grasses", 7), std::string_view("grass", 5) },
+{ std::string_view("grasshoppers", 12), std::string_view("grasshopper", 11) },
+{ std::string_view("grating", 7), std::string_view("grate", 5) },
+{ std::string_view("graved", 6), std::string_view("grave", 5) },
+{ std::string_view("graves", 6), std::string_view("grave", 5) },
+{ std::string_view("graving", 7), std::string_view("grave", 5) },
+{ std::string_view("gravings", 8), std::string_view("graving", 7) },
+{ std::string_view("grazes", 6), std::string_view("graze", 5) },
+{ std::string_view("greating", 8), std::string_view("great", 5) },
+{ std::string_view("grecians", 8), std::string_view("grecian", 7) },
+{ std::string_view("greeks", 6), std::string_view("greek", 5) },
+{ std::string_view("greeted", 7), std::string_view("greet", 5) },
+{ std::string_view("greeting", 8), std::string_view("greet", 5) },
+{ std::string_view("greetings", 9), std::string_view("greeting", 8) },
+{ std::string_view("greets", 6), std::string_view("greet", 5) },
+{ std::string_view("griefs", 6), std::string_view("grief", 5) },
+{ std::string_view("grieved", 7), std::string_view("grieve", 6) },
+{ std::string_view("grieves", 7), std::string_view("grieve", 6) },
+{ std::string_view("grieving", 8), std::string_view("grieve", 6) },
+{ std::string_view("grinding", 8), std::string_view("grind", 5) },
+{ std::string_view("grinds", 6), std::string_view("grind", 5) },
+{ std::string_view("groaned", 7), std::string_view("groan", 5) },
+{ std::string_view("groaning", 8), std::string_view("groan", 5) },
+{ std::string_view("groanings", 9), std::string_view("groaning", 8) },
+{ std::string_view("groans", 6), std::string_view("groan", 5) },
+{ std::string_view("gropes", 6), std::string_view("grope", 5) },
+{ std::string_view("grounded", 8), std::string_view("ground", 6) },
+{ std::string_view("groves", 6), std::string_view("grove", 5) },
+{ std::string_view("growing", 7), std::string_view("grow", 4) },
+{ std::string_view("growling", 8), std::string_view("growl", 5) },
+{ std::string_view("grows", 5), std::string_view("grow", 4) },
+{ std::string_view("grudging", 8), std::string_view("grudge", 6) },
+{ std::string_view("grumbled", 8), std::string_view("grumble", 7) },
+{ std::string_view("grumbling", 9), std::string_view("grumble", 7) },
+{ std::string_view("guarded", 7), std::string_view("guard", 5) },
+{ std::string_view("guarding", 8), std::string_view("guard", 5) },
+{ std::string_view("guards", 6), std::string_view("guard", 5) },
+{ std::string_view("guest", 5), std::string_view("gum", 3) },
+{ std::string_view("guests", 6), std::string_view("guest", 5) },
+{ std::string_view("guided", 6), std::string_view("guide", 5) },
+{ std::string_view("guides", 6), std::string_view("guide", 5) },
+{ std::string_view("guiding", 7), std::string_view("guide", 5) },
+{ std::string_view("gushed", 6), std::string_view("gush", 4) },
+{ std::string_view("gushes", 6), std::string_view("gush", 4) },
+{ std::string_view("gutters", 7), std::string_view("gutter", 6) },
+{ std::string_view("habergeons", 10), std::string_view("habergeon", 9) },
+{ std::string_view("habitations", 11), std::string_view("habitation", 10) },
+{ std::string_view("habits", 6), std::string_view("habit", 5) },
+{ std::string_view("had", 3), std::string_view("ha", 2) },
+{ std::string_view("hades", 5), std::string_view("had", 3) },
+{ std::string_view("hagrites", 8), std::string_view("hagrite", 7) },
+{ std::string_view("hairs", 5), std::string_view("hair", 4) },
+{ std::string_view("haling", 6), std::string_view("hale", 4) },
+{ std::string_view("hallowed", 8), std::string_view("hallow", 6) },
+{ std::string_view("halted", 6), std::string_view("halt", 4) },
+{ std::string_view("halting", 7), std::string_view("halt", 4) },
+{ std::string_view("hamathite", 9), std::string_view("hamath", 6) },
+{ std::string_view("hammered", 8), std::string_view("hammer", 6) },
+{ std::string_view("hammers", 7), std::string_view("hammer", 6) },
+{ std::string_view("handbreadths", 12), std::string_view("handbreadth", 11) },
+{ std::string_view("handed", 6), std::string_view("hand", 4) },
+{ std::string_view("handfuls", 8), std::string_view("handful", 7) },
+{ std::string_view("handiworks", 10), std::string_view("handiwork", 9) },
+{ std::string_view("handkerchiefs", 13), std::string_view("handkerchief", 12) },
+{ std::string_view("handled", 7), std::string_view("handle", 6) },
+{ std::string_view("handles", 7), std::string_view("handle", 6) },
+{ std::string_view("handling", 8), std::string_view("handle", 6) },
+{ std::string_view("handmaidens", 11), std::string_view("handmaiden", 10) },
+{ std::string_view("handmaids", 9), std::string_view("handmaid", 8) },
+{ std::string_view("hands", 5), std::string_view("hand", 4) },
+{ std::string_view("hanged", 6), std::string_view("hang", 4) },
+{ std::string_view("hanging", 7), std::string_view("hang", 4) },
+{ std::string_view("hangings", 8), std::string_view("hanging", 7) },
+{ std::string_view("hangs", 5), std::string_view("hang", 4) },
+{ std::string_view("happened", 8), std::string_view("happen", 6) },
+{ std::string_view("happening", 9), std::string_view("happen", 6) },
+{ std::string_view("happens", 7), std::string_view("happen", 6) },
+{ std::string_view("hard", 4), std::string_view("har", 3) },
+{ std::string_view("hardened", 8), std::string_view("harden", 6) },
+{ std::string_view("hardening", 9), std::string_view("harden", 6) },
+{ std::string_view("hardens", 7), std::string_view("harden", 6) },
+{ std::string_view("hardships", 9), std::string_view("hardship", 8) },
+{ std::string_view("harlots", 7), std::string_view("harlot", 6) },
+{ std::string_view("harmed", 6), std::string_view("harm", 4) },
+{ std::string_view("harnessed", 9), std::string_view("harness", 7) },
+{ std::string_view("harnesses", 9), std::string_view("harness", 7) },
+{ std::string_view("harodite", 8), std::string_view("harod", 5) },
+{ std::string_view("harped", 6), std::string_view("harp", 4) },
+{ std::string_view("harping", 7), std::string_view("harp", 4) },
+{ std::string_view("harps", 5), std::string_view("harp", 4) },
+{ std::string_view("harrows", 7), std::string_view("harrow", 6) },
+{ std::string_view("harts", 5), std::string_view("hart", 4) },
+{ std::string_view("harvests", 8), std::string_view("harvest", 7) },
+{ std::string_view("has", 3), std::string_view("ha", 2) },
+{ std::string_view("hasted", 6), std::string_view("hast", 4) },
+{ std::string_view("hastened", 8), std::string_view("hasten", 6) },
+{ std::string_view("hastening", 9), std::string_view("hasten", 6) },
+{ std::string_view("hasting", 7), std::string_view("hast", 4) },
+{ std::string_view("hated", 5), std::string_view("hate", 4) },
+{ std::string_view("hates", 5), std::string_view("hate", 4) },
+{ std::string_view("hatest", 6), std::string_view("hate", 4) },
+{ std::string_view("hating", 6), std::string_view("hate", 4) },
+{ std::string_view("haunts", 6), std::string_view("haunt", 5) },
+{ std::string_view("havens", 6), std::string_view("haven", 5) },
+{ std::string_view("having", 6), std::string_view("have", 4) },
+{ std::string_view("headbands", 9), std::string_view("headband", 8) },
+{ std::string_view("headdresses", 11), std::string_view("headdress", 9) },
+{ std::string_view("headed", 6), std::string_view("head", 4) },
+{ std::string_view("heads", 5), std::string_view("head", 4) },
+{ std::string_view("healed", 6), std::string_view("heal", 4) },
+{ std::string_view("healing", 7), std::string_view("heal", 4) },
+{ std::string_view("healings", 8), std::string_view("healing", 7) },
+{ std::string_view("heals", 5), std::string_view("heal", 4) },
+{ std::string_view("heaped", 6), std::string_view("heap", 4) },
+{ std::string_view("heaps", 5), std::string_view("heap", 4) },
+{ std::string_view("heard", 5), std::string_view("hear", 4) },
+{ std::string_view("hearding", 8), std::string_view("heard", 5) },
+{ std::string_view("hearers", 7), std::string_view("hearer", 6) },
+{ std::string_view("hearest", 7), std::string_view("heard", 5) },
+{ std::string_view("hearing", 7), std::string_view("hear", 4) },
+{ std::string_view("hearkened", 9), std::string_view("hearken", 7) },
+{ std::string_view("hearkening", 10), std::string_view("hearken", 7) },
+{ std::string_view("hears", 5), std::string_view("hear", 4) },
+{ std::string_view("hearted", 7), std::string_view("heart", 5) },
+{ std::string_view("hearts", 6), std::string_view("heart", 5) },
+{ std::string_view("heated", 6), std::string_view("heat", 4) },
+{ std::string_view("heaved", 6), std::string_view("heave", 5) },
+{ std::string_view("heavens", 7), std::string_view("heaven", 6) },
+{ std::string_view("hebrews", 7), std::string_view("hebrew", 6) },
+{ std::string_view("hedged", 6), std::string_view("hedge", 5) },
+{ std::string_view("hedges", 6), std::string_view("hedge", 5) },
+{ std::string_view("heed", 4), std::string_view("he", 2) },
+{ std::string_view("heeding", 7), std::string_view("heed", 4) },
+{ std::string_view("heeds", 5), std::string_view("heed", 4) },
+{ std::string_view("heels", 5), std::string_view("heel", 4) },
+{ std::string_view("heights", 7), std::string_view("height", 6) },
+{ std::string_view("heirs", 5), std::string_view("heir", 4) },
+{ std::string_view("helmets", 7), std::string_view("helmet", 6) },
+{ std::string_view("helped", 6), std::string_view("help", 4) },
+{ std::string_view("helpers", 7), std::string_view("helper", 6) },
+{ std::string_view("helping", 7), std::string_view("help", 4) },
+{ std::string_view("helps", 5), std::string_view("help", 4) },
+{ std::string_view("hems", 4), std::string_view("hem", 3) },
+{ std::string_view("herbs", 5), std::string_view("herb", 4) },
+{ std::string_view("herd", 4), std::string_view("her", 3) },
+{ std::string_view("herds", 5), std::string_view("herd", 4) },
+{ std::string_view("heres", 5), std::string_view("her", 3) },
+{ std::string_view("heritages", 9), std::string_view("heritage", 8) },
+{ std::string_view("hers", 4), std::string_view("her", 3) },
+{ std::string_view("hewed", 5), std::string_view("hew", 3) },
+{ std::string_view("hewers", 6), std::string_view("hewer", 5) },
+{ std::string_view("hews", 4), std::string_view("hew", 3) },
+{ std::string_view("hides", 5), std::string_view("hid", 3) },
+{ std::string_view("hidest", 6), std::string_view("hide", 4) },
+{ std::string_view("hiding", 6), std::string_view("hid", 3) },
+{ std::string_view("highing", 7), std::string_view("high", 4) },
+{ std::string_view("highways", 8), std::string_view("highway", 7) },
+{ std::string_view("hills", 5), std::string_view("hill", 4) },
+{ std::string_view("hind", 4), std::string_view("hin", 3) },
+{ std::string_view("hindered", 8), std::string_view("hinder", 6) },
+{ std::string_view("hinds", 5), std::string_view("hind", 4) },
+{ std::string_view("hired", 5), std::string_view("hire", 4) },
+{ std::string_view("hires", 5), std::string_view("hire", 4) },
+{ std::string_view("hirest", 6), std::string_view("hire", 4) },
+{ std::string_view("hiss", 4), std::string_view("his", 3) },
+{ std::string_view("hissing", 7), std::string_view("hiss", 4) },
+{ std::string_view("hittites", 8), std::string_view("hittite", 7) },
+{ std::string_view("hivites", 7), std::string_view("hivite", 6) },
+{ std::string_view("hod", 3), std::string_view("ho", 2) },
+{ std::string_view("hoed", 4), std::string_view("ho", 2) },
+{ std::string_view("holdest", 7), std::string_view("holds", 5) },
+{ std::string_view("holding", 7), std::string_view("hold", 4) },
+{ std::string_view("holds", 5), std::string_view("hold", 4) },
+{ std::string_view("holes", 5), std::string_view("hole", 4) },
+{ std::string_view("homers", 6), std::string_view("homer", 5) },
+{ std::string_view("homes", 5), std::string_view("home", 4) },
+{ std::string_view("honored", 7), std::string_view("honor", 5) },
+{ std::string_view("honors", 6), std::string_view("honor", 5) },
+{ std::string_view("honoured", 8), std::string_view("honour", 6) },
+{ std::string_view("honourest", 9), std::string_view("honours", 7) },
+{ std::string_view("honouring", 9), std::string_view("honour", 6) },
+{ std::string_view("honours", 7), std::string_view("honour", 6) },
+{ std::string_view("hoofs", 5), std::string_view("hoof", 4) },
+{ std::string_view("hooks", 5), std::string_view("hook", 4) },
+{ std::string_view("hoped", 5), std::string_view("hope", 4) },
+{ std::string_view("hopes", 5), std::string_view("hope", 4) },
+{ std::string_view("hoping", 6), std::string_view("hope", 4) },
+{ std::string_view("horite", 6), std::string_view("hor", 3) },
+{ std::string_view("horites", 7), std::string_view("horite", 6) },
+{ std::string_view("horned", 6), std::string_view("horn", 4) },
+{ std::string_view("hornets", 7), std::string_view("hornet", 6) },
+{ std::string_view("horns", 5), std::string_view("horn", 4) },
+{ std::string_view("horonite", 8), std::string_view("horon", 5) },
+{ std::string_view("horses", 6), std::string_view("horse", 5) },
+{ std::string_view("hosts", 5), std::string_view("host", 4) },
+{ std::string_view("houghed", 7), std::string_view("hough", 5) },
+{ std::string_view("hours", 5), std::string_view("hour", 4) },
+{ std::string_view("households", 10), std::string_view("household", 9) },
+{ std::string_view("houses", 6), std::string_view("house", 5) },
+{ std::string_view("housetops", 9), std::string_view("housetop", 8) },
+{ std::string_view("howled", 6), std::string_view("howl", 4) },
+{ std::string_view("howling", 7), std::string_view("howl", 4) },
+{ std::string_view("howlings", 8), std::string_view("howling", 7) },
+{ std::string_view("humbled", 7), std::string_view("humble", 6) },
+{ std::string_view("humbles", 7), std::string_view("humble", 6) },
+{ std::string_view("humbling", 8), std::string_view("humble", 6) },
+{ std::string_view("hundreds", 8), std::string_view("hundred", 7) },
+{ std::string_view("hungered", 8), std::string_view("hunger", 6) },
+{ std::string_view("hunted", 6), std::string_view("hunt", 4) },
+{ std::string_view("hunters", 7), std::string_view("hunter", 6) },
+{ std::string_view("huntest", 7), std::string_view("hunts", 5) },
+{ std::string_view("hunting", 7), std::string_view("hunt", 4) },
+{ std::string_view("hunts", 5), std::string_view("hunt", 4) },
+{ std::string_view("hurled", 6), std::string_view("hurl", 4) },
+{ std::string_view("hurling", 7), std::string_view("hurl", 4) },
+{ std::string_view("hurls", 5), std::string_view("hurl", 4) },
+{ std::string_view("hurting", 7), std::string_view("hurt", 4) },
+{ std::string_view("hurts", 5), std::string_view("hurt", 4) },
+{ std::string_view("husbands", 8), std::string_view("husband", 7) },
+{ std::string_view("husks", 5), std::string_view("husk", 4) },
+{ std::string_view("hymns", 5), std::string_view("hymn", 4) },
+{ std::string_view("hypocrites", 10), std::string_view("hypocrite", 9) },
+{ std::string_view("idolaters", 9), std::string_view("idolater", 8) },
+{ std::string_view("idols", 5), std::string_view("idol", 4) },
+{ std::string_view("ignored", 7), std::string_view("ignore", 6) },
+{ std::string_view("images", 6), std::string_view("image", 5) },
+{ std::string_view("imaginations", 12), std::string_view("imagination", 11) },
+{ std::string_view("imagined", 8), std::string_view("imagine", 7) },
+{ std::string_view("imparted", 8), std::string_view("impart", 6) },
+{ std::string_view("imposed", 7), std::string_view("impose", 6) },
+{ std::string_view("impoverished", 12), std::string_view("impoverish", 10) },
+{ std::string_view("imprisonments", 13), std::string_view("imprisonment", 12) },
+{ std::string_view("imputed", 7), std::string_view("impute", 6) },
+{ std::string_view("imputing", 8), std::string_view("impute", 6) },
+{ std::string_view("incensed", 8), std::string_view("incense", 7) },
+{ std::string_view("inclined", 8), std::string_view("incline", 7) },
+{ std::string_view("inclines", 8), std::string_view("incline", 7) },
+{ std::string_view("inclosed", 8), std::string_view("inclose", 7) },
+{ std::string_view("increased", 9), std::string_view("increase", 8) },
+{ std::string_view("increases", 9), std::string_view("increase", 8) },
+{ std::string_view("increasest", 10), std::string_view("increase", 8) },
+{ std::string_view("increasing", 10), std::string_view("increase", 8) },
+{ std::string_view("indeed", 6), std::string_view("indee", 5) },
+{ std::string_view("infants", 7), std::string_view("infant", 6) },
+{ std::string_view("inflaming", 9), std::string_view("inflame", 7) },
+{ std::string_view("informed", 8), std::string_view("inform", 6) },
+{ std::string_view("inhabitants", 11), std::string_view("inhabitant", 10) },
+{ std::string_view("inhabited", 9), std::string_view("inhabit", 7) },
+{ std::string_view("inhabitest", 10), std::string_view("inhabits", 8) },
+{ std::string_view("inhabiting", 10), std::string_view("inhabit", 7) },
+{ std::string_view("inhabits", 8), std::string_view("inhabit", 7) },
+{ std::string_view("inheritances", 12), std::string_view("inheritance", 11) },
+{ std::string_view("inherited", 9), std::string_view("inherit", 7) },
+{ std::string_view("inherits", 8), std::string_view("inherit", 7) },
+{ std::string_view("innocents", 9), std::string_view("innocent", 8) },
+{ std::string_view("inquired", 8), std::string_view("inquire", 7) },
+{ std::string_view("inquires", 8), std::string_view("inquire", 7) },
+{ std::string_view("inscribed", 9), std::string_view("inscribe", 8) },
+{ std::string_view("instructed", 10), std::string_view("instruct", 8) },
+{ std::string_view("instructing", 11), std::string_view("instruct", 8) },
+{ std::string_view("instructions", 12), std::string_view("instruction", 11) },
+{ std::string_view("instructors", 11), std::string_view("instructor", 10) },
+{ std::string_view("instructs", 9), std::string_view("instruct", 8) },
+{ std::string_view("instruments", 11), std::string_view("instrument", 10) },
+{ std::string_view("insulted", 8), std::string_view("insult", 6) },
+{ std::string_view("insulting", 9), std::string_view("insult", 6) },
+{ std::string_view("insults", 7), std::string_view("insult", 6) },
+{ std::string_view("insurrections", 13), std::string_view("insurrection", 12) },
+{ std::string_view("intended", 8), std::string_view("intend", 6) },
+{ std::string_view("intending", 9), std::string_view("intend", 6) },
+{ std::string_view("intents", 7), std::string_view("intent", 6) },
+{ std::string_view("intercessions", 13), std::string_view("intercession", 12) },
+{ std::string_view("interpretations", 15), std::string_view("interpretation", 14) },
+{ std::string_view("interpreted", 11), std::string_view("interpret", 9) },
+{ std::string_view("interpreting", 12), std::string_view("interpret", 9) },
+{ std::string_view("interprets", 10), std::string_view("interpret", 9) },
+{ std::string_view("intreated", 9), std::string_view("intreat", 7) },
+{ std::string_view("invaded", 7), std::string_view("invade", 6) },
+{ std::string_view("invented", 8), std::string_view("invent", 6) },
+{ std::string_view("invited", 7), std::string_view("invite", 6) },
+{ std::string_view("invites", 7), std::string_view("invite", 6) },
+{ std::string_view("inwards", 7), std::string_view("inward", 6) },
+{ std::string_view("irad", 4), std::string_view("ira", 3) },
+{ std::string_view("irons", 5), std::string_view("iron", 4) },
+{ std::string_view("is", 2), std::string_view("i", 1) },
+{ std::string_view("ishmaelite", 10), std::string_view("ishmael", 7) },
+{ std::string_view("ishmaelites", 11), std::string_view("ishmaelite", 10) },
+{ std::string_view("ishmeelites", 11), std::string_view("ishmeelite", 10) },
+{ std::string_view("islands", 7), std::string_view("island", 6) },
+{ std::string_view("isles", 5), std::string_view("isle", 4) },
+{ std::string_view("israelite", 9), std::string_view("israel", 6) },
+{ std::string_view("israelites", 10), std::string_view("israelite", 9) },
+{ std::string_view("issued", 6), std::string_view("issue", 5) },
+{ std::string_view("issues", 6), std::string_view("issue", 5) },
+{ std::string_view("italians", 8), std::string_view("italian", 7) },
+{ std::string_view("itching", 7), std::string_view("itch", 4) },
+{ std::string_view("ithrites", 8), std::string_view("ithrite", 7) },
+{ std::string_view("its", 3), std::string_view("it", 2) },
+{ std::string_view("jackals", 7), std::string_view("jackal", 6) },
+{ std::string_view("jairite", 7), std::string_view("jair", 4) },
+{ std::string_view("jared", 5), std::string_view("jar", 3) },
+{ std::string_view("jars", 4), std::string_view("jar", 3) },
+{ std::string_view("jaws", 4), std::string_view("jaw", 3) },
+{ std::string_view("jebusite", 8), std::string_view("jebus", 5) },
+{ std::string_view("jebusites", 9), std::string_view("jebusite", 8) },
+{ std::string_view("jehud", 5), std::string_view("jehu", 4) },
+{ std::string_view("jewels", 6), std::string_view("jewel", 5) },
+{ std::string_view("jews", 4), std::string_view("jew", 3) },
+{ std::string_view("jezreelite", 10), std::string_view("jezreel", 7) },
+{ std::string_view("joined", 6), std::string_view("join", 4) },
+{ std::string_view("joining", 7), std::string_view("join", 4) },
+{ std::string_view("joinings", 8), std::string_view("joining", 7) },
+{ std::string_view("joints", 6), std::string_view("joint", 5) },
+{ std::string_view("joking", 6), std::string_view("joke", 4) },
+{ std::string_view("jonas", 5), std::string_view("jona", 4) },
+{ std::string_view("joses", 5), std::string_view("jose", 4) },
+{ std::string_view("journeyed", 9), std::string_view("journey", 7) },
+{ std::string_view("journeying", 10), std::string_view("journey", 7) },
+{ std::string_view("journeyings", 11), std::string_view("journeying", 10) },
+{ std::string_view("journeys", 8), std::string_view("journey", 7) },
+{ std::string_view("joyed", 5), std::string_view("joy", 3) },
+{ std::string_view("joying", 6), std::string_view("joy", 3) },
+{ std::string_view("judas", 5), std::string_view("juda", 4) },
+{ std::string_view("judged", 6), std::string_view("judge", 5) },
+{ std::string_view("judges", 6), std::string_view("judge", 5) },
+{ std::string_view("judgest", 7), std::string_view("judge", 5) },
+{ std::string_view("judging", 7), std::string_view("judge", 5) },
+{ std::string_view("judgments", 9), std::string_view("judgment", 8) },
+{ std::string_view("junias", 6), std::string_view("junia", 5) },
+{ std::string_view("justifying", 10), std::string_view("justify", 7) },
+{ std::string_view("keepers", 7), std::string_view("keeper", 6) },
+{ std::string_view("keepest", 7), std::string_view("keeps", 5) },
+{ std::string_view("keeping", 7), std::string_view("keep", 4) },
+{ std::string_view("keeps", 5), std::string_view("keep", 4) },
+{ std::string_view("kenites", 7), std::string_view("kenite", 6) },
+{ std::string_view("kenizzites", 10), std::string_view("kenizzite", 9) },
+{ std::string_view("kernels", 7), std::string_view("kernel", 6) },
+{ std::string_view("keys", 4), std::string_view("key", 3) },
+{ std::string_view("kicked", 6), std::string_view("kick", 4) },
+{ std::string_view("kids", 4), std::string_view("kid", 3) },
+{ std::string_view("killed", 6), std::string_view("kill", 4) },
+{ std::string_view("killest", 7), std::string_view("kills", 5) },
+{ std::string_view("killing", 7), std::string_view("kill", 4) },
+{ std::string_view("kills", 5), std::string_view("kill", 4) },
+{ std::string_view("kind", 4), std::string_view("kin", 3) },
+{ std::string_view("kindled", 7), std::string_view("kindle", 6) },
+{ std::string_view("kindles", 7), std::string_view("kindle", 6) },
+{ std::string_view("kindreds", 8), std::string_view("kindred", 7) },
+{ std::string_view("kinds", 5), std::string_view("kind", 4) },
+{ std::string_view("kingdoms", 8), std::string_view("kingdom", 7) },
+{ std::string_view("kings", 5), std::string_view("king", 4) },
+{ std::string_view("kinsfolks", 9), std::string_view("kinsfolk", 8) },
+{ std::string_view("kissed", 6), std::string_view("kiss", 4) },
+{ std::string_view("kisses", 6), std::string_view("kiss", 4) },
+{ std::string_view("kites", 5), std::string_view("kite", 4) },
+{ std::string_view("kneaded", 7), std::string_view("knead", 5) },
+{ std::string_view("kneading", 8), std::string_view("knead", 5) },
+{ std::string_view("kneeled", 7), std::string_view("kneel", 5) },
+{ std::string_view("kneeling", 8), std::string_view("kneel", 5) },
+{ std::string_view("knees", 5), std::string_view("knee", 4) },
+{ std::string_view("knewing", 7), std::string_view("knew", 4) },
+{ std::string_view("knocked", 7), std::string_view("knock", 5) },
+{ std::string_view("knocking", 8), std::string_view("knock", 5) },
+{ std::string_view("knocks", 6), std::string_view("knock", 5) },
+{ std::string_view("knops", 5), std::string_view("knop", 4) },
+{ std::string_view("knowest", 7), std::string_view("known", 5) },
+{ std::string_view("knowing", 7), std::string_view("know", 4) },
+{ std::string_view("knows", 5), std::string_view("know", 4) },
+{ std::string_view("korahite", 8), std::string_view("korah", 5) },
+{ std::string_view("korahites", 9), std::string_view("korahite", 8) },
+{ std::string_view("labored", 7), std::string_view("labor", 5) },
+{ std::string_view("laborers", 8), std::string_view("laborer", 7) },
+{ std::string_view("laboring", 8), std::string_view("labor", 5) },
+{ std::string_view("labors", 6), std::string_view("labor", 5) },
+{ std::string_view("laboured", 8), std::string_view("labour", 6) },
+{ std::string_view("labourers", 9), std::string_view("labourer", 8) },
+{ std::string_view("labouring", 9), std::string_view("labour", 6) },
+{ std::string_view("labours", 7), std::string_view("labour", 6) },
+{ std::string_view("lacked", 6), std::string_view("lack", 4) },
+{ std::string_view("lackest", 7), std::string_view("lacks", 5) },
+{ std::string_view("lacking", 7), std::string_view("lack", 4) },
+{ std::string_view("lacks", 5), std::string_view("lack", 4) },
+{ std::string_view("laded", 5), std::string_view("lad", 3) },
+{ std::string_view("lading", 6), std::string_view("lad", 3) },
+{ std::string_view("lads", 4), std::string_view("lad", 3) },
+{ std::string_view("lambs", 5), std::string_view("lamb", 4) },
+{ std::string_view("lamed", 5), std::string_view("lame", 4) },
+{ std::string_view("lamentations", 12), std::string_view("lamentation", 11) },
+{ std::string_view("lamented", 8), std::string_view("lament", 6) },
+{ std::string_view("lamps", 5), std::string_view("lamp", 4) },
+{ std::string_view("lampstands", 10), std::string_view("lampstand", 9) },
+{ std::string_view("lances", 6), std::string_view("lance", 5) },
+{ std::string_view("landed", 6), std::string_view("land", 4) },
+{ std::string_view("landing", 7), std::string_view("land", 4) },
+{ std::string_view("landmarks", 9), std::string_view("landmark", 8) },
+{ std::string_view("lands", 5), std::string_view("land", 4) },
+{ std::string_view("languages", 9), std::string_view("language", 8) },
+{ std::string_view("languished", 10), std::string_view("languish", 8) },
+{ std::string_view("languishes", 10), std::string_view("languish", 8) },
+{ std::string_view("languishing", 11), std::string_view("languish", 8) },
+{ std::string_view("laps", 4), std::string_view("lap", 3) },
+{ std::string_view("lasted", 6), std::string_view("last", 4) },
+{ std::string_view("lasting", 7), std::string_view("last", 4) },
+{ std::string_view("laughed", 7), std::string_view("laugh", 5) },
+{ std::string_view("laughing", 8), std::string_view("laugh", 5) },
+{ std::string_view("laughs", 6), std::string_view("laugh", 5) },
+{ std::string_view("launched", 8), std::string_view("launch", 6) },
+{ std::string_view("lavers", 6), std::string_view("laver", 5) },
+{ std::string_view("laws", 4), std::string_view("law", 3) },
+{ std::string_view("lawyers", 7), std::string_view("lawyer", 6) },
+{ std::string_view("layest", 6), std::string_view("lays", 4) },
+{ std::string_view("laying", 6), std::string_view("lay", 3) },
+{ std::string_view("lays", 4), std::string_view("lay", 3) },
+{ std::string_view("leaders", 7), std::string_view("leader", 6) },
+{ std::string_view("leadest", 7), std::string_view("leads", 5) },
+{ std::string_view("leading", 7), std::string_view("lead", 4) },
+{ std::string_view("leads", 5), std::string_view("lead", 4) },
+{ std::string_view("leaned", 6), std::string_view("lean", 4) },
+{ std::string_view("leaning", 7), std::string_view("lean", 4) },
+{ std::string_view("leans", 5), std::string_view("lean", 4) },
+{ std::string_view("leaped", 6), std::string_view("leap", 4) },
+{ std::string_view("leaping", 7), std::string_view("leap", 4) },
+{ std::string_view("leaps", 5), std::string_view("leap", 4) },
+{ std::string_view("learned", 7), std::string_view("learn", 5) },
+{ std::string_view("learning", 8), std::string_view("learn", 5) },
+{ std::string_view("leased", 6), std::string_view("lease", 5) },
+{ std::string_view("leasing", 7), std::string_view("lease", 5) },
+{ std::string_view("leaved", 6), std::string_view("leave", 5) },
+{ std::string_view("leavened", 8), std::string_view("leaven", 6) },
+{ std::string_view("leavens", 7), std::string_view("leaven", 6) },
+{ std::string_view("leaves", 6), std::string_view("leave", 5) },
+{ std::string_view("leaving", 7), std::string_view("leave", 5) },
+{ std::string_view("led", 3), std::string_view("le", 2) },
+{ std::string_view("ledges", 6), std::string_view("ledge", 5) },
+{ std::string_view("lees", 4), std::string_view("le", 2) },
+{ std::string_view("lefting", 7), std::string_view("left", 4) },
+{ std::string_view("legions", 7), std::string_view("legion", 6) },
+{ std::string_view("legs", 4), std::string_view("leg", 3) },
+{ std::string_view("lehemite", 8), std::string_view("lehem", 5) },
+{ std::string_view("lends", 5), std::string_view("lend", 4) },
+{ std::string_view("lengthened", 10), std::string_view("lengthen", 8) },
+{ std::string_view("lengthening", 11), std::string_view("lengthen", 8) },
+{ std::string_view("leopards", 8), std::string_view("leopard", 7) },
+{ std::string_view("lepers", 6), std::string_view("leper", 5) },
+{ std::string_view("lest", 4), std::string_view("le", 2) },
+{ std::string_view("lets", 4), std::string_view("let", 3) },
+{ std::string_view("letters", 7), std::string_view("letter", 6) },
+{ std::string_view("leveled", 7), std::string_view("level", 5) },
+{ std::string_view("levels", 6), std::string_view("level", 5) },
+{ std::string_view("levites", 7), std::string_view("levite", 6) },
+{ std::string_view("liars", 5), std::string_view("liar", 4) },
+{ std::string_view("licked", 6), std::string_view("lick", 4) },
+{ std::string_view("licks", 5), std::string_view("lick", 4) },
+{ std::string_view("lied", 4), std::string_view("lie", 3) },
+{ std::string_view("lies", 4), std::string_view("lie", 3) },
+{ std::string_view("liest", 5), std::string_view("lid", 3) },
+{ std::string_view("lifted", 6), std::string_view("lift", 4) },
+{ std::string_view("liftest", 7), std::string_view("lifts", 5) },
+{ std::string_view("lifting", 7), std::string_view("lift", 4) },
+{ std::string_view("lifts", 5), std::string_view("lift", 4) },
+{ std::string_view("lighted", 7), std::string_view("light", 5) },
+{ std::string_view("lightened", 9), std::string_view("lighten", 7) },
+{ std::string_view("lightest", 8), std::string_view("lights", 6) },
+{ std::string_view("lighting", 8), std::string_view("light", 5) },
+{ std::string_view("lightnings", 10), std::string_view("lightning", 9) },
+{ std::string_view("lights", 6), std::string_view("light", 5) },
+{ std::string_view("liked", 5), std::string_view("like", 4) },
+{ std::string_view("likened", 7), std::string_view("liken", 5) },
+{ std::string_view("liking", 6), std::string_view("like", 4) },
+{ std::string_view("limbs", 5), std::string_view("limb", 4) },
+{ std::string_view("limited", 7), std::string_view("limit", 5) },
+{ std::string_view("limits", 6), std::string_view("limit", 5) },
+{ std::string_view("lines", 5), std::string_view("line", 4) },
+{ std::string_view("lingered", 8), std::string_view("linger", 6) },
+{ std::string_view("lintels", 7), std::string_view("lintel", 6) },
+{ std::string_view("lionesses", 9), std::string_view("lioness", 7) },
+{ std::string_view("lions", 5), std::string_view("lion", 4) },
+{ std::string_view("lips", 4), std::string_view("lip", 3) },
+{ std::string_view("liquors", 7), std::string_view("liquor", 6) },
+{ std::string_view("listened", 8), std::string_view("listen", 6) },
+{ std::string_view("listening", 9), std::string_view("listen", 6) },
+{ std::string_view("listens", 7), std::string_view("listen", 6) },
+{ std::string_view("lived", 5), std::string_view("live", 4) },
+{ std::string_view("lives", 5), std::string_view("live", 4) },
+{ std::string_view("livest", 6), std::string_view("live", 4) },
+{ std::string_view("living", 6), std::string_view("live", 4) },
+{ std::string_view("loaded", 6), std::string_view("load", 4) },
+{ std::string_view("loads", 5), std::string_view("load", 4) },
+{ std::string_view("loathed", 7), std::string_view("loathe", 6) },
+{ std::string_view("loathes", 7), std::string_view("loathe", 6) },
+{ std::string_view("loathing", 8), std::string_view("loathe", 6) },
+{ std::string_view("locked", 6), std::string_view("lock", 4) },
+{ std::string_view("locks", 5), std::string_view("lock", 4) },
+{ std::string_view("locusts", 7), std::string_view("locust", 6) },
+{ std::string_view("lod", 3), std::string_view("lo", 2) },
+{ std::string_view("lodged", 6), std::string_view("lodge", 5) },
+{ std::string_view("lodges", 6), std::string_view("lodge", 5) },
+{ std::string_view("lodgest", 7), std::string_view("lodge", 5) },
+{ std::string_view("lodging", 7), std::string_view("lodge", 5) },
+{ std::string_view("lodgings", 8), std::string_view("lodging", 7) },
+{ std::string_view("longed", 6), std::string_view("long", 4) },
+{ std::string_view("longing", 7), std::string_view("long", 4) },
+{ std::string_view("longs", 5), std::string_view("long", 4) },
+{ std::string_view("looked", 6), std::string_view("look", 4) },
+{ std::string_view("lookest", 7), std::string_view("looks", 5) },
+{ std::string_view("looking", 7), std::string_view("look", 4) },
+{ std::string_view("looks", 5), std::string_view("look", 4) },
+{ std::string_view("loosed", 6), std::string_view("loose", 5) },
+{ std::string_view("loosened", 8), std::string_view("loosen", 6) },
+{ std::string_view("loosens", 7), std::string_view("loosen", 6) },
+{ std::string_view("loosing", 7), std::string_view("loose", 5) },
+{ std::string_view("lording", 7), std::string_view("lord", 4) },
+{ std::string_view("lords", 5), std::string_view("lord", 4) },
+{ std::string_view("loses", 5), std::string_view("lose", 4) },
+{ std::string_view("lothed", 6), std::string_view("lothe", 5) },
+{ std::string_view("lothing", 7), std::string_view("lothe", 5) },
+{ std::string_view("lots", 4), std::string_view("lot", 3) },
+{ std::string_view("lotuses", 7), std::string_view("lotus", 5) },
+{ std::string_view("loved", 5), std::string_view("love", 4) },
+{ std::string_view("lovers", 6), std::string_view("lover", 5) },
+{ std::string_view("loves", 5), std::string_view("love", 4) },
+{ std::string_view("lovest", 6), std::string_view("love", 4) },
+{ std::string_view("loving", 6), std::string_view("love", 4) },
+{ std::string_view("lovingkindnesses", 16), std::string_view("lovingkindness", 14) },
+{ std::string_view("lowered", 7), std::string_view("lower", 5) },
+{ std::string_view("lowering", 8), std::string_view("lower", 5) },
+{ std::string_view("lowing", 6), std::string_view("low", 3) },
+{ std::string_view("lubims", 6), std::string_view("lubim", 5) },
+{ std::string_view("lurking", 7), std::string_view("lurk", 4) },
+{ std::string_view("lurks", 5), std::string_view("lurk", 4) },
+{ std::string_view("lusted", 6), std::string_view("lust", 4) },
+{ std::string_view("lusting", 7), std::string_view("lust", 4) },
+{ std::string_view("lusts", 5), std::string_view("lust", 4) },
+{ std::string_view("lying", 5), std::string_view("lye", 3) },
+{ std::string_view("maacathite", 10), std::string_view("maacath", 7) },
+{ std::string_view("maacathites", 11), std::string_view("maacathite", 10) },
+{ std::string_view("maachathites", 12), std::string_view("maachathite", 11) },
+{ std::string_view("madest", 6), std::string_view("made", 4) },
+{ std::string_view("mading", 6), std::string_view("mad", 3) },
+{ std::string_view("magicians", 9), std::string_view("magician", 8) },
+{ std::string_view("magistrates", 11), std::string_view("magistrate", 10) },
+{ std::string_view("maidens", 7), std::string_view("maiden", 6) },
+{ std::string_view("maids", 5), std::string_view("maid", 4) },
+{ std::string_view("maidservants", 12), std::string_view("maidservant", 11) },
+{ std::string_view("maimed", 6), std::string_view("maim", 4) },
+{ std::string_view("maintained", 10), std::string_view("maintain", 8) },
+{ std::string_view("maintainest", 11), std::string_view("maintains", 9) },
+{ std::string_view("maintaining", 11), std::string_view("maintain", 8) },
+{ std::string_view("maintains", 9), std::string_view("maintain", 8) },
+{ std::string_view("makers", 6), std::string_view("maker", 5) },
+{ std::string_view("makes", 5), std::string_view("make", 4) },
+{ std::string_view("makest", 6), std::string_view("make", 4) },
+{ std::string_view("making", 6), std::string_view("make", 4) },
+{ std::string_view("malefactors", 11), std::string_view("malefactor", 10) },
+{ std::string_view("males", 5), std::string_view("male", 4) },
+{ std::string_view("maligned", 8), std::string_view("malign", 6) },
+{ std::string_view("manifested", 10), std::string_view("manifest", 8) },
+{ std::string_view("manners", 7), std::string_view("manner", 6) },
+{ std::string_view("manservants", 11), std::string_view("manservant", 10) },
+{ std::string_view("manslayers", 10), std::string_view("manslayer", 9) },
+{ std::string_view("mantles", 7), std::string_view("mantle", 6) },
+{ std::string_view("marched", 7), std::string_view("march", 5) },
+{ std::string_view("marching", 8), std::string_view("march", 5) },
+{ std::string_view("marked", 6), std::string_view("mark", 4) },
+{ std::string_view("markest", 7), std::string_view("marks", 5) },
+{ std::string_view("marketplaces", 12), std::string_view("marketplace", 11) },
+{ std::string_view("markets", 7), std::string_view("market", 6) },
+{ std::string_view("marking", 7), std::string_view("mark", 4) },
+{ std::string_view("marks", 5), std::string_view("mark", 4) },
+{ std::string_view("marriages", 9), std::string_view("marriage", 8) },
+{ std::string_view("marrying", 8), std::string_view("marry", 5) },
+{ std::string_view("mars", 4), std::string_view("mar", 3) },
+{ std::string_view("marshes", 7), std::string_view("marsh", 5) },
+{ std::string_view("martyrs", 7), std::string_view("martyr", 6) },
+{ std::string_view("marveled", 8), std::string_view("marvel", 6) },
+{ std::string_view("marveling", 9), std::string_view("marvel", 6) },
+{ std::string_view("marvels", 7), std::string_view("marvel", 6) },
+{ std::string_view("masquerades", 11), std::string_view("masquerade", 10) },
+{ std::string_view("masquerading", 12), std::string_view("masquerade", 10) },
+{ std::string_view("masters", 7), std::string_view("master", 6) },
+{ std::string_view("masts", 5), std::string_view("mast", 4) },
+{ std::string_view("mats", 4), std::string_view("mat", 3) },
+{ std::string_view("matters", 7), std::string_view("matter", 6) },
+{ std::string_view("mattocks", 8), std::string_view("mattock", 7) },
+{ std::string_view("mauled", 6), std::string_view("maul", 4) },
+{ std::string_view("maying", 6), std::string_view("may", 3) },
+{ std::string_view("meadows", 7), std::string_view("meadow", 6) },
+{ std::string_view("meanest", 7), std::string_view("means", 5) },
+{ std::string_view("meaning", 7), std::string_view("mean", 4) },
+{ std::string_view("means", 5), std::string_view("mean", 4) },
+{ std::string_view("measured", 8), std::string_view("measure", 7) },
+{ std::string_view("measures", 8), std::string_view("measure", 7) },
+{ std::string_view("measuring", 9), std::string_view("measure", 7) },
+{ std::string_view("meats", 5), std::string_view("meat", 4) },
+{ std::string_view("meddled", 7), std::string_view("meddle", 6) },
+{ std::string_view("meddles", 7), std::string_view("meddle", 6) },
+{ std::string_view("meddling", 8), std::string_view("meddle", 6) },
+{ std::string_view("medes", 5), std::string_view("mede", 4) },
+{ std::string_view("medicines", 9), std::string_view("medicine", 8) },
+{ std::string_view("meditated", 9), std::string_view("meditate", 8) },
+{ std::string_view("meditates", 9), std::string_view("meditate", 8) },
+{ std::string_view("meetest", 7), std::string_view("meets", 5) },
+{ std::string_view("meeting", 7), std::string_view("meet", 4) },
+{ std::string_view("meets", 5), std::string_view("meet", 4) },
+{ std::string_view("mehunims", 8), std::string_view("mehunim", 7) },
+{ std::string_view("melted", 6), std::string_view("melt", 4) },
+{ std::string_view("melting", 7), std::string_view("melt", 4) },
+{ std::string_view("melts", 5), std::string_view("melt", 4) },
+{ std::string_view("members", 7), std::string_view("member", 6) },
+{ std::string_view("mend", 4), std::string_view("men", 3) },
+{ std::string_view("mending", 7), std::string_view("mend", 4) },
+{ std::string_view("mentioned", 9), std::string_view("mention", 7) },
+{ std::string_view("mentioning", 10), std::string_view("mention", 7) },
+{ std::string_view("merchants", 9), std::string_view("merchant", 8) },
+{ std::string_view("mered", 5), std::string_view("mere", 4) },
+{ std::string_view("meres", 5), std::string_view("mere", 4) },
+{ std::string_view("messengers", 10), std::string_view("messenger", 9) },
+{ std::string_view("messes", 6), std::string_view("mess", 4) },
+{ std::string_view("metals", 6), std::string_view("metal", 5) },
+{ std::string_view("meted", 5), std::string_view("met", 3) },
+{ std::string_view("midianite", 9), std::string_view("midian", 6) },
+{ std::string_view("midianites", 10), std::string_view("midianite", 9) },
+{ std::string_view("mightest", 8), std::string_view("mighty", 6) },
+{ std::string_view("mighting", 8), std::string_view("might", 5) },
+{ std::string_view("millions", 8), std::string_view("million", 7) },
+{ std::string_view("mills", 5), std::string_view("mill", 4) },
+{ std::string_view("millstones", 10), std::string_view("millstone", 9) },
+{ std::string_view("minas", 5), std::string_view("mina", 4) },
+{ std::string_view("minded", 6), std::string_view("mind", 4) },
+{ std::string_view("minding", 7), std::string_view("mind", 4) },
+{ std::string_view("minds", 5), std::string_view("mind", 4) },
+{ std::string_view("mingled", 7), std::string_view("mingle", 6) },
+{ std::string_view("minished", 8), std::string_view("minish", 6) },
+{ std::string_view("ministered", 10), std::string_view("minister", 8) },
+{ std::string_view("ministering", 11), std::string_view("minister", 8) },
+{ std::string_view("ministers", 9), std::string_view("minister", 8) },
+{ std::string_view("minstrels", 9), std::string_view("minstrel", 8) },
+{ std::string_view("miracles", 8), std::string_view("miracle", 7) },
+{ std::string_view("mirrors", 7), std::string_view("mirror", 6) },
+{ std::string_view("miscarrying", 11), std::string_view("miscarry", 8) },
+{ std::string_view("mischiefs", 9), std::string_view("mischief", 8) },
+{ std::string_view("missed", 6), std::string_view("miss", 4) },
+{ std::string_view("missing", 7), std::string_view("miss", 4) },
+{ std::string_view("mite", 4), std::string_view("m", 1) },
+{ std::string_view("mites", 5), std::string_view("mite", 4) },
+{ std::string_view("mixed", 5), std::string_view("mix", 3) },
+{ std::string_view("mixes", 5), std::string_view("mix", 3) },
+{ std::string_view("moabite", 7), std::string_view("moab", 4) },
+{ std::string_view("moabites", 8), std::string_view("moabite", 7) },
+{ std::string_view("moabitess", 9), std::string_view("moabites", 8) },
+{ std::string_view("moaning", 7), std::string_view("moan", 4) },
+{ std::string_view("mocked", 6), std::string_view("mock", 4) },
+{ std::string_view("mockers", 7), std::string_view("mocker", 6) },
+{ std::string_view("mockest", 7), std::string_view("mocks", 5) },
+{ std::string_view("mocking", 7), std::string_view("mock", 4) },
+{ std::string_view("mockings", 8), std::string_view("mocking", 7) },
+{ std::string_view("mocks", 5), std::string_view("mock", 4) },
+{ std::string_view("modest", 6), std::string_view("mode", 4) },
+{ std::string_view("moistened", 9), std::string_view("moisten", 7) },
+{ std::string_view("molding", 7), std::string_view("moldy", 5) },
+{ std::string_view("moles", 5), std::string_view("mole", 4) },
+{ std::string_view("monsters", 8), std::string_view("monster", 7) },
+{ std::string_view("months", 6), std::string_view("month", 5) },
+{ std::string_view("monuments", 9), std::string_view("monument", 8) },
+{ std::string_view("moons", 5), std::string_view("moon", 4) },
+{ std::string_view("morals", 6), std::string_view("moral", 5) },
+{ std::string_view("mornings", 8), std::string_view("morning", 7) },
+{ std::string_view("morsels", 7), std::string_view("morsel", 6) },
+{ std::string_view("mortals", 7), std::string_view("mortal", 6) },
+{ std::string_view("mortars", 7), std::string_view("mortar", 6) },
+{ std::string_view("mothers", 7), std::string_view("mother", 6) },
+{ std::string_view("mounds", 6), std::string_view("mound", 5) },
+{ std::string_view("mountains", 9), std::string_view("mountain", 8) },
+{ std::string_view("mounted", 7), std::string_view("mount", 5) },
+{ std::string_view("mounting", 8), std::string_view("mount", 5) },
+{ std::string_view("mounts", 6), std::string_view("mount", 5) },
+{ std::string_view("mourned", 7), std::string_view("mourn", 5) },
+{ std::string_view("mourners", 8), std::string_view("mourner", 7) },
+{ std::string_view("mourning", 8), std::string_view("mourn", 5) },
+{ std::string_view("mourns", 6), std::string_view("mourn", 5) },
+{ std::string_view("mouths", 6), std::string_view("mouth", 5) },
+{ std::string_view("moved", 5), std::string_view("move", 4) },
+{ std::string_view("moves", 5), std::string_view("move", 4) },
+{ std::string_view("moving", 6), std::string_view("move", 4) },
+{ std::string_view("mules", 5), std::string_view("mule", 4) },
+{ std::string_view("multiplying", 11), std::string_view("multiply", 8) },
+{ std::string_view("multitudes", 10), std::string_view("multitude", 9) },
+{ std::string_view("munitions", 9), std::string_view("munition", 8) },
+{ std::string_view("murdered", 8), std::string_view("murder", 6) },
+{ std::string_view("murderers", 9), std::string_view("murderer", 8) },
+{ std::string_view("murders", 7), std::string_view("murder", 6) },
+{ std::string_view("murmured", 8), std::string_view("murmur", 6) },
+{ std::string_view("murmuring", 9), std::string_view("murmur", 6) },
+{ std::string_view("murmurings", 10), std::string_view("murmuring", 9) },
+{ std::string_view("mused", 5), std::string_view("muse", 4) },
+{ std::string_view("musicians", 9), std::string_view("musician", 8) },
+{ std::string_view("musing", 6), std::string_view("muse", 4) },
+{ std::string_view("muttered", 8), std::string_view("mutter", 6) },
+{ std::string_view("mutters", 7), std::string_view("mutter", 6) },
+{ std::string_view("nailing", 7), std::string_view("nail", 4) },
+{ std::string_view("nails", 5), std::string_view("nail", 4) },
+{ std::string_view("named", 5), std::string_view("name", 4) },
+{ std::string_view("names", 5), std::string_view("name", 4) },
+{ std::string_view("narrowed", 8), std::string_view("narrow", 6) },
+{ std::string_view("nations", 7), std::string_view("nation", 6) },
+{ std::string_view("natives", 7), std::string_view("native", 6) },
+{ std::string_view("nazarenes", 9), std::string_view("nazarene", 8) },
+{ std::string_view("nazarites", 9), std::string_view("nazarite", 8) },
+{ std::string_view("nazirites", 9), std::string_view("nazirite", 8) },
+{ std::string_view("nearing", 7), std::string_view("near", 4) },
+{ std::string_view("necked", 6), std::string_view("neck", 4) },
+{ std::string_view("necks", 5), std::string_view("neck", 4) },
+{ std::string_view("needed", 6), std::string_view("need", 4) },
+{ std::string_view("needest", 7), std::string_view("needs", 5) },
+{ std::string_view("needing", 7), std::string_view("need", 4) },
+{ std::string_view("needs", 5), std::string_view("need", 4) },
+{ std::string_view("neglected", 9), std::string_view("neglect", 7) },
+{ std::string_view("neglecting", 10), std::string_view("neglect", 7) },
+{ std::string_view("neighbors", 9), std::string_view("neighbor", 8) },
+{ std::string_view("neighbours", 10), std::string_view("neighbour", 9) },
+{ std::string_view("neighed", 7), std::string_view("neigh", 5) },
+{ std::string_view("neighing", 8), std::string_view("neigh", 5) },
+{ std::string_view("neighings", 9), std::string_view("neighing", 8) },
+{ std::string_view("nephews", 7), std::string_view("nephew", 6) },
+{ std::string_view("nest", 4), std::string_view("nd", 2) },
+{ std::string_view("nests", 5), std::string_view("nest", 4) },
+{ std::string_view("nethinims", 9), std::string_view("nethinim", 8) },
+{ std::string_view("netophathites", 13), std::string_view("netophathite", 12) },
+{ std::string_view("nets", 4), std::string_view("net", 3) },
+{ std::string_view("networks", 8), std::string_view("network", 7) },
+{ std::string_view("news", 4), std::string_view("new", 3) },
+{ std::string_view("nights", 6), std::string_view("night", 5) },
+{ std::string_view("nobles", 6), std::string_view("noble", 5) },
+{ std::string_view("nod", 3), std::string_view("no", 2) },
+{ std::string_view("noised", 6), std::string_view("noise", 5) },
+{ std::string_view("noses", 5), std::string_view("nose", 4) },
+{ std::string_view("noted", 5), std::string_view("not", 3) },
+{ std::string_view("noticed", 7), std::string_view("notice", 6) },
+{ std::string_view("nourished", 9), std::string_view("nourish", 7) },
+{ std::string_view("nourishes", 9), std::string_view("nourish", 7) },
+{ std::string_view("nourishing", 10), std::string_view("nourish", 7) },
+{ std::string_view("numbered", 8), std::string_view("number", 6) },
+{ std::string_view("numberest", 9), std::string_view("numbers", 7) },
+{ std::string_view("numbering", 9), std::string_view("number", 6) },
+{ std::string_view("numbers", 7), std::string_view("number", 6) },
+{ std::string_view("nursed", 6), std::string_view("nurse", 5) },
+{ std::string_view("nursing", 7), std::string_view("nurse", 5) },
+{ std::string_view("nurtured", 8), std::string_view("nurture", 7) },
+{ std::string_view("nuts", 4), std::string_view("nut", 3) },
+{ std::string_view("oaks", 4), std::string_view("oak", 3) },
+{ std::string_view("oars", 4), std::string_view("oar", 3) },
+{ std::string_view("oaths", 5), std::string_view("oath", 4) },
+{ std::string_view("obeyed", 6), std::string_view("obey", 4) },
+{ std::string_view("obeying", 7), std::string_view("obey", 4) },
+{ std::string_view("obeys", 5), std::string_view("obey", 4) },
+{ std::string_view("objects", 7), std::string_view("object", 6) },
+{ std::string_view("oblations", 9), std::string_view("oblation", 8) },
+{ std::string_view("observed", 8), std::string_view("observe", 7) },
+{ std::string_view("observers", 9), std::string_view("observer", 8) },
+{ std::string_view("observes", 8), std::string_view("observe", 7) },
+{ std::string_view("observest", 9), std::string_view("observe", 7) },
+{ std::string_view("observing", 9), std::string_view("observe", 7) },
+{ std::string_view("obtained", 8), std::string_view("obtain", 6) },
+{ std::string_view("obtaining", 9), std::string_view("obtain", 6) },
+{ std::string_view("obtains", 7), std::string_view("obtain", 6) },
+{ std::string_view("occasioned", 10), std::string_view("occasion", 8) },
+{ std::string_view("occasions", 9), std::string_view("occasion", 8) },
+{ std::string_view("odds", 4), std::string_view("odd", 3) },
+{ std::string_view("odors", 5), std::string_view("odor", 4) },
+{ std::string_view("odours", 6), std::string_view("odour", 5) },
+{ std::string_view("offences", 8), std::string_view("offence", 7) },
+{ std::string_view("offended", 8), std::string_view("offend", 6) },
+{ std::string_view("offenders", 9), std::string_view("offender", 8) },
+{ std::string_view("offenses", 8), std::string_view("offense", 7) },
+{ std::string_view("offered", 7), std::string_view("offer", 5) },
+{ std::string_view("offering", 8), std::string_view("offer", 5) },
+{ std::string_view("offerings", 9), std::string_view("offering", 8) },
+{ std::string_view("offers", 6), std::string_view("offer", 5) },
+{ std::string_view("officers", 8), std::string_view("officer", 7) },
+{ std::string_view("offices", 7), std::string_view("office", 6) },
+{ std::string_view("officials", 9), std::string_view("official", 8) },
+{ std::string_view("oiled", 5), std::string_view("oil", 3) },
+{ std::string_view("oils", 4), std::string_view("oil", 3) },
+{ std::string_view("ointments", 9), std::string_view("ointment", 8) },
+{ std::string_view("olding", 6), std::string_view("old", 3) },
+{ std::string_view("olives", 6), std::string_view("olive", 5) },
+{ std::string_view("oliveyards", 10), std::string_view("oliveyard", 9) },
+{ std::string_view("omers", 5), std::string_view("omer", 4) },
+{ std::string_view("ones", 4), std::string_view("on", 2) },
+{ std::string_view("opened", 6), std::string_view("open", 4) },
+{ std::string_view("openest", 7), std::string_view("opens", 5) },
+{ std::string_view("opening", 7), std::string_view("open", 4) },
+{ std::string_view("openings", 8), std::string_view("opening", 7) },
+{ std::string_view("opens", 5), std::string_view("open", 4) },
+{ std::string_view("operations", 10), std::string_view("operation", 9) },
+{ std::string_view("opinions", 8), std::string_view("opinion", 7) },
+{ std::string_view("opposed", 7), std::string_view("oppose", 6) },
+{ std::string_view("opposes", 7), std::string_view("oppose", 6) },
+{ std::string_view("opposest", 8), std::string_view("oppose", 6) },
+{ std::string_view("oppressed", 9), std::string_view("oppress", 7) },
+{ std::string_view("oppresses", 9), std::string_view("oppress", 7) },
+{ std::string_view("oppressing", 10), std::string_view("oppress", 7) },
+{ std::string_view("oppressions", 11), std::string_view("oppression", 10) },
+{ std::string_view("oppressors", 10), std::string_view("oppressor", 9) },
+{ std::string_view("oracles", 7), std::string_view("oracle", 6) },
+{ std::string_view("orchards", 8), std::string_view("orchard", 7) },
+{ std::string_view("ordained", 8), std::string_view("ordain", 6) },
+{ std::string_view("ordered", 7), std::string_view("order", 5) },
+{ std::string_view("ordering", 8), std::string_view("order", 5) },
+{ std::string_view("orderings", 9), std::string_view("ordering", 8) },
+{ std::string_view("orders", 6), std::string_view("order", 5) },
+{ std::string_view("ordinances", 10), std::string_view("ordinance", 9) },
+{ std::string_view("organs", 6), std::string_view("organ", 5) },
+{ std::string_view("ornaments", 9), std::string_view("ornament", 8) },
+{ std::string_view("ostriches", 9), std::string_view("ostrich", 7) },
+{ std::string_view("others", 6), std::string_view("other", 5) },
+{ std::string_view("oughting", 8), std::string_view("ought", 5) },
+{ std::string_view("ours", 4), std::string_view("our", 3) },
+{ std::string_view("outcasts", 8), std::string_view("outcast", 7) },
+{ std::string_view("ovens", 5), std::string_view("oven", 4) },
+{ std::string_view("overcharged", 11), std::string_view("overcharge", 10) },
+{ std::string_view("overcomes", 9), std::string_view("overcome", 8) },
+{ std::string_view("overflowed", 10), std::string_view("overflow", 8) },
+{ std::string_view("overflowing", 11), std::string_view("overflow", 8) },
+{ std::string_view("overflows", 9), std::string_view("overflow", 8) },
+{ std::string_view("overlaying", 10), std::string_view("overlay", 7) },
+{ std::string_view("overlays", 8), std::string_view("overlay", 7) },
+{ std::string_view("overlooked", 10), std::string_view("overlook", 8) },
+{ std::string_view("overlooks", 9), std::string_view("overlook", 8) },
+{ std::string_view("overseers", 9), std::string_view("overseer", 8) },
+{ std::string_view("overshadowed", 12), std::string_view("overshadow", 10) },
+{ std::string_view("overshadowing", 13), std::string_view("overshadow", 10) },
+{ std::string_view("overspreading", 13), std::string_view("overspread", 10) },
+{ std::string_view("overtakes", 9), std::string_view("overtake", 8) },
+{ std::string_view("overthrowing", 12), std::string_view("overthrow", 9) },
+{ std::string_view("overthrows", 10), std::string_view("overthrow", 9) },
+{ std::string_view("overturned", 10), std::string_view("overturn", 8) },
+{ std::string_view("overturns", 9), std::string_view("overturn", 8) },
+{ std::string_view("overwhelmed", 11), std::string_view("overwhelm", 9) },
+{ std::string_view("overwhelming", 12), std::string_view("overwhelm", 9) },
+{ std::string_view("owed", 4), std::string_view("owe", 3) },
+{ std::string_view("owes", 4), std::string_view("owe", 3) },
+{ std::string_view("owest", 5), std::string_view("owe", 3) },
+{ std::string_view("owls", 4), std::string_view("owl", 3) },
+{ std::string_view("owners", 6), std::string_view("owner", 5) },
+{ std::string_view("owns", 4), std::string_view("own", 3) },
+{ std::string_view("paces", 5), std::string_view("pace", 4) },
+{ std::string_view("paid", 4), std::string_view("pai", 3) },
+{ std::string_view("pained", 6), std::string_view("pain", 4) },
+{ std::string_view("pains", 5), std::string_view("pain", 4) },
+{ std::string_view("painted", 7), std::string_view("paint", 5) },
+{ std::string_view("painting", 8), std::string_view("paint", 5) },
+{ std::string_view("pairs", 5), std::string_view("pair", 4) },
+{ std::string_view("palaces", 7), std::string_view("palace", 6) },
+{ std::string_view("palms", 5), std::string_view("palm", 4) },
+{ std::string_view("pans", 4), std::string_view("pan", 3) },
+{ std::string_view("panted", 6), std::string_view("pant", 4) },
+{ std::string_view("pants", 5), std::string_view("pant", 4) },
+{ std::string_view("parables", 8), std::string_view("parable", 7) },
+{ std::string_view("paralytics", 10), std::string_view("paralytic", 9) },
+{ std::string_view("pardoned", 8), std::string_view("pardon", 6) },
+{ std::string_view("pardons", 7), std::string_view("pardon", 6) },
+{ std::string_view("parlours", 8), std::string_view("parlour", 7) },
+{ std::string_view("partakers", 9), std::string_view("partaker", 8) },
+{ std::string_view("partakest", 9), std::string_view("partake", 7) },
+{ std::string_view("parted", 6), std::string_view("part", 4) },
+{ std::string_view("parting", 7), std::string_view("part", 4) },
+{ std::string_view("partners", 8), std::string_view("partner", 7) },
+{ std::string_view("parts", 5), std::string_view("part", 4) },
+{ std::string_view("passages", 8), std::string_view("passage", 7) },
+{ std::string_view("passed", 6), std::string_view("pass", 4) },
+{ std::string_view("passes", 6), std::string_view("pass", 4) },
+{ std::string_view("passing", 7), std::string_view("pass", 4) },
+{ std::string_view("passions", 8), std::string_view("passion", 7) },
+{ std::string_view("passovers", 9), std::string_view("passover", 8) },
+{ std::string_view("pastors", 7), std::string_view("pastor", 6) },
+{ std::string_view("pastures", 8), std::string_view("pasture", 7) },
+{ std::string_view("patched", 7), std::string_view("patch", 5) },
+{ std::string_view("paths", 5), std::string_view("path", 4) },
+{ std::string_view("patriarchs", 10), std::string_view("patriarch", 9) },
+{ std::string_view("patterns", 8), std::string_view("pattern", 7) },
+{ std::string_view("pavilions", 9), std::string_view("pavilion", 8) },
+{ std::string_view("paws", 4), std::string_view("paw", 3) },
+{ std::string_view("payed", 5), std::string_view("pay", 3) },
+{ std::string_view("paying", 6), std::string_view("pay", 3) },
+{ std::string_view("pays", 4), std::string_view("pay", 3) },
+{ std::string_view("pearls", 6), std::string_view("pearl", 5) },
+{ std::string_view("peeped", 6), std::string_view("peep", 4) },
+{ std::string_view("pens", 4), std::string_view("pen", 3) },
+{ std::string_view("peoples", 7), std::string_view("people", 6) },
+{ std::string_view("perceived", 9), std::string_view("perceive", 8) },
+{ std::string_view("perceives", 9), std::string_view("perceive", 8) },
+{ std::string_view("perceivest", 10), std::string_view("perceive", 8) },
+{ std::string_view("perceiving", 10), std::string_view("perceive", 8) },
+{ std::string_view("perfected", 9), std::string_view("perfect", 7) },
+{ std::string_view("perfecting", 10), std::string_view("perfect", 7) },
+{ std::string_view("performed", 9), std::string_view("perform", 7) },
+{ std::string_view("performing", 10), std::string_view("perform", 7) },
+{ std::string_view("performs", 8), std::string_view("perform", 7) },
+{ std::string_view("perfumed", 8), std::string_view("perfume", 7) },
+{ std::string_view("perfumers", 9), std::string_view("perfumer", 8) },
+{ std::string_view("perfumes", 8), std::string_view("perfume", 7) },
+{ std::string_view("perils", 6), std::string_view("peril", 5) },
+{ std::string_view("perished", 8), std::string_view("perish", 6) },
+{ std::string_view("perishes", 8), std::string_view("perish", 6) },
+{ std::string_view("perishing", 9), std::string_view("perish", 6) },
+{ std::string_view("perizzites", 10), std::string_view("perizzite", 9) },
+{ std::string_view("permits", 7), std::string_view("permit", 6) },
+{ std::string_view("persecuted", 10), std::string_view("persecute", 9) },
+{ std::string_view("persecutest", 11), std::string_view("persecute", 9) },
+{ std::string_view("persecuting", 11), std::string_view("persecute", 9) },
+{ std::string_view("persecutions", 12), std::string_view("persecution", 11) },
+{ std::string_view("persecutors", 11), std::string_view("persecutor", 10) },
+{ std::string_view("persians", 8), std::string_view("persian", 7) },
+{ std::string_view("persons", 7), std::string_view("person", 6) },
+{ std::string_view("persuaded", 9), std::string_view("persuade", 8) },
+{ std::string_view("persuades", 9), std::string_view("persuade", 8) },
+{ std::string_view("persuadest", 10), std::string_view("persuade", 8) },
+{ std::string_view("persuading", 10), std::string_view("persuade", 8) },
+{ std::string_view("pertained", 9), std::string_view("pertain", 7) },
+{ std::string_view("pertaining", 10), std::string_view("pertain", 7) },
+{ std::string_view("pertains", 8), std::string_view("pertain", 7) },
+{ std::string_view("perverted", 9), std::string_view("pervert", 7) },
+{ std::string_view("perverting", 10), std::string_view("pervert", 7) },
+{ std::string_view("perverts", 8), std::string_view("pervert", 7) },
+{ std::string_view("pestilences", 11), std::string_view("pestilence", 10) },
+{ std::string_view("petitioned", 10), std::string_view("petition", 8) },
+{ std::string_view("petitions", 9), std::string_view("petition", 8) },
+{ std::string_view("pharisees", 9), std::string_view("pharisee", 8) },
+{ std::string_view("philistines", 11), std::string_view("philistine", 10) },
+{ std::string_view("physicians", 10), std::string_view("physician", 9) },
+{ std::string_view("picked", 6), std::string_view("pick", 4) },
+{ std::string_view("pieces", 6), std::string_view("piece", 5) },
+{ std::string_view("pierced", 7), std::string_view("pierce", 6) },
+{ std::string_view("piercing", 8), std::string_view("pierce", 6) },
+{ std::string_view("piercings", 9), std::string_view("piercing", 8) },
+{ std::string_view("pigeons", 7), std::string_view("pigeon", 6) },
+{ std::string_view("pigs", 4), std::string_view("pig", 3) },
+{ std::string_view("piled", 5), std::string_view("pile", 4) },
+{ std::string_view("pillars", 7), std::string_view("pillar", 6) },
+{ std::string_view("pillows", 7), std::string_view("pillow", 6) },
+{ std::string_view("pilots", 6), std::string_view("pilot", 5) },
+{ std::string_view("pining", 6), std::string_view("pin", 3) },
+{ std::string_view("pinnacles", 9), std::string_view("pinnacle", 8) },
+{ std::string_view("pins", 4), std::string_view("pin", 3) },
+{ std::string_view("piped", 5), std::string_view("pipe", 4) },
+{ std::string_view("pipes", 5), std::string_view("pipe", 4) },
+{ std::string_view("pirathonite", 11), std::string_view("pirathon", 8) },
+{ std::string_view("pitched", 7), std::string_view("pitch", 5) },
+{ std::string_view("pitchers", 8), std::string_view("pitcher", 7) },
+{ std::string_view("pits", 4), std::string_view("pit", 3) },
+{ std::string_view("placed", 6), std::string_view("place", 5) },
+{ std::string_view("places", 6), std::string_view("place", 5) },
+{ std::string_view("plagued", 7), std::string_view("plague", 6) },
+{ std::string_view("plagues", 7), std::string_view("plague", 6) },
+{ std::string_view("plains", 6), std::string_view("plain", 5) },
+{ std::string_view("plaistered", 10), std::string_view("plaister", 8) },
+{ std::string_view("planes", 6), std::string_view("plan", 4) },
+{ std::string_view("plans", 5), std::string_view("plan", 4) },
+{ std::string_view("planted", 7), std::string_view("plant", 5) },
+{ std::string_view("planting", 8), std::string_view("plant", 5) },
+{ std::string_view("plantings", 9), std::string_view("planting", 8) },
+{ std::string_view("plants", 6), std::string_view("plant", 5) },
+{ std::string_view("plastered", 9), std::string_view("plaster", 7) },
+{ std::string_view("plates", 6), std::string_view("plat", 4) },
+{ std::string_view("plating", 7), std::string_view("plat", 4) },
+{ std::string_view("platters", 8), std::string_view("platter", 7) },
+{ std::string_view("played", 6), std::string_view("play", 4) },
+{ std::string_view("players", 7), std::string_view("player", 6) },
+{ std::string_view("playing", 7), std::string_view("play", 4) },
+{ std::string_view("plead", 5), std::string_view("plea", 4) },
+{ std::string_view("pleaded", 7), std::string_view("plead", 5) },
+{ std::string_view("pleads", 6), std::string_view("plead", 5) },
+{ std::string_view("pleas", 5), std::string_view("plea", 4) },
+{ std::string_view("pleased", 7), std::string_view("pleas", 5) },
+{ std::string_view("pleases", 7), std::string_view("pleas", 5) },
+{ std::string_view("pleasing", 8), std::string_view("pleas", 5) },
+{ std::string_view("pleasures", 9), std::string_view("pleasure", 8) },
+{ std::string_view("pledged", 7), std::string_view("pledge", 6) },
+{ std::string_view("pledges", 7), std::string_view("pledge", 6) },
+{ std::string_view("plots", 5), std::string_view("plot", 4) },
+{ std::string_view("plowed", 6), std::string_view("plow", 4) },
+{ std::string_view("plowing", 7), std::string_view("plow", 4) },
+{ std::string_view("plows", 5), std::string_view("plow", 4) },
+{ std::string_view("plowshares", 10), std::string_view("plowshare", 9) },
+{ std::string_view("plucked", 7), std::string_view("pluck", 5) },
+{ std::string_view("plucking", 8), std::string_view("pluck", 5) },
+{ std::string_view("plundered", 9), std::string_view("plunder", 7) },
+{ std::string_view("plundering", 10), std::string_view("plunder", 7) },
+{ std::string_view("pointed", 7), std::string_view("point", 5) },
+{ std::string_view("points", 6), std::string_view("point", 5) },
+{ std::string_view("poisons", 7), std::string_view("poison", 6) },
+{ std::string_view("poles", 5), std::string_view("pole", 4) },
+{ std::string_view("polled", 6), std::string_view("poll", 4) },
+{ std::string_view("polls", 5), std::string_view("poll", 4) },
+{ std::string_view("polluted", 8), std::string_view("pollute", 7) },
+{ std::string_view("pollutes", 8), std::string_view("pollute", 7) },
+{ std::string_view("polluting", 9), std::string_view("pollute", 7) },
+{ std::string_view("pollutions", 10), std::string_view("pollution", 9) },
+{ std::string_view("pomegranates", 12), std::string_view("pomegranate", 11) },
+{ std::string_view("pondered", 8), std::string_view("ponder", 6) },
+{ std::string_view("pondering", 9), std::string_view("ponder", 6) },
+{ std::string_view("pools", 5), std::string_view("pool", 4) },
+{ std::string_view("pooring", 7), std::string_view("poor", 4) },
+{ std::string_view("poplars", 7), std::string_view("poplar", 6) },
+{ std::string_view("porches", 7), std::string_view("porch", 5) },
+{ std::string_view("porters", 7), std::string_view("porter", 6) },
+{ std::string_view("portions", 8), std::string_view("portion", 7) },
+{ std::string_view("portrayed", 9), std::string_view("portray", 7) },
+{ std::string_view("possessed", 9), std::string_view("possess", 7) },
+{ std::string_view("possesses", 9), std::string_view("possess", 7) },
+{ std::string_view("possessing", 10), std::string_view("possess", 7) },
+{ std::string_view("possessions", 11), std::string_view("possession", 10) },
+{ std::string_view("possessors", 10), std::string_view("possessor", 9) },
+{ std::string_view("posted", 6), std::string_view("post", 4) },
+{ std::string_view("posts", 5), std::string_view("post", 4) },
+{ std::string_view("pots", 4), std::string_view("pot", 3) },
+{ std::string_view("potsherds", 9), std::string_view("potsherd", 8) },
+{ std::string_view("potters", 7), std::string_view("potter", 6) },
+{ std::string_view("pounded", 7), std::string_view("pound", 5) },
+{ std::string_view("pounds", 6), std::string_view("pound", 5) },
+{ std::string_view("poured", 6), std::string_view("pour", 4) },
+{ std::string_view("pouring", 7), std::string_view("pour", 4) },
+{ std::string_view("pours", 5), std::string_view("pour", 4) },
+{ std::string_view("pourtrayed", 10), std::string_view("pourtray", 8) },
+{ std::string_view("powders", 7), std::string_view("powder", 6) },
+{ std::string_view("powers", 6), std::string_view("power", 5) },
+{ std::string_view("practiced", 9), std::string_view("practice", 8) },
+{ std::string_view("practices", 9), std::string_view("practice", 8) },
+{ std::string_view("practised", 9), std::string_view("practise", 8) },
+{ std::string_view("praised", 7), std::string_view("praise", 6) },
+{ std::string_view("praises", 7), std::string_view("praise", 6) },
+{ std::string_view("praising", 8), std::string_view("praise", 6) },
+{ std::string_view("prancings", 9), std::string_view("prancing", 8) },
+{ std::string_view("pransings", 9), std::string_view("pransing", 8) },
+{ std::string_view("prayed", 6), std::string_view("pray", 4) },
+{ std::string_view("prayers", 7), std::string_view("prayer", 6) },
+{ std::string_view("prayest", 7), std::string_view("prays", 5) },
+{ std::string_view("praying", 7), std::string_view("pray", 4) },
+{ std::string_view("prays", 5), std::string_view("pray", 4) },
+{ std::string_view("preached", 8), std::string_view("preach", 6) },
+{ std::string_view("preaches", 8), std::string_view("preach", 6) },
+{ std::string_view("preaching", 9), std::string_view("preach", 6) },
+{ std::string_view("precepts", 8), std::string_view("precept", 7) },
+{ std::string_view("predestinated", 13), std::string_view("predestinate", 12) },
+{ std::string_view("preparations", 12), std::string_view("preparation", 11) },
+{ std::string_view("prepared", 8), std::string_view("prepare", 7) },
+{ std::string_view("prepares", 8), std::string_view("prepare", 7) },
+{ std::string_view("preparest", 9), std::string_view("prepare", 7) },
+{ std::string_view("preparing", 9), std::string_view("prepare", 7) },
+{ std::string_view("presented", 9), std::string_view("present", 7) },
+{ std::string_view("presenting", 10), std::string_view("present", 7) },
+{ std::string_view("presents", 8), std::string_view("present", 7) },
+{ std::string_view("preserved", 9), std::string_view("preserve", 8) },
+{ std::string_view("preserves", 9), std::string_view("preserve", 8) },
+{ std::string_view("preservest", 10), std::string_view("preserve", 8) },
+{ std::string_view("pressed", 7), std::string_view("press", 5) },
+{ std::string_view("presses", 7), std::string_view("press", 5) },
+{ std::string_view("pressing", 8), std::string_view("press", 5) },
+{ std::string_view("presumed", 8), std::string_view("presume", 7) },
+{ std::string_view("pretended", 9), std::string_view("pretend", 7) },
+{ std::string_view("pretending", 10), std::string_view("pretend", 7) },
+{ std::string_view("prevailed", 9), std::string_view("prevail", 7) },
+{ std::string_view("prevailest", 10), std::string_view("prevails", 8) },
+{ std::string_view("prevailing", 10), std::string_view("prevail", 7) },
+{ std::string_view("prevails", 8), std::string_view("prevail", 7) },
+{ std::string_view("prevented", 9), std::string_view("prevent", 7) },
+{ std::string_view("preventing", 10), std::string_view("prevent", 7) },
+{ std::string_view("priced", 6), std::string_view("price", 5) },
+{ std::string_view("prices", 6), std::string_view("price", 5) },
+{ std::string_view("pricking", 8), std::string_view("pricks", 6) },
+{ std::string_view("priests", 7), std::string_view("priest", 6) },
+{ std::string_view("princes", 7), std::string_view("prince", 6) },
+{ std::string_view("princess", 8), std::string_view("princes", 7) },
+{ std::string_view("princesses", 10), std::string_view("princess", 8) },
+{ std::string_view("printed", 7), std::string_view("print", 5) },
+{ std::string_view("prisoners", 9), std::string_view("prisoner", 8) },
+{ std::string_view("prisons", 7), std::string_view("prison", 6) },
+{ std::string_view("prized", 6), std::string_view("prize", 5) },
+{ std::string_view("proceeded", 9), std::string_view("proceed", 7) },
+{ std::string_view("proceeding", 10), std::string_view("proceed", 7) },
+{ std::string_view("proceeds", 8), std::string_view("proceed", 7) },
+{ std::string_view("proclaimed", 10), std::string_view("proclaim", 8) },
+{ std::string_view("proclaiming", 11), std::string_view("proclaim", 8) },
+{ std::string_view("proconsuls", 10), std::string_view("proconsul", 9) },
+{ std::string_view("procured", 8), std::string_view("procure", 7) },
+{ std::string_view("produced", 8), std::string_view("produce", 7) },
+{ std::string_view("produces", 8), std::string_view("produce", 7) },
+{ std::string_view("profaned", 8), std::string_view("profane", 7) },
+{ std::string_view("profanes", 8), std::string_view("profane", 7) },
+{ std::string_view("profaning", 9), std::string_view("profane", 7) },
+{ std::string_view("professed", 9), std::string_view("profess", 7) },
+{ std::string_view("professing", 10), std::string_view("profess", 7) },
+{ std::string_view("profited", 8), std::string_view("profit", 6) },
+{ std::string_view("profiting", 9), std::string_view("profit", 6) },
+{ std::string_view("profits", 7), std::string_view("profit", 6) },
+{ std::string_view("prolonged", 9), std::string_view("prolong", 7) },
+{ std::string_view("prolongs", 8), std::string_view("prolong", 7) },
+{ std::string_view("promised", 8), std::string_view("promise", 7) },
+{ std::string_view("promises", 8), std::string_view("promise", 7) },
+{ std::string_view("promising", 9), std::string_view("promise", 7) },
+{ std::string_view("promoted", 8), std::string_view("promote", 7) },
+{ std::string_view("promotes", 8), std::string_view("promote", 7) },
+{ std::string_view("pronounced", 10), std::string_view("pronounce", 9) },
+{ std::string_view("pronounces", 10), std::string_view("pronounce", 9) },
+{ std::string_view("pronouncing", 11), std::string_view("pronounce", 9) },
+{ std::string_view("proofs", 6), std::string_view("proof", 5) },
+{ std::string_view("prophesying", 11), std::string_view("prophesy", 8) },
+{ std::string_view("prophesyings", 12), std::string_view("prophesying", 11) },
+{ std::string_view("prophets", 8), std::string_view("prophet", 7) },
+{ std::string_view("proselytes", 10), std::string_view("proselyte", 9) },
+{ std::string_view("prospered", 9), std::string_view("prosper", 7) },
+{ std::string_view("prospers", 8), std::string_view("prosper", 7) },
+{ std::string_view("prostituted", 11), std::string_view("prostitute", 10) },
+{ std::string_view("prostitutes", 11), std::string_view("prostitute", 10) },
+{ std::string_view("protects", 8), std::string_view("protect", 7) },
+{ std::string_view("protested", 9), std::string_view("protest", 7) },
+{ std::string_view("protesting", 10), std::string_view("protest", 7) },
+{ std::string_view("proved", 6), std::string_view("prove", 5) },
+{ std::string_view("proverbs", 8), std::string_view("proverb", 7) },
+{ std::string_view("proves", 6), std::string_view("prove", 5) },
+{ std::string_view("provided", 8), std::string_view("provide", 7) },
+{ std::string_view("provides", 8), std::string_view("provide", 7) },
+{ std::string_view("providing", 9), std::string_view("provide", 7) },
+{ std::string_view("provinces", 9), std::string_view("province", 8) },
+{ std::string_view("proving", 7), std::string_view("prove", 5) },
+{ std::string_view("provisioned", 11), std::string_view("provision", 9) },
+{ std::string_view("provisions", 10), std::string_view("provision", 9) },
+{ std::string_view("provocations", 12), std::string_view("provocation", 11) },
+{ std::string_view("provoked", 8), std::string_view("provoke", 7) },
+{ std::string_view("provokes", 8), std::string_view("provoke", 7) },
+{ std::string_view("provoking", 9), std::string_view("provoke", 7) },
+{ std::string_view("pruned", 6), std::string_view("prune", 5) },
+{ std::string_view("prunes", 6), std::string_view("prune", 5) },
+{ std::string_view("pruning", 7), std::string_view("prune", 5) },
+{ std::string_view("psalms", 6), std::string_view("psalm", 5) },
+{ std::string_view("publicans", 9), std::string_view("publican", 8) },
+{ std::string_view("published", 9), std::string_view("publish", 7) },
+{ std::string_view("publishes", 9), std::string_view("publish", 7) },
+{ std::string_view("pulled", 6), std::string_view("pull", 4) },
+{ std::string_view("pulling", 7), std::string_view("pull", 4) },
+{ std::string_view("punished", 8), std::string_view("punish", 6) },
+{ std::string_view("punishing", 9), std::string_view("punish", 6) },
+{ std::string_view("punishments", 11), std::string_view("punishment", 10) },
+{ std::string_view("purchased", 9), std::string_view("purchase", 8) },
+{ std::string_view("purest", 6), std::string_view("pure", 4) },
+{ std::string_view("purged", 6), std::string_view("purge", 5) },
+{ std::string_view("purges", 6), std::string_view("purge", 5) },
+{ std::string_view("purging", 7), std::string_view("purge", 5) },
+{ std::string_view("purifications", 13), std::string_view("purification", 12) },
+{ std::string_view("purifying", 9), std::string_view("purify", 6) },
+{ std::string_view("puring", 6), std::string_view("pur", 3) },
+{ std::string_view("purposed", 8), std::string_view("purpose", 7) },
+{ std::string_view("purposes", 8), std::string_view("purpose", 7) },
+{ std::string_view("purposing", 9), std::string_view("purpose", 7) },
+{ std::string_view("purses", 6), std::string_view("purse", 5) },
+{ std::string_view("pursued", 7), std::string_view("pursue", 6) },
+{ std::string_view("pursuers", 8), std::string_view("pursuer", 7) },
+{ std::string_view("pursues", 7), std::string_view("pursue", 6) },
+{ std::string_view("pursuing", 8), std::string_view("pursue", 6) },
+{ std::string_view("pushed", 6), std::string_view("push", 4) },
+{ std::string_view("pushing", 7), std::string_view("push", 4) },
+{ std::string_view("puts", 4), std::string_view("put", 3) },
+{ std::string_view("quails", 6), std::string_view("quail", 5) },
+{ std::string_view("quaked", 6), std::string_view("quake", 5) },
+{ std::string_view("quakes", 6), std::string_view("quake", 5) },
+{ std::string_view("quaking", 7), std::string_view("quake", 5) },
+{ std::string_view("quarreled", 9), std::string_view("quarrel", 7) },
+{ std::string_view("quarreling", 10), std::string_view("quarrel", 7) },
+{ std::string_view("quarrels", 8), std::string_view("quarrel", 7) },
+{ std::string_view("quarters", 8), std::string_view("quarter", 7) },
+{ std::string_view("queens", 6), std::string_view("queen", 5) },
+{ std::string_view("quenched", 8), std::string_view("quench", 6) },
+{ std::string_view("questioned", 10), std::string_view("question", 8) },
+{ std::string_view("questioning", 11), std::string_view("question", 8) },
+{ std::string_view("questionings", 12), std::string_view("questioning", 11) },
+{ std::string_view("questions", 9), std::string_view("question", 8) },
+{ std::string_view("quickened", 9), std::string_view("quicken", 7) },
+{ std::string_view("quickening", 10), std::string_view("quicken", 7) },
+{ std::string_view("quieted", 7), std::string_view("quiet", 5) },
+{ std::string_view("quivered", 8), std::string_view("quiver", 6) },
+{ std::string_view("quivering", 9), std::string_view("quiver", 6) },
+{ std::string_view("raged", 5), std::string_view("rage", 4) },
+{ std::string_view("rages", 5), std::string_view("rage", 4) },
+{ std::string_view("raging", 6), std::string_view("rage", 4) },
+{ std::string_view("railed", 6), std::string_view("rail", 4) },
+{ std::string_view("railing", 7), std::string_view("rail", 4) },
+{ std::string_view("railings", 8), std::string_view("railing", 7) },
+{ std::string_view("rained", 6), std::string_view("rain", 4) },
+{ std::string_view("rains", 5), std::string_view("rain", 4) },
+{ std::string_view("raised", 6), std::string_view("raise", 5) },
+{ std::string_view("raises", 6), std::string_view("raise", 5) },
+{ std::string_view("raising", 7), std::string_view("raise", 5) },
+{ std::string_view("raisins", 7), std::string_view("raisin", 6) },
+{ std::string_view("ramathite", 9), std::string_view("ramath", 6) },
+{ std::string_view("ramparts", 8), std::string_view("rampart", 7) },
+{ std::string_view("rams", 4), std::string_view("ram", 3) },
+{ std::string_view("ranges", 6), std::string_view("rang", 4) },
+{ std::string_view("ranging", 7), std::string_view("rang", 4) },
+{ std::string_view("ranks", 5), std::string_view("rank", 4) },
+{ std::string_view("ransomed", 8), std::string_view("ransom", 6) },
+{ std::string_view("rated", 5), std::string_view("rate", 4) },
+{ std::string_view("ravaged", 7), std::string_view("ravage", 6) },
+{ std::string_view("ravages", 7), std::string_view("ravage", 6) },
+{ std::string_view("ravening", 8), std::string_view("raven", 5) },
+{ std::string_view("ravens", 6), std::string_view("raven", 5) },
+{ std::string_view("reached", 7), std::string_view("reach", 5) },
+{ std::string_view("reaches", 7), std::string_view("reach", 5) },
+{ std::string_view("reaching", 8), std::string_view("reach", 5) },
+{ std::string_view("readest", 7), std::string_view("reads", 5) },
+{ std::string_view("reading", 7), std::string_view("read", 4) },
+{ std::string_view("reads", 5), std::string_view("read", 4) },
+{ std::string_view("reaped", 6), std::string_view("reap", 4) },
+{ std::string_view("reapers", 7), std::string_view("reaper", 6) },
+{ std::string_view("reapest", 7), std::string_view("reaps", 5) },
+{ std::string_view("reaping", 7), std::string_view("reap", 4) },
+{ std::string_view("reaps", 5), std::string_view("reap", 4) },
+{ std::string_view("reared", 6), std::string_view("rear", 4) },
+{ std::string_view("reasoned", 8), std::string_view("reason", 6) },
+{ std::string_view("reasoning", 9), std::string_view("reason", 6) },
+{ std::string_view("reasons", 7), std::string_view("reason", 6) },
+{ std::string_view("rebels", 6), std::string_view("rebel", 5) },
+{ std::string_view("rebuked", 7), std::string_view("rebuke", 6) },
+{ std::string_view("rebukes", 7), std::string_view("rebuke", 6) },
+{ std::string_view("rebuking", 8), std::string_view("rebuke", 6) },
+{ std::string_view("received", 8), std::string_view("receive", 7) },
+{ std::string_view("receives", 8), std::string_view("receive", 7) },
+{ std::string_view("receiving", 9), std::string_view("receive", 7) },
+{ std::string_view("reckoned", 8), std::string_view("reckon", 6) },
+{ std::string_view("reckoning", 9), std::string_view("reckon", 6) },
+{ std::string_view("reclining", 9), std::string_view("recline", 7) },
+{ std::string_view("recognized", 10), std::string_view("recognize", 9) },
+{ std::string_view("recognizing", 11), std::string_view("recognize", 9) },
+{ std::string_view("recompences", 11), std::string_view("recompence", 10) },
+{ std::string_view("recompensed", 11), std::string_view("recompense", 10) },
+{ std::string_view("recompenses", 11), std::string_view("recompense", 10) },
+{ std::string_view("recompensest", 12), std::string_view("recompense", 10) },
+{ std::string_view("recompensing", 12), std::string_view("recompense", 10) },
+{ std::string_view("reconciled", 10), std::string_view("reconcile", 9) },
+{ std::string_view("reconciling", 11), std::string_view("reconcile", 9) },
+{ std::string_view("recorded", 8), std::string_view("record", 6) },
+{ std::string_view("records", 7), std::string_view("record", 6) },
+{ std::string_view("recounted", 9), std::string_view("recount", 7) },
+{ std::string_view("recovered", 9), std::string_view("recover", 7) },
+{ std::string_view("recovering", 10), std::string_view("recover", 7) },
+{ std::string_view("redeemed", 8), std::string_view("redeem", 6) },
+{ std::string_view("redeeming", 9), std::string_view("redeem", 6) },
+{ std::string_view("redeems", 7), std::string_view("redeem", 6) },
+{ std::string_view("reeds", 5), std::string_view("reed", 4) },
+{ std::string_view("reeling", 7), std::string_view("reel", 4) },
+{ std::string_view("refined", 7), std::string_view("refine", 6) },
+{ std::string_view("refining", 8), std::string_view("refine", 6) },
+{ std::string_view("reflects", 8), std::string_view("reflect", 7) },
+{ std::string_view("refrained", 9), std::string_view("refrain", 7) },
+{ std::string_view("refreshed", 9), std::string_view("refresh", 7) },
+{ std::string_view("refreshes", 9), std::string_view("refresh", 7) },
+{ std::string_view("refreshing", 10), std::string_view("refresh", 7) },
+{ std::string_view("refused", 7), std::string_view("refuse", 6) },
+{ std::string_view("refuses", 7), std::string_view("refuse", 6) },
+{ std::string_view("refuted", 7), std::string_view("refute", 6) },
+{ std::string_view("regarded", 8), std::string_view("regard", 6) },
+{ std::string_view("regardest", 9), std::string_view("regards", 7) },
+{ std::string_view("regarding", 9), std::string_view("regard", 6) },
+{ std::string_view("regards", 7), std::string_view("regard", 6) },
+{ std::string_view("regions", 7), std::string_view("region", 6) },
+{ std::string_view("rehearsed", 9), std::string_view("rehearse", 8) },
+{ std::string_view("reigned", 7), std::string_view("reign", 5) },
+{ std::string_view("reignest", 8), std::string_view("reigns", 6) },
+{ std::string_view("reigning", 8), std::string_view("reign", 5) },
+{ std::string_view("reigns", 6), std::string_view("reign", 5) },
+{ std::string_view("rejected", 8), std::string_view("reject", 6) },
+{ std::string_view("rejects", 7), std::string_view("reject", 6) },
+{ std::string_view("rejoiced", 8), std::string_view("rejoice", 7) },
+{ std::string_view("rejoices", 8), std::string_view("rejoice", 7) },
+{ std::string_view("rejoicest", 9), std::string_view("rejoice", 7) },
+{ std::string_view("rejoicing", 9), std::string_view("rejoice", 7) },
+{ std::string_view("relatives", 9), std::string_view("relative", 8) },
+{ std::string_view("released", 8), std::string_view("release", 7) },
+{ std::string_view("relents", 7), std::string_view("relent", 6) },
+{ std::string_view("relieved", 8), std::string_view("relieve", 7) },
+{ std::string_view("remained", 8), std::string_view("remain", 6) },
+{ std::string_view("remainest", 9), std::string_view("remains", 7) },
+{ std::string_view("remaining", 9), std::string_view("remain", 6) },
+{ std::string_view("remains", 7), std::string_view("remain", 6) },
+{ std::string_view("remembered", 10), std::string_view("remember", 8) },
+{ std::string_view("rememberest", 11), std::string_view("remembers", 9) },
+{ std::string_view("remembering", 11), std::string_view("remember", 8) },
+{ std::string_view("remembers", 9), std::string_view("remember", 8) },
+{ std::string_view("remembrances", 12), std::string_view("remembrance", 11) },
+{ std::string_view("reminded", 8), std::string_view("remind", 6) },
+{ std::string_view("reminding", 9), std::string_view("remind", 6) },
+{ std::string_view("removed", 7), std::string_view("remove", 6) },
+{ std::string_view("removes", 7), std::string_view("remove", 6) },
+{ std::string_view("removing", 8), std::string_view("remove", 6) },
+{ std::string_view("rendered", 8), std::string_view("render", 6) },
+{ std::string_view("renderest", 9), std::string_view("renders", 7) },
+{ std::string_view("rendering", 9), std::string_view("render", 6) },
+{ std::string_view("renders", 7), std::string_view("render", 6) },
+{ std::string_view("rending", 7), std::string_view("rend", 4) },
+{ std::string_view("renewed", 7), std::string_view("renew", 5) },
+{ std::string_view("renewing", 8), std::string_view("renew", 5) },
+{ std::string_view("renounced", 9), std::string_view("renounce", 8) },
+{ std::string_view("renounces", 9), std::string_view("renounce", 8) },
+{ std::string_view("renowned", 8), std::string_view("renown", 6) },
+{ std::string_view("rented", 6), std::string_view("rent", 4) },
+{ std::string_view("renting", 7), std::string_view("rent", 4) },
+{ std::string_view("repaired", 8), std::string_view("repair", 6) },
+{ std::string_view("repairers", 9), std::string_view("repairer", 8) },
+{ std::string_view("repairing", 9), std::string_view("repair", 6) },
+{ std::string_view("repayed", 7), std::string_view("repay", 5) },
+{ std::string_view("repays", 6), std::string_view("repay", 5) },
+{ std::string_view("repented", 8), std::string_view("repent", 6) },
+{ std::string_view("repentest", 9), std::string_view("repents", 7) },
+{ std::string_view("repenting", 9), std::string_view("repent", 6) },
+{ std::string_view("repentings", 10), std::string_view("repenting", 9) },
+{ std::string_view("repents", 7), std::string_view("repent", 6) },
+{ std::string_view("rephaims", 8), std::string_view("rephaim", 7) },
+{ std::string_view("replenished", 11), std::string_view("replenish", 9) },
+{ std::string_view("reported", 8), std::string_view("report", 6) },
+{ std::string_view("reporting", 9), std::string_view("report", 6) },
+{ std::string_view("reproached", 10), std::string_view("reproach", 8) },
+{ std::string_view("reproaches", 10), std::string_view("reproach", 8) },
+{ std::string_view("reproaching", 11), std::string_view("reproach", 8) },
+{ std::string_view("reprobates", 10), std::string_view("reprobate", 9) },
+{ std::string_view("reproofs", 8), std::string_view("reproof", 7) },
+{ std::string_view("reproved", 8), std::string_view("reprove", 7) },
+{ std::string_view("reproves", 8), std::string_view("reprove", 7) },
+{ std::string_view("requested", 9), std::string_view("request", 7) },
+{ std::string_view("requesting", 10), std::string_view("request", 7) },
+{ std::string_view("requests", 8), std::string_view("request", 7) },
+{ std::string_view("required", 8), std::string_view("require", 7) },
+{ std::string_view("requires", 8), std::string_view("require", 7) },
+{ std::string_view("requirest", 9), std::string_view("require", 7) },
+{ std::string_view("requiring", 9), std::string_view("require", 7) },
+{ std::string_view("requited", 8), std::string_view("requite", 7) },
+{ std::string_view("requiting", 9), std::string_view("requite", 7) },
+{ std::string_view("rescued", 7), std::string_view("rescue", 6) },
+{ std::string_view("rescues", 7), std::string_view("rescue", 6) },
+{ std::string_view("resembled", 9), std::string_view("resemble", 8) },
+{ std::string_view("reserved", 8), std::string_view("reserve", 7) },
+{ std::string_view("resisted", 8), std::string_view("resist", 6) },
+{ std::string_view("resists", 7), std::string_view("resist", 6) },
+{ std::string_view("resorted", 8), std::string_view("resort", 6) },
+{ std::string_view("respected", 9), std::string_view("respect", 7) },
+{ std::string_view("respects", 8), std::string_view("respect", 7) },
+{ std::string_view("responded", 9), std::string_view("respond", 7) },
+{ std::string_view("rested", 6), std::string_view("rest", 4) },
+{ std::string_view("restest", 7), std::string_view("rests", 5) },
+{ std::string_view("resting", 7), std::string_view("rest", 4) },
+{ std::string_view("restored", 8), std::string_view("restore", 7) },
+{ std::string_view("restores", 8), std::string_view("restore", 7) },
+{ std::string_view("restoring", 9), std::string_view("restore", 7) },
+{ std::string_view("restrained", 10), std::string_view("restrain", 8) },
+{ std::string_view("restrainest", 11), std::string_view("restrains", 9) },
+{ std::string_view("restraining", 11), std::string_view("restrain", 8) },
+{ std::string_view("restrains", 9), std::string_view("restrain", 8) },
+{ std::string_view("rests", 5), std::string_view("rest", 4) },
+{ std::string_view("results", 7), std::string_view("result", 6) },
+{ std::string_view("retained", 8), std::string_view("retain", 6) },
+{ std::string_view("retains", 7), std::string_view("retain", 6) },
+{ std::string_view("retired", 7), std::string_view("retire", 6) },
+{ std::string_view("returned", 8), std::string_view("return", 6) },
+{ std::string_view("returning", 9), std::string_view("return", 6) },
+{ std::string_view("returns", 7), std::string_view("return", 6) },
+{ std::string_view("reubenite", 9), std::string_view("reuben", 6) },
+{ std::string_view("reubenites", 10), std::string_view("reubenite", 9) },
+{ std::string_view("revealed", 8), std::string_view("reveal", 6) },
+{ std::string_view("reveals", 7), std::string_view("reveal", 6) },
+{ std::string_view("revelations", 11), std::string_view("revelation", 10) },
+{ std::string_view("reveling", 8), std::string_view("revel", 5) },
+{ std::string_view("revenged", 8), std::string_view("revenge", 7) },
+{ std::string_view("revengers", 9), std::string_view("revenger", 8) },
+{ std::string_view("revenges", 8), std::string_view("revenge", 7) },
+{ std::string_view("revenging", 9), std::string_view("revenge", 7) },
+{ std::string_view("revenues", 8), std::string_view("revenue", 7) },
+{ std::string_view("reverenced", 10), std::string_view("reverence", 9) },
+{ std::string_view("reviled", 7), std::string_view("revile", 6) },
+{ std::string_view("reviles", 7), std::string_view("revile", 6) },
+{ std::string_view("revilest", 8), std::string_view("revile", 6) },
+{ std::string_view("reviling", 8), std::string_view("revile", 6) },
+{ std::string_view("revilings", 9), std::string_view("reviling", 8) },
+{ std::string_view("revived", 7), std::string_view("revive", 6) },
+{ std::string_view("reviving", 8), std::string_view("revive", 6) },
+{ std::string_view("revolted", 8), std::string_view("revolt", 6) },
+{ std::string_view("revolting", 9), std::string_view("revolt", 6) },
+{ std::string_view("rewarded", 8), std::string_view("reward", 6) },
+{ std::string_view("rewards", 7), std::string_view("reward", 6) },
+{ std::string_view("ribs", 4), std::string_view("rib", 3) },
+{ std::string_view("riches", 6), std::string_view("rich", 4) },
+{ std::string_view("riching", 7), std::string_view("rich", 4) },
+{ std::string_view("riddles", 7), std::string_view("riddle", 6) },
+{ std::string_view("riders", 6), std::string_view("rider", 5) },
+{ std::string_view("rides", 5), std::string_view("rid", 3) },
+{ std::string_view("riding", 6), std::string_view("rid", 3) },
+{ std::string_view("righteousnesses", 15), std::string_view("righteousness", 13) },
+{ std::string_view("rights", 6), std::string_view("right", 5) },
+{ std::string_view("rims", 4), std::string_view("rim", 3) },
+{ std::string_view("rings", 5), std::string_view("ring", 4) },
+{ std::string_view("rioting", 7), std::string_view("riot", 4) },
+{ std::string_view("riots", 5), std::string_view("riot", 4) },
+{ std::string_view("ripening", 8), std::string_view("ripens", 6) },
+{ std::string_view("rises", 5), std::string_view("rise", 4) },
+{ std::string_view("risest", 6), std::string_view("rise", 4) },
+{ std::string_view("rising", 6), std::string_view("rise", 4) },
+{ std::string_view("rivers", 6), std::string_view("river", 5) },
+{ std::string_view("roaming", 7), std::string_view("roams", 5) },
+{ std::string_view("roared", 6), std::string_view("roar", 4) },
+{ std::string_view("roaring", 7), std::string_view("roar", 4) },
+{ std::string_view("roarings", 8), std::string_view("roaring", 7) },
+{ std::string_view("roars", 5), std::string_view("roar", 4) },
+{ std::string_view("roasted", 7), std::string_view("roast", 5) },
+{ std::string_view("roasts", 6), std::string_view("roast", 5) },
+{ std::string_view("robbers", 7), std::string_view("robber", 6) },
+{ std::string_view("robes", 5), std::string_view("rob", 3) },
+{ std::string_view("robs", 4), std::string_view("rob", 3) },
+{ std::string_view("rocks", 5), std::string_view("rock", 4) },
+{ std::string_view("rods", 4), std::string_view("rod", 3) },
+{ std::string_view("roebucks", 8), std::string_view("roebuck", 7) },
+{ std::string_view("roes", 4), std::string_view("roe", 3) },
+{ std::string_view("rolled", 6), std::string_view("roll", 4) },
+{ std::string_view("rolling", 7), std::string_view("roll", 4) },
+{ std::string_view("rolls", 5), std::string_view("roll", 4) },
+{ std::string_view("romans", 6), std::string_view("roman", 5) },
+{ std::string_view("roofs", 5), std::string_view("roof", 4) },
+{ std::string_view("rooms", 5), std::string_view("room", 4) },
+{ std::string_view("rooted", 6), std::string_view("root", 4) },
+{ std::string_view("roots", 5), std::string_view("root", 4) },
+{ std::string_view("ropes", 5), std::string_view("rope", 4) },
+{ std::string_view("rots", 4), std::string_view("rot", 3) },
+{ std::string_view("rounded", 7), std::string_view("round", 5) },
+{ std::string_view("roused", 6), std::string_view("rouse", 5) },
+{ std::string_view("routed", 6), std::string_view("rout", 4) },
+{ std::string_view("rowed", 5), std::string_view("row", 3) },
+{ std::string_view("rowing", 6), std::string_view("row", 3) },
+{ std::string_view("rows", 4), std::string_view("row", 3) },
+{ std::string_view("ruined", 6), std::string_view("ruin", 4) },
+{ std::string_view("ruins", 5), std::string_view("ruin", 4) },
+{ std::string_view("ruled", 5), std::string_view("rule", 4) },
+{ std::string_view("rulers", 6), std::string_view("ruler", 5) },
+{ std::string_view("rules", 5), std::string_view("rule", 4) },
+{ std::string_view("rulest", 6), std::string_view("rule", 4) },
+{ std::string_view("ruling", 6), std::string_view("rule", 4) },
+{ std::string_view("rumors", 6), std::string_view("rumor", 5) },
+{ std::string_view("rumours", 7), std::string_view("rumour", 6) },
+{ std::string_view("runs", 4), std::string_view("run", 3) },
+{ std::string_view("rushed", 6), std::string_view("rush", 4) },
+{ std::string_view("rushes", 6), std::string_view("rush", 4) },
+{ std::string_view("rushing", 7), std::string_view("rush", 4) },
+{ std::string_view("sabbaths", 8), std::string_view("sabbath", 7) },
+{ std::string_view("sackclothes", 11), std::string_view("sackcloth", 9) },
+{ std::string_view("sacks", 5), std::string_view("sack", 4) },
+{ std::string_view("sacrificed", 10), std::string_view("sacrifice", 9) },
+{ std::string_view("sacrifices", 10), std::string_view("sacrifice", 9) },
+{ std::string_view("sacrificing", 11), std::string_view("sacrifice", 9) },
+{ std::string_view("saddled", 7), std::string_view("saddle", 6) },
+{ std::string_view("sailed", 6), std::string_view("sail", 4) },
+{ std::string_view("sailing", 7), std::string_view("sail", 4) },
+{ std::string_view("sails", 5), std::string_view("sail", 4) },
+{ std::string_view("saints", 6), std::string_view("saint", 5) },
+{ std::string_view("sakes", 5), std::string_view("sake", 4) },
+{ std::string_view("salted", 6), std::string_view("salt", 4) },
+{ std::string_view("salutations", 11), std::string_view("salutation", 10) },
+{ std::string_view("saluted", 7), std::string_view("salute", 6) },
+{ std::string_view("salutes", 7), std::string_view("salute", 6) },
+{ std::string_view("samaritans", 10), std::string_view("samaritan", 9) },
+{ std::string_view("sandals", 7), std::string_view("sandal", 6) },
+{ std::string_view("sapphires", 9), std::string_view("sapphire", 8) },
+{ std::string_view("sashes", 6), std::string_view("sash", 4) },
+{ std::string_view("sated", 5), std::string_view("sat", 3) },
+{ std::string_view("satest", 6), std::string_view("sata", 4) },
+{ std::string_view("satiated", 8), std::string_view("satiate", 7) },
+{ std::string_view("sating", 6), std::string_view("sat", 3) },
+{ std::string_view("satisfying", 10), std::string_view("satisfy", 7) },
+{ std::string_view("satyrs", 6), std::string_view("satyr", 5) },
+{ std::string_view("saved", 5), std::string_view("save", 4) },
+{ std::string_view("saves", 5), std::string_view("save", 4) },
+{ std::string_view("savest", 6), std::string_view("save", 4) },
+{ std::string_view("saving", 6), std::string_view("save", 4) },
+{ std::string_view("saviors", 7), std::string_view("savior", 6) },
+{ std::string_view("saviours", 8), std::string_view("saviour", 7) },
+{ std::string_view("savourest", 9), std::string_view("savours", 7) },
+{ std::string_view("savouring", 9), std::string_view("savour", 6) },
+{ std::string_view("savours", 7), std::string_view("savour", 6) },
+{ std::string_view("sawed", 5), std::string_view("saw", 3) },
+{ std::string_view("sawest", 6), std::string_view("sawn", 4) },
+{ std::string_view("sawing", 6), std::string_view("saw", 3) },
+{ std::string_view("saws", 4), std::string_view("saw", 3) },
+{ std::string_view("sayest", 6), std::string_view("says", 4) },
+{ std::string_view("saying", 6), std::string_view("say", 3) },
+{ std::string_view("sayings", 7), std::string_view("saying", 6) },
+{ std::string_view("says", 4), std::string_view("say", 3) },
+{ std::string_view("scared", 6), std::string_view("scar", 4) },
+{ std::string_view("scaring", 7), std::string_view("scar", 4) },
+{ std::string_view("scattered", 9), std::string_view("scatter", 7) },
+{ std::string_view("scattering", 10), std::string_view("scatter", 7) },
+{ std::string_view("scatters", 8), std::string_view("scatter", 7) },
+{ std::string_view("scepters", 8), std::string_view("scepter", 7) },
+{ std::string_view("sceptres", 8), std::string_view("sceptre", 7) },
+{ std::string_view("schemes", 7), std::string_view("scheme", 6) },
+{ std::string_view("scoffed", 7), std::string_view("scoff", 5) },
+{ std::string_view("scoffers", 8), std::string_view("scoffer", 7) },
+{ std::string_view("scoffing", 8), std::string_view("scoff", 5) },
+{ std::string_view("scoffs", 6), std::string_view("scoff", 5) },
+{ std::string_view("scorched", 8), std::string_view("scorch", 6) },
+{ std::string_view("scorching", 9), std::string_view("scorch", 6) },
+{ std::string_view("scorned", 7), std::string_view("scorn", 5) },
+{ std::string_view("scorners", 8), std::string_view("scorner", 7) },
+{ std::string_view("scornest", 8), std::string_view("scorns", 6) },
+{ std::string_view("scorning", 8), std::string_view("scorn", 5) },
+{ std::string_view("scorns", 6), std::string_view("scorn", 5) },
+{ std::string_view("scorpions", 9), std::string_view("scorpion", 8) },
+{ std::string_view("scourged", 8), std::string_view("scourge", 7) },
+{ std::string_view("scourges", 8), std::string_view("scourge", 7) },
+{ std::string_view("scourging", 9), std::string_view("scourge", 7) },
+{ std::string_view("scourgings", 10), std::string_view("scourging", 9) },
+{ std::string_view("scraped", 7), std::string_view("scrape", 6) },
+{ std::string_view("screened", 8), std::string_view("screen", 6) },
+{ std::string_view("scribes", 7), std::string_view("scribe", 6) },
+{ std::string_view("scriptures", 10), std::string_view("scripture", 9) },
+{ std::string_view("sealed", 6), std::string_view("seal", 4) },
+{ std::string_view("sealest", 7), std::string_view("seals", 5) },
+{ std::string_view("sealing", 7), std::string_view("seal", 4) },
+{ std::string_view("seals", 5), std::string_view("seal", 4) },
+{ std::string_view("seams", 5), std::string_view("seam", 4) },
+{ std::string_view("searched", 8), std::string_view("search", 6) },
+{ std::string_view("searches", 8), std::string_view("search", 6) },
+{ std::string_view("searching", 9), std::string_view("search", 6) },
+{ std::string_view("searchings", 10), std::string_view("searching", 9) },
+{ std::string_view("seas", 4), std::string_view("sea", 3) },
+{ std::string_view("seasoned", 8), std::string_view("season", 6) },
+{ std::string_view("seasons", 7), std::string_view("season", 6) },
+{ std::string_view("seated", 6), std::string_view("seat", 4) },
+{ std::string_view("seats", 5), std::string_view("seat", 4) },
+{ std::string_view("secrets", 7), std::string_view("secret", 6) },
+{ std::string_view("secured", 7), std::string_view("secure", 6) },
+{ std::string_view("seditions", 9), std::string_view("sedition", 8) },
+{ std::string_view("seduced", 7), std::string_view("seduce", 6) },
+{ std::string_view("seduces", 7), std::string_view("seduce", 6) },
+{ std::string_view("seducing", 8), std::string_view("seduce", 6) },
+{ std::string_view("seed", 4), std::string_view("see", 3) },
+{ std::string_view("seeds", 5), std::string_view("seed", 4) },
+{ std::string_view("seeing", 6), std::string_view("see", 3) },
+{ std::string_view("seekest", 7), std::string_view("seeks", 5) },
+{ std::string_view("seeking", 7), std::string_view("seek", 4) },
+{ std::string_view("seeks", 5), std::string_view("seek", 4) },
+{ std::string_view("seemed", 6), std::string_view("seem", 4) },
+{ std::string_view("seems", 5), std::string_view("seem", 4) },
+{ std::string_view("seers", 5), std::string_view("seer", 4) },
+{ std::string_view("sees", 4), std::string_view("see", 3) },
+{ std::string_view("seest", 5), std::string_view("sea", 3) },
+{ std::string_view("seething", 8), std::string_view("seeth", 5) },
+{ std::string_view("seized", 6), std::string_view("seize", 5) },
+{ std::string_view("seizes", 6), std::string_view("seize", 5) },
+{ std::string_view("selfwilled", 10), std::string_view("selfwill", 8) },
+{ std::string_view("sellers", 7), std::string_view("seller", 6) },
+{ std::string_view("sellest", 7), std::string_view("sells", 5) },
+{ std::string_view("selling", 7), std::string_view("sell", 4) },
+{ std::string_view("sells", 5), std::string_view("sell", 4) },
+{ std::string_view("sendest", 7), std::string_view("sends", 5) },
+{ std::string_view("sending", 7), std::string_view("send", 4) },
+{ std::string_view("sends", 5), std::string_view("send", 4) },
+{ std::string_view("senses", 6), std::string_view("sense", 5) },
+{ std::string_view("sentenced", 9), std::string_view("sentence", 8) },
+{ std::string_view("sentences", 9), std::string_view("sentence", 8) },
+{ std::string_view("senting", 7), std::string_view("sent", 4) },
+{ std::string_view("separated", 9), std::string_view("separate", 8) },
+{ std::string_view("separates", 9), std::string_view("separate", 8) },
+{ std::string_view("separating", 10), std::string_view("separate", 8) },
+{ std::string_view("sepulchres", 10), std::string_view("sepulchre", 9) },
+{ std::string_view("seraphims", 9), std::string_view("seraphim", 8) },
+{ std::string_view("serpents", 8), std::string_view("serpent", 7) },
+{ std::string_view("servants", 8), std::string_view("servant", 7) },
+{ std::string_view("served", 6), std::string_view("serve", 5) },
+{ std::string_view("serves", 6), std::string_view("serve", 5) },
+{ std::string_view("servest", 7), std::string_view("serve", 5) },
+{ std::string_view("services", 8), std::string_view("service", 7) },
+{ std::string_view("serving", 7), std::string_view("serve", 5) },
+{ std::string_view("sets", 4), std::string_view("set", 3) },
+{ std::string_view("settings", 8), std::string_view("setting", 7) },
+{ std::string_view("settled", 7), std::string_view("settle", 6) },
+{ std::string_view("settles", 7), std::string_view("settle", 6) },
+{ std::string_view("settlest", 8), std::string_view("settle", 6) },
+{ std::string_view("sevens", 6), std::string_view("seven", 5) },
+{ std::string_view("severed", 7), std::string_view("sever", 5) },
+{ std::string_view("sewed", 5), std::string_view("sew", 3) },
+{ std::string_view("sewest", 6), std::string_view("sews", 4) },
+{ std::string_view("sewing", 6), std::string_view("sew", 3) },
+{ std::string_view("sews", 4), std::string_view("sew", 3) },
+{ std::string_view("shadowing", 9), std::string_view("shadow", 6) },
+{ std::string_view("shadows", 7), std::string_view("shadow", 6) },
+{ std::string_view("shafts", 6), std::string_view("shaft", 5) },
+{ std::string_view("shaked", 6), std::string_view("shake", 5) },
+{ std::string_view("shakes", 6), std::string_view("shake", 5) },
+{ std::string_view("shaking", 7), std::string_view("shake", 5) },
+{ std::string_view("shamed", 6), std::string_view("shame", 5) },
+{ std::string_view("shames", 6), std::string_view("shame", 5) },
+{ std::string_view("shapes", 6), std::string_view("shape", 5) },
+{ std::string_view("shared", 6), std::string_view("share", 5) },
+{ std::string_view("shares", 6), std::string_view("share", 5) },
+{ std::string_view("sharing", 7), std::string_view("share", 5) },
+{ std::string_view("sharonite", 9), std::string_view("sharon", 6) },
+{ std::string_view("sharpened", 9), std::string_view("sharpen", 7) },
+{ std::string_view("sharpens", 8), std::string_view("sharpen", 7) },
+{ std::string_view("shaved", 6), std::string_view("shave", 5) },
+{ std::string_view("shearers", 8), std::string_view("shearer", 7) },
+{ std::string_view("shearing", 8), std::string_view("shear", 5) },
+{ std::string_view("sheathed", 8), std::string_view("sheath", 6) },
+{ std::string_view("shed", 4), std::string_view("she", 3) },
+{ std::string_view("sheds", 5), std::string_view("shed", 4) },
+{ std::string_view("sheepcotes", 10), std::string_view("sheepcote", 9) },
+{ std::string_view("sheepfolds", 10), std::string_view("sheepfold", 9) },
+{ std::string_view("sheets", 6), std::string_view("sheet", 5) },
+{ std::string_view("shekels", 7), std::string_view("shekel", 6) },
+{ std::string_view("shelters", 8), std::string_view("shelter", 7) },
+{ std::string_view("shemed", 6), std::string_view("shem", 4) },
+{ std::string_view("shemite", 7), std::string_view("shem", 4) },
+{ std::string_view("shepherd", 8), std::string_view("shepher", 7) },
+{ std::string_view("shepherds", 9), std::string_view("shepherd", 8) },
+{ std::string_view("sherds", 6), std::string_view("sherd", 5) },
+{ std::string_view("shewed", 6), std::string_view("shew", 4) },
+{ std::string_view("shewing", 7), std::string_view("shew", 4) },
+{ std::string_view("shields", 7), std::string_view("shield", 6) },
+{ std::string_view("shilonites", 10), std::string_view("shilonite", 9) },
+{ std::string_view("shined", 6), std::string_view("shine", 5) },
+{ std::string_view("shines", 6), std::string_view("shine", 5) },
+{ std::string_view("shining", 7), std::string_view("shine", 5) },
+{ std::string_view("ships", 5), std::string_view("ship", 4) },
+{ std::string_view("shocks", 6), std::string_view("shock", 5) },
+{ std::string_view("shoes", 5), std::string_view("shoe", 4) },
+{ std::string_view("shooting", 8), std::string_view("shoot", 5) },
+{ std::string_view("shoots", 6), std::string_view("shoot", 5) },
+{ std::string_view("shores", 6), std::string_view("shore", 5) },
+{ std::string_view("shoulders", 9), std::string_view("shoulder", 8) },
+{ std::string_view("shouldest", 9), std::string_view("shouldn", 7) },
+{ std::string_view("shoulding", 9), std::string_view("should", 6) },
+{ std::string_view("shouted", 7), std::string_view("shout", 5) },
+{ std::string_view("shouting", 8), std::string_view("shout", 5) },
+{ std::string_view("shoutings", 9), std::string_view("shouting", 8) },
+{ std::string_view("shouts", 6), std::string_view("shout", 5) },
+{ std::string_view("shovels", 7), std::string_view("shovel", 6) },
+{ std::string_view("showed", 6), std::string_view("show", 4) },
+{ std::string_view("showers", 7), std::string_view("shower", 6) },
+{ std::string_view("showing", 7), std::string_view("show", 4) },
+{ std::string_view("shows", 5), std::string_view("show", 4) },
+{ std::string_view("shrines", 7), std::string_view("shrine", 6) },
+{ std::string_view("shrinks", 7), std::string_view("shrink", 6) },
+{ std::string_view("shuns", 5), std::string_view("shun", 4) },
+{ std::string_view("shuts", 5), std::string_view("shut", 4) },
+{ std::string_view("sicknesses", 10), std::string_view("sickness", 8) },
+{ std::string_view("sided", 5), std::string_view("side", 4) },
+{ std::string_view("sides", 5), std::string_view("side", 4) },
+{ std::string_view("sifted", 6), std::string_view("sift", 4) },
+{ std::string_view("sighed", 6), std::string_view("sigh", 4) },
+{ std::string_view("sighest", 7), std::string_view("sighs", 5) },
+{ std::string_view("sighing", 7), std::string_view("sigh", 4) },
+{ std::string_view("sighs", 5), std::string_view("sigh", 4) },
+{ std::string_view("sights", 6), std::string_view("sight", 5) },
+{ std::string_view("signals", 7), std::string_view("signal", 6) },
+{ std::string_view("signed", 6), std::string_view("sign", 4) },
+{ std::string_view("signets", 7), std::string_view("signet", 6) },
+{ std::string_view("signifying", 10), std::string_view("signify", 7) },
+{ std::string_view("signs", 5), std::string_view("sign", 4) },
+{ std::string_view("silenced", 8), std::string_view("silence", 7) },
+{ std::string_view("similitudes", 11), std::string_view("similitude", 10) },
+{ std::string_view("sinews", 6), std::string_view("sinew", 5) },
+{ std::string_view("sing", 4), std::string_view("s", 1) },
+{ std::string_view("singed", 6), std::string_view("sing", 4) },
+{ std::string_view("singers", 7), std::string_view("singer", 6) },
+{ std::string_view("singing", 7), std::string_view("sing", 4) },
+{ std::string_view("sings", 5), std::string_view("sing", 4) },
+{ std::string_view("sinite", 6), std::string_view("sin", 3) },
+{ std::string_view("sinks", 5), std::string_view("sink", 4) },
+{ std::string_view("sinners", 7), std::string_view("sinner", 6) },
+{ std::string_view("sins", 4), std::string_view("sin", 3) },
+{ std::string_view("sirs", 4), std::string_view("sir", 3) },
+{ std::string_view("sisters", 7), std::string_view("sister", 6) },
+{ std::string_view("sits", 4), std::string_view("sit", 3) },
+{ std::string_view("situated", 8), std::string_view("situate", 7) },
+{ std::string_view("skilled", 7), std::string_view("skill", 5) },
+{ std::string_view("skins", 5), std::string_view("skin", 4) },
+{ std::string_view("skirts", 6), std::string_view("skirt", 5) },
+{ std::string_view("slacked", 7), std::string_view("slack", 5) },
+{ std::string_view("slandered", 9), std::string_view("slander", 7) },
+{ std::string_view("slanderers", 10), std::string_view("slanderer", 9) },
+{ std::string_view("slanderest", 10), std::string_view("slanders", 8) },
+{ std::string_view("slandering", 10), std::string_view("slander", 7) },
+{ std::string_view("slanders", 8), std::string_view("slander", 7) },
+{ std::string_view("slaughtered", 11), std::string_view("slaughter", 9) },
+{ std::string_view("slaves", 6), std::string_view("slave", 5) },
+{ std::string_view("slaying", 7), std::string_view("slay", 4) },
+{ std::string_view("slays", 5), std::string_view("slay", 4) },
+{ std::string_view("sleepest", 8), std::string_view("sleeps", 6) },
+{ std::string_view("sleeping", 8), std::string_view("sleep", 5) },
+{ std::string_view("sleeps", 6), std::string_view("sleep", 5) },
+{ std::string_view("slewing", 7), std::string_view("slew", 4) },
+{ std::string_view("slinging", 8), std::string_view("sling", 5) },
+{ std::string_view("slings", 6), std::string_view("sling", 5) },
+{ std::string_view("slips", 5), std::string_view("slip", 4) },
+{ std::string_view("slopes", 6), std::string_view("slope", 5) },
+{ std::string_view("slumbered", 9), std::string_view("slumber", 7) },
+{ std::string_view("slumbering", 10), std::string_view("slumber", 7) },
+{ std::string_view("slumberings", 11), std::string_view("slumbering", 10) },
+{ std::string_view("smalling", 8), std::string_view("small", 5) },
+{ std::string_view("smelled", 7), std::string_view("smell", 5) },
+{ std::string_view("smelling", 8), std::string_view("smell", 5) },
+{ std::string_view("smells", 6), std::string_view("smell", 5) },
+{ std::string_view("smiled", 6), std::string_view("smile", 5) },
+{ std::string_view("smitest", 7), std::string_view("smite", 5) },
+{ std::string_view("smiths", 6), std::string_view("smith", 5) },
+{ std::string_view("smiting", 7), std::string_view("smite", 5) },
+{ std::string_view("smoked", 6), std::string_view("smoke", 5) },
+{ std::string_view("smoking", 7), std::string_view("smoke", 5) },
+{ std::string_view("smoothes", 8), std::string_view("smooth", 6) },
+{ std::string_view("smotest", 7), std::string_view("smote", 5) },
+{ std::string_view("snared", 6), std::string_view("snare", 5) },
+{ std::string_view("snares", 6), std::string_view("snare", 5) },
+{ std::string_view("snatched", 8), std::string_view("snatch", 6) },
+{ std::string_view("snatches", 8), std::string_view("snatch", 6) },
+{ std::string_view("snatching", 9), std::string_view("snatch", 6) },
+{ std::string_view("snorting", 8), std::string_view("snorts", 6) },
+{ std::string_view("snowed", 6), std::string_view("snow", 4) },
+{ std::string_view("snuffed", 7), std::string_view("snuff", 5) },
+{ std::string_view("snuffs", 6), std::string_view("snuff", 5) },
+{ std::string_view("sockets", 7), std::string_view("socket", 6) },
+{ std::string_view("sod", 3), std::string_view("so", 2) },
+{ std::string_view("sodomite", 8), std::string_view("sodom", 5) },
+{ std::string_view("sodomites", 9), std::string_view("sodomite", 8) },
+{ std::string_view("sojourned", 9), std::string_view("sojourn", 7) },
+{ std::string_view("sojourners", 10), std::string_view("sojourner", 9) },
+{ std::string_view("sojourning", 10), std::string_view("sojourn", 7) },
+{ std::string_view("sojourns", 8), std::string_view("sojourn", 7) },
+{ std::string_view("soldiers", 8), std::string_view("soldier", 7) },
+{ std::string_view("soles", 5), std::string_view("sole", 4) },
+{ std::string_view("sometimes", 9), std::string_view("sometime", 8) },
+{ std::string_view("songs", 5), std::string_view("song", 4) },
+{ std::string_view("sons", 4), std::string_view("son", 3) },
+{ std::string_view("soothsayers", 11), std::string_view("soothsayer", 10) },
+{ std::string_view("sorcerers", 9), std::string_view("sorcerer", 8) },
+{ std::string_view("sores", 5), std::string_view("sore", 4) },
+{ std::string_view("sorrowed", 8), std::string_view("sorrow", 6) },
+{ std::string_view("sorrowing", 9), std::string_view("sorrow", 6) },
+{ std::string_view("sorrows", 7), std::string_view("sorrow", 6) },
+{ std::string_view("sorts", 5), std::string_view("sort", 4) },
+{ std::string_view("souls", 5), std::string_view("soul", 4) },
+{ std::string_view("sounded", 7), std::string_view("sound", 5) },
+{ std::string_view("sounding", 8), std::string_view("sound", 5) },
+{ std::string_view("soundings", 9), std::string_view("sounding", 8) },
+{ std::string_view("sounds", 6), std::string_view("sound", 5) },
+{ std::string_view("sowed", 5), std::string_view("sow", 3) },
+{ std::string_view("sowest", 6), std::string_view("sown", 4) },
+{ std::string_view("sowing", 6), std::string_view("sow", 3) },
+{ std::string_view("sows", 4), std::string_view("sow", 3) },
+{ std::string_view("spakest", 7), std::string_view("spake", 5) },
+{ std::string_view("spared", 6), std::string_view("spare", 5) },
+{ std::string_view("spares", 6), std::string_view("spare", 5) },
+{ std::string_view("sparing", 7), std::string_view("spare", 5) },
+{ std::string_view("sparks", 6), std::string_view("spark", 5) },
+{ std::string_view("sparrows", 8), std::string_view("sparrow", 7) },
+{ std::string_view("speakest", 8), std::string_view("speaks", 6) },
+{ std::string_view("speaking", 8), std::string_view("speak", 5) },
+{ std::string_view("speakings", 9), std::string_view("speaking", 8) },
+{ std::string_view("speaks", 6), std::string_view("speak", 5) },
+{ std::string_view("spears", 6), std::string_view("spear", 5) },
+{ std::string_view("speeches", 8), std::string_view("speech", 6) },
+{ std::string_view("spendest", 8), std::string_view("spends", 6) },
+{ std::string_view("spending", 8), std::string_view("spend", 5) },
+{ std::string_view("spends", 6), std::string_view("spend", 5) },
+{ std::string_view("spewed", 6), std::string_view("spew", 4) },
+{ std::string_view("spewing", 7), std::string_view("spew", 4) },
+{ std::string_view("spiced", 6), std::string_view("spice", 5) },
+{ std::string_view("spices", 6), std::string_view("spice", 5) },
+{ std::string_view("spirits", 7), std::string_view("spirit", 6) },
+{ std::string_view("splits", 6), std::string_view("split", 5) },
+{ std::string_view("spoiled", 7), std::string_view("spoil", 5) },
+{ std::string_view("spoilers", 8), std::string_view("spoiler", 7) },
+{ std::string_view("spoilest", 8), std::string_view("spoils", 6) },
+{ std::string_view("spoiling", 8), std::string_view("spoil", 5) },
+{ std::string_view("spoils", 6), std::string_view("spoil", 5) },
+{ std::string_view("spokes", 6), std::string_view("spoke", 5) },
+{ std::string_view("spoons", 6), std::string_view("spoon", 5) },
+{ std::string_view("sporting", 8), std::string_view("sport", 5) },
+{ std::string_view("spots", 5), std::string_view("spot", 4) },
+{ std::string_view("spouses", 7), std::string_view("spouse", 6) },
+{ std::string_view("spreadest", 9), std::string_view("spreads", 7) },
+{ std::string_view("spreading", 9), std::string_view("spread", 6) },
+{ std::string_view("spreadings", 10), std::string_view("spreading", 9) },
+{ std::string_view("spreads", 7), std::string_view("spread", 6) },
+{ std::string_view("springing", 9), std::string_view("spring", 6) },
+{ std::string_view("springs", 7), std::string_view("spring", 6) },
+{ std::string_view("sprinkled", 9), std::string_view("sprinkle", 8) },
+{ std::string_view("sprinkles", 9), std::string_view("sprinkle", 8) },
+{ std::string_view("sprinkling", 10), std::string_view("sprinkle", 8) },
+{ std::string_view("sprouts", 7), std::string_view("sprout", 6) },
+{ std::string_view("spued", 5), std::string_view("spue", 4) },
+{ std::string_view("spying", 6), std::string_view("spy", 3) },
+{ std::string_view("squared", 7), std::string_view("square", 6) },
+{ std::string_view("squares", 7), std::string_view("square", 6) },
+{ std::string_view("stablished", 10), std::string_view("stablish", 8) },
+{ std::string_view("staffs", 6), std::string_view("staff", 5) },
+{ std::string_view("staggered", 9), std::string_view("stagger", 7) },
+{ std::string_view("staggering", 10), std::string_view("stagger", 7) },
+{ std::string_view("staggers", 8), std::string_view("stagger", 7) },
+{ std::string_view("stained", 7), std::string_view("stain", 5) },
+{ std::string_view("stalks", 6), std::string_view("stalk", 5) },
+{ std::string_view("stalled", 7), std::string_view("stall", 5) },
+{ std::string_view("stalls", 6), std::string_view("stall", 5) },
+{ std::string_view("stamped", 7), std::string_view("stamp", 5) },
+{ std::string_view("stamping", 8), std::string_view("stamp", 5) },
+{ std::string_view("standards", 9), std::string_view("standard", 8) },
+{ std::string_view("standest", 8), std::string_view("stands", 6) },
+{ std::string_view("standing", 8), std::string_view("stand", 5) },
+{ std::string_view("stands", 6), std::string_view("stand", 5) },
+{ std::string_view("stars", 5), std::string_view("star", 4) },
+{ std::string_view("starting", 8), std::string_view("start", 5) },
+{ std::string_view("statutes", 8), std::string_view("statute", 7) },
+{ std::string_view("stayed", 6), std::string_view("stay", 4) },
+{ std::string_view("staying", 7), std::string_view("stay", 4) },
+{ std::string_view("stays", 5), std::string_view("stay", 4) },
+{ std::string_view("steads", 6), std::string_view("stead", 5) },
+{ std::string_view("stealing", 8), std::string_view("steal", 5) },
+{ std::string_view("steals", 6), std::string_view("steal", 5) },
+{ std::string_view("steeds", 6), std::string_view("steed", 5) },
+{ std::string_view("steps", 5), std::string_view("step", 4) },
+{ std::string_view("stewards", 8), std::string_view("steward", 7) },
+{ std::string_view("sticks", 6), std::string_view("stick", 5) },
+{ std::string_view("stilled", 7), std::string_view("still", 5) },
+{ std::string_view("stillest", 8), std::string_view("stills", 6) },
+{ std::string_view("stilling", 8), std::string_view("still", 5) },
+{ std::string_view("stills", 6), std::string_view("still", 5) },
+{ std::string_view("stings", 6), std::string_view("sting", 5) },
+{ std::string_view("stinking", 8), std::string_view("stink", 5) },
+{ std::string_view("stirs", 5), std::string_view("stir", 4) },
+{ std::string_view("stocks", 6), std::string_view("stock", 5) },
+{ std::string_view("stoned", 6), std::string_view("stone", 5) },
+{ std::string_view("stones", 6), std::string_view("stone", 5) },
+{ std::string_view("stonest", 7), std::string_view("stone", 5) },
+{ std::string_view("stoning", 7), std::string_view("stone", 5) },
+{ std::string_view("stooding", 8), std::string_view("stood", 5) },
+{ std::string_view("stools", 6), std::string_view("stool", 5) },
+{ std::string_view("stooped", 7), std::string_view("stoop", 5) },
+{ std::string_view("stooping", 8), std::string_view("stoop", 5) },
+{ std::string_view("stoops", 6), std::string_view("stoop", 5) },
+{ std::string_view("stops", 5), std::string_view("stop", 4) },
+{ std::string_view("stored", 6), std::string_view("store", 5) },
+{ std::string_view("storehouses", 11), std::string_view("storehouse", 10) },
+{ std::string_view("stores", 6), std::string_view("store", 5) },
+{ std::string_view("strained", 8), std::string_view("strain", 6) },
+{ std::string_view("straitened", 10), std::string_view("straiten", 8) },
+{ std::string_view("straitest", 9), std::string_view("straits", 7) },
+{ std::string_view("straiting", 9), std::string_view("strait", 6) },
+{ std::string_view("straits", 7), std::string_view("strait", 6) },
+{ std::string_view("strakes", 7), std::string_view("strake", 6) },
+{ std::string_view("strangers", 9), std::string_view("stranger", 8) },
+{ std::string_view("strawed", 7), std::string_view("straw", 5) },
+{ std::string_view("streams", 7), std::string_view("stream", 6) },
+{ std::string_view("streets", 7), std::string_view("street", 6) },
+{ std::string_view("strengthened", 12), std::string_view("strengthen", 10) },
+{ std::string_view("strengthening", 13), std::string_view("strengthen", 10) },
+{ std::string_view("strengthens", 11), std::string_view("strengthen", 10) },
+{ std::string_view("stretched", 9), std::string_view("stretch", 7) },
+{ std::string_view("stretches", 9), std::string_view("stretch", 7) },
+{ std::string_view("stretching", 10), std::string_view("stretch", 7) },
+{ std::string_view("stricting", 9), std::string_view("strict", 6) },
+{ std::string_view("strifes", 7), std::string_view("strife", 6) },
+{ std::string_view("strikers", 8), std::string_view("striker", 7) },
+{ std::string_view("strikes", 7), std::string_view("strike", 6) },
+{ std::string_view("striking", 8), std::string_view("strike", 6) },
+{ std::string_view("stringed", 8), std::string_view("string", 6) },
+{ std::string_view("strings", 7), std::string_view("string", 6) },
+{ std::string_view("striped", 7), std::string_view("strip", 5) },
+{ std::string_view("stripes", 7), std::string_view("strip", 5) },
+{ std::string_view("strips", 6), std::string_view("strip", 5) },
+{ std::string_view("strived", 7), std::string_view("strive", 6) },
+{ std::string_view("strives", 7), std::string_view("strive", 6) },
+{ std::string_view("striving", 8), std::string_view("strive", 6) },
+{ std::string_view("strivings", 9), std::string_view("striving", 8) },
+{ std::string_view("strokes", 7), std::string_view("stroke", 6) },
+{ std::string_view("strongholds", 11), std::string_view("stronghold", 10) },
+{ std::string_view("stronging", 9), std::string_view("strong", 6) },
+{ std::string_view("struggled", 9), std::string_view("struggle", 8) },
+{ std::string_view("struggles", 9), std::string_view("struggle", 8) },
+{ std::string_view("studs", 5), std::string_view("stud", 4) },
+{ std::string_view("stumbled", 8), std::string_view("stumble", 7) },
+{ std::string_view("stumbles", 8), std::string_view("stumble", 7) },
+{ std::string_view("stumbling", 9), std::string_view("stumble", 7) },
+{ std::string_view("stumblingblocks", 15), std::string_view("stumblingblock", 14) },
+{ std::string_view("stumblings", 10), std::string_view("stumbling", 9) },
+{ std::string_view("subdued", 7), std::string_view("subdue", 6) },
+{ std::string_view("subdues", 7), std::string_view("subdue", 6) },
+{ std::string_view("subjected", 9), std::string_view("subject", 7) },
+{ std::string_view("subjecting", 10), std::string_view("subject", 7) },
+{ std::string_view("subscribed", 10), std::string_view("subscribe", 9) },
+{ std::string_view("subverted", 9), std::string_view("subvert", 7) },
+{ std::string_view("subverting", 10), std::string_view("subvert", 7) },
+{ std::string_view("subverts", 8), std::string_view("subvert", 7) },
+{ std::string_view("succeeded", 9), std::string_view("succeed", 7) },
+{ std::string_view("succeeding", 10), std::string_view("succeed", 7) },
+{ std::string_view("succoured", 9), std::string_view("succour", 7) },
+{ std::string_view("sucked", 6), std::string_view("suck", 4) },
+{ std::string_view("sucking", 7), std::string_view("suck", 4) },
+{ std::string_view("sucklings", 9), std::string_view("suckling", 8) },
+{ std::string_view("sues", 4), std::string_view("sue", 3) },
+{ std::string_view("suffered", 8), std::string_view("suffer", 6) },
+{ std::string_view("sufferest", 9), std::string_view("suffers", 7) },
+{ std::string_view("suffering", 9), std::string_view("suffer", 6) },
+{ std::string_view("sufferings", 10), std::string_view("suffering", 9) },
+{ std::string_view("suffers", 7), std::string_view("suffer", 6) },
+{ std::string_view("sufficed", 8), std::string_view("suffice", 7) },
+{ std::string_view("suits", 5), std::string_view("suit", 4) },
+{ std::string_view("sukkiims", 8), std::string_view("sukkiim", 7) },
+{ std::string_view("summoned", 8), std::string_view("summon", 6) },
+{ std::string_view("summons", 7), std::string_view("summon", 6) },
+{ std::string_view("sundered", 8), std::string_view("sunder", 6) },
+{ std::string_view("sunrising", 9), std::string_view("sunrise", 7) },
+{ std::string_view("supplanted", 10), std::string_view("supplant", 8) },
+{ std::string_view("supplications", 13), std::string_view("supplication", 12) },
+{ std::string_view("supported", 9), std::string_view("support", 7) },
+{ std::string_view("supports", 8), std::string_view("support", 7) },
+{ std::string_view("supposed", 8), std::string_view("suppose", 7) },
+{ std::string_view("supposing", 9), std::string_view("suppose", 7) },
+{ std::string_view("surnamed", 8), std::string_view("surname", 7) },
+{ std::string_view("surrounded", 10), std::string_view("surround", 8) },
+{ std::string_view("surrounding", 11), std::string_view("surround", 8) },
+{ std::string_view("surrounds", 9), std::string_view("surround", 8) },
+{ std::string_view("sustained", 9), std::string_view("sustain", 7) },
+{ std::string_view("sustains", 8), std::string_view("sustain", 7) },
+{ std::string_view("swallowed", 9), std::string_view("swallow", 7) },
+{ std::string_view("swallows", 8), std::string_view("swallow", 7) },
+{ std::string_view("swarest", 7), std::string_view("sware", 5) },
+{ std::string_view("swarmed", 7), std::string_view("swarm", 5) },
+{ std::string_view("swarming", 8), std::string_view("swarm", 5) },
+{ std::string_view("swarms", 6), std::string_view("swarm", 5) },
+{ std::string_view("sways", 5), std::string_view("sway", 4) },
+{ std::string_view("swearing", 8), std::string_view("swear", 5) },
+{ std::string_view("swears", 6), std::string_view("swear", 5) },
+{ std::string_view("sweeping", 8), std::string_view("sweep", 5) },
+{ std::string_view("sweeps", 6), std::string_view("sweep", 5) },
+{ std::string_view("swelled", 7), std::string_view("swell", 5) },
+{ std::string_view("swelling", 8), std::string_view("swell", 5) },
+{ std::string_view("swellings", 9), std::string_view("swelling", 8) },
+{ std::string_view("swells", 6), std::string_view("swell", 5) },
+{ std::string_view("swerved", 7), std::string_view("swerve", 6) },
+{ std::string_view("swims", 5), std::string_view("swim", 4) },
+{ std::string_view("swooned", 7), std::string_view("swoon", 5) },
+{ std::string_view("swords", 6), std::string_view("sword", 5) },
+{ std::string_view("sycamores", 9), std::string_view("sycamore", 8) },
+{ std::string_view("sycomores", 9), std::string_view("sycomore", 8) },
+{ std::string_view("symbols", 7), std::string_view("symbol", 6) },
+{ std::string_view("synagogues", 10), std::string_view("synagogue", 9) },
+{ std::string_view("syrians", 7), std::string_view("syrian", 6) },
+{ std::string_view("tabernacles", 11), std::string_view("tabernacle", 10) },
+{ std::string_view("tables", 6), std::string_view("table", 5) },
+{ std::string_view("tablets", 7), std::string_view("tablet", 6) },
+{ std::string_view("tabrets", 7), std::string_view("tabret", 6) },
+{ std::string_view("tackling", 8), std::string_view("tackle", 6) },
+{ std::string_view("tacklings", 9), std::string_view("tackling", 8) },
+{ std::string_view("tails", 5), std::string_view("tail", 4) },
+{ std::string_view("takes", 5), std::string_view("take", 4) },
+{ std::string_view("takest", 6), std::string_view("take", 4) },
+{ std::string_view("taking", 6), std::string_view("take", 4) },
+{ std::string_view("talents", 7), std::string_view("talent", 6) },
+{ std::string_view("tales", 5), std::string_view("tale", 4) },
+{ std::string_view("talked", 6), std::string_view("talk", 4) },
+{ std::string_view("talkest", 7), std::string_view("talks", 5) },
+{ std::string_view("talking", 7), std::string_view("talk", 4) },
+{ std::string_view("talks", 5), std::string_view("talk", 4) },
+{ std::string_view("tambourines", 11), std::string_view("tambourine", 10) },
+{ std::string_view("tamed", 5), std::string_view("tame", 4) },
+{ std::string_view("tares", 5), std::string_view("tar", 3) },
+{ std::string_view("targets", 7), std::string_view("target", 6) },
+{ std::string_view("tarrying", 8), std::string_view("tarry", 5) },
+{ std::string_view("taskmasters", 11), std::string_view("taskmaster", 10) },
+{ std::string_view("tasks", 5), std::string_view("task", 4) },
+{ std::string_view("tasted", 6), std::string_view("taste", 5) },
+{ std::string_view("tastes", 6), std::string_view("taste", 5) },
+{ std::string_view("taunting", 8), std::string_view("taunt", 5) },
+{ std::string_view("taunts", 6), std::string_view("taunt", 5) },
+{ std::string_view("taxed", 5), std::string_view("tax", 3) },
+{ std::string_view("taxes", 5), std::string_view("tax", 3) },
+{ std::string_view("taxing", 6), std::string_view("tax", 3) },
+{ std::string_view("teachers", 8), std::string_view("teacher", 7) },
+{ std::string_view("teaches", 7), std::string_view("teach", 5) },
+{ std::string_view("teaching", 8), std::string_view("teach", 5) },
+{ std::string_view("teachings", 9), std::string_view("teaching", 8) },
+{ std::string_view("tearing", 7), std::string_view("tear", 4) },
+{ std::string_view("tears", 5), std::string_view("tear", 4) },
+{ std::string_view("tekoites", 8), std::string_view("tekoite", 7) },
+{ std::string_view("tellest", 7), std::string_view("tells", 5) },
+{ std::string_view("telling", 7), std::string_view("tell", 4) },
+{ std::string_view("tells", 5), std::string_view("tell", 4) },
+{ std::string_view("temanite", 8), std::string_view("teman", 5) },
+{ std::string_view("temanites", 9), std::string_view("temanite", 8) },
+{ std::string_view("tempered", 8), std::string_view("temper", 6) },
+{ std::string_view("tempest", 7), std::string_view("tempt", 5) },
+{ std::string_view("temples", 7), std::string_view("temple", 6) },
+{ std::string_view("temptations", 11), std::string_view("temptation", 10) },
+{ std::string_view("tempted", 7), std::string_view("tempt", 5) },
+{ std::string_view("tempting", 8), std::string_view("tempt", 5) },
+{ std::string_view("tempts", 6), std::string_view("tempt", 5) },
+{ std::string_view("tend", 4), std::string_view("ten", 3) },
+{ std::string_view("tends", 5), std::string_view("tend", 4) },
+{ std::string_view("tens", 4), std::string_view("ten", 3) },
+{ std::string_view("tents", 5), std::string_view("tent", 4) },
+{ std::string_view("terebinths", 10), std::string_view("terebinth", 9) },
+{ std::string_view("terrors", 7), std::string_view("terror", 6) },
+{ std::string_view("test", 4), std::string_view("to", 2) },
+{ std::string_view("tested", 6), std::string_view("test", 4) },
+{ std::string_view("testifying", 10), std::string_view("testify", 7) },
+{ std::string_view("testing", 7), std::string_view("test", 4) },
+{ std::string_view("tests", 5), std::string_view("test", 4) },
+{ std::string_view("thanked", 7), std::string_view("thank", 5) },
+{ std::string_view("thanking", 8), std::string_view("thank", 5) },
+{ std::string_view("thanks", 6), std::string_view("thank", 5) },
+{ std::string_view("thanksgivings", 13), std::string_view("thanksgiving", 12) },
+{ std::string_view("thefts", 6), std::string_view("theft", 5) },
+{ std::string_view("theirs", 6), std::string_view("their", 5) },
+{ std::string_view("thickets", 8), std::string_view("thicket", 7) },
+{ std::string_view("thighs", 6), std::string_view("thigh", 5) },
+{ std::string_view("thing", 5), std::string_view("the", 3) },
+{ std::string_view("things", 6), std::string_view("thing", 5) },
+{ std::string_view("thinkest", 8), std::string_view("thinks", 6) },
+{ std::string_view("thinking", 8), std::string_view("think", 5) },
+{ std::string_view("thinks", 6), std::string_view("think", 5) },
+{ std::string_view("thirsted", 8), std::string_view("thirst", 6) },
+{ std::string_view("thirsts", 7), std::string_view("thirst", 6) },
+{ std::string_view("thistles", 8), std::string_view("thistle", 7) },
+{ std::string_view("thongs", 6), std::string_view("thong", 5) },
+{ std::string_view("thorns", 6), std::string_view("thorn", 5) },
+{ std::string_view("thoughtest", 10), std::string_view("thoughts", 8) },
+{ std::string_view("thoughting", 10), std::string_view("thought", 7) },
+{ std::string_view("thoughts", 8), std::string_view("thought", 7) },
+{ std::string_view("thousands", 9), std::string_view("thousand", 8) },
+{ std::string_view("threatened", 10), std::string_view("threaten", 8) },
+{ std::string_view("threatening", 11), std::string_view("threaten", 8) },
+{ std::string_view("threatenings", 12), std::string_view("threatening", 11) },
+{ std::string_view("threats", 7), std::string_view("threat", 6) },
+{ std::string_view("threshed", 8), std::string_view("thresh", 6) },
+{ std::string_view("threshes", 8), std::string_view("thresh", 6) },
+{ std::string_view("threshing", 9), std::string_view("thresh", 6) },
+{ std::string_view("threshingfloors", 15), std::string_view("threshingfloor", 14) },
+{ std::string_view("thresholds", 10), std::string_view("threshold", 9) },
+{ std::string_view("threwing", 8), std::string_view("threw", 5) },
+{ std::string_view("thriving", 8), std::string_view("thrive", 6) },
+{ std::string_view("thrones", 7), std::string_view("throne", 6) },
+{ std::string_view("thronged", 8), std::string_view("throng", 6) },
+{ std::string_view("thronging", 9), std::string_view("throng", 6) },
+{ std::string_view("throwing", 8), std::string_view("throw", 5) },
+{ std::string_view("throws", 6), std::string_view("throw", 5) },
+{ std::string_view("thrusts", 7), std::string_view("thrust", 6) },
+{ std::string_view("thumbs", 6), std::string_view("thumb", 5) },
+{ std::string_view("thundered", 9), std::string_view("thunder", 7) },
+{ std::string_view("thunders", 8), std::string_view("thunder", 7) },
+{ std::string_view("tied", 4), std::string_view("tie", 3) },
+{ std::string_view("tiles", 5), std::string_view("tile", 4) },
+{ std::string_view("tiling", 6), std::string_view("tile", 4) },
+{ std::string_view("tilled", 6), std::string_view("till", 4) },
+{ std::string_view("tillest", 7), std::string_view("tills", 5) },
+{ std::string_view("tilling", 7), std::string_view("till", 4) },
+{ std::string_view("tills", 5), std::string_view("till", 4) },
+{ std::string_view("timbrels", 8), std::string_view("timbrel", 7) },
+{ std::string_view("times", 5), std::string_view("time", 4) },
+{ std::string_view("ting", 4), std::string_view("t", 1) },
+{ std::string_view("tired", 5), std::string_view("tire", 4) },
+{ std::string_view("tires", 5), std::string_view("tire", 4) },
+{ std::string_view("tithes", 6), std::string_view("tithe", 5) },
+{ std::string_view("tithing", 7), std::string_view("tithe", 5) },
+{ std::string_view("titles", 6), std::string_view("title", 5) },
+{ std::string_view("toes", 4), std::string_view("to", 2) },
+{ std::string_view("toiled", 6), std::string_view("toil", 4) },
+{ std::string_view("toiling", 7), std::string_view("toil", 4) },
+{ std::string_view("tokens", 6), std::string_view("token", 5) },
+{ std::string_view("tolad", 5), std::string_view("tola", 4) },
+{ std::string_view("tombs", 5), std::string_view("tomb", 4) },
+{ std::string_view("tongued", 7), std::string_view("tongue", 6) },
+{ std::string_view("tongues", 7), std::string_view("tongue", 6) },
+{ std::string_view("tooking", 7), std::string_view("took", 4) },
+{ std::string_view("tops", 4), std::string_view("top", 3) },
+{ std::string_view("torches", 7), std::string_view("torch", 5) },
+{ std::string_view("tormented", 9), std::string_view("torment", 7) },
+{ std::string_view("tormentors", 10), std::string_view("tormentor", 9) },
+{ std::string_view("torments", 8), std::string_view("torment", 7) },
+{ std::string_view("tossed", 6), std::string_view("toss", 4) },
+{ std::string_view("touched", 7), std::string_view("touch", 5) },
+{ std::string_view("touches", 7), std::string_view("touch", 5) },
+{ std::string_view("touching", 8), std::string_view("touch", 5) },
+{ std::string_view("towards", 7), std::string_view("toward", 6) },
+{ std::string_view("towers", 6), std::string_view("tower", 5) },
+{ std::string_view("towns", 5), std::string_view("town", 4) },
+{ std::string_view("traded", 6), std::string_view("trade", 5) },
+{ std::string_view("trading", 7), std::string_view("trade", 5) },
+{ std::string_view("traditions", 10), std::string_view("tradition", 9) },
+{ std::string_view("trafficked", 10), std::string_view("traffick", 8) },
+{ std::string_view("traffickers", 11), std::string_view("trafficker", 10) },
+{ std::string_view("trained", 7), std::string_view("train", 5) },
+{ std::string_view("traitors", 8), std::string_view("traitor", 7) },
+{ std::string_view("trampled", 8), std::string_view("trample", 7) },
+{ std::string_view("transgressed", 12), std::string_view("transgress", 10) },
+{ std::string_view("transgresses", 12), std::string_view("transgress", 10) },
+{ std::string_view("transgressing", 13), std::string_view("transgress", 10) },
+{ std::string_view("transgressions", 14), std::string_view("transgression", 13) },
+{ std::string_view("transgressors", 13), std::string_view("transgressor", 12) },
+{ std::string_view("translated", 10), std::string_view("translate", 9) },
+{ std::string_view("traps", 5), std::string_view("trap", 4) },
+{ std::string_view("travailed", 9), std::string_view("travail", 7) },
+{ std::string_view("travailest", 10), std::string_view("travails", 8) },
+{ std::string_view("travailing", 10), std::string_view("travail", 7) },
+{ std::string_view("travails", 8), std::string_view("travail", 7) },
+{ std::string_view("traveled", 8), std::string_view("travel", 6) },
+{ std::string_view("travelers", 9), std::string_view("traveler", 8) },
+{ std::string_view("traveling", 9), std::string_view("travel", 6) },
+{ std::string_view("travellers", 10), std::string_view("traveller", 9) },
+{ std::string_view("travels", 7), std::string_view("travel", 6) },
+{ std::string_view("treaders", 8), std::string_view("treader", 7) },
+{ std::string_view("treading", 8), std::string_view("tread", 5) },
+{ std::string_view("treads", 6), std::string_view("tread", 5) },
+{ std::string_view("treasured", 9), std::string_view("treasure", 8) },
+{ std::string_view("treasurers", 10), std::string_view("treasurer", 9) },
+{ std::string_view("treasures", 9), std::string_view("treasure", 8) },
+{ std::string_view("treasurest", 10), std::string_view("treasure", 8) },
+{ std::string_view("treasuring", 10), std::string_view("treasure", 8) },
+{ std::string_view("treated", 7), std::string_view("treat", 5) },
+{ std::string_view("trees", 5), std::string_view("tree", 4) },
+{ std::string_view("trembled", 8), std::string_view("tremble", 7) },
+{ std::string_view("trembles", 8), std::string_view("tremble", 7) },
+{ std::string_view("trembling", 9), std::string_view("tremble", 7) },
+{ std::string_view("trenches", 8), std::string_view("trench", 6) },
+{ std::string_view("trespassed", 10), std::string_view("trespass", 8) },
+{ std::string_view("trespasses", 10), std::string_view("trespass", 8) },
+{ std::string_view("trespassing", 11), std::string_view("trespass", 8) },
+{ std::string_view("trials", 6), std::string_view("trial", 5) },
+{ std::string_view("tribes", 6), std::string_view("tribe", 5) },
+{ std::string_view("tribulations", 12), std::string_view("tribulation", 11) },
+{ std::string_view("triest", 6), std::string_view("trip", 4) },
+{ std::string_view("triumphed", 9), std::string_view("triumph", 7) },
+{ std::string_view("triumphing", 10), std::string_view("triumph", 7) },
+{ std::string_view("triumphs", 8), std::string_view("triumph", 7) },
+{ std::string_view("troops", 6), std::string_view("troop", 5) },
+{ std::string_view("troubled", 8), std::string_view("trouble", 7) },
+{ std::string_view("troubles", 8), std::string_view("trouble", 7) },
+{ std::string_view("troublest", 9), std::string_view("trouble", 7) },
+{ std::string_view("troubling", 9), std::string_view("trouble", 7) },
+{ std::string_view("troughs", 7), std::string_view("trough", 6) },
+{ std::string_view("trumpets", 8), std::string_view("trumpet", 7) },
+{ std::string_view("trusted", 7), std::string_view("trust", 5) },
+{ std::string_view("trustest", 8), std::string_view("trusts", 6) },
+{ std::string_view("trusting", 8), std::string_view("trust", 5) },
+{ std::string_view("trusts", 6), std::string_view("trust", 5) },
+{ std::string_view("trying", 6), std::string_view("try", 3) },
+{ std::string_view("tumults", 7), std::string_view("tumult", 6) },
+{ std::string_view("tuned", 5), std::string_view("tune", 4) },
+{ std::string_view("turbans", 7), std::string_view("turban", 6) },
+{ std::string_view("turned", 6), std::string_view("turn", 4) },
+{ std::string_view("turnest", 7), std::string_view("turns", 5) },
+{ std::string_view("turning", 7), std::string_view("turn", 4) },
+{ std::string_view("turns", 5), std::string_view("turn", 4) },
+{ std::string_view("turtledoves", 11), std::string_view("turtledove", 10) },
+{ std::string_view("turtles", 7), std::string_view("turtle", 6) },
+{ std::string_view("tutors", 6), std::string_view("tutor", 5) },
+{ std::string_view("twined", 6), std::string_view("twin", 4) },
+{ std::string_view("twins", 5), std::string_view("twin", 4) },
+{ std::string_view("twisted", 7), std::string_view("twist", 5) },
+{ std::string_view("unawares", 8), std::string_view("unaware", 7) },
+{ std::string_view("unbelievers", 11), std::string_view("unbeliever", 10) },
+{ std::string_view("uncleannesses", 13), std::string_view("uncleanness", 11) },
+{ std::string_view("uncovered", 9), std::string_view("uncover", 7) },
+{ std::string_view("uncovers", 8), std::string_view("uncover", 7) },
+{ std::string_view("understandest", 13), std::string_view("understands", 11) },
+{ std::string_view("understanding", 13), std::string_view("understand", 10) },
+{ std::string_view("understands", 11), std::string_view("understand", 10) },
+{ std::string_view("unicorns", 8), std::string_view("unicorn", 7) },
+{ std::string_view("united", 6), std::string_view("unit", 4) },
+{ std::string_view("unloaded", 8), std::string_view("unload", 6) },
+{ std::string_view("untied", 6), std::string_view("untie", 5) },
+{ std::string_view("upbraided", 9), std::string_view("upbraid", 7) },
+{ std::string_view("upholdest", 9), std::string_view("upholds", 7) },
+{ std::string_view("upholding", 9), std::string_view("uphold", 6) },
+{ std::string_view("upholds", 7), std::string_view("uphold", 6) },
+{ std::string_view("uprooted", 8), std::string_view("uproot", 6) },
+{ std::string_view("urged", 5), std::string_view("urge", 4) },
+{ std::string_view("urges", 5), std::string_view("urge", 4) },
+{ std::string_view("used", 4), std::string_view("us", 2) },
+{ std::string_view("uses", 4), std::string_view("us", 2) },
+{ std::string_view("usest", 5), std::string_view("use", 3) },
+{ std::string_view("using", 5), std::string_view("us", 2) },
+{ std::string_view("uttered", 7), std::string_view("utter", 5) },
+{ std::string_view("uttering", 8), std::string_view("utter", 5) },
+{ std::string_view("utters", 6), std::string_view("utter", 5) },
+{ std::string_view("vagabonds", 9), std::string_view("vagabond", 8) },
+{ std::string_view("vails", 5), std::string_view("vail", 4) },
+{ std::string_view("valianting", 10), std::string_view("valiant", 7) },
+{ std::string_view("valleys", 7), std::string_view("valley", 6) },
+{ std::string_view("valued", 6), std::string_view("value", 5) },
+{ std::string_view("valuest", 7), std::string_view("value", 5) },
+{ std::string_view("vanished", 8), std::string_view("vanish", 6) },
+{ std::string_view("vanishes", 8), std::string_view("vanish", 6) },
+{ std::string_view("vanishing", 9), std::string_view("vanish", 6) },
+{ std::string_view("vapors", 6), std::string_view("vapor", 5) },
+{ std::string_view("vapours", 7), std::string_view("vapour", 6) },
+{ std::string_view("vats", 4), std::string_view("vat", 3) },
+{ std::string_view("vaulted", 7), std::string_view("vault", 5) },
+{ std::string_view("veiled", 6), std::string_view("veil", 4) },
+{ std::string_view("veils", 5), std::string_view("veil", 4) },
+{ std::string_view("vents", 5), std::string_view("vent", 4) },
+{ std::string_view("ventures", 8), std::string_view("venture", 7) },
+{ std::string_view("vessels", 7), std::string_view("vessel", 6) },
+{ std::string_view("vestures", 8), std::string_view("vesture", 7) },
+{ std::string_view("vexations", 9), std::string_view("vexation", 8) },
+{ std::string_view("vexed", 5), std::string_view("vex", 3) },
+{ std::string_view("vials", 5), std::string_view("vial", 4) },
+{ std::string_view("victuals", 8), std::string_view("victual", 7) },
+{ std::string_view("viewed", 6), std::string_view("view", 4) },
+{ std::string_view("vilest", 6), std::string_view("vile", 4) },
+{ std::string_view("villages", 8), std::string_view("village", 7) },
+{ std::string_view("vindicated", 10), std::string_view("vindicate", 9) },
+{ std::string_view("vines", 5), std::string_view("vine", 4) },
+{ std::string_view("vineyards", 9), std::string_view("vineyard", 8) },
+{ std::string_view("violated", 8), std::string_view("violate", 7) },
+{ std::string_view("viols", 5), std::string_view("viol", 4) },
+{ std::string_view("vipers", 6), std::string_view("viper", 5) },
+{ std::string_view("virgins", 7), std::string_view("virgin", 6) },
+{ std::string_view("visions", 7), std::string_view("vision", 6) },
+{ std::string_view("visited", 7), std::string_view("visit", 5) },
+{ std::string_view("visitest", 8), std::string_view("visits", 6) },
+{ std::string_view("visiting", 8), std::string_view("visit", 5) },
+{ std::string_view("visits", 6), std::string_view("visit", 5) },
+{ std::string_view("voices", 6), std::string_view("voice", 5) },
+{ std::string_view("vomited", 7), std::string_view("vomit", 5) },
+{ std::string_view("vomits", 6), std::string_view("vomit", 5) },
+{ std::string_view("vowed", 5), std::string_view("vow", 3) },
+{ std::string_view("vowest", 6), std::string_view("vows", 4) },
+{ std::string_view("vowing", 6), std::string_view("vow", 3) },
+{ std::string_view("vows", 4), std::string_view("vow", 3) },
+{ std::string_view("vultures", 8), std::string_view("vulture", 7) },
+{ std::string_view("wafers", 6), std::string_view("wafer", 5) },
+{ std::string_view("wages", 5), std::string_view("wag", 3) },
+{ std::string_view("wagons", 6), std::string_view("wagon", 5) },
+{ std::string_view("wailed", 6), std::string_view("wail", 4) },
+{ std::string_view("wailing", 7), std::string_view("wail", 4) },
+{ std::string_view("wailings", 8), std::string_view("wailing", 7) },
+{ std::string_view("wails", 5), std::string_view("wail", 4) },
+{ std::string_view("waited", 6), std::string_view("wait", 4) },
+{ std::string_view("waiting", 7), std::string_view("wait", 4) },
+{ std::string_view("waits", 5), std::string_view("wait", 4) },
+{ std::string_view("waked", 5), std::string_view("wake", 4) },
+{ std::string_view("wakes", 5), std::string_view("wake", 4) },
+{ std::string_view("waking", 6), std::string_view("wake", 4) },
+{ std::string_view("walked", 6), std::string_view("walk", 4) },
+{ std::string_view("walkest", 7), std::string_view("walks", 5) },
+{ std::string_view("walking", 7), std::string_view("walk", 4) },
+{ std::string_view("walks", 5), std::string_view("walk", 4) },
+{ std::string_view("walled", 6), std::string_view("wall", 4) },
+{ std::string_view("wallowed", 8), std::string_view("wallow", 6) },
+{ std::string_view("wallowing", 9), std::string_view("wallow", 6) },
+{ std::string_view("walls", 5), std::string_view("wall", 4) },
+{ std::string_view("wandered", 8), std::string_view("wander", 6) },
+{ std::string_view("wanderers", 9), std::string_view("wanderer", 8) },
+{ std::string_view("wanderest", 9), std::string_view("wanders", 7) },
+{ std::string_view("wandering", 9), std::string_view("wander", 6) },
+{ std::string_view("wanderings", 10), std::string_view("wandering", 9) },
+{ std::string_view("wanders", 7), std::string_view("wander", 6) },
+{ std::string_view("wanted", 6), std::string_view("want", 4) },
+{ std::string_view("wanting", 7), std::string_view("want", 4) },
+{ std::string_view("wants", 5), std::string_view("want", 4) },
+{ std::string_view("ward", 4), std::string_view("war", 3) },
+{ std::string_view("wards", 5), std::string_view("ward", 4) },
+{ std::string_view("wares", 5), std::string_view("war", 3) },
+{ std::string_view("warmed", 6), std::string_view("warm", 4) },
+{ std::string_view("warming", 7), std::string_view("warm", 4) },
+{ std::string_view("warms", 5), std::string_view("warm", 4) },
+{ std::string_view("warned", 6), std::string_view("warn", 4) },
+{ std::string_view("warning", 7), std::string_view("warn", 4) },
+{ std::string_view("warns", 5), std::string_view("warn", 4) },
+{ std::string_view("warped", 6), std::string_view("warp", 4) },
+{ std::string_view("warriors", 8), std::string_view("warrior", 7) },
+{ std::string_view("wars", 4), std::string_view("war", 3) },
+{ std::string_view("washed", 6), std::string_view("wash", 4) },
+{ std::string_view("washing", 7), std::string_view("wash", 4) },
+{ std::string_view("washings", 8), std::string_view("washing", 7) },
+{ std::string_view("wasted", 6), std::string_view("wast", 4) },
+{ std::string_view("wastes", 6), std::string_view("wast", 4) },
+{ std::string_view("wasting", 7), std::string_view("wast", 4) },
+{ std::string_view("watched", 7), std::string_view("watch", 5) },
+{ std::string_view("watchers", 8), std::string_view("watcher", 7) },
+{ std::string_view("watches", 7), std::string_view("watch", 5) },
+{ std::string_view("watching", 8), std::string_view("watch", 5) },
+{ std::string_view("watchings", 9), std::string_view("watching", 8) },
+{ std::string_view("watercourses", 12), std::string_view("watercourse", 11) },
+{ std::string_view("watered", 7), std::string_view("water", 5) },
+{ std::string_view("waterest", 8), std::string_view("waters", 6) },
+{ std::string_view("watering", 8), std::string_view("water", 5) },
+{ std::string_view("waterpots", 9), std::string_view("waterpot", 8) },
+{ std::string_view("waters", 6), std::string_view("water", 5) },
+{ std::string_view("waved", 5), std::string_view("wave", 4) },
+{ std::string_view("waves", 5), std::string_view("wave", 4) },
+{ std::string_view("waxed", 5), std::string_view("wax", 3) },
+{ std::string_view("waxing", 6), std::string_view("wax", 3) },
+{ std::string_view("ways", 4), std::string_view("way", 3) },
+{ std::string_view("weakened", 8), std::string_view("weaken", 6) },
+{ std::string_view("weakens", 7), std::string_view("weaken", 6) },
+{ std::string_view("weaknesses", 10), std::string_view("weakness", 8) },
+{ std::string_view("weapons", 7), std::string_view("weapon", 6) },
+{ std::string_view("wearing", 7), std::string_view("wear", 4) },
+{ std::string_view("wears", 5), std::string_view("wear", 4) },
+{ std::string_view("weavest", 7), std::string_view("weave", 5) },
+{ std::string_view("weaving", 7), std::string_view("weave", 5) },
+{ std::string_view("webs", 4), std::string_view("web", 3) },
+{ std::string_view("weddings", 8), std::string_view("wedding", 7) },
+{ std::string_view("weeks", 5), std::string_view("week", 4) },
+{ std::string_view("weepest", 7), std::string_view("weeps", 5) },
+{ std::string_view("weeping", 7), std::string_view("weep", 4) },
+{ std::string_view("weeps", 5), std::string_view("weep", 4) },
+{ std::string_view("weighed", 7), std::string_view("weigh", 5) },
+{ std::string_view("weighing", 8), std::string_view("weigh", 5) },
+{ std::string_view("weighs", 6), std::string_view("weigh", 5) },
+{ std::string_view("weights", 7), std::string_view("weight", 6) },
+{ std::string_view("welcomed", 8), std::string_view("welcome", 7) },
+{ std::string_view("welcomes", 8), std::string_view("welcome", 7) },
+{ std::string_view("wells", 5), std::string_view("well", 4) },
+{ std::string_view("wenting", 7), std::string_view("went", 4) },
+{ std::string_view("west", 4), std::string_view("we", 2) },
+{ std::string_view("whales", 6), std::string_view("whale", 5) },
+{ std::string_view("wheels", 6), std::string_view("wheel", 5) },
+{ std::string_view("whelps", 6), std::string_view("whelp", 5) },
+{ std::string_view("whiles", 6), std::string_view("while", 5) },
+{ std::string_view("whips", 5), std::string_view("whip", 4) },
+{ std::string_view("whirlwinds", 10), std::string_view("whirlwind", 9) },
+{ std::string_view("whispered", 9), std::string_view("whisper", 7) },
+{ std::string_view("whisperers", 10), std::string_view("whisperer", 9) },
+{ std::string_view("whispering", 10), std::string_view("whisper", 7) },
+{ std::string_view("whisperings", 11), std::string_view("whispering", 10) },
+{ std::string_view("whited", 6), std::string_view("whit", 4) },
+{ std::string_view("whitened", 8), std::string_view("whiten", 6) },
+{ std::string_view("whitewashed", 11), std::string_view("whitewash", 9) },
+{ std::string_view("whoredoms", 9), std::string_view("whoredom", 8) },
+{ std::string_view("whoremongers", 12), std::string_view("whoremonger", 11) },
+{ std::string_view("whores", 6), std::string_view("whore", 5) },
+{ std::string_view("whoring", 7), std::string_view("whore", 5) },
+{ std::string_view("wicked", 6), std::string_view("wick", 4) },
+{ std::string_view("widows", 6), std::string_view("widow", 5) },
+{ std::string_view("wielding", 8), std::string_view("wield", 5) },
+{ std::string_view("wields", 6), std::string_view("wield", 5) },
+{ std::string_view("willed", 6), std::string_view("will", 4) },
+{ std::string_view("willing", 7), std::string_view("will", 4) },
+{ std::string_view("willows", 7), std::string_view("willow", 6) },
+{ std::string_view("wills", 5), std::string_view("will", 4) },
+{ std::string_view("wind", 4), std::string_view("win", 3) },
+{ std::string_view("winding", 7), std::string_view("wind", 4) },
+{ std::string_view("windows", 7), std::string_view("window", 6) },
+{ std::string_view("winds", 5), std::string_view("wind", 4) },
+{ std::string_view("winebibbers", 11), std::string_view("winebibber", 10) },
+{ std::string_view("winepresses", 11), std::string_view("winepress", 9) },
+{ std::string_view("wines", 5), std::string_view("win", 3) },
+{ std::string_view("wineskins", 9), std::string_view("wineskin", 8) },
+{ std::string_view("wing", 4), std::string_view("we", 2) },
+{ std::string_view("winged", 6), std::string_view("wing", 4) },
+{ std::string_view("wings", 5), std::string_view("wing", 4) },
+{ std::string_view("winked", 6), std::string_view("wink", 4) },
+{ std::string_view("winking", 7), std::string_view("wink", 4) },
+{ std::string_view("winks", 5), std::string_view("wink", 4) },
+{ std::string_view("winnowed", 8), std::string_view("winnow", 6) },
+{ std::string_view("winnowing", 9), std::string_view("winnow", 6) },
+{ std::string_view("winnows", 7), std::string_view("winnow", 6) },
+{ std::string_view("wins", 4), std::string_view("win", 3) },
+{ std::string_view("wintered", 8), std::string_view("winter", 6) },
+{ std::string_view("wiped", 5), std::string_view("wipe", 4) },
+{ std::string_view("wipes", 5), std::string_view("wipe", 4) },
+{ std::string_view("wiping", 6), std::string_view("wipe", 4) },
+{ std::string_view("wisest", 6), std::string_view("wise", 4) },
+{ std::string_view("wished", 6), std::string_view("wish", 4) },
+{ std::string_view("wishing", 7), std::string_view("wish", 4) },
+{ std::string_view("witchcrafts", 11), std::string_view("witchcraft", 10) },
+{ std::string_view("withdrawest", 11), std::string_view("withdrawn", 9) },
+{ std::string_view("withdrawing", 11), std::string_view("withdraw", 8) },
+{ std::string_view("withered", 8), std::string_view("wither", 6) },
+{ std::string_view("withers", 7), std::string_view("wither", 6) },
+{ std::string_view("withhelding", 11), std::string_view("withheld", 8) },
+{ std::string_view("withholds", 9), std::string_view("withhold", 8) },
+{ std::string_view("withs", 5), std::string_view("with", 4) },
+{ std::string_view("withstands", 10), std::string_view("withstand", 9) },
+{ std::string_view("witnessed", 9), std::string_view("witness", 7) },
+{ std::string_view("witnesses", 9), std::string_view("witness", 7) },
+{ std::string_view("witnessing", 10), std::string_view("witness", 7) },
+{ std::string_view("wits", 4), std::string_view("wit", 3) },
+{ std::string_view("wizards", 7), std::string_view("wizard", 6) },
+{ std::string_view("woes", 4), std::string_view("woe", 3) },
+{ std::string_view("wombs", 5), std::string_view("womb", 4) },
+{ std::string_view("wondered", 8), std::string_view("wonder", 6) },
+{ std::string_view("wondering", 9), std::string_view("wonder", 6) },
+{ std::string_view("wonders", 7), std::string_view("wonder", 6) },
+{ std::string_view("woods", 5), std::string_view("wood", 4) },
+{ std::string_view("words", 5), std::string_view("word", 4) },
+{ std::string_view("worked", 6), std::string_view("work", 4) },
+{ std::string_view("workers", 7), std::string_view("worker", 6) },
+{ std::string_view("working", 7), std::string_view("work", 4) },
+{ std::string_view("workings", 8), std::string_view("working", 7) },
+{ std::string_view("works", 5), std::string_view("work", 4) },
+{ std::string_view("worlds", 6), std::string_view("world", 5) },
+{ std::string_view("worms", 5), std::string_view("worm", 4) },
+{ std::string_view("worshiped", 9), std::string_view("worship", 7) },
+{ std::string_view("worshippers", 11), std::string_view("worshipper", 10) },
+{ std::string_view("worships", 8), std::string_view("worship", 7) },
+{ std::string_view("wouldest", 8), std::string_view("wouldn", 6) },
+{ std::string_view("woulding", 8), std::string_view("would", 5) },
+{ std::string_view("wounded", 7), std::string_view("wound", 5) },
+{ std::string_view("wounding", 8), std::string_view("wound", 5) },
+{ std::string_view("wounds", 6), std::string_view("wound", 5) },
+{ std::string_view("wraths", 6), std::string_view("wrath", 5) },
+{ std::string_view("wreathed", 8), std::string_view("wreath", 6) },
+{ std::string_view("wreaths", 7), std::string_view("wreath", 6) },
+{ std::string_view("wrestled", 8), std::string_view("wrestle", 7) },
+{ std::string_view("wrestling", 9), std::string_view("wrestle", 7) },
+{ std::string_view("wrestlings", 10), std::string_view("wrestling", 9) },
+{ std::string_view("wrests", 6), std::string_view("wrest", 5) },
+{ std::string_view("wringed", 7), std::string_view("wring", 5) },
+{ std::string_view("wringing", 8), std::string_view("wring", 5) },
+{ std::string_view("wrinkles", 8), std::string_view("wrinkle", 7) },
+{ std::string_view("writers", 7), std::string_view("writer", 6) },
+{ std::string_view("writes", 6), std::string_view("write", 5) },
+{ std::string_view("writest", 7), std::string_view("write", 5) },
+{ std::string_view("writing", 7), std::string_view("write", 5) },
+{ std::string_view("writings", 8), std::string_view("writing", 7) },
+{ std::string_view("wronged", 7), std::string_view("wrong", 5) },
+{ std::string_view("wrongs", 6), std::string_view("wrong", 5) },
+{ std::string_view("wroughting", 10), std::string_view("wrought", 7) },
+{ std::string_view("yearned", 7), std::string_view("yearn", 5) },
+{ std::string_view("yearning", 8), std::string_view("yearn", 5) },
+{ std::string_view("yearns", 6), std::string_view("yearn", 5) },
+{ std::string_view("years", 5), std::string_view("year", 4) },
+{ std::string_view("yelled", 6), std::string_view("yell", 4) },
+{ std::string_view("yes", 3), std::string_view("ye", 2) },
+{ std::string_view("yielded", 7), std::string_view("yield", 5) },
+{ std::string_view("yielding", 8), std::string_view("yield", 5) },
+{ std::string_view("yields", 6), std::string_view("yield", 5) },
+{ std::string_view("yoked", 5), std::string_view("yoke", 4) },
+{ std::string_view("yokes", 5), std::string_view("yoke", 4) },
+{ std::string_view("younging", 8), std::string_view("young", 5) },
+{ std::string_view("yours", 5), std::string_view("your", 4) },
+{ std::string_view("youths", 6), std::string_view("youth", 5) },
+{ std::string_view("zamzummims", 10), std::string_view("zamzummim", 9) },
+{ std::string_view("zebulunite", 10), std::string_view("zebulun", 7) },
+{ std::string_view("zebulunites", 11), std::string_view("zebulunite", 10) },
+{ std::string_view("zered", 5), std::string_view("zer", 3) },
+{ std::string_view("zuzims", 6), std::string_view("zuzim", 5) },
+};
+const std::uint32_t ROOT_WORD_MAP_SEEDS_BY_BUCKET[] =
+{
+1,
+1,
+1,
+8,
+3,
+15,
+3,
+0,
+0,
+0,
+10,
+0,
+1,
+0,
+0,
+0,
+2,
+1,
+0,
+5,
+3,
+1,
+1,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+2,
+1,
+0,
+1,
+1,
+1,
+1,
+0,
+0,
+4,
+2,
+2,
+2,
+0,
+3,
+1,
+0,
+1,
+1,
+0,
+0,
+2,
+1,
+2,
+9,
+7,
+0,
+0,
+1,
+1,
+1,
+0,
+4,
+9,
+1,
+1,
+4,
+0,
+0,
+0,
+1,
+0,
+0,
+2,
+1,
+0,
+4,
+0,
+0,
+0,
+1,
+0,
+0,
+1,
+5,
+1,
+4,
+1,
+0,
+2,
+1,
+3,
+3,
+0,
+0,
+0,
+0,
+1,
+1,
+2,
+2,
+4,
+2,
+4,
+3,
+0,
+0,
+2,
+4,
+2,
+5,
+3,
+6,
+0,
+0,
+7,
+2,
+3,
+1,
+1,
+1,
+3,
+7,
+3,
+0,
+1,
+2,
+3,
+3,
+2,
+8,
+5,
+1,
+15,
+1,
+3,
+2,
+0,
+2,
+5,
+1,
+0,
+0,
+0,
+7,
+0,
+3,
+5,
+5,
+1,
+0,
+2,
+0,
+1,
+0,
+0,
+0,
+4,
+3,
+1,
+2,
+0,
+0,
+2,
+0,
+0,
+3,
+6,
+0,
+0,
+1,
+4,
+4,
+3,
+2,
+1,
+17,
+0,
+1,
+2,
+0,
+1,
+0,
+2,
+0,
+1,
+2,
+5,
+1,
+1,
+1,
+0,
+0,
+2,
+4,
+0,
+5,
+3,
+2,
+0,
+0,
+0,
+1,
+4,
+0,
+6,
+0,
+1,
+2,
+1,
+4,
+0,
+0,
+4,
+2,
+3,
+2,
+0,
+0,
+12,
+8,
+1,
+0,
+1,
+5,
+0,
+1,
+1,
+1,
+0,
+0,
+0,
+0,
+2,
+2,
+0,
+0,
+4,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+3,
+0,
+10,
+0,
+0,
+2,
+1,
+0,
+8,
+3,
+2,
+0,
+3,
+5,
+9,
+0,
+0,
+3,
+1,
+0,
+2,
+0,
+2,
+2,
+1,
+1,
+0,
+5,
+0,
+0,
+4,
+1,
+2,
+0,
+4,
+0,
+2,
+0,
+3,
+3,
+1,
+0,
+2,
+0,
+1,
+1,
+1,
+1,
+0,
+3,
+0,
+1,
+9,
+5,
+3,
+1,
+6,
+0,
+10,
+0,
+2,
+0,
+15,
+2,
+0,
+8,
+5,
+5,
+2,
+1,
+1,
+3,
+1,
+4,
+0,
+0,
+2,
+2,
+1,
+10,
+1,
+0,
+2,
+3,
+0,
+5,
+0,
+2,
+4,
+1,
+1,
+4,
+1,
+0,
+0,
+0,
+8,
+0,
+0,
+3,
+9,
+11,
+6,
+0,
+2,
+0,
+2,
+0,
+4,
+2,
+1,
+0,
+0,
+0,
+1,
+2,
+0,
+1,
+0,
+7,
+10,
+7,
+0,
+4,
+1,
+3,
+3,
+3,
+6,
+1,
+0,
+0,
+0,
+0,
+3,
+3,
+1,
+0,
+2,
+1,
+5,
+0,
+4,
+8,
+2,
+1,
+4,
+0,
+10,
+3,
+0,
+0,
+0,
+0,
+1,
+0,
+1,
+0,
+7,
+0,
+4,
+1,
+0,
+7,
+2,
+0,
+0,
+0,
+1,
+1,
+7,
+1,
+3,
+2,
+6,
+10,
+0,
+6,
+0,
+22,
+3,
+0,
+1,
+2,
+5,
+1,
+2,
+1,
+7,
+0,
+0,
+3,
+2,
+2,
+4,
+0,
+1,
+3,
+0,
+0,
+3,
+4,
+13,
+0,
+3,
+1,
+7,
+2,
+0,
+3,
+0,
+0,
+0,
+6,
+0,
+1,
+6,
+3,
+5,
+0,
+1,
+2,
+1,
+0,
+3,
+3,
+4,
+0,
+0,
+0,
+6,
+1,
+0,
+0,
+1,
+4,
+7,
+0,
+7,
+5,
+2,
+2,
+6,
+0,
+0,
+0,
+0,
+1,
+1,
+7,
+5,
+0,
+1,
+4,
+0,
+1,
+0,
+1,
+0,
+0,
+0,
+1,
+0,
+0,
+3,
+7,
+2,
+1,
+1,
+10,
+0,
+1,
+0,
+1,
+1,
+0,
+1,
+4,
+14,
+0,
+2,
+0,
+9,
+0,
+3,
+1,
+3,
+3,
+1,
+0,
+4,
+13,
+0,
+4,
+2,
+2,
+7,
+7,
+9,
+0,
+0,
+0,
+1,
+0,
+2,
+0,
+5,
+2,
+6,
+8,
+3,
+7,
+4,
+3,
+0,
+2,
+0,
+0,
+8,
+0,
+2,
+2,
+0,
+2,
+0,
+0,
+1,
+3,
+8,
+0,
+0,
+0,
+0,
+4,
+5,
+0,
+6,
+0,
+6,
+0,
+1,
+4,
+0,
+3,
+0,
+0,
+0,
+1,
+7,
+10,
+12,
+0,
+11,
+0,
+3,
+4,
+0,
+0,
+2,
+0,
+0,
+2,
+1,
+0,
+1,
+3,
+11,
+3,
+0,
+4,
+0,
+0,
+1,
+1,
+3,
+1,
+3,
+2,
+0,
+5,
+2,
+1,
+1,
+0,
+5,
+2,
+0,
+0,
+5,
+1,
+3,
+2,
+1,
+11,
+0,
+0,
+3,
+2,
+0,
+0,
+4,
+4,
+3,
+0,
+19,
+0,
+2,
+7,
+0,
+2,
+1,
+3,
+1,
+1,
+0,
+2,
+2,
+2,
+0,
+2,
+2,
+9,
+0,
+8,
+2,
+2,
+3,
+2,
+1,
+3,
+6,
+12,
+2,
+0,
+0,
+0,
+0,
+2,
+0,
+5,
+1,
+0,
+0,
+0,
+0,
+3,
+0,
+0,
+1,
+3,
+12,
+0,
+1,
+0,
+0,
+11,
+3,
+0,
+2,
+0,
+8,
+0,
+7,
+7,
+7,
+15,
+0,
+1,
+6,
+2,
+0,
+1,
+1,
+0,
+0,
+1,
+1,
+2,
+0,
+1,
+5,
+0,
+2,
+0,
+8,
+2,
+10,
+4,
+6,
+0,
+0,
+1,
+1,
+6,
+22,
+0,
+14,
+2,
+1,
+13,
+0,
+0,
+0,
+0,
+3,
+6,
+0,
+7,
+0,
+1,
+0,
+0,
+4,
+9,
+2,
+9,
+10,
+1,
+0,
+4,
+0,
+6,
+0,
+2,
+4,
+5,
+5,
+2,
+9,
+2,
+0,
+5,
+10,
+2,
+13,
+1,
+2,
+6,
+2,
+1,
+7,
+3,
+2,
+0,
+0,
+4,
+8,
+8,
+7,
+2,
+3,
+1,
+2,
+2,
+1,
+0,
+7,
+3,
+1,
+3,
+1,
+1,
+5,
+2,
+0,
+1,
+0,
+0,
+1,
+5,
+3,
+11,
+4,
+4,
+2,
+2,
+2,
+1,
+1,
+3,
+4,
+8,
+8,
+0,
+8,
+4,
+2,
+2,
+5,
+7,
+4,
+14,
+5,
+1,
+0,
+12,
+1,
+0,
+1,
+0,
+0,
+3,
+1,
+0,
+0,
+15,
+1,
+0,
+7,
+1,
+0,
+1,
+5,
+1,
+2,
+11,
+4,
+0,
+0,
+2,
+5,
+2,
+11,
+1,
+0,
+4,
+0,
+2,
+2,
+1,
+5,
+9,
+1,
+5,
+0,
+1,
+0,
+0,
+2,
+1,
+1,
+7,
+0,
+5,
+3,
+5,
+3,
+7,
+10,
+1,
+0,
+3,
+6,
+5,
+1,
+6,
+1,
+1,
+10,
+0,
+0,
+2,
+5,
+7,
+0,
+0,
+20,
+2,
+2,
+0,
+3,
+14,
+8,
+0,
+1,
+18,
+5,
+5,
+6,
+2,
+9,
+0,
+3,
+3,
+14,
+7,
+2,
+4,
+2,
+5,
+2,
+1,
+0,
+4,
+0,
+5,
+23,
+2,
+3,
+0,
+2,
+1,
+0,
+0,
+3,
+8,
+0,
+1,
+0,
+10,
+0,
+1,
+0,
+6,
+0,
+0,
+0,
+7,
+0,
+3,
+8,
+2,
+0,
+3,
+4,
+2,
+2,
+0,
+5,
+6,
+0,
+0,
+4,
+2,
+5,
+0,
+2,
+6,
+3,
+0,
+4,
+0,
+1,
+9,
+4,
+7,
+3,
+1,
+0,
+0,
+2,
+3,
+1,
+0,
+2,
+0,
+2,
+2,
+0,
+11,
+5,
+3,
+0,
+0,
+4,
+2,
+4,
+1,
+1,
+1,
+31,
+2,
+4,
+0,
+3,
+6,
+12,
+3,
+0,
+1,
+8,
+2,
+5,
+0,
+2,
+0,
+0,
+0,
+1,
+4,
+};
+const std::uint16_t ROOT_WORD_MAP_ENTRY_INDICES_BY_SLOT[] =
+{
+1433,
+65535,
+65535,
+2228,
+65535,
+2047,
+1446,
+65535,
+2708,
+2021,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3747,
+65535,
+65535,
+65535,
+432,
+65535,
+1651,
+65535,
+2863,
+864,
+65535,
+65535,
+65535,
+1725,
+65535,
+1108,
+1706,
+2366,
+894,
+65535,
+2529,
+3870,
+1016,
+1941,
+1730,
+65535,
+137,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+6,
+3152,
+957,
+1872,
+65535,
+65535,
+65535,
+65535,
+817,
+964,
+3869,
+599,
+65535,
+65535,
+1052,
+905,
+65535,
+65535,
+840,
+3357,
+1284,
+65535,
+625,
+65535,
+65535,
+65535,
+65535,
+532,
+3847,
+65535,
+2097,
+65535,
+65535,
+65535,
+65535,
+65535,
+1818,
+65535,
+3090,
+65535,
+65535,
+65535,
+65535,
+3140,
+65535,
+3801,
+65535,
+1514,
+2736,
+824,
+65535,
+3311,
+65535,
+3916,
+65535,
+3333,
+2913,
+1665,
+2182,
+3430,
+796,
+65535,
+65535,
+3926,
+1461,
+65535,
+65535,
+65535,
+65535,
+1978,
+65535,
+65535,
+2199,
+1855,
+872,
+452,
+65535,
+65535,
+65535,
+3199,
+65535,
+65535,
+65535,
+2637,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3483,
+154,
+65535,
+2447,
+459,
+65535,
+830,
+65535,
+3994,
+65535,
+65535,
+65535,
+1271,
+1424,
+115,
+3968,
+65535,
+65535,
+65535,
+65535,
+638,
+65535,
+570,
+3473,
+3685,
+1106,
+410,
+65535,
+65535,
+1333,
+65535,
+2458,
+3636,
+65535,
+1573,
+65535,
+972,
+65535,
+65535,
+1670,
+3742,
+378,
+416,
+65535,
+802,
+128,
+65535,
+1309,
+150,
+65535,
+4028,
+65535,
+65535,
+990,
+3824,
+65535,
+65535,
+3760,
+3890,
+522,
+65535,
+918,
+2357,
+65535,
+3472,
+65535,
+1370,
+974,
+65535,
+2751,
+2776,
+65535,
+498,
+65535,
+65535,
+2080,
+65535,
+65535,
+65535,
+2594,
+65535,
+1031,
+2200,
+65535,
+421,
+65535,
+65535,
+65535,
+2157,
+65535,
+65535,
+65535,
+65535,
+65535,
+3274,
+65535,
+65535,
+65535,
+3581,
+65535,
+946,
+65535,
+65535,
+513,
+65535,
+21,
+2886,
+1289,
+65535,
+3132,
+2582,
+1303,
+65535,
+139,
+3653,
+65535,
+65535,
+1103,
+65535,
+65535,
+18,
+4112,
+65535,
+65535,
+1686,
+850,
+65535,
+1840,
+65535,
+65535,
+65535,
+3280,
+65535,
+65535,
+65535,
+22,
+65535,
+65535,
+503,
+65535,
+283,
+65535,
+65535,
+591,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+64,
+65535,
+65535,
+65535,
+1287,
+3153,
+65535,
+2163,
+1101,
+794,
+65535,
+693,
+3428,
+1775,
+516,
+65535,
+65535,
+65535,
+1379,
+443,
+65535,
+65535,
+65535,
+65535,
+65535,
+2423,
+65535,
+2243,
+484,
+65535,
+65535,
+65535,
+1555,
+65535,
+65535,
+65535,
+2105,
+65535,
+65535,
+3320,
+594,
+65535,
+65535,
+1554,
+3220,
+65535,
+65535,
+3456,
+631,
+65535,
+4077,
+65535,
+451,
+3201,
+1312,
+65535,
+903,
+916,
+65535,
+65535,
+270,
+65535,
+65535,
+488,
+2122,
+610,
+2987,
+1526,
+65535,
+1450,
+65535,
+65535,
+65535,
+65535,
+65535,
+395,
+1253,
+4065,
+2685,
+65535,
+65535,
+65535,
+65535,
+65535,
+3236,
+219,
+1701,
+3015,
+981,
+127,
+2144,
+333,
+65535,
+65535,
+4059,
+65535,
+65535,
+3184,
+3940,
+65535,
+414,
+65535,
+65535,
+2475,
+65535,
+65535,
+1184,
+65535,
+65535,
+3364,
+176,
+65535,
+282,
+2516,
+65535,
+3687,
+289,
+65535,
+65535,
+65535,
+65535,
+65535,
+3988,
+65535,
+65535,
+65535,
+3062,
+65535,
+65535,
+3691,
+2081,
+65535,
+1842,
+3838,
+65535,
+65535,
+3953,
+2744,
+65535,
+65535,
+2944,
+637,
+65535,
+719,
+4128,
+2978,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1747,
+3868,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3069,
+65535,
+3686,
+1124,
+1675,
+65535,
+1488,
+862,
+3704,
+2980,
+65535,
+65535,
+2028,
+65535,
+827,
+65535,
+3676,
+65535,
+1237,
+65535,
+65535,
+3963,
+65535,
+3651,
+3061,
+3215,
+3563,
+65535,
+3786,
+65535,
+65535,
+65535,
+65535,
+774,
+65535,
+65535,
+2426,
+65535,
+3718,
+1742,
+1340,
+65535,
+65535,
+65535,
+3664,
+65535,
+65535,
+2256,
+65535,
+65535,
+65535,
+65535,
+3917,
+759,
+65535,
+2853,
+2511,
+65535,
+65535,
+65535,
+1421,
+65535,
+65535,
+65535,
+871,
+65535,
+65535,
+394,
+65535,
+2627,
+2831,
+2240,
+65535,
+65535,
+1807,
+1996,
+1025,
+2227,
+735,
+2376,
+65535,
+3631,
+143,
+65535,
+65535,
+65535,
+3710,
+65535,
+65535,
+1852,
+65535,
+65535,
+728,
+65535,
+65535,
+65535,
+3554,
+3882,
+3833,
+3632,
+65535,
+65535,
+131,
+65535,
+1375,
+1283,
+510,
+65535,
+65535,
+65535,
+65535,
+1647,
+65535,
+65535,
+2327,
+768,
+65535,
+973,
+3454,
+65535,
+65535,
+441,
+2014,
+65535,
+2121,
+65535,
+533,
+3490,
+1037,
+65535,
+65535,
+65535,
+65535,
+25,
+65535,
+3598,
+65535,
+65535,
+2517,
+65535,
+65535,
+2757,
+464,
+65535,
+679,
+1813,
+65535,
+65535,
+4050,
+568,
+1771,
+1426,
+3190,
+3667,
+858,
+65535,
+2147,
+65535,
+1439,
+3079,
+65535,
+65535,
+65535,
+730,
+65535,
+3639,
+1663,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+196,
+1157,
+65535,
+2555,
+3947,
+612,
+65535,
+390,
+933,
+65535,
+3505,
+860,
+65535,
+65535,
+65535,
+4118,
+65535,
+65535,
+65535,
+65535,
+2155,
+65535,
+65535,
+65535,
+1160,
+2396,
+1056,
+3130,
+1983,
+3952,
+873,
+3292,
+65535,
+65535,
+187,
+1524,
+327,
+2323,
+65535,
+65535,
+65535,
+65535,
+869,
+958,
+3971,
+1447,
+2732,
+65535,
+65535,
+65535,
+65535,
+2057,
+3677,
+65535,
+65535,
+2792,
+65535,
+2026,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3200,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+11,
+65535,
+65535,
+65535,
+2670,
+4086,
+1677,
+65535,
+102,
+14,
+726,
+65535,
+4034,
+2846,
+2305,
+65535,
+3848,
+65535,
+386,
+65535,
+65535,
+318,
+1743,
+2771,
+1295,
+2949,
+65535,
+65535,
+556,
+65535,
+3086,
+3413,
+65535,
+44,
+65535,
+65535,
+1164,
+146,
+65535,
+1853,
+1591,
+1216,
+65535,
+65535,
+65535,
+3924,
+147,
+71,
+65535,
+711,
+33,
+3362,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2094,
+65535,
+65535,
+525,
+2933,
+3731,
+65535,
+2888,
+65535,
+65535,
+65535,
+3175,
+65535,
+65535,
+65535,
+65535,
+3273,
+1764,
+2926,
+116,
+65535,
+294,
+1189,
+2714,
+65535,
+1448,
+65535,
+1,
+2347,
+65535,
+65535,
+2787,
+65535,
+1344,
+3020,
+229,
+51,
+65535,
+1881,
+65535,
+65535,
+2924,
+65535,
+3089,
+3241,
+2161,
+65535,
+65535,
+65535,
+2134,
+2630,
+65535,
+299,
+1090,
+1493,
+3669,
+915,
+1680,
+4040,
+2823,
+3263,
+65535,
+65535,
+65535,
+65535,
+3044,
+3750,
+1314,
+2108,
+65535,
+984,
+65535,
+1308,
+65535,
+2680,
+65535,
+65535,
+2951,
+267,
+65535,
+317,
+65535,
+3999,
+65535,
+3589,
+3319,
+65535,
+2584,
+1835,
+2443,
+1210,
+65535,
+65535,
+65535,
+2880,
+2342,
+65535,
+3302,
+2354,
+65535,
+65535,
+2400,
+65535,
+65535,
+3328,
+941,
+65535,
+65535,
+65535,
+65535,
+65535,
+1599,
+2282,
+65535,
+3668,
+2270,
+65535,
+65535,
+65535,
+3414,
+65535,
+65535,
+1655,
+65535,
+65535,
+3470,
+3172,
+65535,
+2749,
+2705,
+494,
+1953,
+2897,
+65535,
+1875,
+1405,
+65535,
+811,
+902,
+3673,
+65535,
+2514,
+65535,
+65535,
+65535,
+65535,
+2451,
+478,
+743,
+65535,
+65535,
+2647,
+2950,
+3874,
+3768,
+3122,
+536,
+4106,
+1080,
+65535,
+3180,
+2600,
+65535,
+3931,
+2352,
+567,
+65535,
+65535,
+12,
+663,
+4070,
+65535,
+65535,
+65535,
+1129,
+65535,
+2241,
+2497,
+3608,
+3609,
+65535,
+1293,
+982,
+1062,
+65535,
+1003,
+65535,
+2502,
+65535,
+65535,
+3830,
+65535,
+344,
+65535,
+65535,
+65535,
+2764,
+35,
+2005,
+3191,
+65535,
+65535,
+65535,
+4030,
+2205,
+65535,
+65535,
+65535,
+1121,
+2329,
+2722,
+239,
+65535,
+2460,
+2609,
+922,
+65535,
+2316,
+3354,
+65535,
+1768,
+65535,
+105,
+65535,
+65535,
+142,
+65535,
+65535,
+65535,
+1236,
+656,
+65535,
+206,
+65535,
+2250,
+65535,
+65535,
+3213,
+65535,
+68,
+65535,
+2929,
+65535,
+275,
+65535,
+65535,
+65535,
+65535,
+65535,
+2043,
+65535,
+65535,
+608,
+65535,
+65535,
+3144,
+65535,
+65535,
+2220,
+1484,
+716,
+2786,
+3814,
+1797,
+2394,
+65535,
+65535,
+2644,
+1247,
+2304,
+65535,
+65535,
+1145,
+65535,
+3453,
+999,
+2218,
+3756,
+65535,
+252,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+454,
+1684,
+65535,
+3005,
+2101,
+65535,
+65535,
+2424,
+65535,
+1304,
+3155,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+677,
+65535,
+2040,
+1922,
+3640,
+65535,
+65535,
+65535,
+65535,
+1146,
+1205,
+65535,
+65535,
+648,
+65535,
+65535,
+65535,
+65535,
+3246,
+65535,
+65535,
+3770,
+334,
+3765,
+65535,
+1649,
+2580,
+65535,
+65535,
+65535,
+1095,
+65535,
+65535,
+65535,
+3547,
+2483,
+574,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2189,
+65535,
+65535,
+453,
+65535,
+277,
+2409,
+65535,
+65535,
+293,
+65535,
+79,
+65535,
+65535,
+910,
+938,
+2238,
+799,
+65535,
+65535,
+360,
+3925,
+65535,
+65535,
+2340,
+65535,
+65535,
+65535,
+1462,
+1403,
+3941,
+65535,
+1387,
+3237,
+1128,
+1399,
+3281,
+65535,
+65535,
+3690,
+2899,
+65535,
+3625,
+3649,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2198,
+65535,
+2903,
+65535,
+65535,
+65535,
+3897,
+65535,
+65535,
+1962,
+2707,
+65535,
+65535,
+1225,
+65535,
+65535,
+1525,
+65535,
+101,
+2011,
+65535,
+65535,
+65535,
+65535,
+1239,
+4014,
+65535,
+2958,
+65535,
+65535,
+3716,
+65535,
+2355,
+1584,
+65535,
+2558,
+3315,
+3900,
+2996,
+65535,
+3174,
+65535,
+988,
+65535,
+65535,
+65535,
+13,
+65535,
+3991,
+65535,
+65535,
+65535,
+65535,
+2986,
+65535,
+65535,
+3238,
+161,
+3727,
+65535,
+65535,
+65535,
+2363,
+65535,
+2138,
+65535,
+65535,
+65535,
+65535,
+1343,
+2591,
+65535,
+2988,
+65535,
+65535,
+65535,
+65535,
+2130,
+3052,
+1315,
+2813,
+65535,
+65535,
+301,
+2208,
+3064,
+65535,
+65535,
+65535,
+2385,
+2479,
+65535,
+4097,
+65535,
+65535,
+3235,
+1751,
+65535,
+65535,
+65535,
+65535,
+65535,
+2869,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1230,
+65535,
+65535,
+2626,
+1722,
+1132,
+468,
+65535,
+407,
+65535,
+65535,
+65535,
+1990,
+1322,
+3026,
+65535,
+65535,
+65535,
+456,
+65535,
+3575,
+65535,
+65535,
+65535,
+2024,
+548,
+65535,
+1472,
+1542,
+65535,
+65535,
+65535,
+678,
+60,
+2466,
+65535,
+2738,
+2755,
+226,
+65535,
+65535,
+2439,
+65535,
+2246,
+1625,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2092,
+1792,
+537,
+712,
+65535,
+140,
+1350,
+65535,
+65535,
+65535,
+65535,
+744,
+392,
+65535,
+65535,
+65535,
+4000,
+65535,
+65535,
+1063,
+2401,
+65535,
+2889,
+2522,
+65535,
+65535,
+773,
+65535,
+1864,
+65535,
+50,
+3539,
+65535,
+65535,
+1348,
+65535,
+564,
+3548,
+3249,
+65535,
+65535,
+2493,
+1917,
+173,
+2971,
+3791,
+1529,
+1045,
+65535,
+2333,
+65535,
+65535,
+65535,
+1981,
+1174,
+4107,
+588,
+815,
+65535,
+65535,
+65535,
+65535,
+65535,
+2701,
+65535,
+65535,
+65535,
+1712,
+2990,
+2501,
+2629,
+3049,
+1692,
+3781,
+65535,
+65535,
+65535,
+1763,
+65535,
+65535,
+2378,
+3689,
+65535,
+65535,
+540,
+65535,
+3862,
+65535,
+65535,
+2325,
+3434,
+65535,
+65535,
+1297,
+3313,
+65535,
+1601,
+2801,
+65535,
+65535,
+373,
+1843,
+3614,
+3965,
+65535,
+65535,
+65535,
+3375,
+65535,
+65535,
+65535,
+788,
+65535,
+65535,
+2276,
+65535,
+65535,
+65535,
+2067,
+1159,
+65535,
+65535,
+65535,
+4012,
+65535,
+65535,
+2348,
+65535,
+65535,
+65535,
+1190,
+65535,
+2905,
+65535,
+65535,
+1452,
+65535,
+65535,
+65535,
+65535,
+2605,
+65535,
+2858,
+65535,
+3367,
+3633,
+65535,
+65535,
+1830,
+65535,
+65535,
+65535,
+65535,
+3048,
+65535,
+65535,
+3857,
+1055,
+3345,
+65535,
+2374,
+65535,
+3523,
+65535,
+65535,
+1218,
+1711,
+2904,
+65535,
+2428,
+65535,
+3708,
+2906,
+1566,
+65535,
+65535,
+65535,
+3993,
+1033,
+3564,
+65535,
+3641,
+65535,
+65535,
+65535,
+65535,
+3540,
+3233,
+65535,
+65535,
+3269,
+65535,
+2167,
+3264,
+65535,
+65535,
+3208,
+583,
+552,
+2440,
+65535,
+1331,
+2982,
+3572,
+65535,
+65535,
+65535,
+65535,
+911,
+65535,
+65535,
+4013,
+65535,
+2433,
+1229,
+65535,
+1630,
+1004,
+65535,
+65535,
+65535,
+118,
+65535,
+976,
+1133,
+65535,
+65535,
+65535,
+65535,
+65535,
+736,
+1213,
+1970,
+3466,
+65535,
+805,
+2932,
+2111,
+65535,
+65535,
+1849,
+24,
+1089,
+1879,
+65535,
+65535,
+65535,
+2657,
+697,
+2152,
+65535,
+65535,
+65535,
+65535,
+1327,
+2977,
+65535,
+3356,
+1994,
+775,
+65535,
+65535,
+3271,
+1357,
+46,
+65535,
+65535,
+65535,
+3758,
+2780,
+3222,
+1223,
+65535,
+2399,
+3977,
+65535,
+65535,
+65535,
+1075,
+1463,
+65535,
+766,
+65535,
+2187,
+65535,
+1682,
+1761,
+3303,
+1702,
+65535,
+2197,
+2114,
+3974,
+2610,
+65535,
+171,
+1233,
+214,
+65535,
+3145,
+120,
+65535,
+742,
+614,
+2018,
+555,
+65535,
+2472,
+1997,
+65535,
+65535,
+3933,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3250,
+2060,
+1299,
+731,
+1220,
+1262,
+65535,
+1854,
+65535,
+65535,
+3268,
+65535,
+1823,
+65535,
+4045,
+1118,
+65535,
+65535,
+2922,
+65535,
+65535,
+1054,
+65535,
+934,
+65535,
+1011,
+65535,
+65535,
+65535,
+65535,
+838,
+65535,
+2164,
+2621,
+65535,
+3873,
+65535,
+2180,
+65535,
+331,
+3730,
+65535,
+65535,
+1982,
+1366,
+2872,
+65535,
+65535,
+65535,
+4066,
+3380,
+2139,
+2289,
+795,
+1335,
+65535,
+65535,
+3561,
+2998,
+65535,
+65535,
+65535,
+2436,
+298,
+65535,
+65535,
+3131,
+1491,
+65535,
+639,
+598,
+831,
+65535,
+2313,
+65535,
+3950,
+65535,
+65535,
+65535,
+65535,
+2857,
+1456,
+3183,
+2573,
+191,
+65535,
+643,
+65535,
+1378,
+65535,
+3557,
+696,
+65535,
+3475,
+3943,
+65535,
+65535,
+3025,
+3903,
+65535,
+4024,
+65535,
+65535,
+2025,
+3403,
+1422,
+65535,
+65535,
+65535,
+65535,
+65535,
+4044,
+65535,
+65535,
+65535,
+209,
+65535,
+65535,
+3577,
+65535,
+3841,
+65535,
+65535,
+3792,
+945,
+65535,
+865,
+65535,
+3034,
+65535,
+1774,
+65535,
+65535,
+65535,
+65535,
+1798,
+502,
+895,
+65535,
+1819,
+65535,
+65535,
+3462,
+65535,
+65535,
+2527,
+2039,
+4053,
+1661,
+2254,
+821,
+2070,
+65535,
+65535,
+65535,
+2914,
+1396,
+65535,
+65535,
+374,
+2564,
+65535,
+65535,
+65535,
+2735,
+2672,
+1444,
+1543,
+65535,
+65535,
+2027,
+3754,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1927,
+65535,
+65535,
+2495,
+1586,
+65535,
+65535,
+3148,
+65535,
+3959,
+1347,
+3078,
+3257,
+65535,
+264,
+1172,
+65535,
+4094,
+628,
+65535,
+3590,
+2907,
+885,
+65535,
+362,
+65535,
+3084,
+1104,
+4010,
+65535,
+65535,
+3284,
+65535,
+1644,
+65535,
+3542,
+65535,
+1713,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3234,
+65535,
+3872,
+3712,
+65535,
+2746,
+2747,
+28,
+2620,
+2338,
+3621,
+31,
+3006,
+4091,
+65535,
+65535,
+65535,
+2353,
+3524,
+507,
+65535,
+3828,
+55,
+2337,
+65535,
+65535,
+65535,
+65535,
+65535,
+2059,
+65535,
+65535,
+3634,
+2650,
+3878,
+3532,
+509,
+3366,
+65535,
+177,
+65535,
+1475,
+3543,
+3493,
+65535,
+65535,
+65535,
+65535,
+511,
+65535,
+3129,
+65535,
+2664,
+65535,
+3946,
+2271,
+65535,
+433,
+65535,
+1779,
+65535,
+65535,
+65535,
+65535,
+330,
+65535,
+3797,
+3141,
+2071,
+65535,
+1544,
+65535,
+3733,
+110,
+3655,
+2688,
+65535,
+65535,
+65535,
+2360,
+924,
+1537,
+1286,
+65535,
+65535,
+65535,
+65535,
+65535,
+38,
+1873,
+971,
+3949,
+65535,
+65535,
+4135,
+1986,
+2671,
+65535,
+65535,
+65535,
+65535,
+65535,
+2519,
+1521,
+65535,
+65535,
+65535,
+2964,
+3735,
+231,
+65535,
+65535,
+65535,
+2127,
+2962,
+2595,
+1206,
+3615,
+1845,
+3389,
+65535,
+65535,
+1175,
+313,
+2418,
+1590,
+65535,
+3672,
+65535,
+1987,
+65535,
+65535,
+65535,
+446,
+3323,
+2488,
+65535,
+1976,
+65535,
+65535,
+65535,
+65535,
+1547,
+1895,
+3209,
+65535,
+65535,
+1436,
+65535,
+65535,
+65535,
+65535,
+65535,
+1323,
+290,
+1746,
+65535,
+1292,
+65535,
+1169,
+65535,
+199,
+2277,
+3068,
+65535,
+2989,
+65535,
+65535,
+65535,
+94,
+65535,
+65535,
+1261,
+65535,
+65535,
+65535,
+1409,
+65535,
+3658,
+65535,
+1013,
+259,
+2925,
+65535,
+2802,
+2778,
+3611,
+1489,
+65535,
+65535,
+1486,
+65535,
+65535,
+752,
+65535,
+65535,
+3326,
+65535,
+65535,
+1575,
+65535,
+2850,
+3154,
+65535,
+65535,
+65535,
+876,
+1181,
+65535,
+65535,
+65535,
+2686,
+65535,
+3471,
+65535,
+65535,
+65535,
+195,
+1351,
+501,
+899,
+65535,
+680,
+2077,
+65535,
+2731,
+65535,
+65535,
+65535,
+112,
+65535,
+65535,
+65535,
+65535,
+615,
+2266,
+943,
+65535,
+1753,
+2430,
+65535,
+1153,
+65535,
+224,
+65535,
+3285,
+65535,
+65535,
+2358,
+3075,
+1569,
+2948,
+65535,
+2311,
+1402,
+65535,
+1977,
+782,
+65535,
+3842,
+80,
+65535,
+4117,
+65535,
+626,
+65535,
+1773,
+3796,
+65535,
+3277,
+1097,
+733,
+65535,
+948,
+3137,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2868,
+1495,
+65535,
+3266,
+65535,
+760,
+65535,
+65535,
+65535,
+1257,
+65535,
+1170,
+65535,
+2711,
+1288,
+723,
+65535,
+65535,
+65535,
+65535,
+56,
+65535,
+1562,
+839,
+65535,
+2559,
+65535,
+3017,
+65535,
+65535,
+2420,
+3018,
+65535,
+180,
+65535,
+1086,
+1696,
+65535,
+2485,
+2898,
+82,
+4043,
+65535,
+65535,
+2326,
+706,
+586,
+65535,
+218,
+2768,
+381,
+3984,
+1353,
+4126,
+1780,
+2272,
+65535,
+2866,
+65535,
+1127,
+65535,
+3070,
+65535,
+65535,
+65535,
+2042,
+687,
+65535,
+404,
+3865,
+65535,
+499,
+65535,
+3920,
+2509,
+2087,
+1812,
+3506,
+65535,
+3178,
+479,
+65535,
+3787,
+1965,
+1596,
+65535,
+65535,
+1065,
+65535,
+65535,
+3198,
+175,
+65535,
+2172,
+2260,
+65535,
+65535,
+65535,
+65535,
+3698,
+66,
+76,
+65535,
+1676,
+3433,
+1664,
+2628,
+2365,
+65535,
+65535,
+4138,
+3715,
+65535,
+3100,
+342,
+65535,
+65535,
+65535,
+898,
+65535,
+65535,
+412,
+65535,
+2247,
+2307,
+65535,
+9,
+975,
+65535,
+65535,
+65535,
+2435,
+3278,
+65535,
+2116,
+1392,
+65535,
+65535,
+1890,
+3643,
+65535,
+835,
+65535,
+65535,
+65535,
+65535,
+1507,
+65535,
+65535,
+65535,
+65535,
+65535,
+1901,
+2422,
+1443,
+65535,
+1280,
+3391,
+1531,
+2604,
+322,
+65535,
+65535,
+65535,
+3702,
+3866,
+778,
+763,
+65535,
+204,
+65535,
+65535,
+65535,
+65535,
+253,
+65535,
+3684,
+165,
+866,
+65535,
+65535,
+65535,
+65535,
+1572,
+3732,
+65535,
+1397,
+1899,
+3929,
+65535,
+65535,
+401,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3937,
+65535,
+4001,
+107,
+65535,
+65535,
+65535,
+65535,
+2837,
+618,
+1361,
+65535,
+65535,
+65535,
+3889,
+1345,
+65535,
+65535,
+1231,
+3745,
+65535,
+1400,
+1371,
+365,
+65535,
+65535,
+3736,
+65535,
+2291,
+2533,
+1887,
+1729,
+2221,
+2598,
+2125,
+65535,
+65535,
+3063,
+65535,
+399,
+3297,
+65535,
+65535,
+2128,
+65535,
+1804,
+1420,
+2368,
+65535,
+65535,
+1363,
+65535,
+65535,
+65535,
+65535,
+3259,
+2223,
+65535,
+65535,
+65535,
+65535,
+65535,
+3850,
+3226,
+200,
+65535,
+65535,
+65535,
+65535,
+592,
+65535,
+2095,
+475,
+1064,
+65535,
+65535,
+2754,
+65535,
+65535,
+2061,
+65535,
+1832,
+65535,
+249,
+65535,
+1442,
+1776,
+65535,
+65535,
+3399,
+3351,
+65535,
+1778,
+65535,
+2843,
+65535,
+65535,
+3349,
+4082,
+65535,
+65535,
+2415,
+1445,
+3041,
+3368,
+994,
+65535,
+2560,
+65535,
+2895,
+1429,
+1388,
+1638,
+2037,
+2566,
+3166,
+3538,
+833,
+65535,
+2339,
+1411,
+1870,
+65535,
+1969,
+65535,
+65535,
+2965,
+65535,
+65535,
+845,
+65535,
+65535,
+472,
+2020,
+65535,
+3081,
+65535,
+952,
+65535,
+65535,
+65535,
+2421,
+65535,
+65535,
+65535,
+135,
+65535,
+65535,
+65535,
+65535,
+316,
+1504,
+65535,
+65535,
+661,
+3734,
+65535,
+65535,
+65535,
+65535,
+3737,
+65535,
+65535,
+684,
+65535,
+1112,
+3746,
+65535,
+65535,
+3481,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1861,
+65535,
+4056,
+2267,
+65535,
+65535,
+1328,
+65535,
+65535,
+81,
+65535,
+2856,
+65535,
+65535,
+1631,
+65535,
+2,
+65535,
+3126,
+545,
+784,
+65535,
+65535,
+1948,
+65535,
+65535,
+65535,
+4069,
+1277,
+65535,
+2545,
+1437,
+65535,
+3210,
+65535,
+65535,
+65535,
+868,
+1330,
+65535,
+3114,
+447,
+467,
+3261,
+65535,
+65535,
+2798,
+3886,
+65535,
+65535,
+1088,
+2902,
+1999,
+1974,
+2469,
+65535,
+65535,
+65535,
+581,
+2640,
+65535,
+65535,
+3329,
+65535,
+65535,
+65535,
+65535,
+65535,
+3629,
+1091,
+65535,
+65535,
+65535,
+2864,
+4018,
+65535,
+65535,
+65535,
+65535,
+65535,
+713,
+65535,
+1094,
+3397,
+65535,
+1940,
+65535,
+65535,
+65535,
+65535,
+1886,
+65535,
+65535,
+3358,
+65535,
+65535,
+1417,
+65535,
+65535,
+2434,
+65535,
+1479,
+2767,
+2548,
+4133,
+65535,
+65535,
+65535,
+1966,
+4068,
+65535,
+748,
+3046,
+423,
+3678,
+65535,
+65535,
+65535,
+3404,
+1502,
+65535,
+65535,
+65535,
+65535,
+65535,
+32,
+2383,
+587,
+65535,
+3831,
+704,
+966,
+2699,
+1767,
+347,
+3024,
+65535,
+23,
+65535,
+65535,
+65535,
+65535,
+2772,
+2773,
+2816,
+2635,
+65535,
+65535,
+449,
+65535,
+65535,
+1458,
+65535,
+65535,
+1769,
+65535,
+1884,
+65535,
+3374,
+337,
+1226,
+65535,
+65535,
+65535,
+419,
+65535,
+65535,
+1425,
+65535,
+3251,
+65535,
+65535,
+65535,
+65535,
+65535,
+3948,
+65535,
+65535,
+65535,
+65535,
+3693,
+65535,
+65535,
+3652,
+65535,
+65535,
+65535,
+380,
+1766,
+65535,
+65535,
+65535,
+65535,
+83,
+371,
+65535,
+65535,
+2303,
+2038,
+2984,
+531,
+65535,
+2599,
+624,
+314,
+3482,
+3656,
+2088,
+151,
+65535,
+65535,
+1260,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3334,
+65535,
+65535,
+4011,
+65535,
+65535,
+621,
+65535,
+1608,
+1563,
+65535,
+2876,
+1951,
+65535,
+1827,
+65535,
+65535,
+65535,
+2118,
+65535,
+65535,
+1294,
+65535,
+699,
+65535,
+65535,
+65535,
+65535,
+179,
+3934,
+65535,
+65535,
+3699,
+2753,
+1602,
+65535,
+3390,
+65535,
+737,
+1923,
+65535,
+65535,
+765,
+1825,
+65535,
+4079,
+65535,
+1741,
+65535,
+65535,
+808,
+65535,
+65535,
+2103,
+2206,
+65535,
+682,
+3803,
+1935,
+65535,
+285,
+65535,
+65535,
+2821,
+1627,
+65535,
+3843,
+3536,
+1740,
+3985,
+3016,
+3527,
+65535,
+4031,
+65535,
+1949,
+65535,
+65535,
+3120,
+281,
+157,
+65535,
+662,
+65535,
+65535,
+65535,
+65535,
+2952,
+240,
+65535,
+3385,
+3469,
+65535,
+65535,
+65535,
+2745,
+3474,
+549,
+65535,
+4115,
+65535,
+3771,
+65535,
+65535,
+1182,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2649,
+3648,
+65535,
+3753,
+65535,
+258,
+2521,
+65535,
+3162,
+65535,
+357,
+65535,
+336,
+3134,
+65535,
+3111,
+65535,
+65535,
+2110,
+65535,
+65535,
+65535,
+3136,
+149,
+65535,
+3353,
+3372,
+1470,
+640,
+202,
+1264,
+3537,
+1032,
+65535,
+1166,
+3769,
+514,
+65535,
+65535,
+3181,
+1579,
+789,
+65535,
+65535,
+1120,
+1833,
+65535,
+65535,
+3778,
+1967,
+65535,
+65535,
+65535,
+2624,
+65535,
+65535,
+3986,
+65535,
+65535,
+65535,
+65535,
+65535,
+2881,
+585,
+65535,
+406,
+1224,
+65535,
+3855,
+2847,
+2739,
+1135,
+65535,
+65535,
+65535,
+3291,
+65535,
+65535,
+698,
+100,
+2947,
+1282,
+65535,
+1671,
+2486,
+65535,
+2341,
+3939,
+3885,
+2492,
+59,
+65535,
+65535,
+1897,
+65535,
+3219,
+65535,
+1789,
+529,
+2013,
+65535,
+65535,
+65535,
+85,
+183,
+65535,
+65535,
+65535,
+65535,
+3887,
+65535,
+491,
+2168,
+65535,
+597,
+2222,
+798,
+2692,
+2632,
+492,
+65535,
+2807,
+65535,
+65535,
+2917,
+1709,
+65535,
+3864,
+1464,
+65535,
+3549,
+65535,
+3618,
+65535,
+1242,
+65535,
+3202,
+518,
+3773,
+769,
+65535,
+65535,
+65535,
+596,
+65535,
+1364,
+429,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+4121,
+1451,
+65535,
+65535,
+3091,
+65535,
+2520,
+65535,
+816,
+1945,
+3856,
+65535,
+422,
+65535,
+1623,
+65535,
+65535,
+65535,
+119,
+3160,
+783,
+65535,
+65535,
+65535,
+1061,
+164,
+65535,
+65535,
+1023,
+65535,
+234,
+2137,
+593,
+272,
+1043,
+65535,
+329,
+1202,
+65535,
+1794,
+2411,
+3804,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3228,
+65535,
+1802,
+65535,
+65535,
+2367,
+65535,
+1803,
+65535,
+319,
+3135,
+2126,
+65535,
+935,
+65535,
+65535,
+3682,
+65535,
+1583,
+65535,
+65535,
+1006,
+65535,
+2412,
+2693,
+546,
+65535,
+65535,
+2033,
+65535,
+65535,
+1866,
+473,
+65535,
+2195,
+606,
+65535,
+65535,
+65535,
+3923,
+65535,
+1624,
+607,
+65535,
+739,
+1785,
+1098,
+65535,
+65535,
+65535,
+70,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+749,
+65535,
+3533,
+65535,
+3800,
+65535,
+65535,
+3301,
+65535,
+65535,
+3076,
+65535,
+65535,
+65535,
+65535,
+3906,
+2320,
+65535,
+4015,
+65535,
+2585,
+65535,
+2955,
+1022,
+90,
+65535,
+3644,
+3562,
+2697,
+65535,
+65535,
+2526,
+65535,
+3858,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1606,
+3571,
+2474,
+2921,
+896,
+65535,
+4027,
+3823,
+65535,
+155,
+65535,
+1637,
+1382,
+2219,
+382,
+65535,
+2728,
+65535,
+2381,
+65535,
+65535,
+3580,
+1116,
+65535,
+3528,
+2321,
+65535,
+65535,
+2062,
+645,
+3904,
+3255,
+65535,
+776,
+65535,
+1912,
+65535,
+65535,
+65535,
+65535,
+65535,
+500,
+1535,
+65535,
+2706,
+65535,
+65535,
+3218,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+361,
+2694,
+65535,
+65535,
+1244,
+477,
+4102,
+65535,
+65535,
+288,
+65535,
+65535,
+3619,
+3495,
+65535,
+93,
+3725,
+65535,
+65535,
+889,
+65535,
+1179,
+65535,
+170,
+3628,
+65535,
+65535,
+3845,
+3531,
+3447,
+4032,
+350,
+3961,
+1538,
+65535,
+2882,
+65535,
+65535,
+1926,
+4002,
+2398,
+4114,
+923,
+65535,
+4090,
+65535,
+3852,
+65535,
+2171,
+242,
+65535,
+65535,
+1772,
+2862,
+65535,
+65535,
+65535,
+65535,
+3074,
+2873,
+65535,
+65535,
+65535,
+65535,
+861,
+65535,
+65535,
+559,
+2661,
+65535,
+65535,
+3344,
+65535,
+3088,
+3410,
+65535,
+1551,
+65535,
+2973,
+3321,
+4005,
+1017,
+65535,
+65535,
+714,
+65535,
+1728,
+2618,
+2194,
+2535,
+3248,
+741,
+65535,
+65535,
+168,
+65535,
+65535,
+560,
+4119,
+1358,
+3308,
+65535,
+65535,
+1952,
+1892,
+65535,
+65535,
+372,
+65535,
+2797,
+65535,
+65535,
+65535,
+897,
+65535,
+396,
+2438,
+3529,
+3331,
+65535,
+4035,
+2547,
+65535,
+65535,
+65535,
+3514,
+4131,
+1874,
+3014,
+65535,
+3312,
+65535,
+65535,
+4084,
+65535,
+3221,
+3299,
+2453,
+261,
+172,
+671,
+65535,
+2631,
+2302,
+1377,
+65535,
+3851,
+4100,
+2356,
+65535,
+208,
+65535,
+210,
+65535,
+3573,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3392,
+305,
+65535,
+65535,
+69,
+65535,
+65535,
+65535,
+761,
+65535,
+65535,
+3683,
+65535,
+65535,
+3720,
+8,
+2800,
+1674,
+3966,
+65535,
+65535,
+3309,
+418,
+65535,
+65535,
+582,
+65535,
+65535,
+65535,
+1042,
+65535,
+286,
+2142,
+65535,
+65535,
+1113,
+2402,
+65535,
+2561,
+65535,
+3935,
+65535,
+2473,
+2937,
+145,
+2496,
+1305,
+65535,
+65535,
+469,
+3809,
+65535,
+474,
+3186,
+65535,
+65535,
+4039,
+65535,
+2459,
+2032,
+65535,
+65535,
+2645,
+3196,
+65535,
+65535,
+3393,
+3489,
+268,
+246,
+134,
+65535,
+2274,
+2765,
+3515,
+65535,
+65535,
+387,
+3594,
+963,
+2022,
+4062,
+65535,
+4007,
+1549,
+3000,
+65535,
+65535,
+2551,
+65535,
+3661,
+65535,
+807,
+2901,
+65535,
+65535,
+2035,
+3670,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1131,
+65535,
+65535,
+561,
+65535,
+65535,
+65535,
+236,
+1325,
+3412,
+65535,
+65535,
+2410,
+1468,
+2523,
+753,
+65535,
+3019,
+65535,
+3979,
+4071,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1587,
+1311,
+65535,
+65535,
+2597,
+65535,
+1522,
+65535,
+65535,
+65535,
+3620,
+65535,
+61,
+65535,
+65535,
+634,
+65535,
+65535,
+65535,
+544,
+3569,
+65535,
+1139,
+1856,
+65535,
+1904,
+3040,
+1734,
+1415,
+3825,
+891,
+65535,
+65535,
+1068,
+65535,
+326,
+65535,
+65535,
+65535,
+2487,
+65535,
+65535,
+65535,
+424,
+2945,
+87,
+65535,
+1911,
+65535,
+65535,
+1908,
+1204,
+2634,
+985,
+2414,
+3616,
+65535,
+2828,
+65535,
+65535,
+65535,
+2997,
+65535,
+65535,
+65535,
+65535,
+920,
+1469,
+65535,
+65535,
+65535,
+65535,
+3009,
+3957,
+3287,
+65535,
+65535,
+65535,
+65535,
+65535,
+244,
+65535,
+65535,
+3776,
+480,
+65535,
+4088,
+65535,
+138,
+65535,
+65535,
+3283,
+1207,
+65535,
+1365,
+65535,
+65535,
+227,
+2007,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3617,
+65535,
+3421,
+2725,
+2603,
+495,
+65535,
+65535,
+1959,
+65535,
+65535,
+65535,
+65535,
+178,
+3992,
+2724,
+65535,
+65535,
+2942,
+1048,
+215,
+65535,
+65535,
+65535,
+1805,
+4078,
+3780,
+65535,
+2782,
+2375,
+576,
+1109,
+65535,
+4127,
+1736,
+2827,
+1732,
+65535,
+65535,
+2113,
+2160,
+3555,
+397,
+2146,
+65535,
+3347,
+882,
+413,
+1972,
+65535,
+3013,
+65535,
+65535,
+65535,
+65535,
+457,
+65535,
+65535,
+65535,
+65535,
+3437,
+65535,
+2239,
+65535,
+2136,
+756,
+65535,
+542,
+3124,
+97,
+2369,
+2662,
+3503,
+65535,
+65535,
+2893,
+65535,
+65535,
+2848,
+65535,
+65535,
+65535,
+3511,
+65535,
+65535,
+355,
+1723,
+1831,
+3805,
+65535,
+3558,
+3813,
+1984,
+658,
+65535,
+1871,
+937,
+65535,
+755,
+2860,
+65535,
+1632,
+65535,
+65535,
+74,
+65535,
+370,
+855,
+65535,
+65535,
+65535,
+914,
+65535,
+2553,
+2969,
+65535,
+880,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1143,
+65535,
+1808,
+2193,
+65535,
+65535,
+460,
+1093,
+569,
+65535,
+3082,
+65535,
+2673,
+928,
+3494,
+1251,
+1368,
+65535,
+207,
+1609,
+65535,
+65535,
+65535,
+3022,
+65535,
+65535,
+2804,
+65535,
+3316,
+3913,
+65535,
+3969,
+3108,
+947,
+3881,
+65535,
+65535,
+65535,
+1673,
+65535,
+65535,
+1916,
+65535,
+65535,
+2586,
+65535,
+65535,
+65535,
+3419,
+3895,
+65535,
+65535,
+65535,
+5,
+3317,
+65535,
+1234,
+65535,
+2761,
+465,
+3834,
+1372,
+65535,
+2568,
+65535,
+194,
+747,
+65535,
+3492,
+65535,
+751,
+65535,
+65535,
+3605,
+65535,
+53,
+3355,
+65535,
+633,
+867,
+2178,
+65535,
+65535,
+1621,
+3039,
+1414,
+65535,
+65535,
+2482,
+1036,
+1824,
+65535,
+65535,
+65535,
+1193,
+1568,
+65535,
+2349,
+65535,
+65535,
+762,
+1427,
+4061,
+65535,
+65535,
+98,
+829,
+65535,
+65535,
+989,
+1073,
+2315,
+3822,
+2112,
+2622,
+323,
+65535,
+2781,
+65535,
+65535,
+3021,
+65535,
+848,
+2865,
+65535,
+3585,
+388,
+3427,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1850,
+3371,
+791,
+1501,
+2730,
+983,
+65535,
+65535,
+65535,
+65535,
+65535,
+851,
+2674,
+2452,
+65535,
+65535,
+65535,
+1259,
+2770,
+65535,
+65535,
+4067,
+65535,
+65535,
+2859,
+65535,
+2829,
+65535,
+627,
+65535,
+65535,
+65535,
+1158,
+254,
+2318,
+2217,
+3110,
+65535,
+1115,
+3369,
+65535,
+65535,
+1471,
+65535,
+2023,
+0,
+1639,
+825,
+2653,
+2450,
+3662,
+111,
+814,
+2255,
+2226,
+312,
+3749,
+65535,
+705,
+65535,
+1991,
+65535,
+65535,
+65535,
+1893,
+65535,
+65535,
+3553,
+2532,
+1185,
+439,
+65535,
+141,
+65535,
+65535,
+65535,
+603,
+2636,
+764,
+1256,
+1925,
+65535,
+3212,
+65535,
+211,
+1561,
+1534,
+65535,
+65535,
+65535,
+65535,
+2909,
+725,
+65535,
+1503,
+3525,
+65535,
+65535,
+1517,
+65535,
+65535,
+65535,
+2224,
+65535,
+65535,
+4120,
+65535,
+65535,
+65535,
+65535,
+65535,
+2153,
+65535,
+3907,
+65535,
+65535,
+65535,
+65535,
+65535,
+3996,
+65535,
+65535,
+235,
+65535,
+256,
+65535,
+1594,
+486,
+65535,
+3216,
+1752,
+1457,
+1888,
+65535,
+3840,
+65535,
+65535,
+1919,
+3650,
+1690,
+65535,
+65535,
+65535,
+3846,
+2344,
+2249,
+1733,
+431,
+1727,
+2377,
+3408,
+1720,
+65535,
+2031,
+65535,
+1412,
+65535,
+2643,
+2655,
+65535,
+3023,
+65535,
+3566,
+1865,
+92,
+65535,
+65535,
+57,
+65535,
+65535,
+2463,
+2769,
+65535,
+2002,
+2258,
+65535,
+1163,
+65535,
+1607,
+65535,
+65535,
+1150,
+1979,
+2099,
+3227,
+2790,
+65535,
+3097,
+65535,
+2669,
+3239,
+65535,
+65535,
+65535,
+321,
+2145,
+2717,
+65535,
+1249,
+65535,
+3401,
+4003,
+3894,
+65535,
+65535,
+1968,
+1018,
+1815,
+65535,
+1275,
+65535,
+2115,
+65535,
+65535,
+65535,
+65535,
+65535,
+1241,
+65535,
+65535,
+2515,
+3518,
+1404,
+1359,
+2842,
+3981,
+65535,
+65535,
+1049,
+1039,
+1667,
+2392,
+65535,
+2053,
+4129,
+3378,
+65535,
+1669,
+1428,
+65535,
+4,
+3607,
+65535,
+65535,
+2174,
+2999,
+1937,
+65535,
+2234,
+2251,
+65535,
+65535,
+3176,
+1648,
+65535,
+2296,
+65535,
+2966,
+4048,
+65535,
+520,
+636,
+65535,
+2269,
+3854,
+4063,
+65535,
+1754,
+65535,
+65535,
+415,
+2449,
+65535,
+3777,
+527,
+65535,
+1228,
+65535,
+233,
+3807,
+1186,
+2646,
+65535,
+65535,
+65535,
+65535,
+1197,
+65535,
+3680,
+65535,
+939,
+65535,
+2789,
+65535,
+442,
+65535,
+1716,
+3004,
+3871,
+3883,
+65535,
+65535,
+2041,
+470,
+3816,
+65535,
+2960,
+4130,
+4099,
+2720,
+65535,
+65535,
+228,
+2083,
+65535,
+1301,
+1136,
+535,
+65535,
+65535,
+65535,
+3042,
+65535,
+65535,
+65535,
+1820,
+65535,
+65535,
+65535,
+1168,
+694,
+2287,
+3254,
+2946,
+2273,
+3811,
+65535,
+65535,
+1346,
+65535,
+2003,
+65535,
+65535,
+65535,
+65535,
+65535,
+1034,
+2306,
+3982,
+65535,
+2963,
+65535,
+2210,
+1326,
+455,
+3113,
+2854,
+3967,
+3958,
+271,
+722,
+65535,
+1672,
+65535,
+2074,
+280,
+65535,
+619,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3192,
+930,
+3423,
+17,
+65535,
+1352,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2712,
+1998,
+65535,
+65535,
+65535,
+1980,
+2589,
+65535,
+3839,
+3743,
+65535,
+4110,
+65535,
+65535,
+3997,
+428,
+1913,
+3738,
+65535,
+65535,
+2324,
+65535,
+65535,
+2181,
+65535,
+65535,
+65535,
+65535,
+65535,
+925,
+3688,
+65535,
+65535,
+65535,
+65535,
+870,
+3336,
+1559,
+3386,
+65535,
+65535,
+65535,
+65535,
+65535,
+346,
+65535,
+65535,
+4041,
+2064,
+65535,
+2335,
+1530,
+3591,
+65535,
+65535,
+3586,
+65535,
+65535,
+992,
+2810,
+65535,
+65535,
+3544,
+3225,
+65535,
+3083,
+65535,
+3956,
+65535,
+65535,
+1027,
+2613,
+65535,
+65535,
+65535,
+2186,
+2229,
+65535,
+65535,
+1217,
+3519,
+65535,
+65535,
+2419,
+65535,
+65535,
+1708,
+65535,
+3118,
+65535,
+65535,
+1909,
+1508,
+2477,
+65535,
+3606,
+65535,
+1862,
+3116,
+65535,
+65535,
+65535,
+3584,
+2072,
+1896,
+3714,
+1993,
+65535,
+1660,
+3445,
+3398,
+10,
+65535,
+325,
+65535,
+3058,
+65535,
+3416,
+65535,
+3232,
+124,
+2587,
+65535,
+402,
+2721,
+1435,
+65535,
+65535,
+65535,
+1975,
+65535,
+65535,
+1438,
+65535,
+1269,
+573,
+389,
+65535,
+65535,
+2504,
+1715,
+65535,
+65535,
+3654,
+65535,
+1719,
+65535,
+250,
+65535,
+65535,
+65535,
+65535,
+65535,
+3295,
+2048,
+2093,
+65535,
+65535,
+4006,
+65535,
+65535,
+65535,
+1519,
+654,
+65535,
+65535,
+936,
+65535,
+926,
+65535,
+65535,
+65535,
+3898,
+3341,
+2141,
+65535,
+1255,
+65535,
+2380,
+65535,
+65535,
+1533,
+245,
+3879,
+65535,
+65535,
+3695,
+740,
+65535,
+2513,
+2556,
+65535,
+65535,
+3978,
+732,
+4058,
+65535,
+65535,
+65535,
+65535,
+2931,
+65535,
+2408,
+65535,
+2173,
+2809,
+65535,
+65535,
+65535,
+65535,
+65535,
+2546,
+3657,
+65535,
+3359,
+65535,
+65535,
+3289,
+65535,
+4085,
+126,
+950,
+65535,
+65535,
+65535,
+368,
+523,
+65535,
+65535,
+65535,
+2051,
+65535,
+65535,
+1947,
+63,
+230,
+65535,
+2286,
+1511,
+3944,
+563,
+65535,
+3744,
+3593,
+3645,
+65535,
+65535,
+3468,
+2557,
+65535,
+65535,
+3837,
+65535,
+65535,
+852,
+65535,
+65535,
+2212,
+65535,
+65535,
+65535,
+65535,
+2871,
+1844,
+65535,
+65535,
+2299,
+3337,
+1053,
+1574,
+311,
+65535,
+65535,
+65535,
+1035,
+2056,
+1699,
+2397,
+2117,
+3504,
+65535,
+65535,
+65535,
+3759,
+2204,
+65535,
+65535,
+3223,
+65535,
+65535,
+462,
+2608,
+2593,
+1070,
+65535,
+1290,
+1867,
+65535,
+2822,
+2448,
+65535,
+65535,
+512,
+65535,
+1731,
+942,
+2713,
+65535,
+3880,
+1633,
+65535,
+65535,
+65535,
+2133,
+65535,
+65535,
+3244,
+2334,
+435,
+420,
+601,
+1932,
+2257,
+1306,
+65535,
+1685,
+1915,
+65535,
+65535,
+2283,
+2201,
+65535,
+1885,
+1500,
+3384,
+667,
+65535,
+65535,
+65535,
+3635,
+3037,
+65535,
+65535,
+664,
+2104,
+2124,
+65535,
+1126,
+617,
+779,
+758,
+65535,
+65535,
+65535,
+65535,
+1087,
+65535,
+3476,
+65535,
+65535,
+2572,
+65535,
+65535,
+65535,
+4103,
+3002,
+65535,
+65535,
+65535,
+65535,
+1028,
+886,
+405,
+65535,
+1019,
+3420,
+2890,
+65535,
+4008,
+3224,
+1931,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2176,
+1659,
+65535,
+65535,
+65535,
+1691,
+65535,
+1938,
+767,
+114,
+65535,
+1480,
+65535,
+65535,
+1593,
+1096,
+65535,
+3138,
+584,
+65535,
+65535,
+1863,
+3188,
+1817,
+1784,
+65535,
+1851,
+65535,
+4004,
+2875,
+65535,
+3104,
+3496,
+65535,
+65535,
+1243,
+65535,
+65535,
+65535,
+65535,
+48,
+2098,
+306,
+65535,
+2036,
+1492,
+65535,
+216,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1015,
+1600,
+2974,
+65535,
+65535,
+2069,
+65535,
+3322,
+819,
+65535,
+1687,
+1735,
+65535,
+2456,
+3595,
+2045,
+65535,
+1369,
+65535,
+2044,
+2225,
+2742,
+3915,
+65535,
+65535,
+65535,
+3446,
+2815,
+801,
+1356,
+354,
+65535,
+3073,
+3133,
+65535,
+65535,
+133,
+65535,
+1814,
+2783,
+3325,
+65535,
+65535,
+65535,
+2531,
+65535,
+1646,
+3799,
+65535,
+65535,
+65535,
+3477,
+65535,
+65535,
+65535,
+65535,
+65535,
+1620,
+4136,
+65535,
+65535,
+3703,
+4095,
+65535,
+65535,
+65535,
+3324,
+65535,
+65535,
+1389,
+65535,
+65535,
+65535,
+813,
+3460,
+65535,
+65535,
+65535,
+4113,
+65535,
+65535,
+274,
+1334,
+2638,
+1137,
+379,
+65535,
+2209,
+629,
+152,
+65535,
+65535,
+2055,
+1678,
+2687,
+65535,
+65535,
+1010,
+65535,
+3647,
+3151,
+1548,
+2214,
+65535,
+3286,
+2549,
+65535,
+65535,
+65535,
+1246,
+3031,
+300,
+3436,
+3545,
+907,
+1726,
+65535,
+3660,
+1565,
+875,
+2170,
+3627,
+251,
+65535,
+3142,
+65535,
+1009,
+3728,
+65535,
+65535,
+65535,
+65535,
+2811,
+65535,
+3432,
+1839,
+65535,
+65535,
+2386,
+65535,
+440,
+3452,
+65535,
+65535,
+3826,
+65535,
+785,
+3065,
+3911,
+2017,
+2413,
+65535,
+3487,
+834,
+3197,
+65535,
+65535,
+65535,
+1418,
+3441,
+1026,
+65535,
+65535,
+844,
+65535,
+1898,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+692,
+2723,
+2259,
+65535,
+221,
+3115,
+890,
+65535,
+65535,
+65535,
+3517,
+65535,
+777,
+65535,
+65535,
+65535,
+2478,
+65535,
+1695,
+2578,
+2263,
+940,
+445,
+65535,
+65535,
+65535,
+3071,
+65535,
+3229,
+550,
+65535,
+65535,
+65535,
+65535,
+2877,
+65535,
+3448,
+2445,
+65535,
+65535,
+1939,
+65535,
+1391,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1298,
+65535,
+269,
+2129,
+65535,
+40,
+65535,
+65535,
+65535,
+1395,
+2656,
+65535,
+1341,
+3478,
+1276,
+2330,
+65535,
+1800,
+65535,
+65535,
+65535,
+622,
+3928,
+65535,
+2554,
+65535,
+65535,
+496,
+65535,
+65535,
+2953,
+3820,
+2596,
+1597,
+65535,
+2068,
+65535,
+3429,
+205,
+1869,
+65535,
+65535,
+2165,
+65535,
+65535,
+65535,
+2943,
+3293,
+1658,
+1105,
+65535,
+65535,
+65535,
+65535,
+65535,
+3187,
+466,
+2188,
+485,
+3306,
+255,
+3038,
+65535,
+727,
+65535,
+287,
+2715,
+558,
+65535,
+2818,
+117,
+65535,
+1079,
+1739,
+3701,
+2151,
+65535,
+65535,
+158,
+65535,
+65535,
+65535,
+65535,
+65535,
+4080,
+3101,
+303,
+65535,
+65535,
+577,
+1989,
+65535,
+1724,
+310,
+65535,
+284,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2332,
+65535,
+1619,
+1485,
+65535,
+2840,
+806,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3335,
+65535,
+1757,
+1008,
+2462,
+1385,
+1167,
+2235,
+65535,
+2500,
+65535,
+1047,
+65535,
+2528,
+65535,
+65535,
+65535,
+1964,
+65535,
+65535,
+65535,
+65535,
+65535,
+1252,
+3565,
+65535,
+65535,
+65535,
+65535,
+4033,
+65535,
+1332,
+2623,
+65535,
+65535,
+1140,
+3189,
+1319,
+1111,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1078,
+65535,
+3205,
+2310,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3060,
+2601,
+4104,
+65535,
+65535,
+3546,
+65535,
+65535,
+65535,
+166,
+65535,
+953,
+65535,
+65535,
+2900,
+65535,
+1721,
+65535,
+65535,
+65535,
+65535,
+65535,
+2758,
+1005,
+65535,
+1704,
+65535,
+1496,
+1474,
+3240,
+65535,
+65535,
+1200,
+65535,
+65535,
+65535,
+65535,
+565,
+65535,
+1611,
+65535,
+65535,
+65535,
+65535,
+2785,
+2090,
+65535,
+3775,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+4101,
+3057,
+65535,
+1628,
+65535,
+65535,
+65535,
+3440,
+3646,
+65535,
+65535,
+2894,
+65535,
+65535,
+4116,
+65535,
+65535,
+65535,
+562,
+65535,
+65535,
+65535,
+65535,
+65535,
+3350,
+3300,
+1209,
+951,
+62,
+65535,
+65535,
+65535,
+463,
+917,
+2617,
+65535,
+2236,
+65535,
+65535,
+1654,
+65535,
+324,
+65535,
+3402,
+65535,
+856,
+65535,
+65535,
+1738,
+3592,
+65535,
+3637,
+65535,
+2615,
+65535,
+2602,
+3954,
+65535,
+65535,
+2154,
+65535,
+65535,
+3444,
+65535,
+2489,
+1329,
+65535,
+1066,
+1122,
+65535,
+857,
+65535,
+1107,
+352,
+65535,
+65535,
+65535,
+65535,
+65535,
+2534,
+403,
+65535,
+65535,
+1058,
+2454,
+65535,
+65535,
+65535,
+956,
+2794,
+65535,
+65535,
+3526,
+65535,
+2109,
+65535,
+65535,
+3707,
+3674,
+65535,
+1857,
+497,
+65535,
+589,
+65535,
+2231,
+2892,
+652,
+65535,
+185,
+65535,
+19,
+335,
+65535,
+65535,
+65535,
+65535,
+65535,
+1077,
+2570,
+65535,
+65535,
+2298,
+65535,
+1668,
+2281,
+65535,
+65535,
+65535,
+2928,
+1466,
+2676,
+65535,
+65535,
+1074,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3343,
+3106,
+65535,
+772,
+3405,
+653,
+1373,
+65535,
+810,
+65535,
+65535,
+65535,
+65535,
+3757,
+65535,
+3818,
+348,
+65535,
+2184,
+65535,
+4019,
+3296,
+65535,
+65535,
+2665,
+2766,
+3551,
+3726,
+2759,
+65535,
+65535,
+3788,
+65535,
+65535,
+2075,
+65535,
+65535,
+65535,
+2012,
+3666,
+1626,
+2216,
+65535,
+65535,
+1641,
+1882,
+65535,
+960,
+3927,
+1102,
+65535,
+65535,
+515,
+3339,
+65535,
+1071,
+65535,
+65535,
+1515,
+65535,
+65535,
+3819,
+2577,
+2703,
+2262,
+89,
+1014,
+2927,
+65535,
+65535,
+65535,
+3243,
+65535,
+2350,
+2471,
+65535,
+3407,
+1394,
+1215,
+1201,
+65535,
+2696,
+65535,
+3206,
+65535,
+65535,
+3459,
+65535,
+3510,
+65535,
+3125,
+65535,
+1099,
+65535,
+65535,
+4092,
+43,
+65535,
+3128,
+4139,
+65535,
+65535,
+955,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2510,
+65535,
+65535,
+65535,
+2550,
+65535,
+1454,
+65535,
+65535,
+65535,
+65535,
+65535,
+78,
+1057,
+160,
+65535,
+65535,
+45,
+65535,
+65535,
+1532,
+2750,
+65535,
+3705,
+198,
+65535,
+1030,
+65535,
+681,
+65535,
+65535,
+738,
+156,
+65535,
+2537,
+65535,
+1238,
+1432,
+65535,
+65535,
+65535,
+65535,
+553,
+65535,
+651,
+1413,
+1505,
+65535,
+65535,
+854,
+3185,
+1434,
+2967,
+343,
+2941,
+1930,
+65535,
+1749,
+65535,
+65535,
+65535,
+65535,
+620,
+65535,
+113,
+3117,
+2300,
+65535,
+65535,
+912,
+65535,
+3709,
+2752,
+3256,
+65535,
+65535,
+1944,
+2756,
+65535,
+65535,
+65535,
+1556,
+3970,
+65535,
+980,
+65535,
+65535,
+1958,
+241,
+2870,
+65535,
+65535,
+232,
+2446,
+4081,
+2777,
+65535,
+3164,
+65535,
+635,
+2718,
+65535,
+2915,
+2934,
+65535,
+2370,
+65535,
+1756,
+1355,
+65535,
+2581,
+65535,
+3327,
+65535,
+65535,
+65535,
+65535,
+3624,
+4052,
+3696,
+1698,
+291,
+2261,
+65535,
+1900,
+65535,
+3093,
+1552,
+3388,
+65535,
+65535,
+2065,
+65535,
+506,
+52,
+1021,
+1173,
+65535,
+1270,
+65535,
+65535,
+3534,
+65535,
+1278,
+65535,
+1040,
+65535,
+65535,
+65535,
+3853,
+65535,
+65535,
+65535,
+2740,
+65535,
+65535,
+2264,
+1162,
+1918,
+2034,
+3465,
+3914,
+2970,
+65535,
+3989,
+2544,
+65535,
+2852,
+65535,
+65535,
+65535,
+977,
+3808,
+3149,
+65535,
+65535,
+65535,
+3165,
+2992,
+3099,
+2961,
+65535,
+1046,
+1527,
+65535,
+65535,
+257,
+3748,
+1920,
+65535,
+3267,
+3102,
+65535,
+65535,
+65535,
+65535,
+65535,
+1310,
+65535,
+3587,
+2442,
+1324,
+4022,
+3127,
+65535,
+65535,
+65535,
+65535,
+65535,
+1362,
+1266,
+1221,
+65535,
+1640,
+3253,
+65535,
+123,
+517,
+65535,
+3179,
+65535,
+65535,
+65535,
+328,
+1693,
+65535,
+65535,
+65535,
+1570,
+65535,
+65535,
+65535,
+65535,
+65535,
+2538,
+65535,
+1700,
+1134,
+65535,
+65535,
+2658,
+65535,
+2748,
+2290,
+3067,
+65535,
+703,
+1300,
+65535,
+4042,
+65535,
+65535,
+3983,
+4122,
+2089,
+65535,
+2562,
+2663,
+65535,
+65535,
+2192,
+65535,
+1516,
+2481,
+1995,
+557,
+65535,
+65535,
+65535,
+2959,
+644,
+3863,
+65535,
+65535,
+65535,
+2058,
+65535,
+3675,
+65535,
+3305,
+65535,
+65535,
+65535,
+65535,
+65535,
+2279,
+901,
+1837,
+65535,
+65535,
+217,
+2156,
+1318,
+108,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3121,
+292,
+65535,
+1419,
+65535,
+65535,
+3169,
+2404,
+65535,
+106,
+65535,
+2120,
+65535,
+65535,
+3157,
+1960,
+65535,
+65535,
+65535,
+65535,
+528,
+65535,
+3480,
+2993,
+65535,
+3976,
+3755,
+1622,
+304,
+1528,
+2841,
+908,
+364,
+65535,
+65535,
+65535,
+2806,
+65535,
+65535,
+2733,
+2441,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2716,
+65535,
+787,
+65535,
+2046,
+65535,
+504,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1203,
+3521,
+65535,
+65535,
+754,
+65535,
+65535,
+65535,
+65535,
+2784,
+65535,
+1302,
+65535,
+65535,
+65535,
+65535,
+450,
+1558,
+3443,
+3,
+65535,
+65535,
+65535,
+3382,
+65535,
+3910,
+65535,
+65535,
+3507,
+144,
+3417,
+2391,
+65535,
+376,
+887,
+65535,
+1783,
+65535,
+65535,
+65535,
+65535,
+65535,
+2190,
+65535,
+3147,
+3276,
+65535,
+65535,
+1339,
+3877,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1196,
+3806,
+65535,
+4029,
+65535,
+1178,
+65535,
+65535,
+65535,
+65535,
+1219,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+341,
+65535,
+65535,
+65535,
+65535,
+65535,
+3119,
+65535,
+65535,
+1963,
+238,
+4046,
+384,
+65535,
+65535,
+1320,
+65535,
+1235,
+65535,
+163,
+3247,
+1376,
+3919,
+3679,
+1453,
+590,
+65535,
+65535,
+2836,
+65535,
+2288,
+702,
+877,
+1571,
+65535,
+65535,
+1955,
+2883,
+65535,
+3908,
+65535,
+65535,
+65535,
+2050,
+65535,
+3451,
+65535,
+3290,
+1316,
+1903,
+4132,
+554,
+65535,
+3304,
+1423,
+65535,
+65535,
+65535,
+65535,
+3387,
+65535,
+65535,
+1889,
+122,
+65535,
+3050,
+65535,
+3314,
+65535,
+1697,
+689,
+65535,
+65535,
+2202,
+65535,
+1636,
+1473,
+3007,
+65535,
+65535,
+649,
+65535,
+1973,
+65535,
+2654,
+65535,
+2135,
+65535,
+65535,
+65535,
+65535,
+2416,
+7,
+65535,
+65535,
+65535,
+1195,
+2096,
+65535,
+65535,
+65535,
+65535,
+65535,
+2920,
+266,
+1567,
+65535,
+408,
+3262,
+2835,
+65535,
+65535,
+2867,
+65535,
+308,
+2543,
+2389,
+1513,
+65535,
+1317,
+65535,
+3875,
+448,
+2102,
+65535,
+3552,
+65535,
+65535,
+3990,
+65535,
+1154,
+1799,
+2437,
+65535,
+2788,
+65535,
+65535,
+65535,
+1171,
+846,
+3396,
+434,
+65535,
+65535,
+721,
+919,
+65535,
+2678,
+1710,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1924,
+2319,
+65535,
+65535,
+65535,
+792,
+65535,
+2775,
+65535,
+65535,
+2268,
+65535,
+65535,
+65535,
+65535,
+3288,
+1523,
+2382,
+1933,
+65535,
+65535,
+65535,
+65535,
+65535,
+1683,
+3442,
+3381,
+1151,
+65535,
+65535,
+65535,
+1612,
+3211,
+65535,
+1481,
+65535,
+65535,
+2659,
+65535,
+2248,
+65535,
+2552,
+65535,
+3502,
+3294,
+65535,
+1214,
+65535,
+130,
+65535,
+65535,
+1860,
+2648,
+2431,
+4060,
+505,
+2930,
+65535,
+65535,
+967,
+383,
+65535,
+3530,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+647,
+686,
+65535,
+2817,
+2727,
+65535,
+1750,
+65535,
+1781,
+65535,
+363,
+676,
+2695,
+65,
+65535,
+65535,
+781,
+3406,
+65535,
+65535,
+3003,
+65535,
+65535,
+3774,
+65535,
+3011,
+1431,
+65535,
+65535,
+65535,
+3053,
+2183,
+771,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3945,
+65535,
+524,
+2301,
+1705,
+358,
+2294,
+65535,
+3724,
+745,
+65535,
+65535,
+65535,
+3936,
+1477,
+65535,
+65535,
+65535,
+65535,
+1338,
+65535,
+929,
+1267,
+3307,
+3242,
+65535,
+4074,
+3600,
+188,
+2166,
+65535,
+2525,
+2611,
+65535,
+932,
+4093,
+65535,
+2015,
+65535,
+159,
+65535,
+65535,
+2791,
+65535,
+3779,
+65535,
+65535,
+65535,
+2681,
+65535,
+65535,
+65535,
+3663,
+65535,
+3659,
+3087,
+65535,
+162,
+65535,
+65535,
+65535,
+4038,
+2677,
+65535,
+65535,
+353,
+2588,
+1476,
+65535,
+3739,
+65535,
+2512,
+2009,
+1822,
+2652,
+2252,
+65535,
+3395,
+3047,
+1147,
+65535,
+65535,
+65535,
+65535,
+65535,
+2082,
+65535,
+3583,
+65535,
+65535,
+65535,
+1354,
+65535,
+65535,
+65535,
+65535,
+1393,
+65535,
+65535,
+820,
+3464,
+2309,
+65535,
+3541,
+65535,
+65535,
+65535,
+3373,
+3051,
+65535,
+2660,
+65535,
+2237,
+65535,
+65535,
+65535,
+669,
+604,
+65535,
+65535,
+3161,
+65535,
+65535,
+2793,
+65535,
+65535,
+3793,
+349,
+65535,
+65535,
+1518,
+65535,
+2179,
+65535,
+3098,
+1081,
+65535,
+65535,
+65535,
+366,
+3955,
+65535,
+65535,
+65535,
+65535,
+1498,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3193,
+1407,
+65535,
+65535,
+2975,
+309,
+332,
+2641,
+65535,
+65535,
+893,
+65535,
+673,
+65535,
+65535,
+2567,
+27,
+65535,
+3182,
+65535,
+65535,
+65535,
+750,
+3449,
+65535,
+65535,
+65535,
+3158,
+65535,
+65535,
+65535,
+65535,
+4124,
+65535,
+65535,
+2625,
+1265,
+65535,
+508,
+65535,
+2991,
+1560,
+611,
+1490,
+65535,
+1349,
+65535,
+3861,
+900,
+65535,
+65535,
+65535,
+65535,
+65535,
+1408,
+3942,
+65535,
+65535,
+2851,
+717,
+3550,
+65535,
+3377,
+65535,
+3995,
+1084,
+65535,
+65535,
+968,
+65535,
+65535,
+65535,
+65535,
+184,
+828,
+65535,
+1755,
+65535,
+65535,
+2919,
+65535,
+65535,
+65535,
+2760,
+904,
+1760,
+3751,
+3370,
+65535,
+3365,
+2158,
+65535,
+65535,
+65535,
+65535,
+65535,
+129,
+73,
+65535,
+65535,
+148,
+2265,
+65535,
+803,
+65535,
+65535,
+1902,
+2467,
+65535,
+690,
+1510,
+65535,
+3001,
+65535,
+65535,
+65535,
+1291,
+3488,
+538,
+2995,
+65535,
+65535,
+65535,
+1307,
+551,
+65535,
+3975,
+3214,
+65535,
+189,
+65535,
+2373,
+790,
+65535,
+65535,
+247,
+65535,
+65535,
+65535,
+65535,
+837,
+3352,
+65535,
+65535,
+2616,
+2826,
+41,
+65535,
+65535,
+3987,
+521,
+65535,
+65535,
+65535,
+65535,
+3909,
+65535,
+65535,
+65535,
+3697,
+3626,
+65535,
+1449,
+2140,
+65535,
+65535,
+3422,
+65535,
+65535,
+65535,
+2579,
+883,
+931,
+65535,
+65535,
+65535,
+672,
+3146,
+65535,
+65535,
+65535,
+65535,
+3613,
+65535,
+1910,
+65535,
+2541,
+65535,
+47,
+2976,
+2476,
+65535,
+2465,
+2143,
+959,
+3762,
+65535,
+65535,
+3231,
+836,
+3789,
+65535,
+65535,
+1877,
+709,
+3692,
+65535,
+65535,
+3711,
+65535,
+3767,
+2054,
+65535,
+547,
+65535,
+2086,
+65535,
+580,
+3330,
+88,
+2107,
+65535,
+65535,
+65535,
+3260,
+65535,
+49,
+1232,
+65535,
+65535,
+65535,
+3107,
+3409,
+3394,
+237,
+65535,
+65535,
+3884,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1188,
+1029,
+2150,
+65535,
+1248,
+2295,
+1240,
+65535,
+3298,
+1921,
+65535,
+2457,
+2079,
+1208,
+2000,
+1653,
+65535,
+691,
+65535,
+3930,
+3951,
+65535,
+65535,
+65535,
+65535,
+3245,
+3346,
+65535,
+65535,
+1082,
+490,
+921,
+65535,
+4021,
+1838,
+2726,
+65535,
+2345,
+65535,
+223,
+746,
+3318,
+99,
+2923,
+3836,
+2444,
+65535,
+458,
+715,
+65535,
+65535,
+3835,
+65535,
+1914,
+2939,
+65535,
+65535,
+2280,
+3204,
+3623,
+2855,
+3932,
+65535,
+2916,
+65535,
+65535,
+65535,
+2832,
+1826,
+65535,
+2213,
+65535,
+65535,
+65535,
+65535,
+302,
+65535,
+3458,
+2574,
+65535,
+1811,
+3270,
+65535,
+3766,
+65535,
+65535,
+3332,
+65535,
+1777,
+65535,
+1007,
+65535,
+65535,
+2405,
+642,
+1642,
+962,
+65535,
+1285,
+65535,
+2490,
+58,
+15,
+65535,
+65535,
+1988,
+65535,
+65535,
+65535,
+65535,
+2879,
+65535,
+2642,
+91,
+718,
+847,
+65535,
+65535,
+1954,
+65535,
+2563,
+3782,
+201,
+65535,
+3918,
+65535,
+65535,
+2203,
+2191,
+65535,
+3740,
+65535,
+65535,
+1152,
+786,
+444,
+65535,
+65535,
+65535,
+2539,
+1100,
+65535,
+1374,
+1222,
+4064,
+65535,
+822,
+213,
+65535,
+2833,
+2100,
+2825,
+65535,
+863,
+65535,
+1788,
+65535,
+65535,
+65535,
+65535,
+4087,
+65535,
+65535,
+65535,
+30,
+3844,
+65535,
+65535,
+65535,
+3455,
+65535,
+65535,
+3802,
+2215,
+65535,
+65535,
+1245,
+65535,
+65535,
+65535,
+1482,
+65535,
+65535,
+65535,
+2885,
+3415,
+2779,
+136,
+2242,
+65535,
+2162,
+4134,
+212,
+65535,
+65535,
+1441,
+65535,
+65535,
+65535,
+2372,
+65535,
+2336,
+65535,
+65535,
+2384,
+65535,
+65535,
+65535,
+65535,
+3905,
+65535,
+34,
+65535,
+65535,
+393,
+665,
+65535,
+2874,
+65535,
+84,
+2484,
+1130,
+65535,
+65535,
+3849,
+65535,
+572,
+65535,
+859,
+167,
+809,
+65535,
+276,
+65535,
+65535,
+965,
+65535,
+65535,
+65535,
+1296,
+3030,
+3463,
+65535,
+65535,
+65535,
+2918,
+65535,
+987,
+655,
+2211,
+4051,
+65535,
+65535,
+1398,
+482,
+65535,
+65535,
+65535,
+2245,
+65535,
+65535,
+3170,
+65535,
+65535,
+1183,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+657,
+2972,
+65535,
+1759,
+65535,
+65535,
+65535,
+3576,
+2524,
+2518,
+2008,
+2498,
+65535,
+2499,
+65535,
+65535,
+4009,
+4125,
+65535,
+1577,
+391,
+2878,
+1787,
+65535,
+65535,
+1336,
+65535,
+65535,
+65535,
+1110,
+65535,
+65535,
+65535,
+2393,
+1337,
+3596,
+2803,
+1155,
+338,
+1020,
+1614,
+2175,
+65535,
+65535,
+65535,
+3272,
+65535,
+1961,
+65535,
+65535,
+65535,
+65535,
+2935,
+65535,
+3921,
+65535,
+1268,
+65535,
+65535,
+65535,
+174,
+65535,
+65535,
+3139,
+2838,
+65535,
+65535,
+1540,
+2743,
+65535,
+65535,
+1906,
+1001,
+461,
+65535,
+65535,
+65535,
+65535,
+65535,
+1002,
+3671,
+2536,
+1942,
+65535,
+65535,
+1946,
+65535,
+65535,
+1806,
+3567,
+65535,
+426,
+780,
+2762,
+2029,
+65535,
+3772,
+793,
+2983,
+1652,
+65535,
+998,
+95,
+1905,
+3177,
+65535,
+65535,
+878,
+65535,
+65535,
+650,
+65535,
+3163,
+65535,
+3258,
+2606,
+757,
+65535,
+65535,
+1360,
+1258,
+65535,
+65535,
+481,
+3112,
+3360,
+65535,
+65535,
+16,
+3694,
+65535,
+65535,
+3509,
+2936,
+2700,
+3752,
+3579,
+65535,
+3962,
+1846,
+1557,
+65535,
+65535,
+65535,
+65535,
+356,
+3719,
+2741,
+1605,
+65535,
+4098,
+1589,
+65535,
+65535,
+2968,
+65535,
+668,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1604,
+1546,
+65535,
+65535,
+36,
+65535,
+65535,
+103,
+1198,
+2896,
+1263,
+1076,
+1971,
+65535,
+2351,
+720,
+65535,
+65535,
+65535,
+3435,
+65535,
+65535,
+1138,
+2839,
+3171,
+65535,
+3150,
+65535,
+1791,
+2131,
+1114,
+65535,
+153,
+65535,
+65535,
+3092,
+2639,
+65535,
+86,
+65535,
+2569,
+2981,
+1928,
+65535,
+1745,
+906,
+4108,
+2232,
+3815,
+3207,
+65535,
+2834,
+3795,
+65535,
+65535,
+65535,
+65535,
+65535,
+2159,
+411,
+3522,
+438,
+65535,
+605,
+1585,
+278,
+37,
+954,
+3501,
+2583,
+65535,
+3383,
+3457,
+595,
+4083,
+2010,
+2690,
+2084,
+65535,
+65535,
+2774,
+1618,
+3722,
+2314,
+65535,
+65535,
+3426,
+579,
+65535,
+125,
+1992,
+65535,
+65535,
+65535,
+65535,
+2343,
+4017,
+4025,
+65535,
+1038,
+65535,
+3486,
+65535,
+2887,
+1790,
+65535,
+65535,
+65535,
+65535,
+2940,
+65535,
+65535,
+65535,
+3972,
+65535,
+65535,
+65535,
+65535,
+409,
+1714,
+2682,
+65535,
+2619,
+65535,
+65535,
+4111,
+65535,
+3431,
+2668,
+65535,
+1187,
+2312,
+2506,
+770,
+1610,
+65535,
+3467,
+65535,
+65535,
+3893,
+2491,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3077,
+2331,
+2824,
+65535,
+65535,
+96,
+65535,
+1796,
+1273,
+2709,
+65535,
+65535,
+65535,
+65535,
+65535,
+2432,
+65535,
+65535,
+65535,
+2614,
+65535,
+1588,
+26,
+1050,
+65535,
+65535,
+2679,
+65535,
+2091,
+2805,
+1645,
+65535,
+3665,
+2425,
+632,
+1786,
+700,
+65535,
+1536,
+2633,
+65535,
+65535,
+65535,
+2891,
+65535,
+1707,
+65535,
+3424,
+1180,
+3761,
+1762,
+2004,
+65535,
+65535,
+3821,
+65535,
+3203,
+65535,
+65535,
+375,
+1465,
+3721,
+3109,
+65535,
+4073,
+3899,
+65535,
+65535,
+3095,
+674,
+1580,
+65535,
+65535,
+65535,
+65535,
+65535,
+2845,
+2417,
+3810,
+4057,
+65535,
+3438,
+65535,
+575,
+65535,
+65535,
+2390,
+65535,
+986,
+1123,
+2317,
+2844,
+65535,
+2177,
+65535,
+65535,
+3379,
+65535,
+20,
+65535,
+65535,
+65535,
+1934,
+65535,
+823,
+1467,
+1024,
+641,
+65535,
+203,
+65535,
+2565,
+884,
+65535,
+3032,
+2278,
+65535,
+65535,
+65535,
+65535,
+65535,
+1459,
+65535,
+2395,
+1576,
+3094,
+1321,
+65535,
+65535,
+65535,
+243,
+65535,
+3279,
+65535,
+385,
+1581,
+65535,
+3252,
+1876,
+65535,
+65535,
+3891,
+65535,
+2908,
+339,
+2710,
+65535,
+65535,
+1272,
+969,
+530,
+65535,
+65535,
+65535,
+2819,
+65535,
+65535,
+1564,
+65535,
+65535,
+65535,
+3484,
+602,
+832,
+2683,
+2371,
+222,
+65535,
+3103,
+65535,
+3497,
+2612,
+65535,
+65535,
+65535,
+65535,
+1629,
+65535,
+65535,
+220,
+1460,
+1156,
+65535,
+65535,
+3597,
+1177,
+65535,
+65535,
+3790,
+1717,
+2297,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+72,
+874,
+65535,
+3599,
+65535,
+65535,
+1666,
+3418,
+65535,
+4055,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+77,
+65535,
+65535,
+3168,
+1737,
+65535,
+65535,
+262,
+2795,
+3029,
+65535,
+1858,
+65535,
+4096,
+534,
+65535,
+3195,
+65535,
+3123,
+3012,
+609,
+65535,
+65535,
+1440,
+65535,
+3896,
+1161,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3612,
+65535,
+65535,
+853,
+65535,
+65535,
+65535,
+1634,
+888,
+1390,
+307,
+3085,
+4123,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2820,
+826,
+65535,
+2956,
+2379,
+65535,
+1582,
+1688,
+65535,
+65535,
+3622,
+1550,
+65535,
+65535,
+65535,
+3072,
+804,
+65535,
+3817,
+65535,
+65535,
+265,
+65535,
+65535,
+181,
+65535,
+65535,
+3892,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2468,
+2284,
+65535,
+65535,
+65535,
+65535,
+1985,
+707,
+65535,
+4105,
+3439,
+65535,
+65535,
+3036,
+1770,
+3560,
+65535,
+2666,
+65535,
+65535,
+132,
+65535,
+65535,
+2675,
+961,
+65535,
+65535,
+2830,
+65535,
+65535,
+75,
+3230,
+65535,
+2403,
+65535,
+65535,
+3938,
+1541,
+65535,
+3860,
+1455,
+65535,
+65535,
+65535,
+65535,
+489,
+65535,
+1598,
+65535,
+1816,
+65535,
+1041,
+65535,
+65535,
+2704,
+65535,
+3479,
+65535,
+729,
+65535,
+65535,
+4020,
+65535,
+65535,
+65535,
+2592,
+65535,
+1199,
+2530,
+65535,
+65535,
+296,
+65535,
+65535,
+944,
+1227,
+65535,
+991,
+65535,
+65535,
+65535,
+65535,
+812,
+65535,
+3798,
+685,
+65535,
+2132,
+2954,
+65535,
+65535,
+3574,
+65535,
+295,
+1883,
+190,
+65535,
+65535,
+65535,
+1059,
+2667,
+909,
+2078,
+2808,
+65535,
+2359,
+65535,
+2494,
+65535,
+65535,
+841,
+65535,
+65535,
+197,
+65535,
+65535,
+340,
+818,
+65535,
+65535,
+65535,
+2001,
+2938,
+842,
+65535,
+65535,
+65535,
+3603,
+359,
+65535,
+65535,
+65535,
+65535,
+65535,
+2576,
+65535,
+65535,
+487,
+65535,
+3794,
+369,
+65535,
+3602,
+65535,
+1281,
+65535,
+65535,
+65535,
+65535,
+65535,
+3512,
+65535,
+65535,
+3520,
+3784,
+65535,
+65535,
+65535,
+1250,
+121,
+3275,
+3310,
+3559,
+65535,
+660,
+65535,
+65535,
+2480,
+1313,
+345,
+65535,
+3054,
+1430,
+600,
+1381,
+1212,
+65535,
+65535,
+2364,
+3888,
+65535,
+3901,
+1643,
+2912,
+65535,
+65535,
+65535,
+3832,
+65535,
+3582,
+65535,
+892,
+65535,
+3535,
+3812,
+1595,
+1194,
+913,
+2796,
+65535,
+879,
+1092,
+65535,
+2406,
+65535,
+65535,
+65535,
+695,
+1810,
+65535,
+997,
+2542,
+65535,
+65535,
+1848,
+65535,
+65535,
+65535,
+65535,
+2427,
+65535,
+3348,
+993,
+65535,
+3461,
+65535,
+3500,
+539,
+65535,
+2346,
+65535,
+471,
+65535,
+65535,
+710,
+65535,
+1694,
+927,
+65535,
+65535,
+65535,
+65535,
+2244,
+2571,
+4016,
+65535,
+2684,
+65535,
+65535,
+65535,
+65535,
+65535,
+1689,
+65535,
+3217,
+659,
+2066,
+65535,
+1859,
+2052,
+65535,
+3159,
+65535,
+1765,
+1847,
+65535,
+192,
+1657,
+65535,
+2285,
+1051,
+65535,
+65535,
+65535,
+1125,
+65535,
+65535,
+65535,
+2734,
+3876,
+1679,
+65535,
+1083,
+1718,
+2230,
+2911,
+2207,
+65535,
+3105,
+65535,
+2019,
+193,
+65535,
+3008,
+1342,
+675,
+427,
+1878,
+65535,
+543,
+1828,
+566,
+65535,
+1487,
+3578,
+65535,
+1499,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+1795,
+3859,
+1176,
+430,
+3902,
+2361,
+65535,
+65535,
+1662,
+65535,
+65535,
+3167,
+65535,
+526,
+65535,
+3912,
+2006,
+65535,
+65535,
+65535,
+3498,
+2030,
+65535,
+65535,
+65535,
+3717,
+65535,
+1012,
+65535,
+1367,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2293,
+3556,
+65535,
+3056,
+65535,
+616,
+39,
+1617,
+65535,
+1401,
+65535,
+2148,
+65535,
+65535,
+65535,
+65535,
+2814,
+65535,
+1957,
+65535,
+1744,
+1067,
+2763,
+1406,
+65535,
+65535,
+1834,
+3485,
+65535,
+65535,
+65535,
+1497,
+670,
+3516,
+1165,
+225,
+65535,
+65535,
+1085,
+65535,
+1380,
+65535,
+65535,
+65535,
+65535,
+2016,
+65535,
+65535,
+2322,
+2702,
+3827,
+1650,
+1758,
+65535,
+1383,
+1578,
+65535,
+2884,
+260,
+351,
+65535,
+65535,
+65535,
+683,
+1410,
+1894,
+849,
+3867,
+2073,
+65535,
+2719,
+65535,
+3143,
+65535,
+65535,
+65535,
+1553,
+1613,
+65535,
+65535,
+65535,
+400,
+65535,
+65535,
+65535,
+493,
+65535,
+1069,
+3964,
+3425,
+1809,
+65535,
+1821,
+2540,
+3400,
+437,
+65535,
+65535,
+1615,
+65535,
+104,
+186,
+65535,
+3491,
+65535,
+65535,
+65535,
+65535,
+2123,
+65535,
+4109,
+3194,
+65535,
+65535,
+978,
+1836,
+701,
+65535,
+724,
+1416,
+623,
+3960,
+65535,
+3638,
+65535,
+1936,
+65535,
+2106,
+3570,
+1000,
+1592,
+65535,
+3096,
+646,
+377,
+65535,
+65535,
+65535,
+65535,
+65535,
+3363,
+65535,
+2812,
+2507,
+65535,
+3783,
+65535,
+3681,
+65535,
+4137,
+65535,
+65535,
+1386,
+65535,
+54,
+3010,
+65535,
+65535,
+4075,
+519,
+734,
+2470,
+995,
+3340,
+65535,
+1044,
+1929,
+1494,
+65535,
+65535,
+65535,
+65535,
+2607,
+666,
+65535,
+1279,
+483,
+65535,
+65535,
+65535,
+4072,
+65535,
+65535,
+1801,
+65535,
+1060,
+65535,
+3764,
+65535,
+800,
+2698,
+65535,
+65535,
+3059,
+65535,
+3601,
+3713,
+65535,
+2910,
+1192,
+1117,
+2985,
+1656,
+65535,
+1191,
+65535,
+2464,
+65535,
+3723,
+1509,
+65535,
+65535,
+1539,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3706,
+2729,
+4049,
+65535,
+65535,
+2979,
+65535,
+3411,
+65535,
+3763,
+630,
+65535,
+65535,
+65535,
+65535,
+3741,
+4054,
+65535,
+65535,
+2575,
+67,
+65535,
+3045,
+1956,
+65535,
+263,
+65535,
+2308,
+65535,
+1506,
+1274,
+65535,
+182,
+3376,
+65535,
+2253,
+3080,
+2505,
+3568,
+436,
+2994,
+1616,
+65535,
+65535,
+65535,
+1841,
+65535,
+1880,
+65535,
+3033,
+3342,
+65535,
+1950,
+65535,
+979,
+688,
+3035,
+2737,
+65535,
+425,
+2849,
+1891,
+65535,
+65535,
+65535,
+367,
+65535,
+1119,
+3156,
+65535,
+1254,
+2388,
+65535,
+65535,
+65535,
+248,
+65535,
+2119,
+1072,
+65535,
+541,
+65535,
+65535,
+65535,
+2590,
+2149,
+4089,
+3588,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+2691,
+3043,
+65535,
+3028,
+65535,
+1142,
+476,
+3338,
+65535,
+65535,
+65535,
+42,
+2169,
+65535,
+970,
+65535,
+65535,
+315,
+65535,
+4047,
+2689,
+4026,
+2362,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+3282,
+65535,
+3980,
+2328,
+65535,
+65535,
+2799,
+65535,
+3700,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+613,
+65535,
+65535,
+1512,
+65535,
+3829,
+65535,
+996,
+65535,
+65535,
+2503,
+65535,
+65535,
+1748,
+3922,
+65535,
+65535,
+65535,
+65535,
+3513,
+65535,
+65535,
+65535,
+3729,
+65535,
+65535,
+65535,
+2429,
+65535,
+65535,
+65535,
+65535,
+3265,
+797,
+65535,
+65535,
+65535,
+65535,
+65535,
+65535,
+4036,
+1793,
+65535,
+65535,
+320,
+65535,
+65535,
+2196,
+65535,
+65535,
+65535,
+1520,
+29,
+2455,
+3785,
+65535,
+708,
+3630,
+65535,
+65535,
+65535,
+1211,
+65535,
+65535,
+65535,
+65535,
+843,
+65535,
+65535,
+65535,
+1603,
+2292,
+3998,
+2049,
+1149,
+3508,
+65535,
+65535,
+1681,
+65535,
+65535,
+65535,
+2063,
+65535,
+2407,
+3173,
+578,
+65535,
+3973,
+417,
+1868,
+3450,
+109,
+65535,
+65535,
+3027,
+1635,
+1545,
+2185,
+65535,
+65535,
+65535,
+1478,
+279,
+881,
+1384,
+65535,
+2076,
+2651,
+3499,
+1782,
+65535,
+1144,
+65535,
+65535,
+65535,
+2275,
+65535,
+65535,
+65535,
+3610,
+65535,
+398,
+1907,
+65535,
+65535,
+65535,
+1148,
+65535,
+65535,
+65535,
+65535,
+65535,
+1141,
+297,
+273,
+65535,
+4037,
+65535,
+1829,
+3055,
+2233,
+1943,
+65535,
+65535,
+65535,
+65535,
+65535,
+2085,
+4023,
+65535,
+65535,
+2861,
+65535,
+571,
+65535,
+65535,
+65535,
+3642,
+1483,
+4076,
+65535,
+1703,
+65535,
+65535,
+65535,
+2461,
+65535,
+3361,
+65535,
+65535,
+65535,
+65535,
+2387,
+65535,
+65535,
+949,
+3066,
+3604,
+2508,
+65535,
+65535,
+65535,
+65535,
+2957,
+169,
+65535,
+};
+}
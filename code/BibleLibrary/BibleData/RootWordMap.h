@@ -0,0 +1,9 @@
+#pragma once
+#include <cstdint>
+#include "BibleData/PerfectHashStringMap.h"
+namespace BIBLE_DATA
+{
+extern const PerfectHashStringMap::Entry ROOT_WORD_MAP_ENTRIES[4140];
+extern const std::uint32_t ROOT_WORD_MAP_SEEDS_BY_BUCKET[1036];
+extern const std::uint16_t ROOT_WORD_MAP_ENTRY_INDICES_BY_SLOT[8281];
+}
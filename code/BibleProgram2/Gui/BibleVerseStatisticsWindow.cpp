@@ -1,3 +1,4 @@
+#include <vector>
 #include <imgui/imgui.h>
 #include <implot/implot.h>
 #include "Gui/BibleVerseStatisticsWindow.h"
@@ -36,12 +37,12 @@ namespace GUI
         {
             std::vector<std::size_t> word_counts_for_each_book;
             std::vector<std::string> book_names;
-            book_names.reserve(VersesByBook.size());
+            book_names.reserve(OccurrenceCountsByBook.size());
             std::vector<const char*> book_labels;
             std::vector<std::size_t> book_ids;
-            for (const auto& [book_id, verses_in_book] : VersesByBook)
+            for (const auto& [book_id, occurrence_count] : OccurrenceCountsByBook)
             {
-                word_counts_for_each_book.push_back(verses_in_book.size());
+                word_counts_for_each_book.push_back(occurrence_count);
 
                 book_ids.push_back(static_cast<std::size_t>(book_id));
                 book_names.push_back(BIBLE_DATA::BibleBook::FullName(book_id));
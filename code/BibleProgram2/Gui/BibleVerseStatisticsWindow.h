@@ -1,10 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <map>
-#include <vector>
 #include "BibleData/BibleBook.h"
-#include "BibleData/BibleVerse.h"
 
 namespace GUI
 {
@@ -20,7 +19,7 @@ namespace GUI
         bool Open = false;
         /// The word for which verse statistics are being displayed.
         std::string Word = "";
-        /// Bible verses by book.
-        std::map<BIBLE_DATA::BibleBook::Id, std::vector<BIBLE_DATA::BibleVerse>> VersesByBook = {};
+        /// The number of occurrences of the word in each book containing it.
+        std::map<BIBLE_DATA::BibleBook::Id, std::size_t> OccurrenceCountsByBook = {};
     };
 }
@@ -1,4 +1,6 @@
 #include <algorithm>
+#include <optional>
+#include <string_view>
 #include <imgui/imgui.h>
 #include <imgui/imgui_internal.h>
 #include "BibleData/BibleWordIndex.h"
@@ -11,11 +13,11 @@ namespace GUI
     /// Updates and renders the specified verse content in the window.
     /// Some of the implementation here is based on ImGui's multi-line text input
     /// but modified/simplified for our purposes here.
-    /// @param[in]  verses - The verse content to render.
+    /// @param[in]  verses - The verse content to render.  Verses are produced from the view as they're rendered.
     /// @param[in,out]  user_selections - User selections.
     /// @param[in,out]  user_settings - User settings.
     void BibleVersesTextPanel::UpdateAndRender(
-        const std::vector<BIBLE_DATA::BibleVerse>& verses, 
+        const BIBLE_DATA::BibleVersesView& verses,
         UserSelections& user_selections,
         UserSettings& user_settings)
     {
@@ -38,7 +40,7 @@ namespace GUI
         bool first_verse = true;
         bool first_chapter = true;
         bool first_book = true;
-        for (const BIBLE_DATA::BibleVerse& verse : verses)
+        for (const BIBLE_DATA::BibleVerse verse : verses)
         {
             // PRINT SOME TEXT TO INDICATE IF A NEW BOOK IS BEING STARTED.
             bool new_book_being_started = (previous_book != verse.Id.Book);
@@ -619,11 +621,10 @@ namespace GUI
                 lowercase_word.begin(),
                 [](const char character) { return static_cast<char>(std::tolower(character)); });
             std::string normalized_word = lowercase_word;
-            auto current_word_and_root_word = BIBLE_DATA::BibleWordIndex::RootWordsByOriginalWord.find(lowercase_word);
-            bool root_word_found = (BIBLE_DATA::BibleWordIndex::RootWordsByOriginalWord.cend() != current_word_and_root_word);
-            if (root_word_found)
+            std::optional<std::string_view> root_word = BIBLE_DATA::BibleWordIndex::RootWordsByOriginalWord.Find(lowercase_word);
+            if (root_word)
             {
-                normalized_word = current_word_and_root_word->second;
+                normalized_word = *root_word;
             }
 
             // GET THE COLOR.
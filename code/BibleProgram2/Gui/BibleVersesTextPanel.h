@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include "BibleData/BibleVerse.h"
+#include "BibleData/BibleVersesView.h"
 #include "BibleData/BibleVerseId.h"
 #include "Gui/UserSelections.h"
 #include "Gui/UserSettings.h"
@@ -17,7 +18,7 @@ namespace GUI
     {
     public:
         static void UpdateAndRender(
-            const std::vector<BIBLE_DATA::BibleVerse>& verses, 
+            const BIBLE_DATA::BibleVersesView& verses,
             UserSelections& user_selections,
             UserSettings& user_settings);
     };
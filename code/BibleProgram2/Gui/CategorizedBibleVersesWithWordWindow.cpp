@@ -1,6 +1,7 @@
 #include <string_view>
+#include <utility>
 #include <imgui/imgui.h>
-#include <stmr/stmr.h>
+#include "BibleData/BibleWordIndex.h"
 #include "Gui/BibleVersesTextPanel.h"
 #include "Gui/CategorizedBibleVersesWithWordWindow.h"
 
@@ -18,13 +19,11 @@ namespace GUI
         }
 
         // UPDATE THE WORD STEM IF IT IS OUT-OF-DATE.
+        // The word index's stemming is used since it's safe to use while translations are loading on other threads.
         bool word_stem_populated = !WordStem.empty();
         if (!word_stem_populated)
         {
-            constexpr int WORD_START_INDEX = 0;
-            int word_character_count = static_cast<int>(Word.length());
-            int word_stem_end_index = stem(const_cast<char*>(Word.c_str()), WORD_START_INDEX, word_character_count);
-            WordStem = Word.substr(WORD_START_INDEX, word_stem_end_index);
+            WordStem = BIBLE_DATA::BibleWordIndex::StemWord(Word);
         }
 
         // RENDER EACH VERSE IN THE WINDOW.
@@ -75,6 +74,76 @@ namespace GUI
             ImGui::SameLine();
             ImGui::Text("(stem: %s)", WordStem.c_str());
 
+            // ALLOW A USER TO CHOOSE HOW VERSES ARE ORDERED.
+            ImGui::SameLine();
+            if (ImGui::Checkbox("Sort by relevance", &SortByRelevance))
+            {
+                SortByRelevanceChanged = true;
+            }
+
+            // ALLOW A USER TO CHOOSE HOW OTHER FORMS OF THE WORD ARE MATCHED.
+            const std::pair<BIBLE_DATA::BibleWordIndex::WordMatchType, const char*> WORD_MATCH_TYPES_AND_LABELS[] =
+            {
+                { BIBLE_DATA::BibleWordIndex::WordMatchType::EXACT, "Exact" },
+                { BIBLE_DATA::BibleWordIndex::WordMatchType::ROOT_WORD, "Root word" },
+                { BIBLE_DATA::BibleWordIndex::WordMatchType::STEM, "Stem" },
+            };
+            for (const auto& [match_type, match_type_label] : WORD_MATCH_TYPES_AND_LABELS)
+            {
+                ImGui::SameLine();
+                if (ImGui::RadioButton(match_type_label, match_type == WordMatchType))
+                {
+                    WordMatchTypeChanged = (match_type != WordMatchType);
+                    WordMatchType = match_type;
+                }
+            }
+
+            // RENDER WORDS FREQUENTLY APPEARING NEAR THE WORD.
+            if (ImGui::CollapsingHeader("Collocates"))
+            {
+                // ALLOW A USER TO CHANGE HOW COLLOCATES ARE FOUND.
+                constexpr int MAX_COLLOCATION_VERSE_WINDOW_SIZE = 5;
+                if (ImGui::SliderInt("Verses before/after", &CollocationVerseWindowSize, 0, MAX_COLLOCATION_VERSE_WINDOW_SIZE))
+                {
+                    CollocationSettingsChanged = true;
+                }
+                ImGui::SameLine();
+                if (ImGui::RadioButton("Log-likelihood", BIBLE_DATA::BibleWordCollocations::ScoreType::LOG_LIKELIHOOD_RATIO == CollocationScoreType))
+                {
+                    CollocationScoreType = BIBLE_DATA::BibleWordCollocations::ScoreType::LOG_LIKELIHOOD_RATIO;
+                    CollocationSettingsChanged = true;
+                }
+                ImGui::SameLine();
+                if (ImGui::RadioButton("PMI", BIBLE_DATA::BibleWordCollocations::ScoreType::POINTWISE_MUTUAL_INFORMATION == CollocationScoreType))
+                {
+                    CollocationScoreType = BIBLE_DATA::BibleWordCollocations::ScoreType::POINTWISE_MUTUAL_INFORMATION;
+                    CollocationSettingsChanged = true;
+                }
+
+                // RENDER THE COLLOCATES FOR EACH VISIBLE TRANSLATION.
+                for (const auto& [translation_name, collocates] : CollocatesByTranslationName)
+                {
+                    bool translation_visible = user_settings.BibleTranslationDisplayStatusesByName[translation_name];
+                    if (!translation_visible)
+                    {
+                        continue;
+                    }
+
+                    // Clicking a collocate selects it so that its verses can be easily viewed.
+                    ImGui::Text("%s:", translation_name.c_str());
+                    for (const BIBLE_DATA::BibleWordCollocations::Collocate& collocate : collocates)
+                    {
+                        ImGui::SameLine();
+                        std::string collocate_text = std::string(collocate.Word) + " (" + std::to_string(collocate.CooccurrenceCount) + ")";
+                        std::string collocate_label = collocate_text + "###" + translation_name + std::string(collocate.Word);
+                        if (ImGui::SmallButton(collocate_label.c_str()))
+                        {
+                            user_selections.CurrentlySelectedWord = std::string(collocate.Word);
+                        }
+                    }
+                }
+            }
+
             // RENDER THE VERSES FOR EACH CATEGORY.
             constexpr int VERSE_CATEGORY_COUNT = 6;
             if (ImGui::BeginTable("RelatedVersesByCategoryTable", VERSE_CATEGORY_COUNT, ImGuiTableFlags_ScrollY))
@@ -111,7 +180,7 @@ namespace GUI
                     for (const std::string& translation_name : visible_translation_names)
                     {
                         // The number of matching verses is included in the title for easy statistical information.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
                         std::string column_title = translation_name + " (" + std::to_string(current_search_results.VersesInSameChapter.size()) +")";
                         ImGui::TableSetupColumn(column_title.c_str());
                     }
@@ -129,7 +198,7 @@ namespace GUI
                         }
 
                         // GET THE VERSES FOR THE TRANSLATION.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
 
                         // DISPLAY THE VERSES IN THE CATEGORY.
                         ImGui::TableNextColumn();
@@ -147,7 +216,7 @@ namespace GUI
                     for (const std::string& translation_name : visible_translation_names)
                     {
                         // The number of matching verses is included in the title for easy statistical information.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
                         std::string column_title = translation_name + " (" + std::to_string(current_search_results.VersesInSameBook.size()) + ")";
                         ImGui::TableSetupColumn(column_title.c_str());
                     }
@@ -165,7 +234,7 @@ namespace GUI
                         }
 
                         // GET THE VERSES FOR THE TRANSLATION.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
 
                         // DISPLAY THE VERSES IN THE CATEGORY.
                         ImGui::TableNextColumn();
@@ -183,7 +252,7 @@ namespace GUI
                     for (const std::string& translation_name : visible_translation_names)
                     {
                         // The number of matching verses is included in the title for easy statistical information.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
                         std::string column_title = translation_name + " (" + std::to_string(current_search_results.VersesInOtherBooksByAuthor.size()) + ")";
                         ImGui::TableSetupColumn(column_title.c_str());
                     }
@@ -201,7 +270,7 @@ namespace GUI
                         }
 
                         // GET THE VERSES FOR THE TRANSLATION.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
 
                         // DISPLAY THE VERSES IN THE CATEGORY.
                         ImGui::TableNextColumn();
@@ -219,7 +288,7 @@ namespace GUI
                     for (const std::string& translation_name : visible_translation_names)
                     {
                         // The number of matching verses is included in the title for easy statistical information.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
                         std::string column_title = translation_name + " (" + std::to_string(current_search_results.VersesInBooksOfSameGenreByOtherAuthorsInSameTestament.size()) + ")";
                         ImGui::TableSetupColumn(column_title.c_str());
                     }
@@ -237,7 +306,7 @@ namespace GUI
                         }
 
                         // GET THE VERSES FOR THE TRANSLATION.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
 
                         // DISPLAY THE VERSES IN THE CATEGORY.
                         ImGui::TableNextColumn();
@@ -255,7 +324,7 @@ namespace GUI
                     for (const std::string& translation_name : visible_translation_names)
                     {
                         // The number of matching verses is included in the title for easy statistical information.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
                         std::string column_title = translation_name + " (" + std::to_string(current_search_results.VersesElsewhereInSameTestament.size()) + ")";
                         ImGui::TableSetupColumn(column_title.c_str());
                     }
@@ -273,7 +342,7 @@ namespace GUI
                         }
 
                         // GET THE VERSES FOR THE TRANSLATION.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
 
                         // DISPLAY THE VERSES IN THE CATEGORY.
                         ImGui::TableNextColumn();
@@ -291,7 +360,7 @@ namespace GUI
                     for (const std::string& translation_name : visible_translation_names)
                     {
                         // The number of matching verses is included in the title for easy statistical information.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
                         std::string column_title = translation_name + " (" + std::to_string(current_search_results.VersesFromOtherTestament.size()) + ")";
                         ImGui::TableSetupColumn(column_title.c_str());
                     }
@@ -309,7 +378,7 @@ namespace GUI
                         }
 
                         // GET THE VERSES FOR THE TRANSLATION.
-                        const BIBLE_DATA::CategorizedBibleVerseSearchResults& current_search_results = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::CategorizedBibleVersesView& current_search_results = VersesByTranslationName[translation_name];
 
                         // DISPLAY THE VERSES IN THE CATEGORY.
                         ImGui::TableNextColumn();
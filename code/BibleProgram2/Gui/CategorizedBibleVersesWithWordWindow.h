@@ -5,7 +5,9 @@
 #include <unordered_map>
 #include <vector>
 #include "BibleData/BibleVerseId.h"
-#include "BibleData/CategorizedBibleVerseSearchResults.h"
+#include "BibleData/BibleWordCollocations.h"
+#include "BibleData/BibleWordIndex.h"
+#include "BibleData/CategorizedBibleVersesView.h"
 #include "Gui/UserSelections.h"
 #include "Gui/UserSettings.h"
 
@@ -24,7 +26,23 @@ namespace GUI
         std::string Word = "";
         /// The stem of the current word being focused on.
         std::string WordStem = "";
+        /// True if verses in each category should be sorted by relevance to the word; false for canonical order.
+        bool SortByRelevance = false;
+        /// True if SortByRelevance was changed since the verses were last populated; false otherwise.
+        bool SortByRelevanceChanged = false;
+        /// How other forms of the word are matched when finding verses.
+        BIBLE_DATA::BibleWordIndex::WordMatchType WordMatchType = BIBLE_DATA::BibleWordIndex::WordMatchType::ROOT_WORD;
+        /// True if WordMatchType was changed since the verses were last populated; false otherwise.
+        bool WordMatchTypeChanged = false;
         /// The current verses being displayed.
-        std::unordered_map<std::string, BIBLE_DATA::CategorizedBibleVerseSearchResults> VersesByTranslationName = {};
+        std::unordered_map<std::string, BIBLE_DATA::CategorizedBibleVersesView> VersesByTranslationName = {};
+        /// The number of verses before and after verses with the word to find collocates in.
+        int CollocationVerseWindowSize = 0;
+        /// How collocates of the word are scored.
+        BIBLE_DATA::BibleWordCollocations::ScoreType CollocationScoreType = BIBLE_DATA::BibleWordCollocations::ScoreType::LOG_LIKELIHOOD_RATIO;
+        /// True if collocation settings were changed since collocates were last populated; false otherwise.
+        bool CollocationSettingsChanged = false;
+        /// The current collocates (words frequently appearing near the word) being displayed.
+        std::unordered_map<std::string, std::vector<BIBLE_DATA::BibleWordCollocations::Collocate>> CollocatesByTranslationName = {};
     };
 }
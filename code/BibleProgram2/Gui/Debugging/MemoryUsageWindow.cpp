@@ -0,0 +1,61 @@
+#include <ThirdParty/imgui/imgui.h>
+#include "BibleData/MemoryUsageReport.h"
+#include "Gui/Debugging/MemoryUsageWindow.h"
+
+namespace GUI::DEBUGGING
+{
+    /// Updates and renders a single frame of the memory usage window, if it's open.
+    /// @param[in]  bibles - The Bibles whose memory usage to display.
+    /// @param[in]  search_result_cache - The cache of search results whose memory usage and statistics to display.
+    void MemoryUsageWindow::UpdateAndRender(const BIBLE_DATA::Bibles& bibles, const BIBLE_DATA::CategorizedSearchResultCache& search_result_cache)
+    {
+        // DON'T RENDER ANYTHING IF THE WINDOW ISN'T OPEN.
+        if (!Open)
+        {
+            return;
+        }
+
+        // RENDER THE MEMORY USAGE IN THE WINDOW.
+        if (ImGui::Begin("Memory Usage", &Open))
+        {
+            // GET THE LATEST MEMORY USAGE.
+            // It's cheap to compute since only the sizes of existing arrays are added up.
+            BIBLE_DATA::MemoryUsageReport memory_usage = bibles.MemoryUsage();
+            memory_usage.Add("Search result cache", search_result_cache.MemoryUsage());
+            constexpr double BYTES_PER_KILOBYTE = 1024.0;
+            ImGui::Text("Total: %.1f KB", static_cast<double>(memory_usage.TotalSizeInBytes()) / BYTES_PER_KILOBYTE);
+
+            // DISPLAY HOW EFFECTIVE THE SEARCH RESULT CACHE IS.
+            constexpr double PERCENT_PER_FRACTION = 100.0;
+            ImGui::Text(
+                "Search result cache: %.1f%% hit rate (%zu hits, %zu misses, %zu evictions), %.1f of %.1f KB used",
+                search_result_cache.HitRate() * PERCENT_PER_FRACTION,
+                search_result_cache.HitCount,
+                search_result_cache.MissCount,
+                search_result_cache.EvictionCount,
+                static_cast<double>(search_result_cache.UsedMemoryInBytes) / BYTES_PER_KILOBYTE,
+                static_cast<double>(search_result_cache.MemoryBudgetInBytes) / BYTES_PER_KILOBYTE);
+
+            // DISPLAY EACH COMPONENT.
+            constexpr int COLUMN_COUNT = 2;
+            if (ImGui::BeginTable("MemoryUsageTable", COLUMN_COUNT, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+            {
+                ImGui::TableSetupColumn("Component");
+                ImGui::TableSetupColumn("Size (KB)");
+                ImGui::TableHeadersRow();
+
+                for (const BIBLE_DATA::MemoryUsageReport::Component& component : memory_usage.Components)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(component.Name.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", static_cast<double>(component.SizeInBytes) / BYTES_PER_KILOBYTE);
+                }
+
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "BibleData/Bibles.h"
+#include "BibleData/CategorizedSearchResultCache.h"
+
+namespace GUI::DEBUGGING
+{
+    /// A window that displays how much memory is used by Bible translations, their indexes, and cached search results.
+    class MemoryUsageWindow
+    {
+    public:
+        void UpdateAndRender(const BIBLE_DATA::Bibles& bibles, const BIBLE_DATA::CategorizedSearchResultCache& search_result_cache);
+
+        /// True if the window is open; false otherwise.
+        bool Open = false;
+    };
+}
@@ -1,3 +1,11 @@
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 #include <imgui/imgui.h>
 #include <imgui/backends/imgui_impl_opengl3.h>
 #include <imgui/backends/imgui_impl_sdl.h>
@@ -32,11 +40,13 @@ namespace GUI
     /// Updates the GUI in response to user input and renders it for the provided window.
     /// @param[in]  window - The window being interacted with and rendered to.
     /// @param[in]  bibles - The Bibles to use for verse data in the GUI.
+    /// @param[in]  translation_loader - The loader for translations that may still be loading.
     /// @param[in,out]  user_selections - The selections the user has made in the GUI.
     /// @param[in,out]  user_settings - User settings for the GUI.
     void Gui::UpdateAndRender(
         const WINDOWING::SdlWindow& window, 
         const BIBLE_DATA::Bibles& bibles,
+        const BIBLE_DATA::BibleTranslationLoader& translation_loader,
         UserSelections& user_selections,
         UserSettings& user_settings)
     {
@@ -45,8 +55,14 @@ namespace GUI
         ImGui_ImplSDL2_NewFrame(window.UnderlyingWindow);
         ImGui::NewFrame();
 
+        // TRACK THE INITIALLY SELECTED WORD.
+        // The word may be changed from the main menu or the main verses window.
+        std::string initial_selected_word = user_selections.CurrentlySelectedWord;
+
         // UPDATE AND RENDER THE MAIN MENU.
-        bool translation_changed = false;
+        // Translations finishing loading in the background are treated like newly selected translations.
+        bool translation_changed = (AvailableTranslationCount != bibles.TranslationsByAbbreviatedName.size());
+        AvailableTranslationCount = bibles.TranslationsByAbbreviatedName.size();
         if (ImGui::BeginMainMenuBar())
         {
             // RENDER THE DEBUG MENU.
@@ -55,6 +71,7 @@ namespace GUI
             if (ImGui::BeginMenu("Debug"))
             {
                 ImGui::MenuItem("Metrics", NO_SHORTCUT_KEYS, &MetricsWindow.Open);
+                ImGui::MenuItem("Memory Usage", NO_SHORTCUT_KEYS, &MemoryUsageWindow.Open);
                 ImGui::MenuItem("Style Editor", NO_SHORTCUT_KEYS, &StyleEditorWindow.Open);
                 ImGui::MenuItem("Demo", NO_SHORTCUT_KEYS, &DemoWindow.Open);
                 ImGui::MenuItem("About", NO_SHORTCUT_KEYS, &AboutWindow.Open);
@@ -80,6 +97,116 @@ namespace GUI
                     }
                 }
 
+                // DISPLAY ANY TRANSLATIONS STILL LOADING OR THAT FAILED TO LOAD.
+                // They can't be selected since they aren't available.
+                constexpr bool NOT_SELECTED = false;
+                constexpr bool DISABLED = false;
+                for (const auto& translation_load : translation_loader.TranslationLoads)
+                {
+                    BIBLE_DATA::BibleTranslationLoader::LoadStatus load_status = translation_load->Status.load(std::memory_order_acquire);
+                    bool translation_available = (BIBLE_DATA::BibleTranslationLoader::LoadStatus::LOADED == load_status);
+                    if (translation_available)
+                    {
+                        continue;
+                    }
+
+                    bool translation_loading = (BIBLE_DATA::BibleTranslationLoader::LoadStatus::LOADING == load_status);
+                    const char* load_status_text = translation_loading ? "Loading..." : "Failed to load";
+                    ImGui::MenuItem(translation_load->AbbreviatedName.c_str(), load_status_text, NOT_SELECTED, DISABLED);
+                }
+
+                ImGui::EndMenu();
+            }
+
+            // DISPLAY THE PROGRESS OF LOADING TRANSLATIONS.
+            std::size_t translation_count = translation_loader.TranslationCount();
+            std::size_t finished_translation_count = translation_loader.FinishedTranslationCount();
+            bool translations_loading = (finished_translation_count < translation_count);
+            if (translations_loading)
+            {
+                float loaded_fraction = static_cast<float>(finished_translation_count) / static_cast<float>(translation_count);
+                std::string progress_text = "Loading translations (" + std::to_string(finished_translation_count) + "/" + std::to_string(translation_count) + ")";
+                constexpr float PROGRESS_BAR_WIDTH_IN_PIXELS = 250.0f;
+                constexpr float DEFAULT_HEIGHT = 0.0f;
+                ImGui::ProgressBar(loaded_fraction, ImVec2(PROGRESS_BAR_WIDTH_IN_PIXELS, DEFAULT_HEIGHT), progress_text.c_str());
+            }
+
+            // RENDER A MENU FOR SEARCHING FOR WORDS.
+            if (ImGui::BeginMenu("Words"))
+            {
+                // ALLOW THE USER TO TYPE A WORD.
+                // Bible words are a bit under 20 characters at most, so 64 characters should be plenty of room.
+                static char word_text[64];
+                ImGui::SetNextItemWidth(256.0f);
+                ImGui::InputTextWithHint("###WordSearch", "Enter start of word (ex. righteous)", word_text, IM_ARRAYSIZE(word_text));
+
+                // FIND THE FIRST DISPLAYED TRANSLATION.
+                // Its lexicon is used for suggesting words.
+                const BIBLE_DATA::BibleTranslation* displayed_translation = nullptr;
+                for (const auto& translation_name_with_display_status : user_settings.BibleTranslationDisplayStatusesByName)
+                {
+                    bool translation_visible = translation_name_with_display_status.second;
+                    const auto& name_with_bible_translation = bibles.TranslationsByAbbreviatedName.find(translation_name_with_display_status.first);
+                    bool translation_exists = (bibles.TranslationsByAbbreviatedName.cend() != name_with_bible_translation);
+                    if (translation_visible && translation_exists)
+                    {
+                        displayed_translation = &name_with_bible_translation->second;
+                        break;
+                    }
+                }
+
+                // DISPLAY THE MOST FREQUENT WORDS STARTING WITH THE TYPED TEXT.
+                // Looking up completions takes well under a millisecond, so this is done every frame as the user types.
+                std::string lowercase_word_prefix = word_text;
+                std::transform(
+                    lowercase_word_prefix.begin(),
+                    lowercase_word_prefix.end(),
+                    lowercase_word_prefix.begin(),
+                    [](const char character) { return static_cast<char>(std::tolower(character)); });
+                bool word_prefix_entered = !lowercase_word_prefix.empty();
+                if (displayed_translation && word_prefix_entered)
+                {
+                    constexpr std::size_t MAX_SUGGESTED_WORD_COUNT = 10;
+                    std::vector<BIBLE_DATA::BibleWordIndex::WordCompletion> word_completions = displayed_translation->WordIndex.GetWordsWithPrefix(
+                        lowercase_word_prefix,
+                        MAX_SUGGESTED_WORD_COUNT);
+                    for (const BIBLE_DATA::BibleWordIndex::WordCompletion& word_completion : word_completions)
+                    {
+                        // ALLOW THE USER TO SELECT THE WORD.
+                        // The occurrence count is displayed in place of shortcut keys to help the user gauge how common words are.
+                        std::string word(word_completion.Word);
+                        std::string occurrence_count_text = std::to_string(word_completion.OccurrenceCount);
+                        if (ImGui::MenuItem(word.c_str(), occurrence_count_text.c_str()))
+                        {
+                            user_selections.CurrentlySelectedWord = word;
+                        }
+                    }
+
+                    // DISPLAY SIMILAR WORDS IF NO WORDS START WITH THE TYPED TEXT.
+                    // This helps with misspellings, especially for older spellings in some translations.
+                    if (word_completions.empty())
+                    {
+                        constexpr std::size_t MAX_EDIT_DISTANCE_FOR_SUGGESTIONS = 2;
+                        std::vector<BIBLE_DATA::BibleWordIndex::SimilarWord> similar_words = displayed_translation->WordIndex.FindSimilarWords(
+                            lowercase_word_prefix,
+                            MAX_EDIT_DISTANCE_FOR_SUGGESTIONS);
+                        if (similar_words.size() > MAX_SUGGESTED_WORD_COUNT)
+                        {
+                            similar_words.resize(MAX_SUGGESTED_WORD_COUNT);
+                        }
+
+                        ImGui::TextDisabled("%s", similar_words.empty() ? "No matching words" : "Did you mean:");
+                        for (const BIBLE_DATA::BibleWordIndex::SimilarWord& similar_word : similar_words)
+                        {
+                            std::string word(similar_word.Word);
+                            if (ImGui::MenuItem(word.c_str()))
+                            {
+                                user_selections.CurrentlySelectedWord = word;
+                            }
+                        }
+                    }
+                }
+
                 ImGui::EndMenu();
             }
 
@@ -127,22 +254,33 @@ namespace GUI
         }
 
         // UPDATE AND RENDER THE MAIN VERSES WINDOW.
-        std::string initial_selected_word = user_selections.CurrentlySelectedWord;
         MainBibleVersesWindow.UpdateAndRender(user_selections, user_settings);
 
         // UPDATE AND RENDER THE WINDOW FOR DISPLAYING CATEGORIZED VERSES.
-        // Refreshing of the window for the current word may be needed if the word or translation changed.
-        bool new_word_selected = (initial_selected_word != user_selections.CurrentlySelectedWord);
-        bool displayed_verses_with_word_outdated = (new_word_selected || translation_changed);
+        // Refreshing of the window for the current word may be needed if the word, translation, verse ordering, word matching, or collocation settings changed.
+        // Words may also be selected from within the categorized verses window (such as collocates),
+        // which is rendered after this check, so the window's own word is also compared.
+        bool new_word_selected = (
+            (initial_selected_word != user_selections.CurrentlySelectedWord) ||
+            (CategorizedBibleVersesWithWordWindow.Word != user_selections.CurrentlySelectedWord));
+        bool displayed_verses_with_word_outdated = (
+            new_word_selected ||
+            translation_changed ||
+            CategorizedBibleVersesWithWordWindow.SortByRelevanceChanged ||
+            CategorizedBibleVersesWithWordWindow.WordMatchTypeChanged ||
+            CategorizedBibleVersesWithWordWindow.CollocationSettingsChanged);
         if (displayed_verses_with_word_outdated)
         {
+            CategorizedBibleVersesWithWordWindow.SortByRelevanceChanged = false;
+            CategorizedBibleVersesWithWordWindow.WordMatchTypeChanged = false;
+            CategorizedBibleVersesWithWordWindow.CollocationSettingsChanged = false;
             CategorizedBibleVersesWithWordWindow.Open = true;
             CategorizedBibleVersesWithWordWindow.Word = user_selections.CurrentlySelectedWord;
             CategorizedBibleVersesWithWordWindow.WordStem.clear();
 
             BibleVerseStatisticsWindow.Open = true;
             BibleVerseStatisticsWindow.Word = user_selections.CurrentlySelectedWord;
-            BibleVerseStatisticsWindow.VersesByBook.clear();
+            BibleVerseStatisticsWindow.OccurrenceCountsByBook.clear();
 
             // UPDATE THE VERSES DISPLAYED IN THE WINDOWS.
             for (const auto& translation_name_with_display_status : user_settings.BibleTranslationDisplayStatusesByName)
@@ -158,16 +296,65 @@ namespace GUI
                 const std::string& translation_name = translation_name_with_display_status.first;
                 const auto& name_with_bible_translation = bibles.TranslationsByAbbreviatedName.find(translation_name);
                 const BIBLE_DATA::BibleTranslation& bible_translation = name_with_bible_translation->second;
-                BIBLE_DATA::CategorizedBibleVerseSearchResults search_results = bible_translation.WordIndex.GetMatchingVerses(
+
+                // CHECK IF THE WORD EXISTS IN THE TRANSLATION.
+                // Words selected from one translation may be spelled differently in another (such as "shew" versus "show"),
+                // so verses with similar words are searched for if the exact word doesn't exist.
+                BIBLE_DATA::BibleWordIndex::WordNormalizationBuffer word_normalization_buffer;
+                std::string_view normalized_word = BIBLE_DATA::BibleWordIndex::NormalizeWord(user_selections.CurrentlySelectedWord, word_normalization_buffer);
+                std::optional<std::size_t> word_index = bible_translation.WordIndex.FindWord(normalized_word);
+                bool word_in_translation = word_index.has_value();
+                bool search_similar_words = !word_in_translation && !normalized_word.empty();
+                constexpr std::size_t MAX_EDIT_DISTANCE_FOR_MISSING_WORDS = 2;
+                std::size_t max_edit_distance = search_similar_words ? MAX_EDIT_DISTANCE_FOR_MISSING_WORDS : 0;
+
+                // GET THE CATEGORIZED VERSES.
+                // Results are cached since users often return to recently viewed words and verses.
+                BIBLE_DATA::CategorizedSearchResultCache::Key search_result_cache_key = BIBLE_DATA::CategorizedSearchResultCache::Key::Create(
+                    translation_name,
                     user_selections.CurrentlySelectedBibleVerseId,
-                    user_selections.CurrentlySelectedWord);
-                CategorizedBibleVersesWithWordWindow.VersesByTranslationName[translation_name] = search_results;
+                    user_selections.CurrentlySelectedWord,
+                    CategorizedBibleVersesWithWordWindow.WordMatchType,
+                    CategorizedBibleVersesWithWordWindow.SortByRelevance);
+                const BIBLE_DATA::CategorizedBibleVersesView* cached_search_results = SearchResultCache.Find(search_result_cache_key);
+                if (cached_search_results)
+                {
+                    CategorizedBibleVersesWithWordWindow.VersesByTranslationName[translation_name] = *cached_search_results;
+                }
+                else
+                {
+                    BIBLE_DATA::CategorizedBibleVersesView search_results = bible_translation.WordIndex.GetMatchingVersesView(
+                        user_selections.CurrentlySelectedBibleVerseId,
+                        user_selections.CurrentlySelectedWord,
+                        max_edit_distance,
+                        CategorizedBibleVersesWithWordWindow.WordMatchType);
+                    if (CategorizedBibleVersesWithWordWindow.SortByRelevance)
+                    {
+                        bible_translation.WordIndex.SortByRelevance(user_selections.CurrentlySelectedWord, search_results);
+                    }
+                    SearchResultCache.Insert(search_result_cache_key, search_results);
+                    CategorizedBibleVersesWithWordWindow.VersesByTranslationName[translation_name] = std::move(search_results);
+                }
+
+                // GET WORDS FREQUENTLY APPEARING NEAR THE CURRENT WORD.
+                constexpr std::size_t MAX_DISPLAYED_COLLOCATE_COUNT = 10;
+                std::vector<BIBLE_DATA::BibleWordCollocations::Collocate> collocates;
+                if (word_in_translation)
+                {
+                    collocates = bible_translation.Collocations.GetCollocates(
+                        *word_index,
+                        static_cast<std::size_t>(CategorizedBibleVersesWithWordWindow.CollocationVerseWindowSize),
+                        CategorizedBibleVersesWithWordWindow.CollocationScoreType,
+                        MAX_DISPLAYED_COLLOCATE_COUNT);
+                }
+                CategorizedBibleVersesWithWordWindow.CollocatesByTranslationName[translation_name] = collocates;
 
                 /// @todo   How to handle different translations for this statistics window?
-                std::vector<BIBLE_DATA::BibleVerse> verses_with_word = bible_translation.WordIndex.GetMatchingVerses(user_selections.CurrentlySelectedWord);
-                for (const BIBLE_DATA::BibleVerse& verse : verses_with_word)
+                // Only counts are needed, so no verses are retrieved.
+                std::map<BIBLE_DATA::BibleBook::Id, std::size_t> occurrence_counts_by_book = bible_translation.WordIndex.CountOccurrencesByBook(user_selections.CurrentlySelectedWord);
+                for (const auto& [book, occurrence_count] : occurrence_counts_by_book)
                 {
-                    BibleVerseStatisticsWindow.VersesByBook[verse.Id.Book].push_back(verse);
+                    BibleVerseStatisticsWindow.OccurrenceCountsByBook[book] += occurrence_count;
                 }
             }
         }
@@ -177,6 +364,7 @@ namespace GUI
 
         // UPDATE AND RENDER DEBUGGING WINDOWS.
         MetricsWindow.UpdateAndRender();
+        MemoryUsageWindow.UpdateAndRender(bibles, SearchResultCache);
         StyleEditorWindow.UpdateAndRender();
         DemoWindow.UpdateAndRender();
         AboutWindow.UpdateAndRender();
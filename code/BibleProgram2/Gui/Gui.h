@@ -1,13 +1,17 @@
 #pragma once
 
+#include <cstddef>
 #include <optional>
 #include "BibleData/Bibles.h"
+#include "BibleData/BibleTranslationLoader.h"
+#include "BibleData/CategorizedSearchResultCache.h"
 #include "Graphics/OpenGL/OpenGLGraphicsDevice.h"
 #include "Gui/BibleVerseStatisticsWindow.h"
 #include "Gui/CategorizedBibleVersesWithWordWindow.h"
 #include "Gui/Debugging/AboutWindow.h"
 #include "Gui/Debugging/DemoWindow.h"
 #include "Gui/Debugging/GuiMetricsWindow.h"
+#include "Gui/Debugging/MemoryUsageWindow.h"
 #include "Gui/Debugging/StyleEditorWindow.h"
 #include "Gui/MainBibleVersesWindow.h"
 #include "Gui/UserSelections.h"
@@ -26,6 +30,7 @@ namespace GUI
         void UpdateAndRender(
             const WINDOWING::SdlWindow& window, 
             const BIBLE_DATA::Bibles& bibles,
+            const BIBLE_DATA::BibleTranslationLoader& translation_loader,
             UserSelections& user_selections,
             UserSettings& user_settings);
 
@@ -39,11 +44,17 @@ namespace GUI
         BibleVerseStatisticsWindow BibleVerseStatisticsWindow = {};
         /// A window displaying basic GUI metrics.
         DEBUGGING::GuiMetricsWindow MetricsWindow = {};
+        /// A window displaying memory used by Bible translations and their indexes.
+        DEBUGGING::MemoryUsageWindow MemoryUsageWindow = {};
         /// A window allowing editing of GUI styles.
         DEBUGGING::StyleEditorWindow StyleEditorWindow = {};
         /// A demo window for ImGui features.
         DEBUGGING::DemoWindow DemoWindow = {};
         /// A basic "about" window for the GUI.
         DEBUGGING::AboutWindow AboutWindow = {};
+        /// Recently displayed categorized verses, for quickly displaying them again.
+        BIBLE_DATA::CategorizedSearchResultCache SearchResultCache = {};
+        /// The number of translations available as of the last update, for detecting when more finish loading.
+        std::size_t AvailableTranslationCount = 0;
     };
 }
@@ -31,48 +31,18 @@ namespace GUI
             }
 
             // GET ALL VERSES IN THE RANGE.
+            // Verses in a range are contiguous, so they're found by binary searching and viewed without
+            // storing anything per verse.  Verses are only produced from the view as they're displayed.
             const std::string& translation_name = translation_name_with_display_status.first;
-            std::vector<BIBLE_DATA::BibleVerse> verses;
+            const auto& name_with_bible_translation = bibles.TranslationsByAbbreviatedName.find(translation_name);
+            const BIBLE_DATA::BibleTranslation& bible_translation = name_with_bible_translation->second;
+            BIBLE_DATA::BibleVersesView verses;
             {
                 // TIME VERSE RETRIEVAL FOR ASSESSING PERFORMANCE.
                 ::DEBUGGING::SystemClockTimer system_clock_timer("Bible Verse Finding System Clock Timer");
                 ::DEBUGGING::HighResolutionTimer high_resolution_timer("Bible Verse Finding High-Resolution Timer");
 
-                // GET ALL VERSES IN THE RANGE.
-                const auto& name_with_bible_translation = bibles.TranslationsByAbbreviatedName.find(translation_name);
-                const BIBLE_DATA::BibleTranslation& bible_translation = name_with_bible_translation->second;
-                for (const BIBLE_DATA::BibleVerseIdWithCharacterRange& verse_id_with_character_range : bible_translation.VerseCharacterRanges)
-                {
-                    // CHECK IF THE CURRENT VERSE IS IN THE RANGE.
-                    bool is_matching_verse = (
-                        (verse_range.StartingVerse.Book <= verse_id_with_character_range.Id.Book) && (verse_id_with_character_range.Id.Book <= verse_range.EndingVerse.Book) &&
-                        (verse_range.StartingVerse.ChapterNumber <= verse_id_with_character_range.Id.ChapterNumber) && (verse_id_with_character_range.Id.ChapterNumber <= verse_range.EndingVerse.ChapterNumber) &&
-                        (verse_range.StartingVerse.VerseNumber <= verse_id_with_character_range.Id.VerseNumber) && (verse_id_with_character_range.Id.VerseNumber <= verse_range.EndingVerse.VerseNumber));
-                    if (is_matching_verse)
-                    {
-                        // STORE THE CURRENT VERSE.
-                        const char* first_character_in_verse = bible_translation.Text + verse_id_with_character_range.FirstCharacterOffsetIntoFullBibleText;
-                        std::size_t verse_character_count = (
-                            verse_id_with_character_range.LastCharacterOffsetIntoFullBibleText -
-                            verse_id_with_character_range.FirstCharacterOffsetIntoFullBibleText);
-                        std::string_view current_verse_text = std::string_view(first_character_in_verse, verse_character_count);
-
-                        BIBLE_DATA::BibleVerse current_verse =
-                        {
-                            .Id = verse_id_with_character_range.Id,
-                            .Text = current_verse_text
-                        };
-
-                        verses.emplace_back(current_verse);
-
-                        // STOP CHECKING FOR MORE VERSES IF THE END OF THE RANGE HAS BEEN REACHED.
-                        bool is_final_verse = (verse_id_with_character_range.Id == verse_range.EndingVerse);
-                        if (is_final_verse)
-                        {
-                            break;
-                        }
-                    }
-                }
+                verses = bible_translation.GetVersesInRange(verse_range);
             }
 
             // STORE THE VERSES FOR THE TRANSLATION.
@@ -164,7 +134,7 @@ namespace GUI
                         ImGui::Text(translation_name.c_str());
 
                         // REDNER THE VERSES FOR THE TRANSLATION.
-                        const std::vector<BIBLE_DATA::BibleVerse>& verses_for_translation = VersesByTranslationName[translation_name];
+                        const BIBLE_DATA::BibleVersesView& verses_for_translation = VersesByTranslationName[translation_name];
                         BibleVersesTextPanel::UpdateAndRender(verses_for_translation, user_selections, user_settings);
                     }
                     ImGui::EndChild();
@@ -3,6 +3,7 @@
 #include <string>
 #include <unordered_map>
 #include "BibleData/Bibles.h"
+#include "BibleData/BibleVersesView.h"
 #include "BibleData/BibleVerse.h"
 #include "BibleData/BibleVerseId.h"
 #include "BibleData/BibleVerseRange.h"
@@ -29,6 +30,6 @@ namespace GUI
         /// The range of verses displayed in the window.
         BIBLE_DATA::BibleVerseRange VerseRange = {};
         /// The current verses being displayed.
-        std::unordered_map<std::string, std::vector<BIBLE_DATA::BibleVerse>> VersesByTranslationName = {};
+        std::unordered_map<std::string, BIBLE_DATA::BibleVersesView> VersesByTranslationName = {};
     };
 }
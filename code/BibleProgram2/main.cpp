@@ -1,7 +1,14 @@
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <exception>
+#include <filesystem>
+#include <iterator>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 #include <imgui/backends/imgui_impl_sdl.h>
 #include <SDL/SDL.h>
 #undef main
@@ -12,15 +19,127 @@
 
 #include "BibleData/Bibles.h"
 #include "BibleData/BibleTranslation.h"
+#include "BibleData/BibleTranslationLoader.h"
 #include "BibleData/BibleWordIndex.h"
+#include "BibleData/BibleWordIndexFile.h"
 #include "BibleData/VerseCharacterRanges_KJV.h"
 #include "BibleData/VerseCharacterRanges_WEB.h"
 #include "BibleData/VerseText_KJV.h"
 #include "BibleData/VerseText_WEB.h"
+// The word indexes are only used if they've been precomputed; otherwise, they're built at runtime.
+#if __has_include("BibleData/WordIndex_KJV.h")
+#include "BibleData/WordIndex_KJV.h"
+#endif
+#if __has_include("BibleData/WordIndex_WEB.h")
+#include "BibleData/WordIndex_WEB.h"
+#endif
+// Suffix arrays are similarly only used if they've been precomputed.
+#if __has_include("BibleData/SuffixArray_KJV.h")
+#include "BibleData/SuffixArray_KJV.h"
+#endif
+#if __has_include("BibleData/SuffixArray_WEB.h")
+#include "BibleData/SuffixArray_WEB.h"
+#endif
 #include "Gui/Gui.h"
 #include "Gui/UserSelections.h"
 #include "Gui/UserSettings.h"
 
+/// Gets the path of a word index file that's built at runtime (see BibleWordIndexFile).
+/// Files are kept in the executable's folder so that the same file is found regardless of
+/// the working directory the program is launched from.
+/// @param[in]  filename - The name of the word index file.
+/// @return The path of the word index file.  Relative to the working directory if the executable's folder can't be found.
+std::filesystem::path GetWordIndexFilepath(const std::string_view filename)
+{
+    std::filesystem::path word_index_filepath = filename;
+    char* executable_folder_path = SDL_GetBasePath();
+    if (executable_folder_path)
+    {
+        // SDL paths are UTF-8, which std::filesystem only assumes for UTF-8 character types
+        // (rather than the system code page on Windows).
+        std::filesystem::path executable_folder = reinterpret_cast<const char8_t*>(executable_folder_path);
+        word_index_filepath = executable_folder / filename;
+        SDL_free(executable_folder_path);
+    }
+    return word_index_filepath;
+}
+
+/// Loads the KJV translation, including all of its indexes.
+/// @param[in,out]  translation - The translation to load into.
+void LoadKjvTranslation(BIBLE_DATA::BibleTranslation& translation)
+{
+    DEBUGGING::HighResolutionTimer high_resolution_timer("KJV Loading High-Resolution Timer");
+    translation.Text = BIBLE_DATA::KJV_VERSE_TEXT;
+    translation.VerseCharacterRanges = BIBLE_DATA::KJV_VERSE_CHARACTER_RANGES;
+#if __has_include("BibleData/WordIndex_KJV.h")
+    translation.WordIndex = BIBLE_DATA::BibleWordIndex::FromPrecomputedData(
+        &translation,
+        std::string_view(BIBLE_DATA::KJV_WORD_INDEX_LEXICON_CHARACTERS, std::size(BIBLE_DATA::KJV_WORD_INDEX_LEXICON_CHARACTERS)),
+        BIBLE_DATA::KJV_WORD_INDEX_LEXICON_WORD_OFFSETS,
+        BIBLE_DATA::KJV_WORD_INDEX_POSTING_VERSE_INDICES,
+        BIBLE_DATA::KJV_WORD_INDEX_POSTING_OFFSETS,
+        BIBLE_DATA::KJV_WORD_INDEX_VERSE_WORD_COUNTS,
+        BIBLE_DATA::KJV_WORD_INDEX_WORD_VERSE_COUNTS,
+        BIBLE_DATA::KJV_WORD_INDEX_POSTING_TOKEN_POSITIONS);
+#else
+    // Token positions are included to support phrase searches, and postings are compressed to keep the file small.
+    // The built index is saved to a file so that later runs only need to load it.
+    // Postings are decoded once after loading so that the GUI's word searches can view them directly
+    // rather than decoding them into new memory for every search.
+    unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency());
+    translation.WordIndex = BIBLE_DATA::BibleWordIndexFile::LoadOrBuild(&translation, GetWordIndexFilepath("WordIndex_KJV.bin"), thread_count, true, true);
+    translation.WordIndex = translation.WordIndex.WithUncompressedPostings();
+#endif
+#if __has_include("BibleData/SuffixArray_KJV.h")
+    translation.SuffixArray = BIBLE_DATA::BibleSuffixArray::FromPrecomputedData(
+        &translation,
+        BIBLE_DATA::KJV_SUFFIX_ARRAY_SUFFIX_OFFSETS,
+        BIBLE_DATA::KJV_SUFFIX_ARRAY_LONGEST_COMMON_PREFIX_LENGTHS);
+#else
+    // The suffix array is left empty rather than built on every launch since the GUI doesn't search for substrings.
+#endif
+    // Collocations are only built if the user views them, since most sessions don't.
+    translation.Collocations = BIBLE_DATA::BibleWordCollocations::BuildOnFirstUse(&translation);
+}
+
+/// Loads the WEB translation, including all of its indexes.
+/// @param[in,out]  translation - The translation to load into.
+void LoadWebTranslation(BIBLE_DATA::BibleTranslation& translation)
+{
+    DEBUGGING::HighResolutionTimer high_resolution_timer("WEB Loading High-Resolution Timer");
+    translation.Text = BIBLE_DATA::WEB_VERSE_TEXT;
+    translation.VerseCharacterRanges = BIBLE_DATA::WEB_VERSE_CHARACTER_RANGES;
+#if __has_include("BibleData/WordIndex_WEB.h")
+    translation.WordIndex = BIBLE_DATA::BibleWordIndex::FromPrecomputedData(
+        &translation,
+        std::string_view(BIBLE_DATA::WEB_WORD_INDEX_LEXICON_CHARACTERS, std::size(BIBLE_DATA::WEB_WORD_INDEX_LEXICON_CHARACTERS)),
+        BIBLE_DATA::WEB_WORD_INDEX_LEXICON_WORD_OFFSETS,
+        BIBLE_DATA::WEB_WORD_INDEX_POSTING_VERSE_INDICES,
+        BIBLE_DATA::WEB_WORD_INDEX_POSTING_OFFSETS,
+        BIBLE_DATA::WEB_WORD_INDEX_VERSE_WORD_COUNTS,
+        BIBLE_DATA::WEB_WORD_INDEX_WORD_VERSE_COUNTS,
+        BIBLE_DATA::WEB_WORD_INDEX_POSTING_TOKEN_POSITIONS);
+#else
+    // Token positions are included to support phrase searches, and postings are compressed to keep the file small.
+    // The built index is saved to a file so that later runs only need to load it.
+    // Postings are decoded once after loading so that the GUI's word searches can view them directly
+    // rather than decoding them into new memory for every search.
+    unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency());
+    translation.WordIndex = BIBLE_DATA::BibleWordIndexFile::LoadOrBuild(&translation, GetWordIndexFilepath("WordIndex_WEB.bin"), thread_count, true, true);
+    translation.WordIndex = translation.WordIndex.WithUncompressedPostings();
+#endif
+#if __has_include("BibleData/SuffixArray_WEB.h")
+    translation.SuffixArray = BIBLE_DATA::BibleSuffixArray::FromPrecomputedData(
+        &translation,
+        BIBLE_DATA::WEB_SUFFIX_ARRAY_SUFFIX_OFFSETS,
+        BIBLE_DATA::WEB_SUFFIX_ARRAY_LONGEST_COMMON_PREFIX_LENGTHS);
+#else
+    // The suffix array is left empty rather than built on every launch since the GUI doesn't search for substrings.
+#endif
+    // Collocations are only built if the user views them, since most sessions don't.
+    translation.Collocations = BIBLE_DATA::BibleWordCollocations::BuildOnFirstUse(&translation);
+}
+
 int main()
 {
     std::printf("Starting program...\n");
@@ -36,28 +155,16 @@ int main()
     std::optional<GUI::Gui> gui = std::nullopt;
     try
     {
-        // INITIALIZE BASIC DATA BASED ON BIBLE TRANSLATIONS.
+        // START LOADING BIBLE TRANSLATIONS IN THE BACKGROUND.
+        // Building indexes can take a while, so translations are loaded on separate threads to allow the GUI
+        // to be displayed immediately.  Translations are added to the GUI as they finish loading.
+        // The loader must have a scope for the entire program for the memory of translations to remain valid.
+        BIBLE_DATA::BibleTranslationLoader translation_loader;
         GUI::UserSettings user_settings;
         BIBLE_DATA::Bibles bibles;
-        // The translations must have a scope for the entire program for their memory to remain valid.
-        BIBLE_DATA::BibleTranslation kjv_translation;
-        BIBLE_DATA::BibleTranslation web_translation;
-        {
-            std::printf("Initializing Bible translations...\n");
-            DEBUGGING::SystemClockTimer system_clock_timer("Bible Data Initialization System Clock Timer");
-            DEBUGGING::HighResolutionTimer high_resolution_timer("Bible Data Initialization High-Resolution Timer");
-            kjv_translation.Text = BIBLE_DATA::KJV_VERSE_TEXT;
-            kjv_translation.VerseCharacterRanges = BIBLE_DATA::KJV_VERSE_CHARACTER_RANGES;
-            kjv_translation.WordIndex = BIBLE_DATA::BibleWordIndex::Build(&kjv_translation);
-            bibles.TranslationsByAbbreviatedName[BIBLE_DATA::BibleTranslation::KJV_ABBREVIATED_NAME] = kjv_translation;
-            user_settings.BibleTranslationDisplayStatusesByName[BIBLE_DATA::BibleTranslation::KJV_ABBREVIATED_NAME] = true;
-
-            web_translation.Text = BIBLE_DATA::WEB_VERSE_TEXT;
-            web_translation.VerseCharacterRanges = BIBLE_DATA::WEB_VERSE_CHARACTER_RANGES;
-            web_translation.WordIndex = BIBLE_DATA::BibleWordIndex::Build(&web_translation);
-            bibles.TranslationsByAbbreviatedName[BIBLE_DATA::BibleTranslation::WEB_ABBREVIATED_NAME] = web_translation;
-            user_settings.BibleTranslationDisplayStatusesByName[BIBLE_DATA::BibleTranslation::WEB_ABBREVIATED_NAME] = false;
-        }
+        std::printf("Loading Bible translations...\n");
+        translation_loader.StartLoading(BIBLE_DATA::BibleTranslation::KJV_ABBREVIATED_NAME, LoadKjvTranslation);
+        translation_loader.StartLoading(BIBLE_DATA::BibleTranslation::WEB_ABBREVIATED_NAME, LoadWebTranslation);
 
         // INITIALIZE SDL.
         constexpr uint32_t SDL_SUBSYSTEMS = (SDL_INIT_EVENTS | SDL_INIT_TIMER | SDL_INIT_VIDEO);
@@ -110,10 +217,19 @@ int main()
                 }
             }
 
+            // ADD ANY NEWLY LOADED TRANSLATIONS.
+            // Only the KJV is displayed by default.
+            std::vector<std::string> loaded_translation_names = translation_loader.AddLoadedTranslations(bibles);
+            for (const std::string& loaded_translation_name : loaded_translation_names)
+            {
+                bool is_kjv = (BIBLE_DATA::BibleTranslation::KJV_ABBREVIATED_NAME == loaded_translation_name);
+                user_settings.BibleTranslationDisplayStatusesByName[loaded_translation_name] = is_kjv;
+            }
+
             // UPDATE AND RENDER THE GUI.
             graphics_device->ClearBackground(GRAPHICS::Color::BLACK);
 
-            gui->UpdateAndRender(*window, bibles, user_selections, user_settings);
+            gui->UpdateAndRender(*window, bibles, translation_loader, user_selections, user_settings);
 
             graphics_device->DisplayRenderedImage(*window);
         }
@@ -0,0 +1,839 @@
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include "BibleData/BibleVerseBitmap.h"
+#include "BibleData/BibleVersePhraseMatch.h"
+#include "BibleData/BibleWordIndexFile.h"
+#include "BibleData/BibleWordQuery.h"
+#include "BibleData/CategorizedSearchResultCache.h"
+#include "BibleData/CompressedPostingLists.h"
+#include "SelfChecks.h"
+
+/// Runs all self-checks, printing the results of each.
+/// @param[in]  kjv_translation - The KJV translation, which most checks are run on.
+/// @param[in]  web_translation - The WEB translation, for checks involving other translations.
+/// @return True if all checks passed; false otherwise.
+bool SelfChecks::Run(const BIBLE_DATA::BibleTranslation& kjv_translation, const BIBLE_DATA::BibleTranslation& web_translation)
+{
+    // BUILD INDEXES WITH BOTH FORMS OF POSTINGS.
+    unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency());
+    BIBLE_DATA::BibleWordIndex word_index = BIBLE_DATA::BibleWordIndex::Build(&kjv_translation, thread_count, true, false);
+    BIBLE_DATA::BibleWordIndex compressed_word_index = BIBLE_DATA::BibleWordIndex::Build(&kjv_translation, thread_count, false, true);
+    std::vector<const BIBLE_DATA::BibleWordIndex*> word_indexes = { &word_index, &compressed_word_index };
+
+    // SPLIT VERSES INTO WORDS BY BRUTE FORCE FOR CHECKING SEARCHES.
+    std::vector<std::vector<VerseWord>> words_by_verse = SplitVersesIntoWords(kjv_translation);
+
+    // RUN EACH CHECK.
+    std::size_t total_failure_count = 0;
+    auto run_check = [&](const std::string_view check_name, const std::function<void(CheckFailures&)>& check)
+    {
+        std::cout << check_name << ":" << std::endl;
+        CheckFailures failures;
+        check(failures);
+        if (0 == failures.Count)
+        {
+            std::cout << "\tpassed" << std::endl;
+        }
+        else
+        {
+            std::cout << "\t" << failures.Count << " FAILURES" << std::endl;
+        }
+        total_failure_count += failures.Count;
+    };
+    run_check("Phrase Searches", [&](CheckFailures& failures) { CheckPhraseSearches(word_indexes, words_by_verse, failures); });
+    run_check("Boolean Queries", [&](CheckFailures& failures) { CheckBooleanQueries(word_indexes, words_by_verse, failures); });
+    run_check("Compressed Postings", [&](CheckFailures& failures) { CheckCompressedPostings(word_index, compressed_word_index, failures); });
+    run_check("Verse Bitmaps", [&](CheckFailures& failures) { CheckVerseBitmaps(word_index, web_translation, failures); });
+    run_check("Word Index Files", [&](CheckFailures& failures) { CheckWordIndexFiles(word_indexes, web_translation, failures); });
+    run_check("Search Result Cache", [&](CheckFailures& failures) { CheckSearchResultCache(word_index, failures); });
+    run_check("Matching Verse Cursors", [&](CheckFailures& failures) { CheckMatchingVerseCursors(word_indexes, failures); });
+
+    bool all_checks_passed = (0 == total_failure_count);
+    std::cout << "Self-Checks: " << (all_checks_passed ? "all passed" : std::to_string(total_failure_count) + " FAILURES") << std::endl;
+    return all_checks_passed;
+}
+
+/// Records a failure, printing it unless many failures have already been printed for the same check.
+/// @param[in]  description - Describes the failure.
+void SelfChecks::CheckFailures::Add(const std::string& description)
+{
+    // A single bug can cause failures for thousands of words, which would bury any other output.
+    constexpr std::size_t MAX_PRINTED_FAILURE_COUNT = 10;
+    if (Count < MAX_PRINTED_FAILURE_COUNT)
+    {
+        std::cout << "\tFAILED: " << description << std::endl;
+    }
+    ++Count;
+}
+
+/// Normalizes a word the same way as for indexing.
+/// @param[in]  word - The word to normalize.
+/// @return The normalized word.
+std::string SelfChecks::NormalizeWord(const std::string_view word)
+{
+    BIBLE_DATA::BibleWordIndex::WordNormalizationBuffer word_normalization_buffer;
+    return std::string(BIBLE_DATA::BibleWordIndex::NormalizeWord(word, word_normalization_buffer));
+}
+
+/// Splits the text of every verse into words by brute force, without using any word index.
+/// Words are runs of letters and digits.  Like for indexing, a final word not followed by any other character isn't included.
+/// @param[in]  translation - The translation whose verses to split.
+/// @return The words in each verse, in the same order as the translation's verses.
+std::vector<std::vector<SelfChecks::VerseWord>> SelfChecks::SplitVersesIntoWords(const BIBLE_DATA::BibleTranslation& translation)
+{
+    std::size_t verse_count = translation.VerseCharacterRanges.size();
+    std::vector<std::vector<VerseWord>> words_by_verse(verse_count);
+    for (std::size_t verse_index = 0; verse_index < verse_count; ++verse_index)
+    {
+        std::string_view verse_text = translation.GetVerse(verse_index).Text;
+        std::size_t word_start_character_index = 0;
+        for (std::size_t character_index = 0; character_index < verse_text.size(); ++character_index)
+        {
+            // CHECK IF THE CURRENT CHARACTER ENDS A WORD.
+            bool is_part_of_word = std::isalnum(static_cast<unsigned char>(verse_text[character_index]));
+            if (is_part_of_word)
+            {
+                continue;
+            }
+
+            // ADD ANY WORD THAT WAS ENDED.
+            bool word_exists = (character_index > word_start_character_index);
+            if (word_exists)
+            {
+                std::string_view word = verse_text.substr(word_start_character_index, character_index - word_start_character_index);
+                words_by_verse[verse_index].push_back(VerseWord
+                {
+                    .FirstCharacterOffsetIntoVerseText = word_start_character_index,
+                    .LastCharacterOffsetIntoVerseText = character_index,
+                    .NormalizedWord = NormalizeWord(word),
+                });
+            }
+            word_start_character_index = character_index + 1;
+        }
+    }
+    return words_by_verse;
+}
+
+/// Checks that exact-phrase searches find the same verses and character ranges as searching verse words by brute force.
+/// @param[in]  word_indexes - The indexes to search, which should include indexes with and without token positions.
+/// @param[in]  words_by_verse - The words in each verse, as split by brute force.
+/// @param[in,out]  failures - The failures to add to.
+void SelfChecks::CheckPhraseSearches(
+    const std::vector<const BIBLE_DATA::BibleWordIndex*>& word_indexes,
+    const std::vector<std::vector<VerseWord>>& words_by_verse,
+    CheckFailures& failures)
+{
+    const std::string_view PHRASES[] =
+    {
+        "the lord",
+        "In the beginning",
+        "and it came to pass",
+        "faith",
+        "grace, and peace",
+        "the the",
+        "the lord notaword",
+        "",
+    };
+    for (const std::string_view phrase : PHRASES)
+    {
+        // SPLIT THE PHRASE INTO WORDS.
+        // Unlike for verses, a final word isn't followed by any other character.
+        std::vector<std::string> phrase_words;
+        std::size_t word_start_character_index = 0;
+        for (std::size_t character_index = 0; character_index <= phrase.size(); ++character_index)
+        {
+            bool is_part_of_word = (character_index < phrase.size()) && std::isalnum(static_cast<unsigned char>(phrase[character_index]));
+            if (!is_part_of_word)
+            {
+                if (character_index > word_start_character_index)
+                {
+                    phrase_words.push_back(NormalizeWord(phrase.substr(word_start_character_index, character_index - word_start_character_index)));
+                }
+                word_start_character_index = character_index + 1;
+            }
+        }
+
+        // FIND THE PHRASE IN EACH VERSE BY BRUTE FORCE.
+        std::vector<std::pair<std::size_t, std::vector<BIBLE_DATA::BibleVersePhraseMatch::CharacterRange>>> expected_matches;
+        for (std::size_t verse_index = 0; !phrase_words.empty() && (verse_index < words_by_verse.size()); ++verse_index)
+        {
+            const std::vector<VerseWord>& verse_words = words_by_verse[verse_index];
+            std::vector<BIBLE_DATA::BibleVersePhraseMatch::CharacterRange> match_character_ranges;
+            for (std::size_t start_position = 0; start_position + phrase_words.size() <= verse_words.size(); ++start_position)
+            {
+                bool phrase_starts_here = std::equal(
+                    phrase_words.cbegin(),
+                    phrase_words.cend(),
+                    verse_words.cbegin() + start_position,
+                    [](const std::string& phrase_word, const VerseWord& verse_word) { return phrase_word == verse_word.NormalizedWord; });
+                if (phrase_starts_here)
+                {
+                    match_character_ranges.push_back(
+                    {
+                        .FirstCharacterOffsetIntoVerseText = verse_words[start_position].FirstCharacterOffsetIntoVerseText,
+                        .LastCharacterOffsetIntoVerseText = verse_words[start_position + phrase_words.size() - 1].LastCharacterOffsetIntoVerseText,
+                    });
+                }
+            }
+            if (!match_character_ranges.empty())
+            {
+                expected_matches.emplace_back(verse_index, std::move(match_character_ranges));
+            }
+        }
+
+        // CHECK THAT EACH INDEX FINDS THE SAME MATCHES.
+        for (const BIBLE_DATA::BibleWordIndex* word_index : word_indexes)
+        {
+            std::vector<BIBLE_DATA::BibleVersePhraseMatch> phrase_matches = word_index->GetVersesMatchingPhrase(phrase);
+            bool same_matches = std::equal(
+                phrase_matches.cbegin(),
+                phrase_matches.cend(),
+                expected_matches.cbegin(),
+                expected_matches.cend(),
+                [&](const BIBLE_DATA::BibleVersePhraseMatch& phrase_match, const auto& expected_match)
+                {
+                    const auto& [verse_index, match_character_ranges] = expected_match;
+                    return (phrase_match.Verse.Id == word_index->Bible->GetVerse(verse_index).Id) && std::ranges::equal(
+                        phrase_match.MatchCharacterRanges,
+                        match_character_ranges,
+                        [](const auto& left, const auto& right)
+                        {
+                            return (left.FirstCharacterOffsetIntoVerseText == right.FirstCharacterOffsetIntoVerseText) &&
+                                (left.LastCharacterOffsetIntoVerseText == right.LastCharacterOffsetIntoVerseText);
+                        });
+                });
+            if (!same_matches)
+            {
+                failures.Add(
+                    "\"" + std::string(phrase) + "\" matched " + std::to_string(phrase_matches.size()) + " verses " +
+                    (word_index->HasTokenPositions() ? "with" : "without") + " token positions, but " +
+                    std::to_string(expected_matches.size()) + " by brute force");
+            }
+        }
+    }
+}
+
+/// Checks that invalid boolean queries are rejected and that valid queries match the same verses as brute force.
+/// @param[in]  word_indexes - The indexes to query, which should include indexes with compressed and uncompressed postings.
+/// @param[in]  words_by_verse - The words in each verse, as split by brute force.
+/// @param[in,out]  failures - The failures to add to.
+void SelfChecks::CheckBooleanQueries(
+    const std::vector<const BIBLE_DATA::BibleWordIndex*>& word_indexes,
+    const std::vector<std::vector<VerseWord>>& words_by_verse,
+    CheckFailures& failures)
+{
+    // CHECK THAT INVALID QUERIES ARE REJECTED.
+    const std::string_view INVALID_QUERIES[] =
+    {
+        "",
+        "   ",
+        "AND",
+        "faith AND",
+        "OR faith",
+        "faith OR",
+        "faith AND AND works",
+        "faith NOT",
+        "NOT",
+        "(faith",
+        "faith)",
+        "()",
+        "faith (works",
+    };
+    for (const std::string_view invalid_query : INVALID_QUERIES)
+    {
+        std::optional<BIBLE_DATA::BibleWordQuery> query = BIBLE_DATA::BibleWordQuery::Parse(invalid_query);
+        if (query)
+        {
+            failures.Add("Invalid query \"" + std::string(invalid_query) + "\" was accepted");
+        }
+    }
+
+    // CHECK THAT VALID QUERIES MATCH THE SAME VERSES AS BRUTE FORCE.
+    // Each query is paired with an equivalent condition on whether a verse contains words.
+    using VerseContainsWord = std::function<bool(const std::string_view)>;
+    const std::pair<std::string_view, bool (*)(const VerseContainsWord&)> QUERIES_AND_CONDITIONS[] =
+    {
+        { "faith", [](const VerseContainsWord& contains) { return contains("faith"); } },
+        { "faith AND works", [](const VerseContainsWord& contains) { return contains("faith") && contains("works"); } },
+        { "faith works", [](const VerseContainsWord& contains) { return contains("faith") && contains("works"); } },
+        { "faith OR works OR grace", [](const VerseContainsWord& contains) { return contains("faith") || contains("works") || contains("grace"); } },
+        { "faith NOT law", [](const VerseContainsWord& contains) { return contains("faith") && !contains("law"); } },
+        { "NOT the", [](const VerseContainsWord& contains) { return !contains("the"); } },
+        { "NOT NOT faith", [](const VerseContainsWord& contains) { return contains("faith"); } },
+        { "(faith OR hope) AND (charity OR love)", [](const VerseContainsWord& contains) { return (contains("faith") || contains("hope")) && (contains("charity") || contains("love")); } },
+        { "the AND lord AND NOT (god OR israel)", [](const VerseContainsWord& contains) { return contains("the") && contains("lord") && !(contains("god") || contains("israel")); } },
+        { "Smote OR SHEW", [](const VerseContainsWord& contains) { return contains("smote") || contains("shew"); } },
+        { "grace OR notaword", [](const VerseContainsWord& contains) { return contains("grace") || contains("notaword"); } },
+        { "the AND notaword", [](const VerseContainsWord& contains) { return contains("the") && contains("notaword"); } },
+        // Non-ASCII characters separate words like any other non-word characters.
+        { "faith caf\xC3\xA9", [](const VerseContainsWord& contains) { return contains("faith") && contains("caf"); } },
+    };
+    for (const auto& [query_text, verse_matches] : QUERIES_AND_CONDITIONS)
+    {
+        // PARSE THE QUERY.
+        std::optional<BIBLE_DATA::BibleWordQuery> query = BIBLE_DATA::BibleWordQuery::Parse(query_text);
+        if (!query)
+        {
+            failures.Add("Valid query \"" + std::string(query_text) + "\" was rejected");
+            continue;
+        }
+
+        // FIND MATCHING VERSES BY BRUTE FORCE.
+        std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex> expected_verse_indices;
+        for (std::size_t verse_index = 0; verse_index < words_by_verse.size(); ++verse_index)
+        {
+            const std::vector<VerseWord>& verse_words = words_by_verse[verse_index];
+            VerseContainsWord verse_contains_word = [&](const std::string_view word)
+            {
+                std::string normalized_word = NormalizeWord(word);
+                return std::ranges::any_of(verse_words, [&](const VerseWord& verse_word) { return normalized_word == verse_word.NormalizedWord; });
+            };
+            if (verse_matches(verse_contains_word))
+            {
+                expected_verse_indices.push_back(static_cast<BIBLE_DATA::BibleWordIndex::VerseIndex>(verse_index));
+            }
+        }
+
+        // CHECK THAT EACH INDEX MATCHES THE SAME VERSES.
+        for (const BIBLE_DATA::BibleWordIndex* word_index : word_indexes)
+        {
+            BIBLE_DATA::BibleVerseSet matching_verses = query->Evaluate(*word_index);
+            if (matching_verses.VerseIndices != expected_verse_indices)
+            {
+                failures.Add(
+                    "\"" + std::string(query_text) + "\" matched " + std::to_string(matching_verses.Count()) + " verses with " +
+                    (word_index->HasCompressedPostings() ? "compressed" : "uncompressed") + " postings, but " +
+                    std::to_string(expected_verse_indices.size()) + " by brute force");
+            }
+        }
+    }
+}
+
+/// Checks that compressed postings decode to the same verse indices as uncompressed postings,
+/// and that skipping through compressed postings (including across block boundaries) stops at the same postings
+/// as searching the uncompressed postings.
+/// @param[in]  uncompressed_word_index - An index with uncompressed postings.
+/// @param[in]  compressed_word_index - An index for the same translation with compressed postings.
+/// @param[in,out]  failures - The failures to add to.
+void SelfChecks::CheckCompressedPostings(
+    const BIBLE_DATA::BibleWordIndex& uncompressed_word_index,
+    const BIBLE_DATA::BibleWordIndex& compressed_word_index,
+    CheckFailures& failures)
+{
+    // CHECK THAT THE POSTINGS ARE IN THE EXPECTED FORMS.
+    bool expected_posting_forms = !uncompressed_word_index.HasCompressedPostings() && compressed_word_index.HasCompressedPostings();
+    if (!expected_posting_forms)
+    {
+        failures.Add("Postings weren't compressed as expected");
+        return;
+    }
+
+    // CHECK THAT BOTH INDEXES HAVE THE SAME WORDS.
+    bool same_lexicons = (
+        (uncompressed_word_index.LexiconCharacters == compressed_word_index.LexiconCharacters) &&
+        std::ranges::equal(uncompressed_word_index.LexiconWordOffsets, compressed_word_index.LexiconWordOffsets));
+    if (!same_lexicons)
+    {
+        failures.Add("Different lexicons");
+        return;
+    }
+
+    std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex> uncompressed_buffer;
+    std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex> decoded_verse_indices;
+    std::size_t word_count = uncompressed_word_index.WordCount();
+    for (std::size_t word_index = 0; word_index < word_count; ++word_index)
+    {
+        // CHECK THAT THE DECODED POSTINGS MATCH.
+        std::string word(uncompressed_word_index.GetWord(word_index));
+        std::span<const BIBLE_DATA::BibleWordIndex::VerseIndex> verse_indices = uncompressed_word_index.GetVerseIndices(word_index, uncompressed_buffer);
+        std::span<const BIBLE_DATA::BibleWordIndex::VerseIndex> decoded_span = compressed_word_index.GetVerseIndices(word_index, decoded_verse_indices);
+        bool same_postings = std::ranges::equal(verse_indices, decoded_span) && (verse_indices.size() == compressed_word_index.GetPostingCount(word_index));
+        if (!same_postings)
+        {
+            failures.Add("Different decoded postings for \"" + word + "\"");
+            continue;
+        }
+
+        // CHECK THAT MOVING THROUGH EVERY POSTING PRODUCES THE SAME VERSES.
+        std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex> walked_verse_indices;
+        for (BIBLE_DATA::BibleWordIndex::PostingCursor postings = compressed_word_index.GetPostingCursor(word_index);
+            !postings.AtEnd();
+            postings.MoveToNextPosting())
+        {
+            walked_verse_indices.push_back(postings.CurrentVerseIndex());
+        }
+        if (!std::ranges::equal(verse_indices, walked_verse_indices))
+        {
+            failures.Add("Different postings when moving through each posting for \"" + word + "\"");
+            continue;
+        }
+
+        // CHECK THAT SKIPPING STOPS AT THE SAME POSTINGS.
+        // Skipping by around a block's worth of postings crosses block boundaries at different points within blocks,
+        // and skipping to just past a posting's verse also covers verses without postings for the word.
+        constexpr std::size_t BLOCK_POSTING_COUNT = BIBLE_DATA::CompressedPostingLists::POSTINGS_PER_BLOCK;
+        const std::size_t SKIPPED_POSTING_COUNTS[] = { 1, BLOCK_POSTING_COUNT - 1, BLOCK_POSTING_COUNT, BLOCK_POSTING_COUNT + 1, 5 * BLOCK_POSTING_COUNT };
+        for (const std::size_t skipped_posting_count : SKIPPED_POSTING_COUNTS)
+        {
+            for (const std::size_t verse_offset_past_posting : { 0u, 1u })
+            {
+                BIBLE_DATA::BibleWordIndex::PostingCursor postings = compressed_word_index.GetPostingCursor(word_index);
+                std::size_t expected_posting_index = 0;
+                bool same_skips = true;
+                while (same_skips && (expected_posting_index < verse_indices.size()))
+                {
+                    // SKIP AHEAD TO A LATER POSTING'S VERSE.
+                    // Verses past the last posting move to the end.
+                    std::size_t target_posting_index = expected_posting_index + skipped_posting_count;
+                    std::size_t target_verse_index = (target_posting_index < verse_indices.size()) ?
+                        (verse_indices[target_posting_index] + verse_offset_past_posting) :
+                        (verse_indices.back() + 1);
+                    postings.SkipToVerse(target_verse_index);
+                    std::size_t previous_posting_index = expected_posting_index;
+                    expected_posting_index = static_cast<std::size_t>(std::lower_bound(
+                        verse_indices.begin() + expected_posting_index,
+                        verse_indices.end(),
+                        target_verse_index) - verse_indices.begin());
+
+                    // MAKE SURE PROGRESS IS MADE.
+                    // Skipping doesn't move past repeated postings for the current verse.
+                    bool posting_unchanged = (previous_posting_index == expected_posting_index);
+                    if (posting_unchanged)
+                    {
+                        postings.MoveToNextPosting();
+                        ++expected_posting_index;
+                    }
+
+                    bool expected_at_end = (expected_posting_index >= verse_indices.size());
+                    same_skips = (
+                        (expected_at_end == postings.AtEnd()) &&
+                        (std::min(expected_posting_index, verse_indices.size()) == postings.CurrentPostingIndex()) &&
+                        (expected_at_end || (verse_indices[expected_posting_index] == postings.CurrentVerseIndex())));
+                }
+                if (!same_skips)
+                {
+                    failures.Add(
+                        "Skipping by " + std::to_string(skipped_posting_count) + " postings for \"" + word +
+                        "\" stopped at posting " + std::to_string(postings.CurrentPostingIndex()) +
+                        " instead of " + std::to_string(expected_posting_index));
+                }
+            }
+        }
+    }
+}
+
+/// Checks that set operations on verse bitmaps match the same operations on sorted verse indices.
+/// @param[in]  word_index - The index to get verses to combine from.
+/// @param[in]  other_translation - A translation to convert bitmaps to.
+/// @param[in,out]  failures - The failures to add to.
+void SelfChecks::CheckVerseBitmaps(
+    const BIBLE_DATA::BibleWordIndex& word_index,
+    const BIBLE_DATA::BibleTranslation& other_translation,
+    CheckFailures& failures)
+{
+    // MAP VERSE IDS TO VERSES IN THE OTHER TRANSLATION.
+    std::map<BIBLE_DATA::BibleVerseId, std::size_t> other_verse_indices_by_id;
+    for (std::size_t other_verse_index = 0; other_verse_index < other_translation.VerseCharacterRanges.size(); ++other_verse_index)
+    {
+        other_verse_indices_by_id[other_translation.VerseCharacterRanges[other_verse_index].Id] = other_verse_index;
+    }
+
+    const std::pair<std::string_view, std::string_view> WORD_PAIRS[] =
+    {
+        { "faith", "works" },
+        { "the", "and" },
+        { "lord", "god" },
+        { "grace", "notaword" },
+    };
+    for (const auto& [first_word, second_word] : WORD_PAIRS)
+    {
+        // GET THE VERSES WITH EACH WORD.
+        auto get_verse_indices = [&](const std::string_view word)
+        {
+            std::optional<BIBLE_DATA::BibleWordQuery> query = BIBLE_DATA::BibleWordQuery::Parse(word);
+            return query->Evaluate(word_index).VerseIndices;
+        };
+        std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex> first_verse_indices = get_verse_indices(first_word);
+        std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex> second_verse_indices = get_verse_indices(second_word);
+        BIBLE_DATA::BibleVerseBitmap first_bitmap = BIBLE_DATA::BibleVerseBitmap::FromVerseIndices(word_index.Bible, first_verse_indices);
+        BIBLE_DATA::BibleVerseBitmap second_bitmap = BIBLE_DATA::BibleVerseBitmap::FromVerseIndices(word_index.Bible, second_verse_indices);
+        std::string word_pair_description = "\"" + std::string(first_word) + "\" and \"" + std::string(second_word) + "\"";
+
+        // CHECK THAT THE BITMAP CONTAINS EXACTLY THE ORIGINAL VERSES.
+        bool same_verses = (first_bitmap.ToVerseSet().VerseIndices == first_verse_indices) && (first_bitmap.Count() == first_verse_indices.size());
+        for (std::size_t verse_index = 0; same_verses && (verse_index < word_index.Bible->VerseCharacterRanges.size()); ++verse_index)
+        {
+            same_verses = (first_bitmap.Contains(verse_index) == std::binary_search(first_verse_indices.cbegin(), first_verse_indices.cend(), verse_index));
+        }
+        if (!same_verses)
+        {
+            failures.Add("Bitmap for \"" + std::string(first_word) + "\" has different verses");
+        }
+
+        // CHECK EACH SET OPERATION.
+        using SetOperation = void (BIBLE_DATA::BibleVerseBitmap::*)(const BIBLE_DATA::BibleVerseBitmap&);
+        using SortedSetOperation = std::function<void(
+            const std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex>&,
+            const std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex>&,
+            std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex>&)>;
+        const std::tuple<std::string_view, SetOperation, SortedSetOperation> SET_OPERATIONS[] =
+        {
+            {
+                "intersection",
+                &BIBLE_DATA::BibleVerseBitmap::IntersectWith,
+                [](const auto& first, const auto& second, auto& result) { std::ranges::set_intersection(first, second, std::back_inserter(result)); },
+            },
+            {
+                "union",
+                &BIBLE_DATA::BibleVerseBitmap::UnionWith,
+                [](const auto& first, const auto& second, auto& result) { std::ranges::set_union(first, second, std::back_inserter(result)); },
+            },
+            {
+                "symmetric difference",
+                &BIBLE_DATA::BibleVerseBitmap::SymmetricDifferenceWith,
+                [](const auto& first, const auto& second, auto& result) { std::ranges::set_symmetric_difference(first, second, std::back_inserter(result)); },
+            },
+            {
+                "difference",
+                &BIBLE_DATA::BibleVerseBitmap::Subtract,
+                [](const auto& first, const auto& second, auto& result) { std::ranges::set_difference(first, second, std::back_inserter(result)); },
+            },
+        };
+        for (const auto& [operation_name, set_operation, sorted_set_operation] : SET_OPERATIONS)
+        {
+            BIBLE_DATA::BibleVerseBitmap result_bitmap = first_bitmap;
+            (result_bitmap.*set_operation)(second_bitmap);
+            std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex> expected_verse_indices;
+            sorted_set_operation(first_verse_indices, second_verse_indices, expected_verse_indices);
+            bool same_result = (result_bitmap.ToVerseSet().VerseIndices == expected_verse_indices) && (result_bitmap.Count() == expected_verse_indices.size());
+            if (!same_result)
+            {
+                failures.Add("Different " + std::string(operation_name) + " of " + word_pair_description);
+            }
+        }
+
+        // CHECK CONVERTING TO THE OTHER TRANSLATION.
+        // Only verses existing in both translations are kept.
+        std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex> expected_other_verse_indices;
+        for (const BIBLE_DATA::BibleWordIndex::VerseIndex verse_index : first_verse_indices)
+        {
+            auto other_verse_id_and_index = other_verse_indices_by_id.find(word_index.Bible->VerseCharacterRanges[verse_index].Id);
+            if (other_verse_indices_by_id.end() != other_verse_id_and_index)
+            {
+                expected_other_verse_indices.push_back(static_cast<BIBLE_DATA::BibleWordIndex::VerseIndex>(other_verse_id_and_index->second));
+            }
+        }
+        std::ranges::sort(expected_other_verse_indices);
+        BIBLE_DATA::BibleVerseBitmap other_bitmap = first_bitmap.ForTranslation(&other_translation);
+        bool same_other_verses = (other_bitmap.Bible == &other_translation) && (other_bitmap.ToVerseSet().VerseIndices == expected_other_verse_indices);
+        if (!same_other_verses)
+        {
+            failures.Add("Different verses converting \"" + std::string(first_word) + "\" to another translation");
+        }
+    }
+}
+
+/// Checks that word indexes saved to files load with the same data, and that corrupted or mismatched files are rejected.
+/// @param[in]  word_indexes - The indexes to save, which should include indexes with compressed and uncompressed postings.
+/// @param[in]  other_translation - A translation the saved indexes must not be loaded for.
+/// @param[in,out]  failures - The failures to add to.
+void SelfChecks::CheckWordIndexFiles(
+    const std::vector<const BIBLE_DATA::BibleWordIndex*>& word_indexes,
+    const BIBLE_DATA::BibleTranslation& other_translation,
+    CheckFailures& failures)
+{
+    std::filesystem::path word_index_filepath = std::filesystem::temp_directory_path() / "SelfCheck_WordIndex.bin";
+    std::filesystem::path corrupted_word_index_filepath = std::filesystem::temp_directory_path() / "SelfCheck_CorruptedWordIndex.bin";
+
+    // CHECK THAT INDEXES WITHOUT DATA AREN'T SAVED.
+    if (BIBLE_DATA::BibleWordIndexFile::Save(BIBLE_DATA::BibleWordIndex(), word_index_filepath))
+    {
+        failures.Add("An index without data was saved");
+    }
+
+    for (const BIBLE_DATA::BibleWordIndex* word_index : word_indexes)
+    {
+        // SAVE AND LOAD THE INDEX.
+        std::string index_description = word_index->HasCompressedPostings() ? "compressed index" : "uncompressed index";
+        bool index_saved = BIBLE_DATA::BibleWordIndexFile::Save(*word_index, word_index_filepath);
+        if (!index_saved)
+        {
+            failures.Add("Saving the " + index_description + " failed");
+            continue;
+        }
+        std::optional<BIBLE_DATA::BibleWordIndex> loaded_word_index = BIBLE_DATA::BibleWordIndexFile::Load(word_index->Bible, word_index_filepath);
+        if (!loaded_word_index)
+        {
+            failures.Add("Loading the " + index_description + " failed");
+            continue;
+        }
+
+        // CHECK THAT THE LOADED INDEX HAS THE SAME DATA.
+        bool same_data = (
+            (loaded_word_index->Bible == word_index->Bible) &&
+            (loaded_word_index->LexiconCharacters == word_index->LexiconCharacters) &&
+            std::ranges::equal(loaded_word_index->LexiconWordOffsets, word_index->LexiconWordOffsets) &&
+            std::ranges::equal(loaded_word_index->PostingVerseIndices, word_index->PostingVerseIndices) &&
+            std::ranges::equal(loaded_word_index->PostingOffsets, word_index->PostingOffsets) &&
+            std::ranges::equal(loaded_word_index->PostingTokenPositions, word_index->PostingTokenPositions) &&
+            std::ranges::equal(loaded_word_index->VerseWordCounts, word_index->VerseWordCounts) &&
+            std::ranges::equal(loaded_word_index->WordVerseCounts, word_index->WordVerseCounts) &&
+            std::ranges::equal(loaded_word_index->CompressedPostings.WordFirstBlockIndices, word_index->CompressedPostings.WordFirstBlockIndices) &&
+            std::ranges::equal(loaded_word_index->CompressedPostings.EncodedBytes, word_index->CompressedPostings.EncodedBytes) &&
+            std::ranges::equal(
+                loaded_word_index->CompressedPostings.Blocks,
+                word_index->CompressedPostings.Blocks,
+                [](const BIBLE_DATA::CompressedPostingLists::Block& left, const BIBLE_DATA::CompressedPostingLists::Block& right)
+                {
+                    return (left.ByteOffset == right.ByteOffset) && (left.LastVerseIndex == right.LastVerseIndex) && (left.PostingCount == right.PostingCount);
+                }));
+        if (!same_data)
+        {
+            failures.Add("The loaded " + index_description + " has different data");
+        }
+
+        // CHECK THAT THE INDEX ISN'T LOADED FOR A DIFFERENT TRANSLATION.
+        std::optional<BIBLE_DATA::BibleWordIndex> mismatched_word_index = BIBLE_DATA::BibleWordIndexFile::Load(&other_translation, word_index_filepath);
+        if (mismatched_word_index)
+        {
+            failures.Add("The " + index_description + " was loaded for a different translation");
+        }
+
+        // READ THE SAVED FILE FOR CORRUPTING.
+        // Loaded indexes keep the file mapped, so they must be destroyed before the file can be changed on all platforms.
+        loaded_word_index.reset();
+        std::ifstream word_index_file(word_index_filepath, std::ios::binary);
+        std::vector<char> file_bytes((std::istreambuf_iterator<char>(word_index_file)), std::istreambuf_iterator<char>());
+        word_index_file.close();
+
+        // CHECK THAT CORRUPTED FILES ARE REJECTED.
+        using Header = BIBLE_DATA::BibleWordIndexFile::Header;
+        auto change_header = [](std::vector<char>& bytes, const std::function<void(Header&)>& change)
+        {
+            Header header;
+            std::memcpy(&header, bytes.data(), sizeof(header));
+            change(header);
+            std::memcpy(bytes.data(), &header, sizeof(header));
+        };
+        const std::pair<std::string_view, std::function<void(std::vector<char>&)>> CORRUPTIONS[] =
+        {
+            { "empty", [](std::vector<char>& bytes) { bytes.clear(); } },
+            { "truncated header", [](std::vector<char>& bytes) { bytes.resize(sizeof(Header) / 2); } },
+            { "truncated arrays", [](std::vector<char>& bytes) { bytes.resize(bytes.size() - BIBLE_DATA::BibleWordIndexFile::ARRAY_ALIGNMENT_IN_BYTES); } },
+            { "extra bytes", [](std::vector<char>& bytes) { bytes.resize(bytes.size() + BIBLE_DATA::BibleWordIndexFile::ARRAY_ALIGNMENT_IN_BYTES, 0); } },
+            { "wrong magic bytes", [&](std::vector<char>& bytes) { change_header(bytes, [](Header& header) { header.MagicBytes[0] = 'X'; }); } },
+            { "wrong format version", [&](std::vector<char>& bytes) { change_header(bytes, [](Header& header) { ++header.FormatVersion; }); } },
+            { "wrong word count", [&](std::vector<char>& bytes) { change_header(bytes, [](Header& header) { ++header.WordCount; }); } },
+            { "wrong checksum", [&](std::vector<char>& bytes) { change_header(bytes, [](Header& header) { ++header.ArraysChecksum; }); } },
+            { "changed array byte", [](std::vector<char>& bytes) { bytes[sizeof(Header) + (bytes.size() - sizeof(Header)) / 2] ^= 1; } },
+        };
+        for (const auto& [corruption_description, corrupt] : CORRUPTIONS)
+        {
+            // WRITE THE CORRUPTED FILE.
+            std::vector<char> corrupted_file_bytes = file_bytes;
+            corrupt(corrupted_file_bytes);
+            std::ofstream corrupted_word_index_file(corrupted_word_index_filepath, std::ios::binary | std::ios::trunc);
+            corrupted_word_index_file.write(corrupted_file_bytes.data(), static_cast<std::streamsize>(corrupted_file_bytes.size()));
+            corrupted_word_index_file.close();
+
+            // CHECK THAT IT'S REJECTED.
+            std::optional<BIBLE_DATA::BibleWordIndex> corrupted_word_index = BIBLE_DATA::BibleWordIndexFile::Load(word_index->Bible, corrupted_word_index_filepath);
+            if (corrupted_word_index)
+            {
+                failures.Add("A " + std::string(corruption_description) + " file for the " + index_description + " was loaded");
+            }
+        }
+    }
+
+    // CHECK THAT MISSING FILES AREN'T LOADED.
+    std::error_code remove_error;
+    std::filesystem::remove(word_index_filepath, remove_error);
+    std::filesystem::remove(corrupted_word_index_filepath, remove_error);
+    std::optional<BIBLE_DATA::BibleWordIndex> missing_word_index = BIBLE_DATA::BibleWordIndexFile::Load(word_indexes.front()->Bible, word_index_filepath);
+    if (missing_word_index)
+    {
+        failures.Add("A missing file was loaded");
+    }
+}
+
+/// Checks that the search result cache evicts the least recently used results to stay within its memory budget.
+/// @param[in]  word_index - The index to get results to cache from.
+/// @param[in,out]  failures - The failures to add to.
+void SelfChecks::CheckSearchResultCache(const BIBLE_DATA::BibleWordIndex& word_index, CheckFailures& failures)
+{
+    // GET RESULTS TO CACHE.
+    // The same results are cached for keys that only differ by chapter, so each cached entry has the same size.
+    constexpr std::string_view CACHED_WORD = "faith";
+    BIBLE_DATA::CategorizedBibleVersesView search_results = word_index.GetMatchingVersesView({ BIBLE_DATA::BibleBook::Id::ROMANS, 5, 1 }, CACHED_WORD);
+    auto create_key = [&](const unsigned int chapter_number)
+    {
+        return BIBLE_DATA::CategorizedSearchResultCache::Key::Create(
+            "KJV",
+            { BIBLE_DATA::BibleBook::Id::ROMANS, chapter_number, 1 },
+            CACHED_WORD,
+            BIBLE_DATA::BibleWordIndex::WordMatchType::ROOT_WORD,
+            false);
+    };
+
+    // MEASURE THE SIZE OF A SINGLE ENTRY.
+    BIBLE_DATA::CategorizedSearchResultCache unbounded_cache;
+    unbounded_cache.Insert(create_key(1), search_results);
+    std::size_t entry_size_in_bytes = unbounded_cache.UsedMemoryInBytes;
+    if (0 == entry_size_in_bytes)
+    {
+        failures.Add("Cached results don't use any memory");
+        return;
+    }
+
+    // CHECK THAT REPLACING RESULTS DOESN'T COUNT THEIR MEMORY TWICE.
+    unbounded_cache.Insert(create_key(1), search_results);
+    if (entry_size_in_bytes != unbounded_cache.UsedMemoryInBytes)
+    {
+        failures.Add("Replacing results changed the used memory");
+    }
+
+    // CHECK THAT THE LEAST RECENTLY USED RESULTS ARE EVICTED.
+    // Finding the first results makes the second results the least recently used.
+    BIBLE_DATA::CategorizedSearchResultCache cache(2 * entry_size_in_bytes + entry_size_in_bytes / 2);
+    cache.Insert(create_key(1), search_results);
+    cache.Insert(create_key(2), search_results);
+    bool first_results_found_before_eviction = (nullptr != cache.Find(create_key(1)));
+    cache.Insert(create_key(3), search_results);
+    bool first_results_kept = (nullptr != cache.Find(create_key(1)));
+    bool second_results_evicted = (nullptr == cache.Find(create_key(2)));
+    const BIBLE_DATA::CategorizedBibleVersesView* third_results = cache.Find(create_key(3));
+    bool least_recently_used_evicted = (
+        first_results_found_before_eviction &&
+        first_results_kept &&
+        second_results_evicted &&
+        third_results &&
+        (1 == cache.EvictionCount) &&
+        (2 * entry_size_in_bytes == cache.UsedMemoryInBytes));
+    if (!least_recently_used_evicted)
+    {
+        failures.Add("The least recently used results weren't the only ones evicted");
+    }
+    bool lookups_counted = (3 == cache.HitCount) && (1 == cache.MissCount);
+    if (!lookups_counted)
+    {
+        failures.Add("Cache hits and misses were miscounted");
+    }
+
+    // CHECK THAT CACHED RESULTS ARE UNCHANGED.
+    if (third_results)
+    {
+        auto same_verses = [](const BIBLE_DATA::BibleVersesView& left_verses, const BIBLE_DATA::BibleVersesView& right_verses)
+        {
+            return std::ranges::equal(left_verses, right_verses, [](const BIBLE_DATA::BibleVerse& left, const BIBLE_DATA::BibleVerse& right)
+            {
+                return left.Id == right.Id;
+            });
+        };
+        bool same_results = (
+            same_verses(third_results->VersesInSameChapter, search_results.VersesInSameChapter) &&
+            same_verses(third_results->VersesInSameBook, search_results.VersesInSameBook) &&
+            same_verses(third_results->VersesInOtherBooksByAuthor, search_results.VersesInOtherBooksByAuthor) &&
+            same_verses(third_results->VersesInBooksOfSameGenreByOtherAuthorsInSameTestament, search_results.VersesInBooksOfSameGenreByOtherAuthorsInSameTestament) &&
+            same_verses(third_results->VersesElsewhereInSameTestament, search_results.VersesElsewhereInSameTestament) &&
+            same_verses(third_results->VersesFromOtherTestament, search_results.VersesFromOtherTestament));
+        if (!same_results)
+        {
+            failures.Add("Cached results changed");
+        }
+    }
+
+    // CHECK THAT THE MEMORY BUDGET IS NEVER EXCEEDED.
+    constexpr unsigned int ROMANS_CHAPTER_COUNT = 16;
+    BIBLE_DATA::CategorizedSearchResultCache budgeted_cache(3 * entry_size_in_bytes + entry_size_in_bytes / 2);
+    bool within_budget = true;
+    for (unsigned int chapter_number = 1; chapter_number <= ROMANS_CHAPTER_COUNT; ++chapter_number)
+    {
+        budgeted_cache.Insert(create_key(chapter_number), search_results);
+        within_budget = within_budget && (budgeted_cache.UsedMemoryInBytes <= budgeted_cache.MemoryBudgetInBytes);
+    }
+    bool most_recent_results_kept = (nullptr != budgeted_cache.Find(create_key(ROMANS_CHAPTER_COUNT)));
+    if (!within_budget || !most_recent_results_kept || ((ROMANS_CHAPTER_COUNT - 3) != budgeted_cache.EvictionCount))
+    {
+        failures.Add("The memory budget wasn't kept while inserting many results");
+    }
+
+    // CHECK THAT RESULTS TOO LARGE FOR THE BUDGET AREN'T CACHED.
+    BIBLE_DATA::CategorizedSearchResultCache small_cache(entry_size_in_bytes - 1);
+    small_cache.Insert(create_key(1), search_results);
+    bool too_large_results_cached = (nullptr != small_cache.Find(create_key(1))) || (0 != small_cache.UsedMemoryInBytes);
+    if (too_large_results_cached)
+    {
+        failures.Add("Results larger than the memory budget were cached");
+    }
+}
+
+/// Checks that streaming matching verses (through cursors or callbacks) produces the same verses as getting them all at once.
+/// @param[in]  word_indexes - The indexes to search, which should include indexes with compressed and uncompressed postings.
+/// @param[in,out]  failures - The failures to add to.
+void SelfChecks::CheckMatchingVerseCursors(const std::vector<const BIBLE_DATA::BibleWordIndex*>& word_indexes, CheckFailures& failures)
+{
+    const std::string_view WORDS[] = { "the", "faith", "Believe", "smote", "shew", "LORD", "notaword", "" };
+    const std::pair<std::string_view, BIBLE_DATA::BibleWordIndex::WordMatchType> MATCH_TYPES[] =
+    {
+        { "exact", BIBLE_DATA::BibleWordIndex::WordMatchType::EXACT },
+        { "root word", BIBLE_DATA::BibleWordIndex::WordMatchType::ROOT_WORD },
+        { "stem", BIBLE_DATA::BibleWordIndex::WordMatchType::STEM },
+    };
+    auto same_verses = [](const std::vector<BIBLE_DATA::BibleVerse>& left_verses, const std::vector<BIBLE_DATA::BibleVerse>& right_verses)
+    {
+        return std::ranges::equal(left_verses, right_verses, [](const BIBLE_DATA::BibleVerse& left, const BIBLE_DATA::BibleVerse& right)
+        {
+            return (left.Id == right.Id) && (left.Text.data() == right.Text.data()) && (left.Text.size() == right.Text.size());
+        });
+    };
+    for (const BIBLE_DATA::BibleWordIndex* word_index : word_indexes)
+    {
+        for (const auto& [match_type_name, match_type] : MATCH_TYPES)
+        {
+            for (const std::string_view word : WORDS)
+            {
+                std::string description =
+                    "\"" + std::string(word) + "\" (" + std::string(match_type_name) + ", " +
+                    (word_index->HasCompressedPostings() ? "compressed" : "uncompressed") + " postings)";
+                std::vector<BIBLE_DATA::BibleVerse> matching_verses = word_index->GetMatchingVerses(word, match_type);
+
+                // CHECK THAT A CURSOR PRODUCES THE SAME VERSES.
+                std::vector<BIBLE_DATA::BibleVerse> cursor_verses;
+                BIBLE_DATA::BibleWordIndex::MatchingVerseCursor cursor = word_index->GetMatchingVerseCursor(word, match_type);
+                for (std::optional<BIBLE_DATA::BibleVerse> verse = cursor.Next(); verse; verse = cursor.Next())
+                {
+                    cursor_verses.push_back(*verse);
+                }
+                if (!same_verses(matching_verses, cursor_verses))
+                {
+                    failures.Add("A cursor produced " + std::to_string(cursor_verses.size()) + " verses instead of " + std::to_string(matching_verses.size()) + " for " + description);
+                }
+
+                // CHECK THAT VISITING VERSES PRODUCES THE SAME VERSES.
+                std::vector<BIBLE_DATA::BibleVerse> visited_verses;
+                bool visited_all_verses = word_index->ForEachMatchingVerse(word, [&](const BIBLE_DATA::BibleVerse& verse)
+                {
+                    visited_verses.push_back(verse);
+                    return true;
+                }, match_type);
+                if (!visited_all_verses || !same_verses(matching_verses, visited_verses))
+                {
+                    failures.Add("Visiting produced " + std::to_string(visited_verses.size()) + " verses instead of " + std::to_string(matching_verses.size()) + " for " + description);
+                }
+            }
+        }
+    }
+}
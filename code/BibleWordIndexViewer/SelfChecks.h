@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "BibleData/BibleTranslation.h"
+#include "BibleData/BibleWordIndex.h"
+
+/// Checks that optimized word index features produce the same results as simpler approaches
+/// (such as scanning verse text by brute force), so that changes to them can be verified without the GUI.
+/// Run by passing --self-check to the viewer.
+///
+/// Separate indexes are built for the checks so that both uncompressed postings (with token positions)
+/// and compressed postings (without token positions) are covered, regardless of how the translations were loaded.
+class SelfChecks
+{
+public:
+    static bool Run(const BIBLE_DATA::BibleTranslation& kjv_translation, const BIBLE_DATA::BibleTranslation& web_translation);
+
+private:
+    /// A single word in a verse, as found by splitting verse text by brute force.
+    struct VerseWord
+    {
+        /// The offset into the verse text of the first character of the word.
+        std::size_t FirstCharacterOffsetIntoVerseText = 0;
+        /// The offset into the verse text one past the last character of the word.
+        std::size_t LastCharacterOffsetIntoVerseText = 0;
+        /// The word, normalized the same way as for indexing.
+        std::string NormalizedWord = "";
+    };
+
+    /// The failures found by a single check.
+    struct CheckFailures
+    {
+        void Add(const std::string& description);
+
+        /// The number of failures found.
+        std::size_t Count = 0;
+    };
+
+    static std::string NormalizeWord(const std::string_view word);
+    static std::vector<std::vector<VerseWord>> SplitVersesIntoWords(const BIBLE_DATA::BibleTranslation& translation);
+
+    static void CheckPhraseSearches(
+        const std::vector<const BIBLE_DATA::BibleWordIndex*>& word_indexes,
+        const std::vector<std::vector<VerseWord>>& words_by_verse,
+        CheckFailures& failures);
+    static void CheckBooleanQueries(
+        const std::vector<const BIBLE_DATA::BibleWordIndex*>& word_indexes,
+        const std::vector<std::vector<VerseWord>>& words_by_verse,
+        CheckFailures& failures);
+    static void CheckCompressedPostings(
+        const BIBLE_DATA::BibleWordIndex& uncompressed_word_index,
+        const BIBLE_DATA::BibleWordIndex& compressed_word_index,
+        CheckFailures& failures);
+    static void CheckVerseBitmaps(
+        const BIBLE_DATA::BibleWordIndex& word_index,
+        const BIBLE_DATA::BibleTranslation& other_translation,
+        CheckFailures& failures);
+    static void CheckWordIndexFiles(
+        const std::vector<const BIBLE_DATA::BibleWordIndex*>& word_indexes,
+        const BIBLE_DATA::BibleTranslation& other_translation,
+        CheckFailures& failures);
+    static void CheckSearchResultCache(const BIBLE_DATA::BibleWordIndex& word_index, CheckFailures& failures);
+    static void CheckMatchingVerseCursors(const std::vector<const BIBLE_DATA::BibleWordIndex*>& word_indexes, CheckFailures& failures);
+};
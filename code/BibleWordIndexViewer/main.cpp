@@ -1,57 +1,1523 @@
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
 #include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <map>
+#include <new>
+#include <optional>
+#include <regex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "BibleData/BibleAuthor.h"
+#include "BibleData/BibleBookGenre.h"
+#include "BibleData/BibleTestament.h"
 #include "BibleData/BibleTranslation.h"
+#include "BibleData/BibleVerseBitmap.h"
+#include "BibleData/BibleWordIndexFile.h"
+#include "BibleData/BibleWordQuery.h"
+#include "BibleData/CompressedPostingLists.h"
+#include "BibleData/MemoryUsageReport.h"
 #include "BibleData/VerseCharacterRanges_KJV.h"
 #include "BibleData/VerseCharacterRanges_WEB.h"
 #include "BibleData/VerseText_KJV.h"
 #include "BibleData/VerseText_WEB.h"
+// The word indexes are only used if they've been precomputed; otherwise, they're built at runtime.
+#if __has_include("BibleData/WordIndex_KJV.h")
+#include "BibleData/WordIndex_KJV.h"
+#endif
+#if __has_include("BibleData/WordIndex_WEB.h")
+#include "BibleData/WordIndex_WEB.h"
+#endif
+#if __has_include("BibleData/SuffixArray_KJV.h")
+#include "BibleData/SuffixArray_KJV.h"
+#endif
 #include "Debugging/Timer.h"
+#include "SelfChecks.h"
 
-int main()
+/// The total number of heap allocations made through operator new.
+/// Tracked to be able to measure allocations when benchmarking index building.
+static std::atomic<std::size_t> g_heap_allocation_count = 0;
+
+/// Allocates memory while counting the allocation.
+/// @param[in]  size_in_bytes - The number of bytes to allocate.
+/// @return The allocated memory.
+void* operator new(const std::size_t size_in_bytes)
 {
-    BIBLE_DATA::BibleTranslation kjv_translation;
+    ++g_heap_allocation_count;
+
+    // At least 1 byte must be allocated to have a unique pointer.
+    std::size_t allocation_size_in_bytes = std::max<std::size_t>(size_in_bytes, 1);
+    void* memory = std::malloc(allocation_size_in_bytes);
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+/// Frees memory allocated by the counting operator new.
+/// @param[in]  memory - The memory to free.
+void operator delete(void* const memory) noexcept
+{
+    std::free(memory);
+}
+
+/// Frees memory allocated by the counting operator new.
+/// @param[in]  memory - The memory to free.
+void operator delete(void* const memory, const std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+/// The number of microseconds in a millisecond, for printing longer times.
+constexpr double MICROSECONDS_PER_MILLISECOND = 1000.0;
+
+/// Measures the average time to run code being benchmarked.
+/// @param[in]  repetition_count - The number of times to run the code.
+/// @param[in]  code_to_time - The code to run.
+/// @return The average time for a single run, in microseconds.
+template <typename CodeToTime>
+static double AverageTimeInMicroseconds(const std::size_t repetition_count, const CodeToTime& code_to_time)
+{
+    auto start_time = std::chrono::high_resolution_clock::now();
+    for (std::size_t repetition = 0; repetition < repetition_count; ++repetition)
+    {
+        code_to_time();
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::micro>(end_time - start_time).count() / repetition_count;
+}
+
+/// Describes whether a benchmarked approach produced the same results as the approach it was checked against.
+/// @param[in]  identical_results - True if both approaches produced identical results.
+/// @return Text to print for the comparison.
+static const char* DescribeComparison(const bool identical_results)
+{
+    return identical_results ? "identical" : "DIFFERENT";
+}
+
+/// Prints the time for a benchmarked approach compared against a baseline approach.
+/// @param[in]  description - Describes what was benchmarked and what it found.
+/// @param[in]  time_in_microseconds - The time for the benchmarked approach.
+/// @param[in]  baseline_name - The name of the baseline approach.
+/// @param[in]  baseline_time_in_microseconds - The time for the baseline approach.
+/// @param[in]  identical_results - True if both approaches produced identical results.
+static void PrintComparison(
+    const std::string_view description,
+    const double time_in_microseconds,
+    const std::string_view baseline_name,
+    const double baseline_time_in_microseconds,
+    const bool identical_results)
+{
+    double speedup = baseline_time_in_microseconds / time_in_microseconds;
+    std::cout
+        << description << ": " << time_in_microseconds << " us (" << baseline_name << ": " << baseline_time_in_microseconds << " us, speedup "
+        << speedup << "x, " << DescribeComparison(identical_results) << ")" << std::endl;
+}
+
+/// Loads the KJV translation, using precomputed indexes if they exist.
+/// @param[in,out]  translation - The translation to load into.
+static void LoadKjvTranslation(BIBLE_DATA::BibleTranslation& translation)
+{
+    DEBUGGING::SystemClockTimer system_clock_timer("KJV System Clock Timer");
+    DEBUGGING::HighResolutionTimer high_resolution_timer("KJV High-Resolution Timer");
+    translation.Text = BIBLE_DATA::KJV_VERSE_TEXT;
+    translation.VerseCharacterRanges = BIBLE_DATA::KJV_VERSE_CHARACTER_RANGES;
+#if __has_include("BibleData/WordIndex_KJV.h")
+    translation.WordIndex = BIBLE_DATA::BibleWordIndex::FromPrecomputedData(
+        &translation,
+        std::string_view(BIBLE_DATA::KJV_WORD_INDEX_LEXICON_CHARACTERS, std::size(BIBLE_DATA::KJV_WORD_INDEX_LEXICON_CHARACTERS)),
+        BIBLE_DATA::KJV_WORD_INDEX_LEXICON_WORD_OFFSETS,
+        BIBLE_DATA::KJV_WORD_INDEX_POSTING_VERSE_INDICES,
+        BIBLE_DATA::KJV_WORD_INDEX_POSTING_OFFSETS,
+        BIBLE_DATA::KJV_WORD_INDEX_VERSE_WORD_COUNTS,
+        BIBLE_DATA::KJV_WORD_INDEX_WORD_VERSE_COUNTS,
+        BIBLE_DATA::KJV_WORD_INDEX_POSTING_TOKEN_POSITIONS);
+#else
+    translation.WordIndex = BIBLE_DATA::BibleWordIndex::Build(&translation);
+#endif
+#if __has_include("BibleData/SuffixArray_KJV.h")
+    translation.SuffixArray = BIBLE_DATA::BibleSuffixArray::FromPrecomputedData(
+        &translation,
+        BIBLE_DATA::KJV_SUFFIX_ARRAY_SUFFIX_OFFSETS,
+        BIBLE_DATA::KJV_SUFFIX_ARRAY_LONGEST_COMMON_PREFIX_LENGTHS);
+#else
+    translation.SuffixArray = BIBLE_DATA::BibleSuffixArray::Build(&translation);
+#endif
+}
+
+/// Loads the WEB translation, using a precomputed word index if it exists.
+/// @param[in,out]  translation - The translation to load into.
+static void LoadWebTranslation(BIBLE_DATA::BibleTranslation& translation)
+{
+    DEBUGGING::SystemClockTimer system_clock_timer("WEB System Clock Timer");
+    DEBUGGING::HighResolutionTimer high_resolution_timer("WEB High-Resolution Timer");
+    translation.Text = BIBLE_DATA::WEB_VERSE_TEXT;
+    translation.VerseCharacterRanges = BIBLE_DATA::WEB_VERSE_CHARACTER_RANGES;
+#if __has_include("BibleData/WordIndex_WEB.h")
+    translation.WordIndex = BIBLE_DATA::BibleWordIndex::FromPrecomputedData(
+        &translation,
+        std::string_view(BIBLE_DATA::WEB_WORD_INDEX_LEXICON_CHARACTERS, std::size(BIBLE_DATA::WEB_WORD_INDEX_LEXICON_CHARACTERS)),
+        BIBLE_DATA::WEB_WORD_INDEX_LEXICON_WORD_OFFSETS,
+        BIBLE_DATA::WEB_WORD_INDEX_POSTING_VERSE_INDICES,
+        BIBLE_DATA::WEB_WORD_INDEX_POSTING_OFFSETS,
+        BIBLE_DATA::WEB_WORD_INDEX_VERSE_WORD_COUNTS,
+        BIBLE_DATA::WEB_WORD_INDEX_WORD_VERSE_COUNTS,
+        BIBLE_DATA::WEB_WORD_INDEX_POSTING_TOKEN_POSITIONS);
+#else
+    translation.WordIndex = BIBLE_DATA::BibleWordIndex::Build(&translation);
+#endif
+}
+
+/// Prints every word in a translation's word index with its number of occurrences.
+/// @param[in]  translation_name - The name of the translation.
+/// @param[in]  translation - The translation to print.
+static void PrintWordIndex(const std::string_view translation_name, const BIBLE_DATA::BibleTranslation& translation)
+{
+    std::string timer_name_prefix = std::string(translation_name) + " Print ";
+    std::string system_clock_timer_name = timer_name_prefix + "System Clock Timer";
+    std::string high_resolution_timer_name = timer_name_prefix + "High-Resolution Timer";
+    DEBUGGING::SystemClockTimer system_clock_timer(system_clock_timer_name.c_str());
+    DEBUGGING::HighResolutionTimer high_resolution_timer(high_resolution_timer_name.c_str());
+
+    std::cout << translation_name << " Word Index:" << std::endl;
+    std::size_t word_count = translation.WordIndex.WordCount();
+    for (std::size_t word_index = 0; word_index < word_count; ++word_index)
+    {
+        std::string_view word = translation.WordIndex.GetWord(word_index);
+        std::size_t verse_count = translation.WordIndex.GetPostingCount(word_index);
+        std::cout << word << " = " << verse_count << std::endl;
+    }
+}
+
+/// Benchmarks building word indexes at runtime with different numbers of threads.
+/// This is done regardless of whether precomputed indexes exist since runtime building
+/// is still needed for translations without precomputed data.
+/// @param[in]  kjv_translation - The KJV translation.
+/// @param[in]  web_translation - The WEB translation.
+static void BenchmarkBuildScaling(const BIBLE_DATA::BibleTranslation& kjv_translation, const BIBLE_DATA::BibleTranslation& web_translation)
+{
+    unsigned int max_thread_count = std::max(1u, std::thread::hardware_concurrency());
+    for (const auto& [translation_name, bible_translation] : { std::pair("KJV", &kjv_translation), std::pair("WEB", &web_translation) })
+    {
+        std::cout << translation_name << " Build Scaling:" << std::endl;
+
+        BIBLE_DATA::BibleWordIndex single_threaded_word_index;
+        double single_threaded_build_time_in_milliseconds = 0.0;
+        for (unsigned int thread_count = 1; thread_count <= max_thread_count; ++thread_count)
+        {
+            // TIME BUILDING THE INDEX.
+            std::size_t heap_allocation_count_before_build = g_heap_allocation_count;
+            BIBLE_DATA::BibleWordIndex word_index;
+            double build_time_in_milliseconds = AverageTimeInMicroseconds(1, [&]()
+            {
+                word_index = BIBLE_DATA::BibleWordIndex::Build(bible_translation, thread_count);
+            }) / MICROSECONDS_PER_MILLISECOND;
+            std::size_t build_heap_allocation_count = g_heap_allocation_count - heap_allocation_count_before_build;
+
+            // COMPARE AGAINST THE SINGLE-THREADED BUILD.
+            bool is_single_threaded = (1 == thread_count);
+            if (is_single_threaded)
+            {
+                single_threaded_word_index = word_index;
+                single_threaded_build_time_in_milliseconds = build_time_in_milliseconds;
+            }
+            bool identical_to_single_threaded = (
+                std::ranges::equal(word_index.LexiconCharacters, single_threaded_word_index.LexiconCharacters) &&
+                std::ranges::equal(word_index.LexiconWordOffsets, single_threaded_word_index.LexiconWordOffsets) &&
+                std::ranges::equal(word_index.PostingVerseIndices, single_threaded_word_index.PostingVerseIndices) &&
+                std::ranges::equal(word_index.PostingOffsets, single_threaded_word_index.PostingOffsets) &&
+                std::ranges::equal(word_index.VerseWordCounts, single_threaded_word_index.VerseWordCounts) &&
+                std::ranges::equal(word_index.WordVerseCounts, single_threaded_word_index.WordVerseCounts));
+            double speedup = single_threaded_build_time_in_milliseconds / build_time_in_milliseconds;
+
+            std::cout
+                << thread_count << " thread(s): " << build_time_in_milliseconds << " ms, "
+                << build_heap_allocation_count << " heap allocations"
+                << " (speedup " << speedup << "x, "
+                << DescribeComparison(identical_to_single_threaded) << ")" << std::endl;
+        }
+    }
+}
+
+/// Benchmarks root word lookups in the perfect hash map against a standard hash map.
+/// @param[in]  kjv_translation - The KJV translation, whose words are looked up.
+static void BenchmarkRootWordLookups(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    // BUILD A STANDARD HASH MAP WITH THE SAME ROOT WORDS.
+    std::unordered_map<std::string, std::string, BIBLE_DATA::TransparentStringHash, std::equal_to<>> root_words_by_original_word;
+    for (const BIBLE_DATA::PerfectHashStringMap::Entry& root_word_entry : BIBLE_DATA::BibleWordIndex::RootWordsByOriginalWord.GetEntries())
+    {
+        root_words_by_original_word.emplace(root_word_entry.Key, root_word_entry.Value);
+    }
+
+    // LOOK UP ALL WORDS IN THE KJV AND ALL ROOT WORD KEYS.
+    // This mixes words with and without root words, similar to real lookups.
+    std::vector<std::string_view> words_to_look_up;
+    for (std::size_t word_index = 0; word_index < kjv_translation.WordIndex.WordCount(); ++word_index)
+    {
+        words_to_look_up.push_back(kjv_translation.WordIndex.GetWord(word_index));
+    }
+    for (const BIBLE_DATA::PerfectHashStringMap::Entry& root_word_entry : BIBLE_DATA::BibleWordIndex::RootWordsByOriginalWord.GetEntries())
     {
-        DEBUGGING::SystemClockTimer system_clock_timer("KJV System Clock Timer");
-        DEBUGGING::HighResolutionTimer high_resolution_timer("KJV High-Resolution Timer");
-        kjv_translation.Text = BIBLE_DATA::KJV_VERSE_TEXT;
-        kjv_translation.VerseCharacterRanges = BIBLE_DATA::KJV_VERSE_CHARACTER_RANGES;
-        kjv_translation.WordIndex = BIBLE_DATA::BibleWordIndex::Build(&kjv_translation);
+        words_to_look_up.push_back(root_word_entry.Key);
     }
 
+    // TIME LOOKUPS IN EACH MAP.
+    // The lengths of found root words are summed to keep lookups from being optimized out.
+    constexpr std::size_t LOOKUP_PASS_COUNT = 100;
+    std::size_t hash_map_root_word_character_count = 0;
+    double hash_map_time_in_microseconds = AverageTimeInMicroseconds(LOOKUP_PASS_COUNT, [&]()
     {
-        DEBUGGING::SystemClockTimer system_clock_timer("KJV Print System Clock Timer");
-        DEBUGGING::HighResolutionTimer high_resolution_timer("KJV Print High-Resolution Timer");
-        
-        std::cout << "KJV Word Index:" << std::endl;
-        for (const auto&[word, verses] : kjv_translation.WordIndex.BibleVersesByWord)
+        for (const std::string_view word : words_to_look_up)
+        {
+            auto word_and_root_word = root_words_by_original_word.find(word);
+            if (root_words_by_original_word.cend() != word_and_root_word)
+            {
+                hash_map_root_word_character_count += word_and_root_word->second.size();
+            }
+        }
+    });
+
+    std::size_t perfect_hash_map_root_word_character_count = 0;
+    double perfect_hash_map_time_in_microseconds = AverageTimeInMicroseconds(LOOKUP_PASS_COUNT, [&]()
+    {
+        for (const std::string_view word : words_to_look_up)
+        {
+            std::optional<std::string_view> root_word = BIBLE_DATA::BibleWordIndex::RootWordsByOriginalWord.Find(word);
+            if (root_word)
+            {
+                perfect_hash_map_root_word_character_count += root_word->size();
+            }
+        }
+    });
+
+    // CHECK THAT BOTH MAPS FIND THE SAME ROOT WORDS.
+    bool identical_results = (hash_map_root_word_character_count == perfect_hash_map_root_word_character_count);
+    for (const std::string_view word : words_to_look_up)
+    {
+        auto word_and_root_word = root_words_by_original_word.find(word);
+        std::optional<std::string_view> hash_map_root_word;
+        if (root_words_by_original_word.cend() != word_and_root_word)
+        {
+            hash_map_root_word = word_and_root_word->second;
+        }
+
+        std::optional<std::string_view> perfect_hash_map_root_word = BIBLE_DATA::BibleWordIndex::RootWordsByOriginalWord.Find(word);
+        if (hash_map_root_word != perfect_hash_map_root_word)
         {
-            std::size_t verse_count = verses.size();
-            std::cout << word << " = " << verse_count << std::endl;
+            identical_results = false;
+            break;
         }
     }
 
-    std::cout << "---------------------------------------------------" << std::endl;
+    std::string description =
+        "Root Word Lookups (" + std::to_string(words_to_look_up.size()) + " words, " +
+        std::to_string(perfect_hash_map_root_word_character_count / LOOKUP_PASS_COUNT) + " root word characters), PerfectHashStringMap";
+    PrintComparison(description, perfect_hash_map_time_in_microseconds, "std::unordered_map", hash_map_time_in_microseconds, identical_results);
+}
 
-    BIBLE_DATA::BibleTranslation web_translation;
+/// Benchmarks boolean queries against getting verses for each word and intersecting them by hand.
+/// Conjunctions of common words are the worst case since their posting lists are the longest.
+/// @param[in]  kjv_translation - The KJV translation to query.
+static void BenchmarkBooleanQueries(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    const std::pair<std::string_view, std::vector<std::string_view>> BOOLEAN_QUERIES_AND_WORDS[] =
+    {
+        { "the AND lord", { "the", "lord" } },
+        { "and AND the AND of", { "and", "the", "of" } },
+        { "shall AND unto AND lord", { "shall", "unto", "lord" } },
+        { "faith AND works", { "faith", "works" } },
+    };
+    std::cout << "KJV Boolean Queries:" << std::endl;
+    for (const auto& [query_text, query_words] : BOOLEAN_QUERIES_AND_WORDS)
+    {
+        // TIME EVALUATING THE QUERY.
+        constexpr std::size_t QUERY_REPETITION_COUNT = 10;
+        std::optional<BIBLE_DATA::BibleWordQuery> query = BIBLE_DATA::BibleWordQuery::Parse(query_text);
+        BIBLE_DATA::BibleVerseSet query_verses;
+        double query_time_in_microseconds = AverageTimeInMicroseconds(QUERY_REPETITION_COUNT, [&]()
+        {
+            query_verses = query->Evaluate(kjv_translation.WordIndex);
+        });
+
+        // TIME GETTING VERSES FOR EACH WORD AND INTERSECTING THEM BY HAND.
+        auto by_verse_id = [](const BIBLE_DATA::BibleVerse& left, const BIBLE_DATA::BibleVerse& right)
+        {
+            return left.Id < right.Id;
+        };
+        auto same_verse_id = [](const BIBLE_DATA::BibleVerse& left, const BIBLE_DATA::BibleVerse& right)
+        {
+            return left.Id == right.Id;
+        };
+        std::vector<BIBLE_DATA::BibleVerse> intersected_verses;
+        double intersection_time_in_microseconds = AverageTimeInMicroseconds(QUERY_REPETITION_COUNT, [&]()
+        {
+            intersected_verses = kjv_translation.WordIndex.GetMatchingVerses(query_words.front());
+            std::sort(intersected_verses.begin(), intersected_verses.end(), by_verse_id);
+            intersected_verses.erase(std::unique(intersected_verses.begin(), intersected_verses.end(), same_verse_id), intersected_verses.end());
+            for (std::size_t word_index = 1; word_index < query_words.size(); ++word_index)
+            {
+                std::vector<BIBLE_DATA::BibleVerse> word_verses = kjv_translation.WordIndex.GetMatchingVerses(query_words[word_index]);
+                std::sort(word_verses.begin(), word_verses.end(), by_verse_id);
+
+                std::vector<BIBLE_DATA::BibleVerse> verses_with_all_words;
+                std::set_intersection(
+                    intersected_verses.cbegin(),
+                    intersected_verses.cend(),
+                    word_verses.cbegin(),
+                    word_verses.cend(),
+                    std::back_inserter(verses_with_all_words),
+                    by_verse_id);
+                intersected_verses = std::move(verses_with_all_words);
+            }
+        });
+
+        // CHECK THAT BOTH APPROACHES FOUND THE SAME VERSES.
+        std::vector<BIBLE_DATA::BibleVerse> query_verse_list = query_verses.GetVerses();
+        bool identical_results = std::equal(
+            query_verse_list.cbegin(),
+            query_verse_list.cend(),
+            intersected_verses.cbegin(),
+            intersected_verses.cend(),
+            same_verse_id);
+
+        std::string description = std::string(query_text) + ": " + std::to_string(query_verses.Count()) + " verses";
+        PrintComparison(description, query_time_in_microseconds, "by hand", intersection_time_in_microseconds, identical_results);
+    }
+}
+
+/// Benchmarks word completions for short prefixes, from a single thread and from many concurrent readers.
+/// Short prefixes match the most words, so they're the worst case for autocompleting typed words.
+/// @param[in]  kjv_translation - The KJV translation whose words are completed.
+static void BenchmarkWordCompletions(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    constexpr std::size_t MAX_COMPLETION_WORD_COUNT = 10;
+    const std::string_view COMPLETION_PREFIXES[] = { "a", "th", "s", "" };
+    std::cout << "KJV Word Completions (top " << MAX_COMPLETION_WORD_COUNT << "):" << std::endl;
+    for (const std::string_view prefix : COMPLETION_PREFIXES)
+    {
+        // TIME GETTING COMPLETIONS FROM A SINGLE THREAD.
+        constexpr std::size_t COMPLETION_REPETITION_COUNT = 1000;
+        std::vector<BIBLE_DATA::BibleWordIndex::WordCompletion> word_completions;
+        double completion_time_in_microseconds = AverageTimeInMicroseconds(COMPLETION_REPETITION_COUNT, [&]()
+        {
+            word_completions = kjv_translation.WordIndex.GetWordsWithPrefix(prefix, MAX_COMPLETION_WORD_COUNT);
+        });
+
+        // COUNT ALL WORDS WITH THE PREFIX.
+        std::size_t word_with_prefix_count = 0;
+        for (std::size_t word_index = 0; word_index < kjv_translation.WordIndex.WordCount(); ++word_index)
+        {
+            if (kjv_translation.WordIndex.GetWord(word_index).starts_with(prefix))
+            {
+                ++word_with_prefix_count;
+            }
+        }
+
+        // GET COMPLETIONS FROM MULTIPLE THREADS AT ONCE.
+        // Every thread should get the same completions as the single thread since the index is only read.
+        // Each round has every thread get completions once, so the total time is divided by the number of rounds.
+        auto same_word_completion = [](
+            const BIBLE_DATA::BibleWordIndex::WordCompletion& left,
+            const BIBLE_DATA::BibleWordIndex::WordCompletion& right)
+        {
+            return (left.Word == right.Word) && (left.OccurrenceCount == right.OccurrenceCount);
+        };
+        unsigned int reader_thread_count = std::max(2u, std::thread::hardware_concurrency());
+        std::atomic<std::size_t> different_completion_count = 0;
+        double concurrent_time_in_microseconds = AverageTimeInMicroseconds(1, [&]()
+        {
+            std::vector<std::thread> reader_threads;
+            for (unsigned int thread_index = 0; thread_index < reader_thread_count; ++thread_index)
+            {
+                reader_threads.emplace_back([&]()
+                {
+                    for (std::size_t repetition = 0; repetition < COMPLETION_REPETITION_COUNT; ++repetition)
+                    {
+                        std::vector<BIBLE_DATA::BibleWordIndex::WordCompletion> thread_word_completions = kjv_translation.WordIndex.GetWordsWithPrefix(
+                            prefix,
+                            MAX_COMPLETION_WORD_COUNT);
+                        bool identical_completions = std::equal(
+                            thread_word_completions.cbegin(),
+                            thread_word_completions.cend(),
+                            word_completions.cbegin(),
+                            word_completions.cend(),
+                            same_word_completion);
+                        if (!identical_completions)
+                        {
+                            ++different_completion_count;
+                        }
+                    }
+                });
+            }
+            for (std::thread& reader_thread : reader_threads)
+            {
+                reader_thread.join();
+            }
+        }) / COMPLETION_REPETITION_COUNT;
+
+        std::cout << "\"" << prefix << "\" (" << word_with_prefix_count << " words): " << completion_time_in_microseconds << " us";
+        for (const BIBLE_DATA::BibleWordIndex::WordCompletion& word_completion : word_completions)
+        {
+            std::cout << " " << word_completion.Word << "(" << word_completion.OccurrenceCount << ")";
+        }
+        std::cout << std::endl;
+        std::cout
+            << "    " << reader_thread_count << " concurrent readers: " << concurrent_time_in_microseconds << " us per round ("
+            << DescribeComparison(0 == different_completion_count) << ")" << std::endl;
+    }
+}
+
+/// Computes the Levenshtein edit distance between two words.
+/// @param[in]  first_word - The first word to compare.
+/// @param[in]  second_word - The second word to compare.
+/// @return The minimum number of single-character insertions, deletions, or substitutions between the words.
+static std::size_t ComputeEditDistance(const std::string_view first_word, const std::string_view second_word)
+{
+    std::vector<std::size_t> previous_row(second_word.size() + 1);
+    std::vector<std::size_t> current_row(second_word.size() + 1);
+    for (std::size_t second_prefix_length = 0; second_prefix_length <= second_word.size(); ++second_prefix_length)
+    {
+        previous_row[second_prefix_length] = second_prefix_length;
+    }
+    for (std::size_t first_prefix_length = 1; first_prefix_length <= first_word.size(); ++first_prefix_length)
+    {
+        current_row[0] = first_prefix_length;
+        for (std::size_t second_prefix_length = 1; second_prefix_length <= second_word.size(); ++second_prefix_length)
+        {
+            std::size_t substitution_cost = (first_word[first_prefix_length - 1] == second_word[second_prefix_length - 1]) ? 0 : 1;
+            current_row[second_prefix_length] = std::min({
+                previous_row[second_prefix_length] + 1,
+                current_row[second_prefix_length - 1] + 1,
+                previous_row[second_prefix_length - 1] + substitution_cost });
+        }
+        std::swap(previous_row, current_row);
+    }
+    return previous_row[second_word.size()];
+}
+
+/// Benchmarks finding similar words against computing the edit distance to every word in the lexicon.
+/// Misspellings of older KJV spellings are used since they're likely in real searches.
+/// @param[in]  kjv_translation - The KJV translation whose lexicon is searched.
+static void BenchmarkSimilarWords(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    constexpr std::size_t MAX_SIMILAR_WORD_EDIT_DISTANCE = 2;
+    const std::string_view MISSPELLED_WORDS[] = { "shewe", "sayst", "hat", "rightous", "jerusalim" };
+    std::cout << "KJV Similar Words (edit distance " << MAX_SIMILAR_WORD_EDIT_DISTANCE << "):" << std::endl;
+    for (const std::string_view misspelled_word : MISSPELLED_WORDS)
+    {
+        // TIME FINDING SIMILAR WORDS.
+        constexpr std::size_t SIMILAR_WORD_REPETITION_COUNT = 100;
+        std::vector<BIBLE_DATA::BibleWordIndex::SimilarWord> similar_words;
+        double similar_words_time_in_microseconds = AverageTimeInMicroseconds(SIMILAR_WORD_REPETITION_COUNT, [&]()
+        {
+            similar_words = kjv_translation.WordIndex.FindSimilarWords(misspelled_word, MAX_SIMILAR_WORD_EDIT_DISTANCE);
+        });
+
+        // TIME COMPUTING THE EDIT DISTANCE TO EVERY WORD IN THE LEXICON.
+        std::vector<std::size_t> scanned_similar_word_indices;
+        double scan_time_in_microseconds = AverageTimeInMicroseconds(SIMILAR_WORD_REPETITION_COUNT, [&]()
+        {
+            scanned_similar_word_indices.clear();
+            for (std::size_t word_index = 0; word_index < kjv_translation.WordIndex.WordCount(); ++word_index)
+            {
+                std::size_t edit_distance = ComputeEditDistance(kjv_translation.WordIndex.GetWord(word_index), misspelled_word);
+                if (edit_distance <= MAX_SIMILAR_WORD_EDIT_DISTANCE)
+                {
+                    scanned_similar_word_indices.push_back(word_index);
+                }
+            }
+        });
+
+        // CHECK THAT BOTH APPROACHES FOUND THE SAME WORDS.
+        std::vector<std::size_t> similar_word_indices;
+        for (const BIBLE_DATA::BibleWordIndex::SimilarWord& similar_word : similar_words)
+        {
+            similar_word_indices.push_back(similar_word.WordIndex);
+        }
+        std::sort(similar_word_indices.begin(), similar_word_indices.end());
+        bool identical_results = (similar_word_indices == scanned_similar_word_indices);
+
+        std::string description = std::string(misspelled_word) + ": " + std::to_string(similar_words.size()) + " words";
+        PrintComparison(description, similar_words_time_in_microseconds, "full scan", scan_time_in_microseconds, identical_results);
+        std::cout << "   ";
+        for (const BIBLE_DATA::BibleWordIndex::SimilarWord& similar_word : similar_words)
+        {
+            std::cout << " " << similar_word.Word;
+        }
+        std::cout << std::endl;
+    }
+}
+
+/// Benchmarks building the suffix array.
+/// This is done regardless of whether a precomputed suffix array exists to track how long building takes.
+/// @param[in]  kjv_translation - The KJV translation, whose current suffix array is compared against.
+static void BenchmarkSuffixArray(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    BIBLE_DATA::BibleSuffixArray built_suffix_array;
+    double build_time_in_milliseconds = AverageTimeInMicroseconds(1, [&]()
+    {
+        built_suffix_array = BIBLE_DATA::BibleSuffixArray::Build(&kjv_translation);
+    }) / MICROSECONDS_PER_MILLISECOND;
+
+    bool identical_to_current_suffix_array = (
+        std::equal(
+            built_suffix_array.SuffixOffsets.begin(),
+            built_suffix_array.SuffixOffsets.end(),
+            kjv_translation.SuffixArray.SuffixOffsets.begin(),
+            kjv_translation.SuffixArray.SuffixOffsets.end()) &&
+        std::equal(
+            built_suffix_array.LongestCommonPrefixLengths.begin(),
+            built_suffix_array.LongestCommonPrefixLengths.end(),
+            kjv_translation.SuffixArray.LongestCommonPrefixLengths.begin(),
+            kjv_translation.SuffixArray.LongestCommonPrefixLengths.end()));
+
+    std::cout
+        << "KJV Suffix Array Build (" << built_suffix_array.SuffixOffsets.size() << " suffixes): "
+        << build_time_in_milliseconds << " ms ("
+        << DescribeComparison(identical_to_current_suffix_array) << ")" << std::endl;
+}
+
+/// Benchmarks substring searches with the suffix array against searching the text of each verse.
+/// Substrings span partial words and multiple words, which the word index can't find.
+/// @param[in]  kjv_translation - The KJV translation to search.
+static void BenchmarkSubstringSearches(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    const std::string_view SUBSTRINGS[] = { "eth unto", "melchi", "righteous", "the lord" };
+    std::cout << "KJV Substring Searches:" << std::endl;
+    for (const std::string_view substring : SUBSTRINGS)
+    {
+        // TIME SEARCHING THE SUFFIX ARRAY.
+        constexpr std::size_t SUBSTRING_SEARCH_REPETITION_COUNT = 10;
+        std::vector<BIBLE_DATA::BibleVersePhraseMatch> matching_verses;
+        double suffix_array_time_in_microseconds = AverageTimeInMicroseconds(SUBSTRING_SEARCH_REPETITION_COUNT, [&]()
+        {
+            matching_verses = kjv_translation.SuffixArray.FindSubstring(substring);
+        });
+
+        // TIME SEARCHING THE TEXT OF EACH VERSE.
+        auto same_character_ignoring_case = [](const char left, const char right)
+        {
+            return std::tolower(static_cast<unsigned char>(left)) == std::tolower(static_cast<unsigned char>(right));
+        };
+        std::size_t scanned_occurrence_count = 0;
+        double scan_time_in_microseconds = AverageTimeInMicroseconds(SUBSTRING_SEARCH_REPETITION_COUNT, [&]()
+        {
+            scanned_occurrence_count = 0;
+            for (std::size_t verse_index = 0; verse_index < kjv_translation.VerseCharacterRanges.size(); ++verse_index)
+            {
+                std::string_view verse_text = kjv_translation.GetVerse(verse_index).Text;
+                auto occurrence = std::search(verse_text.cbegin(), verse_text.cend(), substring.cbegin(), substring.cend(), same_character_ignoring_case);
+                while (verse_text.cend() != occurrence)
+                {
+                    ++scanned_occurrence_count;
+                    occurrence = std::search(occurrence + 1, verse_text.cend(), substring.cbegin(), substring.cend(), same_character_ignoring_case);
+                }
+            }
+        });
+
+        // CHECK THAT BOTH APPROACHES FOUND THE SAME NUMBER OF OCCURRENCES.
+        std::size_t occurrence_count = 0;
+        for (const BIBLE_DATA::BibleVersePhraseMatch& matching_verse : matching_verses)
+        {
+            occurrence_count += matching_verse.MatchCharacterRanges.size();
+        }
+        bool identical_results = (occurrence_count == scanned_occurrence_count);
+
+        std::string description =
+            "\"" + std::string(substring) + "\": " + std::to_string(matching_verses.size()) + " verses, " +
+            std::to_string(occurrence_count) + " occurrences";
+        PrintComparison(description, suffix_array_time_in_microseconds, "verse scan", scan_time_in_microseconds, identical_results);
+    }
+}
+
+/// Benchmarks multi-threaded regular expression searches against a single-threaded baseline.
+/// @param[in]  kjv_translation - The KJV translation to search.
+static void BenchmarkRegexSearches(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    const std::string_view REGEX_PATTERNS[] = { "\\bsmit(e|ote|eth)\\b", "\\b[A-Z]\\w*el\\b", "eth unto (him|them)" };
+    unsigned int regex_thread_count = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "KJV Regex Searches (" << regex_thread_count << " threads):" << std::endl;
+    for (const std::string_view regex_pattern : REGEX_PATTERNS)
+    {
+        // TIME SEARCHING EACH VERSE WITH A SINGLE THREAD.
+        constexpr std::size_t REGEX_SEARCH_REPETITION_COUNT = 3;
+        std::regex regular_expression(regex_pattern.cbegin(), regex_pattern.cend(), std::regex::ECMAScript | std::regex::optimize);
+        std::size_t baseline_match_count = 0;
+        double baseline_time_in_microseconds = AverageTimeInMicroseconds(REGEX_SEARCH_REPETITION_COUNT, [&]()
+        {
+            baseline_match_count = 0;
+            for (std::size_t verse_index = 0; verse_index < kjv_translation.VerseCharacterRanges.size(); ++verse_index)
+            {
+                // std::cregex_iterator repeatedly calls std::regex_search to find all matches.
+                std::string_view verse_text = kjv_translation.GetVerse(verse_index).Text;
+                std::cregex_iterator end_of_matches;
+                for (std::cregex_iterator match(verse_text.data(), verse_text.data() + verse_text.size(), regular_expression); match != end_of_matches; ++match)
+                {
+                    if (match->length() > 0)
+                    {
+                        ++baseline_match_count;
+                    }
+                }
+            }
+        });
+
+        // TIME SEARCHING WITH MULTIPLE THREADS.
+        std::optional<std::vector<BIBLE_DATA::BibleVersePhraseMatch>> matching_verses;
+        double parallel_time_in_microseconds = AverageTimeInMicroseconds(REGEX_SEARCH_REPETITION_COUNT, [&]()
+        {
+            matching_verses = kjv_translation.RegexSearch(regex_pattern, regex_thread_count);
+        });
+
+        // CHECK THAT BOTH APPROACHES FOUND THE SAME NUMBER OF MATCHES.
+        std::size_t parallel_match_count = 0;
+        for (const BIBLE_DATA::BibleVersePhraseMatch& matching_verse : *matching_verses)
+        {
+            parallel_match_count += matching_verse.MatchCharacterRanges.size();
+        }
+        bool identical_results = (parallel_match_count == baseline_match_count);
+
+        std::string description =
+            std::string(regex_pattern) + ": " + std::to_string(matching_verses->size()) + " verses, " +
+            std::to_string(parallel_match_count) + " matches";
+        PrintComparison(description, parallel_time_in_microseconds, "single-threaded std::regex_search", baseline_time_in_microseconds, identical_results);
+    }
+}
+
+/// Benchmarks ranked searches against scoring and sorting all matching verses.
+/// @param[in]  kjv_translation - The KJV translation to search.
+static void BenchmarkRankedSearches(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    constexpr std::size_t MAX_RELEVANT_VERSE_COUNT = 10;
+    const std::string_view RANKED_QUERIES[] = { "the", "lord god", "faith hope charity", "love one another" };
+    std::cout << "KJV Ranked Searches (top " << MAX_RELEVANT_VERSE_COUNT << "):" << std::endl;
+    for (const std::string_view ranked_query : RANKED_QUERIES)
+    {
+        // TIME GETTING THE MOST RELEVANT VERSES.
+        constexpr std::size_t RANKED_SEARCH_REPETITION_COUNT = 10;
+        std::vector<BIBLE_DATA::BibleWordIndex::ScoredVerse> most_relevant_verses;
+        double ranked_search_time_in_microseconds = AverageTimeInMicroseconds(RANKED_SEARCH_REPETITION_COUNT, [&]()
+        {
+            most_relevant_verses = kjv_translation.WordIndex.GetMostRelevantVerses(ranked_query, MAX_RELEVANT_VERSE_COUNT);
+        });
+
+        // TIME SCORING AND SORTING ALL MATCHING VERSES.
+        // Verses with any of the words are found with a boolean query, put into a single category, and then fully sorted
+        // by verse index, with full verses only being produced once sorted.
+        std::string any_word_query_text(ranked_query);
+        for (std::size_t space_index = any_word_query_text.find(' '); std::string::npos != space_index; space_index = any_word_query_text.find(' ', space_index + 4))
+        {
+            any_word_query_text.replace(space_index, 1, " OR ");
+        }
+        std::optional<BIBLE_DATA::BibleWordQuery> any_word_query = BIBLE_DATA::BibleWordQuery::Parse(any_word_query_text);
+        std::vector<BIBLE_DATA::BibleVerse> sorted_verses;
+        double full_sort_time_in_microseconds = AverageTimeInMicroseconds(RANKED_SEARCH_REPETITION_COUNT, [&]()
+        {
+            BIBLE_DATA::BibleVerseSet matching_verses = any_word_query->Evaluate(kjv_translation.WordIndex);
+            BIBLE_DATA::CategorizedBibleVersesView sorted_search_results;
+            sorted_search_results.VersesFromOtherTestament = BIBLE_DATA::BibleVersesView::FromOwnedVerseIndices(
+                &kjv_translation,
+                std::move(matching_verses.VerseIndices));
+            kjv_translation.WordIndex.SortByRelevance(ranked_query, sorted_search_results);
+            sorted_verses.assign(sorted_search_results.VersesFromOtherTestament.begin(), sorted_search_results.VersesFromOtherTestament.end());
+        });
+
+        // CHECK THAT BOTH APPROACHES RANKED THE SAME VERSES FIRST.
+        bool identical_results = (most_relevant_verses.size() <= sorted_verses.size());
+        for (std::size_t rank = 0; identical_results && (rank < most_relevant_verses.size()); ++rank)
+        {
+            identical_results = (most_relevant_verses[rank].Verse.Id == sorted_verses[rank].Id);
+        }
+
+        std::string description = "\"" + std::string(ranked_query) + "\"";
+        std::string baseline_name = "scoring and sorting all " + std::to_string(sorted_verses.size()) + " matching verses";
+        PrintComparison(description, ranked_search_time_in_microseconds, baseline_name, full_sort_time_in_microseconds, identical_results);
+        for (const BIBLE_DATA::BibleWordIndex::ScoredVerse& scored_verse : most_relevant_verses)
+        {
+            std::cout
+                << "    " << scored_verse.RelevanceScore << " "
+                << BIBLE_DATA::BibleBook::FullName(scored_verse.Verse.Id.Book) << " " << scored_verse.Verse.Id.ChapterNumber << ":" << scored_verse.Verse.Id.VerseNumber << " "
+                << scored_verse.Verse.Text << std::endl;
+        }
+    }
+}
+
+/// Compares an index with compressed postings against one with uncompressed postings,
+/// for memory and for the kinds of searches done by the GUI and by boolean queries.
+/// Both are built at runtime so that this doesn't depend on how any precomputed index is stored.
+/// @param[in]  kjv_translation - The KJV translation to index.
+static void BenchmarkCompressedPostings(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    BIBLE_DATA::BibleWordIndex uncompressed_word_index = BIBLE_DATA::BibleWordIndex::Build(&kjv_translation);
+    BIBLE_DATA::BibleWordIndex compressed_word_index = BIBLE_DATA::BibleWordIndex::Build(&kjv_translation, 1, false, true);
+
+    // COMPARE SIZES.
+    std::size_t uncompressed_size_in_bytes = uncompressed_word_index.PostingVerseIndices.size_bytes();
+    std::size_t compressed_size_in_bytes = compressed_word_index.CompressedPostings.SizeInBytes();
+    std::cout
+        << "KJV Compressed Postings: " << compressed_size_in_bytes << " bytes (uncompressed: " << uncompressed_size_in_bytes << " bytes, "
+        << (100.0 * compressed_size_in_bytes / uncompressed_size_in_bytes) << "%), "
+        << compressed_word_index.MemoryUsage().TotalSizeInBytes() << " bytes for the full index (uncompressed: "
+        << uncompressed_word_index.MemoryUsage().TotalSizeInBytes() << " bytes)" << std::endl;
+
+    // TIME DECODING ALL POSTING LISTS.
+    constexpr std::size_t DECODE_REPETITION_COUNT = 20;
+    std::size_t word_count = compressed_word_index.WordCount();
+    std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex> decoded_verse_indices;
+    std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex> no_decoded_verse_indices;
+    bool identical_results = true;
+    double decode_time_in_microseconds = AverageTimeInMicroseconds(DECODE_REPETITION_COUNT, [&]()
+    {
+        for (std::size_t word_index = 0; word_index < word_count; ++word_index)
+        {
+            std::span<const BIBLE_DATA::BibleWordIndex::VerseIndex> verse_indices = compressed_word_index.GetVerseIndices(word_index, decoded_verse_indices);
+            identical_results = identical_results && std::ranges::equal(verse_indices, uncompressed_word_index.GetVerseIndices(word_index, no_decoded_verse_indices));
+        }
+    });
+
+    // TIME COPYING ALL UNCOMPRESSED POSTING LISTS.
+    // Comparisons are done the same as for decoding so that only decoding versus copying differs.
+    std::vector<BIBLE_DATA::BibleWordIndex::VerseIndex> copied_verse_indices;
+    double copy_time_in_microseconds = AverageTimeInMicroseconds(DECODE_REPETITION_COUNT, [&]()
+    {
+        for (std::size_t word_index = 0; word_index < word_count; ++word_index)
+        {
+            std::span<const BIBLE_DATA::BibleWordIndex::VerseIndex> verse_indices = uncompressed_word_index.GetVerseIndices(word_index, no_decoded_verse_indices);
+            copied_verse_indices.assign(verse_indices.begin(), verse_indices.end());
+            identical_results = identical_results && std::ranges::equal(copied_verse_indices, verse_indices);
+        }
+    });
+
+    std::string decode_description = "Decoding all " + std::to_string(uncompressed_word_index.PostingVerseIndices.size()) + " postings";
+    PrintComparison(decode_description, decode_time_in_microseconds, "copying uncompressed", copy_time_in_microseconds, identical_results);
+
+    // TIME DECODING THE ENTIRE INDEX ONCE.
+    // This is the one-time cost for a program to search uncompressed postings loaded from compressed storage.
+    constexpr std::size_t DECODE_INDEX_REPETITION_COUNT = 20;
+    BIBLE_DATA::BibleWordIndex decoded_word_index;
+    double decode_index_time_in_microseconds = AverageTimeInMicroseconds(DECODE_INDEX_REPETITION_COUNT, [&]()
+    {
+        decoded_word_index = compressed_word_index.WithUncompressedPostings();
+    });
+    bool identical_decoded_index = std::ranges::equal(decoded_word_index.PostingVerseIndices, uncompressed_word_index.PostingVerseIndices);
+    std::cout
+        << "Decoding the entire index: " << decode_index_time_in_microseconds << " microseconds, "
+        << DescribeComparison(identical_decoded_index) << std::endl;
+
+    // TIME CATEGORIZED WORD SEARCHES LIKE THE GUI DOES FOR EACH CLICKED WORD.
+    // Uncompressed postings are viewed directly, whereas compressed postings are decoded into a new buffer for each search.
+    const BIBLE_DATA::BibleVerseId CATEGORIZED_VERSE_ID = { BIBLE_DATA::BibleBook::Id::ROMANS, 5, 1 };
+    const std::string_view CATEGORIZED_WORDS[] = { "the", "lord", "faith" };
+    for (const std::string_view categorized_word : CATEGORIZED_WORDS)
+    {
+        constexpr std::size_t CATEGORIZING_REPETITION_COUNT = 100;
+        BIBLE_DATA::CategorizedBibleVersesView compressed_search_results;
+        std::size_t compressed_heap_allocation_count = g_heap_allocation_count;
+        double compressed_categorizing_time_in_microseconds = AverageTimeInMicroseconds(CATEGORIZING_REPETITION_COUNT, [&]()
+        {
+            compressed_search_results = compressed_word_index.GetMatchingVersesView(CATEGORIZED_VERSE_ID, categorized_word);
+        });
+        compressed_heap_allocation_count = (g_heap_allocation_count - compressed_heap_allocation_count) / CATEGORIZING_REPETITION_COUNT;
+
+        BIBLE_DATA::CategorizedBibleVersesView uncompressed_search_results;
+        std::size_t uncompressed_heap_allocation_count = g_heap_allocation_count;
+        double uncompressed_categorizing_time_in_microseconds = AverageTimeInMicroseconds(CATEGORIZING_REPETITION_COUNT, [&]()
+        {
+            uncompressed_search_results = uncompressed_word_index.GetMatchingVersesView(CATEGORIZED_VERSE_ID, categorized_word);
+        });
+        uncompressed_heap_allocation_count = (g_heap_allocation_count - uncompressed_heap_allocation_count) / CATEGORIZING_REPETITION_COUNT;
+
+        auto same_verses = [](const BIBLE_DATA::BibleVersesView& left_verses, const BIBLE_DATA::BibleVersesView& right_verses)
+        {
+            return std::ranges::equal(left_verses, right_verses, [](const BIBLE_DATA::BibleVerse& left, const BIBLE_DATA::BibleVerse& right)
+            {
+                return left.Id == right.Id;
+            });
+        };
+        bool identical_search_results = (
+            same_verses(compressed_search_results.VersesInSameChapter, uncompressed_search_results.VersesInSameChapter) &&
+            same_verses(compressed_search_results.VersesInSameBook, uncompressed_search_results.VersesInSameBook) &&
+            same_verses(compressed_search_results.VersesInOtherBooksByAuthor, uncompressed_search_results.VersesInOtherBooksByAuthor) &&
+            same_verses(compressed_search_results.VersesInBooksOfSameGenreByOtherAuthorsInSameTestament, uncompressed_search_results.VersesInBooksOfSameGenreByOtherAuthorsInSameTestament) &&
+            same_verses(compressed_search_results.VersesElsewhereInSameTestament, uncompressed_search_results.VersesElsewhereInSameTestament) &&
+            same_verses(compressed_search_results.VersesFromOtherTestament, uncompressed_search_results.VersesFromOtherTestament));
+        std::string description =
+            "Categorized \"" + std::string(categorized_word) + "\" (" + std::to_string(compressed_heap_allocation_count) + " vs. " +
+            std::to_string(uncompressed_heap_allocation_count) + " heap allocations)";
+        PrintComparison(description, compressed_categorizing_time_in_microseconds, "uncompressed", uncompressed_categorizing_time_in_microseconds, identical_search_results);
+    }
+
+    // TIME INTERSECTING PAIRS OF WORDS THROUGH BOOLEAN QUERIES ON EACH INDEX.
+    // Queries walk through postings with cursors, which skip over compressed blocks without decoding them.
+    const std::string_view INTERSECTION_QUERIES[] =
+    {
+        "faith AND the",
+        "lord AND the",
+        "charity AND and",
+    };
+    for (const std::string_view query_text : INTERSECTION_QUERIES)
+    {
+        std::optional<BIBLE_DATA::BibleWordQuery> query = BIBLE_DATA::BibleWordQuery::Parse(query_text);
+        constexpr std::size_t INTERSECTION_REPETITION_COUNT = 100;
+
+        BIBLE_DATA::BibleVerseSet compressed_query_verses;
+        double compressed_intersection_time_in_microseconds = AverageTimeInMicroseconds(INTERSECTION_REPETITION_COUNT, [&]()
+        {
+            compressed_query_verses = query->Evaluate(compressed_word_index);
+        });
+
+        BIBLE_DATA::BibleVerseSet uncompressed_query_verses;
+        double uncompressed_intersection_time_in_microseconds = AverageTimeInMicroseconds(INTERSECTION_REPETITION_COUNT, [&]()
+        {
+            uncompressed_query_verses = query->Evaluate(uncompressed_word_index);
+        });
+
+        bool identical_intersections = std::ranges::equal(
+            compressed_query_verses.GetVerses(),
+            uncompressed_query_verses.GetVerses(),
+            [](const BIBLE_DATA::BibleVerse& left, const BIBLE_DATA::BibleVerse& right)
+            {
+                return left.Id == right.Id;
+            });
+        std::string description = std::string(query_text) + ": " + std::to_string(compressed_query_verses.Count()) + " verses";
+        PrintComparison(description, compressed_intersection_time_in_microseconds, "uncompressed", uncompressed_intersection_time_in_microseconds, identical_intersections);
+    }
+}
+
+/// Benchmarks bitmap set operations against boolean queries.
+/// Getting each word's bitmap is timed separately since bitmaps can be reused across many operations.
+/// @param[in]  kjv_translation - The KJV translation to search.
+/// @param[in]  web_translation - The WEB translation, for comparing across translations.
+static void BenchmarkVerseBitmaps(const BIBLE_DATA::BibleTranslation& kjv_translation, const BIBLE_DATA::BibleTranslation& web_translation)
+{
+    std::cout << "KJV Verse Bitmaps:" << std::endl;
+    const std::pair<std::string_view, std::string_view> BITMAP_WORD_PAIRS[] =
+    {
+        { "the", "lord" },
+        { "and", "of" },
+        { "faith", "works" },
+    };
+    for (const auto& [first_word, second_word] : BITMAP_WORD_PAIRS)
+    {
+        // TIME GETTING BITMAPS FOR EACH WORD.
+        constexpr std::size_t BITMAP_REPETITION_COUNT = 100;
+        BIBLE_DATA::BibleVerseBitmap first_word_bitmap;
+        BIBLE_DATA::BibleVerseBitmap second_word_bitmap;
+        double bitmap_creation_time_in_microseconds = AverageTimeInMicroseconds(BITMAP_REPETITION_COUNT, [&]()
+        {
+            first_word_bitmap = kjv_translation.WordIndex.GetMatchingVerseBitmap(first_word);
+            second_word_bitmap = kjv_translation.WordIndex.GetMatchingVerseBitmap(second_word);
+        });
+
+        // TIME INTERSECTING THE BITMAPS.
+        BIBLE_DATA::BibleVerseBitmap intersected_bitmap;
+        std::size_t intersected_verse_count = 0;
+        double bitmap_intersection_time_in_microseconds = AverageTimeInMicroseconds(BITMAP_REPETITION_COUNT, [&]()
+        {
+            intersected_bitmap = first_word_bitmap;
+            intersected_bitmap.IntersectWith(second_word_bitmap);
+            intersected_verse_count = intersected_bitmap.Count();
+        });
+
+        // TIME THE SAME INTERSECTION AS A BOOLEAN QUERY.
+        std::string query_text = std::string(first_word) + " AND " + std::string(second_word);
+        std::optional<BIBLE_DATA::BibleWordQuery> query = BIBLE_DATA::BibleWordQuery::Parse(query_text);
+        BIBLE_DATA::BibleVerseSet query_verses;
+        double query_time_in_microseconds = AverageTimeInMicroseconds(BITMAP_REPETITION_COUNT, [&]()
+        {
+            query_verses = query->Evaluate(kjv_translation.WordIndex);
+        });
+
+        // FIND VERSES WITH THE FIRST WORD IN THE KJV BUT NOT THE WEB.
+        BIBLE_DATA::BibleVerseBitmap web_first_word_bitmap = web_translation.WordIndex.GetMatchingVerseBitmap(first_word);
+        BIBLE_DATA::BibleVerseBitmap kjv_only_bitmap = first_word_bitmap;
+        kjv_only_bitmap.Subtract(web_first_word_bitmap.ForTranslation(&kjv_translation));
+
+        bool identical_results = (intersected_bitmap.ToVerseSet().VerseIndices == query_verses.VerseIndices);
+        std::string description = query_text + ": " + std::to_string(intersected_verse_count) + " verses, intersecting and counting";
+        PrintComparison(description, bitmap_intersection_time_in_microseconds, "boolean query", query_time_in_microseconds, identical_results);
+        std::cout
+            << "    " << bitmap_creation_time_in_microseconds << " us to get bitmaps, "
+            << "\"" << first_word << "\" in KJV but not WEB: " << kjv_only_bitmap.Count() << " verses" << std::endl;
+    }
+}
+
+/// Benchmarks building the forward index for collocations and finding collocates with it.
+/// @param[in,out]  kjv_translation - The KJV translation, whose collocations are built.
+static void BenchmarkCollocations(BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    // TIME BUILDING THE FORWARD INDEX NEEDED FOR COLLOCATES.
+    double collocations_build_time_in_milliseconds = AverageTimeInMicroseconds(1, [&]()
+    {
+        kjv_translation.Collocations = BIBLE_DATA::BibleWordCollocations::Build(&kjv_translation);
+    }) / MICROSECONDS_PER_MILLISECOND;
+    std::cout << "KJV Collocations: " << collocations_build_time_in_milliseconds << " ms to build" << std::endl;
+
+    // TIME FINDING COLLOCATES FOR INDIVIDUAL WORDS.
+    // Very common words are included since they're the worst case for counting.
+    constexpr std::size_t MAX_COLLOCATE_COUNT = 10;
+    const std::string_view COLLOCATION_WORDS[] = { "grace", "faith", "lord", "the" };
+    const std::pair<BIBLE_DATA::BibleWordCollocations::ScoreType, std::string_view> SCORE_TYPES_AND_NAMES[] =
+    {
+        { BIBLE_DATA::BibleWordCollocations::ScoreType::POINTWISE_MUTUAL_INFORMATION, "PMI" },
+        { BIBLE_DATA::BibleWordCollocations::ScoreType::LOG_LIKELIHOOD_RATIO, "log-likelihood" },
+    };
+    for (const std::string_view collocation_word : COLLOCATION_WORDS)
+    {
+        std::optional<std::size_t> word_index = kjv_translation.WordIndex.FindWord(collocation_word);
+        if (!word_index)
+        {
+            continue;
+        }
+
+        for (const std::size_t verse_window_size : { 0, 2 })
+        {
+            for (const auto& [score_type, score_type_name] : SCORE_TYPES_AND_NAMES)
+            {
+                std::vector<BIBLE_DATA::BibleWordCollocations::Collocate> collocates;
+                double collocates_time_in_milliseconds = AverageTimeInMicroseconds(1, [&]()
+                {
+                    collocates = kjv_translation.Collocations.GetCollocates(
+                        *word_index,
+                        verse_window_size,
+                        score_type,
+                        MAX_COLLOCATE_COUNT);
+                }) / MICROSECONDS_PER_MILLISECOND;
+
+                std::cout
+                    << "\"" << collocation_word << "\" (" << kjv_translation.WordIndex.GetPostingCount(*word_index) << " occurrences, window "
+                    << verse_window_size << ", " << score_type_name << "): " << collocates_time_in_milliseconds << " ms:";
+                for (const BIBLE_DATA::BibleWordCollocations::Collocate& collocate : collocates)
+                {
+                    std::cout << " " << collocate.Word << "(" << collocate.CooccurrenceCount << ")";
+                }
+                std::cout << std::endl;
+            }
+        }
+    }
+
+    // TIME FINDING COLLOCATES FOR ALL WORDS WITH DIFFERENT NUMBERS OF THREADS.
+    unsigned int hardware_thread_count = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::vector<BIBLE_DATA::BibleWordCollocations::Collocate>> single_threaded_collocates_by_word;
+    for (const unsigned int thread_count : { 1u, hardware_thread_count })
+    {
+        std::vector<std::vector<BIBLE_DATA::BibleWordCollocations::Collocate>> collocates_by_word;
+        double all_collocates_time_in_milliseconds = AverageTimeInMicroseconds(1, [&]()
+        {
+            collocates_by_word = kjv_translation.Collocations.GetCollocatesForAllWords(
+                0,
+                BIBLE_DATA::BibleWordCollocations::ScoreType::LOG_LIKELIHOOD_RATIO,
+                MAX_COLLOCATE_COUNT,
+                thread_count);
+        }) / MICROSECONDS_PER_MILLISECOND;
+
+        // CHECK THAT THE SAME COLLOCATES WERE FOUND REGARDLESS OF THE NUMBER OF THREADS.
+        bool identical_results = true;
+        if (single_threaded_collocates_by_word.empty())
+        {
+            single_threaded_collocates_by_word = collocates_by_word;
+        }
+        else
+        {
+            identical_results = std::ranges::equal(
+                collocates_by_word,
+                single_threaded_collocates_by_word,
+                [](const auto& collocates, const auto& single_threaded_collocates)
+                {
+                    return std::ranges::equal(collocates, single_threaded_collocates, std::equal_to<>{}, &BIBLE_DATA::BibleWordCollocations::Collocate::WordIndex, &BIBLE_DATA::BibleWordCollocations::Collocate::WordIndex);
+                });
+        }
+
+        std::cout
+            << "All " << collocates_by_word.size() << " words (" << thread_count << " threads): " << all_collocates_time_in_milliseconds << " ms ("
+            << DescribeComparison(identical_results) << ")" << std::endl;
+    }
+}
+
+/// Benchmarks counting words in verse ranges and books against getting and filtering all matching verses.
+/// @param[in]  kjv_translation - The KJV translation to count words in.
+static void BenchmarkCountingOccurrences(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    std::cout << "KJV Range Counts:" << std::endl;
+    const std::pair<std::string_view, BIBLE_DATA::BibleVerseRange> COUNTED_WORDS_AND_RANGES[] =
+    {
+        { "the", BIBLE_DATA::BibleVerseRange { .StartingVerse = { BIBLE_DATA::BibleBook::Id::GENESIS, 1, 1 }, .EndingVerse = { BIBLE_DATA::BibleBook::Id::GENESIS, 50, 26 } } },
+        { "lord", BIBLE_DATA::BibleVerseRange { .StartingVerse = { BIBLE_DATA::BibleBook::Id::PSALMS, 1, 1 }, .EndingVerse = { BIBLE_DATA::BibleBook::Id::PSALMS, 150, 6 } } },
+        { "faith", BIBLE_DATA::BibleVerseRange { .StartingVerse = { BIBLE_DATA::BibleBook::Id::MATTHEW, 1, 1 }, .EndingVerse = { BIBLE_DATA::BibleBook::Id::REVELATION, 22, 21 } } },
+        { "grace", BIBLE_DATA::BibleVerseRange { .StartingVerse = { BIBLE_DATA::BibleBook::Id::ROMANS, 3, 21 }, .EndingVerse = { BIBLE_DATA::BibleBook::Id::ROMANS, 5, 21 } } },
+    };
+    for (const auto& [counted_word, verse_range] : COUNTED_WORDS_AND_RANGES)
     {
-        DEBUGGING::SystemClockTimer system_clock_timer("WEB System Clock Timer");
-        DEBUGGING::HighResolutionTimer high_resolution_timer("WEB High-Resolution Timer");
-        web_translation.Text = BIBLE_DATA::WEB_VERSE_TEXT;
-        web_translation.VerseCharacterRanges = BIBLE_DATA::WEB_VERSE_CHARACTER_RANGES;
-        web_translation.WordIndex = BIBLE_DATA::BibleWordIndex::Build(&web_translation);
+        // TIME COUNTING OCCURRENCES IN THE RANGE AND IN EACH BOOK.
+        constexpr std::size_t COUNT_REPETITION_COUNT = 1000;
+        std::size_t range_occurrence_count = 0;
+        double range_count_time_in_microseconds = AverageTimeInMicroseconds(COUNT_REPETITION_COUNT, [&]()
+        {
+            range_occurrence_count = kjv_translation.WordIndex.CountOccurrences(counted_word, verse_range);
+        });
+        std::map<BIBLE_DATA::BibleBook::Id, std::size_t> occurrence_counts_by_book;
+        double book_counts_time_in_microseconds = AverageTimeInMicroseconds(COUNT_REPETITION_COUNT, [&]()
+        {
+            occurrence_counts_by_book = kjv_translation.WordIndex.CountOccurrencesByBook(counted_word);
+        });
+
+        // TIME GETTING ALL MATCHING VERSES AND BUCKETING THEM BY BOOK.
+        // This is how counts were previously computed for the statistics window.
+        constexpr std::size_t MATCHING_VERSES_REPETITION_COUNT = 10;
+        std::size_t baseline_range_occurrence_count = 0;
+        std::map<BIBLE_DATA::BibleBook::Id, std::size_t> baseline_occurrence_counts_by_book;
+        double matching_verses_time_in_microseconds = AverageTimeInMicroseconds(MATCHING_VERSES_REPETITION_COUNT, [&]()
+        {
+            baseline_range_occurrence_count = 0;
+            baseline_occurrence_counts_by_book.clear();
+            std::vector<BIBLE_DATA::BibleVerse> matching_verses = kjv_translation.WordIndex.GetMatchingVerses(counted_word);
+            for (const BIBLE_DATA::BibleVerse& verse : matching_verses)
+            {
+                ++baseline_occurrence_counts_by_book[verse.Id.Book];
+                bool verse_in_range = !(verse.Id < verse_range.StartingVerse) && !(verse_range.EndingVerse < verse.Id);
+                if (verse_in_range)
+                {
+                    ++baseline_range_occurrence_count;
+                }
+            }
+        });
+
+        // The baseline computes both counts at once, so it's compared against the combined time for both counts.
+        bool identical_results = (range_occurrence_count == baseline_range_occurrence_count) && (occurrence_counts_by_book == baseline_occurrence_counts_by_book);
+        std::string description =
+            "\"" + std::string(counted_word) + "\": " + std::to_string(range_occurrence_count) + " in range, " +
+            std::to_string(occurrence_counts_by_book.size()) + " books";
+        PrintComparison(
+            description,
+            range_count_time_in_microseconds + book_counts_time_in_microseconds,
+            "matching verses",
+            matching_verses_time_in_microseconds,
+            identical_results);
+        std::cout
+            << "    " << range_count_time_in_microseconds << " us in range, "
+            << book_counts_time_in_microseconds << " us by book" << std::endl;
     }
+}
+
+/// Benchmarks building the stem index and searching with each type of word matching.
+/// @param[in]  kjv_translation - The KJV translation, whose stem index is built on first use here.
+static void BenchmarkStemIndex(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    // TIME BUILDING THE STEM INDEX.
+    // It's built on its first use, which is timed like the first stem search would be.
+    const BIBLE_DATA::BibleWordIndex::StemIndex* stem_index_pointer = nullptr;
+    double stem_index_build_time_in_milliseconds = AverageTimeInMicroseconds(1, [&]()
+    {
+        stem_index_pointer = kjv_translation.WordIndex.GetStemIndex();
+    }) / MICROSECONDS_PER_MILLISECOND;
+
+    // CALCULATE THE MEMORY USED BY THE STEM INDEX.
+    const BIBLE_DATA::BibleWordIndex::StemIndex& stem_index = *stem_index_pointer;
+    std::size_t stem_count = stem_index.StemOffsets.size() - 1;
+    std::size_t stem_index_size_in_bytes =
+        stem_index.StemCharacters.size() +
+        sizeof(std::uint32_t) * (stem_index.StemOffsets.size() + stem_index.LexiconStemIndices.size() + stem_index.StemWordOffsets.size() + stem_index.StemWordIndices.size());
+    std::cout
+        << "KJV Stem Index: " << stem_index_build_time_in_milliseconds << " ms to build, "
+        << stem_count << " stems for " << kjv_translation.WordIndex.WordCount() << " words, " << stem_index_size_in_bytes << " bytes" << std::endl;
 
+    // TIME SEARCHING WITH EACH TYPE OF WORD MATCHING.
+    const std::pair<BIBLE_DATA::BibleWordIndex::WordMatchType, std::string_view> WORD_MATCH_TYPES_AND_NAMES[] =
     {
-        DEBUGGING::SystemClockTimer system_clock_timer("WEB Print System Clock Timer");
-        DEBUGGING::HighResolutionTimer high_resolution_timer("WEB Print High-Resolution Timer");
-        
-        std::cout << "WEB Word Index:" << std::endl;
-        for (const auto&[word, verses] : web_translation.WordIndex.BibleVersesByWord)
+        { BIBLE_DATA::BibleWordIndex::WordMatchType::EXACT, "exact" },
+        { BIBLE_DATA::BibleWordIndex::WordMatchType::ROOT_WORD, "root word" },
+        { BIBLE_DATA::BibleWordIndex::WordMatchType::STEM, "stem" },
+    };
+    const std::string_view STEMMED_WORDS[] = { "believe", "loved", "walking", "righteousness" };
+    for (const std::string_view stemmed_word : STEMMED_WORDS)
+    {
+        std::cout << "\"" << stemmed_word << "\" (stem: " << BIBLE_DATA::BibleWordIndex::StemWord(stemmed_word) << "):";
+        for (const auto& [match_type, match_type_name] : WORD_MATCH_TYPES_AND_NAMES)
         {
-            std::size_t verse_count = verses.size();
-            std::cout << word << " = " << verse_count << std::endl;
+            std::vector<BIBLE_DATA::BibleVerse> matching_verses;
+            double search_time_in_microseconds = AverageTimeInMicroseconds(1, [&]()
+            {
+                matching_verses = kjv_translation.WordIndex.GetMatchingVerses(stemmed_word, match_type);
+            });
+            std::cout << " " << match_type_name << ": " << matching_verses.size() << " (" << search_time_in_microseconds << " us)";
         }
+        std::cout << std::endl;
     }
+}
+
+/// Benchmarks saving and loading word index files against building indexes.
+/// @param[in]  kjv_translation - The KJV translation, whose index is saved and loaded.
+/// @param[in]  web_translation - The WEB translation, which the saved KJV index must be rejected for.
+static void BenchmarkWordIndexFiles(const BIBLE_DATA::BibleTranslation& kjv_translation, const BIBLE_DATA::BibleTranslation& web_translation)
+{
+    // TIME BUILDING AN INDEX.
+    // Postings are compressed like for indexes saved by the program.
+    BIBLE_DATA::BibleWordIndex built_word_index;
+    double index_build_time_in_milliseconds = AverageTimeInMicroseconds(1, [&]()
+    {
+        built_word_index = BIBLE_DATA::BibleWordIndex::Build(&kjv_translation, 1, true, true);
+    }) / MICROSECONDS_PER_MILLISECOND;
+
+    // TIME SAVING THE INDEX.
+    std::filesystem::path word_index_filepath = std::filesystem::temp_directory_path() / "WordIndex_KJV.bin";
+    bool index_saved = false;
+    double index_save_time_in_milliseconds = AverageTimeInMicroseconds(1, [&]()
+    {
+        index_saved = BIBLE_DATA::BibleWordIndexFile::Save(built_word_index, word_index_filepath);
+    }) / MICROSECONDS_PER_MILLISECOND;
+
+    // TIME LOADING THE INDEX.
+    std::optional<BIBLE_DATA::BibleWordIndex> loaded_word_index;
+    double index_load_time_in_milliseconds = AverageTimeInMicroseconds(1, [&]()
+    {
+        loaded_word_index = BIBLE_DATA::BibleWordIndexFile::Load(&kjv_translation, word_index_filepath);
+    }) / MICROSECONDS_PER_MILLISECOND;
+
+    // CHECK THAT THE LOADED INDEX MATCHES THE BUILT INDEX.
+    bool identical_indexes = loaded_word_index &&
+        (loaded_word_index->LexiconCharacters == built_word_index.LexiconCharacters) &&
+        std::ranges::equal(loaded_word_index->LexiconWordOffsets, built_word_index.LexiconWordOffsets) &&
+        std::ranges::equal(loaded_word_index->PostingVerseIndices, built_word_index.PostingVerseIndices) &&
+        std::ranges::equal(loaded_word_index->PostingOffsets, built_word_index.PostingOffsets) &&
+        std::ranges::equal(loaded_word_index->PostingTokenPositions, built_word_index.PostingTokenPositions) &&
+        std::ranges::equal(loaded_word_index->VerseWordCounts, built_word_index.VerseWordCounts) &&
+        std::ranges::equal(loaded_word_index->WordVerseCounts, built_word_index.WordVerseCounts) &&
+        std::ranges::equal(loaded_word_index->CompressedPostings.WordFirstBlockIndices, built_word_index.CompressedPostings.WordFirstBlockIndices) &&
+        std::ranges::equal(loaded_word_index->CompressedPostings.EncodedBytes, built_word_index.CompressedPostings.EncodedBytes) &&
+        std::ranges::equal(
+            loaded_word_index->CompressedPostings.Blocks,
+            built_word_index.CompressedPostings.Blocks,
+            [](const BIBLE_DATA::CompressedPostingLists::Block& left, const BIBLE_DATA::CompressedPostingLists::Block& right)
+            {
+                return (left.ByteOffset == right.ByteOffset) && (left.LastVerseIndex == right.LastVerseIndex) && (left.PostingCount == right.PostingCount);
+            });
+
+    // CHECK THAT THE INDEX ISN'T USED FOR A DIFFERENT TRANSLATION.
+    std::optional<BIBLE_DATA::BibleWordIndex> mismatched_word_index = BIBLE_DATA::BibleWordIndexFile::Load(&web_translation, word_index_filepath);
+
+    std::error_code file_size_error;
+    std::uintmax_t file_size_in_bytes = std::filesystem::file_size(word_index_filepath, file_size_error);
+    std::cout
+        << "KJV Word Index File: " << (file_size_error ? 0 : file_size_in_bytes) << " bytes, "
+        << index_build_time_in_milliseconds << " ms to build, "
+        << index_save_time_in_milliseconds << " ms to save (" << (index_saved ? "saved" : "FAILED") << "), "
+        << index_load_time_in_milliseconds << " ms to load (" << DescribeComparison(identical_indexes) << "), "
+        << "WEB load " << (mismatched_word_index ? "INCORRECTLY ACCEPTED" : "rejected") << std::endl;
+
+    // Loaded indexes keep the file mapped, so they must be destroyed before the file can be deleted on all platforms.
+    loaded_word_index.reset();
+    std::error_code remove_error;
+    std::filesystem::remove(word_index_filepath, remove_error);
+}
+
+/// Benchmarks batch queries with different numbers of threads against querying each word separately.
+/// Every word in the lexicon is queried (in its original case) to match large offline jobs.
+/// @param[in]  kjv_translation - The KJV translation to query.
+static void BenchmarkBatchQueries(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    constexpr double MICROSECONDS_PER_SECOND = 1'000'000.0;
+
+    std::vector<std::string> batch_words;
+    std::size_t lexicon_word_count = kjv_translation.WordIndex.WordCount();
+    for (std::size_t word_index = 0; word_index < lexicon_word_count; ++word_index)
+    {
+        std::string batch_word(kjv_translation.WordIndex.GetWord(word_index));
+        batch_word[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(batch_word[0])));
+        batch_words.push_back(batch_word);
+    }
+    std::vector<std::string_view> batch_word_views(batch_words.cbegin(), batch_words.cend());
+
+    // TIME QUERYING EACH WORD SEPARATELY.
+    std::vector<std::vector<BIBLE_DATA::BibleVerse>> separate_matching_verses;
+    separate_matching_verses.reserve(batch_word_views.size());
+    double separate_queries_time_in_microseconds = AverageTimeInMicroseconds(1, [&]()
+    {
+        for (const std::string_view batch_word : batch_word_views)
+        {
+            separate_matching_verses.push_back(kjv_translation.WordIndex.GetMatchingVerses(batch_word));
+        }
+    });
+    std::cout
+        << "KJV Batch Queries: " << batch_word_views.size() << " words, separate queries: "
+        << (batch_word_views.size() * MICROSECONDS_PER_SECOND / separate_queries_time_in_microseconds) << " queries/second" << std::endl;
+
+    // TIME BATCHES WITH DIFFERENT NUMBERS OF THREADS.
+    // The same storage is reused for each batch like in a long-running job.
+    BIBLE_DATA::BibleWordIndex::MatchingVersesBatch matching_verses_batch;
+    unsigned int hardware_thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    for (const unsigned int thread_count : { 1u, hardware_thread_count })
+    {
+        double batch_time_in_microseconds = AverageTimeInMicroseconds(1, [&]()
+        {
+            kjv_translation.WordIndex.GetMatchingVersesBatch(batch_word_views, matching_verses_batch, BIBLE_DATA::BibleWordIndex::WordMatchType::ROOT_WORD, thread_count);
+        });
+
+        bool identical_results = true;
+        for (std::size_t word_index = 0; word_index < batch_word_views.size(); ++word_index)
+        {
+            std::span<const BIBLE_DATA::BibleVerse> batch_verses = matching_verses_batch.GetVerses(word_index);
+            const std::vector<BIBLE_DATA::BibleVerse>& separate_verses = separate_matching_verses[word_index];
+            identical_results = identical_results && std::ranges::equal(batch_verses, separate_verses, [](const BIBLE_DATA::BibleVerse& left, const BIBLE_DATA::BibleVerse& right)
+            {
+                return left.Id == right.Id;
+            });
+        }
+
+        double queries_per_second = batch_word_views.size() * MICROSECONDS_PER_SECOND / batch_time_in_microseconds;
+        std::cout
+            << "\t" << thread_count << " threads: " << queries_per_second << " queries/second, "
+            << (queries_per_second / thread_count) << " queries/second/core ("
+            << DescribeComparison(identical_results) << ")" << std::endl;
+    }
+}
+
+/// Categorizes verses with a word relative to another verse by looking up attributes for every verse.
+/// This is how verses were previously categorized, with author, testament, and genre looked up for every verse.
+/// @param[in]  translation - The translation to search.
+/// @param[in]  verse_id - The verse that matching verses are categorized relative to.
+/// @param[in]  word - The word to search for.
+/// @return The categorized matching verses.
+static BIBLE_DATA::CategorizedBibleVerseSearchResults CategorizeVersesByLookingUpAttributes(
+    const BIBLE_DATA::BibleTranslation& translation,
+    const BIBLE_DATA::BibleVerseId& verse_id,
+    const std::string_view word)
+{
+    BIBLE_DATA::CategorizedBibleVerseSearchResults search_results;
+    for (const BIBLE_DATA::BibleVerse& current_verse : translation.WordIndex.GetMatchingVerses(word))
+    {
+        bool in_same_book = (verse_id.Book == current_verse.Id.Book);
+        if (in_same_book)
+        {
+            bool in_same_chapter = (verse_id.ChapterNumber == current_verse.Id.ChapterNumber);
+            if (!in_same_chapter)
+            {
+                search_results.VersesInSameBook.push_back(current_verse);
+            }
+            else if (verse_id.VerseNumber != current_verse.Id.VerseNumber)
+            {
+                search_results.VersesInSameChapter.push_back(current_verse);
+            }
+        }
+        else if (BIBLE_DATA::BibleAuthor::Get(verse_id) == BIBLE_DATA::BibleAuthor::Get(current_verse.Id))
+        {
+            search_results.VersesInOtherBooksByAuthor.push_back(current_verse);
+        }
+        else if (BIBLE_DATA::BibleTestament::Get(verse_id) != BIBLE_DATA::BibleTestament::Get(current_verse.Id))
+        {
+            search_results.VersesFromOtherTestament.push_back(current_verse);
+        }
+        else if (BIBLE_DATA::BibleBookGenre::Get(verse_id) == BIBLE_DATA::BibleBookGenre::Get(current_verse.Id))
+        {
+            search_results.VersesInBooksOfSameGenreByOtherAuthorsInSameTestament.push_back(current_verse);
+        }
+        else
+        {
+            search_results.VersesElsewhereInSameTestament.push_back(current_verse);
+        }
+    }
+    return search_results;
+}
+
+/// Benchmarks categorizing verses against categorizing by looking up attributes for every verse.
+/// The most frequent words have the longest posting lists, so they're the worst case.
+/// @param[in]  kjv_translation - The KJV translation to search.
+static void BenchmarkCategorizing(const BIBLE_DATA::BibleTranslation& kjv_translation)
+{
+    std::cout << "KJV Categorized Verses:" << std::endl;
+    auto same_verses = [](const std::vector<BIBLE_DATA::BibleVerse>& left_verses, const std::vector<BIBLE_DATA::BibleVerse>& right_verses)
+    {
+        return std::ranges::equal(left_verses, right_verses, [](const BIBLE_DATA::BibleVerse& left, const BIBLE_DATA::BibleVerse& right)
+        {
+            return left.Id == right.Id;
+        });
+    };
+
+    const BIBLE_DATA::BibleVerseId CATEGORIZED_VERSE_ID = { BIBLE_DATA::BibleBook::Id::ROMANS, 5, 1 };
+    const std::string_view CATEGORIZED_WORDS[] = { "the", "lord", "and", "faith" };
+    for (const std::string_view categorized_word : CATEGORIZED_WORDS)
+    {
+        constexpr std::size_t CATEGORIZING_REPETITION_COUNT = 100;
+        BIBLE_DATA::CategorizedBibleVerseSearchResults search_results;
+        double categorizing_time_in_microseconds = AverageTimeInMicroseconds(CATEGORIZING_REPETITION_COUNT, [&]()
+        {
+            search_results = kjv_translation.WordIndex.GetMatchingVerses(CATEGORIZED_VERSE_ID, categorized_word);
+        });
+
+        BIBLE_DATA::CategorizedBibleVerseSearchResults baseline_search_results;
+        double baseline_time_in_microseconds = AverageTimeInMicroseconds(CATEGORIZING_REPETITION_COUNT, [&]()
+        {
+            baseline_search_results = CategorizeVersesByLookingUpAttributes(kjv_translation, CATEGORIZED_VERSE_ID, categorized_word);
+        });
+
+        bool identical_results = (
+            same_verses(search_results.VersesInSameChapter, baseline_search_results.VersesInSameChapter) &&
+            same_verses(search_results.VersesInSameBook, baseline_search_results.VersesInSameBook) &&
+            same_verses(search_results.VersesInOtherBooksByAuthor, baseline_search_results.VersesInOtherBooksByAuthor) &&
+            same_verses(search_results.VersesInBooksOfSameGenreByOtherAuthorsInSameTestament, baseline_search_results.VersesInBooksOfSameGenreByOtherAuthorsInSameTestament) &&
+            same_verses(search_results.VersesElsewhereInSameTestament, baseline_search_results.VersesElsewhereInSameTestament) &&
+            same_verses(search_results.VersesFromOtherTestament, baseline_search_results.VersesFromOtherTestament));
+        std::string description =
+            "\"" + std::string(categorized_word) + "\": " + std::to_string(kjv_translation.WordIndex.GetMatchingVerses(categorized_word).size()) + " postings";
+        PrintComparison(description, categorizing_time_in_microseconds, "looking up attributes", baseline_time_in_microseconds, identical_results);
+    }
+}
+
+/// Benchmarks streaming matching verses against getting them all at once.
+/// The most frequent word across all translations is the worst case for storing all matching verses.
+/// @param[in]  kjv_translation - The KJV translation to search.
+/// @param[in]  web_translation - The WEB translation to search.
+static void BenchmarkStreamingVerses(const BIBLE_DATA::BibleTranslation& kjv_translation, const BIBLE_DATA::BibleTranslation& web_translation)
+{
+    std::cout << "Streaming Matching Verses:" << std::endl;
+    for (const auto& [translation_name, translation] : { std::pair("KJV", &kjv_translation), std::pair("WEB", &web_translation) })
+    {
+        constexpr std::string_view STREAMED_WORD = "the";
+
+        // TIME GETTING ALL MATCHING VERSES AT ONCE.
+        std::vector<BIBLE_DATA::BibleVerse> matching_verses;
+        std::size_t vector_character_count = 0;
+        std::size_t heap_allocation_count_before_vector = g_heap_allocation_count;
+        double vector_time_in_microseconds = AverageTimeInMicroseconds(1, [&]()
+        {
+            matching_verses = translation->WordIndex.GetMatchingVerses(STREAMED_WORD);
+            for (const BIBLE_DATA::BibleVerse& verse : matching_verses)
+            {
+                vector_character_count += verse.Text.size();
+            }
+        });
+        std::size_t vector_heap_allocation_count = g_heap_allocation_count - heap_allocation_count_before_vector;
+
+        // TIME STREAMING MATCHING VERSES.
+        std::size_t streamed_verse_count = 0;
+        std::size_t streamed_character_count = 0;
+        std::size_t heap_allocation_count_before_streaming = g_heap_allocation_count;
+        double streaming_time_in_microseconds = AverageTimeInMicroseconds(1, [&]()
+        {
+            translation->WordIndex.ForEachMatchingVerse(STREAMED_WORD, [&](const BIBLE_DATA::BibleVerse& verse)
+            {
+                ++streamed_verse_count;
+                streamed_character_count += verse.Text.size();
+                return true;
+            });
+        });
+        std::size_t streaming_heap_allocation_count = g_heap_allocation_count - heap_allocation_count_before_streaming;
+
+        // CHECK THAT STREAMING CAN BE STOPPED EARLY.
+        constexpr std::size_t EARLY_TERMINATION_VERSE_COUNT = 10;
+        std::size_t early_terminated_verse_count = 0;
+        bool visited_all_verses = translation->WordIndex.ForEachMatchingVerse(STREAMED_WORD, [&](const BIBLE_DATA::BibleVerse&)
+        {
+            ++early_terminated_verse_count;
+            return (early_terminated_verse_count < EARLY_TERMINATION_VERSE_COUNT);
+        });
+
+        bool identical_results = (
+            (matching_verses.size() == streamed_verse_count) &&
+            (vector_character_count == streamed_character_count) &&
+            !visited_all_verses &&
+            (EARLY_TERMINATION_VERSE_COUNT == early_terminated_verse_count));
+        std::string description =
+            "\t" + std::string(translation_name) + " \"" + std::string(STREAMED_WORD) + "\": " + std::to_string(streamed_verse_count) + " verses, streaming";
+        PrintComparison(description, streaming_time_in_microseconds, "all at once", vector_time_in_microseconds, identical_results);
+        std::cout
+            << "\t    " << streaming_heap_allocation_count << " allocations streaming vs. "
+            << vector_heap_allocation_count << " allocations and " << (matching_verses.size() * sizeof(BIBLE_DATA::BibleVerse)) << " bytes all at once" << std::endl;
+    }
+}
+
+/// Prints the memory used by each component of each translation.
+/// @param[in]  kjv_translation - The KJV translation.
+/// @param[in]  web_translation - The WEB translation.
+static void PrintMemoryUsage(const BIBLE_DATA::BibleTranslation& kjv_translation, const BIBLE_DATA::BibleTranslation& web_translation)
+{
+    for (const auto& [translation_name, translation] : { std::pair("KJV", &kjv_translation), std::pair("WEB", &web_translation) })
+    {
+        BIBLE_DATA::MemoryUsageReport memory_usage = translation->MemoryUsage();
+        std::cout << translation_name << " Memory Usage: " << memory_usage.TotalSizeInBytes() << " bytes" << std::endl;
+        for (const BIBLE_DATA::MemoryUsageReport::Component& component : memory_usage.Components)
+        {
+            std::cout << "\t" << component.Name << " = " << component.SizeInBytes << " bytes" << std::endl;
+        }
+    }
+}
+
+/// Prints information about word indexes and benchmarks searching them.
+/// @param[in]  argument_count - The number of command line arguments.
+/// @param[in]  arguments - The command line arguments.  If --self-check is passed,
+///     only self-checks (see SelfChecks) are run instead of benchmarks.
+/// @return EXIT_SUCCESS if the program succeeded (including all self-checks passing); EXIT_FAILURE otherwise.
+int main(int argument_count, char* arguments[])
+{
+    constexpr std::string_view SECTION_SEPARATOR = "---------------------------------------------------";
+
+    BIBLE_DATA::BibleTranslation kjv_translation;
+    LoadKjvTranslation(kjv_translation);
+    PrintWordIndex("KJV", kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+
+    BIBLE_DATA::BibleTranslation web_translation;
+    LoadWebTranslation(web_translation);
+    PrintWordIndex("WEB", web_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+
+    // RUN ONLY THE SELF-CHECKS IF REQUESTED.
+    constexpr std::string_view SELF_CHECK_ARGUMENT = "--self-check";
+    bool self_checks_requested = (argument_count > 1) && (SELF_CHECK_ARGUMENT == arguments[1]);
+    if (self_checks_requested)
+    {
+        bool self_checks_passed = SelfChecks::Run(kjv_translation, web_translation);
+        return self_checks_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    BenchmarkBuildScaling(kjv_translation, web_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkRootWordLookups(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkBooleanQueries(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkWordCompletions(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkSimilarWords(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkSuffixArray(kjv_translation);
+    BenchmarkSubstringSearches(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkRegexSearches(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkRankedSearches(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkCompressedPostings(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkVerseBitmaps(kjv_translation, web_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkCollocations(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkCountingOccurrences(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkStemIndex(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkWordIndexFiles(kjv_translation, web_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkBatchQueries(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkCategorizing(kjv_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    BenchmarkStreamingVerses(kjv_translation, web_translation);
+    std::cout << SECTION_SEPARATOR << std::endl;
+    PrintMemoryUsage(kjv_translation, web_translation);
 
     return EXIT_SUCCESS;
 }